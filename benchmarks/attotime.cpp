@@ -0,0 +1,89 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "osdcore.h"
+#include "emucore.h"
+#include "eminline.h"
+#include "attotime.h"
+#include <vector>
+
+// attotime arithmetic the way the scheduler uses it: stepping by a clock
+// period, finding the earliest of a set of expiry times, scaling periods by
+// cycle counts and converting to and from clock ticks
+
+static const u32 BENCH_CLOCK = 3579545;
+
+static void BM_attotime_add(benchmark::State& state) {
+	const attotime period = attotime::from_hz(BENCH_CLOCK);
+	attotime now = attotime::zero;
+	while (state.KeepRunning()) {
+		now += period;
+		benchmark::DoNotOptimize(now);
+	}
+}
+BENCHMARK(BM_attotime_add);
+
+static void BM_attotime_sub(benchmark::State& state) {
+	const attotime period = attotime::from_hz(BENCH_CLOCK);
+	attotime now = attotime::from_seconds(1000);
+	while (state.KeepRunning()) {
+		now -= period;
+		benchmark::DoNotOptimize(now);
+	}
+}
+BENCHMARK(BM_attotime_sub);
+
+static void BM_attotime_min(benchmark::State& state) {
+	std::vector<attotime> expiry(state.range(0));
+	u32 seed = 0x12345678;
+	for (auto & elem : expiry) {
+		seed = seed * 1103515245 + 12345;
+		elem = attotime(seed >> 28, attoseconds_t(seed) * 1000000);
+	}
+	while (state.KeepRunning()) {
+		attotime earliest = attotime::never;
+		for (auto & elem : expiry)
+			earliest = min(earliest, elem);
+		benchmark::DoNotOptimize(earliest);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * expiry.size());
+}
+BENCHMARK(BM_attotime_min)->Arg(8)->Arg(64);
+
+static void BM_attotime_mul(benchmark::State& state) {
+	const attotime period = attotime::from_hz(BENCH_CLOCK);
+	u32 cycles = 1;
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(period * cycles);
+		cycles = (cycles * 5 + 1) & 0xffff;
+	}
+}
+BENCHMARK(BM_attotime_mul);
+
+static void BM_attotime_div(benchmark::State& state) {
+	const attotime frame = attotime::from_hz(60);
+	u32 divisor = 1;
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(frame / divisor);
+		divisor = (divisor * 5 + 1) & 0xffff;
+	}
+}
+BENCHMARK(BM_attotime_div);
+
+static void BM_attotime_as_ticks(benchmark::State& state) {
+	const attotime period = attotime::from_hz(BENCH_CLOCK / 7);
+	attotime now = attotime::from_seconds(3);
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(now.as_ticks(BENCH_CLOCK));
+		now += period;
+	}
+}
+BENCHMARK(BM_attotime_as_ticks);
+
+static void BM_attotime_from_ticks(benchmark::State& state) {
+	u64 ticks = 12345;
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(attotime::from_ticks(ticks, BENCH_CLOCK));
+		ticks += 7;
+	}
+}
+BENCHMARK(BM_attotime_from_ticks);
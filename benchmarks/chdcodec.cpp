@@ -0,0 +1,138 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "osdcore.h"
+#include "chd.h"
+#include "cdrom.h"
+#include <memory>
+#include <stdlib.h>
+
+// decode throughput of each CHD codec on the first hunks of a real image;
+// set CHD_BENCH_IMAGE to the path of an uncompressed or compressed CHD
+
+static const uint32_t BENCH_HUNKS = 64;
+
+struct chd_bench_image {
+	chd_file chd;
+	std::vector<std::vector<uint8_t>> hunks;
+	bool valid;
+
+	chd_bench_image() : valid(false) {
+		const char *path = getenv("CHD_BENCH_IMAGE");
+		if (path == nullptr || chd.open(path) != CHDERR_NONE)
+			return;
+		uint32_t count = std::min(chd.hunk_count(), BENCH_HUNKS);
+		hunks.resize(count);
+		for (uint32_t hunknum = 0; hunknum < count; hunknum++) {
+			hunks[hunknum].resize(chd.hunk_bytes());
+			if (chd.read_hunk(hunknum, &hunks[hunknum][0]) != CHDERR_NONE)
+				return;
+		}
+		valid = true;
+	}
+};
+
+static chd_bench_image &bench_image()
+{
+	static chd_bench_image image;
+	return image;
+}
+
+template<chd_codec_type Codec>
+static void BM_chd_decompress(benchmark::State& state) {
+	chd_bench_image &image = bench_image();
+	if (!image.valid) {
+		state.SkipWithError("CHD_BENCH_IMAGE not set or unreadable");
+		return;
+	}
+
+	// the CD codecs need whole frames in each hunk
+	const uint32_t hunkbytes = image.chd.hunk_bytes();
+	const bool cd_codec = (Codec >> 24) == 'c' && ((Codec >> 16) & 0xff) == 'd';
+	if (cd_codec && (hunkbytes % CD_FRAME_SIZE) != 0) {
+		state.SkipWithError("image is not a CD");
+		return;
+	}
+
+	// compress each hunk once up front; hunks the codec can't shrink are left out
+	std::unique_ptr<chd_compressor> compressor(chd_codec_list::new_compressor(Codec, image.chd));
+	std::unique_ptr<chd_decompressor> decompressor(chd_codec_list::new_decompressor(Codec, image.chd));
+	std::vector<std::vector<uint8_t>> compressed;
+	std::vector<const std::vector<uint8_t> *> originals;
+	uint64_t inbytes = 0, outbytes = 0;
+	for (auto &hunk : image.hunks) {
+		std::vector<uint8_t> dest(hunkbytes);
+		try {
+			dest.resize(compressor->compress(&hunk[0], hunkbytes, &dest[0]));
+		} catch (...) {
+			continue;
+		}
+		inbytes += hunkbytes;
+		outbytes += dest.size();
+		compressed.push_back(std::move(dest));
+		originals.push_back(&hunk);
+	}
+	if (compressed.empty()) {
+		state.SkipWithError("codec compressed no hunks");
+		return;
+	}
+
+	// the round trip must be bit-exact
+	std::vector<uint8_t> output(hunkbytes);
+	for (size_t index = 0; index < compressed.size(); index++) {
+		decompressor->decompress(&compressed[index][0], compressed[index].size(), &output[0], hunkbytes);
+		if (output != *originals[index]) {
+			state.SkipWithError("decompressed data does not match");
+			return;
+		}
+	}
+
+	size_t index = 0;
+	while (state.KeepRunning()) {
+		decompressor->decompress(&compressed[index][0], compressed[index].size(), &output[0], hunkbytes);
+		benchmark::DoNotOptimize(output[0]);
+		if (++index == compressed.size())
+			index = 0;
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * hunkbytes);
+
+	char label[64];
+	snprintf(label, sizeof(label), "%s ratio=%.1f%%", chd_codec_list::codec_name(Codec), 100.0 * outbytes / inbytes);
+	state.SetLabel(label);
+}
+// Register the function as a benchmark
+BENCHMARK_TEMPLATE(BM_chd_decompress, CHD_CODEC_ZLIB);
+BENCHMARK_TEMPLATE(BM_chd_decompress, CHD_CODEC_LZMA);
+BENCHMARK_TEMPLATE(BM_chd_decompress, CHD_CODEC_HUFFMAN);
+BENCHMARK_TEMPLATE(BM_chd_decompress, CHD_CODEC_FLAC);
+#if CHDCODEC_USE_ZSTD_LZ4
+BENCHMARK_TEMPLATE(BM_chd_decompress, CHD_CODEC_ZSTD);
+BENCHMARK_TEMPLATE(BM_chd_decompress, CHD_CODEC_LZ4);
+#endif
+BENCHMARK_TEMPLATE(BM_chd_decompress, CHD_CODEC_CD_ZLIB);
+BENCHMARK_TEMPLATE(BM_chd_decompress, CHD_CODEC_CD_LZMA);
+BENCHMARK_TEMPLATE(BM_chd_decompress, CHD_CODEC_CD_FLAC);
+#if CHDCODEC_USE_ZSTD_LZ4
+BENCHMARK_TEMPLATE(BM_chd_decompress, CHD_CODEC_CD_ZSTD);
+BENCHMARK_TEMPLATE(BM_chd_decompress, CHD_CODEC_CD_LZ4);
+#endif
+
+// chd_file::read_hunk on the same image: the codec plus the file reads,
+// map lookup and CRC check, cycling through the first hunks
+static void BM_chd_read_hunk(benchmark::State& state) {
+	chd_bench_image &image = bench_image();
+	if (!image.valid) {
+		state.SkipWithError("CHD_BENCH_IMAGE not set or unreadable");
+		return;
+	}
+
+	std::vector<uint8_t> output(image.chd.hunk_bytes());
+	uint32_t hunknum = 0;
+	while (state.KeepRunning()) {
+		image.chd.read_hunk(hunknum, &output[0]);
+		benchmark::DoNotOptimize(output[0]);
+		if (++hunknum == image.hunks.size())
+			hunknum = 0;
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * output.size());
+}
+BENCHMARK(BM_chd_read_hunk);
@@ -0,0 +1,94 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "osdcore.h"
+#include "emucore.h"
+#include "delegate.h"
+
+// the shape of devcb_write_line and devcb_write8 dispatch: a member function
+// pointer to an adapter that applies the shift, mask and XOR before calling
+// the delegate, the same adapter with the transforms left out, and the
+// inline check that calls the delegate without going through an adapter
+
+class bench_target : public delegate_late_bind {
+public:
+	bench_target() : m_state(0), m_latch(0) { }
+	void write_line(int state) { m_state += state; }
+	void write(u32 offset, u8 data, u8 mem_mask) { m_latch ^= data; }
+	int m_state;
+	u8 m_latch;
+};
+
+typedef delegate<void (int)> bench_write_line_delegate;
+typedef delegate<void (u32, u8, u8)> bench_write8_delegate;
+
+class bench_devcb {
+public:
+	bench_devcb(bench_target &target, bool direct, bool inline_call)
+		: m_writeline(&bench_target::write_line, &target)
+		, m_write8(&bench_target::write, &target)
+		, m_rshift(0), m_mask(0xff), m_xor(0)
+		, m_direct(direct && inline_call) {
+		m_line_adapter = direct ? &bench_devcb::write_line_direct_adapter : &bench_devcb::write_line_adapter;
+		m_adapter8 = direct ? &bench_devcb::write8_direct_adapter : &bench_devcb::write8_adapter;
+	}
+
+	void write_line(int state) {
+		if (m_direct)
+			m_writeline(state & 1);
+		else
+			(this->*m_line_adapter)(0, state & 1, 0xff);
+	}
+
+	void write8(u32 offset, u8 data) {
+		if (m_direct)
+			m_write8(offset, data, 0xff);
+		else
+			(this->*m_adapter8)(offset, data, 0xff);
+	}
+
+private:
+	typedef void (bench_devcb::*adapter_func)(u32, u64, u64);
+
+	u64 unshift_mask(u64 value) const { return (m_rshift < 0) ? ((value & m_mask) >> -m_rshift) : ((value & m_mask) << m_rshift); }
+	u64 unshift_mask_xor(u64 value) const { return (m_rshift < 0) ? (((value ^ m_xor) & m_mask) >> -m_rshift) : (((value ^ m_xor) & m_mask) << m_rshift); }
+
+	void write_line_adapter(u32 offset, u64 data, u64 mask) { m_writeline(unshift_mask_xor(data) & 1); }
+	void write_line_direct_adapter(u32 offset, u64 data, u64 mask) { m_writeline(data & 1); }
+	void write8_adapter(u32 offset, u64 data, u64 mask) { m_write8(offset, unshift_mask_xor(data), unshift_mask(mask)); }
+	void write8_direct_adapter(u32 offset, u64 data, u64 mask) { m_write8(offset, data, mask); }
+
+	bench_write_line_delegate m_writeline;
+	bench_write8_delegate m_write8;
+	int m_rshift;
+	u64 m_mask;
+	u64 m_xor;
+	bool m_direct;
+	adapter_func m_line_adapter;
+	adapter_func m_adapter8;
+};
+
+static void BM_devcb_write_line(benchmark::State& state) {
+	bench_target target;
+	bench_devcb callback(target, state.range(0) != 0, state.range(1) != 0);
+	int line = 0;
+	while (state.KeepRunning()) {
+		for (int count = 0; count < 1024; count++)
+			callback.write_line(line ^= 1);
+		benchmark::DoNotOptimize(target.m_state);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * 1024);
+}
+BENCHMARK(BM_devcb_write_line)->ArgPair(0, 0)->ArgPair(1, 0)->ArgPair(1, 1);
+
+static void BM_devcb_write8(benchmark::State& state) {
+	bench_target target;
+	bench_devcb callback(target, state.range(0) != 0, state.range(1) != 0);
+	u32 data = 0;
+	while (state.KeepRunning()) {
+		for (int count = 0; count < 1024; count++, data++)
+			callback.write8(0, data);
+		benchmark::DoNotOptimize(target.m_latch);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * 1024);
+}
+BENCHMARK(BM_devcb_write8)->ArgPair(0, 0)->ArgPair(1, 0)->ArgPair(1, 1);
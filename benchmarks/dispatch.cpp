@@ -0,0 +1,77 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "osdcore.h"
+
+// the generated m6502 family cores dispatch every instruction on inst_state,
+// either through a switch or as threaded code where each handler jumps
+// directly to the next one through a computed goto table (M6502_THREADED_DISPATCH)
+
+struct dispatch_state {
+	uint32_t acc;
+	uint32_t pc;
+	uint8_t program[0x100];
+
+	dispatch_state() : acc(0), pc(0) {
+		uint32_t seed = 0x12345678;
+		for (auto & elem : program) {
+			seed = seed * 1103515245 + 12345;
+			elem = seed >> 24;
+		}
+	}
+
+	uint8_t fetch() { return program[pc++ & 0xff]; }
+};
+
+#define DISPATCH_OPS(X) \
+	X(0x00, s.acc += 1) X(0x01, s.acc ^= 0x55) X(0x02, s.acc <<= 1) X(0x03, s.acc >>= 1) \
+	X(0x04, s.acc -= 3) X(0x05, s.acc |= 0x80) X(0x06, s.acc &= 0x7f) X(0x07, s.acc = ~s.acc) \
+	X(0x08, s.pc += 1) X(0x09, s.acc += s.pc) X(0x0a, s.acc ^= s.pc) X(0x0b, s.acc -= s.pc) \
+	X(0x0c, s.acc *= 3) X(0x0d, s.acc += 7) X(0x0e, s.acc ^= 0xaa) X(0x0f, s.pc -= 1)
+
+static void dispatch_switch(dispatch_state &s, int count)
+{
+	while (count-- > 0) {
+		switch (s.fetch() & 0x0f) {
+#define DISPATCH_CASE(n, op) case n: op; break;
+		DISPATCH_OPS(DISPATCH_CASE)
+#undef DISPATCH_CASE
+		}
+	}
+}
+
+#if defined(__GNUC__)
+static void dispatch_threaded(dispatch_state &s, int count)
+{
+	static void *const dispatch[0x10] = {
+#define DISPATCH_LABEL(n, op) &&op_##n,
+		DISPATCH_OPS(DISPATCH_LABEL)
+#undef DISPATCH_LABEL
+	};
+	goto *dispatch[s.fetch() & 0x0f];
+#define DISPATCH_BODY(n, op) op_##n: op; if (--count <= 0) return; goto *dispatch[s.fetch() & 0x0f];
+	DISPATCH_OPS(DISPATCH_BODY)
+#undef DISPATCH_BODY
+}
+#endif
+
+static void BM_dispatch_switch(benchmark::State& state) {
+	dispatch_state s;
+	while (state.KeepRunning()) {
+		dispatch_switch(s, 1000);
+		benchmark::DoNotOptimize(s.acc);
+	}
+}
+// Register the function as a benchmark
+BENCHMARK(BM_dispatch_switch);
+
+#if defined(__GNUC__)
+static void BM_dispatch_threaded(benchmark::State& state) {
+	dispatch_state s;
+	while (state.KeepRunning()) {
+		dispatch_threaded(s, 1000);
+		benchmark::DoNotOptimize(s.acc);
+	}
+}
+// Register the function as a benchmark
+BENCHMARK(BM_dispatch_threaded);
+#endif
@@ -0,0 +1,82 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "osdcore.h"
+#include "emucore.h"
+#include "bitmap.h"
+#include "drawgfxm.h"
+#include <vector>
+
+// the drawgfx pixel operations filling a 320x240 screen with 16x16 tiles,
+// walked the way DRAWGFX_CORE walks an unflipped, unclipped tile; about a
+// quarter of the source pixels are the transparent pen
+
+static const int TILE_SIZE = 16;
+static const int TILE_COUNT = 256;
+static const int SCREEN_WIDTH = 320;
+static const int SCREEN_HEIGHT = 240;
+
+struct drawgfx_bench_data {
+	std::vector<u8> tiles;
+	std::vector<u32> palette;
+	bitmap_ind16 dest;
+	bitmap_ind8 priority;
+
+	drawgfx_bench_data()
+		: tiles(TILE_COUNT * TILE_SIZE * TILE_SIZE)
+		, palette(0x100)
+		, dest(SCREEN_WIDTH, SCREEN_HEIGHT)
+		, priority(SCREEN_WIDTH, SCREEN_HEIGHT) {
+		u32 seed = 0x12345678;
+		for (auto & elem : tiles) {
+			seed = seed * 1103515245 + 12345;
+			elem = ((seed >> 24) & 3) ? (seed >> 16) & 0x0f : 0;
+		}
+		for (int pen = 0; pen < palette.size(); pen++)
+			palette[pen] = 0x100 + pen * 3;
+		dest.fill(0);
+		priority.fill(0);
+	}
+};
+
+#define DRAWGFX_BENCHMARK(NAME, PIXEL_OP, PRIORITY_TYPE)                            \
+static void NAME(benchmark::State& state) {                                         \
+	drawgfx_bench_data data;                                                        \
+	const u32 *paldata = &data.palette[0x10];                                       \
+	const u32 color = 0x10;                                                         \
+	const u32 trans_pen = 0;                                                        \
+	const u32 trans_mask = 0x8001;                                                  \
+	const u32 pmask = 0x02;                                                         \
+	bitmap_ind8 &priority = data.priority;                                          \
+	(void)paldata; (void)color; (void)trans_pen; (void)trans_mask; (void)pmask;     \
+	u32 code = 0;                                                                   \
+	while (state.KeepRunning()) {                                                   \
+		for (int desty = 0; desty < SCREEN_HEIGHT; desty += TILE_SIZE)              \
+			for (int destx = 0; destx < SCREEN_WIDTH; destx += TILE_SIZE) {         \
+				const u8 *srcdata = &data.tiles[(code++ % TILE_COUNT) * TILE_SIZE * TILE_SIZE]; \
+				for (int cury = desty; cury < desty + TILE_SIZE; cury++) {          \
+					PRIORITY_TYPE *priptr = PRIORITY_ADDR(priority, PRIORITY_TYPE, cury, destx); \
+					u16 *destptr = &data.dest.pix16(cury, destx);                   \
+					const u8 *srcptr = srcdata;                                     \
+					srcdata += TILE_SIZE;                                           \
+					for (int curx = 0; curx < TILE_SIZE / 4; curx++) {              \
+						PIXEL_OP(destptr[0], priptr[0], srcptr[0]);                 \
+						PIXEL_OP(destptr[1], priptr[1], srcptr[1]);                 \
+						PIXEL_OP(destptr[2], priptr[2], srcptr[2]);                 \
+						PIXEL_OP(destptr[3], priptr[3], srcptr[3]);                 \
+						srcptr += 4;                                                \
+						destptr += 4;                                               \
+						PRIORITY_ADVANCE(PRIORITY_TYPE, priptr, 4);                 \
+					}                                                               \
+				}                                                                   \
+			}                                                                       \
+		benchmark::DoNotOptimize(data.dest.pix16(0, 0));                            \
+	}                                                                               \
+	state.SetItemsProcessed(int64_t(state.iterations()) * SCREEN_WIDTH * SCREEN_HEIGHT); \
+}                                                                                   \
+BENCHMARK(NAME);
+
+DRAWGFX_BENCHMARK(BM_drawgfx_opaque, PIXEL_OP_REMAP_OPAQUE, NO_PRIORITY)
+DRAWGFX_BENCHMARK(BM_drawgfx_transpen, PIXEL_OP_REMAP_TRANSPEN, NO_PRIORITY)
+DRAWGFX_BENCHMARK(BM_drawgfx_transpen_raw, PIXEL_OP_REBASE_TRANSPEN, NO_PRIORITY)
+DRAWGFX_BENCHMARK(BM_drawgfx_transmask, PIXEL_OP_REMAP_TRANSMASK, NO_PRIORITY)
+DRAWGFX_BENCHMARK(BM_drawgfx_transpen_priority, PIXEL_OP_REMAP_TRANSPEN_PRIORITY, u8)
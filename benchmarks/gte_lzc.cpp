@@ -0,0 +1,46 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "osdcore.h"
+#include "eminline.h"
+
+// the PSX GTE counts leading sign bits for LZCR and for every perspective divide
+
+static uint32_t gte_leadingzerocount_loop(uint32_t lzcs)
+{
+	uint32_t lzcr = 0;
+	if ((lzcs & 0x80000000) == 0)
+		lzcs = ~lzcs;
+	while ((lzcs & 0x80000000) != 0)
+	{
+		lzcr++;
+		lzcs <<= 1;
+	}
+	return lzcr;
+}
+
+static uint32_t gte_leadingzerocount_clz(uint32_t lzcs)
+{
+	if ((lzcs & 0x80000000) != 0)
+		lzcs = ~lzcs;
+	return count_leading_zeros(lzcs);
+}
+
+static void BM_gte_leadingzerocount_loop(benchmark::State& state) {
+	uint32_t cnt = 0x332533;
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(gte_leadingzerocount_loop(cnt));
+		cnt += 0x10001;
+	}
+}
+// Register the function as a benchmark
+BENCHMARK(BM_gte_leadingzerocount_loop);
+
+static void BM_gte_leadingzerocount_clz(benchmark::State& state) {
+	uint32_t cnt = 0x332533;
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(gte_leadingzerocount_clz(cnt));
+		cnt += 0x10001;
+	}
+}
+// Register the function as a benchmark
+BENCHMARK(BM_gte_leadingzerocount_clz);
@@ -0,0 +1,44 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "osdcore.h"
+#include "hashing.h"
+#include <vector>
+
+// CRC-32 and SHA-1 throughput on a ROM-sized buffer, with the CPU-specific
+// implementations (range 1) and the portable ones (range 0)
+
+static std::vector<uint8_t> &hash_bench_data()
+{
+	static std::vector<uint8_t> data;
+	if (data.empty()) {
+		data.resize(1024 * 1024);
+		uint32_t seed = 0x12345678;
+		for (auto & elem : data) {
+			seed = seed * 1103515245 + 12345;
+			elem = seed >> 24;
+		}
+	}
+	return data;
+}
+
+static void BM_crc32(benchmark::State& state) {
+	std::vector<uint8_t> &data = hash_bench_data();
+	util::set_hash_acceleration(state.range(0) != 0);
+	while (state.KeepRunning())
+		benchmark::DoNotOptimize(util::crc32_creator::simple(&data[0], data.size()));
+	util::set_hash_acceleration(true);
+	state.SetBytesProcessed(int64_t(state.iterations()) * data.size());
+}
+// Register the function as a benchmark
+BENCHMARK(BM_crc32)->Arg(0)->Arg(1);
+
+static void BM_sha1(benchmark::State& state) {
+	std::vector<uint8_t> &data = hash_bench_data();
+	util::set_hash_acceleration(state.range(0) != 0);
+	while (state.KeepRunning())
+		benchmark::DoNotOptimize(util::sha1_creator::simple(&data[0], data.size()));
+	util::set_hash_acceleration(true);
+	state.SetBytesProcessed(int64_t(state.iterations()) * data.size());
+}
+// Register the function as a benchmark
+BENCHMARK(BM_sha1)->Arg(0)->Arg(1);
@@ -0,0 +1,55 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "osdcore.h"
+#include "huffman.h"
+#include <vector>
+
+// huffman_8bit_decoder::decode (multi-symbol table) against a plain
+// decode_one loop on a CD-sized hunk of skewed data
+
+struct huffman_bench_data {
+	std::vector<uint8_t> source;
+	std::vector<uint8_t> compressed;
+
+	huffman_bench_data(int spread) : source(19584), compressed(19584 * 2) {
+		uint32_t seed = 0x12345678;
+		for (auto & elem : source) {
+			seed = seed * 1103515245 + 12345;
+			uint32_t r = (seed >> 8) & 0xffff;
+			elem = (r % spread) * (r % 7 == 0 ? 37 : 1);
+		}
+		uint32_t complength;
+		huffman_8bit_encoder encoder;
+		encoder.encode(&source[0], source.size(), &compressed[0], compressed.size(), complength);
+		compressed.resize(complength);
+	}
+};
+
+static void BM_huffman_decode_one(benchmark::State& state) {
+	huffman_bench_data data(state.range(0));
+	std::vector<uint8_t> dest(data.source.size());
+	huffman_8bit_decoder decoder;
+	while (state.KeepRunning()) {
+		bitstream_in bitbuf(&data.compressed[0], data.compressed.size());
+		decoder.import_tree_huffman(bitbuf);
+		for (auto & elem : dest)
+			elem = decoder.decode_one(bitbuf);
+		benchmark::DoNotOptimize(dest[0]);
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * dest.size());
+}
+// Register the function as a benchmark
+BENCHMARK(BM_huffman_decode_one)->Arg(4)->Arg(40)->Arg(256);
+
+static void BM_huffman_decode_multi(benchmark::State& state) {
+	huffman_bench_data data(state.range(0));
+	std::vector<uint8_t> dest(data.source.size());
+	huffman_8bit_decoder decoder;
+	while (state.KeepRunning()) {
+		decoder.decode(&data.compressed[0], data.compressed.size(), &dest[0], dest.size());
+		benchmark::DoNotOptimize(dest[0]);
+	}
+	state.SetBytesProcessed(int64_t(state.iterations()) * dest.size());
+}
+// Register the function as a benchmark
+BENCHMARK(BM_huffman_decode_multi)->Arg(4)->Arg(40)->Arg(256);
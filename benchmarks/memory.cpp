@@ -0,0 +1,120 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "osdcore.h"
+#include "emucore.h"
+#include "delegate.h"
+#include <vector>
+
+// the shape of address_space::read_native and write_native for a 16-bit,
+// 8-bit wide space: a check against the last RAM window, a lookup table
+// from address to handler entry, then either a bank pointer or a delegate
+// call into a device; each benchmark walks the whole space through one
+// kind of handler
+
+static const int ADDR_BITS = 16;
+static const int PAGE_BITS = 8;
+
+class bench_device : public delegate_late_bind {
+public:
+	bench_device() : m_latch(0) { }
+	u8 read(u32 offset, u8 mem_mask) { return m_latch ^ offset; }
+	void write(u32 offset, u8 data, u8 mem_mask) { m_latch = data; }
+private:
+	u8 m_latch;
+};
+
+typedef delegate<u8 (u32, u8)> bench_read8_delegate;
+typedef delegate<void (u32, u8, u8)> bench_write8_delegate;
+
+enum {
+	BENCH_UNMAP = 0,
+	BENCH_BANK,
+	BENCH_DEVICE
+};
+
+struct bench_handler {
+	u8 *ramptr;
+	u32 bytestart;
+	bench_read8_delegate read;
+	bench_write8_delegate write;
+	bool is_bank() const { return ramptr != nullptr; }
+};
+
+struct bench_space {
+	std::vector<u8> ram;
+	bench_device device;
+	bench_handler handlers[3];
+	std::vector<u16> table;
+	u32 window_start, window_end;
+	u8 *window_ptr;
+
+	bench_space(int handler, bool use_window)
+		: ram(1 << ADDR_BITS)
+		, table(1 << (ADDR_BITS - PAGE_BITS), handler)
+		, window_start(1), window_end(0), window_ptr(nullptr) {
+		handlers[BENCH_UNMAP].ramptr = nullptr;
+		handlers[BENCH_BANK].ramptr = &ram[0];
+		handlers[BENCH_DEVICE].ramptr = nullptr;
+		for (auto & elem : handlers)
+			elem.bytestart = 0;
+		handlers[BENCH_DEVICE].read = bench_read8_delegate(&bench_device::read, &device);
+		handlers[BENCH_DEVICE].write = bench_write8_delegate(&bench_device::write, &device);
+		if (use_window && handler == BENCH_BANK) {
+			window_start = 0;
+			window_end = (1 << ADDR_BITS) - 1;
+			window_ptr = &ram[0];
+		}
+	}
+
+	u8 read_native(u32 byteaddress) {
+		byteaddress &= (1 << ADDR_BITS) - 1;
+		if (byteaddress >= window_start && byteaddress <= window_end)
+			return window_ptr[byteaddress - window_start];
+		const bench_handler &handler = handlers[table[byteaddress >> PAGE_BITS]];
+		u32 offset = byteaddress - handler.bytestart;
+		if (handler.is_bank())
+			return handler.ramptr[offset];
+		if (handler.read.isnull())
+			return 0xff;
+		return handler.read(offset, 0xff);
+	}
+
+	void write_native(u32 byteaddress, u8 data) {
+		byteaddress &= (1 << ADDR_BITS) - 1;
+		if (byteaddress >= window_start && byteaddress <= window_end) {
+			window_ptr[byteaddress - window_start] = data;
+			return;
+		}
+		const bench_handler &handler = handlers[table[byteaddress >> PAGE_BITS]];
+		u32 offset = byteaddress - handler.bytestart;
+		if (handler.is_bank())
+			handler.ramptr[offset] = data;
+		else if (!handler.write.isnull())
+			handler.write(offset, data, 0xff);
+	}
+};
+
+static void BM_memory_read(benchmark::State& state) {
+	bench_space space(state.range(0), state.range(1) != 0);
+	u32 address = 0;
+	u32 sum = 0;
+	while (state.KeepRunning()) {
+		for (int count = 0; count < 1024; count++)
+			sum += space.read_native(address++);
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * 1024);
+}
+BENCHMARK(BM_memory_read)->ArgPair(BENCH_UNMAP, 0)->ArgPair(BENCH_BANK, 0)->ArgPair(BENCH_BANK, 1)->ArgPair(BENCH_DEVICE, 0);
+
+static void BM_memory_write(benchmark::State& state) {
+	bench_space space(state.range(0), state.range(1) != 0);
+	u32 address = 0;
+	while (state.KeepRunning()) {
+		for (int count = 0; count < 1024; count++, address++)
+			space.write_native(address, address);
+		benchmark::DoNotOptimize(space.ram[0]);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * 1024);
+}
+BENCHMARK(BM_memory_write)->ArgPair(BENCH_UNMAP, 0)->ArgPair(BENCH_BANK, 0)->ArgPair(BENCH_BANK, 1)->ArgPair(BENCH_DEVICE, 0);
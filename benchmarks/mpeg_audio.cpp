@@ -0,0 +1,67 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "osdcore.h"
+#include "emucore.h"
+#include "sound/mpeg_audio.h"
+
+// the MPEG audio synthesis filterbank, run once per channel for every
+// 32 output samples: the idct32 of the subband samples and the window
+// over the last 16 blocks, each against its direct reference formula
+
+struct mpeg_bench_buffer {
+	double subbands[32];
+	double polyphase[32*32];
+	double output[32];
+
+	mpeg_bench_buffer() {
+		u32 seed = 0x12345678;
+		for (double &value : subbands) {
+			seed = seed * 1103515245 + 12345;
+			value = double(s32(seed) >> 8) / double(1 << 23);
+		}
+		for (double &value : polyphase) {
+			seed = seed * 1103515245 + 12345;
+			value = double(s32(seed) >> 8) / double(1 << 23);
+		}
+	}
+};
+
+static void BM_mpeg_audio_idct32_reference(benchmark::State& state) {
+	mpeg_bench_buffer buf;
+	while (state.KeepRunning()) {
+		mpeg_audio::idct32_reference(buf.subbands, buf.output);
+		benchmark::DoNotOptimize(buf.output[0]);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * 32);
+}
+BENCHMARK(BM_mpeg_audio_idct32_reference);
+
+static void BM_mpeg_audio_idct32(benchmark::State& state) {
+	mpeg_bench_buffer buf;
+	while (state.KeepRunning()) {
+		mpeg_audio::idct32(buf.subbands, buf.output);
+		benchmark::DoNotOptimize(buf.output[0]);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * 32);
+}
+BENCHMARK(BM_mpeg_audio_idct32);
+
+static void BM_mpeg_audio_resynthesis_reference(benchmark::State& state) {
+	mpeg_bench_buffer buf;
+	while (state.KeepRunning()) {
+		mpeg_audio::resynthesis_reference(buf.polyphase + 16, buf.output);
+		benchmark::DoNotOptimize(buf.output[0]);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * 32);
+}
+BENCHMARK(BM_mpeg_audio_resynthesis_reference);
+
+static void BM_mpeg_audio_resynthesis(benchmark::State& state) {
+	mpeg_bench_buffer buf;
+	while (state.KeepRunning()) {
+		mpeg_audio::resynthesis(buf.polyphase + 16, buf.output);
+		benchmark::DoNotOptimize(buf.output[0]);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * 32);
+}
+BENCHMARK(BM_mpeg_audio_resynthesis);
@@ -0,0 +1,88 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "osdcore.h"
+#include "emucore.h"
+#include "palette.h"
+#include "video/rgbutil.h"
+#include <vector>
+
+// rgbaint_t over a scanline of pixels, as the 3D rasterizers use it:
+// alpha blending, modulate-and-add with clamping, bilinear texel
+// filtering, and the same blend two pixels at a time with rgbaint8_t
+
+static const int BENCH_PIXELS = 1024;
+
+struct rgb_bench_line {
+	std::vector<u32> src;
+	std::vector<u32> dest;
+
+	rgb_bench_line() : src(BENCH_PIXELS), dest(BENCH_PIXELS) {
+		u32 seed = 0x12345678;
+		for (int x = 0; x < BENCH_PIXELS; x++) {
+			seed = seed * 1103515245 + 12345;
+			src[x] = seed;
+			seed = seed * 1103515245 + 12345;
+			dest[x] = seed;
+		}
+	}
+};
+
+static void BM_rgbaint_blend(benchmark::State& state) {
+	rgb_bench_line line;
+	while (state.KeepRunning()) {
+		for (int x = 0; x < BENCH_PIXELS; x++) {
+			rgbaint_t color(line.src[x]);
+			color.blend(rgbaint_t(line.dest[x]), line.src[x] >> 24);
+			line.dest[x] = color.to_rgba();
+		}
+		benchmark::DoNotOptimize(line.dest[0]);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * BENCH_PIXELS);
+}
+BENCHMARK(BM_rgbaint_blend);
+
+static void BM_rgbaint_scale_add_and_clamp(benchmark::State& state) {
+	rgb_bench_line line;
+	const rgbaint_t scale(0x80, 0xc0, 0x40, 0xff);
+	while (state.KeepRunning()) {
+		for (int x = 0; x < BENCH_PIXELS; x++) {
+			rgbaint_t color(line.src[x]);
+			color.scale_add_and_clamp(scale, rgbaint_t(line.dest[x]));
+			line.dest[x] = color.to_rgba_clamp();
+		}
+		benchmark::DoNotOptimize(line.dest[0]);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * BENCH_PIXELS);
+}
+BENCHMARK(BM_rgbaint_scale_add_and_clamp);
+
+static void BM_rgbaint_bilinear_filter(benchmark::State& state) {
+	rgb_bench_line line;
+	while (state.KeepRunning()) {
+		for (int x = 0; x < BENCH_PIXELS - 1; x++) {
+			const u32 *texel = &line.src[x];
+			line.dest[x] = rgbaint_t::bilinear_filter(texel[0], texel[1], line.dest[x], line.dest[x + 1], x, x * 3);
+		}
+		benchmark::DoNotOptimize(line.dest[0]);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * (BENCH_PIXELS - 1));
+}
+BENCHMARK(BM_rgbaint_bilinear_filter);
+
+static void BM_rgbaint8_blend(benchmark::State& state) {
+	rgb_bench_line line;
+	while (state.KeepRunning()) {
+		for (int x = 0; x < BENCH_PIXELS; x += 2) {
+			rgbaint8_t color(line.src[x], line.src[x + 1]);
+			rgbaint8_t other(line.dest[x], line.dest[x + 1]);
+			color.sub(other);
+			color.mul_imm(line.src[x] >> 24);
+			color.sra_imm(8);
+			color.add(other);
+			color.to_rgba(&line.dest[x]);
+		}
+		benchmark::DoNotOptimize(line.dest[0]);
+	}
+	state.SetItemsProcessed(int64_t(state.iterations()) * BENCH_PIXELS);
+}
+BENCHMARK(BM_rgbaint8_blend);
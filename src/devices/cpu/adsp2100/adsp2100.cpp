@@ -176,7 +176,10 @@ adsp21xx_device::adsp21xx_device(const machine_config &mconfig, device_type type
 	memset(&m_irq_latch, 0, sizeof(m_irq_latch));
 
 	// create the tables
-	create_tables();
+	m_tables = shared_tables<tables>(0, &adsp21xx_device::create_tables);
+	m_condition_table = m_tables->condition;
+	m_mask_table = m_tables->mask;
+	m_reverse_table = m_tables->reverse;
 
 	// set up read register group 0 pointers
 	m_read0_ptr[0x00] = &m_core.ax0.s;
@@ -1033,7 +1036,7 @@ void adsp2181_device::check_irqs()
     INITIALIZATION AND SHUTDOWN
 ***************************************************************************/
 
-void adsp21xx_device::create_tables()
+void adsp21xx_device::create_tables(tables &t)
 {
 	// initialize the bit reversing table
 	for (int i = 0; i < 0x4000; i++)
@@ -1055,27 +1058,27 @@ void adsp21xx_device::create_tables()
 		data |= (i << 11) & 0x1000;
 		data |= (i << 13) & 0x2000;
 
-		m_reverse_table[i] = data;
+		t.reverse[i] = data;
 	}
 
 	// initialize the mask table
 	for (int i = 0; i < 0x4000; i++)
 	{
-				if (i > 0x2000) m_mask_table[i] = 0x0000;
-		else if (i > 0x1000) m_mask_table[i] = 0x2000;
-		else if (i > 0x0800) m_mask_table[i] = 0x3000;
-		else if (i > 0x0400) m_mask_table[i] = 0x3800;
-		else if (i > 0x0200) m_mask_table[i] = 0x3c00;
-		else if (i > 0x0100) m_mask_table[i] = 0x3e00;
-		else if (i > 0x0080) m_mask_table[i] = 0x3f00;
-		else if (i > 0x0040) m_mask_table[i] = 0x3f80;
-		else if (i > 0x0020) m_mask_table[i] = 0x3fc0;
-		else if (i > 0x0010) m_mask_table[i] = 0x3fe0;
-		else if (i > 0x0008) m_mask_table[i] = 0x3ff0;
-		else if (i > 0x0004) m_mask_table[i] = 0x3ff8;
-		else if (i > 0x0002) m_mask_table[i] = 0x3ffc;
-		else if (i > 0x0001) m_mask_table[i] = 0x3ffe;
-		else                 m_mask_table[i] = 0x3fff;
+				if (i > 0x2000) t.mask[i] = 0x0000;
+		else if (i > 0x1000) t.mask[i] = 0x2000;
+		else if (i > 0x0800) t.mask[i] = 0x3000;
+		else if (i > 0x0400) t.mask[i] = 0x3800;
+		else if (i > 0x0200) t.mask[i] = 0x3c00;
+		else if (i > 0x0100) t.mask[i] = 0x3e00;
+		else if (i > 0x0080) t.mask[i] = 0x3f00;
+		else if (i > 0x0040) t.mask[i] = 0x3f80;
+		else if (i > 0x0020) t.mask[i] = 0x3fc0;
+		else if (i > 0x0010) t.mask[i] = 0x3fe0;
+		else if (i > 0x0008) t.mask[i] = 0x3ff0;
+		else if (i > 0x0004) t.mask[i] = 0x3ff8;
+		else if (i > 0x0002) t.mask[i] = 0x3ffc;
+		else if (i > 0x0001) t.mask[i] = 0x3ffe;
+		else                 t.mask[i] = 0x3fff;
 	}
 
 	// initialize the condition table
@@ -1088,21 +1091,21 @@ void adsp21xx_device::create_tables()
 		int mv = ((i & MVFLAG) != 0);
 		int as = ((i & SFLAG) != 0);
 
-		m_condition_table[i | 0x000] = az;
-		m_condition_table[i | 0x100] = !az;
-		m_condition_table[i | 0x200] = !((an ^ av) | az);
-		m_condition_table[i | 0x300] = (an ^ av) | az;
-		m_condition_table[i | 0x400] = an ^ av;
-		m_condition_table[i | 0x500] = !(an ^ av);
-		m_condition_table[i | 0x600] = av;
-		m_condition_table[i | 0x700] = !av;
-		m_condition_table[i | 0x800] = ac;
-		m_condition_table[i | 0x900] = !ac;
-		m_condition_table[i | 0xa00] = as;
-		m_condition_table[i | 0xb00] = !as;
-		m_condition_table[i | 0xc00] = mv;
-		m_condition_table[i | 0xd00] = !mv;
-		m_condition_table[i | 0xf00] = 1;
+		t.condition[i | 0x000] = az;
+		t.condition[i | 0x100] = !az;
+		t.condition[i | 0x200] = !((an ^ av) | az);
+		t.condition[i | 0x300] = (an ^ av) | az;
+		t.condition[i | 0x400] = an ^ av;
+		t.condition[i | 0x500] = !(an ^ av);
+		t.condition[i | 0x600] = av;
+		t.condition[i | 0x700] = !av;
+		t.condition[i | 0x800] = ac;
+		t.condition[i | 0x900] = !ac;
+		t.condition[i | 0xa00] = as;
+		t.condition[i | 0xb00] = !as;
+		t.condition[i | 0xc00] = mv;
+		t.condition[i | 0xd00] = !mv;
+		t.condition[i | 0xf00] = 1;
 	}
 }
 
@@ -246,7 +246,8 @@ protected:
 	virtual offs_t disasm_disassemble(std::ostream &stream, offs_t pc, const uint8_t *oprom, const uint8_t *opram, uint32_t options) override;
 
 	// helpers
-	void create_tables();
+	struct tables;
+	static void create_tables(tables &t);
 	inline void update_mstat();
 	inline uint32_t pc_stack_top();
 	inline void set_pc_stack_top(uint32_t top);
@@ -452,10 +453,17 @@ protected:
 	address_space *     m_io;
 	direct_read_data *  m_direct;
 
-	// tables
-	uint8_t               m_condition_table[0x1000];
-	uint16_t              m_mask_table[0x4000];
-	uint16_t              m_reverse_table[0x4000];
+	// tables, shared between all instances
+	struct tables
+	{
+		uint8_t             condition[0x1000];
+		uint16_t            mask[0x4000];
+		uint16_t            reverse[0x4000];
+	};
+	std::shared_ptr<const tables> m_tables;
+	const uint8_t *     m_condition_table;
+	const uint16_t *    m_mask_table;
+	const uint16_t *    m_reverse_table;
 
 	devcb_read32            m_sport_rx_cb;    // callback for serial receive
 	devcb_write32           m_sport_tx_cb;    // callback for serial transmit
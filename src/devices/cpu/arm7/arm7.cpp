@@ -594,6 +594,27 @@ void arm7_cpu_device::device_reset()
 	m_r[eR15] += 4; \
 	m_icount +=2; /* Any unexecuted instruction only takes 1 cycle (page 193) */
 
+/* for each condition code, bit n is set if the condition passes with NZCV == n */
+const uint16_t arm7_cpu_device::s_condition_table[0x10] =
+{
+	0xf0f0, // EQ: Z
+	0x0f0f, // NE: !Z
+	0xcccc, // CS: C
+	0x3333, // CC: !C
+	0xff00, // MI: N
+	0x00ff, // PL: !N
+	0xaaaa, // VS: V
+	0x5555, // VC: !V
+	0x0c0c, // HI: C && !Z
+	0xf3f3, // LS: !C || Z
+	0xaa55, // GE: N == V
+	0x55aa, // LT: N != V
+	0x0a05, // GT: !Z && N == V
+	0xf5fa, // LE: Z || N != V
+	0xffff, // AL
+	0x0000  // NV: handled separately
+};
+
 void arm7_cpu_device::execute_run()
 {
 	uint32_t insn;
@@ -659,71 +680,14 @@ void arm7_cpu_device::execute_run()
 			/* process condition codes for this instruction */
 			if ((insn >> INSN_COND_SHIFT) != COND_AL)
 			{
-				switch (insn >> INSN_COND_SHIFT)
+				if ((insn >> INSN_COND_SHIFT) == COND_NV)
 				{
-					case COND_EQ:
-						if (Z_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_NE:
-						if (Z_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_CS:
-						if (C_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_CC:
-						if (C_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_MI:
-						if (N_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_PL:
-						if (N_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_VS:
-						if (V_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_VC:
-						if (V_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_HI:
-						if (C_IS_CLEAR(m_r[eCPSR]) || Z_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_LS:
-						if (C_IS_SET(m_r[eCPSR]) && Z_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_GE:
-						if (!(m_r[eCPSR] & N_MASK) != !(m_r[eCPSR] & V_MASK)) /* Use x ^ (x >> ...) method */
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_LT:
-						if (!(m_r[eCPSR] & N_MASK) == !(m_r[eCPSR] & V_MASK))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_GT:
-						if (Z_IS_SET(m_r[eCPSR]) || (!(m_r[eCPSR] & N_MASK) != !(m_r[eCPSR] & V_MASK)))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_LE:
-						if (Z_IS_CLEAR(m_r[eCPSR]) && (!(m_r[eCPSR] & N_MASK) == !(m_r[eCPSR] & V_MASK)))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_NV:
-						if (m_archRev < 5)
-						  { UNEXECUTED();  goto skip_exec; }
-						else
-							op_offset = 0x10;
-						break;
+					if (m_archRev < 5)
+						{ UNEXECUTED();  goto skip_exec; }
+					op_offset = 0x10;
 				}
+				else if (!BIT(s_condition_table[insn >> INSN_COND_SHIFT], m_r[eCPSR] >> V_BIT))
+					{ UNEXECUTED();  goto skip_exec; }
 			}
 			/*******************************************************************/
 			/* If we got here - condition satisfied, so decode the instruction */
@@ -279,6 +279,7 @@ protected:
 
 	typedef void ( arm7_cpu_device::*arm7ops_ophandler )(uint32_t);
 	static const arm7ops_ophandler ops_handler[0x20];
+	static const uint16_t s_condition_table[0x10];
 
 	//
 	// DRC
@@ -124,7 +124,8 @@ enum
 	OP_FFRI4,
 	OP_FFRI8,
 	OP_FFRFS,
-	OP_FFRFD
+	OP_FFRFD,
+	OP_HASHJMPD
 };
 
 
@@ -290,6 +291,8 @@ drcbe_c::drcbe_c(drcuml_state &drcuml, device_t &device, drc_cache &cache, uint3
 		m_labels(cache),
 		m_fixup_delegate(&drcbe_c::fixup_label, this)
 {
+	// direct links between blocks are repointed when their target is recompiled
+	m_hash.set_link_fixup(drc_link_fixup_delegate(&drcbe_c::fixup_link, this));
 }
 
 
@@ -379,6 +382,19 @@ void drcbe_c::generate(drcuml_block &block, const instruction *instlist, uint32_
 			// generically handle everything else
 			default:
 
+				// HASHJMPs to a fixed mode/PC link directly to the target block, and keep
+				// the PC and handle around in case it isn't there yet
+				if (opcode == OP_HASHJMP && inst.param(0).is_immediate() && inst.param(1).is_immediate())
+				{
+					(dst++)->i = MAKE_OPCODE_FULL(OP_HASHJMPD, 4, COND_ALWAYS, 0, 3);
+					dst->inst = (drcbec_instruction *)m_hash.get_codeptr(inst.param(0).immediate(), inst.param(1).immediate());
+					m_hash.add_link(inst.param(0).immediate(), inst.param(1).immediate(), (drccodeptr)dst);
+					dst++;
+					(dst++)->i = inst.param(1).immediate();
+					(dst++)->handle = &inst.param(2).handle();
+					break;
+				}
+
 				// determine the operand size for each operand; mostly this is just the instruction size
 				for (int pnum = 0; pnum < inst.numparams(); pnum++)
 					psize[pnum] = inst.size();
@@ -470,6 +486,17 @@ bool drcbe_c::hash_exists(uint32_t mode, uint32_t pc)
 }
 
 
+//-------------------------------------------------
+//  hash_invalidate - forget the code for the
+//  given mode/pc
+//-------------------------------------------------
+
+void drcbe_c::hash_invalidate(uint32_t mode, uint32_t pc)
+{
+	m_hash.invalidate(mode, pc);
+}
+
+
 //-------------------------------------------------
 //  get_info - return information about the
 //  back-end implementation
@@ -536,6 +563,19 @@ int drcbe_c::execute(code_handle &entry)
 				inst = newinst;
 				continue;
 
+			case MAKE_OPCODE_SHORT(OP_HASHJMPD, 4, 0):  // HASHJMP mode,pc,handle (fixed mode/pc)
+				sp = 0;
+				newinst = inst[0].inst;
+				if (newinst == nullptr)
+				{
+					m_state.exp = inst[1].i;
+					newinst = (const drcbec_instruction *)inst[2].handle->codeptr();
+					callstack[sp++] = inst;
+				}
+				assert_in_cache(m_cache, newinst);
+				inst = newinst;
+				continue;
+
 			case MAKE_OPCODE_SHORT(OP_EXIT, 4, 1):      // EXIT    src1[,c]
 				if (OPCODE_FAIL_CONDITION(opcode, flags))
 					break;
@@ -2216,6 +2256,19 @@ void drcbe_c::fixup_label(void *parameter, drccodeptr labelcodeptr)
 }
 
 
+//-------------------------------------------------
+//  fixup_link - callback to repoint a direct
+//  HASHJMP at a newly compiled target, or back
+//  at its exception handle when unlinked
+//-------------------------------------------------
+
+void drcbe_c::fixup_link(drccodeptr site, drccodeptr target)
+{
+	drcbec_instruction *dst = (drcbec_instruction *)site;
+	dst->inst = (drcbec_instruction *)target;
+}
+
+
 //-------------------------------------------------
 //  dmulu - perform a double-wide unsigned multiply
 //-------------------------------------------------
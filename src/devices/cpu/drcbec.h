@@ -36,12 +36,14 @@ public:
 	virtual int execute(uml::code_handle &entry) override;
 	virtual void generate(drcuml_block &block, const uml::instruction *instlist, uint32_t numinst) override;
 	virtual bool hash_exists(uint32_t mode, uint32_t pc) override;
+	virtual void hash_invalidate(uint32_t mode, uint32_t pc) override;
 	virtual void get_info(drcbe_info &info) override;
 
 private:
 	// helpers
 	void output_parameter(drcbec_instruction **dstptr, void **immedptr, int size, const uml::parameter &param);
 	void fixup_label(void *parameter, drccodeptr labelcodeptr);
+	void fixup_link(drccodeptr site, drccodeptr target);
 	int dmulu(uint64_t &dstlo, uint64_t &dsthi, uint64_t src1, uint64_t src2, bool flags);
 	int dmuls(uint64_t &dstlo, uint64_t &dsthi, int64_t src1, int64_t src2, bool flags);
 	uint32_t tzcount32(uint32_t value);
@@ -55,6 +55,9 @@ drc_hash_table::drc_hash_table(drc_cache &cache, uint32_t modes, uint8_t addrbit
 
 bool drc_hash_table::reset()
 {
+	// the code containing any direct links is gone
+	m_links.clear();
+
 	// allocate an empty l2 hash table
 	m_emptyl2 = (drccodeptr *)m_cache.alloc_temporary(sizeof(drccodeptr) << m_l2bits);
 	if (m_emptyl2 == nullptr)
@@ -184,10 +187,43 @@ bool drc_hash_table::set_codeptr(uint32_t mode, uint32_t pc, drccodeptr code)
 	// set the new entry
 	uint32_t l2 = (pc >> m_l2shift) & m_l2mask;
 	m_base[mode][l1][l2] = code;
+
+	// repoint any direct links to this mode/pc; a null code pointer is only a
+	// placeholder while the block is being generated, so leave those alone
+	if (code != nullptr && !m_links.empty())
+	{
+		auto found = m_links.find((uint64_t(mode) << 32) | pc);
+		if (found != m_links.end())
+			for (drccodeptr site : found->second)
+				m_link_fixup(site, code);
+	}
 	return true;
 }
 
 
+//-------------------------------------------------
+//  invalidate - forget the code for the given
+//  mode/pc, so that the next jump there finds it
+//  missing and any direct links to it go back
+//  through the generic path
+//-------------------------------------------------
+
+void drc_hash_table::invalidate(uint32_t mode, uint32_t pc)
+{
+	// nothing to do if there was never any code here; this also means the
+	// entry lives in a table of its own rather than a shared empty one
+	if (!code_exists(mode, pc))
+		return;
+
+	m_base[mode][(pc >> m_l1shift) & m_l1mask][(pc >> m_l2shift) & m_l2mask] = m_nocodeptr;
+
+	auto found = m_links.find((uint64_t(mode) << 32) | pc);
+	if (found != m_links.end())
+		for (drccodeptr site : found->second)
+			m_link_fixup(site, nullptr);
+}
+
+
 
 //**************************************************************************
 //  DRC MAP VARIABLES
@@ -15,6 +15,9 @@
 
 #include "drcuml.h"
 
+#include <unordered_map>
+#include <vector>
+
 
 //**************************************************************************
 //  TYPE DEFINITIONS
@@ -22,6 +25,8 @@
 
 // ======================> drc_hash_table
 
+typedef delegate<void (drccodeptr, drccodeptr)> drc_link_fixup_delegate;
+
 // common hash table management
 class drc_hash_table
 {
@@ -51,11 +56,19 @@ public:
 	bool set_codeptr(uint32_t mode, uint32_t pc, drccodeptr code);
 	drccodeptr get_codeptr(uint32_t mode, uint32_t pc) { assert(mode < m_modes); return m_base[mode][(pc >> m_l1shift) & m_l1mask][(pc >> m_l2shift) & m_l2mask]; }
 	bool code_exists(uint32_t mode, uint32_t pc) { return get_codeptr(mode, pc) != m_nocodeptr; }
+	void invalidate(uint32_t mode, uint32_t pc);
+
+	// direct links between blocks, fixed up whenever the target's codeptr changes;
+	// a null target means the link should go back to the generic path
+	void set_link_fixup(drc_link_fixup_delegate fixup) { m_link_fixup = fixup; }
+	void add_link(uint32_t mode, uint32_t pc, drccodeptr site) { m_links[(uint64_t(mode) << 32) | pc].push_back(site); }
 
 private:
 	// internal state
 	drc_cache &     m_cache;                // cache where allocations come from
 	uint32_t          m_modes;                // number of modes supported
+	drc_link_fixup_delegate m_link_fixup;   // callback to repoint a direct link
+	std::unordered_map<uint64_t, std::vector<drccodeptr>> m_links; // direct link sites, by target mode/pc
 
 	drccodeptr      m_nocodeptr;            // pointer to code which will handle missing entries
 
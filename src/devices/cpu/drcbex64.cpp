@@ -115,7 +115,7 @@
         RBP        - pointer to code cache
         R8         - scratch register
         R9         - scratch register
-        R10        - scratch register
+        R10        - caches a memory operand within a block
         R11        - scratch register
         R12        - maps to I3
         R13        - maps to I4
@@ -130,9 +130,9 @@
         RSI        - unused
         RDI        - unused
         RBP        - pointer to code cache
-        R8         - scratch register
-        R9         - scratch register
-        R10        - scratch register
+        R8         - caches a memory operand within a block
+        R9         - caches a memory operand within a block
+        R10        - caches a memory operand within a block
         R11        - scratch register
         R12        - maps to I1
         R13        - maps to I2
@@ -296,6 +296,16 @@ static uint8_t float_register_map[REG_F_COUNT] =
 #endif
 };
 
+// volatile registers that can hold hot memory operands for the duration of a block
+static const uint8_t cache_register_map[] =
+{
+#ifdef X64_WINDOWS_ABI
+	REG_R10
+#else
+	REG_R8, REG_R9, REG_R10
+#endif
+};
+
 // condition mapping table
 static const uint8_t condition_map[uml::COND_MAX - uml::COND_Z] =
 {
@@ -448,10 +458,14 @@ drcbe_x64::be_parameter::be_parameter(drcbe_x64 &drcbe, const parameter &param,
 			*this = param.immediate();
 			break;
 
-		// memory passes through
+		// memory passes through, unless it is cached in a register for this block
 		case parameter::PTYPE_MEMORY:
 			assert(allowed & PTYPE_M);
-			*this = make_memory(param.memory());
+			regnum = drcbe.m_regcache_active ? drcbe.regcache_lookup(param.memory()) : 0;
+			if (regnum != 0)
+				*this = make_ireg(regnum);
+			else
+				*this = make_memory(param.memory());
 			break;
 
 		// if a register maps to a register, keep it as a register; otherwise map it to memory
@@ -628,10 +642,16 @@ drcbe_x64::drcbe_x64(drcuml_state &drcuml, device_t &device, drc_cache &cache, u
 		m_entry(nullptr),
 		m_exit(nullptr),
 		m_nocode(nullptr),
+		m_regcache_count(0),
+		m_regcache_active(false),
+		m_predict_next(0),
 		m_fixup_label(&drcbe_x64::fixup_label, this),
 		m_fixup_exception(&drcbe_x64::fixup_exception, this),
 		m_near(*(near_state *)cache.alloc_near(sizeof(m_near)))
 {
+	// direct links between blocks are repointed when their target is recompiled
+	m_hash.set_link_fixup(drc_link_fixup_delegate(&drcbe_x64::fixup_link, this));
+
 	// build up necessary arrays
 	static const uint32_t sse_control[4] =
 	{
@@ -785,6 +805,13 @@ void drcbe_x64::reset()
 	// reset our hash tables
 	m_hash.reset();
 	m_hash.set_default_codeptr(m_nocode);
+
+	// forget all hashjmp predictions; the tables they point into are gone
+	for (auto &predict : m_near.hashjmp_predict)
+	{
+		predict.pc = ~0;
+		predict.entry = &m_nocode;
+	}
 }
 
 
@@ -811,8 +838,11 @@ void drcbe_x64::generate(drcuml_block &block, const instruction *instlist, uint3
 	m_labels.block_begin(block);
 	m_map.block_begin(block);
 
+	// pick the memory operands worth keeping in registers for this block
+	regcache_select(instlist, numinst);
+
 	// begin codegen; fail if we can't
-	drccodeptr *cachetop = m_cache.begin_codegen(numinst * 8 * 4);
+	drccodeptr *cachetop = m_cache.begin_codegen(numinst * (8 * 4 + 16 * m_regcache_count));
 	if (cachetop == nullptr)
 		block.abort();
 
@@ -822,6 +852,7 @@ void drcbe_x64::generate(drcuml_block &block, const instruction *instlist, uint3
 
 	// generate code
 	const char *blockname = nullptr;
+	bool fallthrough = false;
 	for (int inum = 0; inum < numinst; inum++)
 	{
 		const instruction &inst = instlist[inum];
@@ -843,9 +874,26 @@ void drcbe_x64::generate(drcuml_block &block, const instruction *instlist, uint3
 				blockname = string_format("Code: mode=%d PC=%08X", (uint32_t)inst.param(0).immediate(), (offs_t)inst.param(1).immediate()).c_str();
 		}
 
+		// cached operands are written back before anything that might look at them
+		// behind our back, and reloaded afterwards; entry points reload them too
+		bool entry = (inst.opcode() == OP_HASH || inst.opcode() == OP_HANDLE);
+		bool barrier = !entry && !regcache_simple(inst.opcode()) && regcache_barrier(inst);
+		if (barrier || (entry && fallthrough))
+			regcache_flush(dst);
+
 		// generate code
+		m_regcache_active = regcache_simple(inst.opcode());
 		(this->*s_opcode_table[inst.opcode()])(dst, inst);
+		m_regcache_active = false;
+
+		if (barrier || entry)
+			regcache_reload(dst);
+
+		// track whether the next instruction can be reached by falling through
+		if (inst.opcode() != OP_COMMENT && inst.opcode() != OP_MAPVAR)
+			fallthrough = (inst.condition() != uml::COND_ALWAYS || (inst.opcode() != OP_JMP && inst.opcode() != OP_HASHJMP && inst.opcode() != OP_EXIT && inst.opcode() != OP_RET));
 	}
+	m_regcache_count = 0;
 
 	// complete codegen
 	*cachetop = (drccodeptr)dst;
@@ -862,6 +910,230 @@ void drcbe_x64::generate(drcuml_block &block, const instruction *instlist, uint3
 }
 
 
+//-------------------------------------------------
+//  regcache_param_size - return the number of
+//  bytes of a memory parameter an instruction
+//  accesses
+//-------------------------------------------------
+
+uint32_t drcbe_x64::regcache_param_size(const instruction &inst, int pnum)
+{
+	if (inst.opcode() == OP_SEXT && pnum == 1)
+		return 1 << inst.param(2).size();
+	return inst.size();
+}
+
+
+//-------------------------------------------------
+//  regcache_simple - return true if an opcode is
+//  plain integer arithmetic whose memory operands
+//  can be replaced by host registers
+//-------------------------------------------------
+
+bool drcbe_x64::regcache_simple(opcode_t opcode)
+{
+	switch (opcode)
+	{
+		case OP_SET:
+		case OP_MOV:
+		case OP_SEXT:
+		case OP_ROLAND:
+		case OP_ROLINS:
+		case OP_ADD:
+		case OP_ADDC:
+		case OP_SUB:
+		case OP_SUBB:
+		case OP_CMP:
+		case OP_AND:
+		case OP_TEST:
+		case OP_OR:
+		case OP_XOR:
+		case OP_LZCNT:
+		case OP_TZCNT:
+		case OP_BSWAP:
+		case OP_SHL:
+		case OP_SHR:
+		case OP_SAR:
+		case OP_ROL:
+		case OP_ROLC:
+		case OP_ROR:
+		case OP_RORC:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+
+//-------------------------------------------------
+//  regcache_select - choose the memory operands
+//  used most by simple instructions in a block,
+//  skipping any that are accessed at different
+//  sizes or overlap other operands
+//-------------------------------------------------
+
+void drcbe_x64::regcache_select(const instruction *instlist, uint32_t numinst)
+{
+	struct candidate
+	{
+		uint8_t *   base;
+		uint32_t    size;
+		uint32_t    uses;
+		bool        conflict;
+	};
+	std::vector<candidate> candidates;
+
+	m_regcache_count = 0;
+	for (int inum = 0; inum < numinst; inum++)
+	{
+		const instruction &inst = instlist[inum];
+		if (!regcache_simple(inst.opcode()))
+			continue;
+
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+			if (inst.param(pnum).is_memory())
+			{
+				uint8_t *base = (uint8_t *)inst.param(pnum).memory();
+				uint32_t size = regcache_param_size(inst, pnum);
+				bool found = false;
+				for (candidate &cand : candidates)
+					if (base < cand.base + cand.size && cand.base < base + size)
+					{
+						if (base == cand.base && size == cand.size)
+						{
+							cand.uses++;
+							found = true;
+						}
+						else
+							cand.conflict = true;
+					}
+				if (!found)
+					candidates.push_back({ base, size, 1, size < 4 });
+			}
+	}
+
+	// a single use doesn't pay for the load and store around it
+	while (m_regcache_count < ARRAY_LENGTH(cache_register_map))
+	{
+		candidate *best = nullptr;
+		for (candidate &cand : candidates)
+			if (!cand.conflict && cand.uses > 2 && (best == nullptr || cand.uses > best->uses))
+				best = &cand;
+		if (best == nullptr)
+			break;
+
+		regcache_entry &entry = m_regcache[m_regcache_count];
+		entry.base = best->base;
+		entry.size = best->size;
+		entry.reg = cache_register_map[m_regcache_count++];
+		best->conflict = true;
+	}
+}
+
+
+//-------------------------------------------------
+//  regcache_barrier - return true if cached
+//  operands must be in memory while an
+//  instruction executes
+//-------------------------------------------------
+
+bool drcbe_x64::regcache_barrier(const instruction &inst) const
+{
+	if (m_regcache_count == 0)
+		return false;
+
+	switch (inst.opcode())
+	{
+		// anything that calls out or leaves the block
+		case OP_DEBUG:
+		case OP_EXIT:
+		case OP_HASHJMP:
+		case OP_EXH:
+		case OP_CALLH:
+		case OP_RET:
+		case OP_CALLC:
+		case OP_RECOVER:
+		case OP_READ:
+		case OP_READM:
+		case OP_WRITE:
+		case OP_WRITEM:
+		case OP_FREAD:
+		case OP_FWRITE:
+
+		// anything that indexes memory, which might alias a cached operand
+		case OP_LOAD:
+		case OP_LOADS:
+		case OP_STORE:
+		case OP_FLOAD:
+		case OP_FSTORE:
+			return true;
+
+		// otherwise only if it touches a cached operand directly
+		default:
+			for (int pnum = 0; pnum < inst.numparams(); pnum++)
+				if (inst.param(pnum).is_memory())
+				{
+					uint8_t *base = (uint8_t *)inst.param(pnum).memory();
+					for (int cachenum = 0; cachenum < m_regcache_count; cachenum++)
+						if (base < (uint8_t *)m_regcache[cachenum].base + m_regcache[cachenum].size && (uint8_t *)m_regcache[cachenum].base < base + 8)
+							return true;
+				}
+			return false;
+	}
+}
+
+
+//-------------------------------------------------
+//  regcache_lookup - return the host register
+//  caching a memory operand, or 0 if none
+//-------------------------------------------------
+
+int drcbe_x64::regcache_lookup(const void *base) const
+{
+	for (int cachenum = 0; cachenum < m_regcache_count; cachenum++)
+		if (m_regcache[cachenum].base == base)
+			return m_regcache[cachenum].reg;
+	return 0;
+}
+
+
+//-------------------------------------------------
+//  regcache_flush - write cached operands back
+//  to memory
+//-------------------------------------------------
+
+void drcbe_x64::regcache_flush(x86code *&dst)
+{
+	for (int cachenum = 0; cachenum < m_regcache_count; cachenum++)
+	{
+		const regcache_entry &entry = m_regcache[cachenum];
+		if (entry.size == 4)
+			emit_mov_m32_r32(dst, MABS(entry.base), entry.reg);                      // mov   [base],reg
+		else
+			emit_mov_m64_r64(dst, MABS(entry.base), entry.reg);                      // mov   [base],reg
+	}
+}
+
+
+//-------------------------------------------------
+//  regcache_reload - load cached operands from
+//  memory
+//-------------------------------------------------
+
+void drcbe_x64::regcache_reload(x86code *&dst)
+{
+	for (int cachenum = 0; cachenum < m_regcache_count; cachenum++)
+	{
+		const regcache_entry &entry = m_regcache[cachenum];
+		if (entry.size == 4)
+			emit_mov_r32_m32(dst, entry.reg, MABS(entry.base));                      // mov   reg,[base]
+		else
+			emit_mov_r64_m64(dst, entry.reg, MABS(entry.base));                      // mov   reg,[base]
+	}
+}
+
+
 //-------------------------------------------------
 //  hash_exists - return true if the given mode/pc
 //  exists in the hash table
@@ -873,6 +1145,17 @@ bool drcbe_x64::hash_exists(uint32_t mode, uint32_t pc)
 }
 
 
+//-------------------------------------------------
+//  hash_invalidate - forget the code for the
+//  given mode/pc
+//-------------------------------------------------
+
+void drcbe_x64::hash_invalidate(uint32_t mode, uint32_t pc)
+{
+	m_hash.invalidate(mode, pc);
+}
+
+
 //-------------------------------------------------
 //  get_info - return information about the
 //  back-end implementation
@@ -2607,6 +2890,23 @@ void drcbe_x64::fixup_label(void *parameter, drccodeptr labelcodeptr)
 }
 
 
+//-------------------------------------------------
+//  fixup_link - callback to repoint a direct
+//  call between blocks; site is the address just
+//  past the call's displacement
+//-------------------------------------------------
+
+void drcbe_x64::fixup_link(drccodeptr site, drccodeptr target)
+{
+	assert(site[-5] == 0xe8);
+
+	// an unlinked call just falls through to the generic lookup that follows it
+	if (target == nullptr)
+		target = site;
+	((int32_t *)site)[-1] = target - site;
+}
+
+
 //-------------------------------------------------
 //  fixup_exception - callback to perform cleanup
 //  and jump to an exception handler
@@ -2865,25 +3165,47 @@ void drcbe_x64::op_hashjmp(x86code *&dst, const instruction &inst)
 	// fixed mode cases
 	if (modep.is_immediate() && m_hash.is_mode_populated(modep.immediate()))
 	{
-		// a straight immediate jump is direct, though we need the PC in EAX in case of failure
+		// a straight immediate jump is linked directly to its target, and repointed
+		// by the hash table whenever the target is (re)compiled
 		if (pcp.is_immediate())
 		{
-			uint32_t l1val = (pcp.immediate() >> m_hash.l1shift()) & m_hash.l1mask();
-			uint32_t l2val = (pcp.immediate() >> m_hash.l2shift()) & m_hash.l2mask();
-			emit_call_m64(dst, MABS(&m_hash.base()[modep.immediate()][l1val][l2val]));
-																						// call  hash[modep][l1val][l2val]
+			drccodeptr target = m_hash.get_codeptr(modep.immediate(), pcp.immediate());
+			emit_call(dst, (target != nullptr) ? target : dst);                        // call  target
+			m_hash.add_link(modep.immediate(), pcp.immediate(), dst);
 		}
 
-		// a fixed mode but variable PC
+		// a fixed mode but variable PC first tries the entry this site used last time,
+		// which catches subroutine returns to the same caller
 		else
 		{
+			auto &predict = m_near.hashjmp_predict[m_predict_next++ % ARRAY_LENGTH(m_near.hashjmp_predict)];
+			emit_link miss, done, skip;
 			emit_mov_r32_p32(dst, REG_EAX, pcp);                                        // mov   eax,pcp
+			emit_cmp_m32_r32(dst, MABS(&predict.pc), REG_EAX);                          // cmp   [predict.pc],eax
+			emit_jcc_short_link(dst, x64emit::COND_NE, miss);                           // jne   miss
+			emit_mov_r64_m64(dst, REG_RDX, MABS(&predict.entry));                       // mov   rdx,[predict.entry]
+			emit_call_m64(dst, MBD(REG_RDX, 0));                                        // call  [rdx]
+			emit_jmp_short_link(dst, done);                                             // jmp   done
+
+			resolve_link(dst, miss);                                                // miss:
+			emit_mov_r32_r32(dst, REG_ECX, REG_EAX);                                    // mov   ecx,eax
 			emit_mov_r32_r32(dst, REG_EDX, REG_EAX);                                    // mov   edx,eax
 			emit_shr_r32_imm(dst, REG_EDX, m_hash.l1shift());                           // shr   edx,l1shift
 			emit_and_r32_imm(dst, REG_EAX, m_hash.l2mask() << m_hash.l2shift());        // and  eax,l2mask << l2shift
 			emit_mov_r64_m64(dst, REG_RDX, MBISD(REG_RBP, REG_RDX, 8, offset_from_rbp(&m_hash.base()[modep.immediate()][0])));
 																						// mov   rdx,hash[modep+edx*8]
-			emit_call_m64(dst, MBISD(REG_RDX, REG_RAX, 8 >> m_hash.l2shift(), 0));      // call  [rdx+rax*shift]
+			emit_lea_r64_m64(dst, REG_RDX, MBISD(REG_RDX, REG_RAX, 8 >> m_hash.l2shift(), 0));
+																						// lea   rdx,[rdx+rax*shift]
+
+			// only remember entries in populated tables; the shared empty table never changes
+			emit_mov_r64_imm(dst, REG_R11, (uintptr_t)m_nocode);                        // mov   r11,nocode
+			emit_cmp_m64_r64(dst, MBD(REG_RDX, 0), REG_R11);                            // cmp   [rdx],r11
+			emit_jcc_short_link(dst, x64emit::COND_E, skip);                            // je    skip
+			emit_mov_m32_r32(dst, MABS(&predict.pc), REG_ECX);                          // mov   [predict.pc],ecx
+			emit_mov_m64_r64(dst, MABS(&predict.entry), REG_RDX);                       // mov   [predict.entry],rdx
+			resolve_link(dst, skip);                                                // skip:
+			emit_call_m64(dst, MBD(REG_RDX, 0));                                        // call  [rdx]
+			resolve_link(dst, done);                                                // done:
 		}
 	}
 	else
@@ -40,6 +40,7 @@ public:
 	virtual int execute(uml::code_handle &entry) override;
 	virtual void generate(drcuml_block &block, const uml::instruction *instlist, uint32_t numinst) override;
 	virtual bool hash_exists(uint32_t mode, uint32_t pc) override;
+	virtual void hash_invalidate(uint32_t mode, uint32_t pc) override;
 	virtual void get_info(drcbe_info &info) override;
 	virtual bool logging() const override { return m_log != nullptr; }
 
@@ -121,7 +122,17 @@ private:
 	void emit_smart_call_r64(x86code *&dst, x86code *target, uint8_t reg);
 	void emit_smart_call_m64(x86code *&dst, x86code **target);
 
+	// per-block caching of memory operands in host registers
+	static uint32_t regcache_param_size(const uml::instruction &inst, int pnum);
+	static bool regcache_simple(uml::opcode_t opcode);
+	void regcache_select(const uml::instruction *instlist, uint32_t numinst);
+	bool regcache_barrier(const uml::instruction &inst) const;
+	int regcache_lookup(const void *base) const;
+	void regcache_flush(x86code *&dst);
+	void regcache_reload(x86code *&dst);
+
 	void fixup_label(void *parameter, drccodeptr labelcodeptr);
+	void fixup_link(drccodeptr site, drccodeptr target);
 	void fixup_exception(drccodeptr *codeptr, void *param1, void *param2);
 
 	static void debug_log_hashjmp(offs_t pc, int mode);
@@ -308,6 +319,18 @@ private:
 	x86code *               m_exit;                 // exit point
 	x86code *               m_nocode;               // nocode handler
 
+	// a memory operand cached in a host register for the current block
+	struct regcache_entry
+	{
+		void *              base;                   // address of the operand
+		uint32_t            size;                   // size of the operand in bytes
+		uint8_t             reg;                    // host register holding it
+	};
+	regcache_entry          m_regcache[3];          // cached operands
+	int                     m_regcache_count;       // number of cached operands
+	bool                    m_regcache_active;      // substitute cached operands for memory?
+	uint32_t                m_predict_next;         // next hashjmp prediction slot to hand out
+
 	drc_label_fixup_delegate m_fixup_label;         // precomputed delegate for fixups
 	drc_oob_delegate        m_fixup_exception;      // precomputed delegate for exception fixups
 
@@ -328,6 +351,12 @@ private:
 		void *              stacksave;              // saved stack pointer
 		void *              hashstacksave;          // saved stack pointer for hashjmp
 
+		struct
+		{
+			uint32_t            pc;                 // PC last dispatched from this slot
+			drccodeptr *        entry;              // hash table entry it dispatched through
+		}                   hashjmp_predict[256];   // last targets of variable-PC hashjmps
+
 		uint8_t               flagsmap[0x1000];       // flags map
 		uint64_t              flagsunmap[0x20];       // flags unmapper
 	};
@@ -836,6 +836,17 @@ bool drcbe_x86::hash_exists(uint32_t mode, uint32_t pc)
 }
 
 
+//-------------------------------------------------
+//  drcbex86_hash_invalidate - forget the code
+//  for the given mode/pc
+//-------------------------------------------------
+
+void drcbe_x86::hash_invalidate(uint32_t mode, uint32_t pc)
+{
+	m_hash.invalidate(mode, pc);
+}
+
+
 //-------------------------------------------------
 //  drcbex86_get_info - return information about
 //  the back-end implementation
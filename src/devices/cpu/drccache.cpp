@@ -21,6 +21,9 @@
 #define ALIGN_PTR_UP(p)         ((void *)(((uintptr_t)(p) + (CACHE_ALIGNMENT - 1)) & ~(CACHE_ALIGNMENT - 1)))
 #define ALIGN_PTR_DOWN(p)       ((void *)((uintptr_t)(p) & ~(CACHE_ALIGNMENT - 1)))
 
+// round a size up to a whole number of commit segments
+#define ALIGN_SEGMENT_UP(s)     (((s) + (CACHE_SEGMENT_SIZE - 1)) & ~(CACHE_SEGMENT_SIZE - 1))
+
 
 
 //**************************************************************************
@@ -28,20 +31,40 @@
 //**************************************************************************
 
 //-------------------------------------------------
-//  drc_cache - constructor
+//  drc_cache - constructor; the full limit is
+//  reserved up front so that everything stays
+//  within reach of the near area, but memory is
+//  only committed in segments as it fills up, so
+//  that cores flush far less often
 //-------------------------------------------------
 
-drc_cache::drc_cache(size_t bytes)
-	: m_near((drccodeptr)osd_alloc_executable(bytes)),
-		m_neartop(m_near),
-		m_base(m_near + NEAR_CACHE_SIZE),
-		m_top(m_base),
-		m_end(m_near + bytes),
+drc_cache::drc_cache(size_t bytes, size_t maxbytes)
+	: m_near(nullptr),
+		m_neartop(nullptr),
+		m_base(nullptr),
+		m_top(nullptr),
+		m_end(nullptr),
 		m_codegen(nullptr),
-		m_size(bytes)
+		m_limit(nullptr),
+		m_permbase(nullptr),
+		m_size(ALIGN_SEGMENT_UP(std::max(bytes, (maxbytes != 0) ? maxbytes : bytes * DEFAULT_GROWTH_FACTOR))),
+		m_budget(0)
 {
 	memset(m_free, 0, sizeof(m_free));
 	memset(m_nearfree, 0, sizeof(m_nearfree));
+
+	// reserve the whole range, then commit the initial size split between the
+	// code growing up from the base and permanent allocations growing down from the end
+	m_near = (drccodeptr)osd_reserve_executable(m_size);
+	size_t initial = ALIGN_SEGMENT_UP(std::max<size_t>(bytes, NEAR_CACHE_SIZE + 2 * CACHE_SEGMENT_SIZE));
+	m_neartop = m_near;
+	m_base = m_near + NEAR_CACHE_SIZE;
+	m_top = m_base;
+	m_end = m_near + m_size;
+	m_limit = m_near + std::min(initial, m_size) - CACHE_SEGMENT_SIZE;
+	m_permbase = m_end - CACHE_SEGMENT_SIZE;
+	if (m_near != nullptr && (!osd_commit_executable(m_near, m_limit - m_near) || !osd_commit_executable(m_permbase, CACHE_SEGMENT_SIZE)))
+		throw std::bad_alloc();
 }
 
 
@@ -94,7 +117,7 @@ void *drc_cache::alloc(size_t bytes)
 
 	// if no space, we just fail
 	drccodeptr ptr = (drccodeptr)ALIGN_PTR_DOWN(m_end - bytes);
-	if (m_top > ptr)
+	if (m_top > ptr || !grow_permanent(ptr))
 		return nullptr;
 
 	// otherwise update the end of the cache
@@ -147,7 +170,7 @@ void *drc_cache::alloc_temporary(size_t bytes)
 
 	// if no space, we just fail
 	drccodeptr ptr = m_top;
-	if (ptr + bytes >= m_end)
+	if (ptr + bytes >= m_end || !grow_code(ptr + bytes + CACHE_ALIGNMENT))
 		return nullptr;
 
 	// otherwise, update the cache top
@@ -190,9 +213,9 @@ drccodeptr *drc_cache::begin_codegen(uint32_t reserve_bytes)
 	assert(m_codegen == nullptr);
 	assert(m_ooblist.first() == nullptr);
 
-	// if still no space, we just fail
+	// if still no space, we just fail; leave room for out-of-band code as well
 	drccodeptr ptr = m_top;
-	if (ptr + reserve_bytes >= m_end)
+	if (ptr + reserve_bytes >= m_end || !grow_code(std::min(ptr + reserve_bytes + CODEGEN_MAX_BYTES, m_end)))
 		return nullptr;
 
 	// otherwise, return a pointer to the cache top
@@ -250,3 +273,45 @@ void drc_cache::request_oob_codegen(drc_oob_delegate callback, void *param1, voi
 	// add to the tail
 	m_ooblist.append(*oob);
 }
+
+
+//-------------------------------------------------
+//  grow_code - make sure memory is committed for
+//  code up to the given address
+//-------------------------------------------------
+
+bool drc_cache::grow_code(drccodeptr end)
+{
+	// the permanent area above m_permbase is committed as well
+	if (end <= m_limit || m_limit == m_permbase)
+		return true;
+
+	drccodeptr newlimit = std::min(m_near + ALIGN_SEGMENT_UP(size_t(end - m_near)), m_permbase);
+	// past the budget, fail so that the core flushes the cache instead of growing it
+	if (m_budget != 0 && committed_bytes() + (newlimit - m_limit) > m_budget)
+		return false;
+	if (!osd_commit_executable(m_limit, newlimit - m_limit))
+		return false;
+	m_limit = newlimit;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  grow_permanent - make sure memory is committed
+//  for permanent allocations down to the given
+//  address
+//-------------------------------------------------
+
+bool drc_cache::grow_permanent(drccodeptr start)
+{
+	// the code area below m_limit is committed as well
+	if (start >= m_permbase || m_permbase == m_limit)
+		return true;
+
+	drccodeptr newbase = std::max(m_near + (size_t(start - m_near) & ~(CACHE_SEGMENT_SIZE - 1)), m_limit);
+	if (!osd_commit_executable(newbase, m_permbase - newbase))
+		return false;
+	m_permbase = newbase;
+	return true;
+}
@@ -42,13 +42,14 @@ class drc_cache
 {
 public:
 	// construction/destruction
-	drc_cache(size_t bytes);
+	drc_cache(size_t bytes, size_t maxbytes = 0);
 	~drc_cache();
 
 	// getters
 	drccodeptr near() const { return m_near; }
 	drccodeptr base() const { return m_base; }
 	drccodeptr top() const { return m_top; }
+	size_t committed_bytes() const { return (m_limit - m_near) + (m_end - m_permbase); }
 
 	// pointer checking
 	bool contains_pointer(const void *ptr) const { return ((const drccodeptr)ptr >= m_near && (const drccodeptr)ptr < m_near + m_size); }
@@ -56,6 +57,7 @@ public:
 	bool generating_code() const { return (m_codegen != nullptr); }
 
 	// memory management
+	void set_budget(size_t bytes) { m_budget = bytes; }
 	void flush();
 	void *alloc(size_t bytes);
 	void *alloc_near(size_t bytes);
@@ -80,6 +82,20 @@ private:
 	// size of "near" area at the base of the cache
 	static const size_t NEAR_CACHE_SIZE = 65536;
 
+	// granularity in which memory is committed as the cache grows
+	static const size_t CACHE_SEGMENT_SIZE = 1024 * 1024;
+
+	// how far the cache may grow beyond its initial size when the caller gives no limit
+#ifdef PTR64
+	static const size_t DEFAULT_GROWTH_FACTOR = 4;
+#else
+	static const size_t DEFAULT_GROWTH_FACTOR = 1;
+#endif
+
+	// internal helpers
+	bool grow_code(drccodeptr end);
+	bool grow_permanent(drccodeptr start);
+
 	// core parameters
 	drccodeptr          m_near;             // pointer to the near part of the cache
 	drccodeptr          m_neartop;          // top of the near part of the cache
@@ -87,7 +103,10 @@ private:
 	drccodeptr          m_top;              // current top of cache
 	drccodeptr          m_end;              // end of cache memory
 	drccodeptr          m_codegen;          // start of generated code
-	size_t              m_size;             // size of the cache in bytes
+	drccodeptr          m_limit;            // end of the committed memory above the base
+	drccodeptr          m_permbase;         // start of the committed memory for permanent allocations
+	size_t              m_size;             // size of the reserved cache in bytes
+	size_t              m_budget;           // bytes past which code no longer grows the cache, or 0 for no limit
 
 	// oob management
 	struct oob_handler
@@ -17,6 +17,9 @@
 
 #include "emu.h"
 #include "drcfe.h"
+#include "drcuml.h"
+#include "emuopts.h"
+#include "romload.h"
 
 
 //**************************************************************************
@@ -25,6 +28,11 @@
 
 const uint32_t MAX_STACK_DEPTH = 100;
 
+// warm cache limits
+const int WARM_MAX_BLOCKS = 65536;                  // most blocks remembered per CPU
+const int WARM_CHECKS_PER_CALL = 8;                 // most blocks validated per next_block() call
+const int WARM_MAX_ATTEMPTS = 16;                   // validations before a block is forgotten for the run
+
 
 
 //**************************************************************************
@@ -73,12 +81,16 @@ drc_frontend::~drc_frontend()
 
 //-------------------------------------------------
 //  describe_code - describe a sequence of code
-//  that falls within the configured window
-//  relative to the specified startpc
+//  that falls within the given window relative
+//  to the specified startpc; the window is
+//  clamped to the configured one
 //-------------------------------------------------
 
-const opcode_desc *drc_frontend::describe_code(offs_t startpc)
+const opcode_desc *drc_frontend::describe_code(offs_t startpc, uint32_t window_start, uint32_t window_end)
 {
+	window_start = std::min(window_start, m_window_start);
+	window_end = std::min(window_end, m_window_end);
+
 	// release any descriptions we've accumulated
 	release_descriptions();
 
@@ -90,8 +102,8 @@ const opcode_desc *drc_frontend::describe_code(offs_t startpc)
 	pcstackptr++;
 
 	// loop while we still have a stack
-	offs_t minpc = startpc - std::min(m_window_start, startpc);
-	offs_t maxpc = startpc + std::min(m_window_end, 0xffffffff - startpc);
+	offs_t minpc = startpc - std::min(window_start, startpc);
+	offs_t maxpc = startpc + std::min(window_end, 0xffffffff - startpc);
 	while (pcstackptr != &pcstack[0])
 	{
 		// if we've already hit this PC, just mark it a branch target and continue
@@ -387,3 +399,294 @@ void drc_frontend::release_descriptions()
 	// reclaim all the descriptors
 	m_desc_allocator.reclaim_all(m_desc_live_list);
 }
+
+
+
+//**************************************************************************
+//  DRC WARM CACHE
+//**************************************************************************
+
+//-------------------------------------------------
+//  drc_warm_cache - constructor
+//-------------------------------------------------
+
+drc_warm_cache::drc_warm_cache(drc_frontend &frontend, device_t &cpu)
+	: m_frontend(frontend),
+		m_cpu(cpu),
+		m_enabled(cpu.machine().options().drc_warm_cache())
+{
+	if (!m_enabled)
+		return;
+
+	// read the blocks remembered last time, and write them back out on exit
+	load();
+	cpu.machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&drc_warm_cache::save, this));
+}
+
+
+//-------------------------------------------------
+//  block_compiled - note a freshly compiled
+//  block so that it is remembered next time
+//-------------------------------------------------
+
+void drc_warm_cache::block_compiled(uint32_t mode, offs_t pc, const opcode_desc *desclist)
+{
+	if (m_enabled && m_compiled.size() < WARM_MAX_BLOCKS)
+		m_compiled[(uint64_t(mode) << 32) | pc] = checksum(desclist);
+}
+
+
+//-------------------------------------------------
+//  next_block - find the next remembered block
+//  for the current mode whose code describes the
+//  same as when it was remembered; blocks that
+//  don't match yet (for example because the code
+//  hasn't been copied to RAM) are retried on
+//  later calls
+//-------------------------------------------------
+
+bool drc_warm_cache::next_block(uint32_t mode, offs_t &pc)
+{
+	for (int checks = 0; checks < WARM_CHECKS_PER_CALL && !m_pending.empty(); checks++)
+	{
+		block_entry entry = m_pending.front();
+		m_pending.pop_front();
+
+		// the frontend decodes in the CPU's current mode, so blocks from other
+		// modes wait until the CPU is back in theirs
+		if (entry.mode != mode)
+		{
+			m_pending.push_back(entry);
+			continue;
+		}
+
+		if (checksum(m_frontend.describe_code(entry.pc)) == entry.checksum)
+		{
+			pc = entry.pc;
+			return true;
+		}
+		if (++entry.attempts < WARM_MAX_ATTEMPTS)
+			m_pending.push_back(entry);
+	}
+	return false;
+}
+
+
+//-------------------------------------------------
+//  checksum - compute a checksum over the PCs
+//  and opcodes of a description list
+//-------------------------------------------------
+
+uint32_t drc_warm_cache::checksum(const opcode_desc *desclist)
+{
+	util::crc32_creator crc;
+	for (const opcode_desc *desc = desclist; desc != nullptr; desc = desc->next())
+	{
+		crc.append(&desc->pc, sizeof(desc->pc));
+		crc.append(desc->opptr.b, std::min<uint32_t>(desc->length, sizeof(desc->opptr.b)));
+	}
+	return crc.finish();
+}
+
+
+//-------------------------------------------------
+//  rom_hash - compute a checksum over the hashes
+//  of every ROM in the system, so that a cache
+//  is never applied to a different ROM set
+//-------------------------------------------------
+
+uint32_t drc_warm_cache::rom_hash() const
+{
+	util::crc32_creator crc;
+	for (device_t &device : device_iterator(m_cpu.machine().root_device()))
+		for (const rom_entry *region = rom_first_region(device); region != nullptr; region = rom_next_region(region))
+			for (const rom_entry *rom = rom_first_file(region); rom != nullptr; rom = rom_next_file(rom))
+				crc.append(ROM_GETHASHDATA(rom), strlen(ROM_GETHASHDATA(rom)));
+	return crc.finish();
+}
+
+
+//-------------------------------------------------
+//  filename - return the name of the cache file
+//  for this CPU
+//-------------------------------------------------
+
+std::string drc_warm_cache::filename() const
+{
+	std::string tag(m_cpu.tag() + 1);
+	std::replace(tag.begin(), tag.end(), ':', '_');
+	return std::string(m_cpu.machine().system().name).append(PATH_SEPARATOR).append(tag).append(".drc");
+}
+
+
+//-------------------------------------------------
+//  load - read the remembered blocks for this
+//  CPU, ignoring them if the ROMs differ
+//-------------------------------------------------
+
+void drc_warm_cache::load()
+{
+	emu_file file(m_cpu.machine().options().cfg_directory(), OPEN_FLAG_READ);
+	if (file.open(filename()) != osd_file::error::NONE)
+		return;
+
+	char line[256];
+	unsigned int hash;
+	if (file.gets(line, sizeof(line)) == nullptr || sscanf(line, "rom %x", &hash) != 1 || hash != rom_hash())
+		return;
+
+	while (file.gets(line, sizeof(line)) != nullptr && m_pending.size() < WARM_MAX_BLOCKS)
+	{
+		unsigned int mode, pc, sum;
+		if (sscanf(line, "%x %x %x", &mode, &pc, &sum) == 3)
+			m_pending.push_back(block_entry{ mode, pc, sum, 0 });
+	}
+}
+
+
+//-------------------------------------------------
+//  save - write out the blocks compiled during
+//  this run, along with any remembered blocks
+//  that never came up
+//-------------------------------------------------
+
+void drc_warm_cache::save()
+{
+	emu_file file(m_cpu.machine().options().cfg_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(filename()) != osd_file::error::NONE)
+		return;
+
+	file.printf("rom %08x\n", rom_hash());
+	int count = 0;
+	for (const auto &block : m_compiled)
+		if (count++ < WARM_MAX_BLOCKS)
+			file.printf("%x %08x %08x\n", uint32_t(block.first >> 32), uint32_t(block.first), block.second);
+	for (const block_entry &entry : m_pending)
+		if (count++ < WARM_MAX_BLOCKS && m_compiled.find((uint64_t(entry.mode) << 32) | entry.pc) == m_compiled.end())
+			file.printf("%x %08x %08x\n", entry.mode, entry.pc, entry.checksum);
+}
+
+
+
+//**************************************************************************
+//  DRC BLOCK TIERS
+//**************************************************************************
+
+//-------------------------------------------------
+//  drc_block_tiers - constructor
+//-------------------------------------------------
+
+drc_block_tiers::drc_block_tiers(device_t &cpu)
+	: m_threshold(std::max(cpu.machine().options().drc_tier_threshold(), 0))
+{
+}
+
+
+//-------------------------------------------------
+//  cold_counter - decide how to compile a block;
+//  blocks seen for the first time are compiled
+//  cold with a counter for the generated code to
+//  decrement on entry, and once that reaches zero
+//  the next compile of the block is a hot one
+//-------------------------------------------------
+
+uint32_t *drc_block_tiers::cold_counter(uint32_t mode, offs_t pc)
+{
+	if (m_threshold == 0)
+		return nullptr;
+
+	// counters live in the map's nodes, which stay put until reset()
+	auto found = m_counters.emplace((uint64_t(mode) << 32) | pc, m_threshold);
+	if (!found.second)
+	{
+		if (found.first->second == 0)
+			return nullptr;
+		found.first->second = m_threshold;
+	}
+	return &found.first->second;
+}
+
+
+
+//**************************************************************************
+//  DRC CODE PAGES
+//**************************************************************************
+
+//-------------------------------------------------
+//  drc_code_pages - constructor
+//-------------------------------------------------
+
+drc_code_pages::drc_code_pages(drcuml_state &drcuml, uint8_t addrbits, uint8_t pageshift)
+	: m_drcuml(drcuml),
+		m_addrmask((addrbits >= 32) ? ~offs_t(0) : ((offs_t(1) << addrbits) - 1)),
+		m_pageshift(pageshift),
+		m_flags((size_t(m_addrmask) >> pageshift) + 1, 0)
+{
+}
+
+
+//-------------------------------------------------
+//  block_compiled - record the pages covered by
+//  a block against the entry point of each of
+//  its sequences
+//-------------------------------------------------
+
+void drc_code_pages::block_compiled(uint32_t mode, const opcode_desc *desclist, offs_t addrmask)
+{
+	// gather the sequence heads, which are the only places the block is entered
+	std::vector<code_entry> heads;
+	bool seqstart = true;
+	for (const opcode_desc *desc = desclist; desc != nullptr; desc = desc->next())
+	{
+		if (seqstart)
+			heads.push_back(code_entry{ mode, desc->pc });
+		seqstart = (desc->flags & OPFLAG_END_SEQUENCE) != 0;
+	}
+
+	// every page touched by any instruction leads back to all of them
+	offs_t lastpage = ~offs_t(0);
+	for (const opcode_desc *desc = desclist; desc != nullptr; desc = desc->next())
+	{
+		offs_t startpage = (desc->physpc & addrmask & m_addrmask) >> m_pageshift;
+		offs_t endpage = ((desc->physpc + desc->length - 1) & addrmask & m_addrmask) >> m_pageshift;
+		for (offs_t page = startpage; page <= endpage; page++)
+			if (page != lastpage)
+			{
+				std::vector<code_entry> &entries = m_entries[page];
+				entries.insert(entries.end(), heads.begin(), heads.end());
+				m_flags[page] = 1;
+				lastpage = page;
+			}
+	}
+}
+
+
+//-------------------------------------------------
+//  reset - forget all pages when the code cache
+//  is flushed
+//-------------------------------------------------
+
+void drc_code_pages::reset()
+{
+	std::fill(m_flags.begin(), m_flags.end(), 0);
+	m_entries.clear();
+}
+
+
+//-------------------------------------------------
+//  invalidate_page - drop every block entered
+//  through code on the given page; they will be
+//  recompiled when next reached
+//-------------------------------------------------
+
+void drc_code_pages::invalidate_page(offs_t page)
+{
+	auto found = m_entries.find(page);
+	if (found != m_entries.end())
+	{
+		for (const code_entry &entry : found->second)
+			m_drcuml.hash_invalidate(entry.mode, entry.pc);
+		m_entries.erase(found);
+	}
+	m_flags[page] = 0;
+}
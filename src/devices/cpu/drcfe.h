@@ -34,6 +34,10 @@
 #ifndef __DRCFE_H__
 #define __DRCFE_H__
 
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -84,6 +88,8 @@ const uint32_t OPFLAG_WRITES_MEMORY           = 0x00200000;       // instruction
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+class drcuml_state;
+
 // description of a given opcode
 struct opcode_desc
 {
@@ -133,7 +139,8 @@ public:
 	virtual ~drc_frontend();
 
 	// describe a block
-	const opcode_desc *describe_code(offs_t startpc);
+	const opcode_desc *describe_code(offs_t startpc) { return describe_code(startpc, m_window_start, m_window_end); }
+	const opcode_desc *describe_code(offs_t startpc, uint32_t window_start, uint32_t window_end);
 
 protected:
 	// required overrides
@@ -163,4 +170,111 @@ private:
 };
 
 
+// remembers the blocks a DRC core compiled on previous runs of the same set,
+// so they can be compiled again as soon as their code is present
+class drc_warm_cache
+{
+public:
+	// construction/destruction
+	drc_warm_cache(drc_frontend &frontend, device_t &cpu);
+
+	// note a freshly compiled block
+	void block_compiled(uint32_t mode, offs_t pc, const opcode_desc *desclist);
+
+	// return the next remembered block for the given mode whose code is present and unchanged
+	bool next_block(uint32_t mode, offs_t &pc);
+
+private:
+	// a remembered block
+	struct block_entry
+	{
+		uint32_t        mode;                       // mode the block was compiled in
+		offs_t          pc;                         // starting PC of the block
+		uint32_t        checksum;                   // checksum of the described code
+		uint8_t         attempts;                   // number of failed validations this run
+	};
+
+	// internal helpers
+	static uint32_t checksum(const opcode_desc *desclist);
+	uint32_t rom_hash() const;
+	std::string filename() const;
+	void load();
+	void save();
+
+	// internal state
+	drc_frontend &      m_frontend;                 // frontend used to validate blocks
+	device_t &          m_cpu;                      // CPU device we belong to
+	bool                m_enabled;                  // is the cache enabled?
+	std::unordered_map<uint64_t, uint32_t> m_compiled; // blocks compiled during this run, by mode/pc
+	std::deque<block_entry> m_pending;              // remembered blocks not yet compiled
+};
+
+
+// tracks how often DRC blocks are entered, so that code which only runs a few
+// times gets a cheap compile and only hot code pays for a full one
+class drc_block_tiers
+{
+public:
+	// construction/destruction
+	drc_block_tiers(device_t &cpu);
+
+	// return the entry counter for a cold compile of a block, or nullptr for a hot one
+	uint32_t *cold_counter(uint32_t mode, offs_t pc);
+
+	// force the next compile of a block to be hot
+	void promote(uint32_t mode, offs_t pc) { if (m_threshold != 0) m_counters[(uint64_t(mode) << 32) | pc] = 0; }
+
+	// forget all counters when the code cache is flushed
+	void reset() { m_counters.clear(); }
+
+private:
+	// internal state
+	uint32_t            m_threshold;                // entries before a block is compiled hot, or 0
+	std::unordered_map<uint64_t, uint32_t> m_counters; // remaining entries of cold blocks, by mode/pc
+};
+
+
+// tracks which pages of memory hold compiled code, so that a write to one of
+// them invalidates just the blocks built from that page instead of the cache
+class drc_code_pages
+{
+public:
+	// construction/destruction
+	drc_code_pages(drcuml_state &drcuml, uint8_t addrbits, uint8_t pageshift = 12);
+
+	// getters
+	uint8_t *page_flags() { return &m_flags[0]; }
+	uint8_t pageshift() const { return m_pageshift; }
+	bool has_code(offs_t address) const { return m_flags[(address & m_addrmask) >> m_pageshift] != 0; }
+
+	// note a freshly compiled block; addrmask folds mirrored addresses together
+	void block_compiled(uint32_t mode, const opcode_desc *desclist, offs_t addrmask = ~0);
+
+	// note a write, invalidating any code in its page
+	void write(offs_t address) { if (has_code(address)) invalidate_page((address & m_addrmask) >> m_pageshift); }
+	void write_tap(address_space &space, offs_t address, u64 data, u64 mask) { write(space.address_to_byte(address)); }
+
+	// forget everything when the code cache is flushed
+	void reset();
+
+private:
+	// an entry point into compiled code
+	struct code_entry
+	{
+		uint32_t        mode;                       // mode of the entry point
+		offs_t          pc;                         // PC of the entry point
+	};
+
+	// internal helpers
+	void invalidate_page(offs_t page);
+
+	// internal state
+	drcuml_state &      m_drcuml;                   // UML state holding the hash tables
+	offs_t              m_addrmask;                 // mask of valid address bits
+	uint8_t             m_pageshift;                // shift to convert address to a page index
+	std::vector<uint8_t> m_flags;                   // non-zero for each page holding code
+	std::unordered_map<offs_t, std::vector<code_entry>> m_entries; // entry points of blocks touching each page
+};
+
+
 #endif /* __DRCFE_H__ */
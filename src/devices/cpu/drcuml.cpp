@@ -11,7 +11,7 @@
     Future improvements/changes:
 
     * UML optimizer:
-        - constant folding
+        - constant folding across memory operands
 
     * Write a back-end validator:
         - checks all combinations of memory/register/immediate on all params
@@ -131,7 +131,10 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, uint32_t flags, i
 			std::unique_ptr<drcbe_interface>{ std::make_unique<drcbe_c>(*this, device, cache, flags, modes, addrbits, ignorebits) } :
 			std::unique_ptr<drcbe_interface>{ std::make_unique<drcbe_native>(*this, device, cache, flags, modes, addrbits, ignorebits) }),
 		m_beintf(*m_drcbe_interface.get()),
-		m_umllog(nullptr)
+		m_umllog(nullptr),
+		m_profiling(device.machine().options().drc_profile()),
+		m_profile_current(nullptr),
+		m_profile_start(0)
 {
 	// if we're to log, create the logfile
 	if (device.machine().options().drc_log_uml())
@@ -139,6 +142,14 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, uint32_t flags, i
 		std::string filename = std::string("drcuml_").append(m_device.shortname()).append(".asm");
 		m_umllog = fopen(filename.c_str(), "w");
 	}
+
+	// if we're profiling, write the report while the address spaces are still around
+	if (m_profiling)
+		device.machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&drcuml_state::profile_report, this));
+
+	// keep the cache within its budget and account for it
+	cache.set_budget(size_t(std::max(device.machine().options().drc_cache_budget(), 0)) << 20);
+	device.machine().memreport().add_reporter([&cache, &device] (memory_report &report) { report.add("DRC caches", device.tag(), cache.committed_bytes()); });
 }
 
 
@@ -286,6 +297,110 @@ void drcuml_state::log_printf(const char *format, ...)
 }
 
 
+//-------------------------------------------------
+//  profile_find - find or create the counters
+//  for an entry point
+//-------------------------------------------------
+
+drcuml_state::profile_entry *drcuml_state::profile_find(uint32_t mode, uint32_t pc)
+{
+	auto found = m_profile.emplace(uint64_t(mode) << 32 | pc, profile_entry{ this, mode, pc, 0, 0, 0 });
+	return &found.first->second;
+}
+
+
+//-------------------------------------------------
+//  profile_enter - called from generated code
+//  each time an entry point is reached; charges
+//  the time since the previous entry to it
+//-------------------------------------------------
+
+void drcuml_state::profile_enter(void *param)
+{
+	profile_entry &entry = *reinterpret_cast<profile_entry *>(param);
+	drcuml_state &drcuml = *entry.owner;
+	int64_t now = get_profile_ticks();
+
+	if (drcuml.m_profile_current != nullptr)
+		drcuml.m_profile_current->ticks += now - drcuml.m_profile_start;
+	drcuml.m_profile_current = &entry;
+	drcuml.m_profile_start = now;
+	entry.count++;
+}
+
+
+//-------------------------------------------------
+//  profile_stop - stop timing when generated
+//  code returns to the core
+//-------------------------------------------------
+
+void drcuml_state::profile_stop()
+{
+	if (m_profile_current != nullptr)
+		m_profile_current->ticks += get_profile_ticks() - m_profile_start;
+	m_profile_current = nullptr;
+}
+
+
+//-------------------------------------------------
+//  profile_report - write the collected counters
+//  sorted by host time, with a disassembly of
+//  the first instruction of each entry point
+//-------------------------------------------------
+
+void drcuml_state::profile_report()
+{
+	std::string filename = std::string("drcprof_").append(m_device.shortname()).append(".txt");
+	FILE *report = fopen(filename.c_str(), "w");
+	if (report == nullptr)
+		return;
+
+	// sort by host time, most expensive first
+	std::vector<const profile_entry *> sorted;
+	uint64_t totalticks = 0;
+	sorted.reserve(m_profile.size());
+	for (auto &elem : m_profile)
+	{
+		sorted.push_back(&elem.second);
+		totalticks += elem.second.ticks;
+	}
+	std::sort(sorted.begin(), sorted.end(), [] (const profile_entry *a, const profile_entry *b) { return a->ticks > b->ticks; });
+
+	device_disasm_interface *dasm;
+	device_memory_interface *memory;
+	bool candisasm = m_device.interface(dasm) && m_device.interface(memory) && memory->has_space(AS_PROGRAM);
+
+	fprintf(report, "%-4s %-8s %12s %16s %7s %8s  %s\n", "mode", "pc", "count", "ticks", "time%", "compiles", "disassembly");
+	for (const profile_entry *entry : sorted)
+	{
+		std::string text;
+		if (candisasm)
+		{
+			address_space &space = memory->space(AS_PROGRAM);
+			offs_t pcbyte = space.address_to_byte(entry->pc) & space.bytemask();
+			if (memory->translate(AS_PROGRAM, TRANSLATE_FETCH_DEBUG, pcbyte))
+			{
+				u8 opbuf[64];
+				u32 numbytes = std::min<u32>(dasm->max_opcode_bytes(), ARRAY_LENGTH(opbuf));
+				for (u32 index = 0; index < numbytes; index++)
+					opbuf[index] = space.direct().read_byte(pcbyte + index);
+
+				std::ostringstream stream;
+				dasm->disassemble(stream, entry->pc, opbuf, opbuf);
+				text = stream.str();
+			}
+		}
+
+		fprintf(report, "%4X %08X %12llu %16llu %6.2f%% %8u  %s\n",
+				entry->mode, entry->pc,
+				(unsigned long long)entry->count, (unsigned long long)entry->ticks,
+				(totalticks != 0) ? 100.0 * double(entry->ticks) / double(totalticks) : 0.0,
+				entry->compiles, text.c_str());
+	}
+	fclose(report);
+}
+
+
 
 //**************************************************************************
 //  DRCUML BLOCK
@@ -329,15 +444,20 @@ void drcuml_block::begin()
 
 //-------------------------------------------------
 //  end - complete a code block and commit it to
-//  the cache via the back-end
+//  the cache via the back-end; aggressive blocks
+//  get the more expensive optimizations as well
 //-------------------------------------------------
 
-void drcuml_block::end()
+void drcuml_block::end(bool aggressive)
 {
 	assert(m_inuse);
 
+	// add block profiling calls if requested
+	if (m_drcuml.profiling())
+		instrument_profile();
+
 	// optimize the resulting code first
-	optimize();
+	optimize(aggressive);
 
 	// if we have a logfile, generate a disassembly of the block
 	if (m_drcuml.logging())
@@ -382,14 +502,37 @@ uml::instruction &drcuml_block::append()
 }
 
 
+//-------------------------------------------------
+//  instrument_profile - insert a call to the
+//  profiler after each hash entry point
+//-------------------------------------------------
+
+void drcuml_block::instrument_profile()
+{
+	for (uint32_t instnum = 0; instnum < m_nextinst; instnum++)
+		if (m_inst[instnum].opcode() == OP_HASH)
+		{
+			drcuml_state::profile_entry *entry = m_drcuml.profile_find(m_inst[instnum].param(0).immediate(), m_inst[instnum].param(1).immediate());
+			entry->compiles++;
+
+			instruction call;
+			call.callc(&drcuml_state::profile_enter, entry);
+			m_inst.insert(m_inst.begin() + ++instnum, call);
+			m_nextinst++;
+		}
+}
+
+
 //-------------------------------------------------
 //  optimize - apply various optimizations to a
 //  block of code
 //-------------------------------------------------
 
-void drcuml_block::optimize()
+void drcuml_block::optimize(bool aggressive)
 {
 	uint32_t mapvar[MAPVAR_COUNT] = { 0 };
+	uint64_t ivalue[REG_I_COUNT] = { 0 };
+	uint8_t isize[REG_I_COUNT] = { 0 };
 
 	// iterate over instructions
 	for (int instnum = 0; instnum < m_nextinst; instnum++)
@@ -423,8 +566,73 @@ void drcuml_block::optimize()
 				if (inst.param(pnum).is_mapvar())
 					inst.set_mapvar(pnum, mapvar[inst.param(pnum).mapvar() - MAPVAR_M0]);
 
+		// hot blocks also get register constants propagated forward through simple
+		// integer operations, so that simplify() can fold them away
+		bool simple = aggressive && propagates_constants(inst.opcode());
+		if (simple)
+			for (int regnum = 0; regnum < REG_I_COUNT; regnum++)
+				if (isize[regnum] != 0 && isize[regnum] >= inst.size())
+					inst.propagate_ireg(REG_I0 + regnum, ivalue[regnum]);
+
 		// now that flags are correct, simplify the instruction
 		inst.simplify();
+
+		// update what we know about register contents; anything that might be reached
+		// from elsewhere or might call out to other code forgets everything
+		if (!aggressive || inst.opcode() == OP_COMMENT || inst.opcode() == OP_MAPVAR || inst.opcode() == OP_NOP)
+			continue;
+		if (!simple)
+			memset(isize, 0, sizeof(isize));
+		else
+		{
+			uint32_t written = inst.output_iregs();
+			for (int regnum = 0; regnum < REG_I_COUNT; regnum++)
+				if (written & (1 << regnum))
+					isize[regnum] = 0;
+			if (inst.opcode() == OP_MOV && inst.condition() == COND_ALWAYS && inst.param(0).is_int_register() && inst.param(1).is_immediate())
+			{
+				ivalue[inst.param(0).ireg() - REG_I0] = inst.param(1).immediate();
+				isize[inst.param(0).ireg() - REG_I0] = inst.size();
+			}
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  propagates_constants - return true if constant
+//  register inputs can be substituted into an
+//  opcode without changing its behavior
+//-------------------------------------------------
+
+bool drcuml_block::propagates_constants(opcode_t opcode)
+{
+	switch (opcode)
+	{
+		case OP_MOV:
+		case OP_SEXT:
+		case OP_ROLAND:
+		case OP_ROLINS:
+		case OP_ADD:
+		case OP_SUB:
+		case OP_CMP:
+		case OP_MULU:
+		case OP_MULS:
+		case OP_AND:
+		case OP_TEST:
+		case OP_OR:
+		case OP_XOR:
+		case OP_LZCNT:
+		case OP_BSWAP:
+		case OP_SHL:
+		case OP_SHR:
+		case OP_SAR:
+		case OP_ROL:
+		case OP_ROR:
+			return true;
+
+		default:
+			return false;
 	}
 }
 
@@ -16,6 +16,8 @@
 #include "drccache.h"
 #include "uml.h"
 
+#include <unordered_map>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -93,7 +95,7 @@ public:
 
 	// code generation
 	void begin();
-	void end();
+	void end(bool aggressive = false);
 	void abort();
 
 	// instruction appending
@@ -109,7 +111,9 @@ public:
 
 private:
 	// internal helpers
-	void optimize();
+	void optimize(bool aggressive);
+	static bool propagates_constants(uml::opcode_t opcode);
+	void instrument_profile();
 	void disassemble();
 	const char *get_comment_text(const uml::instruction &inst, std::string &comment);
 
@@ -136,6 +140,7 @@ public:
 	virtual int execute(uml::code_handle &entry) = 0;
 	virtual void generate(drcuml_block &block, const uml::instruction *instlist, uint32_t numinst) = 0;
 	virtual bool hash_exists(uint32_t mode, uint32_t pc) = 0;
+	virtual void hash_invalidate(uint32_t mode, uint32_t pc) = 0;
 	virtual void get_info(drcbe_info &info) = 0;
 	virtual bool logging() const { return false; }
 
@@ -153,6 +158,8 @@ protected:
 // structure describing UML generation state
 class drcuml_state
 {
+	friend class drcuml_block;
+
 public:
 	// construction/destruction
 	drcuml_state(device_t &device, drc_cache &cache, uint32_t flags, int modes, int addrbits, int ignorebits);
@@ -164,7 +171,7 @@ public:
 
 	// reset the state
 	void reset();
-	int execute(uml::code_handle &entry) { return m_beintf.execute(entry); }
+	int execute(uml::code_handle &entry) { int result = m_beintf.execute(entry); if (m_profiling) profile_stop(); return result; }
 
 	// code generation
 	drcuml_block *begin_block(uint32_t maxinst);
@@ -172,6 +179,7 @@ public:
 	// back-end interface
 	void get_backend_info(drcbe_info &info) { m_beintf.get_info(info); }
 	bool hash_exists(uint32_t mode, uint32_t pc) { return m_beintf.hash_exists(mode, pc); }
+	void hash_invalidate(uint32_t mode, uint32_t pc) { m_beintf.hash_invalidate(mode, pc); }
 	void generate(drcuml_block &block, uml::instruction *instructions, uint32_t count) { m_beintf.generate(block, instructions, count); }
 
 	// handle management
@@ -187,7 +195,27 @@ public:
 	void log_flush() { if (logging()) fflush(m_umllog); }
 	bool logging_native() const { return m_beintf.logging(); }
 
+	// profiling
+	bool profiling() const { return m_profiling; }
+
 private:
+	// per-entry point profiling counters
+	struct profile_entry
+	{
+		drcuml_state *          owner;              // state that owns this entry
+		uint32_t                  mode;               // mode of the entry point
+		uint32_t                  pc;                 // guest PC of the entry point
+		uint64_t                  count;              // number of times entered
+		uint64_t                  ticks;              // host ticks spent until the next entry
+		uint32_t                  compiles;           // number of times compiled
+	};
+
+	// profiling helpers
+	profile_entry *profile_find(uint32_t mode, uint32_t pc);
+	static void profile_enter(void *param);
+	void profile_stop();
+	void profile_report();
+
 	// symbol class
 	class symbol
 	{
@@ -222,6 +250,12 @@ private:
 	simple_list<drcuml_block>   m_blocklist;        // list of active blocks
 	simple_list<uml::code_handle> m_handlelist;     // list of active handles
 	simple_list<symbol>         m_symlist;          // list of symbols
+
+	// profiling state
+	bool                        m_profiling;        // are we profiling blocks?
+	std::unordered_map<uint64_t, profile_entry> m_profile; // counters for each entry point
+	profile_entry *             m_profile_current;  // entry point currently being timed
+	int64_t                     m_profile_start;    // tick count when it was entered
 };
 
 
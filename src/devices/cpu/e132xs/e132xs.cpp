@@ -227,6 +227,14 @@
 #define SETCARRYS 0
 #define MISSIONCRAFT_FLAGS 1
 
+/* size of the execution code cache */
+#define CACHE_SIZE                      (32 * 1024 * 1024)
+
+/* compilation boundaries -- how far back/forward does the analysis extend? */
+#define COMPILE_BACKWARDS_BYTES         128
+#define COMPILE_FORWARDS_BYTES          512
+#define COMPILE_MAX_SEQUENCE            64
+
 /* Registers */
 
 /* Internal registers */
@@ -297,7 +305,15 @@ hyperstone_device::hyperstone_device(const machine_config &mconfig, const char *
 	: cpu_device(mconfig, type, name, tag, owner, clock, shortname, source),
 		m_program_config("program", ENDIANNESS_BIG, prg_data_width, 32, 0, internal_map),
 		m_io_config("io", ENDIANNESS_BIG, io_data_width, 15),
-		m_icount(0)
+		m_icount(0),
+		m_enable_drc(false),
+		m_isdrc(false),
+		m_cache(CACHE_SIZE),
+		m_drcuml(nullptr),
+		m_drcfe(nullptr),
+		m_cache_dirty(true),
+		m_entry(nullptr),
+		m_nocode(nullptr)
 {
 	// build the opcode table
 	for (int op = 0; op < 256; op++)
@@ -831,7 +847,7 @@ void hyperstone_device::set_global_register(uint8_t code, uint32_t val)
 
 #define LOCAL  1
 
-static const int32_t immediate_values[32] =
+const int32_t hyperstone_device::s_immediate_values[32] =
 {
 	0, 1, 2, 3, 4, 5, 6, 7,
 	8, 9, 10, 11, 12, 13, 14, 15,
@@ -992,12 +1008,12 @@ do
 do                                                                                  \
 {                                                                                   \
 	if (!nbit)                                                                      \
-		EXTRA_U = immediate_values[OP & 0x0f];                                      \
+		EXTRA_U = s_immediate_values[OP & 0x0f];                                      \
 	else                                                                            \
 		switch( OP & 0x0f )                                                         \
 		{                                                                           \
 			default:                                                                \
-				EXTRA_U = immediate_values[0x10 + (OP & 0x0f)];                     \
+				EXTRA_U = s_immediate_values[0x10 + (OP & 0x0f)];                     \
 				break;                                                              \
 																					\
 			case 1:                                                                 \
@@ -1699,6 +1715,27 @@ void hyperstone_device::init(int scale_mask)
 
 	// set our instruction counter
 	m_icountptr = &m_icount;
+
+	m_isdrc = m_enable_drc && allow_drc();
+	if (m_isdrc)
+	{
+		/* initialize the UML generator */
+		m_drcuml = std::make_unique<drcuml_state>(*this, m_cache, 0, 1, 32, 1);
+
+		/* add symbols for our stuff */
+		m_drcuml->symbol_add(&m_global_regs[PC_REGISTER], sizeof(m_global_regs[PC_REGISTER]), "pc");
+		m_drcuml->symbol_add(&m_global_regs[SR_REGISTER], sizeof(m_global_regs[SR_REGISTER]), "sr");
+		m_drcuml->symbol_add(&m_icount, sizeof(m_icount), "icount");
+		m_drcuml->symbol_add(&m_delay.delay_cmd, sizeof(m_delay.delay_cmd), "delay_cmd");
+		m_drcuml->symbol_add(&m_intblock, sizeof(m_intblock), "intblock");
+
+		/* initialize the front-end helper */
+		m_drcfe = std::make_unique<e132xs_frontend>(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, COMPILE_MAX_SEQUENCE);
+		m_warmcache = std::make_unique<drc_warm_cache>(*m_drcfe, *this);
+
+		/* mark the cache dirty so it is updated on next execute */
+		m_cache_dirty = true;
+	}
 }
 
 void e116t_device::device_start()
@@ -1816,6 +1853,8 @@ void hyperstone_device::device_reset()
 	SET_L_REG(1, SR);
 
 	m_icount -= m_clock_cycles_2;
+
+	m_cache_dirty = true;
 }
 
 void hyperstone_device::device_stop()
@@ -4927,6 +4966,12 @@ void hyperstone_device::execute_set_input(int inputnum, int state)
 
 void hyperstone_device::execute_run()
 {
+	if (m_isdrc)
+	{
+		execute_run_drc();
+		return;
+	}
+
 	if (m_intblock < 0)
 		m_intblock = 0;
 
@@ -4934,34 +4979,48 @@ void hyperstone_device::execute_run()
 
 	do
 	{
-		uint32_t oldh = SR & 0x00000020;
-
-		PPC = PC;   /* copy PC to previous PC */
 		debugger_instruction_hook(this, PC);
 
-		OP = READ_OP(PC);
-		PC += 2;
+		execute_one();
 
-		m_instruction_length = 1;
+	} while( m_icount > 0 );
+}
 
-		/* execute opcode */
-		(this->*m_opcode[(OP & 0xff00) >> 8])();
 
-		/* clear the H state if it was previously set */
-		SR ^= oldh;
+//-------------------------------------------------
+//  execute_one - execute the instruction at PC,
+//  including trace and interrupt checks; the
+//  recompiler falls back to this for anything it
+//  does not generate itself
+//-------------------------------------------------
 
-		SET_ILC(m_instruction_length & 3);
+void hyperstone_device::execute_one()
+{
+	uint32_t oldh = SR & 0x00000020;
 
-		if( GET_T && GET_P && m_delay.delay_cmd == NO_DELAY ) /* Not in a Delayed Branch instructions */
-		{
-			uint32_t addr = get_trap_addr(TRAPNO_TRACE_EXCEPTION);
-			execute_exception(addr);
-		}
+	PPC = PC;   /* copy PC to previous PC */
 
-		if (--m_intblock == 0)
-			check_interrupts();
+	OP = READ_OP(PC);
+	PC += 2;
 
-	} while( m_icount > 0 );
+	m_instruction_length = 1;
+
+	/* execute opcode */
+	(this->*m_opcode[(OP & 0xff00) >> 8])();
+
+	/* clear the H state if it was previously set */
+	SR ^= oldh;
+
+	SET_ILC(m_instruction_length & 3);
+
+	if( GET_T && GET_P && m_delay.delay_cmd == NO_DELAY ) /* Not in a Delayed Branch instructions */
+	{
+		uint32_t addr = get_trap_addr(TRAPNO_TRACE_EXCEPTION);
+		execute_exception(addr);
+	}
+
+	if (--m_intblock == 0)
+		check_interrupts();
 }
 
 const device_type E116T = &device_creator<e116t_device>;
@@ -5,6 +5,8 @@
 #ifndef __E132XS_H__
 #define __E132XS_H__
 
+#include "cpu/drcfe.h"
+#include "cpu/drcuml.h"
 
 /*
     A note about clock multipliers and dividers:
@@ -201,20 +203,37 @@ extern unsigned dasm_hyperstone(std::ostream &stream, unsigned pc, const uint8_t
 
 #define READ_OP(addr)          m_direct->read_word((addr), m_opcodexor)
 
+
+//**************************************************************************
+//  INTERFACE CONFIGURATION MACROS
+//**************************************************************************
+
+// the recompiler hasn't been run against real software yet, so it is only
+// used by systems that ask for it (and then only when -drc allows it)
+#define MCFG_HYPERSTONE_ENABLE_DRC() \
+	hyperstone_device::static_set_enable_drc(*device, true);
+
 //**************************************************************************
 //  TYPE DEFINITIONS
 //**************************************************************************
 
 // ======================> hyperstone_device
 
+class e132xs_frontend;
+
 // Used by core CPU interface
 class hyperstone_device : public cpu_device
 {
+	friend class e132xs_frontend;
+
 public:
 	// construction/destruction
 	hyperstone_device(const machine_config &mconfig, const char *name, const char *tag, device_t *owner, uint32_t clock,
 						const device_type type, uint32_t prg_data_width, uint32_t io_data_width, address_map_constructor internal_map, const char *shortname, const char *source);
 
+	// static configuration helpers
+	static void static_set_enable_drc(device_t &device, bool enable) { downcast<hyperstone_device &>(device).m_enable_drc = enable; }
+
 	// public interfaces
 
 protected:
@@ -294,6 +313,10 @@ protected:
 	ophandler m_opcode[256];
 
 	static const ophandler s_opcodetable[256];
+	static const int32_t s_immediate_values[32];
+
+	// core execution
+	void execute_one();
 
 private:
 	struct regs_decode
@@ -460,6 +483,45 @@ private:
 
 	void reserved(struct regs_decode *decode);
 
+	/* internal compiler state */
+	struct compiler_state
+	{
+		uml::code_label  labelnum;                   /* index for local labels */
+		bool             fp_loaded;                  /* I3 holds the frame pointer */
+		bool             check_delay;                /* a delayed branch may be pending */
+	};
+
+	bool                m_enable_drc;                /* configured to use the recompiler */
+	bool                m_isdrc;                     /* using the recompiler */
+	drc_cache           m_cache;                     /* pointer to the DRC code cache */
+	std::unique_ptr<drcuml_state>      m_drcuml;     /* DRC UML generator state */
+	std::unique_ptr<e132xs_frontend>   m_drcfe;      /* pointer to the DRC front-end state */
+	std::unique_ptr<drc_warm_cache>    m_warmcache;  /* blocks remembered from previous runs */
+	uint8_t             m_cache_dirty;               /* true if we need to flush the cache */
+
+	uml::code_handle *  m_entry;                     /* entry point */
+	uml::code_handle *  m_nocode;                    /* nocode */
+
+	inline void alloc_handle(drcuml_state *drcuml, uml::code_handle **handleptr, const char *name);
+
+	void code_flush_cache();
+	void execute_run_drc();
+	void code_compile_block(uint8_t mode, offs_t pc);
+	void static_generate_entry_point();
+	void static_generate_nocode_handler();
+	void generate_checksum_block(drcuml_block *block, compiler_state *compiler, const opcode_desc *seqhead, const opcode_desc *seqlast);
+	void generate_sequence_instruction(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+	void generate_interpreted(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+	void generate_epilogue(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, uml::parameter srreg);
+	void generate_local_address(drcuml_block *block, compiler_state *compiler, uml::parameter dst, uint8_t code);
+	bool generate_opcode(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc);
+
+public:
+	void func_execute_one();
+	void func_trace_exception();
+	void func_check_interrupts();
+
+private:
 	void op00();    void op01();    void op02();    void op03();    void op04();    void op05();    void op06();    void op07();
 	void op08();    void op09();    void op0a();    void op0b();    void op0c();    void op0d();    void op0e();    void op0f();
 	void op10();    void op11();    void op12();    void op13();    void op14();    void op15();    void op16();    void op17();
@@ -494,6 +556,21 @@ private:
 	void opf8();    void opf9();    void opfa();    void opfb();    void opfc();    void opfd();    void opfe();    void opff();
 };
 
+class e132xs_frontend : public drc_frontend
+{
+public:
+	e132xs_frontend(hyperstone_device *device, uint32_t window_start, uint32_t window_end, uint32_t max_sequence);
+
+protected:
+	virtual bool describe(opcode_desc &desc, const opcode_desc *prev) override;
+
+private:
+	uint16_t read_word(opcode_desc &desc);
+	void describe_extension(opcode_desc &desc, uint16_t ext);
+
+	hyperstone_device *m_cpu;
+};
+
 // device type definition
 extern const device_type E116T;
 extern const device_type E116XT;
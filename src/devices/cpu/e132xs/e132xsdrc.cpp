@@ -0,0 +1,650 @@
+// license:BSD-3-Clause
+// copyright-holders:Pierpaolo Prazzoli
+/***************************************************************************
+
+    e132xsdrc.cpp
+    Universal machine language-based Hyperstone emulator.
+
+    Simple register-window ALU instructions are translated directly;
+    everything else, including all delay slot and exception handling,
+    calls back into the interpreter one instruction at a time. Control
+    leaves a block whenever the interpreter moved PC somewhere other than
+    the next instruction.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "debugger.h"
+#include "e132xs.h"
+#include "cpu/drcumlsh.h"
+
+using namespace uml;
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+/* exit codes */
+#define EXECUTE_OUT_OF_CYCLES           0
+#define EXECUTE_MISSING_CODE            1
+#define EXECUTE_UNMAPPED_CODE           2
+#define EXECUTE_RESET_CACHE             3
+
+/* status register bits updated by the translated instructions */
+#define SR_C                            0x00000001
+#define SR_Z                            0x00000002
+#define SR_N                            0x00000004
+#define SR_V                            0x00000008
+#define SR_H                            0x00000020
+#define SR_TP                           0x00030000
+#define SR_ILC                          0x00180000
+
+
+/***************************************************************************
+    MACROS
+***************************************************************************/
+
+#define PC_MEM          mem(&m_global_regs[PC_REGISTER])
+#define SR_MEM          mem(&m_global_regs[SR_REGISTER])
+
+
+/***************************************************************************
+    INLINE FUNCTIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    alloc_handle - allocate a handle if not
+    already allocated
+-------------------------------------------------*/
+
+inline void hyperstone_device::alloc_handle(drcuml_state *drcuml, code_handle **handleptr, const char *name)
+{
+	if (*handleptr == nullptr)
+		*handleptr = drcuml->handle_alloc(name);
+}
+
+/*-------------------------------------------------
+    cfunc_execute_one - run one instruction in
+    the interpreter
+-------------------------------------------------*/
+
+static void cfunc_execute_one(void *param)
+{
+	((hyperstone_device *)param)->func_execute_one();
+}
+
+void hyperstone_device::func_execute_one()
+{
+	execute_one();
+}
+
+/*-------------------------------------------------
+    cfunc_trace_exception - take a pending trace
+    exception after a translated instruction
+-------------------------------------------------*/
+
+static void cfunc_trace_exception(void *param)
+{
+	((hyperstone_device *)param)->func_trace_exception();
+}
+
+void hyperstone_device::func_trace_exception()
+{
+	execute_exception(get_trap_addr(TRAPNO_TRACE_EXCEPTION));
+
+	if (--m_intblock == 0)
+		check_interrupts();
+}
+
+/*-------------------------------------------------
+    cfunc_check_interrupts - check for interrupts
+    once the interrupt block expires
+-------------------------------------------------*/
+
+static void cfunc_check_interrupts(void *param)
+{
+	((hyperstone_device *)param)->func_check_interrupts();
+}
+
+void hyperstone_device::func_check_interrupts()
+{
+	check_interrupts();
+}
+
+
+/***************************************************************************
+    CORE EXECUTION
+***************************************************************************/
+
+/*-------------------------------------------------
+    code_flush_cache - flush the cache and
+    regenerate static code
+-------------------------------------------------*/
+
+void hyperstone_device::code_flush_cache()
+{
+	/* empty the transient cache contents */
+	m_drcuml->reset();
+
+	try
+	{
+		/* generate the entry point and nocode handlers */
+		static_generate_nocode_handler();
+		static_generate_entry_point();
+	}
+	catch (drcuml_block::abort_compilation &)
+	{
+		fatalerror("Unable to generate Hyperstone static code\n");
+	}
+
+	m_cache_dirty = false;
+}
+
+/*-------------------------------------------------
+    execute_run_drc - execute a timeslice's worth
+    of opcodes through the recompiler
+-------------------------------------------------*/
+
+void hyperstone_device::execute_run_drc()
+{
+	drcuml_state *drcuml = m_drcuml.get();
+	int execute_result;
+
+	if (m_intblock < 0)
+		m_intblock = 0;
+
+	check_interrupts();
+
+	/* reset the cache if dirty */
+	if (m_cache_dirty)
+		code_flush_cache();
+
+	/* execute */
+	do
+	{
+		/* run as much as we can */
+		execute_result = drcuml->execute(*m_entry);
+
+		/* if we need to recompile, do it */
+		if (execute_result == EXECUTE_MISSING_CODE)
+		{
+			code_compile_block(0, m_global_regs[PC_REGISTER]);
+
+			/* also compile any blocks remembered from previous runs that are ready */
+			const uint32_t warmmode = 0;
+			offs_t warmpc;
+			while (m_warmcache->next_block(warmmode, warmpc))
+				if (!drcuml->hash_exists(warmmode, warmpc))
+					code_compile_block(warmmode, warmpc);
+		}
+		else if (execute_result == EXECUTE_UNMAPPED_CODE)
+		{
+			fatalerror("Attempted to execute unmapped code at PC=%08X\n", m_global_regs[PC_REGISTER]);
+		}
+		else if (execute_result == EXECUTE_RESET_CACHE)
+		{
+			code_flush_cache();
+		}
+	} while (execute_result != EXECUTE_OUT_OF_CYCLES);
+}
+
+/*-------------------------------------------------
+    code_compile_block - compile a block of the
+    given mode at the specified pc
+-------------------------------------------------*/
+
+void hyperstone_device::code_compile_block(uint8_t mode, offs_t pc)
+{
+	drcuml_state *drcuml = m_drcuml.get();
+	const opcode_desc *seqhead, *seqlast;
+	const opcode_desc *desclist;
+	bool override = false;
+	drcuml_block *block;
+
+	g_profiler.start(PROFILER_DRC_COMPILE);
+
+	/* get a description of this sequence */
+	desclist = m_drcfe->describe_code(pc);
+
+	bool succeeded = false;
+	while (!succeeded)
+	{
+		try
+		{
+			compiler_state compiler = { 0 };
+
+			/* start the block */
+			block = drcuml->begin_block(4096);
+
+			/* loop until we get through all instruction sequences */
+			for (seqhead = desclist; seqhead != nullptr; seqhead = seqlast->next())
+			{
+				const opcode_desc *curdesc;
+				uint32_t nextpc;
+
+				/* determine the last instruction in this sequence */
+				for (seqlast = seqhead; seqlast != nullptr; seqlast = seqlast->next())
+					if (seqlast->flags & OPFLAG_END_SEQUENCE)
+						break;
+				assert(seqlast != nullptr);
+
+				/* if we don't have a hash for this mode/pc, or if we are overriding all, add one */
+				if (override || !drcuml->hash_exists(mode, seqhead->pc))
+					UML_HASH(block, mode, seqhead->pc);                                     // hash    mode,pc
+
+				/* if we already have a hash, and this is the first sequence, assume that we */
+				/* are recompiling due to being out of sync and allow future overrides */
+				else if (seqhead == desclist)
+				{
+					override = true;
+					UML_HASH(block, mode, seqhead->pc);                                     // hash    mode,pc
+				}
+
+				/* otherwise, redispatch to that fixed PC and skip the rest of the processing */
+				else
+				{
+					UML_HASHJMP(block, 0, seqhead->pc, *m_nocode);                          // hashjmp <mode>,seqhead->pc,nocode
+					continue;
+				}
+
+				/* sequences are entered by hash jump, possibly with a delayed branch pending */
+				compiler.fp_loaded = false;
+				compiler.check_delay = true;
+
+				/* validate this code block if we're not pointing into ROM */
+				if (m_program->get_write_ptr(seqhead->physpc) != nullptr)
+					generate_checksum_block(block, &compiler, seqhead, seqlast);
+
+				/* iterate over instructions in the sequence and compile them */
+				for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+					generate_sequence_instruction(block, &compiler, curdesc);
+
+				/* go to the next instruction */
+				nextpc = seqlast->pc + seqlast->length;
+				if (seqlast->next() == nullptr || seqlast->next()->pc != nextpc)
+					UML_HASHJMP(block, 0, nextpc, *m_nocode);                               // hashjmp <mode>,nextpc,nocode
+			}
+
+			/* end the sequence */
+			block->end();
+			m_warmcache->block_compiled(mode, pc, desclist);
+			g_profiler.stop();
+			succeeded = true;
+		}
+		catch (drcuml_block::abort_compilation &)
+		{
+			code_flush_cache();
+		}
+	}
+}
+
+/*-------------------------------------------------
+    static_generate_entry_point - generate a
+    static entry point
+-------------------------------------------------*/
+
+void hyperstone_device::static_generate_entry_point()
+{
+	drcuml_state *drcuml = m_drcuml.get();
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(20);
+
+	/* forward references */
+	alloc_handle(drcuml, &m_nocode, "nocode");
+	alloc_handle(drcuml, &m_entry, "entry");
+	UML_HANDLE(block, *m_entry);                                                        // handle  entry
+
+	/* interrupts were already checked by execute_run_drc; just jump to the code */
+	UML_HASHJMP(block, 0, PC_MEM, *m_nocode);                                           // hashjmp <mode>,<pc>,nocode
+
+	block->end();
+}
+
+/*-------------------------------------------------
+    static_generate_nocode_handler - generate an
+    exception handler for "out of code"
+-------------------------------------------------*/
+
+void hyperstone_device::static_generate_nocode_handler()
+{
+	drcuml_state *drcuml = m_drcuml.get();
+	drcuml_block *block;
+
+	/* begin generating */
+	block = drcuml->begin_block(10);
+
+	/* generate a hash jump via the current mode and PC */
+	alloc_handle(drcuml, &m_nocode, "nocode");
+	UML_HANDLE(block, *m_nocode);                                                       // handle  nocode
+	UML_GETEXP(block, I0);                                                              // getexp  i0
+	UML_MOV(block, PC_MEM, I0);                                                         // mov     [pc],i0
+	UML_EXIT(block, EXECUTE_MISSING_CODE);                                              // exit    EXECUTE_MISSING_CODE
+
+	block->end();
+}
+
+
+/***************************************************************************
+    CODE GENERATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    generate_checksum_block - generate code to
+    validate a sequence of opcodes
+-------------------------------------------------*/
+
+void hyperstone_device::generate_checksum_block(drcuml_block *block, compiler_state *compiler, const opcode_desc *seqhead, const opcode_desc *seqlast)
+{
+	const opcode_desc *curdesc;
+
+	/* compare every halfword, including immediates, against what was compiled */
+	for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
+		if (!(curdesc->flags & OPFLAG_VIRTUAL_NOOP))
+			for (int word = 0; word < curdesc->length / 2; word++)
+			{
+				void *base = m_direct->read_ptr(curdesc->physpc + word * 2, m_opcodexor);
+				if (base == nullptr)
+					continue;
+				UML_LOAD(block, I0, base, 0, SIZE_WORD, SCALE_x2);                      // load    i0,base,word
+				UML_CMP(block, I0, curdesc->opptr.w[word]);                             // cmp     i0,*opptr
+				UML_EXHc(block, COND_NE, *m_nocode, seqhead->pc);                       // exne    nocode,seqhead->pc
+			}
+}
+
+/*-------------------------------------------------
+    generate_sequence_instruction - generate code
+    for a single instruction in a sequence
+-------------------------------------------------*/
+
+void hyperstone_device::generate_sequence_instruction(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	/* if we are debugging, call the debugger */
+	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) != 0)
+	{
+		UML_MOV(block, PC_MEM, desc->pc);                                               // mov     [pc],desc->pc
+		UML_DEBUG(block, desc->pc);                                                     // debug   desc->pc
+	}
+
+	/* if we hit an unmapped address, fatal error */
+	if (desc->flags & OPFLAG_COMPILER_UNMAPPED)
+	{
+		UML_MOV(block, PC_MEM, desc->pc);                                               // mov     [pc],desc->pc
+		UML_EXIT(block, EXECUTE_UNMAPPED_CODE);                                         // exit    EXECUTE_UNMAPPED_CODE
+	}
+
+	/* otherwise, unless this is a virtual no-op, it's a regular instruction */
+	else if (!(desc->flags & OPFLAG_VIRTUAL_NOOP))
+	{
+		if (!generate_opcode(block, compiler, desc))
+			generate_interpreted(block, compiler, desc);
+	}
+}
+
+/*-------------------------------------------------
+    generate_interpreted - generate a call into
+    the interpreter for one instruction
+-------------------------------------------------*/
+
+void hyperstone_device::generate_interpreted(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	code_label cycles = compiler->labelnum++;
+	code_label skip = compiler->labelnum++;
+
+	UML_CALLC(block, cfunc_execute_one, this);                                          // callc   execute_one,this
+
+	/* stop when out of cycles, and follow the interpreter if it went elsewhere */
+	UML_CMP(block, mem(&m_icount), 0);                                                  // cmp     [icount],0
+	UML_JMPc(block, COND_G, cycles);                                                    // jg      cycles
+	UML_EXIT(block, EXECUTE_OUT_OF_CYCLES);                                             // exit    EXECUTE_OUT_OF_CYCLES
+	UML_LABEL(block, cycles);                                                           // cycles:
+	UML_CMP(block, PC_MEM, desc->pc + desc->length);                                    // cmp     [pc],nextpc
+	UML_JMPc(block, COND_E, skip);                                                      // je      skip
+	UML_HASHJMP(block, 0, PC_MEM, *m_nocode);                                           // hashjmp <mode>,[pc],nocode
+	UML_LABEL(block, skip);                                                             // skip:
+
+	/* the instruction may have moved the register window or left a delayed branch pending */
+	compiler->fp_loaded = false;
+	compiler->check_delay = true;
+}
+
+/*-------------------------------------------------
+    generate_epilogue - store the status register
+    held in srreg and do the per-instruction
+    bookkeeping of the interpreter loop
+-------------------------------------------------*/
+
+void hyperstone_device::generate_epilogue(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, uml::parameter srreg)
+{
+	code_label notrace = compiler->labelnum++;
+	code_label redispatch = compiler->labelnum++;
+	code_label done = compiler->labelnum++;
+	code_label cycles = compiler->labelnum++;
+	code_label next = compiler->labelnum++;
+
+	/* clear H, which none of the translated instructions set, and record the length */
+	UML_AND(block, srreg, srreg, ~(SR_H | SR_ILC));                                     // and     sr,sr,~(H|ILC)
+	UML_OR(block, SR_MEM, srreg, ((desc->length / 2) & 3) << 19);                       // or      [sr],sr,ilc
+
+	UML_LOAD(block, I1, &m_clock_cycles_1, 0, SIZE_BYTE, SCALE_x1);                     // load    i1,clock_cycles_1,byte
+	UML_SUB(block, mem(&m_icount), mem(&m_icount), I1);                                 // sub     [icount],[icount],i1
+
+	/* trace exception */
+	UML_AND(block, I1, srreg, SR_TP);                                                   // and     i1,sr,T|P
+	UML_CMP(block, I1, SR_TP);                                                          // cmp     i1,T|P
+	UML_JMPc(block, COND_NE, notrace);                                                  // jne     notrace
+	UML_CALLC(block, cfunc_trace_exception, this);                                      // callc   trace_exception,this
+	UML_JMP(block, redispatch);                                                         // jmp     redispatch
+	UML_LABEL(block, notrace);                                                          // notrace:
+
+	/* interrupts are checked when the interrupt block runs out */
+	UML_SUB(block, mem(&m_intblock), mem(&m_intblock), 1);                              // sub     [intblock],[intblock],1
+	UML_JMPc(block, COND_NZ, done);                                                     // jnz     done
+	UML_CALLC(block, cfunc_check_interrupts, this);                                     // callc   check_interrupts,this
+
+	UML_LABEL(block, redispatch);                                                       // redispatch:
+	UML_CMP(block, mem(&m_icount), 0);                                                  // cmp     [icount],0
+	UML_JMPc(block, COND_LE, cycles);                                                   // jle     cycles
+	UML_HASHJMP(block, 0, PC_MEM, *m_nocode);                                           // hashjmp <mode>,[pc],nocode
+
+	UML_LABEL(block, done);                                                             // done:
+	UML_CMP(block, mem(&m_icount), 0);                                                  // cmp     [icount],0
+	UML_JMPc(block, COND_G, next);                                                      // jg      next
+	UML_LABEL(block, cycles);                                                           // cycles:
+	UML_EXIT(block, EXECUTE_OUT_OF_CYCLES);                                             // exit    EXECUTE_OUT_OF_CYCLES
+	UML_LABEL(block, next);                                                             // next:
+}
+
+/*-------------------------------------------------
+    generate_local_address - compute the index of
+    a local register in the current window; the
+    frame pointer stays in I3 between translated
+    instructions
+-------------------------------------------------*/
+
+void hyperstone_device::generate_local_address(drcuml_block *block, compiler_state *compiler, uml::parameter dst, uint8_t code)
+{
+	if (!compiler->fp_loaded)
+	{
+		UML_ROLAND(block, I3, SR_MEM, 7, 0x7f);                                         // roland  i3,[sr],7,0x7f
+		compiler->fp_loaded = true;
+	}
+	UML_ADD(block, dst, I3, code);                                                      // add     dst,i3,code
+	UML_AND(block, dst, dst, 0x3f);                                                     // and     dst,dst,0x3f
+}
+
+/*-------------------------------------------------
+    generate_opcode - generate code for a
+    specific opcode, or return false to leave it
+    to the interpreter
+-------------------------------------------------*/
+
+bool hyperstone_device::generate_opcode(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
+{
+	uint16_t op = desc->opptr.w[0];
+	uint8_t group = op >> 8;
+	uint8_t dcode = (op & 0xf0) >> 4;
+	uint8_t scode = op & 0x0f;
+	uint32_t imm = desc->userdata0;
+	bool rimm;
+
+	/* only instructions whose operands are all local registers are translated */
+	switch (group)
+	{
+		case 0x23:  // CMP Ld,Ls
+		case 0x27:  // MOV Ld,Ls
+		case 0x2b:  // ADD Ld,Ls
+		case 0x37:  // ANDN Ld,Ls
+		case 0x3b:  // OR Ld,Ls
+		case 0x3f:  // XOR Ld,Ls
+		case 0x4b:  // SUB Ld,Ls
+		case 0x57:  // AND Ld,Ls
+			rimm = false;
+			break;
+
+		case 0x6a:  // ADDI Ld,imm
+			/* n = 0 adds a carry derived from Z and the destination */
+			if ((op & 0x0f) == 0)
+				return false;
+			// fall through
+		case 0x62: case 0x63:   // CMPI Ld,imm
+		case 0x66: case 0x67:   // MOVI Ld,imm
+		case 0x6b:
+		case 0x76: case 0x77:   // ANDNI Ld,imm
+		case 0x7a: case 0x7b:   // ORI Ld,imm
+		case 0x7e: case 0x7f:   // XORI Ld,imm
+			rimm = true;
+			break;
+
+		default:
+			return false;
+	}
+
+	/* a pending delayed branch redirects PC after this instruction; leave that to the interpreter */
+	code_label interp = 0, join = 0;
+	if (compiler->check_delay)
+	{
+		interp = compiler->labelnum++;
+		join = compiler->labelnum++;
+		UML_CMP(block, mem(&m_delay.delay_cmd), NO_DELAY);                              // cmp     [delay_cmd],NO_DELAY
+		UML_JMPc(block, COND_NE, interp);                                               // jne     interp
+	}
+
+	UML_MOV(block, mem(&m_ppc), desc->pc);                                              // mov     [ppc],desc->pc
+	UML_MOV(block, PC_MEM, desc->pc + desc->length);                                    // mov     [pc],nextpc
+
+	/* I4 = destination index, I1 = destination value, I2 = source value */
+	generate_local_address(block, compiler, I4, dcode);
+	if (!rimm)
+	{
+		generate_local_address(block, compiler, I5, scode);
+		UML_LOAD(block, I2, m_local_regs, I5, SIZE_DWORD, SCALE_x4);                    // load    i2,local_regs,i5,dword
+	}
+	if (group != 0x27 && (group & 0xfe) != 0x66)
+		UML_LOAD(block, I1, m_local_regs, I4, SIZE_DWORD, SCALE_x4);                    // load    i1,local_regs,i4,dword
+	UML_MOV(block, I0, SR_MEM);                                                         // mov     i0,[sr]
+
+	/* flags are captured with SETc straight after the operation, then merged into I0 */
+	switch (group)
+	{
+		case 0x23:  // CMP Ld,Ls
+		case 0x62: case 0x63:   // CMPI Ld,imm
+			if (rimm)
+				UML_CMP(block, I1, imm);                                                // cmp     i1,imm
+			else
+				UML_CMP(block, I1, I2);                                                 // cmp     i1,i2
+			UML_SETc(block, COND_C, I5);                                                // setc    i5,c
+			UML_SETc(block, COND_Z, I6);                                                // setc    i6,z
+			UML_SETc(block, COND_L, I7);                                                // setc    i7,l
+			UML_SETc(block, COND_V, I8);                                                // setc    i8,v
+			UML_ROLINS(block, I0, I5, 0, SR_C);                                         // rolins  i0,i5,0,C
+			UML_ROLINS(block, I0, I6, 1, SR_Z);                                         // rolins  i0,i6,1,Z
+			UML_ROLINS(block, I0, I7, 2, SR_N);                                         // rolins  i0,i7,2,N
+			UML_ROLINS(block, I0, I8, 3, SR_V);                                         // rolins  i0,i8,3,V
+			break;
+
+		case 0x27:  // MOV Ld,Ls
+			UML_STORE(block, m_local_regs, I4, I2, SIZE_DWORD, SCALE_x4);               // store   local_regs,i4,i2,dword
+			UML_TEST(block, I2, I2);                                                    // test    i2,i2
+			UML_SETc(block, COND_Z, I6);                                                // setc    i6,z
+			UML_SETc(block, COND_S, I7);                                                // setc    i7,s
+			UML_ROLINS(block, I0, I6, 1, SR_Z);                                         // rolins  i0,i6,1,Z
+			UML_ROLINS(block, I0, I7, 2, SR_N);                                         // rolins  i0,i7,2,N
+			break;
+
+		case 0x66: case 0x67:   // MOVI Ld,imm
+			UML_STORE(block, m_local_regs, I4, imm, SIZE_DWORD, SCALE_x4);              // store   local_regs,i4,imm,dword
+			UML_AND(block, I0, I0, ~(SR_Z | SR_N | SR_V));                              // and     i0,i0,~(Z|N|V)
+			UML_OR(block, I0, I0, (imm == 0 ? SR_Z : 0) | (BIT(imm, 31) ? SR_N : 0));   // or      i0,i0,flags
+			break;
+
+		case 0x2b:  // ADD Ld,Ls
+		case 0x4b:  // SUB Ld,Ls
+		case 0x6a: case 0x6b:   // ADDI Ld,imm
+			if (group == 0x4b)
+				UML_SUB(block, I1, I1, I2);                                             // sub     i1,i1,i2
+			else if (rimm)
+				UML_ADD(block, I1, I1, imm);                                            // add     i1,i1,imm
+			else
+				UML_ADD(block, I1, I1, I2);                                             // add     i1,i1,i2
+			UML_SETc(block, COND_C, I5);                                                // setc    i5,c
+			UML_SETc(block, COND_Z, I6);                                                // setc    i6,z
+			UML_SETc(block, COND_S, I7);                                                // setc    i7,s
+			UML_SETc(block, COND_V, I8);                                                // setc    i8,v
+			UML_STORE(block, m_local_regs, I4, I1, SIZE_DWORD, SCALE_x4);               // store   local_regs,i4,i1,dword
+			UML_ROLINS(block, I0, I5, 0, SR_C);                                         // rolins  i0,i5,0,C
+			UML_ROLINS(block, I0, I6, 1, SR_Z);                                         // rolins  i0,i6,1,Z
+			UML_ROLINS(block, I0, I7, 2, SR_N);                                         // rolins  i0,i7,2,N
+			UML_ROLINS(block, I0, I8, 3, SR_V);                                         // rolins  i0,i8,3,V
+			break;
+
+		default:    // logical operations only update Z
+			switch (group)
+			{
+				case 0x37:  // ANDN Ld,Ls
+					UML_XOR(block, I2, I2, 0xffffffff);                                  // xor     i2,i2,~0
+					UML_AND(block, I1, I1, I2);                                         // and     i1,i1,i2
+					break;
+				case 0x76: case 0x77:   // ANDNI Ld,imm
+					if ((((group & 0x01) << 4) | (op & 0x0f)) == 31)
+						imm = 0x7fffffff;
+					UML_AND(block, I1, I1, ~imm);                                       // and     i1,i1,~imm
+					break;
+				case 0x3b:  // OR Ld,Ls
+					UML_OR(block, I1, I1, I2);                                          // or      i1,i1,i2
+					break;
+				case 0x7a: case 0x7b:   // ORI Ld,imm
+					UML_OR(block, I1, I1, imm);                                         // or      i1,i1,imm
+					break;
+				case 0x3f:  // XOR Ld,Ls
+					UML_XOR(block, I1, I1, I2);                                         // xor     i1,i1,i2
+					break;
+				case 0x7e: case 0x7f:   // XORI Ld,imm
+					UML_XOR(block, I1, I1, imm);                                        // xor     i1,i1,imm
+					break;
+				case 0x57:  // AND Ld,Ls
+					UML_AND(block, I1, I1, I2);                                         // and     i1,i1,i2
+					break;
+			}
+			UML_SETc(block, COND_Z, I6);                                                // setc    i6,z
+			UML_STORE(block, m_local_regs, I4, I1, SIZE_DWORD, SCALE_x4);               // store   local_regs,i4,i1,dword
+			UML_ROLINS(block, I0, I6, 1, SR_Z);                                         // rolins  i0,i6,1,Z
+			break;
+	}
+
+	generate_epilogue(block, compiler, desc, I0);
+
+	if (compiler->check_delay)
+	{
+		UML_JMP(block, join);                                                           // jmp     join
+		UML_LABEL(block, interp);                                                       // interp:
+		generate_interpreted(block, compiler, desc);
+		UML_LABEL(block, join);                                                         // join:
+
+		/* the frame pointer is only known on one of the two paths */
+		compiler->fp_loaded = false;
+	}
+	compiler->check_delay = false;
+	return true;
+}
@@ -0,0 +1,192 @@
+// license:BSD-3-Clause
+// copyright-holders:Pierpaolo Prazzoli
+/***************************************************************************
+
+    e132xsfe.cpp
+
+    Front end for Hyperstone recompiler
+
+***************************************************************************/
+
+#include "emu.h"
+#include "e132xs.h"
+
+
+/***************************************************************************
+    INSTRUCTION PARSERS
+***************************************************************************/
+
+e132xs_frontend::e132xs_frontend(hyperstone_device *device, uint32_t window_start, uint32_t window_end, uint32_t max_sequence)
+	: drc_frontend(*device, window_start, window_end, max_sequence)
+	, m_cpu(device)
+{
+}
+
+/*-------------------------------------------------
+    read_word - fetch the next halfword of the
+    instruction and grow its length
+-------------------------------------------------*/
+
+uint16_t e132xs_frontend::read_word(opcode_desc &desc)
+{
+	uint16_t data = m_cpu->m_direct->read_word(desc.physpc + desc.length, m_cpu->m_opcodexor);
+	desc.opptr.w[desc.length / 2] = data;
+	desc.length += 2;
+	return data;
+}
+
+/*-------------------------------------------------
+    describe_extension - account for the second
+    extension word of the const, dis and lim
+    formats, present when the E bit is set
+-------------------------------------------------*/
+
+void e132xs_frontend::describe_extension(opcode_desc &desc, uint16_t ext)
+{
+	if (E_BIT(ext))
+		read_word(desc);
+}
+
+/*-------------------------------------------------
+    describe - build a description of a single
+    instruction
+-------------------------------------------------*/
+
+bool e132xs_frontend::describe(opcode_desc &desc, const opcode_desc *prev)
+{
+	uint16_t op = desc.opptr.w[0] = m_cpu->m_direct->read_word(desc.physpc, m_cpu->m_opcodexor);
+	uint8_t group = op >> 8;
+	bool dst_is_pc = false;
+
+	/* most instructions are a single halfword; timing is left to the interpreter */
+	desc.length = 2;
+	desc.cycles = 1;
+
+	if (group < 0x10 || (group >= 0x20 && group < 0x60))
+	{
+		/* RR format: bit 1 selects a local destination */
+		dst_is_pc = !(group & 0x02) && ((op & 0xf0) >> 4) == PC_REGISTER;
+
+		/* CHK traps on a range error */
+		if (group < 0x04)
+			desc.flags |= OPFLAG_CAN_CAUSE_EXCEPTION;
+
+		/* MOVD PC,... is RET */
+		if (dst_is_pc && group >= 0x04 && group < 0x08)
+		{
+			desc.targetpc = BRANCH_TARGET_DYNAMIC;
+			desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+			return true;
+		}
+	}
+	else if (group < 0x20)
+	{
+		/* XM (lim format) and MASK/SUM/SUMS (const format) */
+		describe_extension(desc, read_word(desc));
+		dst_is_pc = !(group & 0x02) && ((op & 0xf0) >> 4) == PC_REGISTER;
+	}
+	else if (group < 0x80)
+	{
+		/* Rimm format: decode the immediate now so the compiler can use it */
+		uint32_t imm = hyperstone_device::s_immediate_values[op & 0x0f];
+		if (group & 0x01)
+		{
+			switch (op & 0x0f)
+			{
+				default:
+					imm = hyperstone_device::s_immediate_values[0x10 + (op & 0x0f)];
+					break;
+
+				case 1:
+					imm = read_word(desc) << 16;
+					imm |= read_word(desc);
+					break;
+
+				case 2:
+					imm = read_word(desc);
+					break;
+
+				case 3:
+					imm = 0xffff0000 | read_word(desc);
+					break;
+			}
+		}
+		desc.userdata0 = imm;
+		dst_is_pc = !(group & 0x02) && ((op & 0xf0) >> 4) == PC_REGISTER;
+	}
+	else if (group >= 0x90 && group < 0xa0)
+	{
+		/* LDxx/STxx (dis format) */
+		describe_extension(desc, read_word(desc));
+		desc.flags |= (group < 0x98) ? OPFLAG_READS_MEMORY : OPFLAG_WRITES_MEMORY;
+	}
+	else if (group >= 0xd0 && group < 0xe0)
+	{
+		/* LDW/LDD/STW/STD register and post-increment forms */
+		desc.flags |= (group < 0xd8) ? OPFLAG_READS_MEMORY : OPFLAG_WRITES_MEMORY;
+	}
+	else if (group == 0xce)
+	{
+		/* EXTEND carries its function code in a second halfword */
+		read_word(desc);
+	}
+	else if (group == 0xed)
+	{
+		/* FRAME can raise a frame error */
+		desc.flags |= OPFLAG_CAN_CAUSE_EXCEPTION;
+	}
+	else if (group == 0xee || group == 0xef)
+	{
+		/* CALL (const format) */
+		describe_extension(desc, read_word(desc));
+		desc.targetpc = BRANCH_TARGET_DYNAMIC;
+		desc.flags |= OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE;
+		return true;
+	}
+	else if ((group >= 0xe0 && group < 0xed) || (group >= 0xf0 && group < 0xfd))
+	{
+		/* PCrel format; the offset is relative to the following instruction */
+		int32_t disp;
+		if (op & 0x80)
+		{
+			uint16_t next = read_word(desc);
+			disp = ((op & 0x7f) << 16) | (next & 0xfffe);
+			if (next & 1)
+				disp |= 0xff800000;
+		}
+		else
+		{
+			disp = op & 0x7e;
+			if (op & 1)
+				disp |= 0xffffff80;
+		}
+
+		/* delayed branches take effect after the next instruction, so leave them dynamic */
+		if (group < 0xf0)
+		{
+			desc.targetpc = BRANCH_TARGET_DYNAMIC;
+			desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+		}
+		else
+		{
+			desc.targetpc = desc.pc + desc.length + disp;
+			desc.flags |= (group == 0xfc) ? OPFLAG_IS_UNCONDITIONAL_BRANCH | OPFLAG_END_SEQUENCE : OPFLAG_IS_CONDITIONAL_BRANCH;
+		}
+		return true;
+	}
+	else if (group >= 0xfd)
+	{
+		/* TRAPxx */
+		desc.targetpc = BRANCH_TARGET_DYNAMIC;
+		desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH | OPFLAG_CAN_TRIGGER_SW_INT;
+		return true;
+	}
+
+	/* anything that writes the PC is an indirect jump */
+	if (dst_is_pc)
+	{
+		desc.targetpc = BRANCH_TARGET_DYNAMIC;
+		desc.flags |= OPFLAG_IS_CONDITIONAL_BRANCH;
+	}
+	return true;
+}
@@ -1326,7 +1326,10 @@ void i386_device::i386_task_switch(uint16_t selector, uint8_t nested)
 	}
 	m_cr[3] = READ32(tss+0x1c);  // CR3 (PDBR)
 	if(oldcr3 != m_cr[3])
+	{
 		vtlb_flush_dynamic();
+		invalidate_fetch_page();
+	}
 
 	/* Set the busy bit in the new task's descriptor */
 	if(selector & 0x0004)
@@ -3202,6 +3205,7 @@ void i386_device::i386_postload()
 	int i;
 	for (i = 0; i < 6; i++)
 		i386_load_segment_descriptor(i);
+	invalidate_fetch_page();
 	CHANGE_PC(m_eip);
 }
 
@@ -3241,6 +3245,7 @@ void i386_device::i386_common_init()
 	m_smi = false;
 	m_debugger_temp = 0;
 	m_lock = false;
+	invalidate_fetch_page();
 
 	zero_state();
 
@@ -3918,6 +3923,7 @@ void i386_device::i386_set_a20_line(int state)
 	}
 	// TODO: how does A20M and the tlb interact
 	vtlb_flush_dynamic();
+	invalidate_fetch_page();
 }
 
 void i386_device::execute_run()
@@ -209,6 +209,8 @@ struct I386_CALL_GATE
 	direct_read_data *m_direct;
 	address_space *m_io;
 	uint32_t m_a20_mask;
+	uint32_t m_fetch_page;  // linear code page (plus user bit) whose translation is cached
+	uint32_t m_fetch_phys;  // physical base of m_fetch_page
 
 	int m_cpuid_max_input_value_eax;
 	uint32_t m_cpuid_id0, m_cpuid_id1, m_cpuid_id2;
@@ -293,6 +295,8 @@ struct I386_CALL_GATE
 	inline vtlb_entry get_permissions(uint32_t pte, int wp);
 	bool i386_translate_address(int intention, offs_t *address, vtlb_entry *entry);
 	inline bool translate_address(int pl, int type, uint32_t *address, uint32_t *error);
+	inline bool translate_fetch(uint32_t *address, uint32_t *error);
+	void invalidate_fetch_page() { m_fetch_page = ~0; }
 	inline void CHANGE_PC(uint32_t pc);
 	inline void NEAR_BRANCH(int32_t offs);
 	inline uint8_t FETCH();
@@ -709,6 +709,7 @@ void i386_device::i386_mov_cr_r32()        // Opcode 0x0f 22
 			return;
 	}
 	m_cr[cr] = data;
+	invalidate_fetch_page();
 }
 
 void i386_device::i386_mov_dr_r32()        // Opcode 0x0f 23
@@ -2509,6 +2510,7 @@ void i386_device::i386_loadall()       // Opcode 0x0f 0x07 (0x0f 0x05 on 80286),
 		FAULT(FAULT_GP,0)
 	uint32_t ea = i386_translate(ES, REG32(EDI), 0);
 	m_cr[0] = READ32(ea) & 0xfffeffff; // wp not supported on 386
+	invalidate_fetch_page();
 	set_flags(READ32(ea + 0x04));
 	m_eip = READ32(ea + 0x08);
 	REG32(EDI) = READ32(ea + 0x0c);
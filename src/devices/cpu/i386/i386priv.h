@@ -523,6 +523,27 @@ bool i386_device::translate_address(int pl, int type, uint32_t *address, uint32_
 	return true;
 }
 
+// instruction fetches stay on one page for long stretches, so remember the
+// last code page translation and only go through the TLB when leaving it
+bool i386_device::translate_fetch(uint32_t *address, uint32_t *error)
+{
+	if(!(m_cr[0] & 0x80000000))
+		return true;
+
+	const uint32_t page = (*address & 0xfffff000) | ((m_CPL == 3) ? 1 : 0);
+	if(page == m_fetch_page)
+	{
+		*address = m_fetch_phys | (*address & 0xfff);
+		return true;
+	}
+
+	if(!translate_address(m_CPL,TRANSLATE_FETCH,address,error))
+		return false;
+	m_fetch_page = page;
+	m_fetch_phys = *address & 0xfffff000;
+	return true;
+}
+
 void i386_device::CHANGE_PC(uint32_t pc)
 {
 	m_pc = i386_translate(CS, pc, -1 );
@@ -540,7 +561,7 @@ uint8_t i386_device::FETCH()
 	uint8_t value;
 	uint32_t address = m_pc, error;
 
-	if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
+	if(!translate_fetch(&address,&error))
 		PF_THROW(error);
 
 	value = m_direct->read_byte(address & m_a20_mask);
@@ -561,7 +582,7 @@ uint16_t i386_device::FETCH16()
 		value = (FETCH() << 0);
 		value |= (FETCH() << 8);
 	} else {
-		if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
+		if(!translate_fetch(&address,&error))
 			PF_THROW(error);
 		address &= m_a20_mask;
 		value = m_direct->read_word(address);
@@ -581,7 +602,7 @@ uint32_t i386_device::FETCH32()
 		value |= (FETCH() << 16);
 		value |= (FETCH() << 24);
 	} else {
-		if(!translate_address(m_CPL,TRANSLATE_FETCH,&address,&error))
+		if(!translate_fetch(&address,&error))
 			PF_THROW(error);
 
 		address &= m_a20_mask;
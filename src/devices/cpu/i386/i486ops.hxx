@@ -313,6 +313,7 @@ void i386_device::i486_group0F01_16()      // Opcode 0x0f 01
 				ea = GetEA(modrm,-1);
 				CYCLES(25); // TODO: add to cycles.h
 				vtlb_flush_address(ea);
+				invalidate_fetch_page();
 				break;
 			}
 		default:
@@ -431,6 +432,7 @@ void i386_device::i486_group0F01_32()      // Opcode 0x0f 01
 				ea = GetEA(modrm,-1);
 				CYCLES(25); // TODO: add to cycles.h
 				vtlb_flush_address(ea);
+				invalidate_fetch_page();
 				break;
 			}
 		default:
@@ -513,4 +515,5 @@ void i386_device::i486_mov_cr_r32()        // Opcode 0x0f 22
 			return;
 	}
 	m_cr[cr] = data;
+	invalidate_fetch_page();
 }
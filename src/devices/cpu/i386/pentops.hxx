@@ -163,6 +163,7 @@ void i386_device::pentium_rsm()
 	m_eflags = READ32(smram_state+SMRAM_EAX);
 	m_cr[3] = READ32(smram_state+SMRAM_CR3);
 	m_cr[0] = READ32(smram_state+SMRAM_CR0);
+	invalidate_fetch_page();
 
 	m_CPL = (m_sreg[SS].flags >> 13) & 3; // cpl == dpl of ss
 
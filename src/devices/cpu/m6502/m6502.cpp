@@ -376,18 +376,23 @@ uint8_t m6502_device::do_asr(uint8_t v)
 	return v;
 }
 
+void m6502_device::start_instruction()
+{
+	if(inst_state < 0xff00) {
+		PPC = NPC;
+		inst_state = IR | inst_state_base;
+		if(machine().debug_flags & DEBUG_FLAG_ENABLED)
+			debugger_instruction_hook(this, NPC);
+	}
+}
+
 void m6502_device::execute_run()
 {
 	if(inst_substate)
 		do_exec_partial();
 
 	while(icount > 0) {
-		if(inst_state < 0xff00) {
-			PPC = NPC;
-			inst_state = IR | inst_state_base;
-			if(machine().debug_flags & DEBUG_FLAG_ENABLED)
-				debugger_instruction_hook(this, NPC);
-		}
+		start_instruction();
 		do_exec_full();
 	}
 }
@@ -11,6 +11,17 @@
 #ifndef __M6502FAM_H__
 #define __M6502FAM_H__
 
+// The generated do_exec_full runs threaded code, chaining instructions
+// through a table of label addresses until the slice is over, on compilers
+// that support it, and dispatches one instruction through a switch otherwise
+#ifndef M6502_THREADED_DISPATCH
+#if defined(__GNUC__)
+#define M6502_THREADED_DISPATCH 1
+#else
+#define M6502_THREADED_DISPATCH 0
+#endif
+#endif
+
 #define MCFG_M6502_DISABLE_DIRECT() \
 	downcast<m6502_device *>(device)->disable_direct();
 
@@ -183,6 +194,8 @@ protected:
 	void prefetch_noirq();
 	void set_nz(uint8_t v);
 
+	void start_instruction();
+
 	virtual void do_exec_full();
 	virtual void do_exec_partial();
 
@@ -160,11 +160,36 @@ def save_opcodes(f, device, opcodes):
 DO_EXEC_FULL_PROLOG="""\
 void %(device)s::do_exec_full()
 {
+"""
+
+DO_EXEC_THREADED_PROLOG="""\
+#if M6502_THREADED_DISPATCH
+\tstatic void *const dispatch[0x%(dispatch_count)x] = {
+"""
+
+DO_EXEC_THREADED_MIDDLE="""\
+\t};
+\tgoto *dispatch[inst_state == STATE_RESET ? 0x%(reset_index)x : inst_state];
+state_none:
+\treturn;
+"""
+
+DO_EXEC_THREADED_NEXT="""\
+%(label)s:
+\t%(state)s_full();
+\tif(icount <= 0) return;
+\tstart_instruction();
+\tgoto *dispatch[inst_state == STATE_RESET ? 0x%(reset_index)x : inst_state];
+"""
+
+DO_EXEC_THREADED_EPILOG="""\
+#else
 \tswitch(inst_state) {
 """
 
-DO_EXEC_FULL_EPILOG="""\
+DO_EXEC_SWITCH_EPILOG="""\
 \t}
+#endif
 }
 """
 
@@ -191,18 +216,38 @@ def save_tables(f, device, states):
     total_states = len(states)
 
     d = { "device": device,
-          "disasm_count": total_states-1
+          "disasm_count": total_states-1,
+          "dispatch_count": total_states,
+          "reset_index": total_states-1
           }
     
     
+    # With threaded dispatch each handler starts the next instruction and
+    # jumps straight to its handler, so every opcode gets its own indirect
+    # branch instead of sharing the single one of the switch
     emit(f, DO_EXEC_FULL_PROLOG % d)
+    emit(f, DO_EXEC_THREADED_PROLOG % d)
+    for n, state in enumerate(states):
+        if state == ".":
+            emit(f, "\t\t&&state_none,")
+        elif n < total_states - 1:
+            emit(f, "\t\t&&state_%02x," % n)
+        else:
+            emit(f, "\t\t&&state_reset,")
+    emit(f, DO_EXEC_THREADED_MIDDLE % d)
+    for n, state in enumerate(states):
+        if state == ".": continue
+        d["state"] = state
+        d["label"] = "state_%02x" % n if n < total_states - 1 else "state_reset"
+        emit(f, DO_EXEC_THREADED_NEXT % d)
+    emit(f, DO_EXEC_THREADED_EPILOG % d)
     for n, state in enumerate(states):
         if state == ".": continue
         if n < total_states - 1:
             emit(f, "\tcase 0x%02x: %s_full(); break;\n" % (n, state))
         else:
             emit(f, "\tcase %s: %s_full(); break;\n" % ("STATE_RESET", state))
-    emit(f, DO_EXEC_FULL_EPILOG % d)
+    emit(f, DO_EXEC_SWITCH_EPILOG % d)
 
     emit(f, DO_EXEC_PARTIAL_PROLOG % d)
     for n, state in enumerate(states):
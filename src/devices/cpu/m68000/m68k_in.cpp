@@ -159,7 +159,6 @@ void m68ki_build_opcode_table(void)
 {
 	const opcode_handler_struct *ostruct;
 	int i;
-	int j;
 	int k;
 
 	for(i = 0; i < 0x10000; i++)
@@ -172,81 +171,18 @@ void m68ki_build_opcode_table(void)
 		}
 	}
 
-	ostruct = m68k_opcode_handler_table;
-	while(ostruct->mask != 0xff00)
+	/* Visit only the opcodes each entry matches, by walking every combination */
+	/* of the bits outside its mask, rather than testing all 64K opcodes per   */
+	/* entry.  Entries are still applied in table order, so later ones win.    */
+	for(ostruct = m68k_opcode_handler_table; ostruct->mask != 0; ostruct++)
 	{
-		for(i = 0;i < 0x10000;i++)
+		const unsigned int freebits = ~ostruct->mask & 0xffff;
+		unsigned int bits = 0;
+		do
 		{
-			if((i & ostruct->mask) == ostruct->match)
-				m68ki_set_one(i, ostruct);
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xff00)
-	{
-		for(i = 0;i <= 0xff;i++)
-			m68ki_set_one(ostruct->match | i, ostruct);
-		ostruct++;
-	}
-	while(ostruct->mask == 0xff20)
-	{
-		for(i = 0;i < 4;i++)
-		{
-			for(j = 0;j < 32;j++)
-			{
-				m68ki_set_one(ostruct->match | (i << 6) | j, ostruct);
-			}
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xf1f8)
-	{
-		for(i = 0;i < 8;i++)
-		{
-			for(j = 0;j < 8;j++)
-				m68ki_set_one(ostruct->match | (i << 9) | j, ostruct);
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xffd8)
-	{
-		for(i = 0;i < 2;i++)
-		{
-			for(j = 0;j < 8;j++)
-			{
-				m68ki_set_one(ostruct->match | (i << 5) | j, ostruct);
-			}
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xfff0)
-	{
-		for(i = 0;i <= 0x0f;i++)
-			m68ki_set_one(ostruct->match | i, ostruct);
-		ostruct++;
-	}
-	while(ostruct->mask == 0xf1ff)
-	{
-		for(i = 0;i <= 0x07;i++)
-			m68ki_set_one(ostruct->match | (i << 9), ostruct);
-		ostruct++;
-	}
-	while(ostruct->mask == 0xfff8)
-	{
-		for(i = 0;i <= 0x07;i++)
-			m68ki_set_one(ostruct->match | i, ostruct);
-		ostruct++;
-	}
-	while(ostruct->mask == 0xffff)
-	{
-		m68ki_set_one(ostruct->match, ostruct);
-		ostruct++;
-	}
-
-	// if we fell all the way through with a non-zero mask, the opcode table wasn't built properly
-	if (ostruct->mask != 0)
-	{
-		fatalerror("m68ki_build_opcode_table: unhandled opcode mask %x (match %x), m68k core will not function!\n", ostruct->mask, ostruct->match);
+			m68ki_set_one(ostruct->match | bits, ostruct);
+			bits = (bits - freebits) & freebits;
+		} while(bits != 0);
 	}
 }
 
@@ -2279,6 +2215,7 @@ M68KMAKE_OP(bcc, 8, ., .)
 	{
 		m68ki_trace_t0(mc68kcpu);              /* auto-disable (see m68kcpu.h) */
 		m68ki_branch_8((mc68kcpu), MASK_OUT_ABOVE_8((mc68kcpu)->ir));
+		(mc68kcpu)->idle_branch(REG_PPC(mc68kcpu), REG_PC(mc68kcpu));
 		return;
 	}
 	(mc68kcpu)->remaining_cycles -= (mc68kcpu)->cyc_bcc_notake_b;
@@ -2293,6 +2230,7 @@ M68KMAKE_OP(bcc, 16, ., .)
 		REG_PC(mc68kcpu) -= 2;
 		m68ki_trace_t0(mc68kcpu);              /* auto-disable (see m68kcpu.h) */
 		m68ki_branch_16((mc68kcpu), offset);
+		(mc68kcpu)->idle_branch(REG_PPC(mc68kcpu), REG_PC(mc68kcpu));
 		return;
 	}
 	REG_PC(mc68kcpu) += 2;
@@ -3164,6 +3102,7 @@ M68KMAKE_OP(bra, 8, ., .)
 	m68ki_branch_8((mc68kcpu), MASK_OUT_ABOVE_8((mc68kcpu)->ir));
 	if(REG_PC(mc68kcpu) == REG_PPC(mc68kcpu) && (mc68kcpu)->remaining_cycles > 0)
 		(mc68kcpu)->remaining_cycles = 0;
+	(mc68kcpu)->idle_branch(REG_PPC(mc68kcpu), REG_PC(mc68kcpu));
 }
 
 
@@ -3175,6 +3114,7 @@ M68KMAKE_OP(bra, 16, ., .)
 	m68ki_branch_16((mc68kcpu), offset);
 	if(REG_PC(mc68kcpu) == REG_PPC(mc68kcpu) && (mc68kcpu)->remaining_cycles > 0)
 		(mc68kcpu)->remaining_cycles = 0;
+	(mc68kcpu)->idle_branch(REG_PPC(mc68kcpu), REG_PC(mc68kcpu));
 }
 
 
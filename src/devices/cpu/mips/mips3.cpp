@@ -386,6 +386,8 @@ void mips3_device::device_start()
 
 	/* initialize the front-end helper */
 	m_drcfe = std::make_unique<mips3_frontend>(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, SINGLE_INSTRUCTION_MODE ? 1 : COMPILE_MAX_SEQUENCE);
+	m_warmcache = std::make_unique<drc_warm_cache>(*m_drcfe, *this);
+	m_tiers = std::make_unique<drc_block_tiers>(*this);
 
 	/* allocate memory for cache-local state and initialize it */
 	memcpy(m_fpmode, fpmode_source, sizeof(fpmode_source));
@@ -2729,6 +2731,16 @@ void mips3_device::execute_run()
 			if (execute_result == EXECUTE_MISSING_CODE)
 			{
 				code_compile_block(m_core->mode, m_core->pc);
+
+				/* also compile any blocks remembered from previous runs that are ready */
+				const uint32_t warmmode = m_core->mode;
+				offs_t warmpc;
+				while (m_warmcache->next_block(warmmode, warmpc))
+					if (!m_drcuml->hash_exists(warmmode, warmpc))
+					{
+						m_tiers->promote(warmmode, warmpc);
+						code_compile_block(warmmode, warmpc);
+					}
 			}
 			else if (execute_result == EXECUTE_UNMAPPED_CODE)
 			{
@@ -409,6 +409,8 @@ private:
 	drc_cache           m_cache;                      /* pointer to the DRC code cache */
 	std::unique_ptr<drcuml_state>      m_drcuml;                     /* DRC UML generator state */
 	std::unique_ptr<mips3_frontend>    m_drcfe;                      /* pointer to the DRC front-end state */
+	std::unique_ptr<drc_warm_cache>    m_warmcache;                  /* blocks remembered from previous runs */
+	std::unique_ptr<drc_block_tiers>   m_tiers;                      /* entry counts of cheaply compiled blocks */
 	uint32_t              m_drcoptions;                 /* configurable DRC options */
 
 	/* internal stuff */
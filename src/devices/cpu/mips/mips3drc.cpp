@@ -241,6 +241,7 @@ void mips3_device::code_flush_cache()
 
 	/* empty the transient cache contents */
 	m_drcuml->reset();
+	m_tiers->reset();
 
 	try
 	{
@@ -307,8 +308,14 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 
 	g_profiler.start(PROFILER_DRC_COMPILE);
 
+	/* blocks that haven't run much yet get a short window and an entry counter */
+	uint32_t *tiercount = m_tiers->cold_counter(mode, pc);
+
 	/* get a description of this sequence */
-	desclist = m_drcfe->describe_code(pc);
+	if (tiercount != nullptr)
+		desclist = m_drcfe->describe_code(pc, 0, COMPILE_COLD_FORWARDS_BYTES);
+	else
+		desclist = m_drcfe->describe_code(pc);
 	if (drcuml->logging() || drcuml->logging_native())
 		log_opcode_desc(drcuml, desclist, 0);
 
@@ -366,6 +373,13 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 				if (seqhead->flags & OPFLAG_IS_BRANCH_TARGET)
 					UML_LABEL(block, seqhead->pc | 0x80000000);                             // label   seqhead->pc | 0x80000000
 
+				/* count entries into a cold block, and recompile it once it gets hot */
+				if (tiercount != nullptr && seqhead == desclist)
+				{
+					UML_SUB(block, mem(tiercount), mem(tiercount), 1);                      // sub     [tiercount],[tiercount],1
+					UML_EXHc(block, COND_Z, *m_nocode, seqhead->pc);                        // exh     nocode,seqhead->pc,z
+				}
+
 				/* iterate over instructions in the sequence and compile them */
 				for (curdesc = seqhead; curdesc != seqlast->next(); curdesc = curdesc->next())
 					generate_sequence_instruction(block, &compiler, curdesc);
@@ -390,14 +404,18 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 																							// hashjmp <mode>,nextpc,nocode
 			}
 
-			/* end the sequence */
-			block->end();
+			/* end the sequence; hot blocks get optimized harder, and are the only ones worth remembering */
+			block->end(tiercount == nullptr);
+			if (tiercount == nullptr)
+				m_warmcache->block_compiled(mode, pc, desclist);
 			g_profiler.stop();
 			succeeded = true;
 		}
 		catch (drcuml_block::abort_compilation &)
 		{
 			code_flush_cache();
+			if (tiercount != nullptr)
+				tiercount = m_tiers->cold_counter(mode, pc);
 		}
 	}
 }
@@ -932,6 +932,7 @@ void ppc_device::device_start()
 
 	/* initialize the front-end helper */
 	m_drcfe = std::make_unique<ppc_frontend>(this, COMPILE_BACKWARDS_BYTES, COMPILE_FORWARDS_BYTES, SINGLE_INSTRUCTION_MODE ? 1 : COMPILE_MAX_SEQUENCE);
+	m_warmcache = std::make_unique<drc_warm_cache>(*m_drcfe, *this);
 
 	/* compute the register parameters */
 	for (int regnum = 0; regnum < 32; regnum++)
@@ -241,7 +241,16 @@ void ppc_device::execute_run()
 
 		/* if we need to recompile, do it */
 		if (execute_result == EXECUTE_MISSING_CODE)
+		{
 			code_compile_block(m_core->mode, m_core->pc);
+
+			/* also compile any blocks remembered from previous runs that are ready */
+			const uint32_t warmmode = m_core->mode;
+			offs_t warmpc;
+			while (m_warmcache->next_block(warmmode, warmpc))
+				if (!m_drcuml->hash_exists(warmmode, warmpc))
+					code_compile_block(warmmode, warmpc);
+		}
 		else if (execute_result == EXECUTE_UNMAPPED_CODE)
 			fatalerror("Attempted to execute unmapped code at PC=%08X\n", m_core->pc);
 		else if (execute_result == EXECUTE_RESET_CACHE)
@@ -468,6 +477,7 @@ void ppc_device::code_compile_block(uint8_t mode, offs_t pc)
 
 			/* end the sequence */
 			block->end();
+			m_warmcache->block_compiled(mode, pc, desclist);
 			g_profiler.stop();
 			succeeded = true;
 		}
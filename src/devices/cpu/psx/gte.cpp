@@ -145,22 +145,15 @@ static inline void ATTR_PRINTF(2,3) GTELOG( uint32_t pc, const char *a, ...) {}
 #define CV2( n ) ( n < 3 ? m_cp2cr[ ( n << 3 ) + 6 ].sd : 0 )
 #define CV3( n ) ( n < 3 ? m_cp2cr[ ( n << 3 ) + 7 ].sd : 0 )
 
-static uint32_t gte_leadingzerocount( uint32_t lzcs )
+/* counts leading bits equal to the sign bit; called for every perspective divide */
+static inline uint32_t gte_leadingzerocount( uint32_t lzcs )
 {
-	uint32_t lzcr = 0;
-
-	if( ( lzcs & 0x80000000 ) == 0 )
+	if( ( lzcs & 0x80000000 ) != 0 )
 	{
 		lzcs = ~lzcs;
 	}
 
-	while( ( lzcs & 0x80000000 ) != 0 )
-	{
-		lzcr++;
-		lzcs <<= 1;
-	}
-
-	return lzcr;
+	return count_leading_zeros( lzcs );
 }
 
 int32_t gte::LIM( int32_t value, int32_t max, int32_t min, uint32_t flag )
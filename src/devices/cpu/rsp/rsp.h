@@ -217,6 +217,7 @@ private:
 	drc_cache           m_cache;                      /* pointer to the DRC code cache */
 	std::unique_ptr<drcuml_state>      m_drcuml;                     /* DRC UML generator state */
 	std::unique_ptr<rsp_frontend>      m_drcfe;                      /* pointer to the DRC front-end state */
+	std::unique_ptr<drc_warm_cache>    m_warmcache;                  /* blocks remembered from previous runs */
 	uint32_t              m_drcoptions;                 /* configurable DRC options */
 
 	/* internal stuff */
@@ -384,11 +384,11 @@ protected:
 #include "vldst.h"
 #endif
 
-private:
 	void            handle_lwc2(uint32_t op);
 	void            handle_swc2(uint32_t op);
 	void            handle_vector_ops(uint32_t op);
 
+private:
 	uint32_t          m_div_in;
 	uint32_t          m_div_out;
 };
@@ -706,6 +706,14 @@ static void cfunc_ltv(void *param)
 }
 
 
+#if USE_SIMD
+static void cfunc_simd_lwc2(void *param)
+{
+	((rsp_cop2_drc *)param)->simd_lwc2();
+}
+#endif
+
+
 bool rsp_cop2_drc::generate_lwc2(drcuml_block *block, rsp_device::compiler_state *compiler, const opcode_desc *desc)
 {
 	uint32_t op = desc->opptr.l[0];
@@ -715,6 +723,19 @@ bool rsp_cop2_drc::generate_lwc2(drcuml_block *block, rsp_device::compiler_state
 		offset |= 0xffffffc0;
 	}
 
+#if USE_SIMD
+	// the vector register file and accumulators live in the SSE layout, so
+	// hand every known load to the shared vectorized implementation
+	if (((op >> 11) & 0x1f) <= 0x0b)
+	{
+		UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [m_rspcop2_state->op],desc->opptr.l
+		UML_CALLC(block, cfunc_simd_lwc2, this);
+		return true;
+	}
+
+	// anything else is reported when it executes, by the caller's fallback
+	return false;
+#else
 	switch ((op >> 11) & 0x1f)
 	{
 		case 0x00:      /* LBV */
@@ -780,6 +801,7 @@ bool rsp_cop2_drc::generate_lwc2(drcuml_block *block, rsp_device::compiler_state
 		default:
 			return false;
 	}
+#endif
 }
 
 
@@ -1256,6 +1278,14 @@ static void cfunc_stv(void *param)
 	((rsp_cop2 *)param)->stv();
 }
 
+#if USE_SIMD
+static void cfunc_simd_swc2(void *param)
+{
+	((rsp_cop2_drc *)param)->simd_swc2();
+}
+#endif
+
+
 bool rsp_cop2_drc::generate_swc2(drcuml_block *block, rsp_device::compiler_state *compiler, const opcode_desc *desc)
 {
 	uint32_t op = desc->opptr.l[0];
@@ -1265,6 +1295,17 @@ bool rsp_cop2_drc::generate_swc2(drcuml_block *block, rsp_device::compiler_state
 		offset |= 0xffffffc0;
 	}
 
+#if USE_SIMD
+	if (((op >> 11) & 0x1f) <= 0x0b)
+	{
+		UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);        // mov     [m_rspcop2_state->op],desc->opptr.l
+		UML_CALLC(block, cfunc_simd_swc2, this);
+		return true;
+	}
+
+	// anything else is reported when it executes, by the caller's fallback
+	return false;
+#else
 	switch ((op >> 11) & 0x1f)
 	{
 		case 0x00:      /* SBV */
@@ -1331,8 +1372,7 @@ bool rsp_cop2_drc::generate_swc2(drcuml_block *block, rsp_device::compiler_state
 			m_rsp.unimplemented_opcode(op);
 			return false;
 	}
-
-	return true;
+#endif
 }
 
 
@@ -3694,11 +3734,37 @@ static void cfunc_ctc2(void *param)
     COP2 Opcode Compilation
 ***************************************************************************/
 
+#if USE_SIMD
+static void cfunc_simd_cop2(void *param)
+{
+	((rsp_cop2_drc *)param)->simd_cop2();
+}
+#endif
+
 bool rsp_cop2_drc::generate_cop2(drcuml_block *block, rsp_device::compiler_state *compiler, const opcode_desc *desc)
 {
 	uint32_t op = desc->opptr.l[0];
 	uint8_t opswitch = RSREG;
 
+#if USE_SIMD
+	// moves, control moves and vector ops all go through the SSE kernels so
+	// that the flags and accumulators stay in a single representation
+	switch (opswitch)
+	{
+		case 0x00:  /* MFCz */
+		case 0x02:  /* CFCz */
+			if (RTREG == 0)
+				return true;
+			// fall through
+		case 0x04:  /* MTCz */
+		case 0x06:  /* CTCz */
+		case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17:
+		case 0x18: case 0x19: case 0x1a: case 0x1b: case 0x1c: case 0x1d: case 0x1e: case 0x1f:
+			UML_MOV(block, mem(&m_rspcop2_state->op), desc->opptr.l[0]);   // mov     [arg0],desc->opptr.l
+			UML_CALLC(block, cfunc_simd_cop2, this);                       // callc   simd_cop2
+			return true;
+	}
+#else
 	switch (opswitch)
 	{
 		case 0x00:  /* MFCz */
@@ -3731,5 +3797,6 @@ bool rsp_cop2_drc::generate_cop2(drcuml_block *block, rsp_device::compiler_state
 		case 0x18: case 0x19: case 0x1a: case 0x1b: case 0x1c: case 0x1d: case 0x1e: case 0x1f:
 			return generate_vector_opcode(block, compiler, desc);
 	}
+#endif
 	return false;
 }
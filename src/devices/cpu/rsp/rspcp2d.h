@@ -102,6 +102,13 @@ public:
 	virtual void mtc2() override;
 	virtual void ctc2() override;
 
+#if USE_SIMD
+	// SSE kernels shared with the interpreter, operating on its SIMD register layout
+	void simd_cop2() { handle_cop2(m_rspcop2_state->op); }
+	void simd_lwc2() { handle_lwc2(m_rspcop2_state->op); }
+	void simd_swc2() { handle_swc2(m_rspcop2_state->op); }
+#endif
+
 private:
 	virtual bool generate_vector_opcode(drcuml_block *block, rsp_device::compiler_state *compiler, const opcode_desc *desc) override;
 };
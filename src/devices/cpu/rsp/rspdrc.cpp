@@ -282,6 +282,13 @@ void rsp_device::execute_run_drc()
 		if (execute_result == EXECUTE_MISSING_CODE)
 		{
 			code_compile_block(m_rsp_state->pc);
+
+			/* also compile any blocks remembered from previous runs that are ready */
+			const uint32_t warmmode = 0;
+			offs_t warmpc;
+			while (m_warmcache->next_block(warmmode, warmpc))
+				if (!drcuml->hash_exists(warmmode, warmpc))
+					code_compile_block(warmpc);
 		}
 		else if (execute_result == EXECUTE_UNMAPPED_CODE)
 		{
@@ -435,6 +442,7 @@ void rsp_device::code_compile_block(offs_t pc)
 
 			/* end the sequence */
 			block->end();
+			m_warmcache->block_compiled(0, pc, desclist);
 			g_profiler.stop();
 			succeeded = true;
 		}
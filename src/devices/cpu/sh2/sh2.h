@@ -78,6 +78,7 @@ typedef device_delegate<void (uint32_t data)> sh2_ftcsr_read_delegate;
 #define SH2DRC_STRICT_VERIFY        0x0001          /* verify all instructions */
 #define SH2DRC_FLUSH_PC         0x0002          /* flush the PC value before each memory access */
 #define SH2DRC_STRICT_PCREL     0x0004          /* do actual loads on MOVLI/MOVWI instead of collapsing to immediates */
+#define SH2DRC_TRACK_CODE_PAGES 0x0008          /* invalidate only the blocks on RAM pages that are written */
 
 #define SH2DRC_COMPATIBLE_OPTIONS   (SH2DRC_STRICT_VERIFY | SH2DRC_FLUSH_PC | SH2DRC_STRICT_PCREL)
 #define SH2DRC_FASTEST_OPTIONS  (0)
@@ -219,6 +220,8 @@ private:
 	drc_cache           m_cache;                  /* pointer to the DRC code cache */
 	std::unique_ptr<drcuml_state>      m_drcuml;                 /* DRC UML generator state */
 	std::unique_ptr<sh2_frontend>      m_drcfe;                  /* pointer to the DRC front-end state */
+	std::unique_ptr<drc_warm_cache>    m_warmcache;              /* blocks remembered from previous runs */
+	std::unique_ptr<drc_code_pages>    m_codepages;              /* RAM pages holding compiled code */
 	uint32_t              m_drcoptions;         /* configurable DRC options */
 
 	internal_sh2_state *m_sh2_state;
@@ -452,6 +455,7 @@ private:
 	void static_generate_nocode_handler();
 	void static_generate_out_of_cycles();
 	void static_generate_memory_accessor(int size, int iswrite, const char *name, uml::code_handle **handleptr);
+	void generate_constant_read(drcuml_block *block, uint32_t address, int size);
 	const char *log_desc_flags_to_string(uint32_t flags);
 	void log_register_list(drcuml_state *drcuml, const char *string, const uint32_t *reglist, const uint32_t *regnostarlist);
 	void log_opcode_desc(drcuml_state *drcuml, const opcode_desc *desclist, int indent);
@@ -473,6 +477,7 @@ public:
 	void func_printf_probe();
 	void func_unimplemented();
 	void func_fastirq();
+	void func_code_page_write();
 	void func_MAC_W();
 	void func_MAC_L();
 	void func_DIV1();
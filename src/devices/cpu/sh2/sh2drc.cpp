@@ -192,6 +192,20 @@ void sh2_device::func_fastirq()
 	sh2_exception("fastirq",m_sh2_state->irqline);
 }
 
+/*-------------------------------------------------
+    cfunc_code_page_write - a fast RAM write hit
+    a page holding compiled code
+-------------------------------------------------*/
+static void cfunc_code_page_write(void *param)
+{
+	((sh2_device *)param)->func_code_page_write();
+}
+
+void sh2_device::func_code_page_write()
+{
+	m_codepages->write(m_sh2_state->arg0);
+}
+
 /*-------------------------------------------------
     cfunc_MAC_W - implementation of MAC_W Rm,Rn
 -------------------------------------------------*/
@@ -590,6 +604,22 @@ void sh2_device::code_flush_cache()
 	/* empty the transient cache contents */
 	drcuml->reset();
 
+	/* track the pages holding code so that writing one only drops the blocks on it */
+	if (m_drcoptions & SH2DRC_TRACK_CODE_PAGES)
+	{
+		if (m_codepages == nullptr)
+		{
+			m_codepages = std::make_unique<drc_code_pages>(*drcuml, 32);
+
+			/* fast RAM writes are checked by the accessors below; everything else comes through the address space */
+			for (auto & elem : m_fastram)
+				if (elem.base != nullptr && !elem.readonly)
+					m_program->install_write_tap(elem.start, elem.end, memory_tap_delegate(&drc_code_pages::write_tap, m_codepages.get()));
+		}
+		else
+			m_codepages->reset();
+	}
+
 	try
 	{
 		/* generate the entry point and out-of-cycles handlers */
@@ -645,6 +675,13 @@ void sh2_device::execute_run_drc()
 		if (execute_result == EXECUTE_MISSING_CODE)
 		{
 			code_compile_block(0, m_sh2_state->pc);
+
+			/* also compile any blocks remembered from previous runs that are ready */
+			const uint32_t warmmode = 0;
+			offs_t warmpc;
+			while (m_warmcache->next_block(warmmode, warmpc))
+				if (!drcuml->hash_exists(warmmode, warmpc))
+					code_compile_block(warmmode, warmpc);
 		}
 		else if (execute_result == EXECUTE_UNMAPPED_CODE)
 		{
@@ -763,6 +800,9 @@ void sh2_device::code_compile_block(uint8_t mode, offs_t pc)
 
 			/* end the sequence */
 			block->end();
+			m_warmcache->block_compiled(mode, pc, desclist);
+			if (m_codepages != nullptr)
+				m_codepages->block_compiled(mode, desclist, AM);
 			g_profiler.stop();
 			succeeded = true;
 		}
@@ -971,6 +1011,19 @@ void sh2_device::static_generate_memory_accessor(int size, int iswrite, const ch
 			}
 			else
 			{
+				if (m_codepages != nullptr)
+				{
+					uint32_t nocode = label++;
+					UML_SHR(block, mem(&m_sh2_state->arg0), I0, m_codepages->pageshift());  // shr     [arg0],i0,pageshift
+					UML_LOAD(block, mem(&m_sh2_state->arg0), m_codepages->page_flags(), mem(&m_sh2_state->arg0), SIZE_BYTE, SCALE_x1);
+																							// load    [arg0],page_flags,[arg0],byte
+					UML_CMP(block, mem(&m_sh2_state->arg0), 0);                              // cmp     [arg0],0
+					UML_JMPc(block, COND_E, nocode);                                         // je      nocode
+					UML_MOV(block, mem(&m_sh2_state->arg0), I0);                             // mov     [arg0],i0
+					UML_CALLC(block, cfunc_code_page_write, this);                           // callc   cfunc_code_page_write
+					UML_LABEL(block, nocode);                                                // nocode:
+				}
+
 				if (size == 1)
 				{
 					UML_XOR(block, I0, I0, BYTE4_XOR_BE(0));
@@ -1032,6 +1085,59 @@ void sh2_device::static_generate_memory_accessor(int size, int iswrite, const ch
 	block->end();
 }
 
+/*------------------------------------------------------------------
+    generate_constant_read - read from an address
+    known at compile time; this resolves the
+    cache-through mirror and fastram lookup done by
+    the memory accessors up front. Result is in I0.
+------------------------------------------------------------------*/
+
+void sh2_device::generate_constant_read(drcuml_block *block, uint32_t address, int size)
+{
+	// same masking as static_generate_memory_accessor
+	if (!(address & 0x80000000) && address < 0x40000000)
+		address &= AM;
+
+	for (auto & elem : m_fastram)
+	{
+		if (elem.base != nullptr && address >= elem.start && address <= elem.end)
+		{
+			if (size == 1)
+			{
+				uint8_t *ptr = (uint8_t *)elem.base + ((address - elem.start) ^ BYTE4_XOR_BE(0));
+				UML_LOAD(block, I0, ptr, 0, SIZE_BYTE, SCALE_x1);               // load    i0,ptr,0,byte
+			}
+			else if (size == 2)
+			{
+				uint8_t *ptr = (uint8_t *)elem.base + ((address - elem.start) ^ WORD_XOR_BE(0));
+				UML_LOAD(block, I0, ptr, 0, SIZE_WORD, SCALE_x1);               // load    i0,ptr,0,word_x1
+			}
+			else if (size == 4)
+			{
+				uint8_t *ptr = (uint8_t *)elem.base + (address - elem.start);
+				UML_LOAD(block, I0, ptr, 0, SIZE_DWORD, SCALE_x1);              // load    i0,ptr,0,dword_x1
+			}
+			return;
+		}
+	}
+
+	// cached RAM outside fastram, cache-through areas and on-chip peripherals go straight to the memory system
+	switch (size)
+	{
+		case 1:
+			UML_READ(block, I0, address, SIZE_BYTE, SPACE_PROGRAM);    // read    i0,address,program_byte
+			break;
+
+		case 2:
+			UML_READ(block, I0, address, SIZE_WORD, SPACE_PROGRAM);    // read    i0,address,program_word
+			break;
+
+		case 4:
+			UML_READ(block, I0, address, SIZE_DWORD, SPACE_PROGRAM);   // read    i0,address,program_dword
+			break;
+	}
+}
+
 /*-------------------------------------------------
     log_desc_flags_to_string - generate a string
     representing the instruction description
@@ -1523,7 +1629,7 @@ bool sh2_device::generate_opcode(drcuml_block *block, compiler_state *compiler,
 			{
 				UML_MOV(block, I0, scratch);            // mov r0, scratch
 				SETEA(0);                       // set ea for debug
-				UML_CALLH(block, *m_read16);             // read16(r0, r1)
+				generate_constant_read(block, scratch, 2);   // read16(scratch)
 				UML_SEXT(block, R32(Rn), I0, SIZE_WORD);            // sext Rn, r0, WORD
 			}
 			else
@@ -1575,8 +1681,7 @@ bool sh2_device::generate_opcode(drcuml_block *block, compiler_state *compiler,
 
 			if (m_drcoptions & SH2DRC_STRICT_PCREL)
 			{
-				UML_MOV(block, I0, scratch);            // mov r0, scratch
-				UML_CALLH(block, *m_read32);             // read32(r0, r1)
+				generate_constant_read(block, scratch, 4);   // read32(scratch)
 				UML_MOV(block, R32(Rn), I0);            // mov Rn, r0
 			}
 			else
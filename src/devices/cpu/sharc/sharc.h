@@ -606,6 +606,7 @@ private:
 			int mode;
 			uint32_t data;
 		} mode1_delay;
+		const opcode_desc *desclist;                 /* instructions in the block being compiled */
 	};
 
 	void execute_run_drc();
@@ -828,6 +828,7 @@ void adsp21062_device::compile_block(offs_t pc)
 	drcuml_block *block;
 
 	desclist = m_drcfe->describe_code(pc);
+	compiler.desclist = desclist;
 
 	bool succeeded = false;
 	while (!succeeded)
@@ -1629,15 +1630,22 @@ void adsp21062_device::generate_jump(drcuml_block *block, compiler_state *compil
 
 void adsp21062_device::generate_loop_jump(drcuml_block *block, compiler_state *compiler, const opcode_desc *desc)
 {
-	// update cycles and hash jump
+	// the loop start is always a branch target, so if it was described as part of
+	// this block it heads a labelled sequence and the loop can close without a hash lookup
+	bool intrablock = false;
+	for (const opcode_desc *scan = compiler->desclist; scan != nullptr; scan = scan->next())
+		if (scan->pc == desc->userdata0)
+		{
+			intrablock = true;
+			break;
+		}
+
+	// update cycles and jump back to the loop start
 	generate_update_cycles(block, compiler, desc->userdata0, true);
-	/*
-	if (desc->flags & OPFLAG_INTRABLOCK_BRANCH)
-	    UML_JMP(block, desc->targetpc | 0x80000000);                                // jmp      targetpc | 0x80000000
+	if (intrablock)
+		UML_JMP(block, desc->userdata0 | 0x80000000);                                  // jmp      userdata0 | 0x80000000
 	else
-	    UML_HASHJMP(block, 0, desc->targetpc, *m_nocode);                           // hashjmp  0,targetpc,nocode
-	    */
-	UML_HASHJMP(block, 0, desc->userdata0, *m_nocode);
+		UML_HASHJMP(block, 0, desc->userdata0, *m_nocode);                             // hashjmp  0,userdata0,nocode
 
 	/* reset the mapvar to the current cycles and account for skipped slots */
 	compiler->cycles += desc->skipslots;
@@ -215,6 +215,16 @@ uint16_t tms340x0_device::memory_r(address_space &space, offs_t offset)
 	return space.read_word(offset);
 }
 
+/* Store a run of identical words straight into RAM; fails if the run is not one contiguous RAM block */
+bool tms340x0_device::fill_words_direct(uint32_t dwordaddr, int words, uint16_t data)
+{
+	uint16_t *dst = (uint16_t *)m_program->get_write_ptr(dwordaddr << 1);
+	if (dst == nullptr || m_program->get_write_ptr((dwordaddr + words - 1) << 1) != dst + words - 1)
+		return false;
+	std::fill_n(dst, words, data);
+	return true;
+}
+
 void tms340x0_device::shiftreg_w(address_space &space, offs_t offset,uint16_t data)
 {
 	if (!m_from_shiftreg_cb.isnull())
@@ -1857,6 +1867,13 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 		m_gfxcycles += 2;
 		m_st |= STBIT_P;
 
+		/* full words can be stored directly into plain memory when every pixel is replaced by COLOR1 */
+		bool direct_words = (word_write == &tms340x0_device::memory_w) && !PIXEL_OP_REQUIRES_SOURCE;
+		if (TRANSPARENCY)
+			for (x = 0; x < PIXELS_PER_WORD; x++)
+				if ((COLOR1() & (PIXEL_MASK << (x * BITS_PER_PIXEL))) == 0)
+					direct_words = false;
+
 		/* loop over rows */
 		for (y = 0; y < dy; y++)
 		{
@@ -1894,30 +1911,35 @@ void FUNCTION_NAME(tms340x0_device::fill)(int dst_is_linear)
 			}
 
 			/* loop over full words */
-			for (words = 0; words < full_words; words++)
+			if (direct_words && full_words > 0 && fill_words_direct(dwordaddr, full_words, COLOR1()))
+				dwordaddr += full_words;
+			else
 			{
-				/* fetch the destination word (if necessary) */
-				if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
-					dstword = (this->*word_read)(*m_program, dwordaddr << 1);
-				else
-					dstword = 0;
-				dstmask = PIXEL_MASK;
-
-				/* loop over partials */
-				for (x = 0; x < PIXELS_PER_WORD; x++)
+				for (words = 0; words < full_words; words++)
 				{
-					/* process the pixel */
-					pixel = COLOR1() & dstmask;
-					PIXEL_OP(dstword, dstmask, pixel);
-					if (!TRANSPARENCY || pixel != 0)
-						dstword = (dstword & ~dstmask) | pixel;
+					/* fetch the destination word (if necessary) */
+					if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
+						dstword = (this->*word_read)(*m_program, dwordaddr << 1);
+					else
+						dstword = 0;
+					dstmask = PIXEL_MASK;
 
-					/* update the destination */
-					dstmask = dstmask << BITS_PER_PIXEL;
-				}
+					/* loop over partials */
+					for (x = 0; x < PIXELS_PER_WORD; x++)
+					{
+						/* process the pixel */
+						pixel = COLOR1() & dstmask;
+						PIXEL_OP(dstword, dstmask, pixel);
+						if (!TRANSPARENCY || pixel != 0)
+							dstword = (dstword & ~dstmask) | pixel;
+
+						/* update the destination */
+						dstmask = dstmask << BITS_PER_PIXEL;
+					}
 
-				/* write the result */
-				(this->*word_write)(*m_program, dwordaddr++ << 1, dstword);
+					/* write the result */
+					(this->*word_write)(*m_program, dwordaddr++ << 1, dstword);
+				}
 			}
 
 			/* handle the right partial word */
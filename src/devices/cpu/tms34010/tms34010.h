@@ -905,6 +905,7 @@ protected:
 	int compute_pixblt_b_cycles(int left_partials, int right_partials, int full_words, int rows, int op_timing, int bpp);
 	void memory_w(address_space &space, offs_t offset,uint16_t data);
 	uint16_t memory_r(address_space &space, offs_t offset);
+	bool fill_words_direct(uint32_t dwordaddr, int words, uint16_t data);
 	void shiftreg_w(address_space &space, offs_t offset, uint16_t data);
 	uint16_t shiftreg_r(address_space &space, offs_t offset);
 	uint16_t dummy_shiftreg_r(address_space &space, offs_t offset);
@@ -849,6 +849,41 @@ uint8_t uml::instruction::modified_flags() const
 }
 
 
+//-------------------------------------------------
+//  output_iregs - return a mask of the integer
+//  registers written by an instruction
+//-------------------------------------------------
+
+uint32_t uml::instruction::output_iregs() const
+{
+	const opcode_info &opinfo = s_opcode_info_table[m_opcode];
+
+	uint32_t result = 0;
+	for (int pnum = 0; pnum < m_numparams; pnum++)
+		if ((opinfo.param[pnum].output & PIO_OUT) && m_param[pnum].is_int_register())
+			result |= 1 << (m_param[pnum].ireg() - REG_I0);
+	return result;
+}
+
+
+//-------------------------------------------------
+//  propagate_ireg - replace input-only uses of
+//  an integer register with a value known at
+//  compile time
+//-------------------------------------------------
+
+void uml::instruction::propagate_ireg(int regnum, uint64_t value)
+{
+	const opcode_info &opinfo = s_opcode_info_table[m_opcode];
+
+	if (m_size == 4)
+		value = uint32_t(value);
+	for (int pnum = 0; pnum < m_numparams; pnum++)
+		if (opinfo.param[pnum].output == PIO_IN && (opinfo.param[pnum].typemask & PTYPES_IMM) && m_param[pnum].is_int_register() && m_param[pnum].ireg() == regnum)
+			m_param[pnum] = value;
+}
+
+
 //-------------------------------------------------
 //  disasm - disassemble an instruction to the
 //  given buffer
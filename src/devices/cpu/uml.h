@@ -416,7 +416,9 @@ namespace uml
 		uint8_t input_flags() const;
 		uint8_t output_flags() const;
 		uint8_t modified_flags() const;
+		uint32_t output_iregs() const;
 		void simplify();
+		void propagate_ireg(int regnum, uint64_t value);
 
 		// compile-time opcodes
 		void handle(code_handle &hand) { configure(OP_HANDLE, 4, hand); }
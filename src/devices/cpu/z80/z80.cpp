@@ -541,6 +541,7 @@ inline void z80_device::jp(void)
 {
 	PCD = arg16();
 	WZ = PCD;
+	idle_branch(PRVPC, PCD);
 }
 
 /***************************************************************
@@ -552,6 +553,7 @@ inline void z80_device::jp_cond(bool cond)
 	{
 		PCD = arg16();
 		WZ = PCD;
+		idle_branch(PRVPC, PCD);
 	}
 	else
 	{
@@ -567,6 +569,7 @@ inline void z80_device::jr()
 	int8_t a = (int8_t)arg();    /* arg() also increments PC */
 	PC += a;             /* so don't do PC += arg() */
 	WZ = PC;
+	idle_branch(PRVPC, PCD);
 }
 
 /***************************************************************
@@ -636,6 +639,7 @@ inline void z80_device::retn()
 	pop(m_pc);
 	WZ = PC;
 	m_iff1 = m_iff2;
+	m_check_pending = true;
 }
 
 /***************************************************************
@@ -646,6 +650,7 @@ inline void z80_device::reti()
 	pop(m_pc);
 	WZ = PC;
 	m_iff1 = m_iff2;
+	m_check_pending = true;
 	daisy_call_reti_device();
 }
 
@@ -1360,6 +1365,7 @@ inline void z80_device::ei()
 {
 	m_iff1 = m_iff2 = 1;
 	m_after_ei = true;
+	m_check_pending = true;
 }
 
 /**********************************************************
@@ -3403,6 +3409,7 @@ void z80_device::device_start()
 	m_busrq_state = 0;
 	m_after_ei = 0;
 	m_after_ldair = 0;
+	m_check_pending = true;
 	m_ea = 0;
 
 	m_program = &space(AS_PROGRAM);
@@ -3445,6 +3452,9 @@ void z80_device::device_start()
 	state_add(Z80_IFF2,        "IFF2",      m_iff2).mask(0x1);
 	state_add(Z80_HALT,        "HALT",      m_halt).mask(0x1);
 
+	// R counts every fetch, so it never settles in an idle loop
+	idle_ignore_state(Z80_R);
+
 	// set our instruction counter
 	m_icountptr = &m_icount;
 
@@ -3495,20 +3505,31 @@ void nsc800_device::device_reset()
  ****************************************************************************/
 void z80_device::execute_run()
 {
+	// state may have been changed from outside since the last timeslice
+	m_check_pending = true;
+
 	do
 	{
-		if (m_wait_state)
+		// the wait and interrupt checks only need to run when one of their
+		// inputs has changed or an interrupt is still waiting to be taken
+		if (m_check_pending)
 		{
-			// stalled
-			m_icount = 0;
-			return;
-		}
+			if (m_wait_state)
+			{
+				// stalled
+				m_icount = 0;
+				return;
+			}
 
-		// check for interrupts before each instruction
-		if (m_nmi_pending)
-			take_nmi();
-		else if (m_irq_state != CLEAR_LINE && m_iff1 && !m_after_ei)
-			take_interrupt();
+			// check for interrupts before each instruction
+			if (m_nmi_pending)
+				take_nmi();
+			else if (m_irq_state != CLEAR_LINE && m_iff1 && !m_after_ei)
+				take_interrupt();
+
+			// an EI shadow or a held IRQ line that is still enabled needs another look next time
+			m_check_pending = m_after_ei || (m_irq_state != CLEAR_LINE && m_iff1);
+		}
 
 		m_after_ei = false;
 		m_after_ldair = false;
@@ -3562,6 +3583,7 @@ void z80_device::execute_set_input(int inputnum, int state)
 		if (m_nmi_state == CLEAR_LINE && state != CLEAR_LINE)
 			m_nmi_pending = true;
 		m_nmi_state = state;
+		m_check_pending = true;
 		break;
 
 	case INPUT_LINE_IRQ0:
@@ -3569,12 +3591,14 @@ void z80_device::execute_set_input(int inputnum, int state)
 		m_irq_state = state;
 		if (daisy_chain_present())
 			m_irq_state = (daisy_update_irq_state() == ASSERT_LINE ) ? ASSERT_LINE : m_irq_state;
+		m_check_pending = true;
 
 		/* the main execute loop will take the interrupt */
 		break;
 
 	case Z80_INPUT_LINE_WAIT:
 		m_wait_state = state;
+		m_check_pending = true;
 		break;
 
 	default:
@@ -275,6 +275,7 @@ protected:
 	int             m_busrq_state;        // bus request line state
 	uint8_t           m_after_ei;           /* are we in the EI shadow? */
 	uint8_t           m_after_ldair;        /* same, but for LD A,I or LD A,R */
+	bool            m_check_pending;      // wait/NMI/IRQ state may need servicing before the next instruction
 	uint32_t          m_ea;
 
 	int             m_icount;
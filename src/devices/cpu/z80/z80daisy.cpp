@@ -24,7 +24,9 @@
 
 device_z80daisy_interface::device_z80daisy_interface(const machine_config &mconfig, device_t &device)
 	: device_interface(device, "z80daisy"),
-		m_daisy_next(nullptr)
+		m_daisy_next(nullptr),
+		m_daisy_chain(nullptr),
+		m_daisy_reports_changes(false)
 {
 }
 
@@ -50,7 +52,12 @@ device_z80daisy_interface::~device_z80daisy_interface()
 z80_daisy_chain_interface::z80_daisy_chain_interface(const machine_config &mconfig, device_t &device)
 	: device_interface(device, "z80daisychain"),
 		m_daisy_config(nullptr),
-		m_chain(nullptr)
+		m_chain(nullptr),
+		m_cacheable(false),
+		m_cache_valid(false),
+		m_int_device(nullptr),
+		m_ieo_device(nullptr),
+		m_irq_line(CLEAR_LINE)
 {
 }
 
@@ -125,6 +132,16 @@ void z80_daisy_chain_interface::daisy_init(const z80_daisy_config *daisy)
 		tailptr = &(*tailptr)->m_daisy_next;
 	}
 
+	// the chain state can only be cached if every device says when it changes
+	m_cacheable = (m_chain != nullptr);
+	for (device_z80daisy_interface *intf = m_chain; intf != nullptr; intf = intf->m_daisy_next)
+	{
+		intf->m_daisy_chain = this;
+		if (!intf->m_daisy_reports_changes)
+			m_cacheable = false;
+	}
+	m_cache_valid = false;
+
 	osd_printf_verbose("Daisy chain = %s\n", daisy_show_chain().c_str());
 }
 
@@ -139,6 +156,54 @@ void z80_daisy_chain_interface::interface_post_reset()
 	// loop over all chained devices and call their reset function
 	for (device_z80daisy_interface *intf = m_chain; intf != nullptr; intf = intf->m_daisy_next)
 		intf->device().reset();
+	m_cache_valid = false;
+}
+
+
+//-------------------------------------------------
+//  interface_post_load - the devices' state has
+//  been replaced, so forget the cached state
+//-------------------------------------------------
+
+void z80_daisy_chain_interface::interface_post_load()
+{
+	m_cache_valid = false;
+}
+
+
+//-------------------------------------------------
+//  daisy_refresh_cache - walk the chain once and
+//  remember everything the callbacks need
+//-------------------------------------------------
+
+void z80_daisy_chain_interface::daisy_refresh_cache()
+{
+	m_int_device = m_ieo_device = nullptr;
+	m_irq_line = CLEAR_LINE;
+
+	// loop over all devices; dev[0] is highest priority
+	for (device_z80daisy_interface *intf = m_chain; intf != nullptr && m_ieo_device == nullptr; intf = intf->m_daisy_next)
+	{
+		// the first device asserting INT is acknowledged; it only reaches the
+		// CPU if no device above it is asserting IEO
+		int state = intf->z80daisy_irq_state();
+		if ((state & Z80_DAISY_INT) && m_int_device == nullptr)
+		{
+			m_int_device = intf;
+			m_irq_line = ASSERT_LINE;
+		}
+
+		// the first device asserting IEO receives the RETI
+		if (state & Z80_DAISY_IEO)
+			m_ieo_device = intf;
+	}
+
+	// devices below an IEO can still be acknowledged
+	for (device_z80daisy_interface *intf = (m_ieo_device != nullptr) ? m_ieo_device->m_daisy_next : nullptr; intf != nullptr && m_int_device == nullptr; intf = intf->m_daisy_next)
+		if (intf->z80daisy_irq_state() & Z80_DAISY_INT)
+			m_int_device = intf;
+
+	m_cache_valid = true;
 }
 
 
@@ -149,6 +214,13 @@ void z80_daisy_chain_interface::interface_post_reset()
 
 int z80_daisy_chain_interface::daisy_update_irq_state()
 {
+	if (m_cacheable)
+	{
+		if (!m_cache_valid)
+			daisy_refresh_cache();
+		return m_irq_line;
+	}
+
 	// loop over all devices; dev[0] is highest priority
 	for (device_z80daisy_interface *intf = m_chain; intf != nullptr; intf = intf->m_daisy_next)
 	{
@@ -172,6 +244,17 @@ int z80_daisy_chain_interface::daisy_update_irq_state()
 
 device_z80daisy_interface *z80_daisy_chain_interface::daisy_get_irq_device()
 {
+	if (m_cacheable)
+	{
+		if (!m_cache_valid)
+			daisy_refresh_cache();
+		if (m_int_device != nullptr)
+			return m_int_device;
+		if (VERBOSE)
+			device().logerror("Interrupt from outside Z80 daisy chain\n");
+		return nullptr;
+	}
+
 	// loop over all devices; dev[0] is the highest priority
 	for (device_z80daisy_interface *intf = m_chain; intf != nullptr; intf = intf->m_daisy_next)
 	{
@@ -194,6 +277,15 @@ device_z80daisy_interface *z80_daisy_chain_interface::daisy_get_irq_device()
 
 void z80_daisy_chain_interface::daisy_call_reti_device()
 {
+	if (m_cacheable)
+	{
+		if (!m_cache_valid)
+			daisy_refresh_cache();
+		if (m_ieo_device != nullptr)
+			m_ieo_device->z80daisy_irq_reti();
+		return;
+	}
+
 	// loop over all devices; dev[0] is the highest priority
 	for (device_z80daisy_interface *intf = m_chain; intf != nullptr; intf = intf->m_daisy_next)
 	{
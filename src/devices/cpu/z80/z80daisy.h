@@ -51,6 +51,8 @@ struct z80_daisy_config
 
 // ======================> device_z80daisy_interface
 
+class z80_daisy_chain_interface;
+
 class device_z80daisy_interface : public device_interface
 {
 	friend class z80_daisy_chain_interface;
@@ -65,8 +67,16 @@ public:
 	virtual int z80daisy_irq_ack() = 0;
 	virtual void z80daisy_irq_reti() = 0;
 
+protected:
+	// devices that call z80daisy_irq_state_changed() whenever the result of
+	// z80daisy_irq_state() may have changed let their chain cache its state
+	void z80daisy_set_reports_changes() { m_daisy_reports_changes = true; }
+	inline void z80daisy_irq_state_changed();
+
 private:
 	device_z80daisy_interface *m_daisy_next;    // next device in the chain
+	z80_daisy_chain_interface *m_daisy_chain;   // chain we are part of
+	bool m_daisy_reports_changes;               // we call z80daisy_irq_state_changed()
 };
 
 
@@ -75,6 +85,8 @@ private:
 
 class z80_daisy_chain_interface : public device_interface
 {
+	friend class device_z80daisy_interface;
+
 public:
 	// construction/destruction
 	z80_daisy_chain_interface(const machine_config &mconfig, device_t &device);
@@ -91,6 +103,7 @@ protected:
 	// interface-level overrides
 	virtual void interface_post_start() override;
 	virtual void interface_post_reset() override;
+	virtual void interface_post_load() override;
 
 	// initialization
 	void daisy_init(const z80_daisy_config *daisy);
@@ -101,9 +114,34 @@ protected:
 	void daisy_call_reti_device();
 
 private:
+	void daisy_refresh_cache();
+
 	const z80_daisy_config *m_daisy_config;
 	device_z80daisy_interface *m_chain;     // head of the daisy chain
+
+	// cached chain state, used when every device reports its changes
+	bool m_cacheable;                       // every device in the chain reports changes
+	bool m_cache_valid;                     // cached state matches the devices
+	device_z80daisy_interface *m_int_device; // first device requesting an interrupt
+	device_z80daisy_interface *m_ieo_device; // first device with an interrupt under service
+	int m_irq_line;                         // resulting state of the INT line
 };
 
 
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  z80daisy_irq_state_changed - tell the chain to
+//  poll this device again
+//-------------------------------------------------
+
+inline void device_z80daisy_interface::z80daisy_irq_state_changed()
+{
+	if (m_daisy_chain != nullptr)
+		m_daisy_chain->m_cache_valid = false;
+}
+
+
 #endif
@@ -11,6 +11,7 @@
 #include "emu.h"
 #include "cdrom.h"
 #include "chd_cd.h"
+#include "emuopts.h"
 
 // device type definition
 const device_type CDROM = &device_creator<cdrom_image_device>;
@@ -101,6 +102,8 @@ image_init_result cdrom_image_device::call_load()
 			if ( err )
 				goto error;
 			chd = &m_self_chd;
+			if (device().machine().options().chd_readahead() > 0)
+				m_self_chd.enable_read_ahead(device().machine().options().chd_readahead());
 		}
 	} else {
 		chd = device().machine().rom_load().get_disk_handle(device().subtag("cdrom").c_str());
@@ -177,6 +177,7 @@ floppy_image_device::floppy_image_device(const machine_config &mconfig, device_t
 		device_slot_card_interface(mconfig, *this),
 		input_format(nullptr),
 		output_format(nullptr),
+		output_in_place(false),
 		image(nullptr),
 		fif_list(nullptr),
 		index_timer(nullptr),
@@ -286,11 +287,13 @@ void floppy_image_device::set_rpm(float _rpm)
 	rpm = _rpm;
 	rev_time = attotime::from_double(60/rpm);
 	floppy_ratio_1 = int(1000.0f*rpm/300.0f+0.5f);
+	tcache.valid = false;
 }
 
 void floppy_image_device::setup_write(floppy_image_format_t *_output_format)
 {
 	output_format = _output_format;
+	output_in_place = false;
 	commit_image();
 }
 
@@ -305,11 +308,22 @@ void floppy_image_device::commit_image()
 	io.procs = &image_ioprocs;
 	io.filler = 0xff;
 
+	// a file the format already laid out only needs the tracks written to since
+	if(output_in_place && output_format->save_modified(&io, image)) {
+		image->clear_dirty_tracks();
+		return;
+	}
+
+	// everything gets rewritten, so read any track still waiting on the file first
+	image->load_all_tracks();
+
 	osd_file::error err = image_core_file().truncate(0);
 	if (err != osd_file::error::NONE)
 		popmessage("Error, unable to truncate image: %d", int(err));
 
 	output_format->save(&io, image);
+	image->clear_dirty_tracks();
+	output_in_place = true;
 }
 
 //-------------------------------------------------
@@ -336,6 +350,7 @@ void floppy_image_device::device_start()
 	dskchg = exists() ? 1 : 0;
 	index_timer = timer_alloc(0);
 	image_dirty = false;
+	tcache.valid = false;
 	ready = true;
 	ready_counter = 0;
 
@@ -434,6 +449,8 @@ image_init_result floppy_image_device::call_load()
 		return image_init_result::FAIL;
 	}
 	output_format = is_readonly() ? nullptr : best_format;
+	output_in_place = true;
+	tcache.valid = false;
 
 	revolution_start_time = mon ? attotime::never : machine().time();
 	revolution_count = 0;
@@ -473,6 +490,7 @@ void floppy_image_device::call_unload()
 			commit_image();
 		global_free(image);
 		image = nullptr;
+		tcache.valid = false;
 	}
 
 	wpt = 1; // disk sleeve is covering the sensor
@@ -500,6 +518,8 @@ image_init_result floppy_image_device::call_create(int format_type, util::option
 {
 	image = global_alloc(floppy_image(tracks, sides, form_factor));
 	output_format = nullptr;
+	output_in_place = false;
+	tcache.valid = false;
 
 	// search for a suitable format based on the extension
 	for(floppy_image_format_t *i = fif_list; i; i = i->next)
@@ -733,6 +753,20 @@ int floppy_image_device::find_index(uint32_t position, const std::vector<uint32_
 	}
 }
 
+// find_index starting from a guess, normally the previous transition
+// looked up; the controllers walk forward a transition or two at a time
+int floppy_image_device::find_index(uint32_t position, const std::vector<uint32_t> &buf, int hint)
+{
+	int cells = buf.size();
+	for(int spos = hint; spos > 0 && spos < cells-1 && spos <= hint+2; spos++) {
+		if((buf[spos] & floppy_image::TIME_MASK) > position)
+			break;
+		if((buf[spos+1] & floppy_image::TIME_MASK) > position)
+			return spos;
+	}
+	return find_index(position, buf);
+}
+
 uint32_t floppy_image_device::find_position(attotime &base, const attotime &when)
 {
 	base = revolution_start_time;
@@ -778,6 +812,10 @@ attotime floppy_image_device::get_next_transition(const attotime &from_when)
 	if (ready_counter > 0)
 		return attotime::never;
 
+	bool same_track = tcache.valid && tcache.cyl == cyl && tcache.subcyl == subcyl && tcache.ss == ss && tcache.revolution_start_time == revolution_start_time;
+	if(same_track && from_when >= tcache.from && from_when < tcache.edge)
+		return tcache.edge;
+
 	std::vector<uint32_t> &buf = image->get_buffer(cyl, ss, subcyl);
 	uint32_t cells = buf.size();
 	if(cells <= 1)
@@ -786,15 +824,25 @@ attotime floppy_image_device::get_next_transition(const attotime &from_when)
 	attotime base;
 	uint32_t position = find_position(base, from_when);
 
-	int index = find_index(position, buf);
+	int index = same_track ? find_index(position, buf, tcache.index) : find_index(position, buf);
 
 	if(index == -1)
 		return attotime::never;
 
 	attotime result = get_next_index_time(buf, index, 1,  base);
-	if(result > from_when)
-		return result;
-	return get_next_index_time(buf, index, 2,  base);
+	if(result <= from_when)
+		result = get_next_index_time(buf, index, 2,  base);
+
+	tcache.valid = true;
+	tcache.cyl = cyl;
+	tcache.subcyl = subcyl;
+	tcache.ss = ss;
+	tcache.revolution_start_time = revolution_start_time;
+	tcache.from = from_when;
+	tcache.edge = result;
+	tcache.index = index;
+
+	return result;
 }
 
 void floppy_image_device::write_flux(const attotime &start, const attotime &end, int transition_count, const attotime *transitions)
@@ -802,6 +850,8 @@ void floppy_image_device::write_flux(const attotime &start, const attotime &end,
 	if(!image || mon)
 		return;
 	image_dirty = true;
+	image->set_track_dirty(cyl, ss, subcyl);
+	tcache.valid = false;
 
 	attotime base;
 	int start_pos = find_position(base, start);
@@ -956,6 +1006,7 @@ void floppy_image_device::set_write_splice(const attotime &when)
 {
 	if(image) {
 		image_dirty = true;
+		image->set_track_dirty(cyl, ss, subcyl);
 		attotime base;
 		int splice_pos = find_position(base, when);
 		image->set_write_splice_position(cyl, ss, splice_pos, subcyl);
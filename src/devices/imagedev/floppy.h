@@ -153,6 +153,7 @@ protected:
 
 	floppy_image_format_t *input_format;
 	floppy_image_format_t *output_format;
+	bool                  output_in_place; // the file is laid out by output_format, so dirty tracks can be rewritten alone
 	floppy_image          *image;
 	char                  extension_list[256];
 	floppy_image_format_t *fif_list;
@@ -191,6 +192,16 @@ protected:
 	bool image_dirty;
 	int ready_counter;
 
+	// last get_next_transition answer; controllers ask once per bit cell,
+	// so most calls fall before the same transition as the previous one
+	struct transition_cache {
+		bool valid;
+		int cyl, subcyl, ss;
+		attotime revolution_start_time;
+		attotime from, edge;    // any time in [from, edge) has edge as its next transition
+		int index;              // last cell at or before 'from'
+	} tcache;
+
 	load_cb cur_load_cb;
 	unload_cb cur_unload_cb;
 	index_pulse_cb cur_index_pulse_cb;
@@ -199,6 +210,7 @@ protected:
 
 	uint32_t find_position(attotime &base, const attotime &when);
 	int find_index(uint32_t position, const std::vector<uint32_t> &buf);
+	int find_index(uint32_t position, const std::vector<uint32_t> &buf, int hint);
 	void write_zone(uint32_t *buf, int &cells, int &index, uint32_t spos, uint32_t epos, uint32_t mg);
 	void commit_image();
 	attotime get_next_index_time(std::vector<uint32_t> &buf, int index, int delta, attotime base);
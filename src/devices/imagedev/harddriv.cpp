@@ -108,6 +108,20 @@ void harddisk_image_device::device_start()
 	{
 		m_hard_disk_handle = nullptr;
 	}
+
+	// writes are written back in the background; a state must not get ahead of the disk
+	machine().save().register_presave(save_prepost_delegate(FUNC(harddisk_image_device::presave), this));
+}
+
+//-------------------------------------------------
+//  presave - make sure every write has reached
+//  the CHD before a state is saved
+//-------------------------------------------------
+
+void harddisk_image_device::presave()
+{
+	if (m_hard_disk_handle != nullptr)
+		hard_disk_flush(m_hard_disk_handle);
 }
 
 void harddisk_image_device::device_stop()
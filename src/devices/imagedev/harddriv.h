@@ -62,6 +62,7 @@ protected:
 	virtual void device_stop() override;
 
 	image_init_result internal_load_hd();
+	void presave();
 
 	chd_file        *m_chd;
 	chd_file        m_origchd;              /* handle to the original CHD */
@@ -34,6 +34,11 @@ public:
 	virtual DECLARE_WRITE_LINE_MEMBER(write_dasp) = 0;
 	virtual DECLARE_WRITE_LINE_MEMBER(write_pdiag) = 0;
 
+	// bulk DMA: AND up to 'words' words into the buffer, or take them from
+	// it, and return how many were moved; 0 means use read_dma/write_dma
+	virtual int read_dma_block(uint16_t *buffer, int words) { return 0; }
+	virtual int write_dma_block(const uint16_t *buffer, int words) { return 0; }
+
 	devcb_write_line m_irq_handler;
 	devcb_write_line m_dmarq_handler;
 	devcb_write_line m_dasp_handler;
@@ -585,6 +585,31 @@ uint16_t ata_hle_device::read_dma()
 	return result;
 }
 
+// how many words of a bulk DMA transfer can come from or go to the current
+// buffer; single word DMA toggles DMARQ for every word, so it never qualifies
+int ata_hle_device::dma_block_words(int words)
+{
+	if (!device_selected() || !m_dmack || !m_dmarq || single_word_dma_mode() >= 0 || m_8bit_data_transfers ||
+		(m_status & IDE_STATUS_BSY) || !(m_status & IDE_STATUS_DRQ) || m_buffer_offset >= m_buffer_size)
+		return 0;
+
+	return std::min(words, (m_buffer_size - m_buffer_offset + 1) / 2);
+}
+
+int ata_hle_device::read_dma_block(uint16_t *buffer, int words)
+{
+	int count = dma_block_words(words);
+	if (count == 0)
+		return 0;
+
+	// the last word goes through read_data so the end of the buffer is handled as usual
+	for (int i = 0; i < count - 1; i++, m_buffer_offset += 2)
+		buffer[i] &= m_buffer[m_buffer_offset] | (m_buffer[m_buffer_offset + 1] << 8);
+	buffer[count - 1] &= read_data();
+
+	return count;
+}
+
 READ16_MEMBER( ata_hle_device::read_cs0 )
 {
 	/* logit */
@@ -807,6 +832,23 @@ void ata_hle_device::write_dma( uint16_t data )
 	}
 }
 
+int ata_hle_device::write_dma_block(const uint16_t *buffer, int words)
+{
+	int count = dma_block_words(words);
+	if (count == 0)
+		return 0;
+
+	// the last word goes through write_data so a full buffer is handled as usual
+	for (int i = 0; i < count - 1; i++)
+	{
+		m_buffer[m_buffer_offset++] = buffer[i];
+		m_buffer[m_buffer_offset++] = buffer[i] >> 8;
+	}
+	write_data(buffer[count - 1]);
+
+	return count;
+}
+
 WRITE16_MEMBER( ata_hle_device::write_cs0 )
 {
 	/* logit */
@@ -25,6 +25,8 @@ public:
 	virtual DECLARE_READ16_MEMBER(read_cs1) override;
 
 	virtual void write_dma(uint16_t data) override;
+	virtual int read_dma_block(uint16_t *buffer, int words) override;
+	virtual int write_dma_block(const uint16_t *buffer, int words) override;
 	virtual DECLARE_WRITE16_MEMBER(write_cs0) override;
 	virtual DECLARE_WRITE16_MEMBER(write_cs1) override;
 	virtual DECLARE_WRITE_LINE_MEMBER(write_csel) override;
@@ -66,6 +68,7 @@ protected:
 
 	int bit_to_mode(uint16_t word);
 	int single_word_dma_mode();
+	int dma_block_words(int words);
 	int multi_word_dma_mode();
 	int ultra_dma_mode();
 
@@ -133,6 +133,25 @@ uint16_t ata_interface_device::read_dma()
 	return result;
 }
 
+int ata_interface_device::read_dma_block(uint16_t *buffer, int words)
+{
+	std::fill_n(buffer, words, 0xffff);
+
+	int result = 0;
+	for (auto & elem : m_slot)
+		if (elem->dev() != nullptr)
+			result = std::max(result, elem->dev()->read_dma_block(buffer, words));
+
+	// nobody could move a block, so go a word at a time
+	if (result == 0)
+	{
+		buffer[0] = read_dma();
+		result = 1;
+	}
+
+	return result;
+}
+
 READ16_MEMBER( ata_interface_device::read_cs0 )
 {
 	uint16_t result = mem_mask;
@@ -175,6 +194,23 @@ void ata_interface_device::write_dma( uint16_t data )
 			elem->dev()->write_dma(data);
 }
 
+int ata_interface_device::write_dma_block(const uint16_t *buffer, int words)
+{
+	int result = 0;
+	for (auto & elem : m_slot)
+		if (elem->dev() != nullptr)
+			result = std::max(result, elem->dev()->write_dma_block(buffer, words));
+
+	// nobody could take a block, so go a word at a time
+	if (result == 0)
+	{
+		write_dma(buffer[0]);
+		result = 1;
+	}
+
+	return result;
+}
+
 WRITE16_MEMBER( ata_interface_device::write_cs0 )
 {
 //  printf( "%s: write cs0 %04x %04x %04x\n", machine().describe_context(), offset, data, mem_mask );
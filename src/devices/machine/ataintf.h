@@ -89,6 +89,8 @@ public:
 	virtual DECLARE_READ16_MEMBER(read_cs1);
 
 	void write_dma(uint16_t data);
+	int read_dma_block(uint16_t *buffer, int words);
+	int write_dma_block(const uint16_t *buffer, int words);
 	virtual DECLARE_WRITE16_MEMBER(write_cs0);
 	virtual DECLARE_WRITE16_MEMBER(write_cs1);
 	DECLARE_WRITE_LINE_MEMBER(write_dmack);
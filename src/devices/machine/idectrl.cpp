@@ -329,8 +329,29 @@ WRITE32_MEMBER( bus_master_ide_controller_device::bmdma_w )
 	}
 }
 
+// a host pointer to the next 'bytes' bytes of DMA memory, if they are plain
+// little-endian RAM in one piece, so a block can be copied with memcpy
+uint8_t *bus_master_ide_controller_device::dma_ram_pointer(uint32_t bytes, bool write)
+{
+	if (ENDIANNESS_NATIVE != ENDIANNESS_LITTLE || m_dma_space->endianness() != ENDIANNESS_LITTLE || bytes == 0)
+		return nullptr;
+
+	offs_t last = m_dma_address + bytes - 1;
+	if (last < m_dma_address)
+		return nullptr;
+
+	uint8_t *first = reinterpret_cast<uint8_t *>(write ? m_dma_space->get_write_ptr(m_dma_address) : m_dma_space->get_read_ptr(m_dma_address));
+	uint8_t *end = reinterpret_cast<uint8_t *>(write ? m_dma_space->get_write_ptr(last) : m_dma_space->get_read_ptr(last));
+	if (first == nullptr || end != first + (bytes - 1))
+		return nullptr;
+
+	return first;
+}
+
 void bus_master_ide_controller_device::execute_dma()
 {
+	uint16_t buffer[256];
+
 	write_dmack(ASSERT_LINE);
 
 	while (m_dmarq && (m_bus_master_status & IDE_BUSMASTER_STATUS_ACTIVE))
@@ -358,26 +379,49 @@ void bus_master_ide_controller_device::execute_dma()
 //          LOG(("New DMA descriptor: address = %08X  bytes = %04X  last = %d\n", m_dma_address, m_dma_bytes_left, m_dma_last_buffer));
 		}
 
+		// move up to a sector at a time; the device stops early at the end of its buffer
+		int words = std::min<uint32_t>(m_dma_bytes_left / 2, ARRAY_LENGTH(buffer));
+		uint32_t bytes;
+
 		if (m_bus_master_command & 8)
 		{
 			// read from ata bus
-			uint16_t data = read_dma();
+			words = read_dma_block(buffer, words);
+			bytes = words * 2;
 
 			// write to memory
-			m_dma_space->write_byte(m_dma_address++, data & 0xff);
-			m_dma_space->write_byte(m_dma_address++, data >> 8);
+			uint8_t *dest = dma_ram_pointer(bytes, true);
+			if (dest != nullptr)
+				memcpy(dest, buffer, bytes);
+			else
+			{
+				for (int i = 0; i < words; i++)
+				{
+					m_dma_space->write_byte(m_dma_address + i * 2, buffer[i] & 0xff);
+					m_dma_space->write_byte(m_dma_address + i * 2 + 1, buffer[i] >> 8);
+				}
+			}
 		}
 		else
 		{
-			// read from memory;
-			uint16_t data = m_dma_space->read_byte(m_dma_address++);
-			data |= m_dma_space->read_byte(m_dma_address++) << 8;
+			// read from memory
+			bytes = words * 2;
+			const uint8_t *src = dma_ram_pointer(bytes, false);
+			if (src != nullptr)
+				memcpy(buffer, src, bytes);
+			else
+			{
+				for (int i = 0; i < words; i++)
+					buffer[i] = m_dma_space->read_byte(m_dma_address + i * 2) | (m_dma_space->read_byte(m_dma_address + i * 2 + 1) << 8);
+			}
 
-			// write to ata bus
-			write_dma(data);
+			// write to ata bus; words it didn't take are read again next time round
+			words = write_dma_block(buffer, words);
+			bytes = words * 2;
 		}
 
-		m_dma_bytes_left -= 2;
+		m_dma_address += bytes;
+		m_dma_bytes_left -= bytes;
 
 		if (m_dma_bytes_left == 0 && m_dma_last_buffer)
 		{
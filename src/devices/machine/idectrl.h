@@ -99,6 +99,7 @@ protected:
 
 private:
 	void execute_dma();
+	uint8_t *dma_ram_pointer(uint32_t bytes, bool write);
 
 	const char *m_bmcpu;
 	uint32_t m_bmspace;
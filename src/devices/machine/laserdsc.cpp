@@ -72,6 +72,8 @@ laserdisc_device::laserdisc_device(const machine_config &mconfig, device_type ty
 		m_readresult(CHDERR_NONE),
 		m_chdtracks(0),
 		m_work_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO)),
+		m_queued_field(nullptr),
+		m_fieldcount(0),
 		m_audiosquelch(0),
 		m_videosquelch(0),
 		m_fieldnum(0),
@@ -98,6 +100,19 @@ laserdisc_device::laserdisc_device(const machine_config &mconfig, device_type ty
 	m_orig_config.m_overposx = m_orig_config.m_overposy = 0.0f;
 	m_orig_config.m_overscalex = m_orig_config.m_overscaley = 1.0f;
 	*static_cast<laserdisc_overlay_config *>(this) = m_orig_config;
+
+	m_prevhunk[0] = m_prevhunk[1] = 0;
+	memset(&m_decode_stats, 0, sizeof(m_decode_stats));
+	for (auto & field : m_prefetch)
+	{
+		field.m_device = this;
+		field.m_osd = nullptr;
+		field.m_hunknum = ~0;
+		field.m_result = CHDERR_NONE;
+		field.m_samples = 0;
+		field.m_lastuse = 0;
+		field.m_decodeticks = 0;
+	}
 }
 
 
@@ -334,6 +349,20 @@ void laserdisc_device::device_stop()
 	// make sure all async operations have completed
 	if (m_disc != nullptr)
 		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+	for (auto & field : m_prefetch)
+		if (field.m_osd != nullptr)
+		{
+			osd_work_item_release(field.m_osd);
+			field.m_osd = nullptr;
+		}
+
+	// report how well the decoder kept up
+	if (m_decode_stats.fields != 0)
+		osd_printf_verbose("%s: %u fields, %u ready in time, %u stalls (%.1f ms total), decode avg %.2f ms max %.2f ms\n",
+				tag(), uint32_t(m_decode_stats.fields), uint32_t(m_decode_stats.hits), uint32_t(m_decode_stats.stalls),
+				1000.0 * m_decode_stats.stall_ticks / osd_ticks_per_second(),
+				1000.0 * m_decode_stats.decode_ticks / osd_ticks_per_second() / m_decode_stats.fields,
+				1000.0 * m_decode_stats.max_decode_ticks / osd_ticks_per_second());
 
 	// free any textures and palettes
 	if (m_videotex != nullptr)
@@ -818,6 +847,10 @@ void laserdisc_device::init_video()
 		frame.m_visbitmap.set_palette(m_videopalette);
 	}
 
+	// allocate fields for decoding ahead
+	for (auto & field : m_prefetch)
+		field.m_bitmap.allocate(m_width, m_height);
+
 	// allocate an empty frame of the same size
 	m_emptyframe.allocate(m_width, m_height * 2);
 	m_emptyframe.set_palette(m_videopalette);
@@ -873,6 +906,11 @@ void laserdisc_device::init_audio()
 	m_audiobufsize = m_audiomaxsamples * 4;
 	m_audiobuffer[0].resize(m_audiobufsize);
 	m_audiobuffer[1].resize(m_audiobufsize);
+	for (auto & field : m_prefetch)
+	{
+		field.m_audio[0].resize(m_audiomaxsamples);
+		field.m_audio[1].resize(m_audiomaxsamples);
+	}
 }
 
 
@@ -1057,18 +1095,107 @@ void laserdisc_device::read_track_data()
 		m_metadata[m_fieldnum].line17 = m_metadata[m_fieldnum].line18 = m_metadata[m_fieldnum].line1718 = VBI_CODE_LEADIN;
 	}
 
-	// configure the codec and then read
+	// find or start decoding this field, then decode the fields we expect to
+	// need next: each field parity is assumed to keep moving the way it did
+	// over the last two fields, which covers play, still, step and scan
 	m_readresult = CHDERR_FILE_NOT_FOUND;
+	m_queued_field = nullptr;
 	if (m_disc != nullptr && !m_videosquelch)
 	{
-		m_readresult = m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &m_avhuff_config);
-		if (m_readresult == CHDERR_NONE)
+		uint32_t wanted[PREFETCH_FIELDS - 1];
+		int32_t stride = int32_t(readhunk) - int32_t(m_prevhunk[1]);
+		int numwanted = 0;
+		wanted[numwanted++] = readhunk;
+		for (int ahead = 1; numwanted < ARRAY_LENGTH(wanted); ahead++)
 		{
-			m_queued_hunknum = readhunk;
+			int32_t base = (ahead & 1) ? m_prevhunk[0] : readhunk;
+			int32_t hunk = base + stride * ((ahead + 1) / 2);
+			wanted[numwanted++] = std::min<int32_t>(std::max<int32_t>(hunk, 0), m_chdtracks * 2 - 1);
+		}
+
+		m_queued_field = find_prefetch(readhunk);
+		if (m_queued_field == nullptr)
+			m_queued_field = queue_prefetch(readhunk, wanted, numwanted);
+		if (m_queued_field != nullptr)
+		{
+			m_queued_field->m_lastuse = m_fieldcount;
 			m_readresult = CHDERR_OPERATION_PENDING;
-			osd_work_item_queue(m_work_queue, read_async_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
 		}
+		for (int index = 1; index < numwanted; index++)
+		{
+			prefetch_field *field = find_prefetch(wanted[index]);
+			if (field == nullptr && (field = queue_prefetch(wanted[index], wanted, numwanted)) != nullptr)
+				m_decode_stats.prefetches++;
+			if (field != nullptr)
+				field->m_lastuse = m_fieldcount;
+		}
+	}
+	m_prevhunk[1] = m_prevhunk[0];
+	m_prevhunk[0] = readhunk;
+	m_fieldcount++;
+}
+
+
+//-------------------------------------------------
+//  find_prefetch - return the field holding or
+//  decoding the given hunk, if any
+//-------------------------------------------------
+
+laserdisc_device::prefetch_field *laserdisc_device::find_prefetch(uint32_t hunknum)
+{
+	for (auto & field : m_prefetch)
+		if (field.m_hunknum == hunknum)
+			return &field;
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  queue_prefetch - start decoding a hunk into
+//  the least recently wanted idle field
+//-------------------------------------------------
+
+laserdisc_device::prefetch_field *laserdisc_device::queue_prefetch(uint32_t hunknum, const uint32_t *wanted, int numwanted)
+{
+	prefetch_field *victim = nullptr;
+	for (auto & field : m_prefetch)
+	{
+		// skip fields still decoding or that we want to keep
+		if (prefetch_busy(field) || std::find(wanted, wanted + numwanted, field.m_hunknum) != wanted + numwanted)
+			continue;
+		if (victim == nullptr || field.m_lastuse < victim->m_lastuse)
+			victim = &field;
+	}
+	if (victim == nullptr)
+		return nullptr;
+
+	victim->m_hunknum = hunknum;
+	victim->m_result = CHDERR_OPERATION_PENDING;
+	victim->m_osd = osd_work_item_queue(m_work_queue, read_async_static, victim, 0);
+	if (victim->m_osd == nullptr)
+	{
+		victim->m_hunknum = ~0;
+		return nullptr;
 	}
+	return victim;
+}
+
+
+//-------------------------------------------------
+//  prefetch_busy - return true if a field is
+//  still being decoded, releasing the work item
+//  once it is done
+//-------------------------------------------------
+
+bool laserdisc_device::prefetch_busy(prefetch_field &field)
+{
+	if (field.m_osd == nullptr)
+		return false;
+	if (!osd_work_item_wait(field.m_osd, 0))
+		return true;
+	osd_work_item_release(field.m_osd);
+	field.m_osd = nullptr;
+	return false;
 }
 
 
@@ -1079,8 +1206,24 @@ void laserdisc_device::read_track_data()
 
 void *laserdisc_device::read_async_static(void *param, int threadid)
 {
-	laserdisc_device &ld = *reinterpret_cast<laserdisc_device *>(param);
-	ld.m_readresult = ld.m_disc->read_hunk(ld.m_queued_hunknum, nullptr);
+	prefetch_field &field = *reinterpret_cast<prefetch_field *>(param);
+	laserdisc_device &ld = *field.m_device;
+	osd_ticks_t start = osd_ticks();
+
+	// only this thread touches the disc while we're running, so configure the
+	// codec for this field's buffers and read
+	avhuff_decompress_config config;
+	config.video.wrap(&field.m_bitmap.pix16(0), field.m_bitmap.width(), field.m_bitmap.height(), field.m_bitmap.rowpixels());
+	config.audio[0] = &field.m_audio[0][0];
+	config.audio[1] = &field.m_audio[1][0];
+	config.maxsamples = ld.m_audiomaxsamples;
+	config.actsamples = &field.m_samples;
+	field.m_samples = 0;
+	chd_error result = ld.m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &config);
+	if (result == CHDERR_NONE)
+		result = ld.m_disc->read_hunk(field.m_hunknum, nullptr);
+	field.m_result = result;
+	field.m_decodeticks = osd_ticks() - start;
 	return nullptr;
 }
 
@@ -1092,10 +1235,40 @@ void *laserdisc_device::read_async_static(void *param, int threadid)
 
 void laserdisc_device::process_track_data()
 {
-	// wait for the async operation to complete
-	if (m_readresult == CHDERR_OPERATION_PENDING)
-		osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
-	assert(m_readresult != CHDERR_OPERATION_PENDING);
+	// wait for the field to finish decoding, then copy it into the frame
+	if (m_queued_field != nullptr)
+	{
+		prefetch_field &field = *m_queued_field;
+		m_decode_stats.fields++;
+		if (prefetch_busy(field))
+		{
+			osd_ticks_t start = osd_ticks();
+			osd_work_item_wait(field.m_osd, osd_ticks_per_second() * 10);
+			prefetch_busy(field);
+			m_decode_stats.stalls++;
+			m_decode_stats.stall_ticks += osd_ticks() - start;
+		}
+		else
+			m_decode_stats.hits++;
+		m_decode_stats.decode_ticks += field.m_decodeticks;
+		m_decode_stats.max_decode_ticks = std::max(m_decode_stats.max_decode_ticks, field.m_decodeticks);
+
+		m_readresult = field.m_result;
+		if (m_readresult == CHDERR_NONE)
+		{
+			bitmap_yuy16 &dest = m_avhuff_config.video;
+			for (int y = 0; y < dest.height(); y++)
+				memcpy(&dest.pix16(y), &field.m_bitmap.pix16(y), dest.width() * 2);
+			m_audiocursamples = std::min(field.m_samples, m_audiomaxsamples);
+			for (int chnum = 0; chnum < 2; chnum++)
+				memcpy(m_avhuff_config.audio[chnum], &field.m_audio[chnum][0], m_audiocursamples * 2);
+		}
+
+		// a failed read is retried the next time the hunk is wanted
+		else
+			field.m_hunknum = ~0;
+		m_queued_field = nullptr;
+	}
 
 	// remove the video if we had an error
 	if (m_readresult != CHDERR_NONE)
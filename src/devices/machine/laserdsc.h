@@ -144,12 +144,25 @@ protected:
 	virtual ~laserdisc_device();
 
 public:
+	// field decode statistics
+	struct decode_statistics
+	{
+		uint64_t            fields;                 // fields consumed from the disc
+		uint64_t            hits;                   // fields already decoded when needed
+		uint64_t            stalls;                 // fields we had to wait for
+		uint64_t            prefetches;             // fields decoded ahead of time
+		osd_ticks_t         stall_ticks;            // total time spent waiting
+		osd_ticks_t         decode_ticks;           // total time spent decoding
+		osd_ticks_t         max_decode_ticks;       // longest single field decode
+	};
+
 	// reset line control
 
 	// core control and status
 	bool video_active() { return (!m_videosquelch && current_frame().m_numfields >= 2); }
 	bitmap_yuy16 &get_video() { return (!video_active()) ? m_emptyframe : current_frame().m_visbitmap; }
 	uint32_t get_field_code(laserdisc_field_code code, bool zero_if_squelched);
+	const decode_statistics &decode_stats() const { return m_decode_stats; }
 
 	// video interface
 	void video_enable(bool enable) { m_videoenable = enable; }
@@ -274,6 +287,23 @@ private:
 		int32_t               m_lastfield;            // last absolute field number
 	};
 
+	// a field decoded on the work queue
+	struct prefetch_field
+	{
+		laserdisc_device *  m_device;               // owning device
+		osd_work_item *     m_osd;                  // work item decoding this field, or nullptr
+		uint32_t              m_hunknum;              // hunk held (or being decoded) here
+		chd_error           m_result;               // result of the read
+		bitmap_yuy16        m_bitmap;               // decoded field
+		std::vector<int16_t>       m_audio[2];             // decoded audio samples
+		uint32_t              m_samples;              // number of audio samples
+		uint64_t              m_lastuse;              // field counter when last wanted
+		osd_ticks_t         m_decodeticks;          // time taken to decode
+	};
+
+	// fields decoded ahead of the player; one is consumed per VBI
+	static const int PREFETCH_FIELDS = 8;
+
 	// internal helpers
 	void init_disc();
 	void init_video();
@@ -286,6 +316,9 @@ private:
 	void read_track_data();
 	static void *read_async_static(void *param, int threadid);
 	void process_track_data();
+	prefetch_field *find_prefetch(uint32_t hunknum);
+	prefetch_field *queue_prefetch(uint32_t hunknum, const uint32_t *wanted, int numwanted);
+	bool prefetch_busy(prefetch_field &field);
 	void config_load(config_type cfg_type, util::xml::data_node const *parentnode);
 	void config_save(config_type cfg_type, util::xml::data_node *parentnode);
 
@@ -312,7 +345,11 @@ private:
 
 	// async operations
 	osd_work_queue *    m_work_queue;           // work queue
-	uint32_t              m_queued_hunknum;       // queued hunk
+	prefetch_field      m_prefetch[PREFETCH_FIELDS]; // fields decoded or being decoded
+	prefetch_field *    m_queued_field;         // field the current VBI will consume
+	uint32_t              m_prevhunk[2];          // hunks read for the previous two fields
+	uint64_t              m_fieldcount;           // fields read so far
+	decode_statistics   m_decode_stats;         // decode statistics
 
 	// core states
 	uint8_t               m_audiosquelch;         // audio squelch state: bit 0 = audio 1, bit 1 = audio 2
@@ -768,6 +768,7 @@ netlist_mame_device_t::netlist_mame_device_t(const machine_config &mconfig, cons
 		m_icount(0),
 		m_old(netlist::netlist_time::zero()),
 		m_netlist(nullptr),
+		m_state_schema(0),
 		m_setup_func(nullptr)
 {
 }
@@ -777,6 +778,7 @@ netlist_mame_device_t::netlist_mame_device_t(const machine_config &mconfig, devi
 		m_icount(0),
 		m_old(netlist::netlist_time::zero()),
 		m_netlist(nullptr),
+		m_state_schema(0),
 		m_setup_func(nullptr)
 {
 }
@@ -879,6 +881,10 @@ ATTR_COLD void netlist_mame_device_t::device_post_load()
 {
 	LOG_DEV_CALLS(("device_post_load\n"));
 
+	if (m_state_schema != netlist().state().schema())
+		netlist().log().fatal("Saved state does not match netlist\n");
+	if (!m_state_buf.empty())
+		netlist().state().unpack(m_state_buf.data());
 	netlist().state().post_load();
 	netlist().rebuild_lists();
 }
@@ -888,6 +894,8 @@ ATTR_COLD void netlist_mame_device_t::device_pre_save()
 	LOG_DEV_CALLS(("device_pre_save\n"));
 
 	netlist().state().pre_save();
+	if (!m_state_buf.empty())
+		netlist().state().pack(m_state_buf.data());
 }
 
 void netlist_mame_device_t::device_timer(emu_timer &timer, device_timer_id id, int param, void *ptr)
@@ -912,42 +920,16 @@ void netlist_mame_device_t::check_mame_abort_slice()
 
 ATTR_COLD void netlist_mame_device_t::save_state()
 {
-	for (auto const & s : netlist().state().save_list())
-	{
-		netlist().log().debug("saving state for {1}\n", s->m_name.c_str());
-		if (s->m_dt.is_float)
-		{
-			if (s->m_dt.size == sizeof(double))
-				save_pointer((double *) s->m_ptr, s->m_name.c_str(), s->m_count);
-			else if (s->m_dt.size == sizeof(float))
-				save_pointer((float *) s->m_ptr, s->m_name.c_str(), s->m_count);
-			else
-				netlist().log().fatal("Unknown floating type for {1}\n", s->m_name.c_str());
-		}
-		else if (s->m_dt.is_integral)
-		{
-			if (s->m_dt.size == sizeof(int64_t))
-				save_pointer((int64_t *) s->m_ptr, s->m_name.c_str(), s->m_count);
-			else if (s->m_dt.size == sizeof(int32_t))
-				save_pointer((int32_t *) s->m_ptr, s->m_name.c_str(), s->m_count);
-			else if (s->m_dt.size == sizeof(int16_t))
-				save_pointer((int16_t *) s->m_ptr, s->m_name.c_str(), s->m_count);
-			else if (s->m_dt.size == sizeof(int8_t))
-				save_pointer((int8_t *) s->m_ptr, s->m_name.c_str(), s->m_count);
-#if (PHAS_INT128)
-			else if (s->m_dt.size == sizeof(INT128))
-				save_pointer((int64_t *) s->m_ptr, s->m_name.c_str(), s->m_count * 2);
-#endif
-			else
-				netlist().log().fatal("Unknown integral type size {1} for {2}\n", s->m_dt.size, s->m_name.c_str());
-		}
-		else if (s->m_dt.is_custom)
-		{
-			/* do nothing */
-		}
-		else
-			netlist().log().fatal("found unsupported save element {1}\n", s->m_name);
-	}
+	/* Registering every netlist variable with the save manager is slow for
+	 * big netlists. They are copied into one buffer in pre_save and back in
+	 * post_load instead.
+	 */
+	m_state_buf.resize(netlist().state().packed_size());
+	m_state_schema = netlist().state().schema();
+	netlist().log().debug("packed {1} state entries into {2} bytes\n", netlist().state().save_list().size(), m_state_buf.size());
+	if (!m_state_buf.empty())
+		save_item(NAME(m_state_buf));
+	save_item(NAME(m_state_schema));
 }
 
 // ----------------------------------------------------------------------------------------
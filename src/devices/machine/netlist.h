@@ -143,6 +143,10 @@ private:
 
 	netlist_mame_t *    m_netlist;
 
+	/* all netlist state, packed into one save item */
+	std::vector<u8>     m_state_buf;
+	u32                 m_state_schema;
+
 	void (*m_setup_func)(netlist::setup_t &);
 };
 
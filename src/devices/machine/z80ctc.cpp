@@ -88,6 +88,8 @@ z80ctc_device::z80ctc_device(const machine_config &mconfig, const char *tag, dev
 		m_zc3_cb(*this),
 		m_vector(0)
 {
+	// every change to the channel interrupt states goes through interrupt_check
+	z80daisy_set_reports_changes();
 }
 
 
@@ -268,6 +270,7 @@ void z80ctc_device::z80daisy_irq_reti()
 void z80ctc_device::interrupt_check()
 {
 	int state = (z80daisy_irq_state() & Z80_DAISY_INT) ? ASSERT_LINE : CLEAR_LINE;
+	z80daisy_irq_state_changed();
 	m_intr_cb(state);
 }
 
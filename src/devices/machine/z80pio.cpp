@@ -49,6 +49,8 @@ z80pio_device::z80pio_device(const machine_config &mconfig, const char *tag, dev
 	m_out_pb_cb(*this),
 	m_out_brdy_cb(*this)
 {
+	// every change to the interrupt flip-flops is followed by check_interrupts
+	z80daisy_set_reports_changes();
 }
 
 
@@ -81,6 +83,7 @@ void z80pio_device::device_reset()
 	// loop over ports
 	for (int index = PORT_A; index < PORT_COUNT; index++)
 		m_port[index].reset();
+	z80daisy_irq_state_changed();
 }
 
 
@@ -261,6 +264,7 @@ void z80pio_device::check_interrupts()
 
 	if (LOG) logerror("Z80PIO INT %u\n", state);
 
+	z80daisy_irq_state_changed();
 	m_out_int_cb(state);
 }
 
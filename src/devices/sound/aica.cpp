@@ -919,6 +919,7 @@ void aica_device::w16(address_space &space,unsigned int addr,unsigned short val)
 		else if(addr<0x3c00)
 		{
 			*((unsigned short *) (m_DSP.MPRO+(addr-0x3400)/2))=val;
+			m_DSP.Decoded=0;
 
 			if (addr == 0x3bfe)
 			{
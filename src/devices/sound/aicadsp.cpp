@@ -55,6 +55,63 @@ static int32_t UNPACK(uint16_t val)
 	return uval;
 }
 
+//unpack the program up to LastStep, dropping steps whose only result is an
+//ACC the following step overwrites without reading
+static void aica_dsp_decode(AICADSP *DSP)
+{
+	AICADSP_OP ops[128];
+	int step;
+
+	for(step=0;step<DSP->LastStep;++step)
+	{
+		uint16_t *IPtr=DSP->MPRO+step*8;
+		AICADSP_OP *op=&ops[step];
+
+		op->TRA=(IPtr[0]>>9)&0x7F;
+		op->TWT=(IPtr[0]>>8)&0x01;
+		op->TWA=(IPtr[0]>>1)&0x7F;
+		op->XSEL=(IPtr[2]>>15)&0x01;
+		op->YSEL=(IPtr[2]>>13)&0x03;
+		op->IRA=(IPtr[2]>>7)&0x3F;
+		op->IWT=(IPtr[2]>>6)&0x01;
+		op->IWA=(IPtr[2]>>1)&0x1F;
+		op->TABLE=(IPtr[4]>>15)&0x01;
+		op->MWT=(IPtr[4]>>14)&0x01;
+		op->MRD=(IPtr[4]>>13)&0x01;
+		op->EWT=(IPtr[4]>>12)&0x01;
+		op->EWA=(IPtr[4]>>8)&0x0F;
+		op->ADRL=(IPtr[4]>>7)&0x01;
+		op->FRCL=(IPtr[4]>>6)&0x01;
+		op->SHIFT=(IPtr[4]>>4)&0x03;
+		op->YRL=(IPtr[4]>>3)&0x01;
+		op->NEGB=(IPtr[4]>>2)&0x01;
+		op->ZERO=(IPtr[4]>>1)&0x01;
+		op->BSEL=(IPtr[4]>>0)&0x01;
+		op->NOFL=(IPtr[6]>>15)&1;
+		op->MASA=(IPtr[6]>>9)&0x1f;
+		op->ADREB=(IPtr[6]>>8)&0x1;
+		op->NXADR=(IPtr[6]>>7)&0x1;
+		op->COEF=step;
+		op->STEP=step;
+	}
+
+	DSP->NumOps=0;
+	for(step=0;step<DSP->LastStep;++step)
+	{
+		const AICADSP_OP *op=&ops[step];
+		bool effects=op->TWT || op->IWT || op->FRCL || op->MRD || op->MWT || op->ADRL || op->EWT || op->YRL || op->IRA>0x31;
+		if(!effects && step+1<DSP->LastStep)
+		{
+			const AICADSP_OP *next=&ops[step+1];
+			bool reads_acc=(!next->ZERO && next->BSEL) || next->TWT || next->FRCL || next->MWT || next->ADRL || next->EWT || next->IRA>0x31;
+			if(!reads_acc)
+				continue;
+		}
+		DSP->OPS[DSP->NumOps++]=*op;
+	}
+	DSP->Decoded=1;
+}
+
 void aica_dsp_init(AICADSP *DSP)
 {
 	memset(DSP,0,sizeof(AICADSP));
@@ -87,42 +144,39 @@ void aica_dsp_step(AICADSP *DSP)
 	if(dump)
 		f=fopen("dsp.txt","wt");
 #endif
-	for(step=0;step</*128*/DSP->LastStep;++step)
-	{
-		uint16_t *IPtr=DSP->MPRO+step*8;
+	if(!DSP->Decoded)
+		aica_dsp_decode(DSP);
 
-//      if(IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
-//          break;
-
-		uint32_t TRA=(IPtr[0]>>9)&0x7F;
-		uint32_t TWT=(IPtr[0]>>8)&0x01;
-		uint32_t TWA=(IPtr[0]>>1)&0x7F;
-
-		uint32_t XSEL=(IPtr[2]>>15)&0x01;
-		uint32_t YSEL=(IPtr[2]>>13)&0x03;
-		uint32_t IRA=(IPtr[2]>>7)&0x3F;
-		uint32_t IWT=(IPtr[2]>>6)&0x01;
-		uint32_t IWA=(IPtr[2]>>1)&0x1F;
-
-		uint32_t TABLE=(IPtr[4]>>15)&0x01;
-		uint32_t MWT=(IPtr[4]>>14)&0x01;
-		uint32_t MRD=(IPtr[4]>>13)&0x01;
-		uint32_t EWT=(IPtr[4]>>12)&0x01;
-		uint32_t EWA=(IPtr[4]>>8)&0x0F;
-		uint32_t ADRL=(IPtr[4]>>7)&0x01;
-		uint32_t FRCL=(IPtr[4]>>6)&0x01;
-		uint32_t SHIFT=(IPtr[4]>>4)&0x03;
-		uint32_t YRL=(IPtr[4]>>3)&0x01;
-		uint32_t NEGB=(IPtr[4]>>2)&0x01;
-		uint32_t ZERO=(IPtr[4]>>1)&0x01;
-		uint32_t BSEL=(IPtr[4]>>0)&0x01;
-
-		uint32_t NOFL=(IPtr[6]>>15)&1;        //????
-		uint32_t COEF=step;
-
-		uint32_t MASA=(IPtr[6]>>9)&0x1f;  //???
-		uint32_t ADREB=(IPtr[6]>>8)&0x1;
-		uint32_t NXADR=(IPtr[6]>>7)&0x1;
+	for(int i=0;i<DSP->NumOps;++i)
+	{
+		const AICADSP_OP *op=&DSP->OPS[i];
+		step=op->STEP;
+
+		uint32_t TRA=op->TRA;
+		uint32_t TWT=op->TWT;
+		uint32_t TWA=op->TWA;
+		uint32_t XSEL=op->XSEL;
+		uint32_t YSEL=op->YSEL;
+		uint32_t IRA=op->IRA;
+		uint32_t IWT=op->IWT;
+		uint32_t IWA=op->IWA;
+		uint32_t TABLE=op->TABLE;
+		uint32_t MWT=op->MWT;
+		uint32_t MRD=op->MRD;
+		uint32_t EWT=op->EWT;
+		uint32_t EWA=op->EWA;
+		uint32_t ADRL=op->ADRL;
+		uint32_t FRCL=op->FRCL;
+		uint32_t SHIFT=op->SHIFT;
+		uint32_t YRL=op->YRL;
+		uint32_t NEGB=op->NEGB;
+		uint32_t ZERO=op->ZERO;
+		uint32_t BSEL=op->BSEL;
+		uint32_t NOFL=op->NOFL;
+		uint32_t MASA=op->MASA;
+		uint32_t ADREB=op->ADREB;
+		uint32_t NXADR=op->NXADR;
+		uint32_t COEF=op->COEF;
 
 		int64_t v;
 
@@ -348,5 +402,6 @@ void aica_dsp_start(AICADSP *DSP)
 			break;
 	}
 	DSP->LastStep=i+1;
+	DSP->Decoded=0;
 
 }
@@ -910,6 +910,7 @@ void ay8910_device::device_start()
 	/* The envelope is pacing twice as fast for the YM2149 as for the AY-3-8910,    */
 	/* This handled by the step parameter. Consequently we use a divider of 8 here. */
 	m_channel = machine().sound().stream_alloc(*this, 0, m_streams, master_clock / 8);
+	m_channel->set_pure();
 
 	ay_set_clock(master_clock);
 	ay8910_statesave();
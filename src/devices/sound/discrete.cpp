@@ -1051,12 +1051,23 @@ void discrete_device::process(int samples)
 		(*task)->prepare_for_queue(samples);
 	}
 
-	for_each(discrete_task **, task, &task_list)
+	if (task_list.count() == 1)
+	{
+		/* a lone task has no sources to wait for, so step it right here
+		   instead of paying for a work item and a queue wait every update */
+		discrete_task *task = task_list[0];
+		while (task->process())
+			;
+	}
+	else
 	{
-		/* Fire a work item for each task */
-		osd_work_item_queue(m_queue, discrete_task::task_callback, (void *) &task_list, WORK_ITEM_FLAG_AUTO_RELEASE);
+		for_each(discrete_task **, task, &task_list)
+		{
+			/* Fire a work item for each task */
+			osd_work_item_queue(m_queue, discrete_task::task_callback, (void *) &task_list, WORK_ITEM_FLAG_AUTO_RELEASE);
+		}
+		osd_work_queue_wait(m_queue, osd_ticks_per_second()*10);
 	}
-	osd_work_queue_wait(m_queue, osd_ticks_per_second()*10);
 
 	if (m_profiling)
 	{
@@ -9,6 +9,14 @@
 #include "emu.h"
 #include "mpeg_audio.h"
 
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || (defined(_MSC_VER) && defined(PTR64))
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
 mpeg_audio::mpeg_audio(const void *_base, unsigned int _accepted, bool lsb_first, int _position_align)
 {
 	base = (const uint8_t *)_base;
@@ -719,7 +727,70 @@ void mpeg_audio::retrieve_subbuffer(int step)
 		memcpy(subbuffer[chan], bdata[chan][step], 32*sizeof(subbuffer[0][0]));
 }
 
+mpeg_audio::filterbank_tables::filterbank_tables()
+{
+	// 1/(2cos((2k+1)pi/2n)) for the odd half of each size n of the DCT, stored from n/2
+	for(int n=2; n<=32; n*=2)
+		for(int k=0; k<n/2; k++)
+			dct_factors[n/2+k] = 0.5/cos((2*k+1)*M_PI/(2*n));
+	dct_factors[0] = 0;
+
+	// Output i sums input[i+j]*direct[i+j] + input[32-i+j]*mirror[i+j],
+	// which is the reference sum term for term with the signs moved
+	// into the tables
+	for(int j=0; j<64*8; j+=64) {
+		for(int i=0; i<16; i++) {
+			window_direct[i+j] = synthesis_filter[i+j];
+			window_mirror[i+j] = -synthesis_filter[32+i+j];
+		}
+		window_direct[16+j] = -synthesis_filter[32+16+j];
+		window_mirror[16+j] = 0;
+		for(int i=17; i<32; i++) {
+			window_direct[i+j] = -synthesis_filter[32+i+j];
+			window_mirror[i+j] = -synthesis_filter[i+j];
+		}
+		for(int i=32; i<64; i++)
+			window_direct[i+j] = window_mirror[i+j] = 0;
+	}
+}
+
+const mpeg_audio::filterbank_tables &mpeg_audio::tables()
+{
+	static const filterbank_tables t;
+	return t;
+}
+
+template<> void mpeg_audio::dct2<1>(const double *input, double *output, const double *factors)
+{
+	output[0] = input[0];
+}
+
+template<int N> void mpeg_audio::dct2(const double *input, double *output, const double *factors)
+{
+	// Lee's factorization: the even outputs are the half-size DCT of
+	// the folded sums, the odd ones come from the half-size DCT of the
+	// scaled differences
+	double even[N/2], odd[N/2], even_out[N/2], odd_out[N/2];
+	for(int k=0; k<N/2; k++) {
+		even[k] = input[k] + input[N-1-k];
+		odd[k] = (input[k] - input[N-1-k]) * factors[N/2+k];
+	}
+	dct2<N/2>(even, even_out, factors);
+	dct2<N/2>(odd, odd_out, factors);
+	for(int k=0; k<N/2-1; k++) {
+		output[2*k] = even_out[k];
+		output[2*k+1] = odd_out[k] + odd_out[k+1];
+	}
+	output[N-2] = even_out[N/2-1];
+	output[N-1] = odd_out[N/2-1];
+}
+
 void mpeg_audio::idct32(const double *input, double *output)
+{
+	dct2<32>(input, output, tables().dct_factors);
+}
+
+void mpeg_audio::idct32_reference(const double *input, double *output)
 {
 	// Simplest idct32 ever, non-fast at all
 	for(int i=0; i<32; i++) {
@@ -731,6 +802,53 @@ void mpeg_audio::idct32(const double *input, double *output)
 }
 
 void mpeg_audio::resynthesis(const double *input, double *output)
+{
+	// Same sums in the same order as resynthesis_reference, so the
+	// result matches it exactly; the mirrored input is loaded forwards
+	// and reversed in the register
+	const double *direct = tables().window_direct;
+	const double *mirror = tables().window_mirror;
+#if defined(__AVX__)
+	for(int i=0; i<32; i+=4) {
+		__m256d acc = _mm256_setzero_pd();
+		for(int j=0; j<64*8; j+=64) {
+			__m256d m = _mm256_loadu_pd(input+29-i+j);
+			m = _mm256_permute_pd(_mm256_permute2f128_pd(m, m, 1), 5);
+			acc = _mm256_add_pd(acc, _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(input+i+j), _mm256_load_pd(direct+i+j)), _mm256_mul_pd(m, _mm256_load_pd(mirror+i+j))));
+		}
+		_mm256_storeu_pd(output+i, acc);
+	}
+#elif defined(__SSE2__) || (defined(_MSC_VER) && defined(PTR64))
+	for(int i=0; i<32; i+=2) {
+		__m128d acc = _mm_setzero_pd();
+		for(int j=0; j<64*8; j+=64) {
+			__m128d m = _mm_loadu_pd(input+31-i+j);
+			m = _mm_shuffle_pd(m, m, 1);
+			acc = _mm_add_pd(acc, _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(input+i+j), _mm_load_pd(direct+i+j)), _mm_mul_pd(m, _mm_load_pd(mirror+i+j))));
+		}
+		_mm_storeu_pd(output+i, acc);
+	}
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	for(int i=0; i<32; i+=2) {
+		float64x2_t acc = vdupq_n_f64(0);
+		for(int j=0; j<64*8; j+=64) {
+			float64x2_t m = vld1q_f64(input+31-i+j);
+			m = vextq_f64(m, m, 1);
+			acc = vaddq_f64(acc, vaddq_f64(vmulq_f64(vld1q_f64(input+i+j), vld1q_f64(direct+i+j)), vmulq_f64(m, vld1q_f64(mirror+i+j))));
+		}
+		vst1q_f64(output+i, acc);
+	}
+#else
+	for(int i=0; i<32; i++) {
+		double acc = 0;
+		for(int j=0; j<64*8; j+=64)
+			acc += input[i+j]*direct[i+j] + input[32-i+j]*mirror[i+j];
+		output[i] = acc;
+	}
+#endif
+}
+
+void mpeg_audio::resynthesis_reference(const double *input, double *output)
 {
 	memset(output, 0, 32*sizeof(output[0]));
 	for(int j=0; j<64*8; j+=64) {
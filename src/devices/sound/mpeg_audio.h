@@ -54,6 +54,17 @@ public:
 	// Clear audio buffer
 	void clear();
 
+	// Synthesis filterbank, exposed for the tests and benchmarks.
+	// idct32 turns 32 subband samples into 32 polyphase values and
+	// resynthesis windows the last 16 blocks of them into 32 output
+	// samples; input points 16 values into the newest block.  The
+	// _reference versions are the direct formulas the fast ones are
+	// checked against.
+	static void idct32(const double *input, double *output);
+	static void idct32_reference(const double *input, double *output);
+	static void resynthesis(const double *input, double *output);
+	static void resynthesis_reference(const double *input, double *output);
+
 private:
 	struct limit_hit {};
 
@@ -74,6 +85,19 @@ private:
 	static const band_info band_infos[18];
 	static const double synthesis_filter[512];
 
+	// Butterfly factors for the factored DCT and the synthesis window
+	// with the mirroring signs folded in, built once from synthesis_filter
+	struct filterbank_tables {
+		double dct_factors[32];
+		alignas(32) double window_direct[512];
+		alignas(32) double window_mirror[512];
+
+		filterbank_tables();
+	};
+
+	static const filterbank_tables &tables();
+	template<int N> static void dct2(const double *input, double *output, const double *factors);
+
 	const uint8_t *base;
 	int accepted, position_align;
 
@@ -106,8 +130,6 @@ private:
 	void build_amplitudes();
 	void build_next_segments(int step);
 	void retrieve_subbuffer(int step);
-	void idct32(const double *input, double *output);
-	void resynthesis(const double *input, double *output);
 	void scale_and_clamp(const double *input, short *output, int step);
 
 
@@ -49,7 +49,8 @@ samples_device::samples_device(const machine_config &mconfig, const char *tag, d
 	: device_t(mconfig, SAMPLES, "Samples", tag, owner, clock, "samples", __FILE__),
 		device_sound_interface(mconfig, *this),
 		m_channels(0),
-		m_names(nullptr)
+		m_names(nullptr),
+		m_on_demand(false)
 {
 }
 
@@ -57,7 +58,8 @@ samples_device::samples_device(const machine_config &mconfig, device_type type,
 	: device_t(mconfig, type, name, tag, owner, clock, shortname, source),
 		device_sound_interface(mconfig, *this),
 		m_channels(0),
-		m_names(nullptr)
+		m_names(nullptr),
+		m_on_demand(false)
 {
 }
 
@@ -84,7 +86,7 @@ void samples_device::start(uint8_t channel, uint32_t samplenum, bool loop)
 	chan.stream->update();
 
 	// update the parameters
-	sample_t &sample = m_sample[samplenum];
+	sample_t &sample = loaded_sample(samplenum);
 	chan.source = (sample.data.size() > 0) ? &sample.data[0] : nullptr;
 	chan.source_length = sample.data.size();
 	chan.source_num = (chan.source_length > 0) ? samplenum : -1;
@@ -237,7 +239,13 @@ bool samples_device::playing(uint8_t channel) const
 void samples_device::device_start()
 {
 	// read audio samples
+	m_on_demand = machine().options().samples_on_demand();
 	load_samples();
+	machine().memreport().add_reporter([this] (memory_report &report)
+	{
+		for (const sample_t &sample : m_sample)
+			report.add("Samples", tag(), sample.data.capacity() * sizeof(sample.data[0]));
+	});
 
 	// allocate channels
 	m_channel.resize(m_channels);
@@ -294,7 +302,7 @@ void samples_device::device_post_load()
 		channel_t &chan = m_channel[channel];
 		if (chan.source_num >= 0 && chan.source_num < m_sample.size())
 		{
-			sample_t &sample = m_sample[chan.source_num];
+			sample_t &sample = loaded_sample(chan.source_num);
 			chan.source = &sample.data[0];
 			chan.source_length = sample.data.size();
 			if (sample.data.empty())
@@ -605,32 +613,27 @@ bool samples_device::load_samples()
 		return false;
 
 	// iterate over ourself
-	const char *basename = machine().basename();
 	samples_iterator iter(*this);
-	const char *altbasename = iter.altbasename();
 
-	// pre-size the array
+	// pre-size the arrays
 	m_sample.resize(iter.count());
+	m_pending.assign(m_on_demand ? iter.count() : 0, nullptr);
 
 	// load the samples
 	int index = 0;
 	for (const char *samplename = iter.first(); samplename != nullptr; index++, samplename = iter.next())
 	{
-		// attempt to open as FLAC first
 		emu_file file(machine().options().sample_path(), OPEN_FLAG_READ);
-		osd_file::error filerr = file.open(basename, PATH_SEPARATOR, samplename, ".flac");
-		if (filerr != osd_file::error::NONE && altbasename != nullptr)
-			filerr = file.open(altbasename, PATH_SEPARATOR, samplename, ".flac");
-
-		// if not, try as WAV
-		if (filerr != osd_file::error::NONE)
-			filerr = file.open(basename, PATH_SEPARATOR, samplename, ".wav");
-		if (filerr != osd_file::error::NONE && altbasename != nullptr)
-			filerr = file.open(altbasename, PATH_SEPARATOR, samplename, ".wav");
+		osd_file::error filerr = open_sample(file, samplename);
 
-		// if opened, read it
+		// if opened, read it now or remember it for the first time it's played
 		if (filerr == osd_file::error::NONE)
-			read_sample(file, m_sample[index]);
+		{
+			if (m_on_demand)
+				m_pending[index] = samplename;
+			else
+				read_sample(file, m_sample[index]);
+		}
 		else if (filerr == osd_file::error::NOT_FOUND)
 		{
 			logerror("%s: Sample '%s' NOT FOUND\n", tag(), samplename);
@@ -639,3 +642,47 @@ bool samples_device::load_samples()
 	}
 	return ok;
 }
+
+
+//-------------------------------------------------
+//  open_sample - open the file for a sample,
+//  trying FLAC before WAV and the alternate
+//  basename after our own
+//-------------------------------------------------
+
+osd_file::error samples_device::open_sample(emu_file &file, const char *samplename)
+{
+	const char *basename = machine().basename();
+	const char *altbasename = samples_iterator(*this).altbasename();
+
+	// attempt to open as FLAC first
+	osd_file::error filerr = file.open(basename, PATH_SEPARATOR, samplename, ".flac");
+	if (filerr != osd_file::error::NONE && altbasename != nullptr)
+		filerr = file.open(altbasename, PATH_SEPARATOR, samplename, ".flac");
+
+	// if not, try as WAV
+	if (filerr != osd_file::error::NONE)
+		filerr = file.open(basename, PATH_SEPARATOR, samplename, ".wav");
+	if (filerr != osd_file::error::NONE && altbasename != nullptr)
+		filerr = file.open(altbasename, PATH_SEPARATOR, samplename, ".wav");
+	return filerr;
+}
+
+
+//-------------------------------------------------
+//  loaded_sample - return a sample, decoding it
+//  first if it was deferred by -samples_on_demand
+//-------------------------------------------------
+
+samples_device::sample_t &samples_device::loaded_sample(uint32_t samplenum)
+{
+	sample_t &sample = m_sample[samplenum];
+	if (samplenum < m_pending.size() && m_pending[samplenum] != nullptr)
+	{
+		emu_file file(machine().options().sample_path(), OPEN_FLAG_READ);
+		if (open_sample(file, m_pending[samplenum]) == osd_file::error::NONE)
+			read_sample(file, sample);
+		m_pending[samplenum] = nullptr;
+	}
+	return sample;
+}
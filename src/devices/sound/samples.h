@@ -110,11 +110,15 @@ protected:
 	// internal helpers
 	static bool read_wav_sample(emu_file &file, sample_t &sample);
 	static bool read_flac_sample(emu_file &file, sample_t &sample);
+	osd_file::error open_sample(emu_file &file, const char *samplename);
 	bool load_samples();
+	sample_t &loaded_sample(uint32_t samplenum);
 
 	// internal state
 	std::vector<channel_t>    m_channel;
 	std::vector<sample_t>     m_sample;
+	bool                      m_on_demand;        // defer decoding until a sample is first played
+	std::vector<const char *> m_pending;          // names of samples found but not yet decoded
 
 	// internal constants
 	static const uint8_t FRAC_BITS = 24;
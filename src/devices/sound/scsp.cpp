@@ -951,6 +951,7 @@ void scsp_device::w16(address_space &space,unsigned int addr,unsigned short val)
 		else if(addr<0xC00)
 		{
 			*((unsigned short *) (m_DSP.MPRO+(addr-0x800)/2))=val;
+			m_DSP.Decoded=0;
 
 			if(addr==0xBF0)
 			{
@@ -54,6 +54,63 @@ static int32_t UNPACK(uint16_t val)
 	return uval;
 }
 
+//unpack the program up to LastStep, dropping steps whose only result is an
+//ACC the following step overwrites without reading
+static void SCSPDSP_Decode(SCSPDSP *DSP)
+{
+	SCSPDSP_OP ops[128];
+	int step;
+
+	for(step=0;step<DSP->LastStep;++step)
+	{
+		uint16_t *IPtr=DSP->MPRO+step*4;
+		SCSPDSP_OP *op=&ops[step];
+
+		op->TRA=(IPtr[0]>>8)&0x7F;
+		op->TWT=(IPtr[0]>>7)&0x01;
+		op->TWA=(IPtr[0]>>0)&0x7F;
+		op->XSEL=(IPtr[1]>>15)&0x01;
+		op->YSEL=(IPtr[1]>>13)&0x03;
+		op->IRA=(IPtr[1]>>6)&0x3F;
+		op->IWT=(IPtr[1]>>5)&0x01;
+		op->IWA=(IPtr[1]>>0)&0x1F;
+		op->TABLE=(IPtr[2]>>15)&0x01;
+		op->MWT=(IPtr[2]>>14)&0x01;
+		op->MRD=(IPtr[2]>>13)&0x01;
+		op->EWT=(IPtr[2]>>12)&0x01;
+		op->EWA=(IPtr[2]>>8)&0x0F;
+		op->ADRL=(IPtr[2]>>7)&0x01;
+		op->FRCL=(IPtr[2]>>6)&0x01;
+		op->SHIFT=(IPtr[2]>>4)&0x03;
+		op->YRL=(IPtr[2]>>3)&0x01;
+		op->NEGB=(IPtr[2]>>2)&0x01;
+		op->ZERO=(IPtr[2]>>1)&0x01;
+		op->BSEL=(IPtr[2]>>0)&0x01;
+		op->NOFL=(IPtr[3]>>15)&1;
+		op->COEF=(IPtr[3]>>9)&0x3f;
+		op->MASA=(IPtr[3]>>2)&0x1f;
+		op->ADREB=(IPtr[3]>>1)&0x1;
+		op->NXADR=(IPtr[3]>>0)&0x1;
+		op->STEP=step;
+	}
+
+	DSP->NumOps=0;
+	for(step=0;step<DSP->LastStep;++step)
+	{
+		const SCSPDSP_OP *op=&ops[step];
+		bool effects=op->TWT || op->IWT || op->FRCL || op->MRD || op->MWT || op->ADRL || op->EWT || op->YRL || op->IRA>0x31;
+		if(!effects && step+1<DSP->LastStep)
+		{
+			const SCSPDSP_OP *next=&ops[step+1];
+			bool reads_acc=(!next->ZERO && next->BSEL) || next->TWT || next->FRCL || next->MWT || next->ADRL || next->EWT;
+			if(!reads_acc)
+				continue;
+		}
+		DSP->OPS[DSP->NumOps++]=*op;
+	}
+	DSP->Decoded=1;
+}
+
 void SCSPDSP_Init(SCSPDSP *DSP)
 {
 	memset(DSP,0,sizeof(SCSPDSP));
@@ -86,42 +143,39 @@ void SCSPDSP_Step(SCSPDSP *DSP)
 	if(dump)
 		f=fopen("dsp.txt","wt");
 #endif
-	for(step=0;step</*128*/DSP->LastStep;++step)
-	{
-		uint16_t *IPtr=DSP->MPRO+step*4;
+	if(!DSP->Decoded)
+		SCSPDSP_Decode(DSP);
 
-//      if(IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
-//          break;
-
-		uint32_t TRA=(IPtr[0]>>8)&0x7F;
-		uint32_t TWT=(IPtr[0]>>7)&0x01;
-		uint32_t TWA=(IPtr[0]>>0)&0x7F;
-
-		uint32_t XSEL=(IPtr[1]>>15)&0x01;
-		uint32_t YSEL=(IPtr[1]>>13)&0x03;
-		uint32_t IRA=(IPtr[1]>>6)&0x3F;
-		uint32_t IWT=(IPtr[1]>>5)&0x01;
-		uint32_t IWA=(IPtr[1]>>0)&0x1F;
-
-		uint32_t TABLE=(IPtr[2]>>15)&0x01;
-		uint32_t MWT=(IPtr[2]>>14)&0x01;
-		uint32_t MRD=(IPtr[2]>>13)&0x01;
-		uint32_t EWT=(IPtr[2]>>12)&0x01;
-		uint32_t EWA=(IPtr[2]>>8)&0x0F;
-		uint32_t ADRL=(IPtr[2]>>7)&0x01;
-		uint32_t FRCL=(IPtr[2]>>6)&0x01;
-		uint32_t SHIFT=(IPtr[2]>>4)&0x03;
-		uint32_t YRL=(IPtr[2]>>3)&0x01;
-		uint32_t NEGB=(IPtr[2]>>2)&0x01;
-		uint32_t ZERO=(IPtr[2]>>1)&0x01;
-		uint32_t BSEL=(IPtr[2]>>0)&0x01;
-
-		uint32_t NOFL=(IPtr[3]>>15)&1;        //????
-		uint32_t COEF=(IPtr[3]>>9)&0x3f;
-
-		uint32_t MASA=(IPtr[3]>>2)&0x1f;  //???
-		uint32_t ADREB=(IPtr[3]>>1)&0x1;
-		uint32_t NXADR=(IPtr[3]>>0)&0x1;
+	for(int i=0;i<DSP->NumOps;++i)
+	{
+		const SCSPDSP_OP *op=&DSP->OPS[i];
+		step=op->STEP;
+
+		uint32_t TRA=op->TRA;
+		uint32_t TWT=op->TWT;
+		uint32_t TWA=op->TWA;
+		uint32_t XSEL=op->XSEL;
+		uint32_t YSEL=op->YSEL;
+		uint32_t IRA=op->IRA;
+		uint32_t IWT=op->IWT;
+		uint32_t IWA=op->IWA;
+		uint32_t TABLE=op->TABLE;
+		uint32_t MWT=op->MWT;
+		uint32_t MRD=op->MRD;
+		uint32_t EWT=op->EWT;
+		uint32_t EWA=op->EWA;
+		uint32_t ADRL=op->ADRL;
+		uint32_t FRCL=op->FRCL;
+		uint32_t SHIFT=op->SHIFT;
+		uint32_t YRL=op->YRL;
+		uint32_t NEGB=op->NEGB;
+		uint32_t ZERO=op->ZERO;
+		uint32_t BSEL=op->BSEL;
+		uint32_t NOFL=op->NOFL;
+		uint32_t COEF=op->COEF;
+		uint32_t MASA=op->MASA;
+		uint32_t ADREB=op->ADREB;
+		uint32_t NXADR=op->NXADR;
 
 		int64_t v;
 
@@ -351,5 +405,6 @@ void SCSPDSP_Start(SCSPDSP *DSP)
 			break;
 	}
 	DSP->LastStep=i+1;
+	DSP->Decoded=0;
 
 }
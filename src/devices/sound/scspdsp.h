@@ -5,6 +5,13 @@
 #ifndef __SCSPDSP_H__
 #define __SCSPDSP_H__
 
+//one microprogram step, unpacked from MPRO
+struct SCSPDSP_OP
+{
+	uint8_t TRA,TWT,TWA,XSEL,YSEL,IRA,IWT,IWA,TABLE,MWT,MRD,EWT,EWA,ADRL,FRCL,SHIFT,YRL,NEGB,ZERO,BSEL,NOFL,COEF,MASA,ADREB,NXADR;
+	uint8_t STEP; //index in MPRO, memory is only accessed on odd steps
+};
+
 //the DSP Context
 struct SCSPDSP
 {
@@ -19,6 +26,9 @@ struct SCSPDSP
 	int16_t COEF[64];     //16 bit signed
 	uint16_t MADRS[32];   //offsets (in words), 16 bit
 	uint16_t MPRO[128*4]; //128 steps 64 bit
+	SCSPDSP_OP OPS[128];  //live steps of MPRO, decoded
+	int NumOps;
+	int Decoded;  //OPS is up to date with MPRO and LastStep
 	int32_t TEMP[128];    //TEMP regs,24 bit signed
 	int32_t MEMS[32]; //MEMS regs,24 bit signed
 	uint32_t DEC;
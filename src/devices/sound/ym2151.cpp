@@ -1069,6 +1069,21 @@ void ym2151_device::chan_calc(unsigned int chan)
 
 	*op->mem_connect = op->mem_value;   /* restore delayed sample (MEM) value to m2 or c2 */
 
+	/* with the M1 feedback drained and every operator attenuated below ENV_QUIET
+	   (TL and AM only ever add to the attenuation) nothing can reach the output;
+	   only the MEM delay needs carrying over, exactly as the full path would */
+	if (!op->fb_out_prev && !op->fb_out_curr &&
+		op[0].volume >= ENV_QUIET && op[1].volume >= ENV_QUIET &&
+		op[2].volume >= ENV_QUIET && op[3].volume >= ENV_QUIET)
+	{
+		if (!op->connect)
+			mem = c1 = c2 = 0;
+		else
+			*op->connect = 0;
+		op->mem_value = mem;
+		return;
+	}
+
 	if (op->ams)
 		AM = lfa << (op->ams-1);
 	env = volume_calc(op);
@@ -12,7 +12,7 @@ const device_type EPIC12 = &device_creator<epic12_device>;
 epic12_device::epic12_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock)
 	: device_t(mconfig, EPIC12, "EP1C12 Blitter", tag, owner, clock, "epic12", __FILE__),
 		device_video_interface(mconfig, *this), m_ram16(nullptr), m_gfx_size(0), m_bitmaps(nullptr), m_use_ram(nullptr),
-	m_main_ramsize(0), m_main_rammask(0), m_maincpu(nullptr), m_ram16_copy(nullptr), m_work_queue(nullptr)
+	m_main_ramsize(0), m_main_rammask(0), m_maincpu(nullptr), m_ram16_copy(nullptr), m_work_queue(nullptr), m_band_queue(nullptr)
 {
 	m_is_unsafe = 0;
 	m_delay_scale = 0;
@@ -47,6 +47,8 @@ void epic12_device::device_start()
 
 	m_ram16_copy = std::make_unique<uint16_t[]>(m_main_ramsize/2);
 
+	m_band_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_HIGH_FREQ|WORK_QUEUE_FLAG_MULTI);
+
 	m_blitter_delay_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(epic12_device::blitter_delay_callback),this));
 	m_blitter_delay_timer->adjust(attotime::never);
 
@@ -109,7 +111,7 @@ void epic12_device::device_reset()
 uint8_t epic12_device_colrtable[0x20][0x40];
 uint8_t epic12_device_colrtable_rev[0x20][0x40];
 uint8_t epic12_device_colrtable_add[0x20][0x20];
-uint64_t epic12_device_blit_delay;
+std::atomic<uint64_t> epic12_device_blit_delay;
 
 inline uint16_t epic12_device::READ_NEXT_WORD(offs_t *addr)
 {
@@ -200,7 +202,6 @@ inline void epic12_device::gfx_upload(offs_t *addr)
 	}
 }
 
-#define draw_params m_bitmaps.get(), &m_clip, &m_bitmaps->pix(0,0),src_x,src_y, x,y, dimx,dimy, flipy, s_alpha, d_alpha, &tint_clr
 
 
 
@@ -332,6 +333,7 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 	int trans,blend, s_mode, d_mode;
 	clr_t tint_clr;
 	int tinted = 0;
+	epic12_device_blitfunction blitfn;
 
 	uint16_t attr     =   READ_NEXT_WORD(addr);
 	uint16_t alpha    =   READ_NEXT_WORD(addr);
@@ -405,22 +407,22 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (!blend)
 				{
-					draw_sprite_f0_ti1_tr1_plain(draw_params);
+					blitfn = draw_sprite_f0_ti1_tr1_plain;
 				}
 				else
 				{
-					epic12_device_f0_ti1_tr1_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfn = epic12_device_f0_ti1_tr1_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 			else
 			{
 			if (!blend)
 				{
-					draw_sprite_f0_ti1_tr0_plain(draw_params);
+					blitfn = draw_sprite_f0_ti1_tr0_plain;
 				}
 				else
 				{
-					epic12_device_f0_ti1_tr0_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfn = epic12_device_f0_ti1_tr0_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 		}
@@ -430,22 +432,22 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (!blend)
 				{
-					draw_sprite_f1_ti1_tr1_plain(draw_params);
+					blitfn = draw_sprite_f1_ti1_tr1_plain;
 				}
 				else
 				{
-					epic12_device_f1_ti1_tr1_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfn = epic12_device_f1_ti1_tr1_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 			else
 			{
 			if (!blend)
 				{
-					draw_sprite_f1_ti1_tr0_plain(draw_params);
+					blitfn = draw_sprite_f1_ti1_tr0_plain;
 				}
 				else
 				{
-					epic12_device_f1_ti1_tr0_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfn = epic12_device_f1_ti1_tr0_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 		}
@@ -458,26 +460,27 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (trans)
 				{
-					draw_sprite_f0_ti0_tr1_simple(draw_params);
+					blitfn = draw_sprite_f0_ti0_tr1_simple;
 				}
 				else
 				{
-					draw_sprite_f0_ti0_tr0_simple(draw_params);
+					blitfn = draw_sprite_f0_ti0_tr0_simple;
 				}
 			}
 			else
 			{
 				if (trans)
 				{
-					draw_sprite_f1_ti0_tr1_simple(draw_params);
+					blitfn = draw_sprite_f1_ti0_tr1_simple;
 				}
 				else
 				{
-					draw_sprite_f1_ti0_tr0_simple(draw_params);
+					blitfn = draw_sprite_f1_ti0_tr0_simple;
 				}
 
 			}
 
+			gfx_blit(blitfn, src_x, src_y, x, y, dimx, dimy, flipy, s_alpha, d_alpha, tint_clr);
 			return;
 		}
 
@@ -491,22 +494,22 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (!blend)
 				{
-					draw_sprite_f0_ti0_plain(draw_params);
+					blitfn = draw_sprite_f0_ti0_plain;
 				}
 				else
 				{
-					epic12_device_f0_ti0_tr1_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfn = epic12_device_f0_ti0_tr1_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 			else
 			{
 			if (!blend)
 				{
-					draw_sprite_f0_ti0_tr0_plain(draw_params);
+					blitfn = draw_sprite_f0_ti0_tr0_plain;
 				}
 				else
 				{
-					epic12_device_f0_ti0_tr0_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfn = epic12_device_f0_ti0_tr0_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 		}
@@ -516,29 +519,85 @@ inline void epic12_device::gfx_draw(offs_t *addr)
 			{
 				if (!blend)
 				{
-					draw_sprite_f1_ti0_plain(draw_params);
+					blitfn = draw_sprite_f1_ti0_plain;
 				}
 				else
 				{
-					epic12_device_f1_ti0_tr1_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfn = epic12_device_f1_ti0_tr1_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 			else
 			{
 			if (!blend)
 				{
-					draw_sprite_f1_ti0_tr0_plain(draw_params);
+					blitfn = draw_sprite_f1_ti0_tr0_plain;
 				}
 				else
 				{
-					epic12_device_f1_ti0_tr0_blit_funcs[s_mode | (d_mode<<3)](draw_params);
+					blitfn = epic12_device_f1_ti0_tr0_blit_funcs[s_mode | (d_mode<<3)];
 				}
 			}
 		}
 	}
 
+	gfx_blit(blitfn, src_x, src_y, x, y, dimx, dimy, flipy, s_alpha, d_alpha, tint_clr);
+}
+
+
+void epic12_device::gfx_blit(epic12_device_blitfunction blitfn, int src_x, int src_y, int dst_x_start, int dst_y_start, int dimx, int dimy, int flipy, uint8_t s_alpha, uint8_t d_alpha, const clr_t &tint_clr)
+{
+	uint32_t *gfx = &m_bitmaps->pix(0,0);
+
+	// rows actually written once clipped
+	const int miny = std::max(dst_y_start, m_clip.min_y);
+	const int maxy = std::min(dst_y_start + dimy - 1, m_clip.max_y);
+	const int width = std::min(dst_x_start + dimx - 1, m_clip.max_x) - std::max(dst_x_start, m_clip.min_x) + 1;
+	const int rows = maxy - miny + 1;
+
+	// rows within one blit are independent unless the source overlaps the destination (or wraps)
+	const bool overlaps = (src_y + dimy > 0x1000) ||
+		(src_y < dst_y_start + dimy && dst_y_start < src_y + dimy && src_x < dst_x_start + dimx && dst_x_start < src_x + dimx);
+
+	int bands = std::min(rows / EPIC12_MIN_BAND_ROWS, EPIC12_MAX_BLIT_BANDS);
+	if (m_band_queue == nullptr || overlaps || width <= 0 || rows * width < EPIC12_SPLIT_BLIT_PIXELS || bands < 2)
+	{
+		blitfn(m_bitmaps.get(), &m_clip, gfx, src_x, src_y, dst_x_start, dst_y_start, dimx, dimy, flipy, s_alpha, d_alpha, &tint_clr);
+		return;
+	}
+
+	// give each band the same blit with the clip narrowed to its rows
+	for (int band = 0; band < bands; band++)
+	{
+		blit_band &work = m_bands[band];
+		work.blitfn = blitfn;
+		work.bitmap = m_bitmaps.get();
+		work.clip = m_clip;
+		work.clip.min_y = miny + (rows * band) / bands;
+		work.clip.max_y = miny + (rows * (band + 1)) / bands - 1;
+		work.gfx = gfx;
+		work.src_x = src_x;
+		work.src_y = src_y;
+		work.dst_x_start = dst_x_start;
+		work.dst_y_start = dst_y_start;
+		work.dimx = dimx;
+		work.dimy = dimy;
+		work.flipy = flipy;
+		work.s_alpha = s_alpha;
+		work.d_alpha = d_alpha;
+		work.tint_clr = tint_clr;
+	}
 
+	osd_work_item_queue_multiple(m_band_queue, blit_band_callback, bands, m_bands, sizeof(m_bands[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(m_band_queue, osd_ticks_per_second() * 10);
+}
 
+
+void *epic12_device::blit_band_callback(void *param, int threadid)
+{
+	blit_band &work = *reinterpret_cast<blit_band *>(param);
+
+	work.blitfn(work.bitmap, &work.clip, work.gfx, work.src_x, work.src_y, work.dst_x_start, work.dst_y_start, work.dimx, work.dimy, work.flipy, work.s_alpha, work.d_alpha, &work.tint_clr);
+	return nullptr;
 }
 
 
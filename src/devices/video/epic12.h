@@ -12,7 +12,20 @@
 extern uint8_t epic12_device_colrtable[0x20][0x40];
 extern uint8_t epic12_device_colrtable_rev[0x20][0x40];
 extern uint8_t epic12_device_colrtable_add[0x20][0x20];
-extern uint64_t epic12_device_blit_delay;
+extern std::atomic<uint64_t> epic12_device_blit_delay;
+
+// the common tinted/transparent/alpha-blended kernels process 4 pixels at a time where SSE2 is available
+#if defined(__SSE2__) || (defined(_MSC_VER) && defined(PTR64))
+#include <emmintrin.h>
+#define EPIC12_USE_SSE2 1
+#else
+#define EPIC12_USE_SSE2 0
+#endif
+
+// blits covering at least this many destination pixels are split into row bands across workers
+#define EPIC12_SPLIT_BLIT_PIXELS    (128*128)
+#define EPIC12_MIN_BAND_ROWS        16
+#define EPIC12_MAX_BLIT_BANDS       8
 
 struct _clr_t
 {
@@ -102,6 +115,8 @@ public:
 	inline void gfx_draw_shadow_copy(address_space &space, offs_t *addr);
 	inline void gfx_upload(offs_t *addr);
 	inline void gfx_draw(offs_t *addr);
+	void gfx_blit(epic12_device_blitfunction blitfn, int src_x, int src_y, int dst_x_start, int dst_y_start, int dimx, int dimy, int flipy, uint8_t s_alpha, uint8_t d_alpha, const clr_t &tint_clr);
+	static void *blit_band_callback(void *param, int threadid);
 	void gfx_exec(void);
 	DECLARE_READ32_MEMBER( gfx_ready_r );
 	DECLARE_WRITE32_MEMBER( gfx_exec_w );
@@ -652,6 +667,33 @@ public:
 
 
 
+#if EPIC12_USE_SSE2
+	// 4-pixel versions of the helpers below; colours are unpacked to 16 bits per channel, two pens per register
+	static inline void simd_pen_to_clr(__m128i pens, __m128i &lo, __m128i &hi)
+	{
+		const __m128i clr = _mm_and_si128(_mm_srli_epi32(pens, 3), _mm_set1_epi32(0x001f1f1f));
+		lo = _mm_unpacklo_epi8(clr, _mm_setzero_si128());
+		hi = _mm_unpackhi_epi8(clr, _mm_setzero_si128());
+	}
+
+	static inline __m128i simd_clr_to_pen(__m128i lo, __m128i hi)
+	{
+		return _mm_slli_epi32(_mm_packus_epi16(lo, hi), 3);
+	}
+
+	// matches epic12_device_colrtable: (x*y) / 0x1f clamped to 0x1f; 2115/65536 is exact for x*y < 0x1f*0x40
+	static inline __m128i simd_clr_mul(__m128i clr, __m128i factor)
+	{
+		return _mm_min_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(clr, factor), _mm_set1_epi16(2115)), _mm_set1_epi16(0x1f));
+	}
+
+	// matches epic12_device_colrtable_add
+	static inline __m128i simd_clr_add(__m128i clr0, __m128i clr1)
+	{
+		return _mm_min_epi16(_mm_add_epi16(clr0, clr1), _mm_set1_epi16(0x1f));
+	}
+#endif
+
 	static inline void pen_to_clr(uint32_t pen, clr_t *clr)
 	{
 	// --t- ---- rrrr r--- gggg g--- bbbb b---  format
@@ -828,6 +870,20 @@ protected:
 	osd_work_queue *m_work_queue;
 	osd_work_item *m_blitter_request;
 
+	// large blits are split into row bands rendered on this queue
+	struct blit_band
+	{
+		epic12_device_blitfunction blitfn;
+		bitmap_rgb32 *bitmap;
+		rectangle clip;
+		uint32_t *gfx;
+		int src_x, src_y, dst_x_start, dst_y_start, dimx, dimy, flipy;
+		uint8_t s_alpha, d_alpha;
+		clr_t tint_clr;
+	};
+	osd_work_queue *m_band_queue;
+	blit_band m_bands[EPIC12_MAX_BLIT_BANDS];
+
 	// blit timing
 	emu_timer *m_blitter_delay_timer;
 	int m_blitter_busy;
@@ -2,6 +2,13 @@
 // copyright-holders:David Haywood
 /* blitter function */
 
+// plain copies, tinting and the s0/d0 alpha blend have a 4-pixel path (epic12simd.hxx)
+#if EPIC12_USE_SSE2 && (REALLY_SIMPLE == 1 || BLENDED == 0 || (_SMODE == 0 && _DMODE == 0))
+#define EPIC12_SIMD_KERNEL 1
+#else
+#define EPIC12_SIMD_KERNEL 0
+#endif
+
 void epic12_device::FUNCNAME(BLIT_PARAMS)
 {
 	uint32_t* gfx2;
@@ -115,7 +122,18 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 #endif
 #endif
 
-
+#if EPIC12_SIMD_KERNEL
+#if TRANSPARENT == 1 || REALLY_SIMPLE == 0
+	const __m128i t_mask = _mm_set1_epi32(0x20000000);
+#endif
+#if TINT == 1
+	const __m128i tint_factor = _mm_setr_epi16(tint_clr->b, tint_clr->g, tint_clr->r, 0, tint_clr->b, tint_clr->g, tint_clr->r, 0);
+#endif
+#if BLENDED == 1
+	const __m128i s_factor = _mm_set1_epi16(s_alpha);
+	const __m128i d_factor = _mm_set1_epi16(d_alpha);
+#endif
+#endif
 
 	for (y = starty; y < dimy; y++)
 	{
@@ -154,6 +172,12 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 
 			bigblocks--;
 		}
+#endif
+#if EPIC12_SIMD_KERNEL
+		while (bmp + 4 <= end)
+		{
+			#include "epic12simd.hxx"
+		}
 #endif
 		while (bmp<end)
 		{
@@ -166,3 +190,4 @@ void epic12_device::FUNCNAME(BLIT_PARAMS)
 }
 
 #undef LOOP_INCREMENTS
+#undef EPIC12_SIMD_KERNEL
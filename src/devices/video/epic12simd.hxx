@@ -0,0 +1,46 @@
+// license:BSD-3-Clause
+// copyright-holders:David Haywood
+/* 4-pixel SSE2 version of epic12pixel.hxx, used for the most common blit modes */
+
+#if FLIPX == 1
+			const __m128i pens = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(gfx2 - 3)), _MM_SHUFFLE(0, 1, 2, 3));
+#else
+			const __m128i pens = _mm_loadu_si128((const __m128i *)gfx2);
+#endif
+
+#if REALLY_SIMPLE == 1
+			__m128i result = pens;
+#else
+			__m128i s_lo, s_hi;
+			simd_pen_to_clr(pens, s_lo, s_hi);
+
+#if TINT == 1
+			s_lo = simd_clr_mul(s_lo, tint_factor);
+			s_hi = simd_clr_mul(s_hi, tint_factor);
+#endif
+
+#if BLENDED == 1
+			// s0/d0: src * s_alpha + dst * d_alpha
+			__m128i d_lo, d_hi;
+			simd_pen_to_clr(_mm_loadu_si128((const __m128i *)bmp), d_lo, d_hi);
+			s_lo = simd_clr_add(simd_clr_mul(s_lo, s_factor), simd_clr_mul(d_lo, d_factor));
+			s_hi = simd_clr_add(simd_clr_mul(s_hi, s_factor), simd_clr_mul(d_hi, d_factor));
+#endif
+
+			__m128i result = _mm_or_si128(simd_clr_to_pen(s_lo, s_hi), _mm_and_si128(pens, t_mask));
+#endif
+
+#if TRANSPARENT == 1
+			// only pens with the transparency bit set are written
+			const __m128i opaque = _mm_cmpeq_epi32(_mm_and_si128(pens, t_mask), t_mask);
+			result = _mm_or_si128(_mm_and_si128(opaque, result), _mm_andnot_si128(opaque, _mm_loadu_si128((const __m128i *)bmp)));
+#endif
+
+			_mm_storeu_si128((__m128i *)bmp, result);
+
+			bmp += 4;
+#if FLIPX == 1
+			gfx2 -= 4;
+#else
+			gfx2 += 4;
+#endif
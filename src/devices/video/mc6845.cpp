@@ -954,11 +954,13 @@ uint8_t mc6845_device::draw_scanline(int y, bitmap_rgb32 &bitmap, const rectangl
 		uint8_t cr = y / (m_max_ras_addr + (MODE_INTERLACE_AND_VIDEO ? m_interlace_adjust : m_noninterlace_adjust));
 		uint16_t ma = (cr << 8) | cc;
 
-		m_update_row_cb(bitmap, cliprect, ma + m_disp_start_addr, ra, y, m_horiz_disp, cursor_x, de, hbp, vbp);
+		if (!row_cached(y, ma + m_disp_start_addr, ra, cursor_x, de, hbp, vbp))
+			m_update_row_cb(bitmap, cliprect, ma + m_disp_start_addr, ra, y, m_horiz_disp, cursor_x, de, hbp, vbp);
 	}
 	else
 	{
-		m_update_row_cb(bitmap, cliprect, m_current_disp_addr, ra, y, m_horiz_disp, cursor_x, de, hbp, vbp);
+		if (!row_cached(y, m_current_disp_addr, ra, cursor_x, de, hbp, vbp))
+			m_update_row_cb(bitmap, cliprect, m_current_disp_addr, ra, y, m_horiz_disp, cursor_x, de, hbp, vbp);
 	}
 
 	/* update MA if the last raster address */
@@ -969,6 +971,63 @@ uint8_t mc6845_device::draw_scanline(int y, bitmap_rgb32 &bitmap, const rectangl
 }
 
 
+void mc6845_device::select_row_cache(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
+{
+	m_row_cache = nullptr;
+	if (m_row_cache_ram.empty())
+		return;
+
+	/* a frame that wasn't drawn may have put anything in the bitmaps */
+	uint64_t frame = screen.frame_number();
+	if (frame != m_row_cache_frame && frame != m_row_cache_frame + 1)
+		invalidate_row_cache();
+	m_row_cache_frame = frame;
+
+	row_cache_slot *slot = nullptr;
+	for (auto &elem : m_row_cache_slots)
+		if (elem.base == bitmap.raw_pixptr(0))
+			slot = &elem;
+	if (slot == nullptr)
+	{
+		slot = &m_row_cache_slots[m_row_cache_next];
+		m_row_cache_next = (m_row_cache_next + 1) % ARRAY_LENGTH(m_row_cache_slots);
+		slot->base = bitmap.raw_pixptr(0);
+		slot->lines.clear();
+	}
+
+	/* only whole frames keep the cache; a partial update draws as usual */
+	if (!cliprect.contains(screen.visible_area()))
+	{
+		slot->base = nullptr;
+		return;
+	}
+
+	if (slot->lines.size() <= size_t(bitmap.height()))
+		slot->lines.resize(bitmap.height() + 1);
+	m_row_cache = slot;
+}
+
+
+bool mc6845_device::row_cached(int y, uint16_t ma, uint8_t ra, int8_t cursor_x, int de, int hbp, int vbp)
+{
+	if (m_row_cache == nullptr || y >= int(m_row_cache->lines.size()))
+		return false;
+
+	int params[] = { ma, ra, cursor_x, de, hbp, vbp, m_horiz_disp };
+	m_row_key.assign((const uint8_t *)params, (const uint8_t *)params + sizeof(params));
+	for (const row_cache_ram &ram : m_row_cache_ram)
+		for (int x = 0; x < m_horiz_disp; x++)
+			for (int i = 0; i < ram.bytes_per_char; i++)
+				m_row_key.push_back(ram.base[(((ma + x) & 0x3fff) * ram.bytes_per_char + i) & ram.mask]);
+
+	std::vector<uint8_t> &line = m_row_cache->lines[y];
+	if (line == m_row_key)
+		return true;
+	line.swap(m_row_key);
+	return false;
+}
+
+
 uint32_t mc6845_device::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
 	assert(bitmap.valid());
@@ -987,6 +1046,8 @@ uint32_t mc6845_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 			m_current_disp_addr = m_disp_start_addr;
 		}
 
+		select_row_cache(screen, bitmap, cliprect);
+
 		/* for each row in the visible region */
 		for (uint16_t y = cliprect.min_y; y <= cliprect.max_y; y++)
 		{
@@ -123,6 +123,15 @@ public:
 	template<class _Object> static devcb_base &set_out_hsync_callback(device_t &device, _Object object) { return downcast<mc6845_device &>(device).m_out_hsync_cb.set_callback(object); }
 	template<class _Object> static devcb_base &set_out_vsync_callback(device_t &device, _Object object) { return downcast<mc6845_device &>(device).m_out_vsync_cb.set_callback(object); }
 
+	/* opt in to the row cache: update_row is skipped for a scanline when its
+	   parameters and the display RAM bytes behind its characters (bytes_per_char
+	   bytes per address, wrapped with mask) match what the screen bitmap last
+	   showed there.  Call once per RAM that update_row reads, e.g. video and
+	   colour RAM; update_row must then draw every pixel of its scanline, and
+	   any other state it uses must be followed by invalidate_row_cache() */
+	void add_row_cache_ram(const uint8_t *base, uint32_t mask, int bytes_per_char = 1) { m_row_cache_ram.push_back(row_cache_ram{ base, mask, bytes_per_char }); }
+	void invalidate_row_cache() { for (auto &slot : m_row_cache_slots) slot.base = nullptr; }
+
 	/* select one of the registers for reading or writing */
 	DECLARE_WRITE8_MEMBER( address_w );
 
@@ -274,6 +283,28 @@ protected:
 	void handle_line_timer();
 	virtual void update_cursor_state();
 	virtual uint8_t draw_scanline(int y, bitmap_rgb32 &bitmap, const rectangle &cliprect);
+	void select_row_cache(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect);
+	bool row_cached(int y, uint16_t ma, uint8_t ra, int8_t cursor_x, int de, int hbp, int vbp);
+
+	/* row cache, see add_row_cache_ram; screen bitmaps are used in
+	   rotation, so each one has its own copy of the scanline keys */
+	struct row_cache_ram
+	{
+		const uint8_t *base;
+		uint32_t mask;
+		int bytes_per_char;
+	};
+	struct row_cache_slot
+	{
+		void *base = nullptr;                       // bitmap this describes
+		std::vector<std::vector<uint8_t>> lines;    // parameters and RAM bytes per scanline
+	};
+	std::vector<row_cache_ram> m_row_cache_ram;
+	row_cache_slot m_row_cache_slots[3];
+	row_cache_slot *m_row_cache = nullptr;
+	int m_row_cache_next = 0;
+	uint64_t m_row_cache_frame = 0;
+	std::vector<uint8_t> m_row_key;
 
 	/************************
 	 interface CRTC - driver
@@ -337,75 +337,149 @@ uint16_t vga_device::offset()
 
 void vga_device::vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
-	uint8_t ch, attr;
-	uint8_t bits;
-	uint32_t font_base;
-	uint32_t *bitmapline;
+	screen_device *screen = machine().first_screen();
+	const rectangle &visarea = screen->visible_area();
+	uint64_t frame = screen->frame_number();
 	int width=CHAR_WIDTH, height = (vga.crtc.maximum_scan_line) * (vga.crtc.scan_doubling + 1);
-	int pos, line, column, mask, w, h, addr;
-	uint8_t blink_en,fore_col,back_col;
-	pen_t pen;
+	int lines = std::min<int>(TEXT_LINES, bitmap.height());
+	int columns = TEXT_COLUMNS;
+	int pos, line, column, addr, row;
 
 	if(vga.crtc.cursor_enable)
-		vga.cursor.visible = machine().first_screen()->frame_number() & 0x10;
+		vga.cursor.visible = frame & 0x10;
 	else
 		vga.cursor.visible = 0;
 
-	for (addr = vga.crtc.start_addr, line = -vga.crtc.preset_row_scan; line < TEXT_LINES;
-			line += height, addr += (offset()>>1))
+	// a full frame can skip the character rows that the bitmap already
+	// shows; screen bitmaps are used in rotation, so each has its own copy
+	text_cache *cache = nullptr;
+	bool redraw_all = true;
+	if(frame != m_text_cache_frame && frame != m_text_cache_frame + 1)
+		for(auto &slot : m_text_cache)
+			slot.base = nullptr;
+	m_text_cache_frame = frame;
+	if(height > 0)
 	{
-		for (pos = addr, column=0; column<TEXT_COLUMNS; column++, pos++)
+		for(auto &slot : m_text_cache)
+			if(slot.base == bitmap.raw_pixptr(0))
+				cache = &slot;
+		if(cache == nullptr)
+		{
+			cache = &m_text_cache[m_text_cache_next];
+			m_text_cache_next = (m_text_cache_next + 1) % ARRAY_LENGTH(m_text_cache);
+			cache->base = bitmap.raw_pixptr(0);
+			cache->state.clear();
+		}
+
+		if(!cliprect.contains(visarea))
 		{
-			ch   = vga.memory[(pos<<1) + 0];
-			attr = vga.memory[(pos<<1) + 1];
-			font_base = 0x20000+(ch<<5);
-			font_base += ((attr & 8) ? vga.sequencer.char_sel.A : vga.sequencer.char_sel.B)*0x2000;
-			blink_en = (vga.attribute.data[0x10]&8&&machine().first_screen()->frame_number() & 0x20) ? attr & 0x80 : 0;
+			// a partial update leaves the rest of the bitmap as it was
+			cache->base = nullptr;
+			cache = nullptr;
+		}
+		else
+		{
+			auto push = [this](const void *data, size_t size) { m_text_key.insert(m_text_key.end(), (const uint8_t *)data, (const uint8_t *)data + size); };
+			int values[] = {
+				bitmap.width(), bitmap.height(), bitmap.rowpixels(), visarea.min_x, visarea.max_x, visarea.min_y, visarea.max_y,
+				width, height, lines, columns, vga.crtc.preset_row_scan, vga.crtc.scan_doubling, int(vga.crtc.start_addr), offset(),
+				vga.attribute.data[0x10], int(frame & 0x20), vga.cursor.visible, int(vga.crtc.cursor_addr), vga.crtc.cursor_scan_start, vga.crtc.cursor_scan_end };
+			m_text_key.clear();
+			push(values, sizeof(values));
+			push(vga.pens, sizeof(vga.pens));
+			redraw_all = m_text_key != cache->state;
+			cache->state.swap(m_text_key);
+		}
+	}
 
-			fore_col = attr & 0xf;
-			back_col = (attr & 0x70) >> 4;
-			back_col |= (vga.attribute.data[0x10]&8) ? 0 : ((attr & 0x80) >> 4);
+	for (row = 0, addr = vga.crtc.start_addr, line = -vga.crtc.preset_row_scan; line < TEXT_LINES;
+			row++, line += height, addr += (offset()>>1))
+	{
+		int hstart = std::max(-line, 0), hend = std::min(height, lines - line);
 
-			for (h = std::max(-line, 0); (h < height) && (line+h < std::min(TEXT_LINES, bitmap.height())); h++)
+		if (cache != nullptr)
+		{
+			// everything the row's pixels depend on besides the state above
+			m_text_key.clear();
+			for (pos = addr, column=0; column<columns; column++, pos++)
 			{
-				bitmapline = &bitmap.pix32(line+h);
-				bits = vga.memory[font_base+(h>>(vga.crtc.scan_doubling))];
+				uint8_t ch = vga.memory[(pos<<1) + 0];
+				uint8_t attr = vga.memory[(pos<<1) + 1];
+				uint32_t font_base = 0x20000+(ch<<5) + ((attr & 8) ? vga.sequencer.char_sel.A : vga.sequencer.char_sel.B)*0x2000;
+				m_text_key.push_back(ch);
+				m_text_key.push_back(attr);
+				for (int h = hstart; h < hend; h++)
+					m_text_key.push_back(vga.memory[font_base+(h>>(vga.crtc.scan_doubling))]);
+			}
+			if (cache->rows.size() <= size_t(row))
+				cache->rows.resize(row + 1);
+			if (!redraw_all && m_text_key == cache->rows[row])
+				continue;
+			cache->rows[row].swap(m_text_key);
+		}
 
-				for (mask=0x80, w=0; (w<width)&&(w<8); w++, mask>>=1)
-				{
-					if (bits&mask)
-						pen = vga.pens[blink_en ? back_col : fore_col];
-					else
-						pen = vga.pens[back_col];
+		vga_vh_text_row(bitmap, visarea, frame, line, addr, hstart, hend, width, height);
+	}
+}
 
-					if(!machine().first_screen()->visible_area().contains(column*width+w, line+h))
-						continue;
-					bitmapline[column*width+w] = pen;
+void vga_device::vga_vh_text_row(bitmap_rgb32 &bitmap, const rectangle &visarea, uint64_t frame, int line, int addr, int hstart, int hend, int width, int height)
+{
+	uint8_t ch, attr;
+	uint8_t bits;
+	uint32_t font_base;
+	uint32_t *bitmapline;
+	int pos, column, mask, w, h;
+	uint8_t blink_en,fore_col,back_col;
+	pen_t pen;
 
-				}
-				if (w<width)
-				{
-					/* 9 column */
-					if (TEXT_COPY_9COLUMN(ch)&&(bits&1))
-						pen = vga.pens[blink_en ? back_col : fore_col];
-					else
-						pen = vga.pens[back_col];
+	for (pos = addr, column=0; column<TEXT_COLUMNS; column++, pos++)
+	{
+		ch   = vga.memory[(pos<<1) + 0];
+		attr = vga.memory[(pos<<1) + 1];
+		font_base = 0x20000+(ch<<5);
+		font_base += ((attr & 8) ? vga.sequencer.char_sel.A : vga.sequencer.char_sel.B)*0x2000;
+		blink_en = (vga.attribute.data[0x10]&8&&frame & 0x20) ? attr & 0x80 : 0;
+
+		fore_col = attr & 0xf;
+		back_col = (attr & 0x70) >> 4;
+		back_col |= (vga.attribute.data[0x10]&8) ? 0 : ((attr & 0x80) >> 4);
+
+		// clip the character cell against the visible area once
+		int x0 = column*width;
+		int wstart = std::max(visarea.min_x - x0, 0), wend = std::min(width, visarea.max_x + 1 - x0);
+		pen_t fore = vga.pens[blink_en ? back_col : fore_col], back = vga.pens[back_col];
+
+		for (h = hstart; h < hend; h++)
+		{
+			if (line+h < visarea.min_y || line+h > visarea.max_y)
+				continue;
+			bitmapline = &bitmap.pix32(line+h);
+			bits = vga.memory[font_base+(h>>(vga.crtc.scan_doubling))];
 
-					if(!machine().first_screen()->visible_area().contains(column*width+w, line+h))
-						continue;
-					bitmapline[column*width+w] = pen;
-				}
+			for (w = wstart; w < wend && w < 8; w++)
+			{
+				mask = 0x80 >> w;
+				bitmapline[x0+w] = (bits&mask) ? fore : back;
 			}
-			if (vga.cursor.visible&&(pos==vga.crtc.cursor_addr))
+			if (w == 8 && w < wend)
 			{
-				for (h=vga.crtc.cursor_scan_start;
-						(h<=vga.crtc.cursor_scan_end)&&(h<height)&&(line+h<TEXT_LINES);
-						h++)
-				{
-					if(!machine().first_screen()->visible_area().contains(column*width, line+h))
-						continue;
-					bitmap.plot_box(column*width, line+h, width, 1, vga.pens[attr&0xf]);
-				}
+				/* 9 column */
+				if (TEXT_COPY_9COLUMN(ch)&&(bits&1))
+					pen = fore;
+				else
+					pen = back;
+				bitmapline[x0+w] = pen;
+			}
+		}
+		if (vga.cursor.visible&&(pos==vga.crtc.cursor_addr))
+		{
+			for (h=vga.crtc.cursor_scan_start;
+					(h<=vga.crtc.cursor_scan_end)&&(h<height)&&(line+h<TEXT_LINES);
+					h++)
+			{
+				if(!visarea.contains(column*width, line+h))
+					continue;
+				bitmap.plot_box(column*width, line+h, width, 1, vga.pens[attr&0xf]);
 			}
 		}
 	}
@@ -418,6 +492,7 @@ void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 	uint32_t *bitmapline;
 	pen_t pen;
 	int pel_shift = (vga.attribute.pel_shift & 7);
+	const rectangle &visarea = machine().first_screen()->visible_area();
 
 //  popmessage("%08x %02x",EGA_START_ADDRESS,pel_shift);
 
@@ -427,6 +502,8 @@ void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 	{
 		for(yi=0;yi<height;yi++)
 		{
+			if(line + yi < visarea.min_y || line + yi > visarea.max_y)
+				continue;
 			bitmapline = &bitmap.pix32(line + yi);
 
 			for (pos=addr, c=0, column=0; column<EGA_COLUMNS+1; column++, c+=8, pos=(pos+1)&0xffff)
@@ -438,6 +515,8 @@ void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 				data[2]=vga.memory[(pos & 0xffff)+0x20000]<<2;
 				data[3]=vga.memory[(pos & 0xffff)+0x30000]<<3;
 
+				int x = c - pel_shift;
+				bool whole = x >= visarea.min_x && x + 7 <= visarea.max_x;
 				for (i = 7; i >= 0; i--)
 				{
 					pen = vga.pens[(data[0]&1) | (data[1]&2) | (data[2]&4) | (data[3]&8)];
@@ -447,9 +526,9 @@ void vga_device::vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect)
 					data[2]>>=1;
 					data[3]>>=1;
 
-					if(!machine().first_screen()->visible_area().contains(c+i-pel_shift, line + yi))
+					if(!whole && (x+i < visarea.min_x || x+i > visarea.max_x))
 						continue;
-					bitmapline[c+i-pel_shift] = pen;
+					bitmapline[x+i] = pen;
 				}
 			}
 		}
@@ -466,6 +545,8 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 	int yi;
 	int xi;
 	int pel_shift = (vga.attribute.pel_shift & 6);
+	const rectangle &visarea = machine().first_screen()->visible_area();
+	const pen_t *pens = m_palette->pens();
 
 	/* line compare is screen sensitive */
 	mask_comp = 0x3ff; //| (LINES & 0x300);
@@ -486,17 +567,32 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 					curr_addr = 0;
 					pel_shift = 0;
 				}
+				bool visible = line + yi >= visarea.min_y && line + yi <= visarea.max_y;
 				bitmapline = &bitmap.pix32(line + yi);
 				for (pos=curr_addr, c=0, column=0; column<VGA_COLUMNS+1; column++, c+=8, pos++)
 				{
 					if(pos > 0x80000/4)
 						return;
+					if(!visible)
+						continue;
 
+					// unchained: one byte from each plane, each shown twice
+					const uint8_t *src = &vga.memory[pos & 0xffff];
+					int x = c - pel_shift;
+					if(x >= visarea.min_x && x + 7 <= visarea.max_x)
+					{
+						uint32_t *dst = &bitmapline[x];
+						dst[0] = dst[1] = pens[src[0x00000]];
+						dst[2] = dst[3] = pens[src[0x10000]];
+						dst[4] = dst[5] = pens[src[0x20000]];
+						dst[6] = dst[7] = pens[src[0x30000]];
+						continue;
+					}
 					for(xi=0;xi<8;xi++)
 					{
-						if(!machine().first_screen()->visible_area().contains(c+xi-(pel_shift), line + yi))
+						if(x+xi < visarea.min_x || x+xi > visarea.max_x)
 							continue;
-						bitmapline[c+xi-(pel_shift)] = m_palette->pen(vga.memory[(pos & 0xffff)+((xi >> 1)*0x10000)]);
+						bitmapline[x+xi] = pens[src[(xi >> 1)*0x10000]];
 					}
 				}
 			}
@@ -512,18 +608,30 @@ void vga_device::vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 					curr_addr = addr;
 				if((line + yi) == (vga.crtc.line_compare & mask_comp))
 					curr_addr = 0;
+				bool visible = line + yi >= visarea.min_y && line + yi <= visarea.max_y;
 				bitmapline = &bitmap.pix32(line + yi);
 				//addr %= 0x80000;
 				for (pos=curr_addr, c=0, column=0; column<VGA_COLUMNS+1; column++, c+=0x10, pos+=0x8)
 				{
 					if(pos + 0x08 > 0x80000)
 						return;
+					if(!visible)
+						continue;
 
+					// chained: eight consecutive bytes, each shown twice
+					int x = c - pel_shift;
+					if(x >= visarea.min_x && x + 15 <= visarea.max_x)
+					{
+						uint32_t *dst = &bitmapline[x];
+						for(xi=0;xi<8;xi++)
+							dst[xi*2] = dst[xi*2+1] = pens[vga.memory[(pos+xi) & 0xffff]];
+						continue;
+					}
 					for(xi=0;xi<0x10;xi++)
 					{
-						if(!machine().first_screen()->visible_area().contains(c+xi-(pel_shift), line + yi))
+						if(x+xi < visarea.min_x || x+xi > visarea.max_x)
 							continue;
-						bitmapline[c+xi-pel_shift] = m_palette->pen(vga.memory[(pos+(xi >> 1)) & 0xffff]);
+						bitmapline[x+xi] = pens[vga.memory[(pos+(xi >> 1)) & 0xffff]];
 					}
 				}
 			}
@@ -62,6 +62,7 @@ protected:
 	virtual void device_reset() override;
 
 	void vga_vh_text(bitmap_rgb32 &bitmap, const rectangle &cliprect);
+	void vga_vh_text_row(bitmap_rgb32 &bitmap, const rectangle &visarea, uint64_t frame, int line, int addr, int hstart, int hend, int width, int height);
 	void vga_vh_ega(bitmap_rgb32 &bitmap,  const rectangle &cliprect);
 	void vga_vh_vga(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	void vga_vh_cga(bitmap_rgb32 &bitmap, const rectangle &cliprect);
@@ -231,6 +232,18 @@ protected:
 	emu_timer *m_vblank_timer;
 	required_device<palette_device> m_palette;
 	required_device<screen_device> m_screen;
+
+	// what each screen bitmap last showed in text mode, see vga_vh_text
+	struct text_cache
+	{
+		void *base = nullptr;                       // bitmap this describes
+		std::vector<uint8_t> state;                 // registers and pens it was drawn with
+		std::vector<std::vector<uint8_t>> rows;     // characters, attributes and glyph lines per row
+	};
+	text_cache m_text_cache[3];
+	int m_text_cache_next = 0;
+	uint64_t m_text_cache_frame = 0;
+	std::vector<uint8_t> m_text_key;
 };
 
 
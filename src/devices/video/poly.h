@@ -63,10 +63,12 @@
 #define POLYFLAG_INCLUDE_RIGHT_EDGE         0x02
 #define POLYFLAG_NO_WORK_QUEUE              0x04
 
-#define SCANLINES_PER_BUCKET                8
+#define SCANLINES_PER_BUCKET                8           // maximum; see set_bucket_height()
+#define MIN_SCANLINES_PER_BUCKET            2
 #define CACHE_LINE_SIZE                     64          // this is a general guess
-#define TOTAL_BUCKETS                       (512 / SCANLINES_PER_BUCKET)
 #define UNITS_PER_POLY                      (100 / SCANLINES_PER_BUCKET)
+#define PIXELS_PER_UNIT                     2048        // work per unit that adaptive bucket sizing aims for
+#define TILE_BINNING_WIDTH                  1024        // horizontal extent covered by distinct tile columns
 
 
 
@@ -131,6 +133,20 @@ public:
 	running_machine &machine() const { return m_machine; }
 	screen_device &screen() const { assert(m_screen != nullptr); return *m_screen; }
 	uint32_t triangles_drawn() const { return m_triangles; }
+	uint32_t conflicts() const { uint32_t total = 0; for (uint32_t count : m_conflicts) total += count; return total; }
+	uint32_t conflicts_resolved() const { uint32_t total = 0; for (uint32_t count : m_resolved) total += count; return total; }
+	int bucket_height() const { return m_bucket_height; }
+	int tile_width() const { return m_tile_width; }
+
+	// configuration; a height of 0 (the default) adapts it to the work queued
+	void set_bucket_height(int height);
+
+	// bin triangles into tiles this many pixels wide as well as into scanline
+	// buckets, so each unit only touches a small block of the frame/Z buffers;
+	// 0 (the default) keeps full-width units. Only render_triangle (and the
+	// fans/strips built on it) bins by tile; other primitives drain the queue
+	// around themselves while tiling is on
+	void set_tile_width(int width);
 
 	// synchronization
 	void wait(const char *debug_reason = "general");
@@ -241,8 +257,16 @@ private:
 	polygon_info &polygon_alloc(int minx, int maxx, int miny, int maxy, render_delegate callback)
 	{
 		// wait for space in the polygon and unit arrays
+		int units = (maxy - miny) / m_bucket_height + 2;
+		if (m_tile_width != 0)
+			units *= std::max(maxx - minx, 0) / m_tile_width + 2;
 		m_polygon.wait_for_space();
-		m_unit.wait_for_space((maxy - miny) / SCANLINES_PER_BUCKET + 2);
+		m_unit.wait_for_space(units);
+
+		// make sure every scanline touched has a bucket of its own
+		if (maxy >= 0 && (uint32_t(maxy) / m_bucket_height + 1) * m_tile_columns > m_unit_bucket.size())
+			m_unit_bucket.resize((uint32_t(maxy) / m_bucket_height + 1) * m_tile_columns, 0xffff);
+		m_scanlines += maxy - miny;
 
 		// return and initialize the next one
 		polygon_info &polygon = m_polygon.next();
@@ -252,8 +276,19 @@ private:
 		return polygon;
 	}
 
+	// bucket tracking the units that touch a scanline (and tile column, when binning by tile)
+	uint32_t bucket_index(int32_t scanline, uint32_t column = 0) const
+	{
+		uint32_t bucketnum = (uint32_t(scanline) / m_bucket_height) * m_tile_columns + column;
+		return (bucketnum < m_unit_bucket.size()) ? bucketnum : bucketnum % m_unit_bucket.size();
+	}
+
+	// primitives that aren't binned by tile can't be ordered against tiled units
+	void sync_untiled() { if (m_tile_width != 0 && m_unit.count() != 0) wait("untiled primitive"); }
+
 	static void *work_item_callback(void *param, int threadid);
 	void presave() { wait("pre-save"); }
+	void adapt_bucket_height();
 
 	// queue management
 	running_machine &   m_machine;
@@ -269,17 +304,21 @@ private:
 	uint8_t               m_flags;                    // flags
 
 	// buckets
-	uint16_t              m_unit_bucket[TOTAL_BUCKETS]; // buckets for tracking unit usage
+	std::vector<uint16_t> m_unit_bucket;            // buckets for tracking unit usage, one per m_bucket_height scanlines
+	int                 m_bucket_height;            // scanlines per bucket for the current batch
+	bool                m_adaptive_buckets;         // adjust m_bucket_height between batches?
+	int                 m_tile_width;               // pixels per tile column, or 0 for full-width units
+	int                 m_tile_columns;             // tile columns per bucket row
 
 	// statistics
 	uint32_t              m_tiles;                    // number of tiles queued
 	uint32_t              m_triangles;                // number of triangles queued
 	uint32_t              m_quads;                    // number of quads queued
 	uint64_t              m_pixels;                   // number of pixels rendered
-#if KEEP_POLY_STATISTICS
+	uint64_t              m_batch_pixels;             // value of m_pixels at the start of the batch
+	uint32_t              m_scanlines;                // number of scanlines queued this batch
 	uint32_t              m_conflicts[WORK_MAX_THREADS]; // number of conflicts found, per thread
 	uint32_t              m_resolved[WORK_MAX_THREADS];   // number of conflicts resolved, per thread
-#endif
 };
 
 
@@ -296,14 +335,19 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(runnin
 		m_object(machine, *this),
 		m_unit(machine, *this),
 		m_flags(flags),
+		m_bucket_height(SCANLINES_PER_BUCKET),
+		m_adaptive_buckets(true),
+		m_tile_width(0),
+		m_tile_columns(1),
 		m_triangles(0),
 		m_quads(0),
-		m_pixels(0)
+		m_pixels(0),
+		m_batch_pixels(0),
+		m_scanlines(0)
 {
-#if KEEP_POLY_STATISTICS
 	memset(m_conflicts, 0, sizeof(m_conflicts));
 	memset(m_resolved, 0, sizeof(m_resolved));
-#endif
+	m_unit_bucket.resize(512 / SCANLINES_PER_BUCKET, 0xffff);
 
 	// create the work queue
 	if (!(flags & POLYFLAG_NO_WORK_QUEUE))
@@ -323,14 +367,19 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(screen
 		m_object(screen.machine(), *this),
 		m_unit(screen.machine(), *this),
 		m_flags(flags),
+		m_bucket_height(SCANLINES_PER_BUCKET),
+		m_adaptive_buckets(true),
+		m_tile_width(0),
+		m_tile_columns(1),
 		m_triangles(0),
 		m_quads(0),
-		m_pixels(0)
+		m_pixels(0),
+		m_batch_pixels(0),
+		m_scanlines(0)
 {
-#if KEEP_POLY_STATISTICS
 	memset(m_conflicts, 0, sizeof(m_conflicts));
 	memset(m_resolved, 0, sizeof(m_resolved));
-#endif
+	m_unit_bucket.resize(512 / SCANLINES_PER_BUCKET, 0xffff);
 
 	// create the work queue
 	if (!(flags & POLYFLAG_NO_WORK_QUEUE))
@@ -351,12 +400,7 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::~poly_manager()
 #if KEEP_POLY_STATISTICS
 {
 	// accumulate stats over the entire collection
-	int conflicts = 0, resolved = 0;
-	for (int i = 0; i < ARRAY_LENGTH(m_conflicts); i++)
-	{
-		conflicts += m_conflicts[i];
-		resolved += m_resolved[i];
-	}
+	int conflicts = this->conflicts(), resolved = conflicts_resolved();
 
 	// output global stats
 	printf("Total triangles = %d\n", m_triangles);
@@ -409,12 +453,10 @@ void *poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::work_item_cal
 					new_count_next = orig_count_next | (unitnum << 16);
 				} while (!prevunit.count_next.compare_exchange_weak(orig_count_next, new_count_next, std::memory_order_release, std::memory_order_relaxed));
 
-#if KEEP_POLY_STATISTICS
 				// track resolved conflicts
 				polygon.m_owner->m_conflicts[threadid]++;
 				if (orig_count_next != 0)
 					polygon.m_owner->m_resolved[threadid]++;
-#endif
 				// if we succeeded, skip out early so we can do other work
 				if (orig_count_next != 0)
 					break;
@@ -474,7 +516,8 @@ void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::wait(const cha
 	// reset the state
 	m_polygon.reset();
 	m_unit.reset();
-	memset(m_unit_bucket, 0xff, sizeof(m_unit_bucket));
+	adapt_bucket_height();
+	std::fill(m_unit_bucket.begin(), m_unit_bucket.end(), 0xffff);
 
 	// we need to preserve the last object data that was supplied
 	if (m_object.count() > 0)
@@ -488,6 +531,67 @@ void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::wait(const cha
 }
 
 
+//-------------------------------------------------
+//  set_bucket_height - fix the number of scanlines
+//  each bucket covers, or 0 to adapt it
+//-------------------------------------------------
+
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::set_bucket_height(int height)
+{
+	assert(height >= 0 && height <= SCANLINES_PER_BUCKET);
+
+	// buckets can only change between batches
+	wait("bucket height");
+	m_adaptive_buckets = (height == 0);
+	if (!m_adaptive_buckets)
+		m_bucket_height = height;
+}
+
+
+//-------------------------------------------------
+//  set_tile_width - set the width of the tiles
+//  triangles are binned into, or 0 to disable
+//-------------------------------------------------
+
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::set_tile_width(int width)
+{
+	assert(width >= 0 && width <= TILE_BINNING_WIDTH);
+
+	// the bucket layout can only change between batches
+	wait("tile width");
+	m_tile_width = width;
+	m_tile_columns = (width != 0) ? (TILE_BINNING_WIDTH + width - 1) / width : 1;
+	m_unit_bucket.assign((512 / SCANLINES_PER_BUCKET) * m_tile_columns, 0xffff);
+}
+
+
+//-------------------------------------------------
+//  adapt_bucket_height - pick the bucket height
+//  for the next batch from the pixels per scanline
+//  of the last one; wide spans get shorter units,
+//  so that more of them can run at once, while
+//  narrow ones keep enough work per unit to be
+//  worth queueing
+//-------------------------------------------------
+
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::adapt_bucket_height()
+{
+	if (m_adaptive_buckets && m_scanlines != 0)
+	{
+		uint64_t perline = (m_pixels - m_batch_pixels) / m_scanlines;
+		int height = SCANLINES_PER_BUCKET;
+		while (height > MIN_SCANLINES_PER_BUCKET && perline * height > PIXELS_PER_UNIT)
+			height /= 2;
+		m_bucket_height = height;
+	}
+	m_batch_pixels = m_pixels;
+	m_scanlines = 0;
+}
+
+
 //-------------------------------------------------
 //  object_data_alloc - allocate a new _ObjectData
 //-------------------------------------------------
@@ -538,6 +642,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_til
 		return 0;
 
 	// allocate and populate a new polygon
+	sync_untiled();
 	polygon_info &polygon = polygon_alloc(round_coordinate(minx), round_coordinate(maxx), v1yclip, v2yclip, callback);
 
 	// compute parameter deltas
@@ -584,12 +689,12 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_til
 	int32_t scaninc = 1;
 	for (int32_t curscan = v1yclip; curscan < v2yclip; curscan += scaninc)
 	{
-		uint32_t bucketnum = ((uint32_t)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+		uint32_t bucketnum = bucket_index(curscan);
 		uint32_t unit_index = m_unit.count();
 		work_unit &unit = m_unit.next();
 
 		// determine how much to advance to hit the next bucket
-		scaninc = SCANLINES_PER_BUCKET - (uint32_t)curscan % SCANLINES_PER_BUCKET;
+		scaninc = m_bucket_height - (uint32_t)curscan % m_bucket_height;
 
 		// fill in the work unit basics
 		unit.polygon = &polygon;
@@ -624,6 +729,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_til
 	// enqueue the work items
 	if (m_queue != nullptr)
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	sync_untiled();
 
 	// return the total number of pixels in the triangle
 	m_tiles++;
@@ -685,7 +791,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tri
 	else if (v3->x > maxx) maxx = v3->x;
 
 	// allocate and populate a new polygon
-	polygon_info &polygon = polygon_alloc(round_coordinate(minx), round_coordinate(maxx), v1yclip, v3yclip, callback);
+	polygon_info &polygon = polygon_alloc(std::max(round_coordinate(minx), cliprect.min_x), std::min(round_coordinate(maxx), cliprect.max_x), v1yclip, v3yclip, callback);
 
 	// compute the slopes for each portion of the triangle
 	_BaseType dxdy_v1v2 = (v2->y == v1->y) ? _BaseType(0.0) : (v2->x - v1->x) / (v2->y - v1->y);
@@ -742,22 +848,15 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tri
 	int32_t scaninc = 1;
 	for (int32_t curscan = v1yclip; curscan < v3yclip; curscan += scaninc)
 	{
-		uint32_t bucketnum = ((uint32_t)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
-		uint32_t unit_index = m_unit.count();
-		work_unit &unit = m_unit.next();
+		int32_t bandstartx[SCANLINES_PER_BUCKET], bandstopx[SCANLINES_PER_BUCKET];
+		int32_t bandminx = INT_MAX, bandmaxx = INT_MIN;
 
 		// determine how much to advance to hit the next bucket
-		scaninc = SCANLINES_PER_BUCKET - (uint32_t)curscan % SCANLINES_PER_BUCKET;
-
-		// fill in the work unit basics
-		unit.polygon = &polygon;
-		unit.count_next = std::min(v3yclip - curscan, scaninc);
-		unit.scanline = curscan;
-		unit.previtem = m_unit_bucket[bucketnum];
-		m_unit_bucket[bucketnum] = unit_index;
+		scaninc = m_bucket_height - (uint32_t)curscan % m_bucket_height;
+		int32_t count = std::min(v3yclip - curscan, scaninc);
 
 		// iterate over extents
-		for (int extnum = 0; extnum < unit.count_next; extnum++)
+		for (int extnum = 0; extnum < count; extnum++)
 		{
 			// compute the ending X based on which part of the triangle we're in
 			_BaseType fully = _BaseType(curscan + extnum) + _BaseType(0.5);
@@ -790,21 +889,66 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tri
 			if (istopx > cliprect.max_x)
 				istopx = cliprect.max_x + 1;
 
-			// set the extent and update the total pixel count
+			// remember the extent and the band's overall X range
 			if (istartx >= istopx)
 				istartx = istopx = 0;
-			extent_t &extent = unit.extent[extnum];
-			extent.startx = istartx;
-			extent.stopx = istopx;
-			extent.userdata = nullptr;
-			pixels += istopx - istartx;
+			else
+			{
+				bandminx = std::min(bandminx, istartx);
+				bandmaxx = std::max(bandmaxx, istopx);
+			}
+			bandstartx[extnum] = istartx;
+			bandstopx[extnum] = istopx;
+		}
 
-			// fill in the parameters for the extent
-			_BaseType fullstartx = _BaseType(istartx) + _BaseType(0.5);
-			for (int paramnum = 0; paramnum < paramcount; paramnum++)
+		// when binning by tile, queue one unit per tile column the band touches
+		int32_t firstcol = 0, lastcol = 0;
+		if (m_tile_width != 0)
+		{
+			if (bandminx >= bandmaxx)
+				continue;
+			firstcol = bandminx / m_tile_width;
+			lastcol = (bandmaxx - 1) / m_tile_width;
+		}
+
+		for (int32_t column = firstcol; column <= lastcol; column++)
+		{
+			const int32_t tileminx = (m_tile_width != 0) ? column * m_tile_width : INT_MIN;
+			const int32_t tilemaxx = (m_tile_width != 0) ? tileminx + m_tile_width : INT_MAX;
+			uint32_t bucketnum = bucket_index(curscan, column % m_tile_columns);
+			uint32_t unit_index = m_unit.count();
+			work_unit &unit = m_unit.next();
+
+			// fill in the work unit basics
+			unit.polygon = &polygon;
+			unit.count_next = count;
+			unit.scanline = curscan;
+			unit.previtem = m_unit_bucket[bucketnum];
+			m_unit_bucket[bucketnum] = unit_index;
+
+			// clip each extent to the tile
+			for (int extnum = 0; extnum < count; extnum++)
 			{
-				extent.param[paramnum].start = param_start[paramnum] + fullstartx * param_dpdx[paramnum] + fully * param_dpdy[paramnum];
-				extent.param[paramnum].dpdx = param_dpdx[paramnum];
+				int32_t istartx = std::max(bandstartx[extnum], tileminx);
+				int32_t istopx = std::min(bandstopx[extnum], tilemaxx);
+
+				// set the extent and update the total pixel count
+				if (istartx >= istopx)
+					istartx = istopx = 0;
+				extent_t &extent = unit.extent[extnum];
+				extent.startx = istartx;
+				extent.stopx = istopx;
+				extent.userdata = nullptr;
+				pixels += istopx - istartx;
+
+				// fill in the parameters for the extent
+				_BaseType fully = _BaseType(curscan + extnum) + _BaseType(0.5);
+				_BaseType fullstartx = _BaseType(istartx) + _BaseType(0.5);
+				for (int paramnum = 0; paramnum < paramcount; paramnum++)
+				{
+					extent.param[paramnum].start = param_start[paramnum] + fullstartx * param_dpdx[paramnum] + fully * param_dpdy[paramnum];
+					extent.param[paramnum].dpdx = param_dpdx[paramnum];
+				}
 			}
 		}
 	}
@@ -867,6 +1011,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tri
 		return 0;
 
 	// allocate and populate a new polygon
+	sync_untiled();
 	polygon_info &polygon = polygon_alloc(0, 0, v1yclip, v3yclip, callback);
 
 	// compute the X extents for each scanline
@@ -875,12 +1020,12 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tri
 	int32_t scaninc = 1;
 	for (int32_t curscan = v1yclip; curscan < v3yclip; curscan += scaninc)
 	{
-		uint32_t bucketnum = ((uint32_t)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+		uint32_t bucketnum = bucket_index(curscan);
 		uint32_t unit_index = m_unit.count();
 		work_unit &unit = m_unit.next();
 
 		// determine how much to advance to hit the next bucket
-		scaninc = SCANLINES_PER_BUCKET - (uint32_t)curscan % SCANLINES_PER_BUCKET;
+		scaninc = m_bucket_height - (uint32_t)curscan % m_bucket_height;
 
 		// fill in the work unit basics
 		unit.polygon = &polygon;
@@ -928,6 +1073,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tri
 	// enqueue the work items
 	if (m_queue != nullptr)
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	sync_untiled();
 
 	// return the total number of pixels in the object
 	m_triangles++;
@@ -975,6 +1121,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_pol
 		return 0;
 
 	// allocate a new polygon
+	sync_untiled();
 	polygon_info &polygon = polygon_alloc(round_coordinate(minx), round_coordinate(maxx), minyclip, maxyclip, callback);
 
 	// walk forward to build up the forward edge list
@@ -1050,12 +1197,12 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_pol
 	int32_t scaninc = 1;
 	for (int32_t curscan = minyclip; curscan < maxyclip; curscan += scaninc)
 	{
-		uint32_t bucketnum = ((uint32_t)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+		uint32_t bucketnum = bucket_index(curscan);
 		uint32_t unit_index = m_unit.count();
 		work_unit &unit = m_unit.next();
 
 		// determine how much to advance to hit the next bucket
-		scaninc = SCANLINES_PER_BUCKET - (uint32_t)curscan % SCANLINES_PER_BUCKET;
+		scaninc = m_bucket_height - (uint32_t)curscan % m_bucket_height;
 
 		// fill in the work unit basics
 		unit.polygon = &polygon;
@@ -1127,6 +1274,7 @@ uint32_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_pol
 	// enqueue the work items
 	if (m_queue != nullptr)
 		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	sync_untiled();
 
 	// return the total number of pixels in the triangle
 	m_quads++;
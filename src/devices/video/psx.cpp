@@ -14,6 +14,9 @@
 
 #define VERBOSE_LEVEL ( 0 )
 
+/* number of GP0 words to collect before handing them to the worker */
+#define GP0_BATCH_WORDS ( 256 )
+
 // device type definition
 const device_type CXD8514Q = &device_creator<cxd8514q_device>;
 const device_type CXD8538Q = &device_creator<cxd8538q_device>;
@@ -24,6 +27,8 @@ const device_type CXD8654Q = &device_creator<cxd8654q_device>;
 
 psxgpu_device::psxgpu_device(const machine_config &mconfig, device_type type, const char *name, const char *tag, device_t *owner, uint32_t clock, const char *shortname, const char *source) :
 	device_t(mconfig, type, name, tag, owner, clock, shortname, source),
+	m_gp0_queue(nullptr),
+	m_gp0_item(nullptr),
 	m_vblank_handler(*this)
 #if DEBUG_VIEWER
 ,
@@ -44,6 +49,10 @@ void psxgpu_device::device_start( void )
 	{
 		psx_gpu_init( 2 );
 	}
+
+	/* a single worker keeps the GP0 stream in order */
+	m_gp0_queue = osd_work_queue_alloc( 0 );
+	machine().save().register_presave( save_prepost_delegate( FUNC( psxgpu_device::gp0_sync ), this ) );
 }
 
 void psxgpu_device::device_reset( void )
@@ -51,6 +60,16 @@ void psxgpu_device::device_reset( void )
 	gpu_reset();
 }
 
+void psxgpu_device::device_stop( void )
+{
+	gp0_sync();
+	if( m_gp0_queue != nullptr )
+	{
+		osd_work_queue_free( m_gp0_queue );
+		m_gp0_queue = nullptr;
+	}
+}
+
 cxd8514q_device::cxd8514q_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock)
 	: psxgpu_device(mconfig, CXD8514Q, "CXD8514Q GPU", tag, owner, clock, "cxd8514q", __FILE__)
 {
@@ -607,6 +626,8 @@ void psxgpu_device::psx_gpu_init( int n_gputype )
 
 uint32_t psxgpu_device::update_screen(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect)
 {
+	gp0_sync();
+
 	uint32_t n_x;
 	uint32_t n_y;
 	int n_top;
@@ -3037,7 +3058,66 @@ void psxgpu_device::MoveImage( void )
 
 void psxgpu_device::dma_write( uint32_t *p_n_psxram, uint32_t n_address, int32_t n_size )
 {
-	gpu_write( &p_n_psxram[ n_address / 4 ], n_size );
+	gp0_queue( &p_n_psxram[ n_address / 4 ], n_size );
+}
+
+/*
+GP0 words are collected on the CPU thread and parsed and rasterized on a
+worker, one batch at a time. Everything else that touches GPU state (status
+and GPUREAD reads, GP1 writes, DMA reads, vblank, screen updates and saving)
+calls gp0_sync() first, which waits for the worker and runs whatever is still
+pending, so the worker never races the CPU thread.
+*/
+
+void psxgpu_device::gp0_queue( uint32_t *p_ram, int32_t n_size )
+{
+	m_gp0_pending.insert( m_gp0_pending.end(), p_ram, p_ram + n_size );
+
+	/* keep the worker fed, but don't stall the CPU waiting for it */
+	if( m_gp0_pending.size() >= GP0_BATCH_WORDS &&
+		( m_gp0_item == nullptr || osd_work_item_wait( m_gp0_item, 0 ) ) )
+	{
+		gp0_wait();
+		m_gp0_active.swap( m_gp0_pending );
+		m_gp0_item = osd_work_item_queue( m_gp0_queue, gp0_execute_static, this, 0 );
+		if( m_gp0_item == nullptr )
+		{
+			gp0_execute();
+		}
+	}
+}
+
+void *psxgpu_device::gp0_execute_static( void *param, int threadid )
+{
+	static_cast<psxgpu_device *>( param )->gp0_execute();
+	return nullptr;
+}
+
+void psxgpu_device::gp0_execute()
+{
+	gpu_write( m_gp0_active.data(), m_gp0_active.size() );
+	m_gp0_active.clear();
+}
+
+void psxgpu_device::gp0_wait()
+{
+	if( m_gp0_item != nullptr )
+	{
+		// the item may still be using m_gp0_active, so never give up on it
+		while( !osd_work_item_wait( m_gp0_item, 10 * osd_ticks_per_second() ) ) { }
+		osd_work_item_release( m_gp0_item );
+		m_gp0_item = nullptr;
+	}
+}
+
+void psxgpu_device::gp0_sync()
+{
+	gp0_wait();
+	if( !m_gp0_pending.empty() )
+	{
+		gpu_write( m_gp0_pending.data(), m_gp0_pending.size() );
+		m_gp0_pending.clear();
+	}
 }
 
 void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
@@ -3530,9 +3610,10 @@ WRITE32_MEMBER( psxgpu_device::write )
 	switch( offset )
 	{
 	case 0x00:
-		gpu_write( &data, 1 );
+		gp0_queue( &data, 1 );
 		break;
 	case 0x01:
+		gp0_sync();
 		switch( data >> 24 )
 		{
 		case 0x00:
@@ -3670,6 +3751,7 @@ WRITE32_MEMBER( psxgpu_device::write )
 
 void psxgpu_device::dma_read( uint32_t *p_n_psxram, uint32_t n_address, int32_t n_size )
 {
+	gp0_sync();
 	gpu_read( &p_n_psxram[ n_address / 4 ], n_size );
 }
 
@@ -3725,6 +3807,8 @@ READ32_MEMBER( psxgpu_device::read )
 {
 	uint32_t data;
 
+	gp0_sync();
+
 	switch( offset )
 	{
 	case 0x00:
@@ -3746,6 +3830,8 @@ void psxgpu_device::vblank(screen_device &screen, bool vblank_state)
 {
 	if( vblank_state )
 	{
+		gp0_sync();
+
 #if DEBUG_VIEWER
 		DebugCheckKeys();
 #endif
@@ -3758,6 +3844,7 @@ void psxgpu_device::vblank(screen_device &screen, bool vblank_state)
 void psxgpu_device::gpu_reset( void )
 {
 	verboselog( *this, 1, "reset gpu\n" );
+	gp0_sync();
 	n_gpu_buffer_offset = 0;
 	n_gpustatus = 0x14802000;
 	n_drawarea_x1 = 0;
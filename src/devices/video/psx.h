@@ -207,6 +207,7 @@ public:
 protected:
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_stop() override;
 
 private:
 	void updatevisiblearea();
@@ -230,6 +231,11 @@ private:
 	void gpu_reset();
 	void gpu_read( uint32_t *p_ram, int32_t n_size );
 	void gpu_write( uint32_t *p_ram, int32_t n_size );
+	void gp0_queue( uint32_t *p_ram, int32_t n_size );
+	static void *gp0_execute_static( void *param, int threadid );
+	void gp0_execute();
+	void gp0_wait();
+	void gp0_sync();
 
 	int32_t m_n_tx;
 	int32_t m_n_ty;
@@ -272,6 +278,11 @@ private:
 
 	uint16_t *p_p_vram[ 1024 ];
 
+	osd_work_queue *m_gp0_queue;
+	osd_work_item *m_gp0_item;              // batch being rasterized by the worker, if any
+	std::vector<uint32_t> m_gp0_active;     // words the worker is executing
+	std::vector<uint32_t> m_gp0_pending;    // words written since the last batch
+
 	uint16_t p_n_redshade[ MAX_LEVEL * MAX_SHADE ];
 	uint16_t p_n_greenshade[ MAX_LEVEL * MAX_SHADE ];
 	uint16_t p_n_blueshade[ MAX_LEVEL * MAX_SHADE ];
@@ -225,6 +225,9 @@ void snes_ppu_device::device_start()
 	m_cgram = std::make_unique<uint16_t[]>(SNES_CGRAM_SIZE/2);
 	m_oam_ram = std::make_unique<uint16_t[]>(SNES_OAM_SIZE/2);
 
+	m_bgline_cache = make_unique_clear<struct BGLINE[]>((SNES_BG4 + 1) * SNES_BGLINE_CACHE_LINES);
+	m_vram_serial = 1;
+
 	for (int i = 0; i < 2; i++)
 	{
 		save_item(NAME(m_scanlines[i].enable), i);
@@ -365,6 +368,12 @@ void snes_ppu_device::device_start()
 	save_pointer(NAME(m_oam_ram.get()), SNES_OAM_SIZE/2);
 }
 
+void snes_ppu_device::device_post_load()
+{
+	/* VRAM has been replaced behind our back */
+	m_vram_serial++;
+}
+
 void snes_ppu_device::device_reset()
 {
 #if SNES_LAYER_DEBUG
@@ -645,11 +654,10 @@ inline void snes_ppu_device::draw_oamtile( int16_t ii, uint8_t colour, uint16_t
  * (depending on layer and resolution)
  *****************************************/
 
-inline void snes_ppu_device::draw_tile( uint8_t planes, uint8_t layer, uint32_t tileaddr, int16_t x, uint8_t priority, uint8_t flip, uint8_t direct_colors, uint16_t pal, uint8_t hires )
+inline void snes_ppu_device::decode_tile( uint8_t planes, uint32_t tileaddr, uint8_t flip, uint8_t *colours )
 {
 	uint8_t plane[8];
 	int16_t ii, jj;
-	int x_mos;
 
 	for (ii = 0; ii < planes / 2; ii++)
 	{
@@ -657,27 +665,43 @@ inline void snes_ppu_device::draw_tile( uint8_t planes, uint8_t layer, uint32_t
 		plane[2 * ii + 1] = m_vram[(tileaddr + 16 * ii + 1) % SNES_VRAM_SIZE];
 	}
 
-	for (ii = x; ii < (x + 8); ii++)
+	for (ii = 0; ii < 8; ii++)
 	{
 		uint8_t colour = 0;
-		uint8_t mosaic = m_layer[layer].mosaic_enabled;
-
-#if SNES_LAYER_DEBUG
-		if (m_debug_options.mosaic_disabled)
-			mosaic = 0;
-#endif /* SNES_LAYER_DEBUG */
 
 		if (flip)
 		{
 			for (jj = 0; jj < planes; jj++)
-				colour |= BIT(plane[jj], ii - x) ? (1 << jj) : 0;
+				colour |= BIT(plane[jj], ii) ? (1 << jj) : 0;
 		}
 		else
 		{
 			for (jj = 0; jj < planes; jj++)
-				colour |= BIT(plane[jj], 7 - (ii - x)) ? (1 << jj) : 0;
+				colour |= BIT(plane[jj], 7 - ii) ? (1 << jj) : 0;
 		}
 
+		colours[ii] = colour;
+	}
+}
+
+inline void snes_ppu_device::draw_tile( uint8_t planes, uint8_t layer, uint32_t tileaddr, int16_t x, uint8_t priority, uint8_t flip, uint8_t direct_colors, uint16_t pal, uint8_t hires )
+{
+	uint8_t colours[8];
+	int16_t ii;
+	int x_mos;
+
+	decode_tile(planes, tileaddr, flip, colours);
+
+	for (ii = x; ii < (x + 8); ii++)
+	{
+		uint8_t colour = colours[ii - x];
+		uint8_t mosaic = m_layer[layer].mosaic_enabled;
+
+#if SNES_LAYER_DEBUG
+		if (m_debug_options.mosaic_disabled)
+			mosaic = 0;
+#endif /* SNES_LAYER_DEBUG */
+
 		if (layer == SNES_OAM)
 			draw_oamtile(ii, colour, pal, priority);
 		else if (!hires)
@@ -705,6 +729,74 @@ inline void snes_ppu_device::draw_tile( uint8_t planes, uint8_t layer, uint32_t
 	}
 }
 
+/*****************************************
+ * add_bgline_tile()
+ * draw_bgline()
+ *
+ * BG lines are decoded into a BGLINE
+ * first and then handed to the scanline
+ * buffers in a separate pass, which picks
+ * the lores/hires and mosaic variant
+ * once for the whole line
+ *****************************************/
+
+inline void snes_ppu_device::add_bgline_tile( struct BGLINE &line, uint8_t planes, uint32_t tileaddr, int16_t x, uint8_t priority, uint8_t flip, uint16_t pal )
+{
+	struct BGTILE &tile = line.tile[line.count++];
+
+	tile.x = x;
+	tile.pal = pal;
+	tile.priority = priority;
+	decode_tile(planes, tileaddr, flip, tile.colour);
+}
+
+void snes_ppu_device::draw_bgline( const struct BGLINE &line, uint8_t layer, uint8_t direct_colors, uint8_t hires )
+{
+	uint8_t mosaic = m_layer[layer].mosaic_enabled;
+	int16_t ii;
+	int x_mos;
+
+#if SNES_LAYER_DEBUG
+	if (m_debug_options.mosaic_disabled)
+		mosaic = 0;
+#endif /* SNES_LAYER_DEBUG */
+
+	for (int i = 0; i < line.count; i++)
+	{
+		const struct BGTILE &tile = line.tile[i];
+		const int16_t x = tile.x;
+
+		if (!hires)
+		{
+			if (mosaic)
+			{
+				for (ii = x; ii < (x + 8); ii += m_mosaic_size + 1)
+					for (x_mos = 0; x_mos < (m_mosaic_size + 1); x_mos++)
+						draw_bgtile_lores(layer, ii + x_mos, tile.colour[ii - x], tile.pal, direct_colors, tile.priority);
+			}
+			else
+			{
+				for (ii = x; ii < (x + 8); ii++)
+					draw_bgtile_lores(layer, ii, tile.colour[ii - x], tile.pal, direct_colors, tile.priority);
+			}
+		}
+		else /* hires */
+		{
+			if (mosaic)
+			{
+				for (ii = x; ii < (x + 8); ii += m_mosaic_size + 1)
+					for (x_mos = 0; x_mos < (m_mosaic_size + 1); x_mos++)
+						draw_bgtile_hires(layer, ii + x_mos, tile.colour[ii - x], tile.pal, direct_colors, tile.priority);
+			}
+			else
+			{
+				for (ii = x; ii < (x + 8); ii++)
+					draw_bgtile_hires(layer, ii, tile.colour[ii - x], tile.pal, direct_colors, tile.priority);
+			}
+		}
+	}
+}
+
 /*************************************************************************************************
  * SNES BG layers
  *
@@ -794,6 +886,39 @@ inline void snes_ppu_device::update_line( uint16_t curline, uint8_t layer, uint8
 
 	xscroll = xoff & ((1 << (3 + tile_size)) - 1);
 
+	/* Reuse the decoded tiles if neither VRAM nor anything they depend on has changed */
+	struct BGLINE *line = nullptr;
+	if (curline < SNES_BGLINE_CACHE_LINES)
+	{
+		uint32_t key[5];
+
+		key[0] = xoff | (yoff << 16);
+		key[1] = m_layer[layer].charmap | (m_layer[layer].tilemap << 8) | (m_layer[layer].tilemap_size << 16) | (tile_size << 24);
+		key[2] = priority_a | (priority_b << 8) | (color_depth << 16) | (hires << 18) | (offset_per_tile << 19) | (direct_colors << 21) | ((m_mode == 0) << 22);
+		key[3] = key[4] = 0;
+		if (offset_per_tile != SNES_OPT_NONE)
+		{
+			key[3] = m_layer[SNES_BG3].hoffs | (m_layer[SNES_BG3].voffs << 16);
+			key[4] = m_layer[SNES_BG3].tilemap | (m_layer[SNES_BG3].tilemap_size << 8) | (m_layer[SNES_BG3].tile_size << 16);
+		}
+#if SNES_LAYER_DEBUG
+		key[4] |= m_debug_options.select_pri[layer] << 24;
+#endif /* SNES_LAYER_DEBUG */
+
+		line = &m_bgline_cache[layer * SNES_BGLINE_CACHE_LINES + curline];
+		if (line->vram_serial == m_vram_serial && !memcmp(line->key, key, sizeof(key)))
+		{
+			draw_bgline(*line, layer, direct_colors, hires);
+			return;
+		}
+
+		line->vram_serial = m_vram_serial;
+		memcpy(line->key, key, sizeof(key));
+	}
+	else
+		line = &m_bgline_scratch;
+	line->count = 0;
+
 	/* Jump to base map address */
 	tmap = m_layer[layer].tilemap << 9;
 	charaddr = m_layer[layer].charmap << 13;
@@ -909,22 +1034,24 @@ inline void snes_ppu_device::update_line( uint16_t curline, uint8_t layer, uint8
 		if (hires)
 		{
 			/* draw 16 pixels (the routine will automatically send half of them to the mainscreen scanline and half to the subscreen one) */
-			draw_tile(color_planes, layer, charaddr + (((tile + 0)         & 0x3ff) * 8 * color_planes) + yscroll, (ii - xscroll) * 2,     priority, hflip, direct_colors, direct_colors ? pal_direct : pal, hires);
-			draw_tile(color_planes, layer, charaddr + (((tile + tile_incr) & 0x3ff) * 8 * color_planes) + yscroll, (ii - xscroll) * 2 + 8, priority, hflip, direct_colors, direct_colors ? pal_direct : pal, hires);
+			add_bgline_tile(*line, color_planes, charaddr + (((tile + 0)         & 0x3ff) * 8 * color_planes) + yscroll, (ii - xscroll) * 2,     priority, hflip, direct_colors ? pal_direct : pal);
+			add_bgline_tile(*line, color_planes, charaddr + (((tile + tile_incr) & 0x3ff) * 8 * color_planes) + yscroll, (ii - xscroll) * 2 + 8, priority, hflip, direct_colors ? pal_direct : pal);
 			ii += 8;
 		}
 		else
 		{
-			draw_tile(color_planes, layer, charaddr + ((tile & 0x3ff) * 8 * color_planes) + yscroll, ii - xscroll, priority, hflip, direct_colors, direct_colors ? pal_direct : pal, hires);
+			add_bgline_tile(*line, color_planes, charaddr + ((tile & 0x3ff) * 8 * color_planes) + yscroll, ii - xscroll, priority, hflip, direct_colors ? pal_direct : pal);
 			ii += 8;
 
 			if (tile_size)
 			{
-				draw_tile(color_planes, layer, charaddr + (((tile + tile_incr) & 0x3ff) * 8 * color_planes) + yscroll, ii - xscroll, priority, hflip, direct_colors, direct_colors ? pal_direct : pal, hires);
+				add_bgline_tile(*line, color_planes, charaddr + (((tile + tile_incr) & 0x3ff) * 8 * color_planes) + yscroll, ii - xscroll, priority, hflip, direct_colors ? pal_direct : pal);
 				ii += 8;
 			}
 		}
 	}
+
+	draw_bgline(*line, layer, direct_colors, hires);
 }
 
 
@@ -2091,6 +2218,8 @@ WRITE8_MEMBER( snes_ppu_device::vram_write )
 {
 	offset &= 0xffff; // only 64KB are present on SNES, Robocop 3 relies on this
 
+	m_vram_serial++;
+
 	if (m_screen_disabled)
 		m_vram[offset] = data;
 	else
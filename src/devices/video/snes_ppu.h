@@ -31,6 +31,10 @@
 
 #define SNES_LAYER_DEBUG  0
 
+/* decoded BG line cache */
+#define SNES_BGLINE_CACHE_LINES  512    /* covers interlaced hires lines */
+#define SNES_BGLINE_MAX_TILES    68     /* 34 columns of 16 pixel wide hires tiles */
+
 
 /* offset-per-tile modes */
 enum
@@ -167,6 +171,27 @@ public:
 
 	struct TILELIST m_oam_tilelist[34];
 
+	/* BG tiles of a line, decoded from VRAM but not yet clipped or composited;
+	   they only depend on VRAM and the layer registers, so they can be reused
+	   by later lines and frames as long as neither has changed */
+	struct BGTILE {
+		int16_t x;
+		uint16_t pal;
+		uint8_t priority;
+		uint8_t colour[8];
+	};
+
+	struct BGLINE {
+		uint64_t vram_serial;   /* m_vram_serial at decode time, 0 = never decoded */
+		uint32_t key[5];
+		uint8_t count;
+		struct BGTILE tile[SNES_BGLINE_MAX_TILES];
+	};
+
+	std::unique_ptr<struct BGLINE[]> m_bgline_cache;    /* [SNES_BG4 + 1][SNES_BGLINE_CACHE_LINES] */
+	struct BGLINE m_bgline_scratch;     /* used for lines past the end of the cache */
+	uint64_t m_vram_serial;     /* bumped on every VRAM write */
+
 #if SNES_LAYER_DEBUG
 	struct DEBUGOPTS
 	{
@@ -229,7 +254,10 @@ public:
 	inline void draw_bgtile_lores(uint8_t layer, int16_t ii, uint8_t colour, uint16_t pal, uint8_t direct_colors, uint8_t priority);
 	inline void draw_bgtile_hires(uint8_t layer, int16_t ii, uint8_t colour, uint16_t pal, uint8_t direct_colors, uint8_t priority);
 	inline void draw_oamtile(int16_t ii, uint8_t colour, uint16_t pal, uint8_t priority);
+	inline void decode_tile(uint8_t planes, uint32_t tileaddr, uint8_t flip, uint8_t *colours);
 	inline void draw_tile(uint8_t planes, uint8_t layer, uint32_t tileaddr, int16_t x, uint8_t priority, uint8_t flip, uint8_t direct_colors, uint16_t pal, uint8_t hires);
+	inline void add_bgline_tile(struct BGLINE &line, uint8_t planes, uint32_t tileaddr, int16_t x, uint8_t priority, uint8_t flip, uint16_t pal);
+	void draw_bgline(const struct BGLINE &line, uint8_t layer, uint8_t direct_colors, uint8_t hires);
 	inline uint32_t get_tmap_addr(uint8_t layer, uint8_t tile_size, uint32_t base, uint32_t x, uint32_t y);
 	inline void update_line(uint16_t curline, uint8_t layer, uint8_t priority_b, uint8_t priority_a, uint8_t color_depth, uint8_t hires, uint8_t offset_per_tile, uint8_t direct_colors);
 	void update_line_mode7(uint16_t curline, uint8_t layer, uint8_t priority_b, uint8_t priority_a);
@@ -275,6 +303,7 @@ protected:
 	// device-level overrides
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_post_load() override;
 
 private:
 	devcb_read16  m_openbus_cb;
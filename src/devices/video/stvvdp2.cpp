@@ -4540,7 +4540,7 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 										int planerenderedsizex,
 										int planerenderedsizey)
 {
-	int32_t xsp, ysp, xp, yp, dx, dy, x, y, xs, ys, dxs, dys;
+	int32_t xsp, ysp, xp, yp, dx, dy, x, y;
 	int32_t vcnt, hcnt;
 	int32_t kx, ky;
 	int8_t  use_coeff_table, coeff_table_mode, coeff_table_size, coeff_table_shift;
@@ -4667,30 +4667,15 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 	xp = mul_fixed32( RP.A, RP.px - RP.cx ) + mul_fixed32( RP.B, RP.py - RP.cy ) + mul_fixed32( RP.C, RP.pz - RP.cz ) + RP.cx + RP.mx;
 	yp = mul_fixed32( RP.D, RP.px - RP.cx ) + mul_fixed32( RP.E, RP.py - RP.cy ) + mul_fixed32( RP.F, RP.pz - RP.cz ) + RP.cy + RP.my;
 
-	for (vcnt = cliprect.min_y; vcnt <= cliprect.max_y; vcnt++ )
+	if ( !use_coeff_table || RP.dkax == 0 )
 	{
-		/*xsp = RP.A * ( ( RP.xst + RP.dxst * (vcnt << 16) ) - RP.px ) +
-		      RP.B * ( ( RP.yst + RP.dyst * (vcnt << 16) ) - RP.py ) +
-		      RP.C * ( RP.zst - RP.pz);
-		ysp = RP.D * ( ( RP.xst + RP.dxst * (vcnt << 16) ) - RP.px ) +
-		      RP.E * ( ( RP.yst + RP.dyst * (vcnt << 16) ) - RP.py ) +
-		      RP.F * ( RP.zst - RP.pz );*/
-		xsp = mul_fixed32( RP.A, RP.xst + mul_fixed32( RP.dxst, vcnt << (16 - vcnt_shift)) - RP.px ) +
-				mul_fixed32( RP.B, RP.yst + mul_fixed32( RP.dyst, vcnt << (16 - vcnt_shift)) - RP.py ) +
-				mul_fixed32( RP.C, RP.zst - RP.pz );
-		ysp = mul_fixed32( RP.D, RP.xst + mul_fixed32( RP.dxst, vcnt << (16 - vcnt_shift)) - RP.px ) +
-				mul_fixed32( RP.E, RP.yst + mul_fixed32( RP.dyst, vcnt << (16 - vcnt_shift)) - RP.py ) +
-				mul_fixed32( RP.F, RP.zst - RP.pz );
-		//xp  = RP.A * ( RP.px - RP.cx ) + RP.B * ( RP.py - RP.cy ) + RP.C * ( RP.pz - RP.cz ) + RP.cx + RP.mx;
-		//yp  = RP.D * ( RP.px - RP.cx ) + RP.E * ( RP.py - RP.cy ) + RP.F * ( RP.pz - RP.cz ) + RP.cy + RP.my;
-		//dx  = (RP.A * RP.dx) + (RP.B * RP.dy);
-		//dy  = (RP.D * RP.dx) + (RP.E * RP.dy);
-
-		line = &bitmap.pix32(vcnt);
-
-		// TODO: nuke this spaghetti code
-		if ( !use_coeff_table || RP.dkax == 0 )
+		/* the coefficient table carries kx/ky/xp over from one line to the next,
+		   so resolve those serially; the pixel loops are then independent per line */
+		m_vdp2.roz_lines.resize(cliprect.max_y + 1);
+		for (vcnt = cliprect.min_y; vcnt <= cliprect.max_y; vcnt++ )
 		{
+			stv_roz_line &info = m_vdp2.roz_lines[vcnt];
+			info.skip = false;
 			if ( use_coeff_table )
 			{
 				switch( coeff_table_size )
@@ -4733,7 +4718,11 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 						coeff_msb = 1;
 						break;
 				}
-				if ( coeff_msb ) continue;
+				if ( coeff_msb )
+				{
+					info.skip = true;
+					continue;
+				}
 
 				switch( coeff_table_mode )
 				{
@@ -4752,168 +4741,282 @@ void saturn_state::stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap,
 				}
 			}
 
+			info.kx = kx;
+			info.ky = ky;
+			info.xp = xp;
+		}
+
+		m_vdp2.roz_copy.bitmap = &bitmap;
+		m_vdp2.roz_copy.roz_bitmap = &roz_bitmap;
+		m_vdp2.roz_copy.min_x = cliprect.min_x;
+		m_vdp2.roz_copy.max_x = cliprect.max_x;
+		m_vdp2.roz_copy.dx = dx;
+		m_vdp2.roz_copy.dy = dy;
+		m_vdp2.roz_copy.yp = yp;
+		m_vdp2.roz_copy.clipxmask = clipxmask;
+		m_vdp2.roz_copy.clipymask = clipymask;
+		m_vdp2.roz_copy.planerenderedsizex = planerenderedsizex;
+		m_vdp2.roz_copy.planerenderedsizey = planerenderedsizey;
+		m_vdp2.roz_copy.vcnt_shift = vcnt_shift;
+		m_vdp2.roz_copy.hcnt_shift = hcnt_shift;
+		stv_vdp2_copy_roz_bands(cliprect.min_y, cliprect.max_y);
+		return;
+	}
+
+	// TODO: nuke this spaghetti code
+	for (vcnt = cliprect.min_y; vcnt <= cliprect.max_y; vcnt++ )
+	{
+		/*xsp = RP.A * ( ( RP.xst + RP.dxst * (vcnt << 16) ) - RP.px ) +
+		      RP.B * ( ( RP.yst + RP.dyst * (vcnt << 16) ) - RP.py ) +
+		      RP.C * ( RP.zst - RP.pz);
+		ysp = RP.D * ( ( RP.xst + RP.dxst * (vcnt << 16) ) - RP.px ) +
+		      RP.E * ( ( RP.yst + RP.dyst * (vcnt << 16) ) - RP.py ) +
+		      RP.F * ( RP.zst - RP.pz );*/
+		xsp = mul_fixed32( RP.A, RP.xst + mul_fixed32( RP.dxst, vcnt << (16 - vcnt_shift)) - RP.px ) +
+				mul_fixed32( RP.B, RP.yst + mul_fixed32( RP.dyst, vcnt << (16 - vcnt_shift)) - RP.py ) +
+				mul_fixed32( RP.C, RP.zst - RP.pz );
+		ysp = mul_fixed32( RP.D, RP.xst + mul_fixed32( RP.dxst, vcnt << (16 - vcnt_shift)) - RP.px ) +
+				mul_fixed32( RP.E, RP.yst + mul_fixed32( RP.dyst, vcnt << (16 - vcnt_shift)) - RP.py ) +
+				mul_fixed32( RP.F, RP.zst - RP.pz );
+		//xp  = RP.A * ( RP.px - RP.cx ) + RP.B * ( RP.py - RP.cy ) + RP.C * ( RP.pz - RP.cz ) + RP.cx + RP.mx;
+		//yp  = RP.D * ( RP.px - RP.cx ) + RP.E * ( RP.py - RP.cy ) + RP.F * ( RP.pz - RP.cz ) + RP.cy + RP.my;
+		//dx  = (RP.A * RP.dx) + (RP.B * RP.dy);
+		//dy  = (RP.D * RP.dx) + (RP.E * RP.dy);
+
+		line = &bitmap.pix32(vcnt);
+
+		for (hcnt = cliprect.min_x; hcnt <= cliprect.max_x; hcnt++ )
+		{
+			switch( coeff_table_size )
+			{
+				case 0:
+					address = coeff_table_offset + ((RP.kast + RP.dkast*(vcnt>>vcnt_shift) + RP.dkax*hcnt) >> 16) * 4;
+					coeff_table_val = coeff_table_base[ address / 4 ];
+					//coeff_line_color_screen_data = (coeff_table_val & 0x7f000000) >> 24;
+					coeff_msb = (coeff_table_val & 0x80000000) > 0;
+					if ( coeff_table_val & 0x00800000 )
+					{
+						coeff_table_val |= 0xff000000;
+					}
+					else
+					{
+						coeff_table_val &= 0x007fffff;
+					}
+					break;
+				case 1:
+					address = coeff_table_offset + ((RP.kast + RP.dkast*(vcnt>>vcnt_shift) + RP.dkax*hcnt) >> 16) * 2;
+					coeff_table_val = coeff_table_base[ address / 4 ];
+					if ( (address & 2) == 0 )
+					{
+						coeff_table_val >>= 16;
+					}
+					coeff_table_val &= 0xffff;
+					//coeff_line_color_screen_data = 0;
+					coeff_msb = (coeff_table_val & 0x8000) > 0;
+					if ( coeff_table_val & 0x4000 )
+					{
+						coeff_table_val |= 0xffff8000;
+					}
+					else
+					{
+						coeff_table_val &= 0x3fff;
+					}
+					coeff_table_val <<= 6; /* to form 16.16 fixed point val */
+					break;
+				default:
+					coeff_msb = 1;
+					break;
+			}
+			if ( coeff_msb ) continue;
+			switch( coeff_table_mode )
+			{
+				case 0:
+					kx = ky = coeff_table_val;
+					break;
+				case 1:
+					kx = coeff_table_val;
+					break;
+				case 2:
+					ky = coeff_table_val;
+					break;
+				case 3:
+					xp = coeff_table_val;
+					break;
+			}
+
 			//x = RP.kx * ( xsp + dx * (hcnt << 16)) + xp;
 			//y = RP.ky * ( ysp + dy * (hcnt << 16)) + yp;
-			xs = mul_fixed32( kx, xsp ) + xp;
-			ys = mul_fixed32( ky, ysp ) + yp;
-			dxs = mul_fixed32( kx, mul_fixed32( dx, 1 << (16-hcnt_shift)));
-			dys = mul_fixed32( ky, mul_fixed32( dy, 1 << (16-hcnt_shift)));
+			x = mul_fixed32( kx, xsp + mul_fixed32( dx, (hcnt>>hcnt_shift) << 16 ) ) + xp;
+			y = mul_fixed32( ky, ysp + mul_fixed32( dy, (hcnt>>hcnt_shift) << 16 ) ) + yp;
 
-			for (hcnt = cliprect.min_x; hcnt <= cliprect.max_x; xs+=dxs, ys+=dys, hcnt++ )
-			{
-				x = xs >> 16;
-				y = ys >> 16;
+			x >>= 16;
+			y >>= 16;
 
-				if ( x & clipxmask || y & clipymask ) continue;
-				pix = roz_bitmap.pix32(y & planerenderedsizey, x & planerenderedsizex);
-				switch( stv2_current_tilemap.transparency )
-				{
-					case STV_TRANSPARENCY_PEN:
-						if (pix & 0xffffff)
-						{
-							if(stv2_current_tilemap.fade_control & 1)
-								stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
+			if ( x & clipxmask || y & clipymask ) continue;
 
-							line[hcnt] = pix;
-						}
-						break;
-					case STV_TRANSPARENCY_NONE:
+			pix = roz_bitmap.pix32(y & planerenderedsizey, x & planerenderedsizex);
+			switch( stv2_current_tilemap.transparency )
+			{
+				case STV_TRANSPARENCY_PEN:
+					if (pix & 0xffffff)
+					{
 						if(stv2_current_tilemap.fade_control & 1)
 							stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
 
 						line[hcnt] = pix;
-						break;
-					case STV_TRANSPARENCY_ALPHA:
-						if (pix & 0xffffff)
-						{
-							if(stv2_current_tilemap.fade_control & 1)
-								stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
-
-							line[hcnt] = alpha_blend_r32( line[hcnt], pix, stv2_current_tilemap.alpha );
-						}
-						break;
-					case STV_TRANSPARENCY_ADD_BLEND:
-						if (pix & 0xffffff)
-						{
-							if(stv2_current_tilemap.fade_control & 1)
-								stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
+					}
+					break;
+				case STV_TRANSPARENCY_NONE:
+					if(stv2_current_tilemap.fade_control & 1)
+						stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
+
+					line[hcnt] = pix;
+					break;
+				case STV_TRANSPARENCY_ALPHA:
+					if (pix & 0xffffff)
+					{
+						if(stv2_current_tilemap.fade_control & 1)
+							stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
 
-							line[hcnt] = stv_add_blend( line[hcnt], pix );
-						}
-						break;
-				}
+						line[hcnt] = alpha_blend_r32( line[hcnt], pix, stv2_current_tilemap.alpha );
+					}
+					break;
+				case STV_TRANSPARENCY_ADD_BLEND:
+					if (pix & 0xffffff)
+					{
+						if(stv2_current_tilemap.fade_control & 1)
+							stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
 
+						line[hcnt] = stv_add_blend( line[hcnt], pix );
+					}
+					break;
 			}
 		}
-		else
-		{
-			for (hcnt = cliprect.min_x; hcnt <= cliprect.max_x; hcnt++ )
-			{
-				switch( coeff_table_size )
-				{
-					case 0:
-						address = coeff_table_offset + ((RP.kast + RP.dkast*(vcnt>>vcnt_shift) + RP.dkax*hcnt) >> 16) * 4;
-						coeff_table_val = coeff_table_base[ address / 4 ];
-						//coeff_line_color_screen_data = (coeff_table_val & 0x7f000000) >> 24;
-						coeff_msb = (coeff_table_val & 0x80000000) > 0;
-						if ( coeff_table_val & 0x00800000 )
-						{
-							coeff_table_val |= 0xff000000;
-						}
-						else
-						{
-							coeff_table_val &= 0x007fffff;
-						}
-						break;
-					case 1:
-						address = coeff_table_offset + ((RP.kast + RP.dkast*(vcnt>>vcnt_shift) + RP.dkax*hcnt) >> 16) * 2;
-						coeff_table_val = coeff_table_base[ address / 4 ];
-						if ( (address & 2) == 0 )
-						{
-							coeff_table_val >>= 16;
-						}
-						coeff_table_val &= 0xffff;
-						//coeff_line_color_screen_data = 0;
-						coeff_msb = (coeff_table_val & 0x8000) > 0;
-						if ( coeff_table_val & 0x4000 )
-						{
-							coeff_table_val |= 0xffff8000;
-						}
-						else
-						{
-							coeff_table_val &= 0x3fff;
-						}
-						coeff_table_val <<= 6; /* to form 16.16 fixed point val */
-						break;
-					default:
-						coeff_msb = 1;
-						break;
-				}
-				if ( coeff_msb ) continue;
-				switch( coeff_table_mode )
-				{
-					case 0:
-						kx = ky = coeff_table_val;
-						break;
-					case 1:
-						kx = coeff_table_val;
-						break;
-					case 2:
-						ky = coeff_table_val;
-						break;
-					case 3:
-						xp = coeff_table_val;
-						break;
-				}
+	}
+}
 
-				//x = RP.kx * ( xsp + dx * (hcnt << 16)) + xp;
-				//y = RP.ky * ( ysp + dy * (hcnt << 16)) + yp;
-				x = mul_fixed32( kx, xsp + mul_fixed32( dx, (hcnt>>hcnt_shift) << 16 ) ) + xp;
-				y = mul_fixed32( ky, ysp + mul_fixed32( dy, (hcnt>>hcnt_shift) << 16 ) ) + yp;
+/* splits the per-line part of a rotation plane copy into scanline bands; the
+   bands write disjoint rows of the destination so they can run in parallel */
+void saturn_state::stv_vdp2_copy_roz_bands(int32_t min_y, int32_t max_y)
+{
+	int32_t rows = max_y - min_y + 1;
+	int32_t bands = rows / STV_ROZ_MIN_BAND_ROWS;
 
-				x >>= 16;
-				y >>= 16;
+	if (bands > STV_ROZ_MAX_BANDS)
+		bands = STV_ROZ_MAX_BANDS;
 
-				if ( x & clipxmask || y & clipymask ) continue;
+	if (m_vdp2.roz_queue == nullptr || bands <= 1)
+	{
+		stv_vdp2_copy_roz_rows(min_y, max_y);
+		return;
+	}
 
-				pix = roz_bitmap.pix32(y & planerenderedsizey, x & planerenderedsizex);
-				switch( stv2_current_tilemap.transparency )
-				{
-					case STV_TRANSPARENCY_PEN:
-						if (pix & 0xffffff)
-						{
-							if(stv2_current_tilemap.fade_control & 1)
-								stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
+	for (int32_t band = 0; band < bands; band++)
+	{
+		m_vdp2.roz_bands[band].state = this;
+		m_vdp2.roz_bands[band].min_y = min_y + (rows * band) / bands;
+		m_vdp2.roz_bands[band].max_y = min_y + (rows * (band + 1)) / bands - 1;
+	}
 
-							line[hcnt] = pix;
-						}
-						break;
-					case STV_TRANSPARENCY_NONE:
+	osd_work_item_queue_multiple(m_vdp2.roz_queue, stv_vdp2_copy_roz_band_callback, bands, m_vdp2.roz_bands, sizeof(m_vdp2.roz_bands[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(m_vdp2.roz_queue, osd_ticks_per_second() * 10);
+}
+
+void *saturn_state::stv_vdp2_copy_roz_band_callback(void *param, int threadid)
+{
+	stv_roz_band *band = (stv_roz_band *)param;
+	band->state->stv_vdp2_copy_roz_rows(band->min_y, band->max_y);
+	return nullptr;
+}
+
+void saturn_state::stv_vdp2_copy_roz_rows(int32_t min_y, int32_t max_y)
+{
+	bitmap_rgb32 &bitmap = *m_vdp2.roz_copy.bitmap;
+	bitmap_rgb32 &roz_bitmap = *m_vdp2.roz_copy.roz_bitmap;
+	const int32_t dx = m_vdp2.roz_copy.dx;
+	const int32_t dy = m_vdp2.roz_copy.dy;
+	const int32_t yp = m_vdp2.roz_copy.yp;
+	const int32_t clipxmask = m_vdp2.roz_copy.clipxmask;
+	const int32_t clipymask = m_vdp2.roz_copy.clipymask;
+	const int32_t planerenderedsizex = m_vdp2.roz_copy.planerenderedsizex;
+	const int32_t planerenderedsizey = m_vdp2.roz_copy.planerenderedsizey;
+	const uint8_t vcnt_shift = m_vdp2.roz_copy.vcnt_shift;
+	const uint8_t hcnt_shift = m_vdp2.roz_copy.hcnt_shift;
+	rectangle cliprect(m_vdp2.roz_copy.min_x, m_vdp2.roz_copy.max_x, min_y, max_y);
+	int32_t xsp, ysp, x, y, xs, ys, dxs, dys;
+	int32_t vcnt, hcnt;
+	uint32_t *line;
+	rgb_t pix;
+
+	for (vcnt = min_y; vcnt <= max_y; vcnt++ )
+	{
+		const stv_roz_line &info = m_vdp2.roz_lines[vcnt];
+		const int32_t kx = info.kx;
+		const int32_t ky = info.ky;
+		const int32_t xp = info.xp;
+
+		if ( info.skip ) continue;
+
+		xsp = mul_fixed32( RP.A, RP.xst + mul_fixed32( RP.dxst, vcnt << (16 - vcnt_shift)) - RP.px ) +
+				mul_fixed32( RP.B, RP.yst + mul_fixed32( RP.dyst, vcnt << (16 - vcnt_shift)) - RP.py ) +
+				mul_fixed32( RP.C, RP.zst - RP.pz );
+		ysp = mul_fixed32( RP.D, RP.xst + mul_fixed32( RP.dxst, vcnt << (16 - vcnt_shift)) - RP.px ) +
+				mul_fixed32( RP.E, RP.yst + mul_fixed32( RP.dyst, vcnt << (16 - vcnt_shift)) - RP.py ) +
+				mul_fixed32( RP.F, RP.zst - RP.pz );
+
+		line = &bitmap.pix32(vcnt);
+
+		//x = RP.kx * ( xsp + dx * (hcnt << 16)) + xp;
+		//y = RP.ky * ( ysp + dy * (hcnt << 16)) + yp;
+		xs = mul_fixed32( kx, xsp ) + xp;
+		ys = mul_fixed32( ky, ysp ) + yp;
+		dxs = mul_fixed32( kx, mul_fixed32( dx, 1 << (16-hcnt_shift)));
+		dys = mul_fixed32( ky, mul_fixed32( dy, 1 << (16-hcnt_shift)));
+
+		for (hcnt = cliprect.min_x; hcnt <= cliprect.max_x; xs+=dxs, ys+=dys, hcnt++ )
+		{
+			x = xs >> 16;
+			y = ys >> 16;
+
+			if ( x & clipxmask || y & clipymask ) continue;
+			pix = roz_bitmap.pix32(y & planerenderedsizey, x & planerenderedsizex);
+			switch( stv2_current_tilemap.transparency )
+			{
+				case STV_TRANSPARENCY_PEN:
+					if (pix & 0xffffff)
+					{
 						if(stv2_current_tilemap.fade_control & 1)
 							stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
 
 						line[hcnt] = pix;
-						break;
-					case STV_TRANSPARENCY_ALPHA:
-						if (pix & 0xffffff)
-						{
-							if(stv2_current_tilemap.fade_control & 1)
-								stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
+					}
+					break;
+				case STV_TRANSPARENCY_NONE:
+					if(stv2_current_tilemap.fade_control & 1)
+						stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
+
+					line[hcnt] = pix;
+					break;
+				case STV_TRANSPARENCY_ALPHA:
+					if (pix & 0xffffff)
+					{
+						if(stv2_current_tilemap.fade_control & 1)
+							stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
 
-							line[hcnt] = alpha_blend_r32( line[hcnt], pix, stv2_current_tilemap.alpha );
-						}
-						break;
-					case STV_TRANSPARENCY_ADD_BLEND:
-						if (pix & 0xffffff)
-						{
-							if(stv2_current_tilemap.fade_control & 1)
-								stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
+						line[hcnt] = alpha_blend_r32( line[hcnt], pix, stv2_current_tilemap.alpha );
+					}
+					break;
+				case STV_TRANSPARENCY_ADD_BLEND:
+					if (pix & 0xffffff)
+					{
+						if(stv2_current_tilemap.fade_control & 1)
+							stv_vdp2_compute_color_offset_UINT32(&pix,stv2_current_tilemap.fade_control & 2);
 
-							line[hcnt] = stv_add_blend( line[hcnt], pix );
-						}
-						break;
-				}
+						line[hcnt] = stv_add_blend( line[hcnt], pix );
+					}
+					break;
 			}
+
 		}
 	}
 }
@@ -6124,6 +6227,12 @@ void saturn_state::stv_vdp2_exit ( void )
 {
 	m_vdp2.roz_bitmap[0].reset();
 	m_vdp2.roz_bitmap[1].reset();
+
+	if (m_vdp2.roz_queue != nullptr)
+	{
+		osd_work_queue_free(m_vdp2.roz_queue);
+		m_vdp2.roz_queue = nullptr;
+	}
 }
 
 int saturn_state::stv_vdp2_start ( void )
@@ -6142,6 +6251,8 @@ int saturn_state::stv_vdp2_start ( void )
 	stv_rbg_cache_data.is_cache_dirty = 3;
 	memset( &stv_vdp2_layer_data_placement, 0, sizeof(stv_vdp2_layer_data_placement));
 
+	m_vdp2.roz_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
 	save_pointer(NAME(m_vdp2_regs.get()), 0x040000/2);
 	save_pointer(NAME(m_vdp2_vram.get()), 0x100000/4);
 	save_pointer(NAME(m_vdp2_cram.get()), 0x080000/4);
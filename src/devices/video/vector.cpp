@@ -158,14 +158,11 @@ uint32_t vector_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 
 	curpoint = m_vector_list.get();
 
-	screen.container().empty();
-	screen.container().add_rect(0.0f, 0.0f, 1.0f, 1.0f, rgb_t(0xff,0x00,0x00,0x00), PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA) | PRIMFLAG_VECTORBUF(1));
-
-	for (int i = 0; i < m_vector_index; i++)
+	// the beam width only depends on the intensity, so work it out once per level
+	// per frame (the sliders may change the weights) rather than for every segment
+	for (int level = 0; level < 256; level++)
 	{
-		render_bounds coords;
-
-		float intensity = (float)curpoint->intensity / 255.0f;
+		float intensity = (float)level / 255.0f;
 		float intensity_weight = normalized_sigmoid(intensity, vector_options::s_beam_intensity_weight);
 
 		// check for static intensity
@@ -174,24 +171,56 @@ uint32_t vector_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 			: vector_options::s_beam_width_min + intensity_weight * (vector_options::s_beam_width_max - vector_options::s_beam_width_min);
 
 		// normalize width
-		beam_width *= 1.0f / (float)VECTOR_WIDTH_DENOM;
+		m_beam_width[level] = beam_width * (1.0f / (float)VECTOR_WIDTH_DENOM);
+	}
 
-		coords.x0 = ((float)lastx - xoffs) * xscale;
-		coords.y0 = ((float)lasty - yoffs) * yscale;
-		coords.x1 = ((float)curpoint->x - xoffs) * xscale;
-		coords.y1 = ((float)curpoint->y - yoffs) * yscale;
+	screen.container().empty();
+	screen.container().add_rect(0.0f, 0.0f, 1.0f, 1.0f, rgb_t(0xff,0x00,0x00,0x00), PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA) | PRIMFLAG_VECTORBUF(1));
+
+	for (int i = 0; i < m_vector_index; i++)
+	{
+		int endx = curpoint->x;
+		int endy = curpoint->y;
 
 		if (curpoint->intensity != 0)
 		{
+			// the vector generators emit long strokes as runs of short segments;
+			// fold consecutive segments that continue in the same direction with
+			// the same colour and intensity into a single line primitive
+			int64_t dx = endx - lastx;
+			int64_t dy = endy - lasty;
+			while (i + 1 < m_vector_index)
+			{
+				const point &next = curpoint[1];
+				int64_t ndx = next.x - endx;
+				int64_t ndy = next.y - endy;
+
+				if (next.intensity != curpoint->intensity || next.col != curpoint->col)
+					break;
+				if (dx * ndy != dy * ndx || dx * ndx + dy * ndy <= 0)
+					break;
+
+				endx = next.x;
+				endy = next.y;
+				curpoint++;
+				i++;
+			}
+
+			render_bounds coords;
+			coords.x0 = ((float)lastx - xoffs) * xscale;
+			coords.y0 = ((float)lasty - yoffs) * yscale;
+			coords.x1 = ((float)endx - xoffs) * xscale;
+			coords.y1 = ((float)endy - yoffs) * yscale;
+
 			screen.container().add_line(
 				coords.x0, coords.y0, coords.x1, coords.y1,
-				beam_width,
+				m_beam_width[curpoint->intensity],
 				(curpoint->intensity << 24) | (curpoint->col & 0xffffff),
 				flags);
 		}
 
-		lastx = curpoint->x;
-		lasty = curpoint->y;
+		lastx = endx;
+		lasty = endy;
 
 		curpoint++;
 	}
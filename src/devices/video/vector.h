@@ -61,6 +61,7 @@ private:
 	int m_vector_index;
 	int m_min_intensity;
 	int m_max_intensity;
+	float m_beam_width[256];
 
 	float normalized_sigmoid(float n, float k);
 };
@@ -5038,6 +5038,7 @@ void voodoo_device::common_start_voodoo(uint8_t type)
 	/* build the rasterizer table */
 	for (info = predef_raster_table; info->callback; info++)
 		add_rasterizer(this, info);
+	last_rasterizer = nullptr;
 
 	/* set up the PCI FIFO */
 	pci.fifo.base = pci.fifo_mem;
@@ -5652,6 +5653,19 @@ raster_info *voodoo_device::find_rasterizer(voodoo_device *vd, int texcount)
 	raster_info curinfo;
 	int hash;
 
+	/* most triangles are drawn in runs with the same modes, so check the last lookup first */
+	uint32_t key[7];
+	key[0] = vd->reg[fbzColorPath].u;
+	key[1] = vd->reg[alphaMode].u;
+	key[2] = vd->reg[fogMode].u;
+	key[3] = vd->reg[fbzMode].u;
+	key[4] = (texcount >= 1) ? vd->tmu[0].reg[textureMode].u : 0;
+	key[5] = (texcount >= 2) ? vd->tmu[1].reg[textureMode].u : 0;
+	key[6] = texcount;
+	if (vd->last_rasterizer != nullptr && memcmp(key, vd->last_raster_key, sizeof(key)) == 0)
+		return vd->last_rasterizer;
+	memcpy(vd->last_raster_key, key, sizeof(key));
+
 	/* build an info struct with all the parameters */
 	curinfo.eff_color_path = normalize_color_path(vd->reg[fbzColorPath].u);
 	curinfo.eff_alpha_mode = normalize_alpha_mode(vd->reg[alphaMode].u);
@@ -5681,6 +5695,7 @@ raster_info *voodoo_device::find_rasterizer(voodoo_device *vd, int texcount)
 			}
 
 			/* return the result */
+			vd->last_rasterizer = info;
 			return info;
 		}
 
@@ -5693,7 +5708,8 @@ raster_info *voodoo_device::find_rasterizer(voodoo_device *vd, int texcount)
 	curinfo.next = nullptr;
 	curinfo.hash = hash;
 
-	return add_rasterizer(vd, &curinfo);
+	vd->last_rasterizer = add_rasterizer(vd, &curinfo);
+	return vd->last_rasterizer;
 }
 
 
@@ -5744,6 +5760,43 @@ void voodoo_device::dump_rasterizer_stats(voodoo_device *vd)
 	}
 }
 
+/*-------------------------------------------------
+    log_generic_rasterizers - log the mode
+    combinations that fell back to the generic
+    rasterizers for a noticeable share of the
+    pixels, in the form voodoo_rast.hxx takes, so
+    they can be collected across runs and added
+    as specialized entries
+-------------------------------------------------*/
+
+void voodoo_device::log_generic_rasterizers(voodoo_device *vd)
+{
+	/* total up the pixels drawn by every rasterizer */
+	uint64_t total = 0;
+	for (int index = 0; index < vd->next_rasterizer; index++)
+		total += vd->rasterizer[index].hits;
+	if (total == 0)
+		return;
+
+	/* report the generic ones responsible for at least 0.5% of them */
+	bool header = false;
+	for (int index = 0; index < vd->next_rasterizer; index++)
+	{
+		const raster_info &info = vd->rasterizer[index];
+		if (!info.is_generic || uint64_t(info.hits) * 200 < total)
+			continue;
+
+		if (!header)
+		{
+			vd->device->logerror("/* %-10s > fbzColorPath alphaMode   fogMode,    fbzMode,    texMode0,   texMode1  */\n", vd->device->machine().system().name);
+			header = true;
+		}
+		vd->device->logerror("RASTERIZER_ENTRY( 0x%08X, 0x%08X, 0x%08X, 0x%08X, 0x%08X, 0x%08X ) /* %8d %10d */\n",
+				info.eff_color_path, info.eff_alpha_mode, info.eff_fog_mode, info.eff_fbz_mode,
+				info.eff_tex_mode_0, info.eff_tex_mode_1, info.polys, info.hits);
+	}
+}
+
 voodoo_device::voodoo_device(const machine_config &mconfig, device_type type, const char *name, const char *tag, device_t *owner, uint32_t clock, const char *shortname, const char *source)
 	: device_t(mconfig, type, name, tag, owner, clock, shortname, source),
 		m_fbmem(0),
@@ -5778,6 +5831,9 @@ void voodoo_device::device_stop()
 	/* release the work queue, ensuring all work is finished */
 	if (poly != nullptr)
 		poly_free(poly);
+
+	/* note any hot mode combinations that lacked a specialized rasterizer */
+	log_generic_rasterizers(this);
 }
 
 
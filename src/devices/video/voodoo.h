@@ -1813,6 +1813,7 @@ public:
 	static raster_info *add_rasterizer(voodoo_device *vd, const raster_info *cinfo);
 	static raster_info *find_rasterizer(voodoo_device *vd, int texcount);
 	static void dump_rasterizer_stats(voodoo_device *vd);
+	static void log_generic_rasterizers(voodoo_device *vd);
 	static void init_tmu_shared(tmu_shared_state *s);
 
 	static void swap_buffers(voodoo_device *vd);
@@ -1876,6 +1877,8 @@ public:
 	int                 next_rasterizer;        /* next rasterizer index */
 	raster_info         rasterizer[MAX_RASTERIZERS]; /* array of rasterizers */
 	raster_info *       raster_hash[RASTER_HASH_SIZE]; /* hash table of rasterizers */
+	raster_info *       last_rasterizer;        /* rasterizer found by the last lookup */
+	uint32_t            last_raster_key[7];     /* raw registers and TMU count that selected it */
 
 	bool                send_config;
 	uint32_t              tmu_config;
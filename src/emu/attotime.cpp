@@ -39,6 +39,18 @@ attotime &attotime::operator*=(u32 factor)
 	if (factor == 0)
 		return *this = zero;
 
+	// fast path: if the scaled attoseconds fit in 64 bits, split them with a single division
+	if (u64((u64(m_attoseconds) >> 32) + 1) * factor <= (u64(1) << 32))
+	{
+		u64 const product = u64(m_attoseconds) * factor;
+		u64 const temp = product / ATTOSECONDS_PER_SECOND + mulu_32x32(m_seconds, factor);
+		if (temp >= ATTOTIME_MAX_SECONDS)
+			return *this = never;
+		m_seconds = temp;
+		m_attoseconds = product % ATTOSECONDS_PER_SECOND;
+		return *this;
+	}
+
 	// split attoseconds into upper and lower halves which fit into 32 bits
 	u32 attolo;
 	u32 attohi = divu_64x32_rem(m_attoseconds, ATTOSECONDS_PER_SECOND_SQRT, &attolo);
@@ -79,24 +91,34 @@ attotime &attotime::operator/=(u32 factor)
 	if (factor == 0)
 		return *this;
 
-	// split attoseconds into upper and lower halves which fit into 32 bits
-	u32 attolo;
-	u32 attohi = divu_64x32_rem(m_attoseconds, ATTOSECONDS_PER_SECOND_SQRT, &attolo);
-
 	// divide the seconds and get the remainder
 	u32 remainder;
 	m_seconds = divu_64x32_rem(m_seconds, factor, &remainder);
 
-	// combine the upper half of attoseconds with the remainder and divide that
-	u64 temp = s64(attohi) + mulu_32x32(remainder, ATTOSECONDS_PER_SECOND_SQRT);
-	u32 reshi = divu_64x32_rem(temp, factor, &remainder);
-
-	// combine the lower half of attoseconds with the remainder and divide that
-	temp = attolo + mulu_32x32(remainder, ATTOSECONDS_PER_SECOND_SQRT);
-	u32 reslo = divu_64x32_rem(temp, factor, &remainder);
+	// fast path: if the remainder and attoseconds fit in 64 bits together, divide them in one go
+	if (remainder < 18)
+	{
+		u64 const temp = u64(remainder) * ATTOSECONDS_PER_SECOND + m_attoseconds;
+		m_attoseconds = temp / factor;
+		remainder = temp % factor;
+	}
+	else
+	{
+		// split attoseconds into upper and lower halves which fit into 32 bits
+		u32 attolo;
+		u32 attohi = divu_64x32_rem(m_attoseconds, ATTOSECONDS_PER_SECOND_SQRT, &attolo);
+
+		// combine the upper half of attoseconds with the remainder and divide that
+		u64 temp = s64(attohi) + mulu_32x32(remainder, ATTOSECONDS_PER_SECOND_SQRT);
+		u32 reshi = divu_64x32_rem(temp, factor, &remainder);
+
+		// combine the lower half of attoseconds with the remainder and divide that
+		temp = attolo + mulu_32x32(remainder, ATTOSECONDS_PER_SECOND_SQRT);
+		u32 reslo = divu_64x32_rem(temp, factor, &remainder);
+		m_attoseconds = (attoseconds_t)reslo + mulu_32x32(reshi, ATTOSECONDS_PER_SECOND_SQRT);
+	}
 
 	// round based on the remainder
-	m_attoseconds = (attoseconds_t)reslo + mulu_32x32(reshi, ATTOSECONDS_PER_SECOND_SQRT);
 	if (remainder >= factor / 2)
 		if (++m_attoseconds >= ATTOSECONDS_PER_SECOND)
 		{
@@ -195,6 +195,8 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 	m_console.register_command("rplist",    CMDFLAG_NONE, 0, 0, 0, std::bind(&debugger_commands::execute_rplist, this, _1, _2, _3));
 
 	m_console.register_command("hotspot",   CMDFLAG_NONE, 0, 0, 3, std::bind(&debugger_commands::execute_hotspot, this, _1, _2, _3));
+	m_console.register_command("profile",   CMDFLAG_NONE, 0, 1, 2, std::bind(&debugger_commands::execute_profile, this, _1, _2, _3));
+	m_console.register_command("profiledump", CMDFLAG_NONE, 0, 0, 3, std::bind(&debugger_commands::execute_profiledump, this, _1, _2, _3));
 
 	m_console.register_command("statesave", CMDFLAG_NONE, 0, 1, 1, std::bind(&debugger_commands::execute_statesave, this, _1, _2, _3));
 	m_console.register_command("ss",        CMDFLAG_NONE, 0, 1, 1, std::bind(&debugger_commands::execute_statesave, this, _1, _2, _3));
@@ -1611,6 +1613,79 @@ void debugger_commands::execute_hotspot(int ref, int params, const char *param[]
 }
 
 
+/*-------------------------------------------------
+    execute_profile - execute the profile
+    command
+-------------------------------------------------*/
+
+void debugger_commands::execute_profile(int ref, int params, const char *param[])
+{
+	device_t *device = nullptr;
+	if (!validate_cpu_parameter((params > 1) ? param[1] : nullptr, &device))
+		return;
+
+	/* stop or clear */
+	if (!core_stricmp(param[0], "off"))
+	{
+		device->debug()->profile_stop();
+		m_console.printf("Stopped profiling CPU '%s'\n", device->tag());
+		return;
+	}
+	if (!core_stricmp(param[0], "clear"))
+	{
+		device->debug()->profile_clear();
+		m_console.printf("Cleared profile of CPU '%s'\n", device->tag());
+		return;
+	}
+
+	/* otherwise it's a sampling rate */
+	u64 frequency;
+	if (!validate_number_parameter(param[0], &frequency))
+		return;
+	if (frequency == 0)
+	{
+		m_console.printf("Sampling frequency must be greater than zero\n");
+		return;
+	}
+	device->debug()->profile_start(frequency);
+	m_console.printf("Now profiling CPU '%s' at %d samples per second\n", device->tag(), (int)frequency);
+}
+
+
+/*-------------------------------------------------
+    execute_profiledump - execute the profiledump
+    command
+-------------------------------------------------*/
+
+void debugger_commands::execute_profiledump(int ref, int params, const char *param[])
+{
+	device_t *device = nullptr;
+	if (!validate_cpu_parameter((params > 0) ? param[0] : nullptr, &device))
+		return;
+	u64 count = 20;
+	if (!validate_number_parameter(param[1], &count))
+		return;
+	u64 granularity = 1;
+	if (!validate_number_parameter(param[2], &granularity))
+		return;
+	if (granularity == 0)
+	{
+		m_console.printf("Granularity must be greater than zero\n");
+		return;
+	}
+
+	if (device->debug()->profile_total() == 0)
+	{
+		m_console.printf("No samples have been taken on CPU '%s'\n", device->tag());
+		return;
+	}
+
+	m_console.printf("%d samples taken on CPU '%s'\n", (int)device->debug()->profile_total(), device->tag());
+	for (std::string const &line : device->debug()->profile_report(count, granularity))
+		m_console.printf("%s\n", line.c_str());
+}
+
+
 /*-------------------------------------------------
     execute_statesave - execute the statesave command
 -------------------------------------------------*/
@@ -2534,6 +2609,7 @@ void debugger_commands::execute_trace_internal(int ref, int params, const char *
 	const char *action = nullptr;
 	bool detect_loops = true;
 	bool logerror = false;
+	bool binary = false;
 	device_t *cpu;
 	FILE *f = nullptr;
 	const char *mode;
@@ -2557,6 +2633,8 @@ void debugger_commands::execute_trace_internal(int ref, int params, const char *
 				detect_loops = false;
 			else if (!core_stricmp(flag.c_str(), "logerror"))
 				logerror = true;
+			else if (!core_stricmp(flag.c_str(), "binary"))
+				binary = true;
 			else
 			{
 				m_console.printf("Invalid flag '%s'\n", flag.c_str());
@@ -2570,12 +2648,12 @@ void debugger_commands::execute_trace_internal(int ref, int params, const char *
 	/* open the file */
 	if (core_stricmp(filename.c_str(), "off") != 0)
 	{
-		mode = "w";
+		mode = binary ? "wb" : "w";
 
 		/* opening for append? */
 		if ((filename[0] == '>') && (filename[1] == '>'))
 		{
-			mode = "a";
+			mode = binary ? "ab" : "a";
 			filename = filename.substr(2);
 		}
 
@@ -2588,7 +2666,7 @@ void debugger_commands::execute_trace_internal(int ref, int params, const char *
 	}
 
 	/* do it */
-	cpu->debug()->trace(f, trace_over, detect_loops, logerror, action);
+	cpu->debug()->trace(f, trace_over, detect_loops, logerror, action, binary);
 	if (f)
 		m_console.printf("Tracing CPU '%s' to file %s\n", cpu->tag(), filename.c_str());
 	else
@@ -129,6 +129,8 @@ private:
 	void execute_rpdisenable(int ref, int params, const char **param);
 	void execute_rplist(int ref, int params, const char **param);
 	void execute_hotspot(int ref, int params, const char **param);
+	void execute_profile(int ref, int params, const char **param);
+	void execute_profiledump(int ref, int params, const char **param);
 	void execute_statesave(int ref, int params, const char **param);
 	void execute_stateload(int ref, int params, const char **param);
 	void execute_save(int ref, int params, const char **param);
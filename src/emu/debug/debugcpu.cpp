@@ -19,6 +19,7 @@
 #include "uiinput.h"
 #include "xmlfile.h"
 #include "coreutil.h"
+#include "tracefile.h"
 #include <ctype.h>
 
 enum
@@ -364,20 +365,23 @@ u8 debugger_cpu::read_byte(address_space &space, offs_t address, bool apply_tran
 	/* mask against the logical byte mask */
 	address &= space.logbytemask();
 
+	/* translate if necessary; if not mapped, return 0xff */
+	if (apply_translation && !memory.translate(space.spacenum(), TRANSLATE_READ_DEBUG, address))
+		return 0xff;
+
+	/* RAM and ROM can be read directly, without going through the handlers; wider
+	   buses keep their words in host order, so swap the byte lane if that differs */
+	offs_t const lane = (space.endianness() != ENDIANNESS_NATIVE) ? ((space.data_width() / 8) - 1) : 0;
+	u8 const *const ptr = reinterpret_cast<u8 const *>(space.get_read_ptr(address ^ lane));
+	if (ptr != nullptr)
+		return *ptr;
+
 	/* all accesses from this point on are for the debugger */
 	m_debugger_access = true;
 	space.set_debugger_access(true);
 
-	/* translate if necessary; if not mapped, return 0xff */
-	u8 result;
-	if (apply_translation && !memory.translate(space.spacenum(), TRANSLATE_READ_DEBUG, address))
-	{
-		result = 0xff;
-	}
-	else
-	{   /* otherwise, call the byte reading function for the translated address */
-		result = space.read_byte(address);
-	}
+	/* call the byte reading function for the translated address */
+	u8 const result = space.read_byte(address);
 
 	/* no longer accessing via the debugger */
 	m_debugger_access = false;
@@ -986,10 +990,17 @@ void debugger_cpu::process_source_file()
 
 device_t* debugger_cpu::expression_get_device(const char *tag)
 {
+	// expressions such as cheats use the same few tags over and over, so remember them
+	for (auto &entry : m_expression_devices)
+		if (!core_stricmp(entry.first.c_str(), tag))
+			return entry.second;
+
 	// convert to lowercase then lookup the name (tags are enforced to be all lower case)
 	std::string fullname(tag);
 	strmakelower(fullname);
-	return m_machine.device(fullname.c_str());
+	device_t *const device = m_machine.device(fullname.c_str());
+	m_expression_devices.emplace_back(std::move(fullname), device);
+	return device;
 }
 
 
@@ -1626,6 +1637,8 @@ device_debug::device_debug(device_t &device)
 	, m_rplist(nullptr)
 	, m_trace(nullptr)
 	, m_hotspot_threshhold(0)
+	, m_profile_timer(nullptr)
+	, m_profile_total(0)
 	, m_track_pc_set()
 	, m_track_pc(false)
 	, m_comment_set()
@@ -2627,14 +2640,14 @@ u32 device_debug::compute_opcode_crc32(offs_t pc) const
 //  trace - trace execution of a given device
 //-------------------------------------------------
 
-void device_debug::trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action)
+void device_debug::trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary)
 {
 	// delete any existing tracers
 	m_trace = nullptr;
 
 	// if we have a new file, make a new tracer
 	if (file != nullptr)
-		m_trace = std::make_unique<tracer>(*this, *file, trace_over, detect_loops, logerror, action);
+		m_trace = std::make_unique<tracer>(*this, *file, trace_over, detect_loops, logerror, action, binary);
 }
 
 
@@ -2943,6 +2956,90 @@ void debugger_cpu::watchpoint_check(address_space& space, int type, offs_t addre
 }
 
 
+//-------------------------------------------------
+//  profile_start - start sampling the PC at the
+//  given rate in emulated time; this costs
+//  nothing per instruction or memory access
+//-------------------------------------------------
+
+void device_debug::profile_start(u32 frequency)
+{
+	if (m_profile_timer == nullptr)
+		m_profile_timer = m_device.machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(device_debug::profile_sample), this));
+	attotime const period = attotime::from_hz(frequency);
+	m_profile_timer->adjust(period, 0, period);
+}
+
+
+//-------------------------------------------------
+//  profile_stop - stop sampling, keeping the
+//  samples taken so far
+//-------------------------------------------------
+
+void device_debug::profile_stop()
+{
+	if (m_profile_timer != nullptr)
+		m_profile_timer->enable(false);
+}
+
+
+//-------------------------------------------------
+//  profile_sample - note where the CPU is; the
+//  scheduler stops it at the timer's expiry, so
+//  this lands on whatever it was executing then
+//-------------------------------------------------
+
+void device_debug::profile_sample(void *ptr, s32 param)
+{
+	if ((m_state == nullptr) || ((m_exec != nullptr) && m_exec->suspended()))
+		return;
+	m_profile[m_state->pcbase()]++;
+	m_profile_total++;
+}
+
+
+//-------------------------------------------------
+//  profile_report - summarise the samples by
+//  address range, busiest first, with the
+//  disassembly of the busiest PC in each range
+//-------------------------------------------------
+
+std::vector<std::string> device_debug::profile_report(int count, offs_t granularity)
+{
+	// gather the samples into ranges, remembering the busiest PC in each
+	struct range { u64 samples; offs_t toppc; u64 topsamples; };
+	std::unordered_map<offs_t, range> ranges;
+	for (auto const &elem : m_profile)
+	{
+		range &r = ranges.emplace(elem.first - (elem.first % granularity), range{ 0, elem.first, 0 }).first->second;
+		r.samples += elem.second;
+		if (elem.second > r.topsamples)
+		{
+			r.toppc = elem.first;
+			r.topsamples = elem.second;
+		}
+	}
+
+	std::vector<std::pair<offs_t, range>> sorted(ranges.begin(), ranges.end());
+	std::sort(sorted.begin(), sorted.end(), [] (std::pair<offs_t, range> const &a, std::pair<offs_t, range> const &b) { return a.second.samples > b.second.samples; });
+	if (sorted.size() > count)
+		sorted.resize(count);
+
+	std::vector<std::string> result;
+	int const addrchars = logaddrchars();
+	for (auto const &elem : sorted)
+	{
+		std::string dasm;
+		dasm_wrapped(dasm, elem.second.toppc);
+		result.emplace_back(string_format("%0*X-%0*X %6.2f%% %10d  %0*X: %s",
+				addrchars, elem.first, addrchars, elem.first + granularity - 1,
+				100.0 * double(elem.second.samples) / double(m_profile_total), int(elem.second.samples),
+				addrchars, elem.second.toppc, dasm));
+	}
+	return result;
+}
+
+
 //-------------------------------------------------
 //  hotspot_check - check for hotspots on a
 //  memory read access
@@ -3295,7 +3392,7 @@ bool device_debug::registerpoint::hit()
 //  tracer - constructor
 //-------------------------------------------------
 
-device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action)
+device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary)
 	: m_debug(debug)
 	, m_file(file)
 	, m_action((action != nullptr) ? action : "")
@@ -3305,8 +3402,22 @@ device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, b
 	, m_nextdex(0)
 	, m_trace_over(trace_over)
 	, m_trace_over_target(~0)
+	, m_binary(binary)
 {
 	memset(m_history, 0, sizeof(m_history));
+
+	// binary traces start with a header identifying the CPU; loops are left for the reader to find
+	if (m_binary)
+	{
+		m_detect_loops = false;
+		m_buffer.reserve(BINARY_BUFFER_SIZE);
+		m_buffer.insert(m_buffer.end(), std::begin(util::tracefile::MAGIC), std::end(util::tracefile::MAGIC));
+		binary_u32(util::tracefile::VERSION);
+		binary_u32(m_debug.logaddrchars());
+		std::string const tag(m_debug.m_device.tag());
+		binary_u32(tag.length());
+		m_buffer.insert(m_buffer.end(), tag.begin(), tag.end());
+	}
 }
 
 
@@ -3317,6 +3428,7 @@ device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, b
 device_debug::tracer::~tracer()
 {
 	// make sure we close the file if we can
+	binary_write();
 	fclose(&m_file);
 }
 
@@ -3361,6 +3473,29 @@ void device_debug::tracer::update(offs_t pc)
 	if (!m_action.empty())
 		m_debug.m_device.machine().debugger().console().execute_command(m_action.c_str(), false);
 
+	// binary traces just record the address, and only disassemble to step over subroutines
+	if (m_binary)
+	{
+		binary_u32(pc);
+		if (m_buffer.size() >= BINARY_BUFFER_SIZE)
+			binary_write();
+
+		if (m_trace_over)
+		{
+			std::string dasm;
+			offs_t const dasmresult = m_debug.dasm_wrapped(dasm, pc);
+			if ((dasmresult & DASMFLAG_SUPPORTED) != 0 && (dasmresult & DASMFLAG_STEP_OVER) != 0)
+			{
+				int extraskip = (dasmresult & DASMFLAG_OVERINSTMASK) >> DASMFLAG_OVERINSTSHIFT;
+				offs_t trace_over_target = pc + (dasmresult & DASMFLAG_LENGTHMASK);
+				while (extraskip-- > 0)
+					trace_over_target += m_debug.dasm_wrapped(dasm, trace_over_target) & DASMFLAG_LENGTHMASK;
+				m_trace_over_target = trace_over_target;
+			}
+		}
+		return;
+	}
+
 	// print the address
 	std::string buffer;
 	int logaddrchars = m_debug.logaddrchars();
@@ -3400,6 +3535,17 @@ void device_debug::tracer::update(offs_t pc)
 
 void device_debug::tracer::vprintf(const char *format, va_list va)
 {
+	// binary traces keep text in a record of its own
+	if (m_binary)
+	{
+		char text[1024];
+		int const length = std::min(std::max(vsnprintf(text, sizeof(text), format, va), 0), int(sizeof(text) - 1));
+		binary_u32(util::tracefile::TEXT_RECORD);
+		binary_u32(length);
+		m_buffer.insert(m_buffer.end(), text, text + length);
+		return;
+	}
+
 	// pass through to the file
 	vfprintf(&m_file, format, va);
 	fflush(&m_file);
@@ -3413,10 +3559,38 @@ void device_debug::tracer::vprintf(const char *format, va_list va)
 
 void device_debug::tracer::flush()
 {
+	binary_write();
 	fflush(&m_file);
 }
 
 
+//-------------------------------------------------
+//  binary_u32 - add a little-endian value to the
+//  pending binary records
+//-------------------------------------------------
+
+void device_debug::tracer::binary_u32(u32 value)
+{
+	u8 const bytes[4] = { u8(value), u8(value >> 8), u8(value >> 16), u8(value >> 24) };
+	m_buffer.insert(m_buffer.end(), std::begin(bytes), std::end(bytes));
+}
+
+
+//-------------------------------------------------
+//  binary_write - write out the pending binary
+//  records in one go
+//-------------------------------------------------
+
+void device_debug::tracer::binary_write()
+{
+	if (!m_buffer.empty())
+	{
+		fwrite(&m_buffer[0], 1, m_buffer.size(), &m_file);
+		m_buffer.clear();
+	}
+}
+
+
 //-------------------------------------------------
 //  dasm_pc_tag - constructor
 //-------------------------------------------------
@@ -16,6 +16,7 @@
 #include "express.h"
 
 #include <set>
+#include <unordered_map>
 
 
 namespace util { namespace xml { class data_node; } }
@@ -236,6 +237,14 @@ public:
 	bool hotspot_tracking_enabled() const { return !m_hotspots.empty(); }
 	void hotspot_track(int numspots, int threshhold);
 
+	// sampling profiler
+	bool profiling() const { return (m_profile_timer != nullptr) && m_profile_timer->enabled(); }
+	void profile_start(u32 frequency);
+	void profile_stop();
+	void profile_clear() { m_profile.clear(); m_profile_total = 0; }
+	u64 profile_total() const { return m_profile_total; }
+	std::vector<std::string> profile_report(int count, offs_t granularity);
+
 	// comments
 	void comment_add(offs_t address, const char *comment, rgb_t color);
 	bool comment_remove(offs_t addr);
@@ -263,7 +272,7 @@ public:
 	void track_mem_data_clear() { m_track_mem_set.clear(); }
 
 	// tracing
-	void trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action);
+	void trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary = false);
 	void trace_printf(const char *fmt, ...) ATTR_PRINTF(2,3);
 	void trace_flush() { if (m_trace != nullptr) m_trace->flush(); }
 
@@ -288,6 +297,7 @@ private:
 	void watchpoint_update_flags(address_space &space);
 	void watchpoint_check(address_space &space, int type, offs_t address, u64 value_to_write, u64 mem_mask);
 	void hotspot_check(address_space &space, offs_t address);
+	void profile_sample(void *ptr, s32 param);
 
 	// symbol get/set callbacks
 	static u64 get_current_pc(symbol_table &table, void *ref);
@@ -337,7 +347,7 @@ private:
 	class tracer
 	{
 	public:
-		tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action);
+		tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action, bool binary);
 		~tracer();
 
 		void update(offs_t pc);
@@ -347,6 +357,10 @@ private:
 
 	private:
 		static const int TRACE_LOOPS = 64;
+		static constexpr size_t BINARY_BUFFER_SIZE = 256 * 1024;
+
+		void binary_u32(u32 value);
+		void binary_write();
 
 		device_debug &      m_debug;                    // reference to our owner
 		FILE &              m_file;                     // tracing file for this CPU
@@ -360,6 +374,8 @@ private:
 		offs_t              m_trace_over_target;        // target for tracing over
 														//    (0 = not tracing over,
 														//    ~0 = not currently tracing over)
+		bool                m_binary;                   // whether we're writing records (see tracefile.h) rather than text
+		std::vector<u8>     m_buffer;                   // binary records not yet written
 	};
 	std::unique_ptr<tracer>                m_trace;                    // tracer state
 
@@ -374,6 +390,11 @@ private:
 	std::vector<hotspot_entry> m_hotspots;            // hotspot list
 	int                     m_hotspot_threshhold;       // threshhold for the number of hits to print
 
+	// sampling profiler
+	emu_timer *             m_profile_timer;            // periodic timer taking the samples
+	std::unordered_map<offs_t, u64> m_profile;          // number of samples taken at each PC
+	u64                     m_profile_total;            // number of samples taken in all
+
 	// pc tracking
 	class dasm_pc_tag
 	{
@@ -624,6 +645,9 @@ private:
 	osd_ticks_t m_last_periodic_update_time;
 
 	bool        m_comments_loaded;
+
+	// devices already looked up by expressions; the device tree doesn't change once the machine is running
+	std::vector<std::pair<std::string, device_t *>> m_expression_devices;
 };
 
 #endif // MAME_EMU_DEBUG_DEBUGCPU_H
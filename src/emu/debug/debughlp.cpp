@@ -171,6 +171,8 @@ static const help_item static_help_list[] =
 		"  wpenable [<wpnum>] -- enables a given watchpoint or all if no <wpnum> specified\n"
 		"  wplist -- lists all the watchpoints\n"
 		"  hotspot [<cpu>,[<depth>[,<hits>]]] -- attempt to find hotspots\n"
+		"  profile {<frequency>|OFF|CLEAR}[,<cpu>] -- sample the PC of <cpu> at <frequency> Hz\n"
+		"  profiledump [<cpu>[,<count>[,<granularity>]]] -- show where the samples landed\n"
 	},
 	{
 		"registerpoints",
@@ -835,7 +837,7 @@ static const help_item static_help_list[] =
 	{
 		"trace",
 		"\n"
-		"  trace {<filename>|OFF}[,<cpu>[,[noloop|logerror][,<action>]]]\n"
+		"  trace {<filename>|OFF}[,<cpu>[,[noloop|logerror|binary][,<action>]]]\n"
 		"\n"
 		"Starts or stops tracing of the execution of the specified <cpu>. If <cpu> is omitted, "
 		"the currently active CPU is specified. When enabling tracing, specify the filename in the "
@@ -843,7 +845,9 @@ static const help_item static_help_list[] =
 		"<detectloops> should be either true or false. If 'noloop' is omitted, the trace "
 		"will have loops detected and condensed to a single line. If 'noloop' is specified, the trace "
 		"will contain every opcode as it is executed. If 'logerror' is specified, logerror output "
-		"will augment the trace.  If you "
+		"will augment the trace. If 'binary' is specified, only the address of each instruction is "
+		"recorded, in a compact binary form that the tracedump tool turns back into text with loops "
+		"condensed; this is far faster than disassembling as the trace is made.  If you "
 		"wish to log additional information on each trace, you can append an <action> parameter which "
 		"is a command that is executed before each trace is logged. Generally, this is used to include "
 		"a 'tracelog' command. Note that you may need to embed the action within braces { } in order "
@@ -867,6 +871,9 @@ static const help_item static_help_list[] =
 		"trace starswep.tr,0,logerror|noloop\n"
 		"  Begin tracing the execution of CPU #0, logging output (along with logerror output) to starswep.tr, with loop detection disabled.\n"
 		"\n"
+		"trace starswep.trb,0,binary\n"
+		"  Begin tracing the execution of CPU #0, recording addresses in binary form to starswep.trb.\n"
+		"\n"
 		"trace >>pigskin.tr\n"
 		"  Begin tracing the currently active CPU, appending log output to pigskin.tr.\n"
 		"\n"
@@ -1146,6 +1153,42 @@ static const help_item static_help_list[] =
 		"  Looks for hotspots on CPU 1 using a search buffer of 64 entries, reporting any entries which "
 		"end up with 1000 or more hits.\n"
 	},
+	{
+		"profile",
+		"\n"
+		"  profile {<frequency>|OFF|CLEAR}[,<cpu>]\n"
+		"\n"
+		"The profile command samples the PC of <cpu>, which defaults to the currently active CPU, "
+		"<frequency> times per second of emulated time. Unlike hotspot, it doesn't trap memory reads or "
+		"instructions, so the machine runs at close to full speed while it collects samples. 'off' stops "
+		"sampling and keeps the samples taken so far; 'clear' throws them away. Use profiledump to see "
+		"the results.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"profile #10000\n"
+		"  Samples the currently active CPU ten thousand times per second.\n"
+		"\n"
+		"profile off,1\n"
+		"  Stops sampling CPU 1.\n"
+	},
+	{
+		"profiledump",
+		"\n"
+		"  profiledump [<cpu>[,<count>[,<granularity>]]]\n"
+		"\n"
+		"The profiledump command lists the <count> (default 20) busiest address ranges of <cpu> found by "
+		"the profile command, with the share of samples in each and the disassembly of the busiest "
+		"instruction in it. <granularity>, which defaults to 1, is the size of the address ranges.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"profiledump\n"
+		"  Lists the 20 busiest addresses of the currently active CPU.\n"
+		"\n"
+		"profiledump 0,10,100\n"
+		"  Lists the 10 busiest 256-byte ranges of CPU 0.\n"
+	},
 	{
 		"rpset",
 		"\n"
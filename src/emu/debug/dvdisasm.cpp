@@ -121,7 +121,10 @@ void debug_view_disasm::view_notify(debug_view_notification type)
 		adjust_visible_y_for_cursor();
 
 	else if (type == VIEW_NOTIFY_SOURCE_CHANGED)
+	{
 		m_expression.set_context(&downcast<const debug_view_disasm_source *>(m_source)->device()->debug()->symtable());
+		m_dasm_cache.clear();
+	}
 }
 
 
@@ -408,8 +411,30 @@ bool debug_view_disasm::recompute(offs_t pc, int startline, int lines)
 				argbuf[numbytes] = machine().debugger().cpu().read_opcode(source.m_space, pcbyte + numbytes, 1);
 			}
 
-			// disassemble the result
-			pc += numbytes = source.m_disasmintf->disassemble(buffer, pc & source.m_space.logaddrmask(), opbuf, argbuf) & DASMFLAG_LENGTHMASK;
+			// reuse the previous disassembly of this address if its bytes are unchanged; the
+			// line being refreshed on its own is always redone so that changes in how the
+			// disassembler reads the same bytes are still noticed
+			auto found = m_dasm_cache.find(pcbyte);
+			if (lines != 1 && found != m_dasm_cache.end() &&
+					std::equal(opbuf, opbuf + maxbytes, found->second.bytes.begin()) &&
+					std::equal(argbuf, argbuf + maxbytes, found->second.bytes.begin() + maxbytes))
+			{
+				buffer << found->second.text;
+				pc += numbytes = found->second.length;
+			}
+			else
+			{
+				// disassemble the result
+				pc += numbytes = source.m_disasmintf->disassemble(buffer, pc & source.m_space.logaddrmask(), opbuf, argbuf) & DASMFLAG_LENGTHMASK;
+
+				if (m_dasm_cache.size() >= DASM_CACHE_SIZE)
+					m_dasm_cache.clear();
+				dasm_cache_entry &entry = m_dasm_cache[pcbyte];
+				entry.bytes.assign(opbuf, opbuf + maxbytes);
+				entry.bytes.insert(entry.bytes.end(), argbuf, argbuf + maxbytes);
+				entry.length = numbytes;
+				entry.text.assign(buffer.vec().begin(), buffer.vec().end());
+			}
 		}
 		else
 			buffer << "<unmapped>";
@@ -442,6 +467,10 @@ bool debug_view_disasm::recompute(offs_t pc, int startline, int lines)
 			changed = true;
 	}
 
+	// if the line changed without its bytes changing, nothing cached can be trusted
+	if (changed)
+		m_dasm_cache.clear();
+
 	// update opcode base information
 	m_last_direct_decrypted = source.m_decrypted_space.direct().ptr();
 	m_last_direct_raw = source.m_space.direct().ptr();
@@ -15,6 +15,8 @@
 
 #include "vecstream.h"
 
+#include <unordered_map>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -93,6 +95,14 @@ private:
 	void generate_bytes(offs_t pcbyte, int numbytes, int minbytes, int maxchars, bool encrypted);
 	bool recompute(offs_t pc, int startline, int lines);
 
+	// an instruction as last disassembled, with the bytes it was disassembled from
+	struct dasm_cache_entry
+	{
+		std::vector<u8> bytes;                  // opcode bytes followed by argument bytes
+		int             length;                 // length returned by the disassembler
+		std::string     text;                   // disassembled text
+	};
+
 	// internal state
 	disasm_right_column m_right_column;         // right column contents
 	u32                 m_backwards_steps;      // number of backwards steps
@@ -106,11 +116,13 @@ private:
 	debug_view_expression m_expression;         // expression-related information
 	std::vector<offs_t> m_byteaddress;               // addresses of the instructions
 	util::ovectorstream m_dasm;                 // disassembled instructions
+	std::unordered_map<offs_t, dasm_cache_entry> m_dasm_cache; // instructions by byte address
 
 	// constants
 	static constexpr int DEFAULT_DASM_LINES = 1000;
 	static constexpr int DEFAULT_DASM_WIDTH = 50;
 	static constexpr int DASM_MAX_BYTES = 16;
+	static constexpr int DASM_CACHE_SIZE = 16 * DEFAULT_DASM_LINES;
 };
 
 
@@ -105,7 +105,9 @@ debug_view_memory::debug_view_memory(running_machine &machine, debug_view_osd_up
 		m_edit_enabled(true),
 		m_maxaddr(0),
 		m_bytes_per_row(16),
-		m_byte_offset(0)
+		m_byte_offset(0),
+		m_rows_valid(false),
+		m_rows_cursor_visible(false)
 {
 	// hack: define some sane init values
 	// that don't hurt the initial computation of top_left
@@ -197,6 +199,7 @@ void debug_view_memory::view_notify(debug_view_notification type)
 		if (m_bytes_per_chunk > 8)
 			m_bytes_per_chunk = 8;
 		m_data_format = m_bytes_per_chunk;
+		m_rows_valid = false;
 		if (source.m_space != nullptr)
 			m_expression.set_context(&source.m_space->device().debug()->symtable());
 		else
@@ -253,6 +256,19 @@ void debug_view_memory::view_update()
 	// get positional data
 	const memory_view_pos &posdata = s_memory_pos_table[m_data_format];
 
+	// rows can only be kept if nothing moved or restyled them since the last update
+	bool const rows_valid = m_rows_valid &&
+			m_rows_topleft.x == m_topleft.x && m_rows_topleft.y == m_topleft.y &&
+			m_rows_visible.x == m_visible.x && m_rows_visible.y == m_visible.y &&
+			m_rows_cursor.x == m_cursor.x && m_rows_cursor.y == m_cursor.y &&
+			m_rows_cursor_visible == m_cursor_visible;
+	m_row_data.resize(m_visible.y * m_bytes_per_row);
+	m_rows_valid = true;
+	m_rows_topleft = m_topleft;
+	m_rows_visible = m_visible;
+	m_rows_cursor = m_cursor;
+	m_rows_cursor_visible = m_cursor_visible;
+
 	// loop over visible rows
 	for (u32 row = 0; row < m_visible.y; row++)
 	{
@@ -260,6 +276,26 @@ void debug_view_memory::view_update()
 		debug_view_char *destmax = destmin + m_visible.x;
 		debug_view_char *destrow = destmin - m_topleft.x;
 		u32 effrow = m_topleft.y + row;
+		u16 *const rowdata = &m_row_data[row * m_bytes_per_row];
+
+		// fetch the bytes for this row, and leave it alone if none of them changed
+		if (effrow < m_total.y)
+		{
+			offs_t addrbyte = m_byte_offset + effrow * m_bytes_per_row;
+			bool changed = !rows_valid;
+			for (int ch = 0; ch < m_bytes_per_row; ch++)
+			{
+				u64 chval;
+				u16 const value = read(1, addrbyte + ch, chval) ? u16(chval & 0xff) : 0x100;
+				if (rowdata[ch] != value)
+				{
+					rowdata[ch] = value;
+					changed = true;
+				}
+			}
+			if (!changed)
+				continue;
+		}
 
 		// reset the line of data; section 1 is normal, others are ancillary, cursor is selected
 		debug_view_char *dest = destmin;
@@ -356,11 +392,7 @@ void debug_view_memory::view_update()
 				dest = destrow + m_section[2].m_pos + 1;
 				for (int ch = 0; ch < m_bytes_per_row; ch++, dest++)
 					if (dest >= destmin && dest < destmax)
-					{
-						u64 chval;
-						bool ismapped = read(1, addrbyte + ch, chval);
-						dest->byte = (ismapped && isprint(chval)) ? chval : '.';
-					}
+						dest->byte = (rowdata[ch] < 0x100 && isprint(rowdata[ch])) ? rowdata[ch] : '.';
 			}
 		}
 	}
@@ -591,6 +623,7 @@ void debug_view_memory::recompute()
 
 	// derive total sizes from that
 	m_total.y = (u64(m_maxaddr) - u64(m_byte_offset) + u64(m_bytes_per_row) /*- 1*/) / m_bytes_per_row;
+	m_rows_valid = false;
 
 	// reset the current cursor position
 	set_cursor_pos(pos);
@@ -112,6 +112,14 @@ private:
 	u32                 m_byte_offset;          // (derived) offset of starting visible byte
 	std::string         m_addrformat;           // (derived) format string to use to print addresses
 
+	// contents of the visible rows as of the last update, so unchanged rows aren't regenerated
+	std::vector<u16>    m_row_data;             // byte values per visible row, 0x100 if unmapped
+	bool                m_rows_valid;           // true if m_row_data describes what's in the view
+	debug_view_xy       m_rows_topleft;         // view position the rows were generated for
+	debug_view_xy       m_rows_visible;         // view size the rows were generated for
+	debug_view_xy       m_rows_cursor;          // cursor position the rows were generated for
+	bool                m_rows_cursor_visible;  // cursor visibility the rows were generated for
+
 	struct section
 	{
 		bool contains(int x) const { return x >= m_pos && x < m_pos + m_width; }
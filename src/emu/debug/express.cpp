@@ -589,6 +589,10 @@ void parsed_expression::parse(const char *expression)
 
 	// convert the infix order to postfix order
 	infix_to_postfix();
+
+	// work out anything that doesn't depend on symbols or memory now, so conditions
+	// evaluated on every breakpoint hit don't have to
+	fold_constants();
 }
 
 
@@ -1340,6 +1344,96 @@ void parsed_expression::infix_to_postfix()
 }
 
 
+//-------------------------------------------------
+//  fold_constant - compute the result of a
+//  side-effect-free operator on constant
+//  operands, returning false if it can't be done
+//  ahead of time
+//-------------------------------------------------
+
+static bool fold_constant(u8 optype, u64 v1, u64 v2, bool unary, u64 &result)
+{
+	if (unary)
+	{
+		switch (optype)
+		{
+			case TVL_COMPLEMENT:        result = !v1;           return true;
+			case TVL_NOT:               result = ~v1;           return true;
+			case TVL_UPLUS:             result = v1;            return true;
+			case TVL_UMINUS:            result = -v1;           return true;
+			default:                                            return false;
+		}
+	}
+
+	switch (optype)
+	{
+		case TVL_MULTIPLY:          result = v1 * v2;       return true;
+		case TVL_DIVIDE:            if (v2 == 0) return false; result = v1 / v2; return true;
+		case TVL_MODULO:            if (v2 == 0) return false; result = v1 % v2; return true;
+		case TVL_ADD:               result = v1 + v2;       return true;
+		case TVL_SUBTRACT:          result = v1 - v2;       return true;
+		case TVL_LSHIFT:            result = v1 << v2;      return true;
+		case TVL_RSHIFT:            result = v1 >> v2;      return true;
+		case TVL_LESS:              result = v1 < v2;       return true;
+		case TVL_LESSOREQUAL:       result = v1 <= v2;      return true;
+		case TVL_GREATER:           result = v1 > v2;       return true;
+		case TVL_GREATEROREQUAL:    result = v1 >= v2;      return true;
+		case TVL_EQUAL:             result = v1 == v2;      return true;
+		case TVL_NOTEQUAL:          result = v1 != v2;      return true;
+		case TVL_BAND:              result = v1 & v2;       return true;
+		case TVL_BXOR:              result = v1 ^ v2;       return true;
+		case TVL_BOR:               result = v1 | v2;       return true;
+		case TVL_LAND:              result = v1 && v2;      return true;
+		case TVL_LOR:               result = v1 || v2;      return true;
+		default:                                            return false;
+	}
+}
+
+
+//-------------------------------------------------
+//  fold_constants - replace operators applied to
+//  numbers in the postfix list with their result;
+//  in postfix order the values directly before an
+//  operator are always its operands
+//-------------------------------------------------
+
+void parsed_expression::fold_constants()
+{
+	bool folded = true;
+	while (folded)
+	{
+		folded = false;
+		parse_token *prev2 = nullptr;
+		parse_token *prev1 = nullptr;
+		for (parse_token *token = m_tokenlist.first(); token != nullptr; prev2 = prev1, prev1 = token, token = token->next())
+		{
+			if (!token->is_operator() || prev1 == nullptr || !prev1->is_number())
+				continue;
+
+			// unary operators take the number right before them
+			u64 value;
+			if (fold_constant(token->optype(), prev1->value(), 0, true, value))
+			{
+				prev1->configure_number(value);
+				m_tokenlist.remove(*token);
+				folded = true;
+				break;
+			}
+
+			// binary operators take the two before that
+			if (prev2 != nullptr && prev2->is_number() && fold_constant(token->optype(), prev2->value(), prev1->value(), false, value))
+			{
+				prev2->configure_number(value).set_offset(*prev2, *prev1);
+				m_tokenlist.remove(*prev1);
+				m_tokenlist.remove(*token);
+				folded = true;
+				break;
+			}
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  push_token - push a token onto the stack
 //-------------------------------------------------
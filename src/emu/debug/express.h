@@ -362,6 +362,7 @@ private:
 	void parse_memory_operator(parse_token &token, const char *string);
 	void normalize_operator(parse_token *prevtoken, parse_token &thistoken);
 	void infix_to_postfix();
+	void fold_constants();
 
 	// execution helpers
 	void push_token(parse_token &token);
@@ -147,6 +147,7 @@ void devcb_base::resolve_space()
 
 devcb_read_base::devcb_read_base(device_t &device, u64 defmask)
 	: devcb_base(device, defmask),
+		m_direct(CALLBACK_NONE),
 		m_adapter(&devcb_read_base::read_unresolved_adapter)
 {
 }
@@ -163,6 +164,7 @@ void devcb_read_base::devcb_reset()
 	m_read16 = read16_delegate();
 	m_read32 = read32_delegate();
 	m_read64 = read64_delegate();
+	m_direct = CALLBACK_NONE;
 	m_adapter = &devcb_read_base::read_unresolved_adapter;
 	m_chain = nullptr;
 }
@@ -275,6 +277,25 @@ void devcb_read_base::resolve()
 		throw emu_fatalerror("devcb_read: Error performing a late bind of type %s to %s (name=%s)\n", binderr.m_actual_type.name(), binderr.m_target_type.name(), name);
 	}
 
+	// skip the shift, mask and XOR steps when they wouldn't change anything
+	if (m_adapter == &devcb_read_base::read_line_adapter && identity_transform(1))
+		m_adapter = &devcb_read_base::read_line_direct_adapter;
+	else if (m_adapter == &devcb_read_base::read8_adapter && identity_transform(0xff))
+		m_adapter = &devcb_read_base::read8_direct_adapter;
+	else if (m_adapter == &devcb_read_base::read16_adapter && identity_transform(0xffff))
+		m_adapter = &devcb_read_base::read16_direct_adapter;
+	else if (m_adapter == &devcb_read_base::read32_adapter && identity_transform(0xffffffff))
+		m_adapter = &devcb_read_base::read32_direct_adapter;
+	else if (m_adapter == &devcb_read_base::read64_adapter && identity_transform(0xffffffffffffffffU))
+		m_adapter = &devcb_read_base::read64_direct_adapter;
+
+	// without a chain, the callers can go straight to the delegate
+	bool const direct = (m_chain == nullptr) && (
+			m_adapter == &devcb_read_base::read_line_direct_adapter || m_adapter == &devcb_read_base::read8_direct_adapter ||
+			m_adapter == &devcb_read_base::read16_direct_adapter || m_adapter == &devcb_read_base::read32_direct_adapter ||
+			m_adapter == &devcb_read_base::read64_direct_adapter);
+	m_direct = direct ? m_type : CALLBACK_NONE;
+
 	// resolve callback chain recursively
 	if (m_chain != nullptr)
 		m_chain->resolve();
@@ -365,6 +386,37 @@ u64 devcb_read_base::read64_adapter(address_space &space, offs_t offset, u64 mas
 }
 
 
+//-------------------------------------------------
+//  read*_direct_adapter - read from a delegate
+//  with no shift, mask or XOR to apply
+//-------------------------------------------------
+
+u64 devcb_read_base::read_line_direct_adapter(address_space &space, offs_t offset, u64 mask)
+{
+	return m_readline() & 1;
+}
+
+u64 devcb_read_base::read8_direct_adapter(address_space &space, offs_t offset, u64 mask)
+{
+	return m_read8(space, offset, mask);
+}
+
+u64 devcb_read_base::read16_direct_adapter(address_space &space, offs_t offset, u64 mask)
+{
+	return m_read16(space, offset, mask);
+}
+
+u64 devcb_read_base::read32_direct_adapter(address_space &space, offs_t offset, u64 mask)
+{
+	return m_read32(space, offset, mask);
+}
+
+u64 devcb_read_base::read64_direct_adapter(address_space &space, offs_t offset, u64 mask)
+{
+	return m_read64(space, offset, mask);
+}
+
+
 //-------------------------------------------------
 //  read_ioport - read from an I/O port
 //-------------------------------------------------
@@ -408,6 +460,7 @@ u64 devcb_read_base::read_constant_adapter(address_space &space, offs_t offset,
 
 devcb_write_base::devcb_write_base(device_t &device, u64 defmask)
 	: devcb_base(device, defmask),
+		m_direct(CALLBACK_NONE),
 		m_adapter(&devcb_write_base::write_unresolved_adapter)
 {
 }
@@ -424,6 +477,7 @@ void devcb_write_base::devcb_reset()
 	m_write16 = write16_delegate();
 	m_write32 = write32_delegate();
 	m_write64 = write64_delegate();
+	m_direct = CALLBACK_NONE;
 	m_adapter = &devcb_write_base::write_unresolved_adapter;
 	m_chain = nullptr;
 }
@@ -533,6 +587,25 @@ void devcb_write_base::resolve()
 		throw emu_fatalerror("devcb_write: Error performing a late bind of type %s to %s (name=%s)\n", binderr.m_actual_type.name(), binderr.m_target_type.name(), name);
 	}
 
+	// skip the shift, mask and XOR steps when they wouldn't change anything
+	if (m_adapter == &devcb_write_base::write_line_adapter && identity_transform(1))
+		m_adapter = &devcb_write_base::write_line_direct_adapter;
+	else if (m_adapter == &devcb_write_base::write8_adapter && identity_transform(0xff))
+		m_adapter = &devcb_write_base::write8_direct_adapter;
+	else if (m_adapter == &devcb_write_base::write16_adapter && identity_transform(0xffff))
+		m_adapter = &devcb_write_base::write16_direct_adapter;
+	else if (m_adapter == &devcb_write_base::write32_adapter && identity_transform(0xffffffff))
+		m_adapter = &devcb_write_base::write32_direct_adapter;
+	else if (m_adapter == &devcb_write_base::write64_adapter && identity_transform(0xffffffffffffffffU))
+		m_adapter = &devcb_write_base::write64_direct_adapter;
+
+	// without a chain, the callers can go straight to the delegate
+	bool const direct = (m_chain == nullptr) && (
+			m_adapter == &devcb_write_base::write_line_direct_adapter || m_adapter == &devcb_write_base::write8_direct_adapter ||
+			m_adapter == &devcb_write_base::write16_direct_adapter || m_adapter == &devcb_write_base::write32_direct_adapter ||
+			m_adapter == &devcb_write_base::write64_direct_adapter);
+	m_direct = direct ? m_type : CALLBACK_NONE;
+
 	// resolve callback chain recursively
 	if (m_chain != nullptr)
 		m_chain->resolve();
@@ -614,6 +687,37 @@ void devcb_write_base::write64_adapter(address_space &space, offs_t offset, u64
 }
 
 
+//-------------------------------------------------
+//  write*_direct_adapter - write to a delegate
+//  with no shift, mask or XOR to apply
+//-------------------------------------------------
+
+void devcb_write_base::write_line_direct_adapter(address_space &space, offs_t offset, u64 data, u64 mask)
+{
+	m_writeline(data & 1);
+}
+
+void devcb_write_base::write8_direct_adapter(address_space &space, offs_t offset, u64 data, u64 mask)
+{
+	m_write8(space, offset, data, mask);
+}
+
+void devcb_write_base::write16_direct_adapter(address_space &space, offs_t offset, u64 data, u64 mask)
+{
+	m_write16(space, offset, data, mask);
+}
+
+void devcb_write_base::write32_direct_adapter(address_space &space, offs_t offset, u64 data, u64 mask)
+{
+	m_write32(space, offset, data, mask);
+}
+
+void devcb_write_base::write64_direct_adapter(address_space &space, offs_t offset, u64 data, u64 mask)
+{
+	m_write64(space, offset, data, mask);
+}
+
+
 //-------------------------------------------------
 //  write_ioport_adapter - write to an I/O port
 //-------------------------------------------------
@@ -194,6 +194,7 @@ protected:
 	inline u64 shift_mask_xor(u64 value) const { return (((m_rshift < 0) ? (value << -m_rshift) : (value >> m_rshift)) ^ m_xor) & m_mask; }
 	inline u64 unshift_mask(u64 value) const { return (m_rshift < 0) ? ((value & m_mask) >> -m_rshift) : ((value & m_mask) << m_rshift); }
 	inline u64 unshift_mask_xor(u64 value) const { return (m_rshift < 0) ? (((value ^ m_xor) & m_mask) >> -m_rshift) : (((value ^ m_xor) & m_mask) << m_rshift); }
+	bool identity_transform(u64 width) const { return (m_rshift == 0) && (m_xor == 0) && ((m_mask & width) == width); }
 	void reset(callback_type type);
 	virtual void devcb_reset() = 0;
 	void resolve_ioport();
@@ -263,10 +264,16 @@ private:
 	u64 read16_adapter(address_space &space, offs_t offset, u64 mask);
 	u64 read32_adapter(address_space &space, offs_t offset, u64 mask);
 	u64 read64_adapter(address_space &space, offs_t offset, u64 mask);
+	u64 read_line_direct_adapter(address_space &space, offs_t offset, u64 mask);
+	u64 read8_direct_adapter(address_space &space, offs_t offset, u64 mask);
+	u64 read16_direct_adapter(address_space &space, offs_t offset, u64 mask);
+	u64 read32_direct_adapter(address_space &space, offs_t offset, u64 mask);
+	u64 read64_direct_adapter(address_space &space, offs_t offset, u64 mask);
 	u64 read_ioport_adapter(address_space &space, offs_t offset, u64 mask);
 	u64 read_logged_adapter(address_space &space, offs_t offset, u64 mask);
 	u64 read_constant_adapter(address_space &space, offs_t offset, u64 mask);
 
+protected:
 	// configuration
 	read_line_delegate  m_readline;             // copy of registered line reader
 	read8_delegate      m_read8;                // copy of registered 8-bit reader
@@ -275,6 +282,9 @@ private:
 	read64_delegate     m_read64;               // copy of registered 64-bit reader
 
 	// derived state
+	callback_type       m_direct;               // delegate type callable without an adapter, or CALLBACK_NONE
+
+private:
 	typedef u64 (devcb_read_base::*adapter_func)(address_space &, offs_t, u64);
 	adapter_func        m_adapter;              // actual callback to invoke
 	std::unique_ptr<devcb_read_base> m_chain;   // next callback for chained input
@@ -319,6 +329,11 @@ private:
 	void write16_adapter(address_space &space, offs_t offset, u64 data, u64 mask);
 	void write32_adapter(address_space &space, offs_t offset, u64 data, u64 mask);
 	void write64_adapter(address_space &space, offs_t offset, u64 data, u64 mask);
+	void write_line_direct_adapter(address_space &space, offs_t offset, u64 data, u64 mask);
+	void write8_direct_adapter(address_space &space, offs_t offset, u64 data, u64 mask);
+	void write16_direct_adapter(address_space &space, offs_t offset, u64 data, u64 mask);
+	void write32_direct_adapter(address_space &space, offs_t offset, u64 data, u64 mask);
+	void write64_direct_adapter(address_space &space, offs_t offset, u64 data, u64 mask);
 	void write_ioport_adapter(address_space &space, offs_t offset, u64 data, u64 mask);
 	void write_membank_adapter(address_space &space, offs_t offset, u64 data, u64 mask);
 	void write_logged_adapter(address_space &space, offs_t offset, u64 data, u64 mask);
@@ -327,6 +342,7 @@ private:
 	void write_assertline_adapter(address_space &space, offs_t offset, u64 data, u64 mask);
 	void write_clearline_adapter(address_space &space, offs_t offset, u64 data, u64 mask);
 
+protected:
 	// configuration
 	write_line_delegate m_writeline;            // copy of registered line writer
 	write8_delegate     m_write8;               // copy of registered 8-bit writer
@@ -335,6 +351,9 @@ private:
 	write64_delegate    m_write64;              // copy of registered 64-bit writer
 
 	// derived state
+	callback_type       m_direct;               // delegate type callable without an adapter, or CALLBACK_NONE
+
+private:
 	typedef void (devcb_write_base::*adapter_func)(address_space &, offs_t, u64, u64);
 	adapter_func        m_adapter;              // actual callback to invoke
 	std::unique_ptr<devcb_write_base> m_chain;  // next callback for chained output
@@ -347,8 +366,8 @@ class devcb_read_line : public devcb_read_base
 {
 public:
 	devcb_read_line(device_t &device) : devcb_read_base(device, 0xff) { }
-	int operator()() { return read(*m_space, 0, 0xffU) & 1; }
-	int operator()(address_space &space) { return read((m_space_tag != nullptr) ? *m_space : space, 0, 0xffU) & 1; }
+	int operator()() { return (m_direct == CALLBACK_LINE) ? (m_readline() & 1) : (read(*m_space, 0, 0xffU) & 1); }
+	int operator()(address_space &space) { return (m_direct == CALLBACK_LINE) ? (m_readline() & 1) : (read((m_space_tag != nullptr) ? *m_space : space, 0, 0xffU) & 1); }
 };
 
 
@@ -358,8 +377,8 @@ class devcb_read8 : public devcb_read_base
 {
 public:
 	devcb_read8(device_t &device) : devcb_read_base(device, 0xff) { }
-	u8 operator()(offs_t offset = 0, u8 mask = 0xff) { return read(*m_space, offset, mask) & mask; }
-	u8 operator()(address_space &space, offs_t offset = 0, u8 mask = 0xff) { return read((m_space_tag != nullptr) ? *m_space : space, offset, mask) & mask; }
+	u8 operator()(offs_t offset = 0, u8 mask = 0xff) { return ((m_direct == CALLBACK_8) ? m_read8(*m_space, offset, mask) : read(*m_space, offset, mask)) & mask; }
+	u8 operator()(address_space &space, offs_t offset = 0, u8 mask = 0xff) { return ((m_direct == CALLBACK_8) ? m_read8((m_space_tag != nullptr) ? *m_space : space, offset, mask) : read((m_space_tag != nullptr) ? *m_space : space, offset, mask)) & mask; }
 };
 
 
@@ -369,8 +388,8 @@ class devcb_read16 : public devcb_read_base
 {
 public:
 	devcb_read16(device_t &device) : devcb_read_base(device, 0xffff) { }
-	u16 operator()(offs_t offset = 0, u16 mask = 0xffff) { return read(*m_space, offset, mask) & mask; }
-	u16 operator()(address_space &space, offs_t offset = 0, u16 mask = 0xffff) { return read((m_space_tag != nullptr) ? *m_space : space, offset, mask) & mask; }
+	u16 operator()(offs_t offset = 0, u16 mask = 0xffff) { return ((m_direct == CALLBACK_16) ? m_read16(*m_space, offset, mask) : read(*m_space, offset, mask)) & mask; }
+	u16 operator()(address_space &space, offs_t offset = 0, u16 mask = 0xffff) { return ((m_direct == CALLBACK_16) ? m_read16((m_space_tag != nullptr) ? *m_space : space, offset, mask) : read((m_space_tag != nullptr) ? *m_space : space, offset, mask)) & mask; }
 };
 
 
@@ -380,8 +399,8 @@ class devcb_read32 : public devcb_read_base
 {
 public:
 	devcb_read32(device_t &device) : devcb_read_base(device, 0xffffffff) { }
-	u32 operator()(offs_t offset = 0, u32 mask = 0xffffffff) { return read(*m_space, offset, mask) & mask; }
-	u32 operator()(address_space &space, offs_t offset = 0, u32 mask = 0xffffffff) { return read((m_space_tag != nullptr) ? *m_space : space, offset, mask) & mask; }
+	u32 operator()(offs_t offset = 0, u32 mask = 0xffffffff) { return ((m_direct == CALLBACK_32) ? m_read32(*m_space, offset, mask) : read(*m_space, offset, mask)) & mask; }
+	u32 operator()(address_space &space, offs_t offset = 0, u32 mask = 0xffffffff) { return ((m_direct == CALLBACK_32) ? m_read32((m_space_tag != nullptr) ? *m_space : space, offset, mask) : read((m_space_tag != nullptr) ? *m_space : space, offset, mask)) & mask; }
 };
 
 
@@ -391,8 +410,8 @@ class devcb_read64 : public devcb_read_base
 {
 public:
 	devcb_read64(device_t &device) : devcb_read_base(device, 0xffffffffffffffffU) { }
-	u64 operator()(offs_t offset = 0, u64 mask = 0xffffffffffffffffU) { return read(*m_space, offset, mask) & mask; }
-	u64 operator()(address_space &space, offs_t offset = 0, u64 mask = 0xffffffffffffffffU) { return read((m_space_tag != nullptr) ? *m_space : space, offset, mask) & mask; }
+	u64 operator()(offs_t offset = 0, u64 mask = 0xffffffffffffffffU) { return ((m_direct == CALLBACK_64) ? m_read64(*m_space, offset, mask) : read(*m_space, offset, mask)) & mask; }
+	u64 operator()(address_space &space, offs_t offset = 0, u64 mask = 0xffffffffffffffffU) { return ((m_direct == CALLBACK_64) ? m_read64((m_space_tag != nullptr) ? *m_space : space, offset, mask) : read((m_space_tag != nullptr) ? *m_space : space, offset, mask)) & mask; }
 };
 
 
@@ -402,8 +421,8 @@ class devcb_write_line : public devcb_write_base
 {
 public:
 	devcb_write_line(device_t &device) : devcb_write_base(device, 0xff) { }
-	void operator()(int state) { write(*m_space, 0, state & 1, 0xffU); }
-	void operator()(address_space &space, int state) { write((m_space_tag != nullptr) ? *m_space : space, 0, state & 1, 0xffU); }
+	void operator()(int state) { if (m_direct == CALLBACK_LINE) m_writeline(state & 1); else write(*m_space, 0, state & 1, 0xffU); }
+	void operator()(address_space &space, int state) { if (m_direct == CALLBACK_LINE) m_writeline(state & 1); else write((m_space_tag != nullptr) ? *m_space : space, 0, state & 1, 0xffU); }
 };
 
 
@@ -413,9 +432,9 @@ class devcb_write8 : public devcb_write_base
 {
 public:
 	devcb_write8(device_t &device) : devcb_write_base(device, 0xff) { }
-	void operator()(u8 data, u8 mask = 0xff) { write(*m_space, 0, data, mask); }
-	void operator()(offs_t offset, u8 data, u8 mask = 0xff) { write(*m_space, offset, data, mask); }
-	void operator()(address_space &space, offs_t offset, u8 data, u8 mask = 0xff) { write((m_space_tag != nullptr) ? *m_space : space, offset, data, mask); }
+	void operator()(u8 data, u8 mask = 0xff) { if (m_direct == CALLBACK_8) m_write8(*m_space, 0, data, mask); else write(*m_space, 0, data, mask); }
+	void operator()(offs_t offset, u8 data, u8 mask = 0xff) { if (m_direct == CALLBACK_8) m_write8(*m_space, offset, data, mask); else write(*m_space, offset, data, mask); }
+	void operator()(address_space &space, offs_t offset, u8 data, u8 mask = 0xff) { if (m_direct == CALLBACK_8) m_write8((m_space_tag != nullptr) ? *m_space : space, offset, data, mask); else write((m_space_tag != nullptr) ? *m_space : space, offset, data, mask); }
 };
 
 
@@ -425,9 +444,9 @@ class devcb_write16 : public devcb_write_base
 {
 public:
 	devcb_write16(device_t &device) : devcb_write_base(device, 0xffff) { }
-	void operator()(u16 data, u16 mask = 0xffff) { write(*m_space, 0, data, mask); }
-	void operator()(offs_t offset, u16 data, u16 mask = 0xffff) { write(*m_space, offset, data, mask); }
-	void operator()(address_space &space, offs_t offset, u16 data, u16 mask = 0xffff) { write((m_space_tag != nullptr) ? *m_space : space, offset, data, mask); }
+	void operator()(u16 data, u16 mask = 0xffff) { if (m_direct == CALLBACK_16) m_write16(*m_space, 0, data, mask); else write(*m_space, 0, data, mask); }
+	void operator()(offs_t offset, u16 data, u16 mask = 0xffff) { if (m_direct == CALLBACK_16) m_write16(*m_space, offset, data, mask); else write(*m_space, offset, data, mask); }
+	void operator()(address_space &space, offs_t offset, u16 data, u16 mask = 0xffff) { if (m_direct == CALLBACK_16) m_write16((m_space_tag != nullptr) ? *m_space : space, offset, data, mask); else write((m_space_tag != nullptr) ? *m_space : space, offset, data, mask); }
 };
 
 
@@ -437,9 +456,9 @@ class devcb_write32 : public devcb_write_base
 {
 public:
 	devcb_write32(device_t &device) : devcb_write_base(device, 0xffffffff) { }
-	void operator()(u32 data, u32 mask = 0xffffffff) { write(*m_space, 0, data, mask); }
-	void operator()(offs_t offset, u32 data, u32 mask = 0xffffffff) { write(*m_space, offset, data, mask); }
-	void operator()(address_space &space, offs_t offset, u32 data, u32 mask = 0xffffffff) { write((m_space_tag != nullptr) ? *m_space : space, offset, data, mask); }
+	void operator()(u32 data, u32 mask = 0xffffffff) { if (m_direct == CALLBACK_32) m_write32(*m_space, 0, data, mask); else write(*m_space, 0, data, mask); }
+	void operator()(offs_t offset, u32 data, u32 mask = 0xffffffff) { if (m_direct == CALLBACK_32) m_write32(*m_space, offset, data, mask); else write(*m_space, offset, data, mask); }
+	void operator()(address_space &space, offs_t offset, u32 data, u32 mask = 0xffffffff) { if (m_direct == CALLBACK_32) m_write32((m_space_tag != nullptr) ? *m_space : space, offset, data, mask); else write((m_space_tag != nullptr) ? *m_space : space, offset, data, mask); }
 };
 
 
@@ -449,9 +468,9 @@ class devcb_write64 : public devcb_write_base
 {
 public:
 	devcb_write64(device_t &device) : devcb_write_base(device, 0xffffffffffffffffU) { }
-	void operator()(u64 data, u64 mask = 0xffffffffffffffffU) { write(*m_space, 0, data, mask); }
-	void operator()(offs_t offset, u64 data, u64 mask = 0xffffffffffffffffU) { write(*m_space, offset, data, mask); }
-	void operator()(address_space &space, offs_t offset, u64 data, u64 mask = 0xffffffffffffffffU) { write((m_space_tag != nullptr) ? *m_space : space, offset, data, mask); }
+	void operator()(u64 data, u64 mask = 0xffffffffffffffffU) { if (m_direct == CALLBACK_64) m_write64(*m_space, 0, data, mask); else write(*m_space, 0, data, mask); }
+	void operator()(offs_t offset, u64 data, u64 mask = 0xffffffffffffffffU) { if (m_direct == CALLBACK_64) m_write64(*m_space, offset, data, mask); else write(*m_space, offset, data, mask); }
+	void operator()(address_space &space, offs_t offset, u64 data, u64 mask = 0xffffffffffffffffU) { if (m_direct == CALLBACK_64) m_write64((m_space_tag != nullptr) ? *m_space : space, offset, data, mask); else write((m_space_tag != nullptr) ? *m_space : space, offset, data, mask); }
 };
 
 
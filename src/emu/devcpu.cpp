@@ -27,7 +27,10 @@ cpu_device::cpu_device(const machine_config &mconfig, device_type type, const ch
 		device_memory_interface(mconfig, *this),
 		device_state_interface(mconfig, *this),
 		device_disasm_interface(mconfig, *this),
-		m_force_no_drc(false)
+		m_force_no_drc(false),
+		m_idle_detect(false),
+		m_idle_target(~0),
+		m_idle_count(0)
 {
 }
 
@@ -52,6 +55,17 @@ void cpu_device::static_set_force_no_drc(device_t &device, bool value)
 }
 
 
+//-------------------------------------------------
+//  static_set_idle_detect - configuration helper
+//  to enable skipping of detected idle loops
+//-------------------------------------------------
+
+void cpu_device::static_set_idle_detect(device_t &device, bool value)
+{
+	downcast<cpu_device &>(device).m_idle_detect = value;
+}
+
+
 //-------------------------------------------------
 //  allow_drc - return true if DRC is allowed
 //-------------------------------------------------
@@ -60,3 +74,43 @@ bool cpu_device::allow_drc() const
 {
 	return mconfig().options().drc() && !m_force_no_drc;
 }
+
+
+//-------------------------------------------------
+//  idle_branch_check - watch a short backward
+//  branch; if the CPU state is identical every
+//  IDLE_LOOP_ITERATIONS times round the loop, it
+//  can only be waiting for something outside the
+//  CPU, so skip to the end of the timeslice
+//-------------------------------------------------
+
+void cpu_device::idle_branch_check(offs_t target)
+{
+	// a different loop starts the count over
+	if (target != m_idle_target)
+	{
+		m_idle_target = target;
+		m_idle_count = 0;
+		m_idle_state.clear();
+		return;
+	}
+	if (++m_idle_count < IDLE_LOOP_ITERATIONS)
+		return;
+	m_idle_count = 0;
+
+	// snapshot everything the core exposes, less anything that changes by itself
+	m_idle_current.clear();
+	for (auto &entry : state_entries())
+		if (std::find(m_idle_ignore.begin(), m_idle_ignore.end(), entry->index()) == m_idle_ignore.end())
+			m_idle_current.push_back(state_int(entry->index()));
+
+	// nothing changed since the last comparison: eat the rest of the timeslice
+	if (m_idle_current == m_idle_state)
+	{
+		int remaining = cycles_remaining();
+		if (remaining > 0)
+			eat_cycles(remaining);
+	}
+	else
+		m_idle_state.swap(m_idle_current);
+}
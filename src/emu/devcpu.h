@@ -47,6 +47,10 @@
 #define MCFG_CPU_FORCE_NO_DRC() \
 	cpu_device::static_set_force_no_drc(*device, true);
 
+// idle loop detection
+#define MCFG_CPU_IDLE_DETECT() \
+	cpu_device::static_set_idle_detect(*device, true);
+
 
 
 //**************************************************************************
@@ -73,16 +77,55 @@ class cpu_device :  public device_t,
 public:
 	// configuration helpers
 	static void static_set_force_no_drc(device_t &device, bool value);
+	static void static_set_idle_detect(device_t &device, bool value);
 	bool allow_drc() const;
 
+	// idle loop detection; cores call this on every taken branch
+	void idle_branch(offs_t pc, offs_t target) { if (m_idle_detect && target <= pc && pc - target <= IDLE_LOOP_BYTES) idle_branch_check(target); }
+
 protected:
 	// construction/destruction
 	cpu_device(const machine_config &mconfig, device_type type, const char *name, const char *tag, device_t *owner, u32 clock, const char *shortname, const char *source);
 	virtual ~cpu_device();
 
+	// exclude a state entry that changes on its own (e.g. a refresh counter) from idle loop comparisons
+	void idle_ignore_state(int index) { m_idle_ignore.push_back(index); }
+
+	// process-wide, reference-counted cache of immutable tables; every instance asking for the
+	// same Tables type and configuration key shares one copy, freed with the last instance
+	template <typename Tables, typename Builder>
+	static std::shared_ptr<const Tables> shared_tables(u32 key, Builder &&build)
+	{
+		static std::unordered_map<u32, std::weak_ptr<const Tables>> s_cache;
+		std::shared_ptr<const Tables> result = s_cache[key].lock();
+		if (!result)
+		{
+			std::shared_ptr<Tables> tables = std::make_shared<Tables>();
+			build(*tables);
+			result = tables;
+			s_cache[key] = result;
+		}
+		return result;
+	}
+
 private:
+	// internal helpers
+	void idle_branch_check(offs_t target);
+
+	// idle loop detection parameters
+	static constexpr offs_t IDLE_LOOP_BYTES = 16;       // largest loop body considered
+	static constexpr u32 IDLE_LOOP_ITERATIONS = 16;     // iterations between state comparisons
+
 	// configured state
 	bool                    m_force_no_drc;             // whether or not to force DRC off
+	bool                    m_idle_detect;              // whether or not to skip detected idle loops
+
+	// idle loop detection state
+	offs_t                  m_idle_target;              // target of the loop being watched
+	u32                     m_idle_count;               // iterations since the last comparison
+	std::vector<u64>        m_idle_state;               // state snapshot at the last comparison
+	std::vector<u64>        m_idle_current;             // scratch snapshot for the current comparison
+	std::vector<int>        m_idle_ignore;              // state entries left out of the comparison
 };
 
 
@@ -286,6 +286,8 @@ public:
 	void ATTR_COLD save_item(_ItemType &value, const char *valname, int index = 0) { assert(m_save != nullptr); m_save->save_item(this, name(), tag(), index, value, valname); }
 	template<typename _ItemType>
 	void ATTR_COLD save_pointer(_ItemType *value, const char *valname, u32 count, int index = 0) { assert(m_save != nullptr); m_save->save_pointer(this, name(), tag(), index, value, valname, count); }
+	template<typename _ElementType, typename _StructType>
+	void ATTR_COLD save_struct(_StructType &value, const char *valname, int index = 0) { assert(m_save != nullptr); m_save->save_struct<_ElementType>(this, name(), tag(), index, value, valname); }
 
 	// debugging
 	device_debug *debug() const { return m_debug.get(); }
@@ -299,6 +301,7 @@ public:
 	// misc
 	template <typename Format, typename... Params> void popmessage(Format &&fmt, Params &&... args) const;
 	template <typename Format, typename... Params> void logerror(Format &&fmt, Params &&... args) const;
+	bool logging_enabled() const;
 
 protected:
 	// miscellaneous helpers
@@ -28,17 +28,22 @@ inline void device_t::popmessage(Format &&fmt, Params &&... args) const
 		m_machine->popmessage(std::forward<Format>(fmt), std::forward<Params>(args)...);
 }
 
+inline bool device_t::logging_enabled() const
+{
+	return m_machine != nullptr && m_machine->allow_logging();
+}
+
 template <typename Format, typename... Params>
 inline void device_t::logerror(Format &&fmt, Params &&... args) const
 {
-	if (m_machine != nullptr && m_machine->allow_logging())
+	if (logging_enabled())
 	{
 		g_profiler.start(PROFILER_LOGERROR);
 
 		// dump to the buffer
 		m_string_buffer.clear();
 		m_string_buffer.seekp(0);
-		util::stream_format(m_string_buffer, "[%s] ", tag());
+		m_string_buffer << '[' << tag() << "] ";
 		util::stream_format(m_string_buffer, std::forward<Format>(fmt), std::forward<Params>(args)...);
 		m_string_buffer.put('\0');
 
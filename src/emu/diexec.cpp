@@ -44,9 +44,11 @@ const int TRIGGER_SUSPENDTIME   = -4000;
 device_execute_interface::device_execute_interface(const machine_config &mconfig, device_t &device)
 	: device_interface(device, "execute"),
 		m_disabled(false),
+		m_execute_group(0),
 		m_vblank_interrupt_screen(nullptr),
 		m_timed_interrupt_period(attotime::zero),
 		m_nextexec(nullptr),
+		m_nextgroupexec(nullptr),
 		m_timedint_timer(nullptr),
 		m_profiler(PROFILER_IDLE),
 		m_icountptr(nullptr),
@@ -94,6 +96,24 @@ void device_execute_interface::static_set_disable(device_t &device)
 }
 
 
+//-------------------------------------------------
+//  static_set_execute_group - configuration
+//  helper to place the device in an execution
+//  group; devices in different non-zero groups
+//  must only communicate through timers
+//-------------------------------------------------
+
+void device_execute_interface::static_set_execute_group(device_t &device, int group)
+{
+	device_execute_interface *exec;
+	if (!device.interface(exec))
+		throw emu_fatalerror("MCFG_DEVICE_EXECUTE_GROUP called on device '%s' with no execute interface", device.tag());
+	if (group < 0 || group >= MAX_EXECUTE_GROUPS)
+		throw emu_fatalerror("MCFG_DEVICE_EXECUTE_GROUP called on device '%s' with group %d out of range (0-%d)", device.tag(), group, MAX_EXECUTE_GROUPS - 1);
+	exec->m_execute_group = group;
+}
+
+
 //-------------------------------------------------
 //  static_set_vblank_int - configuration helper
 //  to set up VBLANK interrupts on the device
@@ -458,6 +478,9 @@ void device_execute_interface::interface_validity_check(validity_checker &valid)
 		osd_printf_error("Timed interrupt handler specified with 0 period\n");
 	else if (m_timed_interrupt.isnull() && m_timed_interrupt_period != attotime::zero)
 		osd_printf_error("No timer interrupt handler specified, but has a non-0 period given\n");
+
+	if (m_execute_group < 0 || m_execute_group >= MAX_EXECUTE_GROUPS)
+		osd_printf_error("Execution group %d is out of range (0-%d)\n", m_execute_group, MAX_EXECUTE_GROUPS - 1);
 }
 
 
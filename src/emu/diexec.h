@@ -32,6 +32,9 @@ constexpr u32 SUSPEND_REASON_TIMESLICE  = 0x0020;   // waiting for the next time
 constexpr u32 SUSPEND_REASON_CLOCK      = 0x0040;   // currently not clocked
 constexpr u32 SUSPEND_ANY_REASON        = ~0;       // all of the above
 
+// number of execution groups a machine may declare
+constexpr int MAX_EXECUTE_GROUPS        = 8;
+
 
 // I/O line states
 enum line_state
@@ -87,6 +90,8 @@ enum
 
 #define MCFG_DEVICE_DISABLE() \
 	device_execute_interface::static_set_disable(*device);
+#define MCFG_DEVICE_EXECUTE_GROUP(_group) \
+	device_execute_interface::static_set_execute_group(*device, _group);
 #define MCFG_DEVICE_VBLANK_INT_DRIVER(_tag, _class, _func) \
 	device_execute_interface::static_set_vblank_int(*device, device_interrupt_delegate(&_class::_func, #_class "::" #_func, DEVICE_SELF, (_class *)nullptr), _tag);
 #define MCFG_DEVICE_VBLANK_INT_DEVICE(_tag, _devtag, _class, _func) \
@@ -138,6 +143,7 @@ public:
 
 	// configuration access
 	bool disabled() const { return m_disabled; }
+	int execute_group() const { return m_execute_group; }
 	u64 clocks_to_cycles(u64 clocks) const { return execute_clocks_to_cycles(clocks); }
 	u64 cycles_to_clocks(u64 cycles) const { return execute_cycles_to_clocks(cycles); }
 	u32 min_cycles() const { return execute_min_cycles(); }
@@ -149,6 +155,7 @@ public:
 
 	// static inline configuration helpers
 	static void static_set_disable(device_t &device);
+	static void static_set_execute_group(device_t &device, int group);
 	static void static_set_vblank_int(device_t &device, device_interrupt_delegate function, const char *tag, int rate = 0);
 	static void static_set_periodic_int(device_t &device, device_interrupt_delegate function, const attotime &rate);
 	static void static_set_irq_acknowledge_callback(device_t &device, device_irq_acknowledge_delegate callback);
@@ -254,6 +261,7 @@ protected:
 
 	// configuration
 	bool                    m_disabled;                 // disabled from executing?
+	int                     m_execute_group;            // execution group; groups other than 0 may run on worker threads
 	device_interrupt_delegate m_vblank_interrupt;       // for interrupts tied to VBLANK
 	const char *            m_vblank_interrupt_screen;  // the screen that causes the VBLANK interrupt
 	device_interrupt_delegate m_timed_interrupt;        // for interrupts not tied to VBLANK
@@ -261,6 +269,7 @@ protected:
 
 	// execution lists
 	device_execute_interface *m_nextexec;               // pointer to the next device to execute, in order
+	device_execute_interface *m_nextgroupexec;          // pointer to the next device to execute in the same group
 
 	// input states and IRQ callbacks
 	device_irq_acknowledge_delegate m_driver_irq;       // driver-specific IRQ callback
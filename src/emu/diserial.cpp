@@ -156,8 +156,10 @@ WRITE_LINE_MEMBER(device_serial_interface::clock_w)
 void device_serial_interface::device_timer(emu_timer &timer, device_timer_id id, int param, void *ptr)
 {
 	switch(id) {
-	case TRA_TIMER_ID: tx_clock_w(!m_tra_clock_state); break;
-	case RCV_TIMER_ID: rx_clock_w(!m_rcv_clock_state); break;
+	// the internal clocks only fire on the active edge, so there is one
+	// event per bit instead of one per half bit
+	case TRA_TIMER_ID: m_tra_clock_state = true; tra_edge(); break;
+	case RCV_TIMER_ID: m_rcv_clock_state = false; rcv_edge(); break;
 	}
 }
 
@@ -222,8 +224,9 @@ WRITE_LINE_MEMBER(device_serial_interface::rx_w)
 	if(m_rcv_flags & RECEIVE_REGISTER_SYNCHRONISED)
 	{
 		if(m_rcv_clock && !(m_rcv_rate.is_never()))
-			// make start delay just a bit longer to make sure we are called after the sender
-			m_rcv_clock->adjust(((m_rcv_rate*3)/2), 0, m_rcv_rate);
+			// make start delay just a bit longer to make sure we are called after the sender;
+			// the first falling edge is one half bit later if the clock is currently low
+			m_rcv_clock->adjust(((m_rcv_rate*3)/2) + (m_rcv_clock_state ? attotime::zero : m_rcv_rate), 0, m_rcv_rate*2);
 		else if(m_start_bit_hack_for_external_clocks)
 			m_rcv_bit_count_received--;
 	}
@@ -374,8 +377,9 @@ void device_serial_interface::transmit_register_setup(u8 data_byte)
 	int i;
 	unsigned char transmit_data;
 
+	// the first rising edge is one half bit later if the clock is currently high
 	if(m_tra_clock && !m_tra_rate.is_never())
-		m_tra_clock->adjust(m_tra_rate, 0, m_tra_rate);
+		m_tra_clock->adjust(m_tra_clock_state ? (m_tra_rate*2) : m_tra_rate, 0, m_tra_rate*2);
 
 	m_tra_bit_count_transmitted = 0;
 	m_tra_bit_count = 0;
@@ -8,8 +8,26 @@
 *********************************************************************/
 
 #include "emu.h"
+#include "emuopts.h"
 #include "drawgfxm.h"
 
+#if defined(__SSE2__) || (defined(_MSC_VER) && defined(PTR64))
+#include <emmintrin.h>
+#define DRAWGFX_SSE2_TRANSPEN   (1)
+#else
+#define DRAWGFX_SSE2_TRANSPEN   (0)
+#endif
+
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+// sets that would decode to more than -gfx_decode_budget use a decode cache
+// of this fraction of the budget, and of at least this many elements
+const u32 GFX_DECODE_CACHE_DIVISOR = 4;
+const u32 GFX_DECODE_CACHE_MIN_SLOTS = 1024;
+
 
 /***************************************************************************
     GLOBAL VARIABLES
@@ -61,6 +79,192 @@ static inline s32 normalize_yscroll(const bitmap_t &bitmap, s32 yscroll)
 }
 
 
+#if DRAWGFX_SSE2_TRANSPEN
+/*-------------------------------------------------
+    transpen_clip - clip an unflipped-in-X gfx
+    element to the cliprect, returning the first
+    source pixel and row, row strides and
+    destination extent; false if nothing is
+    visible
+-------------------------------------------------*/
+
+static inline bool transpen_clip(gfx_element &gfx, const rectangle &cliprect, u32 code, int flipy,
+		s32 &destx, s32 &desty, s32 &destendx, s32 &destendy, const u8 *&srcdata, s32 &dy, s32 &srcrow, s32 &rowstep)
+{
+	// ignore empty/invalid cliprects
+	if (cliprect.empty())
+		return false;
+
+	// clip in X
+	destendx = destx + gfx.width() - 1;
+	if (destx > cliprect.max_x || destendx < cliprect.min_x)
+		return false;
+	s32 srcx = 0;
+	if (destx < cliprect.min_x)
+	{
+		srcx = cliprect.min_x - destx;
+		destx = cliprect.min_x;
+	}
+	if (destendx > cliprect.max_x)
+		destendx = cliprect.max_x;
+
+	// clip in Y
+	destendy = desty + gfx.height() - 1;
+	if (desty > cliprect.max_y || destendy < cliprect.min_y)
+		return false;
+	s32 srcy = 0;
+	if (desty < cliprect.min_y)
+	{
+		srcy = cliprect.min_y - desty;
+		desty = cliprect.min_y;
+	}
+	if (destendy > cliprect.max_y)
+		destendy = cliprect.max_y;
+
+	// apply Y flipping
+	dy = gfx.rowbytes();
+	rowstep = 1;
+	if (flipy)
+	{
+		srcy = gfx.height() - 1 - srcy;
+		dy = -dy;
+		rowstep = -1;
+	}
+
+	srcrow = srcy;
+	srcdata = gfx.get_data(code) + srcy * gfx.rowbytes() + srcx;
+	return true;
+}
+
+
+/*-------------------------------------------------
+    transpen_sse2 - unflipped-in-X transpen that
+    tests 16 source pixels at once, skipping
+    transparent runs and writing opaque ones as
+    whole vectors; rows whose pen usage shows
+    they are entirely transparent or entirely
+    opaque skip the test altogether
+-------------------------------------------------*/
+
+static void transpen_sse2(gfx_element &gfx, bitmap_ind16 &dest, const rectangle &cliprect,
+		u32 code, u32 color, int flipy, s32 destx, s32 desty, u32 trans_pen)
+{
+	s32 destendx, destendy, dy, srcrow, rowstep;
+	const u8 *srcdata;
+	if (!transpen_clip(gfx, cliprect, code, flipy, destx, desty, destendx, destendy, srcdata, dy, srcrow, rowstep))
+		return;
+
+	const int count = destendx + 1 - destx;
+	const __m128i trans = _mm_set1_epi8(u8(trans_pen));
+	const __m128i base = _mm_set1_epi16(u16(color));
+	const __m128i zero = _mm_setzero_si128();
+	const bool rowusage = gfx.has_pen_usage() && trans_pen < 32;
+	for (s32 cury = desty; cury <= destendy; cury++, srcdata += dy, srcrow += rowstep)
+	{
+		u16 *destptr = &dest.pix16(cury, destx);
+		const u8 *srcptr = srcdata;
+		int curx = 0;
+
+		if (rowusage)
+		{
+			u32 usage = gfx.row_pen_usage(code, srcrow);
+			if ((usage & ~(1 << trans_pen)) == 0)
+				continue;
+			if (!(usage & (1 << trans_pen)))
+			{
+				for ( ; curx < count; curx++)
+					destptr[curx] = color + srcptr[curx];
+				continue;
+			}
+		}
+
+		for ( ; curx + 16 <= count; curx += 16)
+		{
+			__m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&srcptr[curx]));
+			__m128i transmask = _mm_cmpeq_epi8(src, trans);
+			int transbits = _mm_movemask_epi8(transmask);
+			if (transbits == 0xffff)
+				continue;
+
+			__m128i *out = reinterpret_cast<__m128i *>(&destptr[curx]);
+			__m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(src, zero), base);
+			__m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(src, zero), base);
+			if (transbits != 0)
+			{
+				// keep the destination under transparent pixels
+				__m128i keeplo = _mm_unpacklo_epi8(transmask, transmask);
+				__m128i keephi = _mm_unpackhi_epi8(transmask, transmask);
+				lo = _mm_or_si128(_mm_andnot_si128(keeplo, lo), _mm_and_si128(keeplo, _mm_loadu_si128(out)));
+				hi = _mm_or_si128(_mm_andnot_si128(keephi, hi), _mm_and_si128(keephi, _mm_loadu_si128(out + 1)));
+			}
+			_mm_storeu_si128(out, lo);
+			_mm_storeu_si128(out + 1, hi);
+		}
+
+		for ( ; curx < count; curx++)
+			if (srcptr[curx] != trans_pen)
+				destptr[curx] = color + srcptr[curx];
+	}
+}
+
+static void transpen_sse2(gfx_element &gfx, bitmap_rgb32 &dest, const rectangle &cliprect,
+		u32 code, const pen_t *paldata, int flipy, s32 destx, s32 desty, u32 trans_pen)
+{
+	s32 destendx, destendy, dy, srcrow, rowstep;
+	const u8 *srcdata;
+	if (!transpen_clip(gfx, cliprect, code, flipy, destx, desty, destendx, destendy, srcdata, dy, srcrow, rowstep))
+		return;
+
+	const int count = destendx + 1 - destx;
+	const __m128i trans = _mm_set1_epi8(u8(trans_pen));
+	const bool rowusage = gfx.has_pen_usage() && trans_pen < 32;
+	for (s32 cury = desty; cury <= destendy; cury++, srcdata += dy, srcrow += rowstep)
+	{
+		u32 *destptr = &dest.pix32(cury, destx);
+		const u8 *srcptr = srcdata;
+		int curx = 0;
+
+		if (rowusage)
+		{
+			u32 usage = gfx.row_pen_usage(code, srcrow);
+			if ((usage & ~(1 << trans_pen)) == 0)
+				continue;
+			if (!(usage & (1 << trans_pen)))
+			{
+				for ( ; curx < count; curx++)
+					destptr[curx] = paldata[srcptr[curx]];
+				continue;
+			}
+		}
+
+		// the palette lookup stays scalar; only the transparency test is vectorized
+		for ( ; curx + 16 <= count; curx += 16)
+		{
+			__m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&srcptr[curx]));
+			int transbits = _mm_movemask_epi8(_mm_cmpeq_epi8(src, trans));
+			if (transbits == 0xffff)
+				continue;
+			if (transbits == 0)
+			{
+				for (int i = 0; i < 16; i++)
+					destptr[curx + i] = paldata[srcptr[curx + i]];
+			}
+			else
+			{
+				for (int i = 0; i < 16; i++)
+					if (!(transbits & (1 << i)))
+						destptr[curx + i] = paldata[srcptr[curx + i]];
+			}
+		}
+
+		for ( ; curx < count; curx++)
+			if (srcptr[curx] != trans_pen)
+				destptr[curx] = paldata[srcptr[curx]];
+	}
+}
+#endif
+
+
 
 //**************************************************************************
 //  DEVICE DEFINITIONS
@@ -104,6 +308,9 @@ gfx_element::gfx_element(palette_device &palette, u8 *base, u16 width, u16 heigh
 		m_srcdata(base),
 		m_dirtyseq(1),
 		m_gfxdata(base),
+		m_cache_hand(0),
+		m_cache_accesses(0),
+		m_cache_misses(0),
 		m_layout_is_raw(true),
 		m_layout_planes(0),
 		m_layout_xormask(0),
@@ -129,6 +336,9 @@ gfx_element::gfx_element(palette_device &palette, const gfx_layout &gl, const u8
 		m_srcdata(nullptr),
 		m_dirtyseq(1),
 		m_gfxdata(nullptr),
+		m_cache_hand(0),
+		m_cache_accesses(0),
+		m_cache_misses(0),
 		m_layout_is_raw(false),
 		m_layout_planes(0),
 		m_layout_xormask(xormask),
@@ -139,6 +349,18 @@ gfx_element::gfx_element(palette_device &palette, const gfx_layout &gl, const u8
 }
 
 
+//-------------------------------------------------
+//  ~gfx_element - destructor
+//-------------------------------------------------
+
+gfx_element::~gfx_element()
+{
+	if (has_decode_cache() && m_cache_accesses != 0)
+		osd_printf_verbose("gfx_element: %d elements in a %d entry decode cache, %.1f%% hit rate (%u misses)\n",
+				m_total_elements, int(m_cache_code.size()), 100.0 * double(decode_cache_hits()) / double(m_cache_accesses), unsigned(m_cache_misses));
+}
+
+
 //-------------------------------------------------
 //  set_layout - set the layout for a gfx_element
 //-------------------------------------------------
@@ -167,6 +389,9 @@ void gfx_element::set_layout(const gfx_layout &gl, const u8 *srcdata)
 		m_layout_xoffset.clear();
 		m_layout_yoffset.clear();
 		m_gfxdata_allocated.clear();
+		m_cache_slot.clear();
+		m_cache_code.clear();
+		m_cache_ref.clear();
 
 		// modulos are determined for us by the layout
 		m_line_modulo = gl.yoffs(0) / 8;
@@ -197,8 +422,7 @@ void gfx_element::set_layout(const gfx_layout &gl, const u8 *srcdata)
 		m_char_modulo = m_line_modulo * m_origheight;
 
 		// allocate memory for the data
-		m_gfxdata_allocated.resize(m_total_elements * m_char_modulo);
-		m_gfxdata = &m_gfxdata_allocated[0];
+		allocate_data();
 	}
 
 	// mark everything dirty
@@ -207,9 +431,15 @@ void gfx_element::set_layout(const gfx_layout &gl, const u8 *srcdata)
 
 	// allocate a pen usage array for entries with 32 pens or less
 	if (m_color_depth <= 32)
+	{
 		m_pen_usage.resize(m_total_elements);
+		m_row_pen_usage.resize(m_total_elements * m_origheight);
+	}
 	else
+	{
 		m_pen_usage.clear();
+		m_row_pen_usage.clear();
+	}
 }
 
 
@@ -259,7 +489,10 @@ void gfx_element::set_source_and_total(const u8 *source, u32 total)
 
 	// allocate a pen usage array for entries with 32 pens or less
 	if (m_color_depth <= 32)
+	{
 		m_pen_usage.resize(m_total_elements);
+		m_row_pen_usage.resize(m_total_elements * m_origheight);
+	}
 
 	if (m_layout_is_raw)
 	{
@@ -268,9 +501,39 @@ void gfx_element::set_source_and_total(const u8 *source, u32 total)
 	else
 	{
 		// allocate memory for the data
-		m_gfxdata_allocated.resize(m_total_elements * m_char_modulo);
-		m_gfxdata = &m_gfxdata_allocated[0];
+		allocate_data();
+	}
+}
+
+
+//-------------------------------------------------
+//  allocate_data - allocate space for decoded
+//  data; sets too large to decode in full get a
+//  bounded cache of elements instead
+//-------------------------------------------------
+
+void gfx_element::allocate_data()
+{
+	u64 fullsize = u64(m_total_elements) * m_char_modulo;
+	u64 budget = u64(std::max(m_palette->machine().options().gfx_decode_budget(), 0)) << 20;
+	if (fullsize <= budget || m_char_modulo == 0)
+	{
+		m_cache_slot.clear();
+		m_cache_code.clear();
+		m_cache_ref.clear();
+		m_gfxdata_allocated.resize(fullsize);
+	}
+	else
+	{
+		// every element starts out non-resident and the slots start out empty
+		u32 slots = std::min<u64>(std::max<u64>(budget / GFX_DECODE_CACHE_DIVISOR / m_char_modulo, GFX_DECODE_CACHE_MIN_SLOTS), m_total_elements);
+		m_cache_slot.assign(m_total_elements, ~0);
+		m_cache_code.assign(slots, ~0);
+		m_cache_ref.assign(slots, 0);
+		m_cache_hand = 0;
+		m_gfxdata_allocated.resize(u64(slots) * m_char_modulo);
 	}
+	m_gfxdata = &m_gfxdata_allocated[0];
 }
 
 
@@ -298,11 +561,22 @@ void gfx_element::set_source_clip(u32 xoffs, u32 width, u32 yoffs, u32 height)
 
 void gfx_element::decode(u32 code)
 {
+	// find a home for the element if it isn't resident in the cache
+	u8 *base = m_gfxdata + code * m_char_modulo;
+	if (has_decode_cache())
+	{
+		m_cache_misses++;
+		if (m_cache_slot[code] == ~0U)
+			m_cache_slot[code] = cache_allocate(code);
+		m_cache_ref[m_cache_slot[code]] = 1;
+		base = m_gfxdata + m_cache_slot[code] * m_char_modulo;
+	}
+
 	// don't decode GFX_RAW
 	if (!m_layout_is_raw)
 	{
 		// zap the data to 0
-		u8 *decode_base = m_gfxdata + code * m_char_modulo;
+		u8 *decode_base = base;
 		memset(decode_base, 0, m_char_modulo);
 
 		// iterate over planes
@@ -330,13 +604,17 @@ void gfx_element::decode(u32 code)
 	// (re)compute pen usage
 	if (code < m_pen_usage.size())
 	{
-		// iterate over data, creating a bitmask of live pens
-		const u8 *dp = m_gfxdata + code * m_char_modulo;
+		// iterate over data, creating a bitmask of live pens for each row and the whole element
+		const u8 *dp = base;
+		u32 *rowusage = &m_row_pen_usage[code * m_origheight];
 		u32 usage = 0;
 		for (int y = 0; y < m_origheight; y++)
 		{
+			u32 rowbits = 0;
 			for (int x = 0; x < m_origwidth; x++)
-				usage |= 1 << dp[x];
+				rowbits |= 1 << dp[x];
+			rowusage[y] = rowbits;
+			usage |= rowbits;
 			dp += m_line_modulo;
 		}
 
@@ -349,6 +627,38 @@ void gfx_element::decode(u32 code)
 }
 
 
+//-------------------------------------------------
+//  cache_allocate - pick a decode cache slot for
+//  an element, evicting the least recently used
+//  one by the clock approximation; a slot that was
+//  just handed out survives at least one full
+//  sweep, so a pointer from get_data stays valid
+//  across a handful of further lookups
+//-------------------------------------------------
+
+u32 gfx_element::cache_allocate(u32 code)
+{
+	const u32 slots = m_cache_code.size();
+	while (m_cache_ref[m_cache_hand])
+	{
+		m_cache_ref[m_cache_hand] = 0;
+		m_cache_hand = (m_cache_hand + 1) % slots;
+	}
+	u32 slot = m_cache_hand;
+	m_cache_hand = (m_cache_hand + 1) % slots;
+
+	// the evicted element will be decoded again on its next use
+	u32 victim = m_cache_code[slot];
+	if (victim != ~0U)
+	{
+		m_cache_slot[victim] = ~0;
+		m_dirty[victim] = 1;
+	}
+	m_cache_code[slot] = code;
+	return slot;
+}
+
+
 
 /***************************************************************************
     DRAWGFX IMPLEMENTATIONS
@@ -407,6 +717,16 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
+#if DRAWGFX_SSE2_TRANSPEN
+	if (!flipx)
+	{
+		assert(dest.cliprect().contains(cliprect));
+		g_profiler.start(PROFILER_DRAWGFX);
+		transpen_sse2(*this, dest, cliprect, code, color, flipy, destx, desty, trans_pen);
+		g_profiler.stop();
+		return;
+	}
+#endif
 	DECLARE_NO_PRIORITY;
 	DRAWGFX_CORE(u16, PIXEL_OP_REBASE_TRANSPEN, NO_PRIORITY);
 }
@@ -435,6 +755,16 @@ void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
+#if DRAWGFX_SSE2_TRANSPEN
+	if (!flipx)
+	{
+		assert(dest.cliprect().contains(cliprect));
+		g_profiler.start(PROFILER_DRAWGFX);
+		transpen_sse2(*this, dest, cliprect, code, paldata, flipy, destx, desty, trans_pen);
+		g_profiler.stop();
+		return;
+	}
+#endif
 	DECLARE_NO_PRIORITY;
 	DRAWGFX_CORE(u32, PIXEL_OP_REMAP_TRANSPEN, NO_PRIORITY);
 }
@@ -1718,6 +2048,179 @@ void gfx_element::alphatable(bitmap_rgb32 &dest, const rectangle &cliprect,
 }
 
 
+/***************************************************************************
+    SPRITE BATCHES
+***************************************************************************/
+
+// sprites are split into bands of at least this many rows
+const int SPRITE_BATCH_MIN_BAND_ROWS = 32;
+
+// upper limit on the number of bands in a single draw
+const int SPRITE_BATCH_MAX_BANDS = 8;
+
+// below this many sprites a batch is drawn on the calling thread
+const int SPRITE_BATCH_MIN_PARALLEL = 16;
+
+
+/*-------------------------------------------------
+    sprite_batch - constructor
+-------------------------------------------------*/
+
+sprite_batch::sprite_batch()
+	: m_work_queue(nullptr),
+		m_serial(false)
+{
+}
+
+
+/*-------------------------------------------------
+    ~sprite_batch - destructor
+-------------------------------------------------*/
+
+sprite_batch::~sprite_batch()
+{
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
+}
+
+
+/*-------------------------------------------------
+    add - queue a sprite to be drawn with
+    transpen
+-------------------------------------------------*/
+
+void sprite_batch::add(gfx_element &gfx, u32 code, u32 color, int flipx, int flipy, s32 destx, s32 desty, u32 transpen)
+{
+	// decode now, so that the workers never have to; elements with a decode
+	// cache may be evicted and redecoded while drawing, so those stay serial
+	code %= gfx.elements();
+	gfx.get_data(code);
+	m_serial |= gfx.has_decode_cache();
+
+	m_sprites.push_back(sprite{ &gfx, code, color, destx, desty, 0, transpen, u8(flipx ? 1 : 0), u8(flipy ? 1 : 0), false });
+}
+
+
+/*-------------------------------------------------
+    add_prio - queue a sprite to be drawn with
+    prio_transpen
+-------------------------------------------------*/
+
+void sprite_batch::add_prio(gfx_element &gfx, u32 code, u32 color, int flipx, int flipy, s32 destx, s32 desty, u32 pmask, u32 transpen)
+{
+	// decode now, so that the workers never have to; elements with a decode
+	// cache may be evicted and redecoded while drawing, so those stay serial
+	code %= gfx.elements();
+	gfx.get_data(code);
+	m_serial |= gfx.has_decode_cache();
+
+	m_sprites.push_back(sprite{ &gfx, code, color, destx, desty, pmask, transpen, u8(flipx ? 1 : 0), u8(flipy ? 1 : 0), true });
+}
+
+
+/*-------------------------------------------------
+    draw - draw the whole batch to a bitmap,
+    with or without a priority bitmap
+-------------------------------------------------*/
+
+void sprite_batch::draw(bitmap_ind16 &dest, const rectangle &cliprect)
+{ draw_common(dest, cliprect, nullptr); }
+
+void sprite_batch::draw(bitmap_rgb32 &dest, const rectangle &cliprect)
+{ draw_common(dest, cliprect, nullptr); }
+
+void sprite_batch::draw(bitmap_ind16 &dest, const rectangle &cliprect, bitmap_ind8 &priority)
+{ draw_common(dest, cliprect, &priority); }
+
+void sprite_batch::draw(bitmap_rgb32 &dest, const rectangle &cliprect, bitmap_ind8 &priority)
+{ draw_common(dest, cliprect, &priority); }
+
+
+/*-------------------------------------------------
+    draw_common - draw the whole batch, split
+    into bands when there is enough work
+-------------------------------------------------*/
+
+template<class _BitmapClass>
+void sprite_batch::draw_common(_BitmapClass &dest, const rectangle &cliprect, bitmap_ind8 *priority)
+{
+	int bands = 1;
+#ifndef MAME_PROFILER
+	// the profiler is not thread-safe, so profiling builds always draw serially
+	if (m_sprites.size() >= SPRITE_BATCH_MIN_PARALLEL && !m_serial && !cliprect.empty())
+		bands = std::min(cliprect.height() / SPRITE_BATCH_MIN_BAND_ROWS, SPRITE_BATCH_MAX_BANDS);
+#endif
+
+	if (bands <= 1)
+	{
+		draw_band(dest, cliprect, priority);
+		return;
+	}
+
+	// apply any pending palette writes here rather than racing to do it in the workers
+	for (const sprite &spr : m_sprites)
+		spr.gfx->palette().flush_writes();
+
+	// each band clips to its own rows, so they can run concurrently
+	band<_BitmapClass> work[SPRITE_BATCH_MAX_BANDS];
+	int rows = cliprect.height();
+	for (int bandnum = 0; bandnum < bands; bandnum++)
+	{
+		work[bandnum].batch = this;
+		work[bandnum].dest = &dest;
+		work[bandnum].priority = priority;
+		work[bandnum].cliprect = cliprect;
+		work[bandnum].cliprect.min_y = cliprect.min_y + rows * bandnum / bands;
+		work[bandnum].cliprect.max_y = cliprect.min_y + rows * (bandnum + 1) / bands - 1;
+	}
+
+	if (m_work_queue == nullptr)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	osd_work_item_queue_multiple(m_work_queue, draw_band_callback<_BitmapClass>, bands, work, sizeof(work[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+}
+
+
+/*-------------------------------------------------
+    draw_band - draw every sprite that touches
+    the cliprect, in painter's order
+-------------------------------------------------*/
+
+template<class _BitmapClass>
+void sprite_batch::draw_band(_BitmapClass &dest, const rectangle &cliprect, bitmap_ind8 *priority) const
+{
+	for (const sprite &spr : m_sprites)
+	{
+		// skip sprites entirely above or below this band
+		if (spr.desty > cliprect.max_y || spr.desty + spr.gfx->height() - 1 < cliprect.min_y)
+			continue;
+
+		if (spr.prio)
+		{
+			assert(priority != nullptr);
+			spr.gfx->prio_transpen(dest, cliprect, spr.code, spr.color, spr.flipx, spr.flipy, spr.destx, spr.desty, *priority, spr.pmask, spr.transpen);
+		}
+		else
+			spr.gfx->transpen(dest, cliprect, spr.code, spr.color, spr.flipx, spr.flipy, spr.destx, spr.desty, spr.transpen);
+	}
+}
+
+
+/*-------------------------------------------------
+    draw_band_callback - work queue entry point
+    for drawing one band
+-------------------------------------------------*/
+
+template<class _BitmapClass>
+void *sprite_batch::draw_band_callback(void *param, int threadid)
+{
+	band<_BitmapClass> &work = *reinterpret_cast<band<_BitmapClass> *>(param);
+	profiler_trace_scope scope("sprite band", "video");
+	work.batch->draw_band(*work.dest, work.cliprect, work.priority);
+	return nullptr;
+}
+
+
 /***************************************************************************
     DRAW_SCANLINE IMPLEMENTATIONS
 ***************************************************************************/
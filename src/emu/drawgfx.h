@@ -153,6 +153,7 @@ public:
 #endif
 	gfx_element(palette_device &palette, const gfx_layout &gl, const u8 *srcdata, u32 xormask, u32 total_colors, u32 color_base);
 	gfx_element(palette_device &palette, u8 *base, u16 width, u16 height, u32 rowbytes, u32 total_colors, u32 color_base, u32 color_granularity);
+	~gfx_element();
 
 	// getters
 	palette_device &palette() const { return *m_palette; }
@@ -165,6 +166,12 @@ public:
 	u32 colors() const { return m_total_colors; }
 	u32 rowbytes() const { return m_line_modulo; }
 	bool has_pen_usage() const { return !m_pen_usage.empty(); }
+	u64 decoded_bytes() const { return m_gfxdata_allocated.size(); }
+
+	// decoded data cache, used instead of decoding everything for very large sets
+	bool has_decode_cache() const { return !m_cache_slot.empty(); }
+	u64 decode_cache_hits() const { return (m_cache_accesses > m_cache_misses) ? m_cache_accesses - m_cache_misses : 0; }
+	u64 decode_cache_misses() const { return m_cache_misses; }
 
 	// used by tilemaps
 	u32 dirtyseq() const { return m_dirtyseq; }
@@ -189,7 +196,7 @@ public:
 	{
 		assert(code < elements());
 		if (code < m_dirty.size() && m_dirty[code]) decode(code);
-		return m_gfxdata + code * m_char_modulo + m_starty * m_line_modulo + m_startx;
+		return element_base(code) + m_starty * m_line_modulo + m_startx;
 	}
 
 	u32 pen_usage(u32 code)
@@ -199,6 +206,16 @@ public:
 		return m_pen_usage[code];
 	}
 
+	// pen usage of a single row, relative to the current source clip; this covers
+	// the full unclipped width, so it is exact for "no pixels" and "all pixels" tests
+	u32 row_pen_usage(u32 code, u32 row)
+	{
+		assert(code < m_pen_usage.size());
+		assert(row < m_height);
+		if (m_dirty[code]) decode(code);
+		return m_row_pen_usage[code * m_origheight + m_starty + row];
+	}
+
 	// ----- core graphics drawing -----
 
 	// specific drawgfx implementations for each transparency type
@@ -266,7 +283,20 @@ public:
 	void alphatable(bitmap_rgb32 &dest, const rectangle &cliprect, u32 code, u32 color, int flipx, int flipy, s32 destx, s32 desty, int fixedalpha ,u8 *alphatable);
 private:
 	// internal helpers
+	void allocate_data();
 	void decode(u32 code);
+	u32 cache_allocate(u32 code);
+
+	// start of an element's decoded data, from the cache if there is one
+	u8 *element_base(u32 code)
+	{
+		if (m_cache_slot.empty())
+			return m_gfxdata + code * m_char_modulo;
+		u32 slot = m_cache_slot[code];
+		m_cache_ref[slot] = 1;
+		m_cache_accesses++;
+		return m_gfxdata + slot * m_char_modulo;
+	}
 
 	// internal state
 	palette_device  *m_palette;             // palette used for drawing
@@ -294,6 +324,14 @@ private:
 	std::vector<u8> m_gfxdata_allocated;    // allocated decoded pixel data, 8bpp
 	std::vector<u8> m_dirty;                // dirty array for detecting chars that need decoding
 	std::vector<u32>  m_pen_usage;      // bitmask of pens that are used (pens 0-31 only)
+	std::vector<u32>  m_row_pen_usage;  // the same, for each row of each element
+
+	std::vector<u32>  m_cache_slot;     // cache slot holding each element, or ~0 (decode cache only)
+	std::vector<u32>  m_cache_code;     // element held in each cache slot, or ~0
+	std::vector<u8>   m_cache_ref;      // per-slot referenced flag for clock replacement
+	u32             m_cache_hand;           // next slot considered for replacement
+	u64             m_cache_accesses;       // total element lookups through the cache
+	u64             m_cache_misses;         // lookups that needed a (re)decode
 
 	bool            m_layout_is_raw;        // raw layout?
 	u8              m_layout_planes;        // bit planes in the layout
@@ -305,6 +343,69 @@ private:
 };
 
 
+// ======================> sprite_batch
+
+// a frame's worth of transpen/prio_transpen sprite draws, queued in painter's
+// order and rendered afterwards as horizontal bands on worker threads; each
+// band draws every sprite touching it in submission order, so the output is
+// the same as drawing the sprites one by one
+class sprite_batch
+{
+public:
+	// construction/destruction
+	sprite_batch();
+	~sprite_batch();
+
+	// building the batch
+	void reset() { m_sprites.clear(); m_serial = false; }
+	void add(gfx_element &gfx, u32 code, u32 color, int flipx, int flipy, s32 destx, s32 desty, u32 transpen);
+	void add_prio(gfx_element &gfx, u32 code, u32 color, int flipx, int flipy, s32 destx, s32 desty, u32 pmask, u32 transpen);
+	int count() const { return m_sprites.size(); }
+
+	// drawing; the priority bitmap is required if any sprites were added with add_prio
+	void draw(bitmap_ind16 &dest, const rectangle &cliprect);
+	void draw(bitmap_rgb32 &dest, const rectangle &cliprect);
+	void draw(bitmap_ind16 &dest, const rectangle &cliprect, bitmap_ind8 &priority);
+	void draw(bitmap_rgb32 &dest, const rectangle &cliprect, bitmap_ind8 &priority);
+
+private:
+	// a single queued sprite
+	struct sprite
+	{
+		gfx_element *   gfx;
+		u32             code;
+		u32             color;
+		s32             destx;
+		s32             desty;
+		u32             pmask;
+		u32             transpen;
+		u8              flipx;
+		u8              flipy;
+		bool            prio;
+	};
+
+	// one band of a draw
+	template<class _BitmapClass>
+	struct band
+	{
+		const sprite_batch *batch;
+		_BitmapClass *      dest;
+		bitmap_ind8 *       priority;
+		rectangle           cliprect;
+	};
+
+	// internal helpers
+	template<class _BitmapClass> void draw_common(_BitmapClass &dest, const rectangle &cliprect, bitmap_ind8 *priority);
+	template<class _BitmapClass> void draw_band(_BitmapClass &dest, const rectangle &cliprect, bitmap_ind8 *priority) const;
+	template<class _BitmapClass> static void *draw_band_callback(void *param, int threadid);
+
+	// internal state
+	std::vector<sprite> m_sprites;              // sprites in painter's order
+	osd_work_queue *    m_work_queue;           // queue for banded drawing, or nullptr
+	bool                m_serial;               // a gfx element in the batch can't be shared between threads
+};
+
+
 /***************************************************************************
     FUNCTION PROTOTYPES
 ***************************************************************************/
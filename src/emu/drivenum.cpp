@@ -105,6 +105,43 @@ int driver_list::penalty_compare(const char *source, const char *target)
 }
 
 
+//-------------------------------------------------
+//  penalty_bound - lowest score penalty_compare
+//  could give source against any target whose
+//  character set is targetset
+//-------------------------------------------------
+
+int driver_list::penalty_bound(const char *source, u64 targetset)
+{
+	// the source can't get past the first character the target lacks, and
+	// every character left over costs a gap
+	const char *const start = source;
+	for ( ; *source; source++)
+		if (!(core_charbit(*source) & targetset))
+			return 1 + strlen(start) - (source - start);
+	return 0;
+}
+
+
+//-------------------------------------------------
+//  charsets - build the table of driver name and
+//  description character sets the first time
+//  it's needed
+//-------------------------------------------------
+
+const std::vector<std::pair<u64, u64>> &driver_list::charsets()
+{
+	static const std::vector<std::pair<u64, u64>> s_charsets = []
+	{
+		std::vector<std::pair<u64, u64>> result(s_driver_count);
+		for (std::size_t index = 0; index < s_driver_count; index++)
+			result[index] = std::make_pair(core_strcharset(s_drivers_sorted[index]->name), core_strcharset(s_drivers_sorted[index]->description));
+		return result;
+	}();
+	return s_charsets;
+}
+
+
 
 //**************************************************************************
 //  DRIVER ENUMERATOR
@@ -310,6 +347,11 @@ void driver_enumerator::find_approximate_matches(const char *string, std::size_t
 			// skip things that can't run
 			if (m_included[index] &&  !(s_drivers_sorted[index]->flags & MACHINE_NO_STANDALONE))
 			{
+				// don't bother scoring entries that can't beat the worst one we're keeping
+				int const bound = (std::min)(penalty_bound(string, description_charset(index)), penalty_bound(string, name_charset(index)));
+				if ((count == 0) || (bound >= penalty[count - 1]))
+					continue;
+
 				// pick the best match between driver name and description
 				int curpenalty = penalty_compare(string, s_drivers_sorted[index]->description);
 				int tmp = penalty_compare(string, s_drivers_sorted[index]->name);
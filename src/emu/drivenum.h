@@ -62,10 +62,18 @@ public:
 	// static helpers
 	static bool matches(const char *wildstring, const char *string);
 	static int penalty_compare(const char *source, const char *target);
+	static int penalty_bound(const char *source, u64 targetset);
+
+	// case-insensitive character sets (see core_strcharset) of each driver's name and description
+	static u64 name_charset(std::size_t index) { assert(index < total()); return charsets()[index].first; }
+	static u64 description_charset(std::size_t index) { assert(index < total()); return charsets()[index].second; }
 
 protected:
 	static std::size_t const            s_driver_count;
 	static game_driver const * const    s_drivers_sorted[];
+
+private:
+	static const std::vector<std::pair<u64, u64>> &charsets();
 };
 
 
@@ -95,6 +95,7 @@ typedef device_t * (*machine_config_constructor)(machine_config &config, device_
 // the running machine
 #include "main.h"
 #include "machine.h"
+#include "memreport.h"
 #include "driver.h"
 
 // video-related
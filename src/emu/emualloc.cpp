@@ -38,9 +38,11 @@ osd::u64 resource_pool::s_id = 0;
 
 resource_pool::resource_pool(int hash_size)
 	: m_hash_size(hash_size),
+		m_count(0),
 		m_hash(hash_size),
 		m_ordered_head(nullptr),
-		m_ordered_tail(nullptr)
+		m_ordered_tail(nullptr),
+		m_owner(&m_usage[""])
 {
 	memset(&m_hash[0], 0, hash_size*sizeof(m_hash[0]));
 }
@@ -66,6 +68,16 @@ void resource_pool::add(resource_pool_item &item, size_t size, const char *type)
 {
 	std::lock_guard<std::mutex> lock(m_listlock);
 
+	// keep the chains short as the pool grows
+	if (++m_count > m_hash_size * 2)
+		rehash(m_hash_size * 2 + 1);
+
+	// charge it to the current owner
+	item.m_usage = m_owner;
+	m_owner->m_current += item.m_size;
+	m_owner->m_peak = std::max(m_owner->m_peak, m_owner->m_current);
+	m_owner->m_items++;
+
 	// insert into hash table
 	int hashval = reinterpret_cast<uintptr_t>(item.m_ptr) % m_hash_size;
 	item.m_next = m_hash[hashval];
@@ -141,6 +153,11 @@ void resource_pool::remove(void *ptr)
 			else
 				m_ordered_tail = deleteme->m_ordered_prev;
 
+			// release it from its owner's accounting
+			m_count--;
+			deleteme->m_usage->m_current -= deleteme->m_size;
+			deleteme->m_usage->m_items--;
+
 			// delete the object and break
 			if (LOG_ALLOCS)
 				fprintf(stderr, "#%06d, delete %d bytes\n", u32(deleteme->m_id), u32(deleteme->m_size));
@@ -206,3 +223,35 @@ void resource_pool::clear()
 	while (m_ordered_head != nullptr)
 		remove(m_ordered_head->m_ptr);
 }
+
+
+//-------------------------------------------------
+//  set_owner - charge items added from now on to
+//  the given owner, or to the pool itself if
+//  nullptr
+//-------------------------------------------------
+
+void resource_pool::set_owner(const char *owner)
+{
+	std::lock_guard<std::mutex> lock(m_listlock);
+	m_owner = &m_usage[(owner != nullptr) ? owner : ""];
+}
+
+
+//-------------------------------------------------
+//  rehash - redistribute the items over a hash
+//  table of the given size
+//-------------------------------------------------
+
+void resource_pool::rehash(int hash_size)
+{
+	std::vector<resource_pool_item *> hash(hash_size, nullptr);
+	for (resource_pool_item *item = m_ordered_head; item != nullptr; item = item->m_ordered_next)
+	{
+		int hashval = reinterpret_cast<uintptr_t>(item->m_ptr) % hash_size;
+		item->m_next = hash[hashval];
+		hash[hashval] = item;
+	}
+	m_hash.swap(hash);
+	m_hash_size = hash_size;
+}
@@ -13,8 +13,10 @@
 #ifndef MAME_EMU_EMUALLOC_H
 #define MAME_EMU_EMUALLOC_H
 
+#include <map>
 #include <new>
 #include <mutex>
+#include <string>
 #include "osdcore.h"
 #include "coretmpl.h"
 
@@ -35,6 +37,15 @@
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+// resource_pool_usage accounts for the memory held by one owner of a resource pool
+struct resource_pool_usage
+{
+	size_t                  m_current = 0;      // bytes currently allocated
+	size_t                  m_peak = 0;         // most bytes allocated at once
+	osd::u32                m_items = 0;        // number of items currently allocated
+};
+
+
 // resource_pool_item is a base class for items that are tracked by a resource pool
 class resource_pool_item
 {
@@ -49,7 +60,8 @@ public:
 			m_ordered_prev(nullptr),
 			m_ptr(ptr),
 			m_size(size),
-			m_id(~osd::u64(0)) { }
+			m_id(~osd::u64(0)),
+			m_usage(nullptr) { }
 	virtual ~resource_pool_item() { }
 
 	resource_pool_item *    m_next;
@@ -58,6 +70,7 @@ public:
 	void *                  m_ptr;
 	size_t                  m_size;
 	osd::u64                m_id;
+	resource_pool_usage *   m_usage;
 };
 
 
@@ -120,15 +133,24 @@ public:
 	bool contains(void *ptrstart, void *ptrend);
 	void clear();
 
+	// memory accounting; items added are charged to the current owner
+	void set_owner(const char *owner);
+	const std::map<std::string, resource_pool_usage> &usage() const { return m_usage; }
+
 	template<class _ObjectClass> _ObjectClass *add_object(_ObjectClass* object) { add(*new resource_pool_object<_ObjectClass>(object), sizeof(_ObjectClass), typeid(_ObjectClass).name()); return object; }
 	template<class _ObjectClass> _ObjectClass *add_array(_ObjectClass* array, int count) { add(*new resource_pool_array<_ObjectClass>(array, count), sizeof(_ObjectClass), typeid(_ObjectClass).name()); return array; }
 
 private:
+	void rehash(int hash_size);
+
 	int                     m_hash_size;
+	int                     m_count;
 	std::mutex              m_listlock;
 	std::vector<resource_pool_item *> m_hash;
 	resource_pool_item *    m_ordered_head;
 	resource_pool_item *    m_ordered_tail;
+	std::map<std::string, resource_pool_usage> m_usage;
+	resource_pool_usage *   m_owner;
 	static osd::u64         s_id;
 };
 
@@ -37,6 +37,18 @@
         STATIC_COUNT .. SUBTABLE_BASE - 1 = driver-specific handlers
         SUBTABLE_BASE .. TOTAL_MEMORY_BANKS - 1 = need to look up lower bits in subtable
 
+    Spaces of FLAT_MAX_BYTES or fewer bytes additionally keep a flat table
+    of handler pointers, indexed directly by byte address, so that the read
+    and write paths skip the handler index lookup entirely.
+
+    Memory taps don't touch the main table.  While any are installed, the
+    live lookup is a copy of the table in which every entry covering a
+    tapped address holds STATIC_TAP; that handler calls the taps and then
+    looks up the real entry.  Subtables may be shared between pages, so a
+    tapped page with a subtable gets a private copy of it in an unused
+    subtable slot.  Untapped pages cost nothing extra, and with no taps the
+    copy is discarded.
+
     Caveats:
 
     * If your driver executes an opcode which crosses a bank-switched
@@ -176,6 +188,7 @@
 
 ***************************************************************************/
 
+#include <algorithm>
 #include <list>
 #include <map>
 
@@ -244,6 +257,9 @@ enum
 	STATIC_NOP,                                         // NOP - reads = unmapped value; writes = no-op
 	STATIC_UNMAP,                                       // unmapped - same as NOP except we log errors
 	STATIC_WATCHPOINT,                                  // watchpoint - used internally
+	STATIC_TAP,                                         // memory tap - used internally
+	STATIC_STATS,                                       // statistics counter - used internally
+	STATIC_DEFERRED,                                    // not yet populated - used internally
 	STATIC_COUNT                                        // total number of static handlers
 };
 
@@ -284,6 +300,10 @@ public:
 	// return a pointer to the backing RAM at the given offset
 	u8 *ramptr(offs_t offset = 0) const { return *m_rambaseptr + offset; }
 
+	// is this one of the bank handlers, which access backing RAM directly?
+	bool is_bank() const { return m_rambaseptr != nullptr; }
+	u8 **rambaseptr() const { return m_rambaseptr; }
+
 	// see if we are an exact match to the given parameters
 	bool matches_exactly(offs_t bytestart, offs_t byteend, offs_t bytemask) const
 	{
@@ -555,6 +575,7 @@ class address_table
 	static const int SUBTABLE_BASE  = TOTAL_MEMORY_BANKS - SUBTABLE_COUNT;     // first index of a subtable
 	static const int ENTRY_COUNT    = SUBTABLE_BASE;            // number of legitimate (non-subtable) entries
 	static const int SUBTABLE_ALLOC = 8;                        // number of subtables to allocate at a time
+	static const offs_t FLAT_MAX_BYTES = 0x10000;               // largest space that gets a flat handler table
 
 	inline int level2_bits() const { return m_large ? LEVEL2_BITS : 0; }
 
@@ -565,7 +586,8 @@ public:
 
 	// getters
 	virtual handler_entry &handler(u32 index) const = 0;
-	bool watchpoints_enabled() const { return (m_live_lookup == s_watchpoint_table); }
+	bool watchpoints_enabled() const { return m_watchpoints; }
+	bool ram_windows_allowed() const { return !m_watchpoints && !m_stats_enabled && m_taps.empty(); }
 
 	// address lookups
 	u32 lookup_live(offs_t byteaddress) const { return m_large ? lookup_live_large(byteaddress) : lookup_live_small(byteaddress); }
@@ -598,8 +620,23 @@ public:
 		return entry;
 	}
 
+	// flat handler table for small spaces, indexed by byte address; nullptr if
+	// not available or while watchpoints or taps are enabled
+	handler_entry *const *flat_live() const { return m_live_flat; }
+
 	// enable watchpoints by swapping in the watchpoint table
-	void enable_watchpoints(bool enable = true) { m_live_lookup = enable ? s_watchpoint_table : &m_table[0]; }
+	void enable_watchpoints(bool enable = true) { m_watchpoints = enable; update_live_lookup(); }
+
+	// enable access counting by swapping in the statistics table
+	void enable_stats(bool enable = true) { m_stats_enabled = enable; update_live_lookup(); }
+
+	// route every access through the deferred table until the space is populated
+	void set_deferred(bool deferred) { m_deferred = deferred; update_live_lookup(); }
+	void dump_stats(FILE *file) const;
+
+	// memory taps
+	int tap_add(offs_t bytestart, offs_t byteend, memory_tap_delegate callback);
+	void tap_remove(int id);
 
 	// table mapping helpers
 	void map_range(offs_t bytestart, offs_t byteend, offs_t bytemask, offs_t bytemirror, u16 staticentry);
@@ -610,6 +647,9 @@ public:
 	void mask_all_handlers(offs_t mask);
 	const char *handler_name(u16 entry) const;
 
+	// find the linearly-mapped RAM window containing an address, if any
+	bool find_ram_window(offs_t byteaddress, address_space::ram_window &window);
+
 protected:
 	// determine table indexes based on the address
 	u32 level1_index_large(offs_t address) const { return address >> LEVEL2_BITS; }
@@ -630,11 +670,49 @@ protected:
 	void subtable_close(offs_t l1index);
 	u16 *subtable_ptr(u16 entry) { return &m_table[level2_index(entry, 0)]; }
 
+	// flat table management
+	void flat_init();
+	void flat_update(offs_t byteaddress, u16 entry) { if (byteaddress < m_flat.size()) m_flat[byteaddress] = &handler(entry); }
+
+	// live lookup selection
+	u16 *base_lookup() { return m_taps.empty() ? &m_table[0] : &m_tap_table[0]; }
+	void update_live_lookup();
+
+	// memory tap management
+	void tap_table_update();
+	void tap_notify(offs_t byteaddress, int bytes, u64 data, u64 mask);
+
+	// memory statistics management
+	void stats_count(offs_t byteaddress);
+	u16 *stats_next_lookup() { return m_watchpoints ? s_watchpoint_table : base_lookup(); }
+
 	// internal state
 	std::vector<u16>   m_table;                    // pointer to base of table
 	u16 *                m_live_lookup;              // current lookup
+	std::vector<handler_entry *> m_flat;            // handler for each byte address in small spaces
+	handler_entry *const *  m_live_flat;                // current flat lookup
 	address_space &         m_space;                    // pointer back to the space
 	bool                    m_large;                    // large memory model?
+	bool                    m_watchpoints;              // are watchpoints enabled?
+	bool                    m_deferred;                 // is population of the space deferred?
+
+	// memory_tap is an observer over a range of byte addresses
+	struct memory_tap
+	{
+		int                 m_id;                       // identifier returned to the installer
+		offs_t              m_bytestart;                // first byte address observed
+		offs_t              m_byteend;                  // last byte address observed
+		memory_tap_delegate m_callback;                 // observer to call
+	};
+	std::vector<memory_tap> m_taps;                     // list of installed taps
+	std::vector<u16>        m_tap_table;                // copy of m_table with tapped entries diverted
+	int                     m_next_tap_id;              // identifier for the next tap
+
+	// access counts live in one block per thread slot, so counting needs no locking
+	static const int STATS_SLOTS = 32;                  // number of per-thread counter blocks
+	bool                    m_stats_enabled;            // are we counting accesses?
+	std::unique_ptr<u64[]>  m_stats[STATS_SLOTS];       // per-thread access counts for each entry
+	std::mutex              m_stats_lock;               // guards allocation of the counter blocks
 
 	// subtable_data is an internal class with information about each subtable
 	class subtable_data
@@ -652,8 +730,19 @@ protected:
 	std::vector<subtable_data>   m_subtable;            // info about each subtable
 	u16                     m_subtable_alloc;           // number of subtables allocated
 
-	// static global read-only watchpoint table
+	// most recently derived contiguous range for each bank handler
+	struct bank_range
+	{
+		offs_t              m_bytestart;
+		offs_t              m_byteend;
+	};
+	bank_range              m_bank_range[STATIC_BANKMAX + 1];
+	void invalidate_ram_windows();
+
+	// static global read-only watchpoint, statistics and deferred tables
 	static u16              s_watchpoint_table[1 << LEVEL1_BITS];
+	static u16              s_stats_table[1 << LEVEL1_BITS];
+	static u16              s_deferred_table[1 << LEVEL1_BITS];
 
 private:
 	int handler_refcount[SUBTABLE_BASE-STATIC_COUNT];
@@ -740,14 +829,60 @@ private:
 	{
 		m_space.device().debug()->memory_read_hook(m_space, offset * sizeof(_UintType), mask);
 
-		u16 *oldtable = m_live_lookup;
+		m_live_lookup = base_lookup();
+		_UintType result;
+		if (sizeof(_UintType) == 1) result = m_space.read_byte(offset);
+		if (sizeof(_UintType) == 2) result = m_space.read_word(offset << 1, mask);
+		if (sizeof(_UintType) == 4) result = m_space.read_dword(offset << 2, mask);
+		if (sizeof(_UintType) == 8) result = m_space.read_qword(offset << 3, mask);
+		update_live_lookup();
+		return result;
+	}
+
+	// internal deferred population handler
+	template<typename _UintType>
+	_UintType deferred_r(address_space &space, offs_t offset, _UintType mask)
+	{
+		m_space.populate_if_deferred();
+
+		_UintType result;
+		if (sizeof(_UintType) == 1) result = m_space.read_byte(offset);
+		if (sizeof(_UintType) == 2) result = m_space.read_word(offset << 1, mask);
+		if (sizeof(_UintType) == 4) result = m_space.read_dword(offset << 2, mask);
+		if (sizeof(_UintType) == 8) result = m_space.read_qword(offset << 3, mask);
+		return result;
+	}
+
+	// internal statistics handler
+	template<typename _UintType>
+	_UintType stats_r(address_space &space, offs_t offset, _UintType mask)
+	{
+		stats_count(offset * sizeof(_UintType));
+
+		m_live_lookup = stats_next_lookup();
+		_UintType result;
+		if (sizeof(_UintType) == 1) result = m_space.read_byte(offset);
+		if (sizeof(_UintType) == 2) result = m_space.read_word(offset << 1, mask);
+		if (sizeof(_UintType) == 4) result = m_space.read_dword(offset << 2, mask);
+		if (sizeof(_UintType) == 8) result = m_space.read_qword(offset << 3, mask);
+		update_live_lookup();
+		return result;
+	}
+
+	// internal memory tap handler; the page may be shared with untapped
+	// addresses, so the taps themselves check the range
+	template<typename _UintType>
+	_UintType tap_r(address_space &space, offs_t offset, _UintType mask)
+	{
 		m_live_lookup = &m_table[0];
 		_UintType result;
 		if (sizeof(_UintType) == 1) result = m_space.read_byte(offset);
 		if (sizeof(_UintType) == 2) result = m_space.read_word(offset << 1, mask);
 		if (sizeof(_UintType) == 4) result = m_space.read_dword(offset << 2, mask);
 		if (sizeof(_UintType) == 8) result = m_space.read_qword(offset << 3, mask);
-		m_live_lookup = oldtable;
+		update_live_lookup();
+
+		tap_notify(offset * sizeof(_UintType), sizeof(_UintType), result, mask);
 		return result;
 	}
 
@@ -808,13 +943,49 @@ private:
 	{
 		m_space.device().debug()->memory_write_hook(m_space, offset * sizeof(_UintType), data, mask);
 
-		u16 *oldtable = m_live_lookup;
+		m_live_lookup = base_lookup();
+		if (sizeof(_UintType) == 1) m_space.write_byte(offset, data);
+		if (sizeof(_UintType) == 2) m_space.write_word(offset << 1, data, mask);
+		if (sizeof(_UintType) == 4) m_space.write_dword(offset << 2, data, mask);
+		if (sizeof(_UintType) == 8) m_space.write_qword(offset << 3, data, mask);
+		update_live_lookup();
+	}
+
+	template<typename _UintType>
+	void deferred_w(address_space &space, offs_t offset, _UintType data, _UintType mask)
+	{
+		m_space.populate_if_deferred();
+
+		if (sizeof(_UintType) == 1) m_space.write_byte(offset, data);
+		if (sizeof(_UintType) == 2) m_space.write_word(offset << 1, data, mask);
+		if (sizeof(_UintType) == 4) m_space.write_dword(offset << 2, data, mask);
+		if (sizeof(_UintType) == 8) m_space.write_qword(offset << 3, data, mask);
+	}
+
+	template<typename _UintType>
+	void stats_w(address_space &space, offs_t offset, _UintType data, _UintType mask)
+	{
+		stats_count(offset * sizeof(_UintType));
+
+		m_live_lookup = stats_next_lookup();
+		if (sizeof(_UintType) == 1) m_space.write_byte(offset, data);
+		if (sizeof(_UintType) == 2) m_space.write_word(offset << 1, data, mask);
+		if (sizeof(_UintType) == 4) m_space.write_dword(offset << 2, data, mask);
+		if (sizeof(_UintType) == 8) m_space.write_qword(offset << 3, data, mask);
+		update_live_lookup();
+	}
+
+	template<typename _UintType>
+	void tap_w(address_space &space, offs_t offset, _UintType data, _UintType mask)
+	{
+		tap_notify(offset * sizeof(_UintType), sizeof(_UintType), data, mask);
+
 		m_live_lookup = &m_table[0];
 		if (sizeof(_UintType) == 1) m_space.write_byte(offset, data);
 		if (sizeof(_UintType) == 2) m_space.write_word(offset << 1, data, mask);
 		if (sizeof(_UintType) == 4) m_space.write_dword(offset << 2, data, mask);
 		if (sizeof(_UintType) == 8) m_space.write_qword(offset << 3, data, mask);
-		m_live_lookup = oldtable;
+		update_live_lookup();
 	}
 
 	// internal state
@@ -890,6 +1061,22 @@ class address_space_specific : public address_space
 	u32 write_lookup(offs_t byteaddress) const { return _Large ? m_write.lookup_live_large(byteaddress) : m_write.lookup_live_small(byteaddress); }
 	u32 setoffset_lookup(offs_t byteaddress) const { return _Large ? m_setoffset.lookup_live_large(byteaddress) : m_setoffset.lookup_live_small(byteaddress); }
 
+	// small spaces resolve the handler directly from the flat table when they can
+	const handler_entry_read &read_handler(offs_t byteaddress) const
+	{
+		handler_entry *const *flat = _Large ? nullptr : m_read.flat_live();
+		if (flat != nullptr)
+			return static_cast<const handler_entry_read &>(*flat[byteaddress]);
+		return m_read.handler_read(read_lookup(byteaddress));
+	}
+	const handler_entry_write &write_handler(offs_t byteaddress) const
+	{
+		handler_entry *const *flat = _Large ? nullptr : m_write.flat_live();
+		if (flat != nullptr)
+			return static_cast<const handler_entry_write &>(*flat[byteaddress]);
+		return m_write.handler_write(write_lookup(byteaddress));
+	}
+
 public:
 	// construction/destruction
 	address_space_specific(memory_manager &manager, device_memory_interface &memory, address_spacenum spacenum)
@@ -1036,13 +1223,13 @@ public:
 	}
 
 	// accessors
-	virtual address_table_read &read() override { return m_read; }
-	virtual address_table_write &write() override { return m_write; }
-	virtual address_table_setoffset &setoffset() override { return m_setoffset; }
+	virtual address_table_read &read() override { populate_if_deferred(); return m_read; }
+	virtual address_table_write &write() override { populate_if_deferred(); return m_write; }
+	virtual address_table_setoffset &setoffset() override { populate_if_deferred(); return m_setoffset; }
 
 	// watchpoint control
-	virtual void enable_read_watchpoints(bool enable = true) override { m_read.enable_watchpoints(enable); }
-	virtual void enable_write_watchpoints(bool enable = true) override { m_write.enable_watchpoints(enable); }
+	virtual void enable_read_watchpoints(bool enable = true) override { m_read.enable_watchpoints(enable); m_read_window.invalidate(); }
+	virtual void enable_write_watchpoints(bool enable = true) override { m_write.enable_watchpoints(enable); m_write_window.invalidate(); }
 
 	// generate accessor table
 	virtual void accessors(data_accessors &accessors) const override
@@ -1098,15 +1285,27 @@ public:
 
 		if (TEST_HANDLER) printf("[r%X,%s]", offset, core_i64_hex_format(mask, sizeof(_NativeType) * 2));
 
-		// look up the handler
+		// accesses within the last RAM window read directly
 		offs_t byteaddress = offset & m_bytemask;
-		u32 entry = read_lookup(byteaddress);
-		const handler_entry_read &handler = m_read.handler_read(entry);
+		if (m_read_window.contains(byteaddress))
+		{
+			_NativeType result = *reinterpret_cast<_NativeType *>(m_read_window.ptr(byteaddress));
+			g_profiler.stop();
+			return result;
+		}
+
+		// look up the handler
+		const handler_entry_read &handler = read_handler(byteaddress);
 
 		// either read directly from RAM, or call the delegate
 		offset = handler.byteoffset(byteaddress);
 		_NativeType result;
-		if (entry <= STATIC_BANKMAX) result = *reinterpret_cast<_NativeType *>(handler.ramptr(offset));
+		if (handler.is_bank())
+		{
+			result = *reinterpret_cast<_NativeType *>(handler.ramptr(offset));
+			if (m_read.ram_windows_allowed())
+				m_read.find_ram_window(byteaddress, m_read_window);
+		}
 		else if (sizeof(_NativeType) == 1) result = handler.read8(*this, offset, mask);
 		else if (sizeof(_NativeType) == 2) result = handler.read16(*this, offset >> 1, mask);
 		else if (sizeof(_NativeType) == 4) result = handler.read32(*this, offset >> 2, mask);
@@ -1123,15 +1322,27 @@ public:
 
 		if (TEST_HANDLER) printf("[r%X]", offset);
 
-		// look up the handler
+		// accesses within the last RAM window read directly
 		offs_t byteaddress = offset & m_bytemask;
-		u32 entry = read_lookup(byteaddress);
-		const handler_entry_read &handler = m_read.handler_read(entry);
+		if (m_read_window.contains(byteaddress))
+		{
+			_NativeType result = *reinterpret_cast<_NativeType *>(m_read_window.ptr(byteaddress));
+			g_profiler.stop();
+			return result;
+		}
+
+		// look up the handler
+		const handler_entry_read &handler = read_handler(byteaddress);
 
 		// either read directly from RAM, or call the delegate
 		offset = handler.byteoffset(byteaddress);
 		_NativeType result;
-		if (entry <= STATIC_BANKMAX) result = *reinterpret_cast<_NativeType *>(handler.ramptr(offset));
+		if (handler.is_bank())
+		{
+			result = *reinterpret_cast<_NativeType *>(handler.ramptr(offset));
+			if (m_read.ram_windows_allowed())
+				m_read.find_ram_window(byteaddress, m_read_window);
+		}
 		else if (sizeof(_NativeType) == 1) result = handler.read8(*this, offset, 0xff);
 		else if (sizeof(_NativeType) == 2) result = handler.read16(*this, offset >> 1, 0xffff);
 		else if (sizeof(_NativeType) == 4) result = handler.read32(*this, offset >> 2, 0xffffffff);
@@ -1146,17 +1357,27 @@ public:
 	{
 		g_profiler.start(PROFILER_MEMWRITE);
 
-		// look up the handler
+		// accesses within the last RAM window write directly
 		offs_t byteaddress = offset & m_bytemask;
-		u32 entry = write_lookup(byteaddress);
-		const handler_entry_write &handler = m_write.handler_write(entry);
+		if (m_write_window.contains(byteaddress))
+		{
+			_NativeType *dest = reinterpret_cast<_NativeType *>(m_write_window.ptr(byteaddress));
+			*dest = (*dest & ~mask) | (data & mask);
+			g_profiler.stop();
+			return;
+		}
+
+		// look up the handler
+		const handler_entry_write &handler = write_handler(byteaddress);
 
 		// either write directly to RAM, or call the delegate
 		offset = handler.byteoffset(byteaddress);
-		if (entry <= STATIC_BANKMAX)
+		if (handler.is_bank())
 		{
 			_NativeType *dest = reinterpret_cast<_NativeType *>(handler.ramptr(offset));
 			*dest = (*dest & ~mask) | (data & mask);
+			if (m_write.ram_windows_allowed())
+				m_write.find_ram_window(byteaddress, m_write_window);
 		}
 		else if (sizeof(_NativeType) == 1) handler.write8(*this, offset, data, mask);
 		else if (sizeof(_NativeType) == 2) handler.write16(*this, offset >> 1, data, mask);
@@ -1171,14 +1392,26 @@ public:
 	{
 		g_profiler.start(PROFILER_MEMWRITE);
 
-		// look up the handler
+		// accesses within the last RAM window write directly
 		offs_t byteaddress = offset & m_bytemask;
-		u32 entry = write_lookup(byteaddress);
-		const handler_entry_write &handler = m_write.handler_write(entry);
+		if (m_write_window.contains(byteaddress))
+		{
+			*reinterpret_cast<_NativeType *>(m_write_window.ptr(byteaddress)) = data;
+			g_profiler.stop();
+			return;
+		}
+
+		// look up the handler
+		const handler_entry_write &handler = write_handler(byteaddress);
 
 		// either write directly to RAM, or call the delegate
 		offset = handler.byteoffset(byteaddress);
-		if (entry <= STATIC_BANKMAX) *reinterpret_cast<_NativeType *>(handler.ramptr(offset)) = data;
+		if (handler.is_bank())
+		{
+			*reinterpret_cast<_NativeType *>(handler.ramptr(offset)) = data;
+			if (m_write.ram_windows_allowed())
+				m_write.find_ram_window(byteaddress, m_write_window);
+		}
 		else if (sizeof(_NativeType) == 1) handler.write8(*this, offset, data, 0xff);
 		else if (sizeof(_NativeType) == 2) handler.write16(*this, offset >> 1, data, 0xffff);
 		else if (sizeof(_NativeType) == 4) handler.write32(*this, offset >> 2, data, 0xffffffff);
@@ -1525,6 +1758,8 @@ typedef address_space_specific<u64, ENDIANNESS_BIG,    true> address_space_64be_
 
 // global watchpoint table
 u16 address_table::s_watchpoint_table[1 << LEVEL1_BITS];
+u16 address_table::s_stats_table[1 << LEVEL1_BITS];
+u16 address_table::s_deferred_table[1 << LEVEL1_BITS];
 
 
 
@@ -1585,9 +1820,23 @@ void memory_manager::initialize()
 	for (auto &space : m_spacelist)
 		space->prepare_map();
 
-	// create the handlers from the resulting address maps
+	// count accesses to every handler if requested
+	if (machine().options().mem_stats())
+	{
+		for (auto &space : m_spacelist)
+			space->enable_stats();
+		machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&memory_manager::write_stats, this));
+	}
+
+	// create the handlers from the resulting address maps; spaces that need no
+	// memory of their own wait until they are first used
 	for (auto &space : m_spacelist)
-		space->populate_from_map();
+	{
+		if (space->can_defer_population())
+			space->defer_population();
+		else
+			space->populate_from_map();
+	}
 
 	// allocate memory needed to back each address space
 	for (auto &space : m_spacelist)
@@ -1644,6 +1893,51 @@ void memory_manager::dump(FILE *file)
 }
 
 
+//-------------------------------------------------
+//  dump_stats - dump the access counts gathered
+//  for each address space to the given file
+//-------------------------------------------------
+
+void memory_manager::dump_stats(FILE *file)
+{
+	// skip if we can't open the file
+	if (file == nullptr)
+		return;
+
+	// loop over address spaces
+	for (auto &space : m_spacelist)
+	{
+		fprintf(file, "\n\n"
+						"====================================================\n"
+						"Device '%s' %s address space read statistics\n"
+						"====================================================\n", space->device().tag(), space->name());
+		space->dump_stats(file, ROW_READ);
+
+		fprintf(file, "\n\n"
+						"====================================================\n"
+						"Device '%s' %s address space write statistics\n"
+						"====================================================\n", space->device().tag(), space->name());
+		space->dump_stats(file, ROW_WRITE);
+	}
+}
+
+
+//-------------------------------------------------
+//  write_stats - write the access counts to
+//  memstats.log on exit
+//-------------------------------------------------
+
+void memory_manager::write_stats()
+{
+	FILE *file = fopen("memstats.log", "w");
+	if (file)
+	{
+		dump_stats(file);
+		fclose(file);
+	}
+}
+
+
 //-------------------------------------------------
 //  region_alloc - allocates memory for a region
 //-------------------------------------------------
@@ -1661,6 +1955,23 @@ memory_region *memory_manager::region_alloc(const char *name, u32 length, u8 wid
 }
 
 
+//-------------------------------------------------
+//  region_map - allocates a region whose contents
+//  are a copy-on-write mapping of a file; the
+//  region keeps the file open until it is freed
+//-------------------------------------------------
+
+memory_region *memory_manager::region_map(const char *name, osd_file::ptr &&backing, u8 *base, u32 length, u8 width, endianness_t endian)
+{
+	osd_printf_verbose("Region '%s' mapped\n", name);
+	if (m_regionlist.find(name) != m_regionlist.end())
+		fatalerror("region_map called with duplicate region name \"%s\"\n", name);
+
+	m_regionlist.emplace(name, std::make_unique<memory_region>(machine(), name, std::move(backing), base, length, width, endian));
+	return m_regionlist.find(name)->second.get();
+}
+
+
 //-------------------------------------------------
 //  region_free - releases memory for a region
 //-------------------------------------------------
@@ -1741,6 +2052,7 @@ address_space::address_space(memory_manager &manager, device_memory_interface &m
 		m_spacenum(spacenum),
 		m_debugger_access(false),
 		m_log_unmap(true),
+		m_population_deferred(false),
 		m_direct(std::make_unique<direct_read_data>(*this)),
 		m_name(memory.space_config(spacenum)->name()),
 		m_addrchars((m_config.m_addrbus_width + 3) / 4),
@@ -1748,6 +2060,8 @@ address_space::address_space(memory_manager &manager, device_memory_interface &m
 		m_manager(manager),
 		m_machine(memory.device().machine())
 {
+	invalidate_ram_windows();
+
 	// notify the device
 	memory.set_address_space(spacenum, *this);
 }
@@ -2120,6 +2434,58 @@ void address_space::populate_from_map(address_map *map)
 }
 
 
+//-------------------------------------------------
+//  can_defer_population - return whether the map
+//  only contains handlers, so that populating it
+//  can wait until the space is first used
+//-------------------------------------------------
+
+bool address_space::can_defer_population() const
+{
+	if (m_map == nullptr)
+		return false;
+
+	// anything backed by memory must exist before the devices start
+	for (const address_map_entry &entry : m_map->m_entrylist)
+	{
+		if (entry.m_share != nullptr || entry.m_memory != nullptr || entry.m_setoffsethd.m_type != AMH_NONE)
+			return false;
+		for (const map_handler_data *data : { &entry.m_read, &entry.m_write })
+			if (data->m_type == AMH_ROM || data->m_type == AMH_RAM || data->m_type == AMH_BANK)
+				return false;
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  defer_population - leave the tables empty and
+//  populate them from the map on the first access
+//  or explicit install
+//-------------------------------------------------
+
+void address_space::defer_population()
+{
+	read().set_deferred(true);
+	write().set_deferred(true);
+	m_population_deferred = true;
+}
+
+
+//-------------------------------------------------
+//  populate_deferred - populate a space whose
+//  population was deferred
+//-------------------------------------------------
+
+void address_space::populate_deferred()
+{
+	m_population_deferred = false;
+	populate_from_map();
+	read().set_deferred(false);
+	write().set_deferred(false);
+}
+
+
 //-------------------------------------------------
 //  populate_map_entry - map a single read or
 //  write entry based on information from an
@@ -2369,6 +2735,32 @@ const char *address_space::get_handler_string(read_or_write readorwrite, offs_t
 }
 
 
+//-------------------------------------------------
+//  dump_stats - dump the access counts of a
+//  single address space
+//-------------------------------------------------
+
+void address_space::dump_stats(FILE *file, read_or_write readorwrite)
+{
+	const address_table &table = (readorwrite == ROW_READ) ? static_cast<address_table &>(read()) : static_cast<address_table &>(write());
+	table.dump_stats(file);
+}
+
+
+//-------------------------------------------------
+//  enable_stats - start or stop counting the
+//  accesses made through each handler; direct
+//  reads are not counted
+//-------------------------------------------------
+
+void address_space::enable_stats(bool enable)
+{
+	read().enable_stats(enable);
+	write().enable_stats(enable);
+	invalidate_ram_windows();
+}
+
+
 //-------------------------------------------------
 //  dump_map - dump the contents of a single
 //  address space
@@ -2765,6 +3157,37 @@ void address_space::install_setoffset_handler(offs_t addrstart, offs_t addrend,
 	setoffset().handler_map_range(nstart, nend, nmask, nmirror, unitmask).set_delegate(handler);
 }
 
+
+//-----------------------------------------------------------------------
+//  install_read_tap/install_write_tap - install an observer over a range
+//  of the space, leaving the handlers there untouched; only accesses to
+//  the pages containing the range are slowed down
+//-----------------------------------------------------------------------
+
+int address_space::install_read_tap(offs_t addrstart, offs_t addrend, memory_tap_delegate tap)
+{
+	if (addrstart > addrend || (addrend & ~m_addrmask))
+		fatalerror("install_read_tap: Invalid range %x-%x\n", addrstart, addrend);
+	return read().tap_add(address_to_byte(addrstart), address_to_byte_end(addrend), tap);
+}
+
+int address_space::install_write_tap(offs_t addrstart, offs_t addrend, memory_tap_delegate tap)
+{
+	if (addrstart > addrend || (addrend & ~m_addrmask))
+		fatalerror("install_write_tap: Invalid range %x-%x\n", addrstart, addrend);
+	return write().tap_add(address_to_byte(addrstart), address_to_byte_end(addrend), tap);
+}
+
+void address_space::remove_read_tap(int id)
+{
+	read().tap_remove(id);
+}
+
+void address_space::remove_write_tap(int id)
+{
+	write().tap_remove(id);
+}
+
 //**************************************************************************
 //  MEMORY MAPPING HELPERS
 //**************************************************************************
@@ -2929,17 +3352,29 @@ memory_bank *address_space::bank_find_anonymous(offs_t bytestart, offs_t byteend
 
 address_table::address_table(address_space &space, bool large)
 	: m_table(1 << LEVEL1_BITS),
+		m_live_flat(nullptr),
 		m_space(space),
 		m_large(large),
+		m_watchpoints(false),
+		m_deferred(false),
+		m_next_tap_id(1),
+		m_stats_enabled(false),
 		m_subtable(SUBTABLE_COUNT),
 		m_subtable_alloc(0)
 {
+	invalidate_ram_windows();
 	m_live_lookup = &m_table[0];
 
-	// make our static table all watchpoints
+	// make our static tables all watchpoints, statistics counters and deferred entries
 	if (s_watchpoint_table[0] != STATIC_WATCHPOINT)
 		for (unsigned int i=0; i != ARRAY_LENGTH(s_watchpoint_table); i++)
 			s_watchpoint_table[i] = STATIC_WATCHPOINT;
+	if (s_stats_table[0] != STATIC_STATS)
+		for (unsigned int i=0; i != ARRAY_LENGTH(s_stats_table); i++)
+			s_stats_table[i] = STATIC_STATS;
+	if (s_deferred_table[0] != STATIC_DEFERRED)
+		for (unsigned int i=0; i != ARRAY_LENGTH(s_deferred_table); i++)
+			s_deferred_table[i] = STATIC_DEFERRED;
 
 	// initialize everything to unmapped
 	for (unsigned int i=0; i != 1 << LEVEL1_BITS; i++)
@@ -2965,6 +3400,38 @@ address_table::~address_table()
 }
 
 
+//-------------------------------------------------
+//  flat_init - set up the flat handler table for
+//  small spaces; must be called once the derived
+//  class has allocated its handlers
+//-------------------------------------------------
+
+void address_table::flat_init()
+{
+	if (m_large || m_space.bytemask() >= FLAT_MAX_BYTES)
+		return;
+
+	// mirror the current contents of the table
+	m_flat.resize(m_space.bytemask() + 1);
+	for (offs_t byteaddress = 0; byteaddress < m_flat.size(); byteaddress++)
+		m_flat[byteaddress] = &handler(m_table[byteaddress]);
+	update_live_lookup();
+}
+
+
+//-------------------------------------------------
+//  update_live_lookup - select the tables used
+//  for lookups based on the watchpoint and tap
+//  state
+//-------------------------------------------------
+
+void address_table::update_live_lookup()
+{
+	m_live_lookup = m_deferred ? s_deferred_table : m_stats_enabled ? s_stats_table : m_watchpoints ? s_watchpoint_table : base_lookup();
+	m_live_flat = (m_deferred || m_stats_enabled || m_watchpoints || !m_taps.empty() || m_flat.empty()) ? nullptr : &m_flat[0];
+}
+
+
 //-------------------------------------------------
 //  map_range - map a specific entry in the address
 //  map
@@ -2991,6 +3458,7 @@ void address_table::map_range(offs_t addrstart, offs_t addrend, offs_t addrmask,
 
 	// populate it
 	populate_range_mirrored(bytestart, byteend, bytemirror, entry);
+	tap_table_update();
 
 	// recompute any direct access on this space if it is a read modification
 	m_space.m_direct->force_update(entry);
@@ -3024,6 +3492,7 @@ void address_table::setup_range(offs_t addrstart, offs_t addrend, offs_t addrmas
 		setup_range_solid(addrstart, addrend, addrmask, addrmirror, entries);
 	else
 		setup_range_masked(addrstart, addrend, addrmask, addrmirror, mask, entries);
+	tap_table_update();
 }
 
 //-------------------------------------------------
@@ -3222,6 +3691,9 @@ void address_table::verify_reference_counts()
 
 void address_table::populate_range(offs_t bytestart, offs_t byteend, u16 handlerindex)
 {
+	// any cached RAM windows may no longer be valid
+	invalidate_ram_windows();
+
 	offs_t l2mask = (1 << level2_bits()) - 1;
 	offs_t l1start = bytestart >> level2_bits();
 	offs_t l2start = bytestart & l2mask;
@@ -3295,6 +3767,8 @@ void address_table::populate_range(offs_t bytestart, offs_t byteend, u16 handler
 		else
 			handler_unref(subindex);
 		m_table[l1index] = handlerindex;
+		if (!m_large)
+			flat_update(l1index, handlerindex);
 	}
 }
 
@@ -3366,6 +3840,8 @@ void address_table::populate_range_mirrored(offs_t bytestart, offs_t byteend, of
 
 				// set the new value and short-circuit the mapping step
 				m_table[cur_index] = m_table[prev_index];
+				if (!m_large)
+					flat_update(cur_index, m_table[cur_index]);
 				continue;
 			}
 			prev_index = cur_index;
@@ -3496,6 +3972,261 @@ void address_table::mask_all_handlers(offs_t mask)
 	// we don't loop over map entries because the mask applies to static handlers as well
 	for (int entrynum = 0; entrynum < ENTRY_COUNT; entrynum++)
 		handler(entrynum).apply_mask(mask);
+	invalidate_ram_windows();
+}
+
+
+//-------------------------------------------------
+//  invalidate_ram_windows - forget all cached
+//  bank ranges, along with the windows the space
+//  derived from them
+//-------------------------------------------------
+
+void address_table::invalidate_ram_windows()
+{
+	for (bank_range &range : m_bank_range)
+	{
+		range.m_bytestart = 1;
+		range.m_byteend = 0;
+	}
+	m_space.invalidate_ram_windows();
+}
+
+
+//-------------------------------------------------
+//  find_ram_window - determine the run of
+//  addresses around the given one that map
+//  linearly onto the same bank; returns false if
+//  there is none
+//-------------------------------------------------
+
+bool address_table::find_ram_window(offs_t byteaddress, address_space::ram_window &window)
+{
+	u16 entry = lookup_live_nowp(byteaddress);
+	if (entry < STATIC_BANK1 || entry > STATIC_BANKMAX)
+		return false;
+
+	// only contiguous low-order masks map linearly
+	const handler_entry &bank = handler(entry);
+	const offs_t mask = bank.bytemask();
+	if ((mask & (mask + 1)) != 0)
+		return false;
+
+	// derive the range the first time, then reuse it until the table changes
+	bank_range &range = m_bank_range[entry];
+	if (byteaddress < range.m_bytestart || byteaddress > range.m_byteend)
+		derive_range(byteaddress, range.m_bytestart, range.m_byteend);
+
+	// reject ranges that wrap around within the bank
+	const offs_t baseoffset = bank.byteoffset(range.m_bytestart);
+	if (baseoffset + (range.m_byteend - range.m_bytestart) > mask)
+		return false;
+
+	window.m_bytestart = range.m_bytestart;
+	window.m_byteend = range.m_byteend;
+	window.m_baseoffset = baseoffset;
+	window.m_baseptr = bank.rambaseptr();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  tap_add - install an observer over a range of
+//  byte addresses, returning an identifier that
+//  can be used to remove it later
+//-------------------------------------------------
+
+int address_table::tap_add(offs_t bytestart, offs_t byteend, memory_tap_delegate callback)
+{
+	memory_tap tap;
+	tap.m_id = m_next_tap_id++;
+	tap.m_bytestart = bytestart;
+	tap.m_byteend = byteend;
+	tap.m_callback = callback;
+	m_taps.push_back(tap);
+
+	// divert the affected pages and stop bypassing the handlers
+	tap_table_update();
+	update_live_lookup();
+	invalidate_ram_windows();
+	return tap.m_id;
+}
+
+
+//-------------------------------------------------
+//  tap_remove - remove a previously installed
+//  observer
+//-------------------------------------------------
+
+void address_table::tap_remove(int id)
+{
+	for (auto it = m_taps.begin(); it != m_taps.end(); ++it)
+		if (it->m_id == id)
+		{
+			m_taps.erase(it);
+			break;
+		}
+
+	// once the last tap is gone, lookups go straight to the real table again
+	if (m_taps.empty())
+		std::vector<u16>().swap(m_tap_table);
+	else
+		tap_table_update();
+	update_live_lookup();
+}
+
+
+//-------------------------------------------------
+//  tap_table_update - rebuild the table used while
+//  taps are installed; entries covering a tapped
+//  address go through the tap handler and
+//  everything else is looked up exactly as before
+//-------------------------------------------------
+
+void address_table::tap_table_update()
+{
+	if (m_taps.empty())
+		return;
+
+	// start from the real table, subtables included
+	m_tap_table.assign(m_table.begin(), m_table.end());
+
+	// collect the level 1 entries that touch a tap
+	std::vector<offs_t> pages;
+	for (const memory_tap &tap : m_taps)
+		for (offs_t l1index = level1_index(tap.m_bytestart); l1index <= level1_index(tap.m_byteend); l1index++)
+			pages.push_back(l1index);
+	std::sort(pages.begin(), pages.end());
+	pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+
+	u16 nextfree = 0;
+	for (offs_t l1index : pages)
+	{
+		// pages without a subtable are diverted as a whole
+		u16 entry = m_table[l1index];
+		if (!m_large || entry < SUBTABLE_BASE)
+		{
+			m_tap_table[l1index] = STATIC_TAP;
+			continue;
+		}
+
+		// subtables may be shared with untapped pages, so divert entries in a private copy;
+		// if every slot is taken, fall back to diverting the whole page
+		while (nextfree < SUBTABLE_COUNT && m_subtable[nextfree].m_usecount != 0)
+			nextfree++;
+		if (nextfree == SUBTABLE_COUNT)
+		{
+			m_tap_table[l1index] = STATIC_TAP;
+			continue;
+		}
+		u16 copy = SUBTABLE_BASE + nextfree++;
+		if (m_tap_table.size() < level2_index_large(copy, 0) + (1 << LEVEL2_BITS))
+			m_tap_table.resize(level2_index_large(copy, 0) + (1 << LEVEL2_BITS));
+		std::copy_n(&m_table[level2_index_large(entry, 0)], 1 << LEVEL2_BITS, &m_tap_table[level2_index_large(copy, 0)]);
+
+		offs_t pagestart = l1index << LEVEL2_BITS;
+		offs_t pageend = pagestart | ((1 << LEVEL2_BITS) - 1);
+		for (const memory_tap &tap : m_taps)
+			if (tap.m_bytestart <= pageend && tap.m_byteend >= pagestart)
+			{
+				// count rather than compare addresses, since the page may end at the top of the space
+				offs_t first = std::max(tap.m_bytestart, pagestart);
+				u32 count = std::min(tap.m_byteend, pageend) - first + 1;
+				std::fill_n(&m_tap_table[level2_index_large(copy, first)], count, STATIC_TAP);
+			}
+		m_tap_table[l1index] = copy;
+	}
+
+	// the table may have been reallocated
+	update_live_lookup();
+}
+
+
+//-------------------------------------------------
+//  tap_notify - call every tap overlapping an
+//  access
+//-------------------------------------------------
+
+void address_table::tap_notify(offs_t byteaddress, int bytes, u64 data, u64 mask)
+{
+	const offs_t byteend = byteaddress + bytes - 1;
+	const offs_t address = m_space.byte_to_address(byteaddress);
+
+	// index rather than iterate, since a tap may install or remove taps
+	for (size_t tapnum = 0; tapnum < m_taps.size(); tapnum++)
+		if (byteaddress <= m_taps[tapnum].m_byteend && byteend >= m_taps[tapnum].m_bytestart)
+		{
+			memory_tap_delegate callback = m_taps[tapnum].m_callback;
+			callback(m_space, address, data, mask);
+		}
+}
+
+
+//-------------------------------------------------
+//  stats_count - count an access against the
+//  entry that will handle it, in this thread's
+//  block of counters
+//-------------------------------------------------
+
+void address_table::stats_count(offs_t byteaddress)
+{
+	static std::atomic<int> s_next_slot(0);
+	static thread_local int s_slot = -1;
+
+	// threads beyond the slot count share blocks, so their counts become approximate
+	if (s_slot < 0)
+		s_slot = s_next_slot++ % STATS_SLOTS;
+
+	u64 *counts = m_stats[s_slot].get();
+	if (counts == nullptr)
+	{
+		std::lock_guard<std::mutex> lock(m_stats_lock);
+		if (m_stats[s_slot] == nullptr)
+		{
+			m_stats[s_slot] = std::make_unique<u64[]>(ENTRY_COUNT);
+			std::fill_n(m_stats[s_slot].get(), ENTRY_COUNT, 0);
+		}
+		counts = m_stats[s_slot].get();
+	}
+	counts[lookup_live_nowp(byteaddress & m_space.bytemask())]++;
+}
+
+
+//-------------------------------------------------
+//  dump_stats - write the access counts for each
+//  entry, busiest first, followed by the totals
+//  for each handler name
+//-------------------------------------------------
+
+void address_table::dump_stats(FILE *file) const
+{
+	// sum the per-thread blocks
+	std::vector<std::pair<u64, u16>> entries;
+	std::map<std::string, u64> names;
+	u64 total = 0;
+	for (u16 entry = 0; entry < ENTRY_COUNT; entry++)
+	{
+		u64 count = 0;
+		for (const auto &block : m_stats)
+			if (block != nullptr)
+				count += block[entry];
+		if (count == 0)
+			continue;
+
+		const char *name = (entry >= STATIC_COUNT) ? handler(entry).name() : nullptr;
+		entries.emplace_back(count, entry);
+		names[(name != nullptr) ? name : handler_name(entry)] += count;
+		total += count;
+	}
+	std::sort(entries.begin(), entries.end(), [] (const std::pair<u64, u16> &a, const std::pair<u64, u16> &b) { return a.first > b.first; });
+
+	fprintf(file, "  Total accesses = %s\n", string_format("%d", total).c_str());
+	for (const auto &entry : entries)
+		fprintf(file, "  %12s  %5.1f%%  %02X  %s\n", string_format("%d", entry.first).c_str(), 100.0 * double(entry.first) / double(total), entry.second, handler_name(entry.second));
+
+	fprintf(file, "\n  By handler name:\n");
+	for (const auto &name : names)
+		fprintf(file, "  %12s  %5.1f%%  %s\n", string_format("%d", name.second).c_str(), 100.0 * double(name.second) / double(total), name.first.c_str());
 }
 
 
@@ -3728,6 +4459,9 @@ const char *address_table::handler_name(u16 entry) const
 	if (entry == STATIC_NOP) return "nop";
 	if (entry == STATIC_UNMAP) return "unmapped";
 	if (entry == STATIC_WATCHPOINT) return "watchpoint";
+	if (entry == STATIC_TAP) return "tap";
+	if (entry == STATIC_STATS) return "statistics";
+	if (entry == STATIC_DEFERRED) return "deferred";
 
 	static char desc[4096];
 	handler(entry).description(desc);
@@ -3759,6 +4493,9 @@ address_table_read::address_table_read(address_space &space, bool large)
 			m_handlers[STATIC_UNMAP]->set_delegate(read8_delegate(FUNC(address_table_read::unmap_r<u8>), this));
 			m_handlers[STATIC_NOP]->set_delegate(read8_delegate(FUNC(address_table_read::nop_r<u8>), this));
 			m_handlers[STATIC_WATCHPOINT]->set_delegate(read8_delegate(FUNC(address_table_read::watchpoint_r<u8>), this));
+			m_handlers[STATIC_TAP]->set_delegate(read8_delegate(FUNC(address_table_read::tap_r<u8>), this));
+			m_handlers[STATIC_STATS]->set_delegate(read8_delegate(FUNC(address_table_read::stats_r<u8>), this));
+			m_handlers[STATIC_DEFERRED]->set_delegate(read8_delegate(FUNC(address_table_read::deferred_r<u8>), this));
 			break;
 
 		// 16-bit case
@@ -3766,6 +4503,9 @@ address_table_read::address_table_read(address_space &space, bool large)
 			m_handlers[STATIC_UNMAP]->set_delegate(read16_delegate(FUNC(address_table_read::unmap_r<u16>), this));
 			m_handlers[STATIC_NOP]->set_delegate(read16_delegate(FUNC(address_table_read::nop_r<u16>), this));
 			m_handlers[STATIC_WATCHPOINT]->set_delegate(read16_delegate(FUNC(address_table_read::watchpoint_r<u16>), this));
+			m_handlers[STATIC_TAP]->set_delegate(read16_delegate(FUNC(address_table_read::tap_r<u16>), this));
+			m_handlers[STATIC_STATS]->set_delegate(read16_delegate(FUNC(address_table_read::stats_r<u16>), this));
+			m_handlers[STATIC_DEFERRED]->set_delegate(read16_delegate(FUNC(address_table_read::deferred_r<u16>), this));
 			break;
 
 		// 32-bit case
@@ -3773,6 +4513,9 @@ address_table_read::address_table_read(address_space &space, bool large)
 			m_handlers[STATIC_UNMAP]->set_delegate(read32_delegate(FUNC(address_table_read::unmap_r<u32>), this));
 			m_handlers[STATIC_NOP]->set_delegate(read32_delegate(FUNC(address_table_read::nop_r<u32>), this));
 			m_handlers[STATIC_WATCHPOINT]->set_delegate(read32_delegate(FUNC(address_table_read::watchpoint_r<u32>), this));
+			m_handlers[STATIC_TAP]->set_delegate(read32_delegate(FUNC(address_table_read::tap_r<u32>), this));
+			m_handlers[STATIC_STATS]->set_delegate(read32_delegate(FUNC(address_table_read::stats_r<u32>), this));
+			m_handlers[STATIC_DEFERRED]->set_delegate(read32_delegate(FUNC(address_table_read::deferred_r<u32>), this));
 			break;
 
 		// 64-bit case
@@ -3780,6 +4523,9 @@ address_table_read::address_table_read(address_space &space, bool large)
 			m_handlers[STATIC_UNMAP]->set_delegate(read64_delegate(FUNC(address_table_read::unmap_r<u64>), this));
 			m_handlers[STATIC_NOP]->set_delegate(read64_delegate(FUNC(address_table_read::nop_r<u64>), this));
 			m_handlers[STATIC_WATCHPOINT]->set_delegate(read64_delegate(FUNC(address_table_read::watchpoint_r<u64>), this));
+			m_handlers[STATIC_TAP]->set_delegate(read64_delegate(FUNC(address_table_read::tap_r<u64>), this));
+			m_handlers[STATIC_STATS]->set_delegate(read64_delegate(FUNC(address_table_read::stats_r<u64>), this));
+			m_handlers[STATIC_DEFERRED]->set_delegate(read64_delegate(FUNC(address_table_read::deferred_r<u64>), this));
 			break;
 	}
 
@@ -3787,6 +4533,12 @@ address_table_read::address_table_read(address_space &space, bool large)
 	m_handlers[STATIC_UNMAP]->configure(0, space.bytemask(), ~0);
 	m_handlers[STATIC_NOP]->configure(0, space.bytemask(), ~0);
 	m_handlers[STATIC_WATCHPOINT]->configure(0, space.bytemask(), ~0);
+	m_handlers[STATIC_TAP]->configure(0, space.bytemask(), ~0);
+	m_handlers[STATIC_STATS]->configure(0, space.bytemask(), ~0);
+	m_handlers[STATIC_DEFERRED]->configure(0, space.bytemask(), ~0);
+
+	// small spaces can dispatch straight from a flat table of handlers
+	flat_init();
 }
 
 
@@ -3833,6 +4585,9 @@ address_table_write::address_table_write(address_space &space, bool large)
 			m_handlers[STATIC_UNMAP]->set_delegate(write8_delegate(FUNC(address_table_write::unmap_w<u8>), this));
 			m_handlers[STATIC_NOP]->set_delegate(write8_delegate(FUNC(address_table_write::nop_w<u8>), this));
 			m_handlers[STATIC_WATCHPOINT]->set_delegate(write8_delegate(FUNC(address_table_write::watchpoint_w<u8>), this));
+			m_handlers[STATIC_TAP]->set_delegate(write8_delegate(FUNC(address_table_write::tap_w<u8>), this));
+			m_handlers[STATIC_STATS]->set_delegate(write8_delegate(FUNC(address_table_write::stats_w<u8>), this));
+			m_handlers[STATIC_DEFERRED]->set_delegate(write8_delegate(FUNC(address_table_write::deferred_w<u8>), this));
 			break;
 
 		// 16-bit case
@@ -3840,6 +4595,9 @@ address_table_write::address_table_write(address_space &space, bool large)
 			m_handlers[STATIC_UNMAP]->set_delegate(write16_delegate(FUNC(address_table_write::unmap_w<u16>), this));
 			m_handlers[STATIC_NOP]->set_delegate(write16_delegate(FUNC(address_table_write::nop_w<u16>), this));
 			m_handlers[STATIC_WATCHPOINT]->set_delegate(write16_delegate(FUNC(address_table_write::watchpoint_w<u16>), this));
+			m_handlers[STATIC_TAP]->set_delegate(write16_delegate(FUNC(address_table_write::tap_w<u16>), this));
+			m_handlers[STATIC_STATS]->set_delegate(write16_delegate(FUNC(address_table_write::stats_w<u16>), this));
+			m_handlers[STATIC_DEFERRED]->set_delegate(write16_delegate(FUNC(address_table_write::deferred_w<u16>), this));
 			break;
 
 		// 32-bit case
@@ -3847,6 +4605,9 @@ address_table_write::address_table_write(address_space &space, bool large)
 			m_handlers[STATIC_UNMAP]->set_delegate(write32_delegate(FUNC(address_table_write::unmap_w<u32>), this));
 			m_handlers[STATIC_NOP]->set_delegate(write32_delegate(FUNC(address_table_write::nop_w<u32>), this));
 			m_handlers[STATIC_WATCHPOINT]->set_delegate(write32_delegate(FUNC(address_table_write::watchpoint_w<u32>), this));
+			m_handlers[STATIC_TAP]->set_delegate(write32_delegate(FUNC(address_table_write::tap_w<u32>), this));
+			m_handlers[STATIC_STATS]->set_delegate(write32_delegate(FUNC(address_table_write::stats_w<u32>), this));
+			m_handlers[STATIC_DEFERRED]->set_delegate(write32_delegate(FUNC(address_table_write::deferred_w<u32>), this));
 			break;
 
 		// 64-bit case
@@ -3854,6 +4615,9 @@ address_table_write::address_table_write(address_space &space, bool large)
 			m_handlers[STATIC_UNMAP]->set_delegate(write64_delegate(FUNC(address_table_write::unmap_w<u64>), this));
 			m_handlers[STATIC_NOP]->set_delegate(write64_delegate(FUNC(address_table_write::nop_w<u64>), this));
 			m_handlers[STATIC_WATCHPOINT]->set_delegate(write64_delegate(FUNC(address_table_write::watchpoint_w<u64>), this));
+			m_handlers[STATIC_TAP]->set_delegate(write64_delegate(FUNC(address_table_write::tap_w<u64>), this));
+			m_handlers[STATIC_STATS]->set_delegate(write64_delegate(FUNC(address_table_write::stats_w<u64>), this));
+			m_handlers[STATIC_DEFERRED]->set_delegate(write64_delegate(FUNC(address_table_write::deferred_w<u64>), this));
 			break;
 	}
 
@@ -3861,6 +4625,12 @@ address_table_write::address_table_write(address_space &space, bool large)
 	m_handlers[STATIC_UNMAP]->configure(0, space.bytemask(), ~0);
 	m_handlers[STATIC_NOP]->configure(0, space.bytemask(), ~0);
 	m_handlers[STATIC_WATCHPOINT]->configure(0, space.bytemask(), ~0);
+	m_handlers[STATIC_TAP]->configure(0, space.bytemask(), ~0);
+	m_handlers[STATIC_STATS]->configure(0, space.bytemask(), ~0);
+	m_handlers[STATIC_DEFERRED]->configure(0, space.bytemask(), ~0);
+
+	// small spaces can dispatch straight from a flat table of handlers
+	flat_init();
 }
 
 
@@ -3896,12 +4666,16 @@ handler_entry &address_table_write::handler(u32 index) const
 
 direct_read_data::direct_read_data(address_space &space)
 	: m_space(space),
-		m_ptr(nullptr),
+		m_baseptr(&m_explicit_ptr),
+		m_baseadjust(0),
+		m_explicit_ptr(nullptr),
 		m_bytemask(space.bytemask()),
 		m_bytestart(1),
 		m_byteend(0),
 		m_entry(STATIC_UNMAP)
 {
+	for (auto &cached : m_range_cache)
+		cached.m_range = nullptr;
 }
 
 
@@ -3944,13 +4718,14 @@ bool direct_read_data::set_direct_region(offs_t &byteaddress)
 		return false;
 	}
 
-	u8 *base = *m_space.manager().bank_pointer_addr(m_entry);
+	// read through the bank's base pointer slot so that bank switches take effect immediately
+	m_baseptr = m_space.manager().bank_pointer_addr(m_entry);
 
 	// compute the adjusted base
 	offs_t maskedbits = overrideaddress & ~m_space.bytemask();
 	const handler_entry_read &handler = m_space.read().handler_read(m_entry);
 	m_bytemask = handler.bytemask();
-	m_ptr = base - (handler.bytestart() & m_bytemask);
+	m_baseadjust = handler.bytestart() & m_bytemask;
 	m_bytestart = maskedbits | range->m_bytestart;
 	m_byteend = maskedbits | range->m_byteend;
 	return true;
@@ -3967,17 +4742,23 @@ direct_read_data::direct_range *direct_read_data::find_range(offs_t byteaddress,
 	byteaddress &= m_space.m_bytemask;
 	entry = m_space.read().lookup_live_nowp(byteaddress);
 
+	// check the most recent range seen in this page first
+	range_cache_entry &cached = m_range_cache[range_cache_slot(byteaddress)];
+	if (cached.m_range != nullptr && cached.m_entry == entry && byteaddress >= cached.m_range->m_bytestart && byteaddress <= cached.m_range->m_byteend)
+		return cached.m_range;
+
 	// scan our table
+	cached.m_entry = entry;
 	for (auto &range : m_rangelist[entry])
 		if (byteaddress >= range.m_bytestart && byteaddress <= range.m_byteend)
-			return &range;
+			return cached.m_range = &range;
 
 	// didn't find out; create a new one
 	direct_range range;
 	m_space.read().derive_range(byteaddress, range.m_bytestart, range.m_byteend);
 	m_rangelist[entry].push_front(range);
 
-	return &m_rangelist[entry].front();
+	return cached.m_range = &m_rangelist[entry].front();
 }
 
 
@@ -3988,6 +4769,11 @@ direct_read_data::direct_range *direct_read_data::find_range(offs_t byteaddress,
 
 void direct_read_data::remove_intersecting_ranges(offs_t bytestart, offs_t byteend)
 {
+	// drop any cached pointers to the ranges about to go away, while they can still be read
+	for (auto &cached : m_range_cache)
+		if (cached.m_range != nullptr && bytestart <= cached.m_range->m_byteend && byteend >= cached.m_range->m_bytestart)
+			cached.m_range = nullptr;
+
 	// loop over all entries
 	for (auto & elem : m_rangelist)
 	{
@@ -4028,7 +4814,9 @@ void direct_read_data::explicit_configure(offs_t bytestart, offs_t byteend, offs
 	m_bytestart = bytestart;
 	m_byteend = byteend;
 	m_bytemask = bytemask;
-	m_ptr = reinterpret_cast<u8 *>(ptr) - (bytestart & bytemask);
+	m_explicit_ptr = reinterpret_cast<u8 *>(ptr);
+	m_baseptr = &m_explicit_ptr;
+	m_baseadjust = bytestart & bytemask;
 }
 
 
@@ -4169,9 +4957,10 @@ void memory_bank::add_reference(address_space &space, read_or_write readorwrite)
 
 void memory_bank::invalidate_references()
 {
-	// invalidate all the direct references to any referenced address spaces
+	// direct reads and RAM windows go through the bank pointer slot, so only
+	// spaces with custom direct update callbacks need to be told
 	for (auto &ref : m_reflist)
-		ref->space().direct().force_update();
+		ref->space().direct().bank_changed();
 }
 
 
@@ -4275,6 +5064,21 @@ memory_region::memory_region(running_machine &machine, const char *name, u32 len
 	: m_machine(machine),
 		m_name(name),
 		m_buffer(length),
+		m_base(length ? &m_buffer[0] : nullptr),
+		m_length(length),
+		m_endianness(endian),
+		m_bitwidth(width * 8),
+		m_bytewidth(width)
+{
+	assert(width == 1 || width == 2 || width == 4 || width == 8);
+}
+
+memory_region::memory_region(running_machine &machine, const char *name, osd_file::ptr &&backing, u8 *base, u32 length, u8 width, endianness_t endian)
+	: m_machine(machine),
+		m_name(name),
+		m_backing(std::move(backing)),
+		m_base(base),
+		m_length(length),
 		m_endianness(endian),
 		m_bitwidth(width * 8),
 		m_bytewidth(width)
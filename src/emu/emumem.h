@@ -112,6 +112,12 @@ struct data_accessors
 typedef delegate<offs_t (direct_read_data &, offs_t)> direct_update_delegate;
 
 
+// ======================> memory_tap_delegate
+
+// memory tap observer, called with the address, data and mask of each access
+typedef delegate<void (address_space &, offs_t, u64, u64)> memory_tap_delegate;
+
+
 // ======================> read_delegate
 
 // declare delegates for each width
@@ -141,6 +147,10 @@ class direct_read_data
 {
 	friend class address_table;
 
+	// recently used ranges are cached by address page to avoid walking the lists
+	static const int RANGE_CACHE_BITS = 6;                  // log2 of the number of cache slots
+	static const int RANGE_CACHE_SHIFT = 10;                // log2 of the page size used to pick a slot
+
 public:
 	// direct_range is an internal class that is part of a list of start/end ranges
 	class direct_range
@@ -165,7 +175,7 @@ public:
 
 	// getters
 	address_space &space() const { return m_space; }
-	u8 *ptr() const { return m_ptr; }
+	u8 *ptr() const { return *m_baseptr - m_baseadjust; }
 
 	// see if an address is within bounds, or attempt to update it if not
 	bool address_is_valid(offs_t byteaddress) { return EXPECTED(byteaddress >= m_bytestart && byteaddress <= m_byteend) || set_direct_region(byteaddress); }
@@ -174,6 +184,10 @@ public:
 	void force_update() { m_byteend = 0; m_bytestart = 1; }
 	void force_update(u16 if_match) { if (m_entry == if_match) force_update(); }
 
+	// banks are read through their base pointer slot, so a bank switch only
+	// matters if a custom update callback may have computed its own pointer
+	void bank_changed() { if (!m_directupdate.isnull()) force_update(); }
+
 	// custom update callbacks and configuration
 	direct_update_delegate set_direct_update(direct_update_delegate function);
 	void explicit_configure(offs_t bytestart, offs_t byteend, offs_t bytemask, void *raw);
@@ -190,15 +204,24 @@ private:
 	bool set_direct_region(offs_t &byteaddress);
 	direct_range *find_range(offs_t byteaddress, u16 &entry);
 	void remove_intersecting_ranges(offs_t bytestart, offs_t byteend);
+	static u32 range_cache_slot(offs_t byteaddress) { return (byteaddress >> RANGE_CACHE_SHIFT) & ((1 << RANGE_CACHE_BITS) - 1); }
 
 	// internal state
 	address_space &             m_space;
-	u8 *                        m_ptr;                  // direct access data pointer
+	u8 **                       m_baseptr;              // pointer to the slot holding the direct access base
+	offs_t                      m_baseadjust;           // amount to subtract from the base to form the data pointer
+	u8 *                        m_explicit_ptr;         // slot used for explicitly configured pointers
 	offs_t                      m_bytemask;             // byte address mask
 	offs_t                      m_bytestart;            // minimum valid byte address
 	offs_t                      m_byteend;              // maximum valid byte address
 	u16                         m_entry;                // live entry
 	std::list<direct_range>     m_rangelist[TOTAL_MEMORY_BANKS];  // list of ranges for each entry
+	struct range_cache_entry
+	{
+		direct_range *          m_range;                // most recent range found in this page slot
+		u16                     m_entry;                // entry the range belongs to
+	};
+	range_cache_entry           m_range_cache[1 << RANGE_CACHE_BITS];
 	direct_update_delegate      m_directupdate;         // fast direct-access update callback
 };
 
@@ -296,6 +319,10 @@ public:
 	void set_log_unmap(bool log) { m_log_unmap = log; }
 	void dump_map(FILE *file, read_or_write readorwrite);
 
+	// access statistics
+	void enable_stats(bool enable = true);
+	void dump_stats(FILE *file, read_or_write readorwrite);
+
 	// watchpoint enablers
 	virtual void enable_read_watchpoints(bool enable = true) = 0;
 	virtual void enable_write_watchpoints(bool enable = true) = 0;
@@ -395,6 +422,13 @@ public:
 	void install_setoffset_handler(offs_t addrstart, offs_t addrend, setoffset_delegate sohandler, u64 unitmask = 0) { install_setoffset_handler(addrstart, addrend, 0, 0, 0, sohandler, unitmask); }
 	void install_setoffset_handler(offs_t addrstart, offs_t addrend, offs_t addrmask, offs_t addrmirror, offs_t addrselect, setoffset_delegate sohandler, u64 unitmask = 0);
 
+	// install memory taps, which observe accesses to a range without disturbing the handlers
+	// there; reads are reported after the access and writes before, direct reads are not seen
+	int install_read_tap(offs_t addrstart, offs_t addrend, memory_tap_delegate tap);
+	int install_write_tap(offs_t addrstart, offs_t addrend, memory_tap_delegate tap);
+	void remove_read_tap(int id);
+	void remove_write_tap(int id);
+
 	// install new-style delegate handlers (short form)
 	void install_read_handler(offs_t addrstart, offs_t addrend, read8_delegate rhandler, u64 unitmask = 0) { install_read_handler(addrstart, addrend, 0, 0, 0, rhandler, unitmask); }
 	void install_write_handler(offs_t addrstart, offs_t addrend, write8_delegate whandler, u64 unitmask = 0) { install_write_handler(addrstart, addrend, 0, 0, 0, whandler, unitmask); }
@@ -426,6 +460,9 @@ public:
 	// setup
 	void prepare_map();
 	void populate_from_map(address_map *map = nullptr);
+	bool can_defer_population() const;
+	void defer_population();
+	void populate_if_deferred() { if (m_population_deferred) populate_deferred(); }
 	void allocate_memory();
 	void locate_memory();
 
@@ -435,6 +472,7 @@ private:
 	virtual address_table_write &write() = 0;
 	virtual address_table_setoffset &setoffset() = 0;
 
+	void populate_deferred();
 	void populate_map_entry(const address_map_entry &entry, read_or_write readorwrite);
 	void populate_map_entry_setoffset(const address_map_entry &entry);
 	void unmap_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, read_or_write readorwrite, bool quiet);
@@ -452,6 +490,20 @@ private:
 	void check_address(const char *function, offs_t addrstart, offs_t addrend);
 
 protected:
+	// a contiguous run of addresses that map linearly onto a memory bank
+	struct ram_window
+	{
+		void invalidate() { m_bytestart = 1; m_byteend = 0; }
+		bool contains(offs_t byteaddress) const { return byteaddress >= m_bytestart && byteaddress <= m_byteend; }
+		u8 *ptr(offs_t byteaddress) const { return *m_baseptr + m_baseoffset + (byteaddress - m_bytestart); }
+
+		offs_t              m_bytestart;        // first byte address in the window
+		offs_t              m_byteend;          // last byte address in the window
+		offs_t              m_baseoffset;       // offset of m_bytestart within the bank
+		u8 **               m_baseptr;          // pointer to the bank base pointer
+	};
+	void invalidate_ram_windows() { m_read_window.invalidate(); m_write_window.invalidate(); }
+
 	// private state
 	const address_space_config &m_config;       // configuration of this space
 	device_t &              m_device;           // reference to the owning device
@@ -464,10 +516,13 @@ protected:
 	address_spacenum        m_spacenum;         // address space index
 	bool                    m_debugger_access;  // treat accesses as coming from the debugger
 	bool                    m_log_unmap;        // log unmapped accesses in this space?
+	bool                    m_population_deferred; // are we waiting for the first use to populate the tables?
 	std::unique_ptr<direct_read_data> m_direct;    // fast direct-access read info
 	const char *            m_name;             // friendly name of the address space
 	u8                      m_addrchars;        // number of characters to use for physical addresses
 	u8                      m_logaddrchars;     // number of characters to use for logical addresses
+	ram_window              m_read_window;      // most recent RAM window hit by a read
+	ram_window              m_write_window;     // most recent RAM window hit by a write
 
 private:
 	memory_manager &        m_manager;          // reference to the owning manager
@@ -671,13 +726,15 @@ class memory_region
 public:
 	// construction/destruction
 	memory_region(running_machine &machine, const char *name, u32 length, u8 width, endianness_t endian);
+	memory_region(running_machine &machine, const char *name, osd_file::ptr &&backing, u8 *base, u32 length, u8 width, endianness_t endian);
 
 	// getters
 	running_machine &machine() const { return m_machine; }
-	u8 *base() { return (m_buffer.size() > 0) ? &m_buffer[0] : nullptr; }
-	u8 *end() { return base() + m_buffer.size(); }
-	u32 bytes() const { return m_buffer.size(); }
+	u8 *base() { return m_base; }
+	u8 *end() { return m_base + m_length; }
+	u32 bytes() const { return m_length; }
 	const char *name() const { return m_name.c_str(); }
+	bool is_mapped() const { return bool(m_backing); }
 
 	// flag expansion
 	endianness_t endianness() const { return m_endianness; }
@@ -685,7 +742,7 @@ public:
 	u8 bytewidth() const { return m_bytewidth; }
 
 	// data access
-	u8 &as_u8(offs_t offset = 0) { return m_buffer[offset]; }
+	u8 &as_u8(offs_t offset = 0) { return m_base[offset]; }
 	u16 &as_u16(offs_t offset = 0) { return reinterpret_cast<u16 *>(base())[offset]; }
 	u32 &as_u32(offs_t offset = 0) { return reinterpret_cast<u32 *>(base())[offset]; }
 	u64 &as_u64(offs_t offset = 0) { return reinterpret_cast<u64 *>(base())[offset]; }
@@ -695,6 +752,9 @@ private:
 	running_machine &       m_machine;
 	std::string             m_name;
 	std::vector<u8>         m_buffer;
+	osd_file::ptr           m_backing;              // copy-on-write file mapping, when not in m_buffer
+	u8 *                    m_base;
+	u32                     m_length;
 	endianness_t            m_endianness;
 	u8                      m_bitwidth;
 	u8                      m_bytewidth;
@@ -720,14 +780,16 @@ public:
 	const std::unordered_map<std::string, std::unique_ptr<memory_region>> &regions() const { return m_regionlist; }
 	const std::unordered_map<std::string, std::unique_ptr<memory_share>> &shares() const { return m_sharelist; }
 
-	// dump the internal memory tables to the given file
+	// dump the internal memory tables or access statistics to the given file
 	void dump(FILE *file);
+	void dump_stats(FILE *file);
 
 	// pointers to a bank pointer (internal usage only)
 	u8 **bank_pointer_addr(u8 index) { return &m_bank_ptr[index]; }
 
 	// regions
 	memory_region *region_alloc(const char *name, u32 length, u8 width, endianness_t endian);
+	memory_region *region_map(const char *name, osd_file::ptr &&backing, u8 *base, u32 length, u8 width, endianness_t endian);
 	void region_free(const char *name);
 	memory_region *region_containing(const void *memory, offs_t bytes) const;
 
@@ -735,6 +797,7 @@ private:
 	// internal helpers
 	void bank_reattach();
 	void allocate(device_memory_interface &memory);
+	void write_stats();
 
 	// internal state
 	running_machine &           m_machine;              // reference to the machine
@@ -875,7 +938,7 @@ private:
 inline void *direct_read_data::read_ptr(offs_t byteaddress, offs_t directxor)
 {
 	if (address_is_valid(byteaddress))
-		return &m_ptr[(byteaddress ^ directxor) & m_bytemask];
+		return &ptr()[(byteaddress ^ directxor) & m_bytemask];
 	return nullptr;
 }
 
@@ -888,7 +951,7 @@ inline void *direct_read_data::read_ptr(offs_t byteaddress, offs_t directxor)
 inline u8 direct_read_data::read_byte(offs_t byteaddress, offs_t directxor)
 {
 	if (address_is_valid(byteaddress))
-		return m_ptr[(byteaddress ^ directxor) & m_bytemask];
+		return ptr()[(byteaddress ^ directxor) & m_bytemask];
 	return m_space.read_byte(byteaddress);
 }
 
@@ -901,7 +964,7 @@ inline u8 direct_read_data::read_byte(offs_t byteaddress, offs_t directxor)
 inline u16 direct_read_data::read_word(offs_t byteaddress, offs_t directxor)
 {
 	if (address_is_valid(byteaddress))
-		return *reinterpret_cast<u16 *>(&m_ptr[(byteaddress ^ directxor) & m_bytemask]);
+		return *reinterpret_cast<u16 *>(&ptr()[(byteaddress ^ directxor) & m_bytemask]);
 	return m_space.read_word(byteaddress);
 }
 
@@ -914,7 +977,7 @@ inline u16 direct_read_data::read_word(offs_t byteaddress, offs_t directxor)
 inline u32 direct_read_data::read_dword(offs_t byteaddress, offs_t directxor)
 {
 	if (address_is_valid(byteaddress))
-		return *reinterpret_cast<u32 *>(&m_ptr[(byteaddress ^ directxor) & m_bytemask]);
+		return *reinterpret_cast<u32 *>(&ptr()[(byteaddress ^ directxor) & m_bytemask]);
 	return m_space.read_dword(byteaddress);
 }
 
@@ -927,7 +990,7 @@ inline u32 direct_read_data::read_dword(offs_t byteaddress, offs_t directxor)
 inline u64 direct_read_data::read_qword(offs_t byteaddress, offs_t directxor)
 {
 	if (address_is_valid(byteaddress))
-		return *reinterpret_cast<u64 *>(&m_ptr[(byteaddress ^ directxor) & m_bytemask]);
+		return *reinterpret_cast<u64 *>(&ptr()[(byteaddress ^ directxor) & m_bytemask]);
 	return m_space.read_qword(byteaddress);
 }
 
@@ -51,6 +51,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SNAPSHOT_DIRECTORY,                         "snap",      OPTION_STRING,     "directory to save/load screenshots" },
 	{ OPTION_DIFF_DIRECTORY,                             "diff",      OPTION_STRING,     "directory to save hard drive image difference files" },
 	{ OPTION_COMMENT_DIRECTORY,                          "comments",  OPTION_STRING,     "directory to save debugger comments" },
+	{ OPTION_REGIONCACHE_DIRECTORY,                      nullptr,        OPTION_STRING,     "directory to share loaded ROM regions between running instances (empty to disable)" },
 
 	// state/playback options
 	{ nullptr,                                              nullptr,        OPTION_HEADER,     "CORE STATE/PLAYBACK OPTIONS" },
@@ -60,6 +61,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_RECORD ";rec",                              nullptr,        OPTION_STRING,     "record an input file" },
 	{ OPTION_RECORD_TIMECODE,                            "0",            OPTION_BOOLEAN,    "record an input timecode file (requires -record option)" },
 	{ OPTION_EXIT_AFTER_PLAYBACK,                        "0",            OPTION_BOOLEAN,    "close the program at the end of playback" },
+	{ OPTION_RECORD_KEYFRAMES,                           "0",            OPTION_BOOLEAN,    "save a state at each keyframe of an input recording so that playback can seek" },
+	{ OPTION_PLAYBACK_SEEK,                              "0",            OPTION_INTEGER,    "start playback from the latest keyframe state at or before this frame" },
 
 	{ OPTION_MNGWRITE,                                   nullptr,        OPTION_STRING,     "optional filename to write a MNG movie of the current session" },
 	{ OPTION_AVIWRITE,                                   nullptr,        OPTION_STRING,     "optional filename to write an AVI movie of the current session" },
@@ -67,11 +70,18 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DUMMYWRITE,                                 "0",         OPTION_BOOLEAN,    "indicates if a snapshot should be created if each frame" },
 #endif
 	{ OPTION_WAVWRITE,                                   nullptr,        OPTION_STRING,     "optional filename to write a WAV file of the current session" },
+	{ OPTION_FRAMEHASH,                                  nullptr,        OPTION_STRING,     "optional filename to write checksums of the screens and sound output to, every -framehash_interval frames" },
+	{ OPTION_FRAMEHASH_BASELINE,                         nullptr,        OPTION_STRING,     "optional -framehash file to compare against; the first difference is a fatal error" },
+	{ OPTION_FRAMEHASH_INTERVAL,                         "1",            OPTION_INTEGER,    "number of frames between checksums for -framehash and -framehash_baseline" },
 	{ OPTION_SNAPNAME,                                   "%g/%i",     OPTION_STRING,     "override of the default snapshot/movie naming; %g == gamename, %i == index" },
 	{ OPTION_SNAPSIZE,                                   "auto",      OPTION_STRING,     "specify snapshot/movie resolution (<width>x<height>) or 'auto' to use minimal size " },
 	{ OPTION_SNAPVIEW,                                   "internal",  OPTION_STRING,     "specify snapshot/movie view or 'internal' to use internal pixel-aspect views" },
 	{ OPTION_SNAPBILINEAR,                               "1",         OPTION_BOOLEAN,    "specify if the snapshot/movie should have bilinear filtering applied" },
+	{ OPTION_SNAPCOMPRESSION "(1-9)",                    "6",         OPTION_INTEGER,    "PNG compression level for snapshots and MNG movies, from 1 (fastest) to 9 (smallest)" },
 	{ OPTION_STATENAME,                                  "%g",        OPTION_STRING,     "override of the default state subfolder naming; %g == gamename" },
+	{ OPTION_REWIND,                                     "0",         OPTION_BOOLEAN,    "keep a history of in-memory save states that can be stepped back through" },
+	{ OPTION_REWIND_INTERVAL "(1-600)",                  "4",         OPTION_INTEGER,    "number of frames between rewind save states" },
+	{ OPTION_REWIND_CAPACITY "(1-4096)",                 "32",        OPTION_INTEGER,    "memory in megabytes for the compressed rewind history" },
 	{ OPTION_BURNIN,                                     "0",         OPTION_BOOLEAN,    "create burn-in snapshots for each screen" },
 
 	// performance options
@@ -83,6 +93,22 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SLEEP,                                      "1",         OPTION_BOOLEAN,    "enable sleeping, which gives time back to other applications when idle" },
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       OPTION_FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         OPTION_BOOLEAN,    "automatically adjusts the speed of gameplay to keep the refresh rate lower than the screen" },
+	{ OPTION_TIMERHEAP,                                  "1",         OPTION_BOOLEAN,    "order pending timers with a binary heap instead of a sorted list" },
+	{ OPTION_RUNAHEAD "(0-4)",                           "0",         OPTION_INTEGER,    "number of frames to emulate ahead of the real timeline to hide input latency; needs save state support" },
+	{ OPTION_NETPLAY,                                    "",          OPTION_STRING,     "play over the network: host:port to connect to a peer, or :port to wait for one" },
+	{ OPTION_NETPLAY_DELAY "(1-8)",                      "2",         OPTION_INTEGER,    "frames between sampling local input and using it when playing over the network" },
+	{ OPTION_NETPLAY_CHECK,                              "60",        OPTION_INTEGER,    "frames between comparing machine state with the network peer to detect desyncs; 0 to disable" },
+	{ OPTION_CHD_READAHEAD,                              "0",         OPTION_INTEGER,    "number of hunks of read-only CHDs to cache, decompressing half of them ahead of sequential reads; 0 to disable" },
+	{ OPTION_TEXTURE_BUDGET,                             "256",       OPTION_INTEGER,    "megabytes of scaled render textures to keep before evicting the least recently used" },
+	{ OPTION_GFX_DECODE_BUDGET,                          "64",        OPTION_INTEGER,    "megabytes a graphics set may decode to in full; larger sets decode into a cache of a quarter of this size" },
+	{ OPTION_DRC_CACHE_BUDGET,                           "0",         OPTION_INTEGER,    "megabytes each DRC code cache may commit before it is flushed instead of grown; 0 for no limit" },
+	{ OPTION_ROM_INDEX,                                  "0",         OPTION_BOOLEAN,    "keep an index of archive contents in the cfg directory and only open archives that may hold the file being loaded" },
+	{ OPTION_HASH_CACHE,                                 "0",         OPTION_BOOLEAN,    "remember the checksums of ROM files in the cfg directory and only recompute them when a file or archive changes" },
+	{ OPTION_SOFTLIST_INDEX,                             "0",         OPTION_BOOLEAN,    "keep compiled software lists in the cfg directory and only parse a list's XML when it changes" },
+	{ OPTION_INFO_CACHE,                                 "0",         OPTION_BOOLEAN,    "keep the -listxml and -listroms output for each system in the cfg directory and reuse it until the build changes" },
+	{ OPTION_BENCHLIST,                                  "",          OPTION_STRING,     "file listing systems to benchmark in turn, one per line, each optionally followed by an input file to play back; each runs for -seconds_to_run (or -bench) emulated seconds" },
+	{ OPTION_BENCHJSON,                                  "",          OPTION_STRING,     "file to write -benchlist results to as JSON; standard output if empty" },
+	{ OPTION_BATCHLIST,                                  "",          OPTION_STRING,     "file listing systems to run in turn in this process, one per line, or - to read them from standard input; archives stay open between runs" },
 
 	// render options
 	{ nullptr,                                              nullptr,        OPTION_HEADER,     "CORE RENDER OPTIONS" },
@@ -133,7 +159,9 @@ const options_entry emu_options::s_option_entries[] =
 	{ nullptr,                                              nullptr,        OPTION_HEADER,     "CORE SOUND OPTIONS" },
 	{ OPTION_SAMPLERATE ";sr(1000-1000000)",             "48000",     OPTION_INTEGER,    "set sound output sample rate" },
 	{ OPTION_SAMPLES,                                    "1",         OPTION_BOOLEAN,    "enable the use of external samples if available" },
+	{ OPTION_SAMPLES_ON_DEMAND,                          "0",         OPTION_BOOLEAN,    "decode each external sample the first time it is played instead of at startup" },
 	{ OPTION_VOLUME ";vol",                              "0",         OPTION_INTEGER,    "sound volume in decibels (-32 min, 0 max)" },
+	{ OPTION_SOUND_UPDATE_RATE "(50-1000)",              "50",        OPTION_INTEGER,    "number of times per second sound is mixed and sent to the OSD; higher values lower latency at some CPU cost" },
 
 	// input options
 	{ nullptr,                                              nullptr,        OPTION_HEADER,     "CORE INPUT OPTIONS" },
@@ -153,6 +181,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_NATURAL_KEYBOARD ";nat",                    "0",         OPTION_BOOLEAN,    "specifies whether to use a natural keyboard or not" },
 	{ OPTION_JOYSTICK_CONTRADICTORY ";joy_contradictory","0",         OPTION_BOOLEAN,    "enable contradictory direction digital joystick input at the same time" },
 	{ OPTION_COIN_IMPULSE,                               "0",         OPTION_INTEGER,    "set coin impulse time (n<0 disable impulse, n==0 obey driver, 0<n set time n)" },
+	{ OPTION_LATE_LATCH,                                 "0",         OPTION_BOOLEAN,    "re-read simple digital inputs when the emulated machine reads a port" },
+	{ OPTION_LATENCY_MONITOR,                            "0",         OPTION_BOOLEAN,    "measure and report latency from digital input changes to reads and presented frames" },
 
 	// input autoenable options
 	{ nullptr,                                              nullptr,        OPTION_HEADER,     "CORE INPUT AUTOMATIC ENABLE OPTIONS" },
@@ -173,6 +203,11 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DEBUG ";d",                                 "0",         OPTION_BOOLEAN,    "enable/disable debugger" },
 	{ OPTION_UPDATEINPAUSE,                              "0",         OPTION_BOOLEAN,    "keep calling video updates while in pause" },
 	{ OPTION_DEBUGSCRIPT,                                nullptr,        OPTION_STRING,     "script for debugger" },
+	{ OPTION_MEMSTATS,                                   "0",         OPTION_BOOLEAN,    "count accesses to each memory handler and write them to memstats.log on exit" },
+	{ OPTION_PROFILE_TRACE,                              nullptr,        OPTION_STRING,     "record profiler scopes from all threads and write them to this file on exit, in Chrome trace format (needs a profiler build)" },
+	{ OPTION_TELEMETRY,                                  "0",         OPTION_BOOLEAN,    "publish speed, frame times, missed frames, sound underflows and input latency as outputs four times a second" },
+	{ OPTION_STARTUP_PROFILE,                            "0",         OPTION_BOOLEAN,    "report the time taken by each phase of machine startup and by the slowest devices to start" },
+	{ OPTION_MEMREPORT,                                  "0",         OPTION_BOOLEAN,    "report the memory held by ROM regions, decoded graphics, tilemaps, caches and other subsystems on exit" },
 
 	// comm options
 	{ nullptr,                                              nullptr,        OPTION_HEADER,     "CORE COMM OPTIONS" },
@@ -187,6 +222,9 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DRC_USE_C,                                  "0",         OPTION_BOOLEAN,    "force DRC use C backend" },
 	{ OPTION_DRC_LOG_UML,                                "0",         OPTION_BOOLEAN,    "write DRC UML disassembly log" },
 	{ OPTION_DRC_LOG_NATIVE,                             "0",         OPTION_BOOLEAN,    "write DRC native disassembly log" },
+	{ OPTION_DRC_WARM_CACHE,                             "0",         OPTION_BOOLEAN,    "remember the blocks DRC cores compile and compile them ahead of time on the next run" },
+	{ OPTION_DRC_TIER_THRESHOLD,                         "0",         OPTION_INTEGER,    "compile DRC blocks cheaply until they have been entered this many times (0 = always compile fully)" },
+	{ OPTION_DRC_PROFILE,                                "0",         OPTION_BOOLEAN,    "count executions and host time for each DRC block and write a report on exit" },
 	{ OPTION_BIOS,                                       nullptr,        OPTION_STRING,     "select the system BIOS to use" },
 	{ OPTION_CHEAT ";c",                                 "0",         OPTION_BOOLEAN,    "enable cheat subsystem" },
 	{ OPTION_SKIP_GAMEINFO,                              "0",         OPTION_BOOLEAN,    "skip displaying the information screen at startup" },
@@ -47,6 +47,7 @@
 #define OPTION_SNAPSHOT_DIRECTORY   "snapshot_directory"
 #define OPTION_DIFF_DIRECTORY       "diff_directory"
 #define OPTION_COMMENT_DIRECTORY    "comment_directory"
+#define OPTION_REGIONCACHE_DIRECTORY "regioncache_directory"
 
 // core state/playback options
 #define OPTION_STATE                "state"
@@ -55,17 +56,26 @@
 #define OPTION_RECORD               "record"
 #define OPTION_RECORD_TIMECODE      "record_timecode"
 #define OPTION_EXIT_AFTER_PLAYBACK  "exit_after_playback"
+#define OPTION_RECORD_KEYFRAMES     "record_keyframes"
+#define OPTION_PLAYBACK_SEEK        "playback_seek"
 #define OPTION_MNGWRITE             "mngwrite"
 #define OPTION_AVIWRITE             "aviwrite"
 #ifdef MAME_DEBUG
 #define OPTION_DUMMYWRITE           "dummywrite"
 #endif
 #define OPTION_WAVWRITE             "wavwrite"
+#define OPTION_FRAMEHASH            "framehash"
+#define OPTION_FRAMEHASH_BASELINE   "framehash_baseline"
+#define OPTION_FRAMEHASH_INTERVAL   "framehash_interval"
 #define OPTION_SNAPNAME             "snapname"
 #define OPTION_SNAPSIZE             "snapsize"
 #define OPTION_SNAPVIEW             "snapview"
 #define OPTION_SNAPBILINEAR         "snapbilinear"
+#define OPTION_SNAPCOMPRESSION      "snapcompression"
 #define OPTION_STATENAME            "statename"
+#define OPTION_REWIND               "rewind"
+#define OPTION_REWIND_INTERVAL      "rewind_interval"
+#define OPTION_REWIND_CAPACITY      "rewind_capacity"
 #define OPTION_BURNIN               "burnin"
 
 // core performance options
@@ -76,6 +86,22 @@
 #define OPTION_SLEEP                "sleep"
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
+#define OPTION_TIMERHEAP            "timerheap"
+#define OPTION_RUNAHEAD             "runahead"
+#define OPTION_NETPLAY              "netplay"
+#define OPTION_NETPLAY_DELAY        "netplay_delay"
+#define OPTION_NETPLAY_CHECK        "netplay_check"
+#define OPTION_CHD_READAHEAD        "chd_readahead"
+#define OPTION_TEXTURE_BUDGET       "texture_budget"
+#define OPTION_GFX_DECODE_BUDGET    "gfx_decode_budget"
+#define OPTION_DRC_CACHE_BUDGET     "drc_cache_budget"
+#define OPTION_ROM_INDEX            "rom_index"
+#define OPTION_HASH_CACHE           "hash_cache"
+#define OPTION_SOFTLIST_INDEX       "softlist_index"
+#define OPTION_INFO_CACHE           "info_cache"
+#define OPTION_BENCHLIST            "benchlist"
+#define OPTION_BENCHJSON            "benchjson"
+#define OPTION_BATCHLIST            "batchlist"
 
 // core render options
 #define OPTION_KEEPASPECT           "keepaspect"
@@ -120,7 +146,9 @@
 // core sound options
 #define OPTION_SAMPLERATE           "samplerate"
 #define OPTION_SAMPLES              "samples"
+#define OPTION_SAMPLES_ON_DEMAND    "samples_on_demand"
 #define OPTION_VOLUME               "volume"
+#define OPTION_SOUND_UPDATE_RATE    "sound_update_rate"
 
 // core input options
 #define OPTION_COIN_LOCKOUT         "coin_lockout"
@@ -139,6 +167,8 @@
 #define OPTION_NATURAL_KEYBOARD     "natural"
 #define OPTION_JOYSTICK_CONTRADICTORY   "joystick_contradictory"
 #define OPTION_COIN_IMPULSE         "coin_impulse"
+#define OPTION_LATE_LATCH           "latelatch"
+#define OPTION_LATENCY_MONITOR      "latency_monitor"
 
 // input autoenable options
 #define OPTION_PADDLE_DEVICE        "paddle_device"
@@ -157,12 +187,20 @@
 #define OPTION_OSLOG                "oslog"
 #define OPTION_UPDATEINPAUSE        "update_in_pause"
 #define OPTION_DEBUGSCRIPT          "debugscript"
+#define OPTION_MEMSTATS             "memstats"
+#define OPTION_PROFILE_TRACE        "profile_trace"
+#define OPTION_TELEMETRY            "telemetry"
+#define OPTION_STARTUP_PROFILE      "startup_profile"
+#define OPTION_MEMREPORT            "memreport"
 
 // core misc options
 #define OPTION_DRC                  "drc"
 #define OPTION_DRC_USE_C            "drc_use_c"
 #define OPTION_DRC_LOG_UML          "drc_log_uml"
 #define OPTION_DRC_LOG_NATIVE       "drc_log_native"
+#define OPTION_DRC_WARM_CACHE       "drc_warm_cache"
+#define OPTION_DRC_TIER_THRESHOLD   "drc_tier_threshold"
+#define OPTION_DRC_PROFILE          "drc_profile"
 #define OPTION_BIOS                 "bios"
 #define OPTION_CHEAT                "cheat"
 #define OPTION_SKIP_GAMEINFO        "skip_gameinfo"
@@ -241,6 +279,7 @@ public:
 	const char *snapshot_directory() const { return value(OPTION_SNAPSHOT_DIRECTORY); }
 	const char *diff_directory() const { return value(OPTION_DIFF_DIRECTORY); }
 	const char *comment_directory() const { return value(OPTION_COMMENT_DIRECTORY); }
+	const char *regioncache_directory() const { return value(OPTION_REGIONCACHE_DIRECTORY); }
 
 	// core state/playback options
 	const char *state() const { return value(OPTION_STATE); }
@@ -249,17 +288,26 @@ public:
 	const char *record() const { return value(OPTION_RECORD); }
 	bool record_timecode() const { return bool_value(OPTION_RECORD_TIMECODE); }
 	bool exit_after_playback() const { return bool_value(OPTION_EXIT_AFTER_PLAYBACK); }
+	bool record_keyframes() const { return bool_value(OPTION_RECORD_KEYFRAMES); }
+	int playback_seek() const { return int_value(OPTION_PLAYBACK_SEEK); }
 	const char *mng_write() const { return value(OPTION_MNGWRITE); }
 	const char *avi_write() const { return value(OPTION_AVIWRITE); }
 #ifdef MAME_DEBUG
 	bool dummy_write() const { return bool_value(OPTION_DUMMYWRITE); }
 #endif
 	const char *wav_write() const { return value(OPTION_WAVWRITE); }
+	const char *frame_hash() const { return value(OPTION_FRAMEHASH); }
+	const char *frame_hash_baseline() const { return value(OPTION_FRAMEHASH_BASELINE); }
+	int frame_hash_interval() const { return int_value(OPTION_FRAMEHASH_INTERVAL); }
 	const char *snap_name() const { return value(OPTION_SNAPNAME); }
 	const char *snap_size() const { return value(OPTION_SNAPSIZE); }
 	const char *snap_view() const { return value(OPTION_SNAPVIEW); }
 	bool snap_bilinear() const { return bool_value(OPTION_SNAPBILINEAR); }
+	int snap_compression() const { return int_value(OPTION_SNAPCOMPRESSION); }
 	const char *state_name() const { return value(OPTION_STATENAME); }
+	bool rewind() const { return bool_value(OPTION_REWIND); }
+	int rewind_interval() const { return int_value(OPTION_REWIND_INTERVAL); }
+	int rewind_capacity() const { return int_value(OPTION_REWIND_CAPACITY); }
 	bool burnin() const { return bool_value(OPTION_BURNIN); }
 
 	// core performance options
@@ -270,6 +318,22 @@ public:
 	bool sleep() const { return m_sleep; }
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return m_refresh_speed; }
+	bool timer_heap() const { return bool_value(OPTION_TIMERHEAP); }
+	int runahead() const { return int_value(OPTION_RUNAHEAD); }
+	const char *netplay() const { return value(OPTION_NETPLAY); }
+	int netplay_delay() const { return int_value(OPTION_NETPLAY_DELAY); }
+	int netplay_check() const { return int_value(OPTION_NETPLAY_CHECK); }
+	int chd_readahead() const { return int_value(OPTION_CHD_READAHEAD); }
+	int texture_budget() const { return int_value(OPTION_TEXTURE_BUDGET); }
+	int gfx_decode_budget() const { return int_value(OPTION_GFX_DECODE_BUDGET); }
+	int drc_cache_budget() const { return int_value(OPTION_DRC_CACHE_BUDGET); }
+	bool rom_index() const { return bool_value(OPTION_ROM_INDEX); }
+	bool hash_cache() const { return bool_value(OPTION_HASH_CACHE); }
+	bool softlist_index() const { return bool_value(OPTION_SOFTLIST_INDEX); }
+	bool info_cache() const { return bool_value(OPTION_INFO_CACHE); }
+	const char *bench_list() const { return value(OPTION_BENCHLIST); }
+	const char *bench_json() const { return value(OPTION_BENCHJSON); }
+	const char *batch_list() const { return value(OPTION_BATCHLIST); }
 
 	// core render options
 	bool keep_aspect() const { return bool_value(OPTION_KEEPASPECT); }
@@ -314,7 +378,9 @@ public:
 	// core sound options
 	int sample_rate() const { return int_value(OPTION_SAMPLERATE); }
 	bool samples() const { return bool_value(OPTION_SAMPLES); }
+	bool samples_on_demand() const { return bool_value(OPTION_SAMPLES_ON_DEMAND); }
 	int volume() const { return int_value(OPTION_VOLUME); }
+	int sound_update_rate() const { return int_value(OPTION_SOUND_UPDATE_RATE); }
 
 	// core input options
 	bool coin_lockout() const { return bool_value(OPTION_COIN_LOCKOUT); }
@@ -341,6 +407,8 @@ public:
 	bool natural_keyboard() const { return bool_value(OPTION_NATURAL_KEYBOARD); }
 	bool joystick_contradictory() const { return m_joystick_contradictory; }
 	int coin_impulse() const { return m_coin_impulse; }
+	bool late_latch() const { return bool_value(OPTION_LATE_LATCH); }
+	bool latency_monitor() const { return bool_value(OPTION_LATENCY_MONITOR); }
 
 	// core debugging options
 	bool log() const { return bool_value(OPTION_LOG); }
@@ -349,12 +417,20 @@ public:
 	bool oslog() const { return bool_value(OPTION_OSLOG); }
 	const char *debug_script() const { return value(OPTION_DEBUGSCRIPT); }
 	bool update_in_pause() const { return bool_value(OPTION_UPDATEINPAUSE); }
+	bool mem_stats() const { return bool_value(OPTION_MEMSTATS); }
+	const char *profile_trace() const { return value(OPTION_PROFILE_TRACE); }
+	bool telemetry() const { return bool_value(OPTION_TELEMETRY); }
+	bool startup_profile() const { return bool_value(OPTION_STARTUP_PROFILE); }
+	bool mem_report() const { return bool_value(OPTION_MEMREPORT); }
 
 	// core misc options
 	bool drc() const { return bool_value(OPTION_DRC); }
 	bool drc_use_c() const { return bool_value(OPTION_DRC_USE_C); }
 	bool drc_log_uml() const { return bool_value(OPTION_DRC_LOG_UML); }
 	bool drc_log_native() const { return bool_value(OPTION_DRC_LOG_NATIVE); }
+	bool drc_warm_cache() const { return bool_value(OPTION_DRC_WARM_CACHE); }
+	int drc_tier_threshold() const { return int_value(OPTION_DRC_TIER_THRESHOLD); }
+	bool drc_profile() const { return bool_value(OPTION_DRC_PROFILE); }
 	const char *bios() const { return value(OPTION_BIOS); }
 	bool cheat() const { return bool_value(OPTION_CHEAT); }
 	bool skip_gameinfo() const { return bool_value(OPTION_SKIP_GAMEINFO); }
@@ -38,6 +38,9 @@ palette_device::palette_device(const machine_config &mconfig, const char *tag, d
 		m_hilight_group(0),
 		m_white_pen(0),
 		m_black_pen(0),
+		m_pending_min(~0),
+		m_pending_max(0),
+		m_writes_pending(false),
 		m_init(palette_init_delegate())
 {
 }
@@ -112,6 +115,7 @@ void palette_device::set_indirect_color(int index, rgb_t rgb)
 {
 	// make sure we are in range
 	assert(index < m_indirect_entries);
+	flush_writes();
 
 	// alpha doesn't matter
 	rgb.set_a(255);
@@ -137,6 +141,7 @@ void palette_device::set_pen_indirect(pen_t pen, indirect_pen_t index)
 {
 	// make sure we are in range
 	assert(pen < m_entries && index < m_indirect_entries);
+	flush_writes();
 
 	m_indirect_pens[pen] = index;
 
@@ -284,8 +289,11 @@ void palette_device::set_shadow_dRGB32(int mode, int dr, int dg, int db, bool no
 
 //-------------------------------------------------
 //  update_for_write - given a write of a given
-//  length to a given byte offset, update all
-//  potentially modified palette entries
+//  length to a given byte offset, note all
+//  potentially modified palette entries; games
+//  often rewrite entries many times between
+//  screen updates, so the colors are converted
+//  once, when the palette is next read
 //-------------------------------------------------
 
 inline void palette_device::update_for_write(offs_t byte_offset, int bytes_modified, bool indirect)
@@ -297,15 +305,66 @@ inline void palette_device::update_for_write(offs_t byte_offset, int bytes_modif
 	assert(bpe != 0);
 	int count = (bytes_modified + bpe - 1) / bpe;
 
-	// for each entry modified, fetch the palette data and set the pen color or indirect color
+	// mark each entry pending
 	offs_t base = byte_offset / bpe;
-	for (int index = 0; index < count; index++)
+	if ((base + count + 31) / 32 > m_pending_dirty.size())
+		m_pending_dirty.resize((base + count + 31) / 32, 0);
+	for (int index = base; index < base + count; index++)
+		m_pending_dirty[index / 32] |= 1 << (index % 32);
+	m_pending_min = std::min<u32>(m_pending_min, base);
+	m_pending_max = std::max<u32>(m_pending_max, base + count - 1);
+	m_writes_pending = true;
+}
+
+
+//-------------------------------------------------
+//  apply_pending_writes - fetch the palette data
+//  for each pending entry and set the pen color
+//  or indirect color
+//-------------------------------------------------
+
+void palette_device::apply_pending_writes()
+{
+	// clear the flag first; the setters below check it
+	m_writes_pending = false;
+	bool indirect = (m_indirect_entries != 0);
+
+	// walk the bitmap a word at a time so that sparse writes stay cheap
+	bool indirect_changed = false;
+	for (u32 word = m_pending_min / 32; word <= m_pending_max / 32; word++)
 	{
-		if (indirect)
-			set_indirect_color(base + index, m_raw_to_rgb(read_entry(base + index)));
-		else
-			m_palette->entry_set_color(base + index, m_raw_to_rgb(read_entry(base + index)));
+		u32 bits = m_pending_dirty[word];
+		if (bits == 0)
+			continue;
+		m_pending_dirty[word] = 0;
+		for (u32 bit = 0; bits != 0; bit++, bits >>= 1)
+			if (bits & 1)
+			{
+				u32 index = word * 32 + bit;
+				rgb_t rgb = m_raw_to_rgb(read_entry(index));
+				if (!indirect)
+					m_palette->entry_set_color(index, rgb);
+				else
+				{
+					// collect indirect colors and resolve the pens once, below
+					assert(index < m_indirect_entries);
+					rgb.set_a(255);
+					if (m_indirect_colors[index] != rgb)
+					{
+						m_indirect_colors[index] = rgb;
+						indirect_changed = true;
+					}
+				}
+			}
 	}
+
+	// update the palette for any colortable entries that reference a changed color
+	if (indirect_changed)
+		for (u32 pen = 0; pen < m_indirect_pens.size(); pen++)
+			m_palette->entry_set_color(pen, m_indirect_colors[m_indirect_pens[pen]]);
+
+	m_pending_min = ~0;
+	m_pending_max = 0;
 }
 
 
@@ -519,6 +578,12 @@ void palette_device::device_pre_save()
 
 void palette_device::device_post_load()
 {
+	// the restored state supersedes any writes that were still pending
+	std::fill(m_pending_dirty.begin(), m_pending_dirty.end(), 0);
+	m_pending_min = ~0;
+	m_pending_max = 0;
+	m_writes_pending = false;
+
 	// reset the pen and brightness for each entry
 	int numcolors = m_palette->num_colors();
 	for (int index = 0; index < numcolors; index++)
@@ -381,11 +381,11 @@ public:
 	// getters
 	int entries() const { return m_entries; }
 	int indirect_entries() const { return m_indirect_entries; }
-	palette_t *palette() const { return m_palette; }
-	const pen_t &pen(int index) const { return m_pens[index]; }
-	const pen_t *pens() const { return m_pens; }
+	palette_t *palette() { flush_writes(); return m_palette; }
+	const pen_t &pen(int index) { flush_writes(); return m_pens[index]; }
+	const pen_t *pens() { flush_writes(); return m_pens; }
 	pen_t *shadow_table() const { return m_shadow_table; }
-	rgb_t pen_color(pen_t pen) { return m_palette->entry_color(pen); }
+	rgb_t pen_color(pen_t pen) { flush_writes(); return m_palette->entry_color(pen); }
 	double pen_contrast(pen_t pen) { return m_palette->entry_contrast(pen); }
 	pen_t black_pen() const { return m_black_pen; }
 	pen_t white_pen() const { return m_white_pen; }
@@ -404,18 +404,18 @@ public:
 	}
 
 	// setters
-	void set_pen_color(pen_t pen, rgb_t rgb) { m_palette->entry_set_color(pen, rgb); }
-	void set_pen_red_level(pen_t pen, u8 level) { m_palette->entry_set_red_level(pen, level); }
-	void set_pen_green_level(pen_t pen, u8 level) { m_palette->entry_set_green_level(pen, level); }
-	void set_pen_blue_level(pen_t pen, u8 level) { m_palette->entry_set_blue_level(pen, level); }
-	void set_pen_color(pen_t pen, u8 r, u8 g, u8 b) { m_palette->entry_set_color(pen, rgb_t(r, g, b)); }
+	void set_pen_color(pen_t pen, rgb_t rgb) { flush_writes(); m_palette->entry_set_color(pen, rgb); }
+	void set_pen_red_level(pen_t pen, u8 level) { flush_writes(); m_palette->entry_set_red_level(pen, level); }
+	void set_pen_green_level(pen_t pen, u8 level) { flush_writes(); m_palette->entry_set_green_level(pen, level); }
+	void set_pen_blue_level(pen_t pen, u8 level) { flush_writes(); m_palette->entry_set_blue_level(pen, level); }
+	void set_pen_color(pen_t pen, u8 r, u8 g, u8 b) { flush_writes(); m_palette->entry_set_color(pen, rgb_t(r, g, b)); }
 	void set_pen_colors(pen_t color_base, const rgb_t *colors, int color_count) { while (color_count--) set_pen_color(color_base++, *colors++); }
 	void set_pen_colors(pen_t color_base, const std::vector<rgb_t> &colors) { for(unsigned int i=0; i != colors.size(); i++) set_pen_color(color_base+i, colors[i]); }
-	void set_pen_contrast(pen_t pen, double bright) { m_palette->entry_set_contrast(pen, bright); }
+	void set_pen_contrast(pen_t pen, double bright) { flush_writes(); m_palette->entry_set_contrast(pen, bright); }
 
 	// indirection (aka colortables)
 	indirect_pen_t pen_indirect(int index) const { return m_indirect_pens[index]; }
-	rgb_t indirect_color(int index) const { return m_indirect_colors[index]; }
+	rgb_t indirect_color(int index) { flush_writes(); return m_indirect_colors[index]; }
 	void set_indirect_color(int index, rgb_t rgb);
 	void set_pen_indirect(pen_t pen, indirect_pen_t index);
 	u32 transpen_mask(gfx_element &gfx, u32 color, indirect_pen_t transcolor);
@@ -455,6 +455,10 @@ public:
 
 	// helper to update palette when data changed
 	void update() { if (!m_init.isnull()) m_init(*this); }
+
+	// paletteram writes are collected and applied in bulk on the next read of the
+	// palette, and by the screens before they draw
+	void flush_writes() { if (m_writes_pending) apply_pending_writes(); }
 protected:
 	// device-level overrides
 	virtual void device_validity_check(validity_checker &valid) const override;
@@ -468,6 +472,8 @@ protected:
 	void allocate_shadow_tables();
 
 	void update_for_write(offs_t byte_offset, int bytes_modified, bool indirect = false);
+	void apply_pending_writes();
+
 public: // needed by konamigx
 	void set_shadow_dRGB32(int mode, int dr, int dg, int db, bool noclip);
 protected:
@@ -513,6 +519,11 @@ private:
 	};
 	shadow_table_data   m_shadow_tables[MAX_SHADOW_PRESETS]; // array of shadow table data
 
+	std::vector<u32>    m_pending_dirty;        // bitmap of paletteram entries written since the last flush
+	u32                 m_pending_min;          // lowest pending entry
+	u32                 m_pending_max;          // highest pending entry
+	bool                m_writes_pending;       // true if any entries are pending
+
 	std::vector<pen_t> m_save_pen;           // pens for save/restore
 	std::vector<float> m_save_contrast;      // brightness for save/restore
 
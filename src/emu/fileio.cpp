@@ -156,6 +156,318 @@ const osd::directory::entry *file_enumerator::next()
 
 
 
+//**************************************************************************
+//  ARCHIVE INDEX
+//**************************************************************************
+
+//-------------------------------------------------
+//  instance - return the global archive index
+//-------------------------------------------------
+
+archive_index &archive_index::instance()
+{
+	static archive_index s_instance;
+	return s_instance;
+}
+
+
+//-------------------------------------------------
+//  load - read the index from the given search
+//  path and start using it; every archive is
+//  checked against the filesystem again the
+//  first time it's looked at after this
+//-------------------------------------------------
+
+void archive_index::load(const char *searchpath)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	// if we already have it, just force revalidation
+	if (m_enabled && m_searchpath == searchpath)
+	{
+		for (auto &entry : m_archives)
+			entry.second.m_validated = false;
+		return;
+	}
+
+	m_enabled = true;
+	m_dirty = false;
+	m_searchpath = searchpath;
+	m_archives.clear();
+
+	emu_file file(std::string(searchpath), OPEN_FLAG_READ);
+	if (file.open("romindex.idx") != osd_file::error::NONE)
+		return;
+
+	// one line per archive followed by one line per member
+	char line[1024];
+	archive *current = nullptr;
+	while (file.gets(line, ARRAY_LENGTH(line)) != nullptr)
+	{
+		std::string text(line);
+		while (!text.empty() && (text.back() == '\n' || text.back() == '\r'))
+			text.pop_back();
+
+		long long modified;
+		unsigned long long size;
+		unsigned crc;
+		int consumed;
+		if (sscanf(text.c_str(), "A %lld %llu %n", &modified, &size, &consumed) == 2 && consumed < text.length())
+		{
+			current = &m_archives[text.substr(consumed)];
+			current->m_exists = true;
+			current->m_validated = false;
+			current->m_modified = modified;
+			current->m_size = size;
+			current->m_members.clear();
+		}
+		else if (current != nullptr && sscanf(text.c_str(), "M %08x %n", &crc, &consumed) == 1 && consumed < text.length())
+			current->m_members.push_back(member{ text.substr(consumed), crc });
+	}
+}
+
+
+//-------------------------------------------------
+//  save - write the index back if it changed
+//-------------------------------------------------
+
+void archive_index::save()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!m_enabled || !m_dirty)
+		return;
+
+	emu_file file(std::string(m_searchpath), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open("romindex.idx") != osd_file::error::NONE)
+		return;
+
+	for (auto const &entry : m_archives)
+		if (entry.second.m_exists)
+		{
+			file.printf("A %d %d %s\n", (long long)entry.second.m_modified, (unsigned long long)entry.second.m_size, entry.first.c_str());
+			for (member const &m : entry.second.m_members)
+				file.printf("M %08x %s\n", m.m_crc, m.m_name.c_str());
+		}
+	m_dirty = false;
+}
+
+
+//-------------------------------------------------
+//  check - determine whether an archive might
+//  hold a file, rescanning it if it changed;
+//  if the archive had to be opened to rescan it,
+//  it is returned in opened
+//-------------------------------------------------
+
+archive_index::match archive_index::check(const std::string &archivepath, bool sevenzip, const std::string &filename, bool hascrc, u32 crc, util::archive_file::ptr &opened)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	archive &entry = m_archives[archivepath];
+
+	// the first time we see an archive in a run, compare it against the filesystem
+	if (!entry.m_validated)
+	{
+		entry.m_validated = true;
+		auto const stat = osd_stat(archivepath);
+		if (!stat || stat->type != osd::directory::entry::entry_type::FILE)
+		{
+			if (entry.m_exists)
+				m_dirty = true;
+			entry.m_exists = false;
+			entry.m_members.clear();
+		}
+		else
+		{
+			s64 const modified = std::chrono::duration_cast<std::chrono::seconds>(stat->last_modified.time_since_epoch()).count();
+			if (!entry.m_exists || entry.m_modified != modified || entry.m_size != stat->size)
+			{
+				entry.m_modified = modified;
+				entry.m_size = stat->size;
+				rescan(entry, archivepath, sevenzip, opened);
+			}
+		}
+	}
+	if (!entry.m_exists)
+		return match::MISSING;
+
+	// look for a matching CRC or name; archives match names case-insensitively
+	// and possibly by partial path, so only the final part of the name is compared
+	std::string const name = member_name(filename);
+	for (member const &m : entry.m_members)
+		if ((hascrc && m.m_crc == crc) || m.m_name == name)
+			return match::POSSIBLE;
+	return match::NONE;
+}
+
+
+//-------------------------------------------------
+//  member_name - reduce a name to its lowercase
+//  final path component
+//-------------------------------------------------
+
+std::string archive_index::member_name(const std::string &name)
+{
+	auto const sep = name.find_last_of("/\\");
+	std::string result((sep == std::string::npos) ? name : name.substr(sep + 1));
+	strmakelower(result);
+	return result;
+}
+
+
+//-------------------------------------------------
+//  rescan - list the files in an archive
+//-------------------------------------------------
+
+void archive_index::rescan(archive &entry, const std::string &archivepath, bool sevenzip, util::archive_file::ptr &opened)
+{
+	m_dirty = true;
+	entry.m_members.clear();
+
+	util::archive_file::ptr zip;
+	util::archive_file::error const ziperr = sevenzip ? util::archive_file::open_7z(archivepath, zip) : util::archive_file::open_zip(archivepath, zip);
+	entry.m_exists = (ziperr == util::archive_file::error::NONE);
+	if (!entry.m_exists)
+		return;
+
+	for (int header = zip->first_file(); header >= 0; header = zip->next_file())
+		if (!zip->current_is_directory())
+			entry.m_members.push_back(member{ member_name(zip->current_name()), zip->current_crc() });
+	opened = std::move(zip);
+}
+
+
+
+//**************************************************************************
+//  HASH CACHE
+//**************************************************************************
+
+//-------------------------------------------------
+//  instance - return the global hash cache
+//-------------------------------------------------
+
+hash_cache &hash_cache::instance()
+{
+	static hash_cache s_instance;
+	return s_instance;
+}
+
+
+//-------------------------------------------------
+//  load - read the cache from the given search
+//  path and start using it
+//-------------------------------------------------
+
+void hash_cache::load(const char *searchpath)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_enabled && m_searchpath == searchpath)
+		return;
+
+	m_enabled = true;
+	m_dirty = false;
+	m_searchpath = searchpath;
+	m_entries.clear();
+
+	emu_file file(std::string(searchpath), OPEN_FLAG_READ);
+	if (file.open("romhash.idx") != osd_file::error::NONE)
+		return;
+
+	// one line per file: time, size, hashes, then the key
+	char line[1024];
+	char hashes[256];
+	while (file.gets(line, ARRAY_LENGTH(line)) != nullptr)
+	{
+		std::string text(line);
+		while (!text.empty() && (text.back() == '\n' || text.back() == '\r'))
+			text.pop_back();
+
+		long long modified;
+		unsigned long long size;
+		int consumed;
+		if (sscanf(text.c_str(), "H %lld %llu %255s %n", &modified, &size, hashes, &consumed) == 3 && consumed < text.length())
+			m_entries[text.substr(consumed)] = entry{ modified, size, hashes };
+	}
+}
+
+
+//-------------------------------------------------
+//  save - write the cache back if it changed
+//-------------------------------------------------
+
+void hash_cache::save()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!m_enabled || !m_dirty)
+		return;
+
+	emu_file file(std::string(m_searchpath), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open("romhash.idx") != osd_file::error::NONE)
+		return;
+
+	for (auto const &e : m_entries)
+		file.printf("H %d %d %s %s\n", (long long)e.second.m_modified, (unsigned long long)e.second.m_size, e.second.m_hashes.c_str(), e.first.c_str());
+	m_dirty = false;
+}
+
+
+//-------------------------------------------------
+//  hashes - return the requested hashes of an
+//  open file, computing them only if the file
+//  (or the archive holding it) has changed
+//  since they were cached
+//-------------------------------------------------
+
+util::hash_collection hash_cache::hashes(emu_file &file, const char *types)
+{
+	if (!m_enabled)
+		return file.hashes(types);
+
+	// archive members are identified by the archive's time and size
+	bool const archived = !file.archive_path().empty();
+	std::string const &statpath = archived ? file.archive_path() : std::string(file.fullpath());
+	std::string key(statpath);
+	if (archived)
+		key.append(PATH_SEPARATOR).append(file.archive_member());
+
+	// files we can't stat (RAM files, for instance) are always hashed
+	auto const stat = osd_stat(statpath);
+	if (!stat || stat->type != osd::directory::entry::entry_type::FILE)
+		return file.hashes(types);
+	s64 const modified = std::chrono::duration_cast<std::chrono::seconds>(stat->last_modified.time_since_epoch()).count();
+
+	// use the cached hashes if nothing changed and they cover what's asked for
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto const found = m_entries.find(key);
+		if (found != m_entries.end() && found->second.m_modified == modified && found->second.m_size == stat->size)
+		{
+			util::hash_collection cached;
+			if (cached.from_internal_string(found->second.m_hashes.c_str()))
+			{
+				std::string const have = cached.hash_types();
+				bool complete = true;
+				for (char const *type = types; complete && *type != 0; type++)
+					complete = (have.find_first_of(*type) != std::string::npos);
+				if (complete)
+					return cached;
+			}
+		}
+	}
+
+	// compute outside the lock so several files can be hashed at once
+	util::hash_collection &computed = file.hashes(types);
+	std::string const text = computed.internal_string();
+	if (!text.empty())
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_entries[key] = entry{ modified, stat->size, text };
+		m_dirty = true;
+	}
+	return computed;
+}
+
+
+
 //**************************************************************************
 //  EMU FILE
 //**************************************************************************
@@ -172,6 +484,7 @@ emu_file::emu_file(u32 openflags)
 	, m_openflags(openflags)
 	, m_zipfile(nullptr)
 	, m_ziplength(0)
+	, m_zipdirect(false)
 	, m_remove_on_close(false)
 	, m_restrict_to_mediapath(false)
 {
@@ -188,6 +501,7 @@ emu_file::emu_file(std::string &&searchpath, u32 openflags)
 	, m_openflags(openflags)
 	, m_zipfile(nullptr)
 	, m_ziplength(0)
+	, m_zipdirect(false)
 	, m_remove_on_close(false)
 	, m_restrict_to_mediapath(false)
 {
@@ -392,6 +706,7 @@ void emu_file::close()
 	m_file.reset();
 
 	m_zipdata.clear();
+	m_zipdirect = false;
 
 	if (m_remove_on_close)
 		osd_file::remove(m_fullpath);
@@ -400,6 +715,8 @@ void emu_file::close()
 	// reset our hashes and path as well
 	m_hashes.reset();
 	m_fullpath.clear();
+	m_archivepath.clear();
+	m_archivemember.clear();
 }
 
 
@@ -426,6 +743,12 @@ bool emu_file::compressed_file_ready(void)
 	if (m_zipfile && (load_zipped_file() != osd_file::error::NONE))
 		return true;
 
+	// if the data was already read directly, carry on from the end
+	if (m_zipdirect && m_file)
+	{
+		m_file->seek(0, SEEK_END);
+		m_zipdirect = false;
+	}
 	return false;
 }
 
@@ -519,6 +842,54 @@ u32 emu_file::read(void *buffer, u32 length)
 }
 
 
+//-------------------------------------------------
+//  read_direct - read a whole file from the
+//  start straight into the caller's buffer and
+//  compute the given hashes over it there; an
+//  archive member that hasn't been loaded yet is
+//  decompressed into the buffer without keeping
+//  a copy; returns false if the file has been
+//  read from or doesn't fit, so the caller can
+//  read it normally
+//-------------------------------------------------
+
+bool emu_file::read_direct(void *buffer, u32 length, const char *types, u32 &actual)
+{
+	actual = 0;
+	if (m_zipfile && !m_file)
+	{
+		if (m_zipdirect || (length < m_ziplength))
+			return false;
+
+		// if it won't decompress, there's nothing to hash either
+		if (m_zipfile->decompress(buffer, m_ziplength) != util::archive_file::error::NONE)
+		{
+			m_zipfile.reset();
+			m_hashes.reset();
+			return true;
+		}
+		actual = m_ziplength;
+		m_zipdirect = true;
+	}
+	else
+	{
+		if (!m_file || (m_file->tell() != 0) || (length < m_file->size()))
+			return false;
+		actual = m_file->read(buffer, length);
+	}
+
+	// compute whatever hashes we don't have yet
+	std::string const already_have = m_hashes.hash_types();
+	std::string needed;
+	for (const char *scan = types; *scan != 0; scan++)
+		if (already_have.find_first_of(*scan) == std::string::npos)
+			needed.push_back(*scan);
+	if (!needed.empty())
+		m_hashes.compute(reinterpret_cast<const u8 *>(buffer), actual, needed.c_str());
+	return true;
+}
+
+
 //-------------------------------------------------
 //  getc - read a character from a file
 //-------------------------------------------------
@@ -675,11 +1046,23 @@ osd_file::error emu_file::attempt_zipped()
 			m_fullpath.resize(dirsep);
 			m_fullpath.append(suffixes[i]);
 
-			// attempt to open the archive file
+			// ask the index first so we don't open archives that can't hold the file
 			util::archive_file::ptr zip;
-			util::archive_file::error ziperr = open_funcs[i](m_fullpath, zip);
+			util::archive_file::error ziperr = util::archive_file::error::NONE;
+			archive_index &index = archive_index::instance();
+			if (index.enabled())
+			{
+				archive_index::match const found = index.check(m_fullpath, open_funcs[i] == &util::archive_file::open_7z, filename, (m_openflags & OPEN_FLAG_HAS_CRC) != 0, m_crc, zip);
+				if (found != archive_index::match::POSSIBLE)
+					ziperr = util::archive_file::error::FILE_ERROR;
+			}
+
+			// attempt to open the archive file
+			if (ziperr == util::archive_file::error::NONE && !zip)
+				ziperr = open_funcs[i](m_fullpath, zip);
 
 			// chop the archive suffix back off the filename before continuing
+			std::string const archivepath(m_fullpath);
 			m_fullpath = m_fullpath.substr(0, dirsep);
 
 			// if we failed to open this file, continue scanning
@@ -705,6 +1088,8 @@ osd_file::error emu_file::attempt_zipped()
 			{
 				m_zipfile = std::move(zip);
 				m_ziplength = m_zipfile->current_uncompressed_length();
+				m_archivepath = archivepath;
+				m_archivemember = m_zipfile->current_name();
 
 				// build a hash with just the CRC
 				m_hashes.reset();
@@ -737,7 +1122,9 @@ osd_file::error emu_file::load_zipped_file()
 	auto const ziperr = m_zipfile->decompress(&m_zipdata[0], m_zipdata.size());
 	if (ziperr != util::archive_file::error::NONE)
 	{
+		// don't vouch for the CRC from the directory when the data is bad
 		m_zipdata.clear();
+		m_hashes.reset();
 		return osd_file::error::FAILURE;
 	}
 
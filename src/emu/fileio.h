@@ -16,6 +16,9 @@
 #include "corefile.h"
 #include "hash.h"
 
+#include <mutex>
+#include <unordered_map>
+
 // some systems use macros for getc/putc rather than functions
 #ifdef getc
 #undef getc
@@ -27,6 +30,7 @@
 
 // forward declarations
 namespace util { class archive_file; }
+class emu_file;
 
 // ======================> path_iterator
 
@@ -82,6 +86,113 @@ private:
 
 
 
+// ======================> archive_index
+
+// persistent index of archive contents, used to skip opening archives that
+// can't hold the file being looked for
+class archive_index
+{
+public:
+	// result of a lookup
+	enum class match
+	{
+		MISSING,            // archive doesn't exist
+		NONE,               // archive exists but holds nothing with this name or CRC
+		POSSIBLE            // archive may hold the file; open it to find out
+	};
+
+	// global instance
+	static archive_index &instance();
+
+	// getters
+	bool enabled() const { return m_enabled; }
+
+	// load/save
+	void load(const char *searchpath);
+	void save();
+
+	// lookups
+	match check(const std::string &archivepath, bool sevenzip, const std::string &filename, bool hascrc, u32 crc, std::unique_ptr<util::archive_file> &opened);
+
+private:
+	// a member of an archive
+	struct member
+	{
+		std::string         m_name;                 // lowercase name without directories
+		u32                 m_crc;                  // CRC-32
+	};
+
+	// an indexed archive
+	struct archive
+	{
+		archive() : m_exists(false), m_validated(false), m_modified(0), m_size(0) { }
+
+		bool                m_exists;               // did the archive exist when last checked?
+		bool                m_validated;            // checked against the filesystem this run?
+		s64                 m_modified;             // last modified time when indexed
+		u64                 m_size;                 // file size when indexed
+		std::vector<member> m_members;              // files in the archive
+	};
+
+	// construction
+	archive_index() : m_enabled(false), m_dirty(false) { }
+
+	// internal helpers
+	static std::string member_name(const std::string &name);
+	void rescan(archive &entry, const std::string &archivepath, bool sevenzip, std::unique_ptr<util::archive_file> &opened);
+
+	// internal state
+	bool                m_enabled;                  // has an index been loaded?
+	bool                m_dirty;                    // changed since loading?
+	std::string         m_searchpath;               // where the index lives
+	std::mutex          m_mutex;                    // protects the map
+	std::unordered_map<std::string, archive> m_archives; // archives by full path
+};
+
+
+
+// ======================> hash_cache
+
+// persistent cache of file hashes, used to skip hashing files that haven't
+// changed since they were last loaded
+class hash_cache
+{
+public:
+	// global instance
+	static hash_cache &instance();
+
+	// getters
+	bool enabled() const { return m_enabled; }
+
+	// load/save
+	void load(const char *searchpath);
+	void save();
+
+	// lookups
+	util::hash_collection hashes(emu_file &file, const char *types);
+
+private:
+	// a cached file
+	struct entry
+	{
+		s64                 m_modified;             // last modified time when hashed
+		u64                 m_size;                 // file or archive size when hashed
+		std::string         m_hashes;               // hashes in internal string form
+	};
+
+	// construction
+	hash_cache() : m_enabled(false), m_dirty(false) { }
+
+	// internal state
+	bool                m_enabled;                  // has a cache been loaded?
+	bool                m_dirty;                    // changed since loading?
+	std::string         m_searchpath;               // where the cache lives
+	std::mutex          m_mutex;                    // protects the map
+	std::unordered_map<std::string, entry> m_entries; // files by full path, or archive path and member name
+};
+
+
+
 // ======================> emu_file
 
 class emu_file
@@ -99,6 +210,8 @@ public:
 	const char *fullpath() const { return m_fullpath.c_str(); }
 	u32 openflags() const { return m_openflags; }
 	util::hash_collection &hashes(const char *types);
+	const std::string &archive_path() const { return m_archivepath; }
+	const std::string &archive_member() const { return m_archivemember; }
 	bool restrict_to_mediapath() const { return m_restrict_to_mediapath; }
 	bool part_of_mediapath(std::string path);
 
@@ -131,6 +244,7 @@ public:
 
 	// reading
 	u32 read(void *buffer, u32 length);
+	bool read_direct(void *buffer, u32 length, const char *types, u32 &actual);
 	int getc();
 	int ungetc(int c);
 	char *gets(char *s, int n);
@@ -167,6 +281,9 @@ private:
 	std::unique_ptr<util::archive_file> m_zipfile;  // ZIP file pointer
 	std::vector<u8>         m_zipdata;               // ZIP file data
 	u64                     m_ziplength;             // ZIP file length
+	bool                    m_zipdirect;             // ZIP data went straight to a caller's buffer
+	std::string             m_archivepath;           // path of the archive the file came from
+	std::string             m_archivemember;         // name of the file within that archive
 
 	bool                    m_remove_on_close;       // flag: remove the file when closing
 	bool                    m_restrict_to_mediapath; // flag: restrict to paths inside the media-path
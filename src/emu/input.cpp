@@ -558,6 +558,7 @@ void input_seq::replace(input_code oldcode, input_code newcode)
 
 input_manager::input_manager(running_machine &machine)
 	: m_machine(machine),
+		m_switch_batch(false),
 		m_poll_seq_last_ticks(0),
 		m_poll_seq_class(ITEM_CLASS_SWITCH)
 {
@@ -1238,11 +1239,11 @@ bool input_manager::seq_pressed(const input_seq &seq)
 		{
 			// if this is the first in the sequence, result is set equal
 			if (first)
-				result = code_pressed(code) ^ invert;
+				result = switch_pressed(code) ^ invert;
 
 			// further values are ANDed
 			else if (result)
-				result &= code_pressed(code) ^ invert;
+				result &= switch_pressed(code) ^ invert;
 
 			// no longer first, and clear the invert flag
 			first = invert = false;
@@ -1254,6 +1255,28 @@ bool input_manager::seq_pressed(const input_seq &seq)
 }
 
 
+//-------------------------------------------------
+//  switch_pressed - return true if the given
+//  switch is pressed; while a batch is active,
+//  each distinct code is only read once, since
+//  many sequences share modifiers like Shift
+//-------------------------------------------------
+
+bool input_manager::switch_pressed(input_code code)
+{
+	if (!m_switch_batch)
+		return code_pressed(code);
+
+	for (auto &entry : m_switch_cache)
+		if (entry.first == code)
+			return entry.second;
+
+	bool pressed = code_pressed(code);
+	m_switch_cache.emplace_back(code, pressed);
+	return pressed;
+}
+
+
 //-------------------------------------------------
 //  seq_axis_value - return the value of an axis
 //  defined in an input sequence
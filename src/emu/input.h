@@ -480,6 +480,8 @@ public:
 
 	// input sequence readers
 	bool seq_pressed(const input_seq &seq);
+	void begin_switch_batch() { m_switch_batch = true; m_switch_cache.clear(); }
+	void end_switch_batch() { m_switch_batch = false; }
 	s32 seq_axis_value(const input_seq &seq, input_item_class &itemclass);
 
 	// input sequence polling
@@ -498,12 +500,17 @@ public:
 private:
 	// internal helpers
 	void reset_memory();
+	bool switch_pressed(input_code code);
 	bool code_check_axis(input_device_item &item, input_code code);
 
 	// internal state
 	running_machine &   m_machine;
 	input_code          m_switch_memory[64];
 
+	// switch states read since begin_switch_batch()
+	bool                m_switch_batch;
+	std::vector<std::pair<input_code, bool>> m_switch_cache;
+
 	// classes
 	std::array<std::unique_ptr<input_class>, DEVICE_CLASS_MAXIMUM> m_class;
 
@@ -98,6 +98,7 @@
 #include "ui/uimain.h"
 #include "inputdev.h"
 #include "natkeyboard.h"
+#include "network.h"
 
 #include "osdepend.h"
 
@@ -118,6 +119,14 @@ namespace {
 
 const int SPACE_COUNT = 3;
 
+// frames between self-contained keyframes in INP files
+const u32 INP_KEYFRAME_INTERVAL = 3600;
+
+// record types in INP files
+const u8 INP_RECORD_KEYFRAME = 'K';     // frame number, time, speed and all port data
+const u8 INP_RECORD_DELTA = 'D';        // changes to the port data since the previous frame
+const u8 INP_RECORD_REPEAT = 'R';       // number of frames with unchanged port data
+
 
 
 //**************************************************************************
@@ -1200,6 +1209,26 @@ void ioport_field::frame_update(ioport_value &result)
 }
 
 
+//-------------------------------------------------
+//  can_late_latch - return true if the field's
+//  state depends only on its input sequence, so
+//  it can be re-read between frame updates
+//-------------------------------------------------
+
+bool ioport_field::can_late_latch() const
+{
+	// analog inputs and anything with per-frame state must be updated once/frame
+	if (m_live->analog != nullptr || m_live->joystick != nullptr || m_live->lockout || m_live->autofire || m_live->toggle)
+		return false;
+
+	// impulse timers count frames, and coins are subject to lockout and the coin impulse option
+	if (m_impulse != 0 || (m_type >= IPT_COIN1 && m_type <= IPT_COIN12))
+		return false;
+
+	return true;
+}
+
+
 //-------------------------------------------------
 //  crosshair_position - compute the crosshair
 //  position
@@ -1479,6 +1508,29 @@ ioport_value ioport_port::read()
 {
 	assert_always(manager().safe_to_read(), "Input ports cannot be read at init time!");
 
+	// the first read after a change stops the latency monitor's clock
+	if (m_live->latency_event != 0)
+	{
+		manager().latency_monitor()->port_read(m_live->latency_event, machine().time());
+		m_live->latency_event = 0;
+	}
+
+	// re-sample late-latched fields if it's been long enough since the last time
+	if (!m_live->latelist.empty())
+	{
+		osd_ticks_t curtime = osd_ticks();
+		if (curtime - m_live->latched >= osd_ticks_per_second() / 1000)
+		{
+			m_live->latched = curtime;
+			for (ioport_field *field : m_live->latelist)
+			{
+				m_live->digital &= ~field->mask();
+				if (field->digital_value() || machine().input().seq_pressed(field->seq()))
+					m_live->digital |= field->mask();
+			}
+		}
+	}
+
 	// start with the digital state
 	ioport_value result = m_live->digital;
 
@@ -1523,6 +1575,16 @@ void ioport_port::frame_update()
 	// now loop back and modify based on the inputs
 	for (ioport_field &field : fields())
 		field.frame_update(m_live->digital);
+
+	// collect the fields that can be re-read when the port is read
+	m_live->latelist.clear();
+	if (manager().late_latch() && !machine().ui().is_menu_active())
+	{
+		for (ioport_field &field : fields())
+			if (field.enabled() && field.can_late_latch())
+				m_live->latelist.push_back(&field);
+		m_live->latched = osd_ticks();
+	}
 }
 
 
@@ -1641,7 +1703,9 @@ void ioport_port::update_defvalue(bool flush_defaults)
 ioport_port_live::ioport_port_live(ioport_port &port)
 	: defvalue(0),
 		digital(0),
-		outputvalue(0)
+		outputvalue(0),
+		latched(0),
+		latency_event(0)
 {
 	// iterate over fields
 	for (ioport_field &field : port.fields())
@@ -1666,6 +1730,157 @@ ioport_port_live::ioport_port_live(ioport_port &port)
 
 
 
+//**************************************************************************
+//  INPUT LATENCY MONITOR
+//**************************************************************************
+
+//-------------------------------------------------
+//  input_latency_monitor - constructor
+//-------------------------------------------------
+
+input_latency_monitor::input_latency_monitor()
+	: m_stage(stage::IDLE),
+		m_event(0),
+		m_input_ticks(0),
+		m_read_ticks(0),
+		m_input_time(attotime::zero),
+		m_overlapped(0)
+{
+}
+
+
+//-------------------------------------------------
+//  input_changed - start timing a digital input
+//  change, returning the event number to attach
+//  to the port, or 0 if one is already underway
+//-------------------------------------------------
+
+u32 input_latency_monitor::input_changed(const attotime &emutime)
+{
+	// only time one change at a time so each stage is unambiguous
+	if (m_stage != stage::IDLE)
+	{
+		m_overlapped++;
+		return 0;
+	}
+
+	m_stage = stage::READ;
+	if (++m_event == 0)
+		m_event = 1;
+	m_input_ticks = osd_ticks();
+	m_input_time = emutime;
+	return m_event;
+}
+
+
+//-------------------------------------------------
+//  port_read - the game has read a port that
+//  changed
+//-------------------------------------------------
+
+void input_latency_monitor::port_read(u32 event, const attotime &emutime)
+{
+	if (m_stage != stage::READ || event != m_event)
+		return;
+
+	m_read_ticks = osd_ticks();
+	m_to_read.add(m_read_ticks - m_input_ticks);
+	m_emulated.add((emutime - m_input_time).as_attoseconds() / (ATTOSECONDS_PER_SECOND / osd_ticks_per_second()));
+	m_stage = stage::PRESENT;
+}
+
+
+//-------------------------------------------------
+//  frame_presented - the OSD has presented a
+//  frame
+//-------------------------------------------------
+
+void input_latency_monitor::frame_presented()
+{
+	if (m_stage != stage::PRESENT)
+		return;
+
+	osd_ticks_t const current = osd_ticks();
+	m_to_present.add(current - m_read_ticks);
+	m_total.add(current - m_input_ticks);
+	m_stage = stage::IDLE;
+}
+
+
+//-------------------------------------------------
+//  report - print the histograms
+//-------------------------------------------------
+
+void input_latency_monitor::report() const
+{
+	osd_printf_info("Input latency (%u changes, %u overlapping ignored):\n", m_total.samples, m_overlapped);
+	m_emulated.report("change to read (emulated)");
+	m_to_read.report("change to read");
+	m_to_present.report("read to present");
+	m_total.report("change to present");
+}
+
+
+//-------------------------------------------------
+//  histogram::add - add a sample in host ticks
+//-------------------------------------------------
+
+void input_latency_monitor::histogram::add(osd_ticks_t ticks)
+{
+	osd_ticks_t const bucket = ticks * 1000 / osd_ticks_per_second();
+	counts[std::min<osd_ticks_t>(bucket, BUCKETS - 1)]++;
+	samples++;
+}
+
+
+//-------------------------------------------------
+//  histogram::percentile - return the latency in
+//  milliseconds below which the given percentage
+//  of samples fell
+//-------------------------------------------------
+
+u32 input_latency_monitor::histogram::percentile(u32 percent) const
+{
+	u64 const threshold = (u64(samples) * percent + 99) / 100;
+	u64 total = 0;
+	for (u32 bucket = 0; bucket < BUCKETS; bucket++)
+	{
+		total += counts[bucket];
+		if (total >= threshold)
+			return bucket;
+	}
+	return BUCKETS - 1;
+}
+
+
+//-------------------------------------------------
+//  histogram::report - print a summary line and
+//  the non-empty buckets
+//-------------------------------------------------
+
+void input_latency_monitor::histogram::report(const char *name) const
+{
+	if (samples == 0)
+	{
+		osd_printf_info("  %-26s no samples\n", name);
+		return;
+	}
+
+	u32 longest = BUCKETS - 1;
+	while (longest > 0 && counts[longest] == 0)
+		longest--;
+	osd_printf_info("  %-26s median %u ms, 99th percentile %u ms, longest %s%u ms\n",
+			name, percentile(50), percentile(99), (longest == BUCKETS - 1) ? ">=" : "", longest);
+
+	std::string buckets;
+	for (u32 bucket = 0; bucket <= longest; bucket++)
+		if (counts[bucket] != 0)
+			buckets.append(string_format(" %u:%u", bucket, counts[bucket]));
+	osd_printf_info("   ms:count%s\n", buckets.c_str());
+}
+
+
+
 //**************************************************************************
 //  I/O PORT MANAGER
 //**************************************************************************
@@ -1677,12 +1892,24 @@ ioport_port_live::ioport_port_live(ioport_port &port)
 ioport_manager::ioport_manager(running_machine &machine)
 	: m_machine(machine),
 		m_safe_to_read(false),
+		m_netplay(nullptr),
 		m_last_frame_time(attotime::zero),
 		m_last_delta_nsec(0),
 		m_record_file(machine.options().input_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS),
 		m_playback_file(machine.options().input_directory(), OPEN_FLAG_READ),
 		m_playback_accumulated_speed(0),
 		m_playback_accumulated_frames(0),
+		m_playback_compact(false),
+		m_playback_offset(0),
+		m_playback_repeats(0),
+		m_playback_speed(0),
+		m_playback_frame(0),
+		m_playback_seek_frame(0),
+		m_record_time(attotime::zero),
+		m_record_speed(0),
+		m_record_repeats(0),
+		m_record_frame(0),
+		m_record_state_frame(~u64(0)),
 		m_timecode_file(machine.options().input_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS),
 		m_timecode_count(0),
 		m_timecode_last_time(attotime::zero),
@@ -1704,6 +1931,10 @@ time_t ioport_manager::initialize()
 	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&ioport_manager::exit, this));
 	machine().add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&ioport_manager::frame_update_callback, this));
 
+	// time input changes if requested
+	if (machine().options().latency_monitor())
+		m_latency = std::make_unique<input_latency_monitor>();
+
 	// initialize the default port info from the OSD
 	init_port_types();
 
@@ -1855,6 +2086,10 @@ void ioport_manager::exit()
 	playback_end();
 	record_end();
 	timecode_end();
+
+	// report input latency
+	if (m_latency)
+		m_latency->report();
 }
 
 
@@ -1920,6 +2155,19 @@ const input_seq &ioport_manager::type_seq(ioport_type type, int player, input_se
 }
 
 
+//-------------------------------------------------
+//  late_latch - return true if simple digital
+//  inputs should be re-read when ports are read;
+//  this is never done when the input stream must
+//  be reproducible
+//-------------------------------------------------
+
+bool ioport_manager::late_latch() const
+{
+	return machine().options().late_latch() && !is_recording() && !is_playing() && m_netplay == nullptr;
+}
+
+
 //-------------------------------------------------
 //  set_type_seq - change the input sequence for
 //  the given type/player
@@ -2042,11 +2290,16 @@ g_profiler.start(PROFILER_INPUT);
 	attotime curtime = machine().time();
 	playback_frame(curtime);
 	record_frame(curtime);
+	if (m_netplay != nullptr)
+		m_netplay->begin_frame();
 
 	// track the duration of the previous frame
 	m_last_delta_nsec = (curtime - m_last_frame_time).as_attoseconds() / ATTOSECONDS_PER_NANOSECOND;
 	m_last_frame_time = curtime;
 
+	// sample each switch once for the joysticks and fields below
+	machine().input().begin_switch_batch();
+
 	// update the digital joysticks
 	for (digital_joystick &joystick : m_joystick_list)
 		joystick.frame_update();
@@ -2061,8 +2314,13 @@ g_profiler.start(PROFILER_INPUT);
 	// loop over all input ports
 	for (auto &port : m_portlist)
 	{
+		ioport_value const previous = port.second->live().digital;
 		port.second->frame_update();
 
+		// swap in the input agreed with a netplay peer
+		if (m_netplay != nullptr)
+			m_netplay->update_port(*port.second.get());
+
 		// handle playback/record
 		playback_port(*port.second.get());
 		record_port(*port.second.get());
@@ -2072,7 +2330,16 @@ g_profiler.start(PROFILER_INPUT);
 		for (dynamic_field &dynfield : port.second->live().writelist)
 			if (dynfield.field().type() != IPT_OUTPUT)
 				dynfield.write(newvalue);
+
+		// start timing digital changes once the port has settled for this frame
+		if (m_latency && port.second->live().digital != previous)
+			port.second->live().latency_event = m_latency->input_changed(curtime);
 	}
+	machine().input().end_switch_batch();
+	record_commit();
+
+	if (m_netplay != nullptr)
+		m_netplay->end_frame();
 
 g_profiler.stop();
 }
@@ -2530,6 +2797,33 @@ bool ioport_manager::playback_read<bool>(bool &result)
 }
 
 
+//-------------------------------------------------
+//  playback_value - read a port value for the
+//  current frame
+//-------------------------------------------------
+
+template<typename _Type>
+void ioport_manager::playback_value(_Type &result)
+{
+	// older files store every value directly in the stream
+	if (!m_playback_compact)
+	{
+		playback_read(result);
+		return;
+	}
+
+	// otherwise take the little-endian bytes from the current frame's data
+	u64 value = 0;
+	for (unsigned byte = 0; byte < sizeof(result); byte++)
+	{
+		if (m_playback_offset < m_playback_data.size())
+			value |= u64(m_playback_data[m_playback_offset]) << (byte * 8);
+		m_playback_offset++;
+	}
+	result = _Type(value);
+}
+
+
 //-------------------------------------------------
 //  playback_init - initialize INP playback
 //-------------------------------------------------
@@ -2551,8 +2845,9 @@ time_t ioport_manager::playback_init()
 		fatalerror("Input file is corrupt or invalid (missing header)\n");
 	if (!header.check_magic())
 		fatalerror("Input file invalid or in an older, unsupported format\n");
-	if (header.get_majversion() != inp_header::MAJVERSION)
+	if (header.get_majversion() != inp_header::MAJVERSION && header.get_majversion() != inp_header::MAJVERSION_FULL)
 		fatalerror("Input file format version mismatch\n");
+	m_playback_compact = (header.get_majversion() == inp_header::MAJVERSION);
 
 	// output info to console
 	osd_printf_info("Input file: %s\n", filename);
@@ -2568,6 +2863,15 @@ time_t ioport_manager::playback_init()
 
 	// enable compression
 	m_playback_file.compress(FCOMPRESS_MEDIUM);
+
+	// seeking relies on keyframes
+	if (machine().options().playback_seek() > 0)
+	{
+		if (m_playback_compact)
+			m_playback_seek_frame = machine().options().playback_seek();
+		else
+			osd_printf_warning("Input file has no keyframes, ignoring -%s\n", OPTION_PLAYBACK_SEEK);
+	}
 	return basetime;
 }
 
@@ -2610,8 +2914,32 @@ void ioport_manager::playback_end(const char *message)
 
 void ioport_manager::playback_frame(const attotime &curtime)
 {
+	// skip ahead before the first frame if asked to
+	if (m_playback_seek_frame != 0)
+	{
+		playback_seek(m_playback_seek_frame);
+		m_playback_seek_frame = 0;
+	}
+
+	// compact files only store changes, with the time and speed at keyframes
+	if (m_playback_compact)
+	{
+		if (!m_playback_file.is_open())
+			return;
+		if (m_playback_repeats != 0)
+		{
+			m_playback_repeats--;
+			m_playback_frame++;
+		}
+		else
+			playback_record(&curtime);
+		m_playback_offset = 0;
+		m_playback_accumulated_speed += m_playback_speed;
+		m_playback_accumulated_frames++;
+	}
+
 	// if playing back, fetch the information and verify
-	if (m_playback_file.is_open())
+	else if (m_playback_file.is_open())
 	{
 		// first the absolute time
 		seconds_t seconds_temp;
@@ -2630,6 +2958,112 @@ void ioport_manager::playback_frame(const attotime &curtime)
 }
 
 
+//-------------------------------------------------
+//  playback_record - read the next record from a
+//  compact file, verifying keyframe times against
+//  curtime if given; returns true for keyframes
+//-------------------------------------------------
+
+bool ioport_manager::playback_record(const attotime *curtime)
+{
+	u8 type;
+	playback_read(type);
+	if (!m_playback_file.is_open())
+		return false;
+
+	switch (type)
+	{
+	case INP_RECORD_KEYFRAME:
+		{
+			u64 frame;
+			seconds_t seconds_temp;
+			attoseconds_t attoseconds_temp;
+			u32 size;
+			m_playback_frame = playback_read(frame);
+			playback_read(seconds_temp);
+			playback_read(attoseconds_temp);
+			playback_read(m_playback_speed);
+			playback_read(size);
+			m_playback_data.resize(size);
+			if (m_playback_file.is_open() && m_playback_file.read(m_playback_data.data(), size) != size)
+				playback_end("End of file");
+			else if (curtime != nullptr && attotime(seconds_temp, attoseconds_temp) != *curtime)
+				playback_end("Out of sync");
+			return true;
+		}
+
+	case INP_RECORD_DELTA:
+		{
+			u32 size;
+			playback_read(size);
+			m_playback_delta.resize(size);
+			if (m_playback_file.is_open() && m_playback_file.read(m_playback_delta.data(), size) != size)
+				playback_end("End of file");
+			else if (!save_manager::apply_delta(m_playback_data, m_playback_delta))
+				playback_end("Input file is corrupt");
+			m_playback_frame++;
+			return false;
+		}
+
+	case INP_RECORD_REPEAT:
+		{
+			u32 count;
+			playback_read(count);
+			if (count == 0)
+				playback_end("Input file is corrupt");
+			else
+				m_playback_repeats = count - 1;
+			m_playback_frame++;
+			return false;
+		}
+
+	default:
+		playback_end("Input file is corrupt");
+		return false;
+	}
+}
+
+
+//-------------------------------------------------
+//  playback_seek - load the latest keyframe state
+//  at or before the given frame and skip the
+//  input file forward to match it
+//-------------------------------------------------
+
+void ioport_manager::playback_seek(u64 frame)
+{
+	// find the latest keyframe that has a saved state
+	u64 keyframe = frame - (frame % INP_KEYFRAME_INTERVAL);
+	std::string name;
+	for ( ; keyframe != 0; keyframe -= INP_KEYFRAME_INTERVAL)
+	{
+		name = keyframe_state_name(machine().options().playback(), keyframe);
+		const char *searchpath;
+		std::string const path = machine().compose_saveload_filename(name.c_str(), &searchpath);
+		emu_file file(searchpath, OPEN_FLAG_READ);
+		if (file.open(path.c_str()) == osd_file::error::NONE)
+			break;
+	}
+	if (keyframe == 0)
+	{
+		osd_printf_warning("No keyframe state found at or before frame %u, playing from the start\n", unsigned(frame));
+		return;
+	}
+
+	// read forward to the keyframe, then have its state loaded once this frame is done
+	while (m_playback_file.is_open())
+	{
+		if (playback_record(nullptr) && m_playback_frame == keyframe)
+		{
+			osd_printf_info("Seeking to keyframe at frame %u\n", unsigned(keyframe));
+			m_playback_repeats = 0;
+			machine().schedule_load(name.c_str());
+			return;
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  playback_port - per-port callback for playback
 //-------------------------------------------------
@@ -2640,19 +3074,19 @@ void ioport_manager::playback_port(ioport_port &port)
 	if (m_playback_file.is_open())
 	{
 		// read the default value and the digital state
-		playback_read(port.live().defvalue);
-		playback_read(port.live().digital);
+		playback_value(port.live().defvalue);
+		playback_value(port.live().digital);
 
 		// loop over analog ports and save their data
 		for (analog_field &analog : port.live().analoglist)
 		{
 			// read current and previous values
-			playback_read(analog.m_accum);
-			playback_read(analog.m_previous);
+			playback_value(analog.m_accum);
+			playback_value(analog.m_previous);
 
 			// read configuration information
-			playback_read(analog.m_sensitivity);
-			playback_read(analog.m_reverse);
+			playback_value(analog.m_sensitivity);
+			playback_value(analog.m_reverse);
 		}
 	}
 }
@@ -2681,6 +3115,20 @@ void ioport_manager::record_write<bool>(bool value)
 	record_write(byte);
 }
 
+
+//-------------------------------------------------
+//  record_value - add a port value to the data
+//  for the current frame
+//-------------------------------------------------
+
+template<typename _Type>
+void ioport_manager::record_value(_Type value)
+{
+	u64 const bits = u64(value);
+	for (unsigned byte = 0; byte < sizeof(value); byte++)
+		m_record_data.push_back(u8(bits >> (byte * 8)));
+}
+
 template<typename _Type>
 void ioport_manager::timecode_write(_Type value)
 {
@@ -2787,7 +3235,8 @@ void ioport_manager::record_end(const char *message)
 	// only applies if we have a live file
 	if (m_record_file.is_open())
 	{
-		// close the file
+		// write out any unchanged frames and close the file
+		record_repeats();
 		m_record_file.close();
 
 		// pop a message
@@ -2817,15 +3266,12 @@ void ioport_manager::timecode_end(const char *message)
 
 void ioport_manager::record_frame(const attotime &curtime)
 {
-	// if recording, record information about the current frame
+	// if recording, note the time and speed; they're only written with keyframes
 	if (m_record_file.is_open())
 	{
-		// first the absolute time
-		record_write(curtime.seconds());
-		record_write(curtime.attoseconds());
-
-		// then the current speed
-		record_write(u32(machine().video().speed_percent() * double(1 << 20)));
+		m_record_time = curtime;
+		m_record_speed = u32(machine().video().speed_percent() * double(1 << 20));
+		m_record_data.clear();
 	}
 
 	if (m_timecode_file.is_open() && machine().video().get_timecode_write())
@@ -2931,24 +3377,132 @@ void ioport_manager::record_port(ioport_port &port)
 	if (m_record_file.is_open())
 	{
 		// store the default value and digital state
-		record_write(port.live().defvalue);
-		record_write(port.live().digital);
+		record_value(port.live().defvalue);
+		record_value(port.live().digital);
 
 		// loop over analog ports and save their data
 		for (analog_field &analog : port.live().analoglist)
 		{
 			// store current and previous values
-			record_write(analog.m_accum);
-			record_write(analog.m_previous);
+			record_value(analog.m_accum);
+			record_value(analog.m_previous);
 
 			// store configuration information
-			record_write(analog.m_sensitivity);
-			record_write(analog.m_reverse);
+			record_value(analog.m_sensitivity);
+			record_value(analog.m_reverse);
 		}
 	}
 }
 
 
+//-------------------------------------------------
+//  record_commit - write the current frame's port
+//  data as a keyframe, a change from the previous
+//  frame, or one more unchanged frame
+//-------------------------------------------------
+
+void ioport_manager::record_commit()
+{
+	if (!m_record_file.is_open())
+		return;
+
+	if ((m_record_frame % INP_KEYFRAME_INTERVAL) == 0 || m_record_data.size() != m_record_previous.size())
+	{
+		// keyframes are self-contained so that playback can start from them
+		record_repeats();
+		record_write(INP_RECORD_KEYFRAME);
+		record_write(m_record_frame);
+		record_write(m_record_time.seconds());
+		record_write(m_record_time.attoseconds());
+		record_write(m_record_speed);
+		record_write(u32(m_record_data.size()));
+		if (m_record_file.is_open() && m_record_file.write(m_record_data.data(), m_record_data.size()) != m_record_data.size())
+			record_end("Out of space");
+
+		// the state itself is saved once the frame is complete
+		if (m_record_frame != 0 && machine().options().record_keyframes())
+			m_record_state_frame = m_record_frame;
+	}
+	else if (m_record_data == m_record_previous)
+	{
+		// most frames repeat the previous one
+		m_record_repeats++;
+	}
+	else
+	{
+		record_repeats();
+		save_manager::make_delta(m_record_previous, m_record_data, m_record_delta);
+		record_write(INP_RECORD_DELTA);
+		record_write(u32(m_record_delta.size()));
+		if (m_record_file.is_open() && m_record_file.write(m_record_delta.data(), m_record_delta.size()) != m_record_delta.size())
+			record_end("Out of space");
+	}
+
+	m_record_previous.swap(m_record_data);
+	m_record_frame++;
+}
+
+
+//-------------------------------------------------
+//  record_repeats - write out the number of
+//  unchanged frames since the last record
+//-------------------------------------------------
+
+void ioport_manager::record_repeats()
+{
+	if (m_record_repeats != 0)
+	{
+		record_write(INP_RECORD_REPEAT);
+		record_write(m_record_repeats);
+		m_record_repeats = 0;
+	}
+}
+
+
+//-------------------------------------------------
+//  record_keyframe_state - save a state for the
+//  keyframe just recorded, called between frames
+//  when the scheduler is able to save
+//-------------------------------------------------
+
+void ioport_manager::record_keyframe_state()
+{
+	if (m_record_state_frame == ~u64(0))
+		return;
+
+	// the state has to be taken before the next frame's inputs are read
+	u64 const frame = m_record_state_frame;
+	m_record_state_frame = ~u64(0);
+	if (m_record_frame != frame + 1 || !m_record_file.is_open())
+		return;
+
+	const char *searchpath;
+	std::string const path = machine().compose_saveload_filename(keyframe_state_name(machine().options().record(), frame).c_str(), &searchpath);
+	emu_file file(searchpath, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(path.c_str()) != osd_file::error::NONE)
+	{
+		osd_printf_warning("Failed to create keyframe state %s\n", path.c_str());
+		return;
+	}
+	if (machine().save().write_file(file) != STATERR_NONE)
+	{
+		osd_printf_warning("Failed to save keyframe state %s\n", path.c_str());
+		file.remove_on_close();
+	}
+}
+
+
+//-------------------------------------------------
+//  keyframe_state_name - return the state name
+//  for a keyframe of the given input file
+//-------------------------------------------------
+
+std::string ioport_manager::keyframe_state_name(const char *inpname, u64 frame) const
+{
+	return string_format("%s-%u", core_filename_extract_base(inpname, true), unsigned(frame));
+}
+
+
 
 //**************************************************************************
 //  I/O PORT CONFIGURER
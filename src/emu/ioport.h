@@ -322,6 +322,7 @@ enum ioport_type
 		IPT_UI_DEBUG_BREAK,
 		IPT_UI_PAUSE,
 		IPT_UI_PAUSE_SINGLE,
+		IPT_UI_REWIND_SINGLE,
 		IPT_UI_RESET_MACHINE,
 		IPT_UI_SOFT_RESET,
 		IPT_UI_SHOW_GFX,
@@ -657,6 +658,7 @@ enum
 namespace util { namespace xml { class data_node; } }
 class ioport_list;
 class ioport_port;
+class netplay_manager;
 struct ioport_port_live;
 class ioport_field;
 struct ioport_field_live;
@@ -680,7 +682,8 @@ class inp_header
 {
 public:
 	// parameters
-	static constexpr unsigned MAJVERSION = 3;
+	static constexpr unsigned MAJVERSION = 4;
+	static constexpr unsigned MAJVERSION_FULL = 3; // every port stored every frame, still supported for playback
 	static constexpr unsigned MINVERSION = 0;
 
 	bool read(emu_file &f)
@@ -1099,6 +1102,7 @@ public:
 	void crosshair_position(float &x, float &y, bool &gotx, bool &goty);
 	void init_live_state(analog_field *analog);
 	void frame_update(ioport_value &result);
+	bool can_late_latch() const;
 	void reduce_mask(ioport_value bits_to_remove) { m_mask &= ~bits_to_remove; }
 
 	// user-controllable settings for a field
@@ -1375,6 +1379,60 @@ struct ioport_port_live
 	ioport_value            defvalue;           // combined default value across the port
 	ioport_value            digital;            // current value from all digital inputs
 	ioport_value            outputvalue;        // current value for outputs
+	std::vector<ioport_field *> latelist;       // digital fields re-read when the port is read
+	osd_ticks_t             latched;            // time the late fields were last sampled
+	u32                     latency_event;      // latency monitor event waiting for this port to be read
+};
+
+
+// ======================> input_latency_monitor
+
+// measures the time from digital input changes to the game reading them and to the next presented frame
+class input_latency_monitor
+{
+public:
+	// construction/destruction
+	input_latency_monitor();
+
+	// notifications
+	u32 input_changed(const attotime &emutime);
+	void port_read(u32 event, const attotime &emutime);
+	void frame_presented();
+
+	// reporting
+	void report() const;
+	u32 samples() const { return m_total.samples; }
+	u32 percentile(u32 percent) const { return m_total.percentile(percent); }
+
+private:
+	static constexpr u32 BUCKETS = 100;         // 1ms buckets, with the last collecting anything slower
+
+	// a latency histogram in milliseconds
+	struct histogram
+	{
+		histogram() : samples(0) { std::fill(std::begin(counts), std::end(counts), 0); }
+		void add(osd_ticks_t ticks);
+		u32 percentile(u32 percent) const;
+		void report(const char *name) const;
+
+		u32                     counts[BUCKETS];    // samples per bucket
+		u32                     samples;            // total samples
+	};
+
+	// which stage the current event has reached
+	enum class stage { IDLE, READ, PRESENT };
+
+	// internal state
+	stage                   m_stage;            // stage of the event being timed
+	u32                     m_event;            // serial number of the event being timed
+	osd_ticks_t             m_input_ticks;      // host time the input change reached the port
+	osd_ticks_t             m_read_ticks;       // host time the game read the port
+	attotime                m_input_time;       // emulated time of the input change
+	u32                     m_overlapped;       // changes ignored because another event was in progress
+	histogram               m_emulated;         // emulated time from the change to the read
+	histogram               m_to_read;          // host time from the change to the read
+	histogram               m_to_present;       // host time from the read to the next presented frame
+	histogram               m_total;            // host time from the change to the presented frame
 };
 
 
@@ -1399,6 +1457,13 @@ public:
 	running_machine &machine() const { return m_machine; }
 	const ioport_list &ports() const { return m_portlist; }
 	bool safe_to_read() const { return m_safe_to_read; }
+	bool is_recording() const { return m_record_file.is_open(); }
+	bool is_playing() const { return m_playback_file.is_open(); }
+	void set_netplay(netplay_manager *netplay) { m_netplay = netplay; }
+	void record_keyframe_state();
+	bool late_latch() const;
+	input_latency_monitor *latency_monitor() const { return m_latency.get(); }
+	void frame_presented() { if (m_latency) m_latency->frame_presented(); }
 	natural_keyboard &natkeyboard() { assert(m_natkeyboard != nullptr); return *m_natkeyboard; }
 
 	// type helpers
@@ -1450,16 +1515,23 @@ private:
 	void save_game_inputs(util::xml::data_node &parentnode);
 
 	template<typename _Type> _Type playback_read(_Type &result);
+	template<typename _Type> void playback_value(_Type &result);
 	time_t playback_init();
 	void playback_end(const char *message = nullptr);
 	void playback_frame(const attotime &curtime);
+	bool playback_record(const attotime *curtime);
+	void playback_seek(u64 frame);
 	void playback_port(ioport_port &port);
 
 	template<typename _Type> void record_write(_Type value);
+	template<typename _Type> void record_value(_Type value);
 	void record_init();
 	void record_end(const char *message = nullptr);
 	void record_frame(const attotime &curtime);
 	void record_port(ioport_port &port);
+	void record_commit();
+	void record_repeats();
+	std::string keyframe_state_name(const char *inpname, u64 frame) const;
 
 	template<typename _Type> void timecode_write(_Type value);
 	void timecode_init();
@@ -1468,6 +1540,7 @@ private:
 	// internal state
 	running_machine &       m_machine;              // reference to owning machine
 	bool                    m_safe_to_read;         // clear at start; set after state is loaded
+	netplay_manager *       m_netplay;              // exchanges digital input with a peer, if any
 	ioport_list             m_portlist;             // list of input port configurations
 
 	// types
@@ -1487,6 +1560,22 @@ private:
 	emu_file                m_playback_file;        // playback file (nullptr if not recording)
 	u64                     m_playback_accumulated_speed; // accumulated speed during playback
 	u32                     m_playback_accumulated_frames; // accumulated frames during playback
+	bool                    m_playback_compact;     // playback file only stores changes
+	std::vector<u8>         m_playback_data;        // port data for the current playback frame
+	std::vector<u8>         m_playback_delta;       // scratch buffer for reading changes
+	size_t                  m_playback_offset;      // next byte of m_playback_data to read
+	u32                     m_playback_repeats;     // frames left that reuse m_playback_data
+	u32                     m_playback_speed;       // speed recorded at the last keyframe
+	u64                     m_playback_frame;       // frame m_playback_data belongs to
+	u64                     m_playback_seek_frame;  // frame to seek to before playing, or 0
+	std::vector<u8>         m_record_data;          // port data for the frame being recorded
+	std::vector<u8>         m_record_previous;      // port data for the previous recorded frame
+	std::vector<u8>         m_record_delta;         // scratch buffer for writing changes
+	attotime                m_record_time;          // time of the frame being recorded
+	u32                     m_record_speed;         // speed of the frame being recorded
+	u32                     m_record_repeats;       // unchanged frames not yet written
+	u64                     m_record_frame;         // number of the frame being recorded
+	u64                     m_record_state_frame;   // keyframe waiting for a state to be saved, or ~0
 	emu_file                m_timecode_file;        // timecode/frames playback file (nullptr if not recording)
 	int                     m_timecode_count;
 	attotime                m_timecode_last_time;
@@ -1494,6 +1583,9 @@ private:
 	// autofire
 	bool                    m_autofire_toggle;      // autofire toggle
 	int                     m_autofire_delay;       // autofire delay
+
+	// latency measurement
+	std::unique_ptr<input_latency_monitor> m_latency; // times input changes, if enabled
 };
 
 
@@ -9,14 +9,27 @@
 #define VERBOSE 0
 #endif
 
+// with the default output function, check whether anything is listening
+// before the arguments are evaluated; only devices and the machine know
+#if !defined(LOG_OUTPUT_FUNC) && !defined(logerror)
+#define LOG_OUTPUT_ENABLED() logmacro_enabled(this)
+inline bool logmacro_enabled(const device_t *device) { return device->logging_enabled(); }
+inline bool logmacro_enabled(const running_machine *machine) { return machine->allow_logging(); }
+inline bool logmacro_enabled(const void *) { return true; }
+#endif
+
 #ifndef LOG_OUTPUT_FUNC
 #define LOG_OUTPUT_FUNC logerror
 #endif
 
+#ifndef LOG_OUTPUT_ENABLED
+#define LOG_OUTPUT_ENABLED() true
+#endif
+
 #ifndef LOG_GENERAL
 #define LOG_GENERAL (1U << 0)
 #endif
 
-#define LOGMASKED(mask, ...) do { if (VERBOSE & (mask)) (LOG_OUTPUT_FUNC)(__VA_ARGS__); } while (false)
+#define LOGMASKED(mask, ...) do { if ((VERBOSE & (mask)) && LOG_OUTPUT_ENABLED()) (LOG_OUTPUT_FUNC)(__VA_ARGS__); } while (false)
 
 #define LOG(...) LOGMASKED(LOG_GENERAL, __VA_ARGS__)
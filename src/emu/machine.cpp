@@ -128,6 +128,11 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 		m_saveload_schedule(SLS_NONE),
 		m_saveload_schedule_time(attotime::zero),
 		m_saveload_searchpath(nullptr),
+		m_rewind_pending(false),
+		m_runahead_frames(0),
+		m_startup_profile(_config.options().startup_profile()),
+		m_startup_ticks(0),
+		m_startup_retries(0),
 
 		m_save(*this),
 		m_memory(*this),
@@ -200,7 +205,11 @@ const char *running_machine::describe_context()
 
 void running_machine::start()
 {
-	// initialize basic can't-fail systems here
+	m_startup_ticks = osd_ticks();
+
+	// initialize basic can't-fail systems here; memory accounting comes first so
+	// that everything after it can add reporters
+	m_memreport = std::make_unique<memory_report>(*this);
 	m_configuration = std::make_unique<configuration_manager>(*this);
 	m_input = std::make_unique<input_manager>(*this);
 	m_output = std::make_unique<output_manager>(*this);
@@ -213,12 +222,16 @@ void running_machine::start()
 	// initialize UI input
 	m_ui_input = make_unique_clear<ui_input_manager>(*this);
 
+	startup_phase("core managers");
+
 	// init the osd layer
 	m_manager.osd().init(*this);
+	startup_phase("OSD");
 
 	// create the video manager
 	m_video = std::make_unique<video_manager>(*this);
 	m_ui = manager().create_ui(*this);
+	startup_phase("video and UI");
 
 	// initialize the base time (needed for doing record/playback)
 	::time(&m_base_time);
@@ -229,14 +242,18 @@ void running_machine::start()
 	time_t newbase = m_ioport.initialize();
 	if (newbase != 0)
 		m_base_time = newbase;
+	startup_phase("input ports");
 
 	// initialize the streams engine before the sound devices start
 	m_sound = std::make_unique<sound_manager>(*this);
+	startup_phase("sound");
 
 	// first load ROMs, then populate memory, and finally initialize CPUs
 	// these operations must proceed in this order
 	m_rom_load = make_unique_clear<rom_load_manager>(*this);
+	startup_phase("ROM loading");
 	m_memory.initialize();
+	startup_phase("memory maps");
 
 	// save the random seed or save states might be broken in drivers that use the rand() method
 	save().save_item(NAME(m_rand_seed));
@@ -247,6 +264,21 @@ void running_machine::start()
 	m_crosshair = make_unique_clear<crosshair_manager>(*this);
 	m_network = std::make_unique<network_manager>(*this);
 
+	// netplay rolls back through save states, so it has to be set up before registration closes
+	if (options().netplay()[0] != 0)
+	{
+		if ((m_system.flags & MACHINE_SUPPORTS_SAVE) == 0)
+			osd_printf_error("Netplay disabled: %s does not support save states\n", m_system.name);
+		else if (m_ioport.is_recording() || m_ioport.is_playing())
+			osd_printf_error("Netplay disabled while recording or playing back input\n");
+		else
+		{
+			m_netplay = std::make_unique<netplay_manager>(*this, options().netplay(), options().netplay_delay(), options().netplay_check());
+			if (m_netplay->active())
+				m_ioport.set_netplay(m_netplay.get());
+		}
+	}
+
 	// initialize the debugger
 	if ((debug_flags & DEBUG_FLAG_ENABLED) != 0)
 	{
@@ -257,12 +289,21 @@ void running_machine::start()
 	m_render->resolve_tags();
 
 	manager().create_custom(*this);
+	startup_phase("images, debugger and frontend");
 
 	// register callbacks for the devices, then start them
 	add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&running_machine::reset_all_devices, this));
 	add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&running_machine::stop_all_devices, this));
+	if (options().profile_trace()[0] != 0)
+	{
+		if (g_profiler.trace_start())
+			add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&running_machine::write_profile_trace, this));
+		else
+			osd_printf_warning("Profiler traces are only available in builds with the profiler enabled\n");
+	}
 	save().register_presave(save_prepost_delegate(FUNC(running_machine::presave_all_devices), this));
 	start_all_devices();
+	startup_phase("device start");
 	save().register_postload(save_prepost_delegate(FUNC(running_machine::postload_all_devices), this));
 
 	// if we're coming in with a savegame request, process it now
@@ -274,6 +315,44 @@ void running_machine::start()
 	else if (options().autosave() && (m_system.flags & MACHINE_SUPPORTS_SAVE) != 0)
 		schedule_load("auto");
 
+	// running ahead rolls back every frame, so it needs reliable save states and no debugger;
+	// netplay does its own rolling back, and rewinding would leave the peer behind
+	m_runahead_frames = options().runahead();
+	if (m_netplay && m_netplay->active())
+		m_runahead_frames = 0;
+	if (m_runahead_frames != 0 && (m_system.flags & MACHINE_SUPPORTS_SAVE) == 0)
+	{
+		osd_printf_verbose("Run-ahead disabled: %s does not support save states\n", m_system.name);
+		m_runahead_frames = 0;
+	}
+	else if (m_runahead_frames != 0 && (debug_flags & DEBUG_FLAG_ENABLED) != 0)
+	{
+		osd_printf_verbose("Run-ahead disabled while debugging\n");
+		m_runahead_frames = 0;
+	}
+
+	// rewinding costs nothing unless it's enabled
+	if (options().rewind() && !(m_netplay && m_netplay->active()))
+	{
+		if ((m_system.flags & MACHINE_SUPPORTS_SAVE) != 0)
+			m_rewind = std::make_unique<rewinder>(m_save, options().rewind_interval(), size_t(options().rewind_capacity()) << 20);
+		else
+			osd_printf_verbose("Rewind disabled: %s does not support save states\n", m_system.name);
+	}
+
+	// the save state buffers held for running ahead and rewinding
+	m_memreport->add_reporter([this] (memory_report &report)
+	{
+		report.add("Save state buffers", "run-ahead", m_runahead_state.capacity());
+		if (m_rewind)
+			report.add("Save state buffers", "rewind", m_rewind->history_bytes());
+	});
+	if (options().mem_report())
+		add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&memory_report::print_summary, m_memreport.get()));
+
+	if (m_startup_profile)
+		report_startup();
+
 	manager().update_machine();
 }
 
@@ -350,14 +429,40 @@ int running_machine::run(bool quiet)
 
 			// execute CPUs if not paused
 			if (!m_paused)
+			{
+				u64 const frame = m_video->frame_count();
 				m_scheduler.timeslice();
+				if (m_video->frame_count() != frame)
+				{
+					if (m_netplay)
+						netplay_frame();
+
+					// capture rewind history from the real timeline before running ahead of it
+					if (m_rewind)
+					{
+						m_rewind->frame_completed();
+						if (m_rewind->capture_due() && m_saveload_schedule == SLS_NONE && m_scheduler.can_save())
+							m_rewind->capture();
+					}
+					// save a state for the input recording's keyframe
+					if (m_saveload_schedule == SLS_NONE && m_scheduler.can_save())
+						m_ioport.record_keyframe_state();
+					if (m_runahead_frames != 0)
+						run_ahead();
+				}
+			}
 			// otherwise, just pump video updates through
 			else
+			{
+				m_video->set_frame_role(video_manager::FR_NORMAL);
 				m_video->frame_update();
+			}
 
 			// handle save/load
 			if (m_saveload_schedule != SLS_NONE)
 				handle_saveload();
+			if (m_rewind_pending)
+				handle_rewind();
 
 			g_profiler.stop();
 		}
@@ -409,7 +514,8 @@ int running_machine::run(bool quiet)
 
 	// call all exit callbacks registered
 	call_notifiers(MACHINE_NOTIFY_EXIT);
-	util::archive_file::cache_clear();
+	if (!manager().keep_archive_cache())
+		util::archive_file::cache_clear();
 
 	// close the logfile
 	m_logfile.reset();
@@ -660,6 +766,17 @@ void running_machine::schedule_load(const char *filename)
 }
 
 
+//-------------------------------------------------
+//  schedule_rewind - schedule a step back through
+//  the rewind history at the end of the timeslice
+//-------------------------------------------------
+
+void running_machine::schedule_rewind()
+{
+	m_rewind_pending = true;
+}
+
+
 //-------------------------------------------------
 //  immediate_load - load state.
 //-------------------------------------------------
@@ -900,6 +1017,10 @@ void running_machine::handle_saveload()
 					break;
 
 				case STATERR_NONE:
+					// the history no longer leads up to the current state
+					if (m_rewind && m_saveload_schedule == SLS_LOAD)
+						m_rewind->invalidate();
+
 					if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
 						popmessage("State successfully %s.\nWarning: Save states are not officially supported for this machine.", opnamed);
 					else
@@ -927,6 +1048,104 @@ void running_machine::handle_saveload()
 }
 
 
+//-------------------------------------------------
+//  handle_rewind - step back through the rewind
+//  history
+//-------------------------------------------------
+
+void running_machine::handle_rewind()
+{
+	m_rewind_pending = false;
+	if (!m_rewind)
+		popmessage("Rewind is not enabled; start with -rewind to use it.");
+	else if (!m_rewind->step_back())
+		popmessage("Rewind history is empty.");
+	else
+		popmessage("Rewound (%u steps left).", unsigned(m_rewind->history_size() - 1));
+}
+
+
+//-------------------------------------------------
+//  netplay_frame - after each frame, snapshot the
+//  state, keep in step with the peer, and emulate
+//  again any frames that ran on a wrong guess of
+//  the peer's input
+//-------------------------------------------------
+
+void running_machine::netplay_frame()
+{
+	m_netplay->frame_completed();
+	m_netplay->wait_for_peer();
+	u32 const target = m_netplay->poll();
+	if (target == 0)
+		return;
+
+	// the frames being emulated again were already heard and seen once
+	sound().suppress_output(true);
+	m_video->set_frame_role(video_manager::FR_AHEAD);
+	while (m_netplay->active() && m_netplay->frame() < target && !m_hard_reset_pending && !m_exit_pending)
+	{
+		u64 const frame = m_video->frame_count();
+		m_scheduler.timeslice();
+		if (m_video->frame_count() != frame)
+			m_netplay->frame_completed();
+	}
+	m_video->set_frame_role(video_manager::FR_NORMAL);
+	sound().suppress_output(false);
+}
+
+
+//-------------------------------------------------
+//  can_run_ahead - check whether it's safe to
+//  snapshot the machine and roll it back now
+//-------------------------------------------------
+
+bool running_machine::can_run_ahead()
+{
+	// anything that has to see every frame exactly once rules it out
+	if (m_hard_reset_pending || m_exit_pending || m_saveload_schedule != SLS_NONE)
+		return false;
+	if (m_ioport.is_recording() || m_ioport.is_playing() || m_video->is_recording())
+		return false;
+
+	// anonymous timers aren't saved, so they would fire twice
+	return m_scheduler.can_save();
+}
+
+
+//-------------------------------------------------
+//  run_ahead - after a frame on the real timeline,
+//  emulate a few frames ahead, show the last one
+//  and roll back, so what is on screen already
+//  reflects the latest input
+//-------------------------------------------------
+
+void running_machine::run_ahead()
+{
+	// if we can't snapshot right now, show the next real frame instead
+	if (!can_run_ahead() || m_save.write_buffer(m_runahead_state) != STATERR_NONE)
+	{
+		m_video->set_frame_role(video_manager::FR_NORMAL);
+		return;
+	}
+
+	// the sound for these frames will be generated again on the real timeline
+	sound().suppress_output(true);
+	for (int frame = 1; frame <= m_runahead_frames && !m_hard_reset_pending && !m_exit_pending; frame++)
+	{
+		m_video->set_frame_role((frame == m_runahead_frames) ? video_manager::FR_SHOWN : video_manager::FR_AHEAD);
+		u64 const target = m_video->frame_count();
+		while (m_video->frame_count() == target && !m_hard_reset_pending && !m_exit_pending)
+			m_scheduler.timeslice();
+	}
+	sound().suppress_output(false);
+
+	// roll back; the next real frame is superseded by the next run ahead
+	m_save.read_buffer(m_runahead_state);
+	m_video->set_frame_role(video_manager::FR_KEPT);
+}
+
+
 //-------------------------------------------------
 //  soft_reset - actually perform a soft-reset
 //  of the system
@@ -988,7 +1207,27 @@ void running_machine::start_all_devices()
 
 					// now start the device
 					osd_printf_verbose("Starting %s '%s'\n", device.name(), device.tag());
-					device.start();
+					osd_ticks_t const start_ticks = m_startup_profile ? osd_ticks() : 0;
+					m_respool.set_owner(device.tag());
+					try
+					{
+						device.start();
+					}
+					catch (device_missing_dependencies &)
+					{
+						m_respool.set_owner(nullptr);
+
+						// abandoned attempts still count against the device
+						if (m_startup_profile)
+						{
+							m_startup_devices[&device] += osd_ticks() - start_ticks;
+							m_startup_retries++;
+						}
+						throw;
+					}
+					m_respool.set_owner(nullptr);
+					if (m_startup_profile)
+						m_startup_devices[&device] += osd_ticks() - start_ticks;
 				}
 
 				// handle missing dependencies by moving the device to the end
@@ -1009,6 +1248,61 @@ void running_machine::start_all_devices()
 }
 
 
+//-------------------------------------------------
+//  startup_phase - record the time taken by the
+//  startup phase that just finished
+//-------------------------------------------------
+
+void running_machine::startup_phase(const char *name)
+{
+	if (!m_startup_profile)
+		return;
+
+	osd_ticks_t const current = osd_ticks();
+	m_startup_phases.emplace_back(name, current - m_startup_ticks);
+	m_startup_ticks = current;
+}
+
+
+//-------------------------------------------------
+//  report_startup - print the startup phases and
+//  the devices that took longest to start
+//-------------------------------------------------
+
+void running_machine::report_startup()
+{
+	double const ms_per_tick = 1000.0 / double(osd_ticks_per_second());
+
+	osd_ticks_t total = 0;
+	for (auto const &phase : m_startup_phases)
+		total += phase.second;
+	osd_printf_info("Startup took %.1f ms:\n", double(total) * ms_per_tick);
+	for (auto const &phase : m_startup_phases)
+		osd_printf_info("  %-32s %8.1f ms\n", phase.first, double(phase.second) * ms_per_tick);
+
+	// the slowest devices, including any attempts abandoned for missing dependencies
+	std::vector<std::pair<device_t *, osd_ticks_t>> devices(m_startup_devices.begin(), m_startup_devices.end());
+	std::sort(devices.begin(), devices.end(), [] (auto const &a, auto const &b) { return a.second > b.second; });
+	if (devices.size() > 10)
+		devices.resize(10);
+	osd_printf_info("Slowest device starts (%u rescheduled for missing dependencies):\n", m_startup_retries);
+	for (auto const &device : devices)
+		osd_printf_info("  %-32s %8.1f ms  %s\n", device.first->tag(), double(device.second) * ms_per_tick, device.first->name());
+
+	// the devices holding the most memory in the machine's resource pool
+	std::vector<std::pair<std::string, resource_pool_usage>> owners(m_respool.usage().begin(), m_respool.usage().end());
+	std::sort(owners.begin(), owners.end(), [] (auto const &a, auto const &b) { return a.second.m_current > b.second.m_current; });
+	if (owners.size() > 10)
+		owners.resize(10);
+	osd_printf_info("Largest resource pool allocations:\n");
+	for (auto const &owner : owners)
+		osd_printf_info("  %-32s %8u kB  %u items, peak %u kB\n", owner.first.empty() ? "(machine)" : owner.first.c_str(), u32(owner.second.m_current / 1024), owner.second.m_items, u32(owner.second.m_peak / 1024));
+
+	m_startup_phases.clear();
+	m_startup_devices.clear();
+}
+
+
 //-------------------------------------------------
 //  reset_all_devices - reset all devices in the
 //  hierarchy
@@ -1038,6 +1332,17 @@ void running_machine::stop_all_devices()
 }
 
 
+//-------------------------------------------------
+//  write_profile_trace - write out the profiler
+//  trace requested on the command line
+//-------------------------------------------------
+
+void running_machine::write_profile_trace()
+{
+	g_profiler.trace_write(options().profile_trace());
+}
+
+
 //-------------------------------------------------
 //  presave_all_devices - tell all the devices we
 //  are about to save
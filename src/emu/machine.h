@@ -18,6 +18,7 @@
 #define MAME_EMU_MACHINE_H
 
 #include <functional>
+#include <mutex>
 
 #include <time.h>
 
@@ -88,6 +89,8 @@ class ui_manager;
 class tilemap_manager;
 class debug_view_manager;
 class network_manager;
+class netplay_manager;
+class memory_report;
 class bookkeeping_manager;
 class configuration_manager;
 class output_manager;
@@ -208,6 +211,7 @@ public:
 	tilemap_manager &tilemap() const { assert(m_tilemap != nullptr); return *m_tilemap; }
 	debug_view_manager &debug_view() const { assert(m_debug_view != nullptr); return *m_debug_view; }
 	debugger_manager &debugger() const { assert(m_debugger != nullptr); return *m_debugger; }
+	memory_report &memreport() const { assert(m_memreport != nullptr); return *m_memreport; }
 	driver_device *driver_data() const { return &downcast<driver_device &>(root_device()); }
 	template<class _DriverClass> _DriverClass *driver_data() const { return &downcast<_DriverClass &>(root_device()); }
 	machine_phase phase() const { return m_current_phase; }
@@ -251,6 +255,7 @@ public:
 	void schedule_soft_reset();
 	void schedule_save(const char *filename);
 	void schedule_load(const char *filename);
+	void schedule_rewind();
 
 	// date & time
 	void base_datetime(system_time &systime);
@@ -286,6 +291,10 @@ private:
 	void set_saveload_filename(const char *filename);
 	std::string get_statename(const char *statename_opt) const;
 	void handle_saveload();
+	void handle_rewind();
+	bool can_run_ahead();
+	void run_ahead();
+	void netplay_frame();
 	void soft_reset(void *ptr = nullptr, s32 param = 0);
 	std::string nvram_filename(device_t &device) const;
 	void nvram_load();
@@ -300,6 +309,11 @@ private:
 	void start_all_devices();
 	void reset_all_devices();
 	void stop_all_devices();
+	void write_profile_trace();
+
+	// startup profiling
+	void startup_phase(const char *name);
+	void report_startup();
 	void presave_all_devices();
 	void postload_all_devices();
 
@@ -324,6 +338,9 @@ private:
 	std::unique_ptr<image_manager> m_image;            // internal data from image.cpp
 	std::unique_ptr<rom_load_manager> m_rom_load;      // internal data from romload.cpp
 	std::unique_ptr<debugger_manager> m_debugger;      // internal data from debugger.cpp
+	std::unique_ptr<rewinder> m_rewind;                // rewind history, if enabled
+	std::unique_ptr<netplay_manager> m_netplay;        // netplay session, if any
+	std::unique_ptr<memory_report> m_memreport;        // memory accounting, from memreport.cpp
 
 	// system state
 	machine_phase           m_current_phase;        // current execution phase
@@ -352,6 +369,18 @@ private:
 	attotime                m_saveload_schedule_time;
 	std::string             m_saveload_pending_file;
 	const char *            m_saveload_searchpath;
+	bool                    m_rewind_pending;
+
+	// run-ahead
+	int                     m_runahead_frames;      // frames to emulate ahead of the real timeline
+	std::vector<u8>         m_runahead_state;       // snapshot of the real timeline
+
+	// startup profiling
+	bool                    m_startup_profile;      // time startup phases and device starts?
+	osd_ticks_t             m_startup_ticks;        // when the current startup phase began
+	std::vector<std::pair<const char *, osd_ticks_t>> m_startup_phases;   // ticks taken by each phase
+	std::unordered_map<device_t *, osd_ticks_t> m_startup_devices;         // ticks taken starting each device
+	u32                     m_startup_retries;      // starts abandoned for missing dependencies
 
 	// notifier callbacks
 	struct notifier_callback_item
@@ -383,8 +412,9 @@ private:
 	parameters_manager      m_parameters;           // parameters manager
 	device_scheduler        m_scheduler;            // scheduler object
 
-	// string formatting buffer
+	// string formatting buffer, shared by devices logging from execution group threads
 	mutable util::ovectorstream m_string_buffer;
+	mutable std::mutex      m_string_buffer_lock;
 
 	// configuration state
 	dummy_space_device m_dummy_space;
@@ -424,6 +454,7 @@ inline void running_machine::logerror(Format &&fmt, Params &&... args) const
 	if (allow_logging())
 	{
 		g_profiler.start(PROFILER_LOGERROR);
+		std::lock_guard<std::mutex> lock(m_string_buffer_lock);
 
 		// dump to the buffer
 		m_string_buffer.clear();
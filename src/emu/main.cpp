@@ -113,6 +113,7 @@ machine_manager::machine_manager(emu_options& options, osd_interface& osd)
   : m_osd(osd),
 	m_options(options),
 	m_machine(nullptr),
+	m_keep_archive_cache(false),
 	m_io_context(std::make_shared<asio::io_context>())
 {
 }
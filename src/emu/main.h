@@ -92,6 +92,10 @@ public:
 
 	void set_machine(running_machine *machine) { m_machine = machine; }
 
+	// keep archives open when a machine exits, for runners that start several in turn
+	bool keep_archive_cache() const { return m_keep_archive_cache; }
+	void set_keep_archive_cache(bool keep) { m_keep_archive_cache = keep; }
+
 	virtual ui_manager* create_ui(running_machine& machine) { return nullptr;  }
 	virtual void create_custom(running_machine& machine) { }
 	virtual void ui_initialize(running_machine& machine) { }
@@ -105,6 +109,7 @@ protected:
 	osd_interface &         m_osd;                  // reference to OSD system
 	emu_options &           m_options;              // reference to options
 	running_machine *       m_machine;
+	bool                    m_keep_archive_cache;
 	std::shared_ptr<asio::io_context>   m_io_context;
 	std::unique_ptr<webpp::http_server> m_server;
 	std::unique_ptr<webpp::ws_server>   m_wsserver;
@@ -0,0 +1,166 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    memreport.cpp
+
+    Accounting of the host memory held by each subsystem.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "render.h"
+
+#include <algorithm>
+
+
+//**************************************************************************
+//  MEMORY REPORT
+//**************************************************************************
+
+//-------------------------------------------------
+//  memory_report - constructor
+//-------------------------------------------------
+
+memory_report::memory_report(running_machine &machine)
+	: m_machine(machine)
+{
+}
+
+
+//-------------------------------------------------
+//  add - account for memory held by a device or
+//  region
+//-------------------------------------------------
+
+void memory_report::add(const char *category, const char *tag, u64 bytes)
+{
+	if (bytes == 0)
+		return;
+
+	for (entry &elem : m_entries)
+		if (elem.category == category && elem.tag == tag)
+		{
+			elem.bytes += bytes;
+			return;
+		}
+	m_entries.push_back(entry{ category, tag, bytes });
+}
+
+
+//-------------------------------------------------
+//  collect - gather a fresh report from the core
+//  and from every reporter
+//-------------------------------------------------
+
+std::vector<memory_report::entry> memory_report::collect()
+{
+	m_entries.clear();
+	add_core();
+	for (reporter_func &reporter : m_reporters)
+		reporter(*this);
+
+	// keep categories together, in the order they first appeared
+	std::vector<entry> result;
+	result.swap(m_entries);
+	std::vector<std::string> order;
+	for (const entry &elem : result)
+		if (std::find(order.begin(), order.end(), elem.category) == order.end())
+			order.push_back(elem.category);
+	std::stable_sort(result.begin(), result.end(), [&order] (const entry &a, const entry &b)
+	{
+		auto acat = std::find(order.begin(), order.end(), a.category);
+		auto bcat = std::find(order.begin(), order.end(), b.category);
+		return (acat != bcat) ? (acat < bcat) : (a.bytes > b.bytes);
+	});
+	return result;
+}
+
+
+//-------------------------------------------------
+//  summary - format a report as text
+//-------------------------------------------------
+
+std::string memory_report::summary()
+{
+	std::vector<entry> entries = collect();
+	std::ostringstream buf;
+	u64 total = 0;
+	for (auto it = entries.begin(); it != entries.end(); )
+	{
+		// total up the category first
+		auto end = std::find_if(it, entries.end(), [it] (const entry &elem) { return elem.category != it->category; });
+		u64 bytes = 0;
+		for (auto cur = it; cur != end; ++cur)
+			bytes += cur->bytes;
+		total += bytes;
+
+		util::stream_format(buf, "%-36s %10s\n", it->category, format_bytes(bytes));
+		for ( ; it != end; ++it)
+			util::stream_format(buf, "  %-34s %10s\n", it->tag, format_bytes(it->bytes));
+	}
+	util::stream_format(buf, "%-36s %10s\n", "Total", format_bytes(total));
+	return buf.str();
+}
+
+
+//-------------------------------------------------
+//  format_bytes - format a byte count compactly
+//-------------------------------------------------
+
+std::string memory_report::format_bytes(u64 bytes)
+{
+	if (bytes >= 1024 * 1024)
+		return string_format("%.1f MB", double(bytes) / (1024 * 1024));
+	else if (bytes >= 1024)
+		return string_format("%.1f KB", double(bytes) / 1024);
+	else
+		return string_format("%u B", unsigned(bytes));
+}
+
+
+//-------------------------------------------------
+//  print_summary - write the report out at exit
+//  for -memreport
+//-------------------------------------------------
+
+void memory_report::print_summary()
+{
+	osd_printf_info("Memory usage for %s:\n%s", machine().system().name, summary().c_str());
+}
+
+
+//-------------------------------------------------
+//  add_core - account for the memory held by the
+//  core managers
+//-------------------------------------------------
+
+void memory_report::add_core()
+{
+	// ROM regions, with files mapped from the region cache kept separate since
+	// they are backed by the page cache rather than the heap
+	for (auto &region : machine().memory().regions())
+		add(region.second->is_mapped() ? "ROM regions (mapped)" : "ROM regions", region.first.c_str(), region.second->bytes());
+
+	// shared memory
+	for (auto &share : machine().memory().shares())
+		add("Shared memory", share.first.c_str(), share.second->bytes());
+
+	// decoded graphics, including the bounded caches of very large sets
+	for (device_gfx_interface &gfx : gfx_interface_iterator(machine().root_device()))
+		for (int index = 0; index < MAX_GFX_ELEMENTS; index++)
+			if (gfx.gfx(index) != nullptr)
+				add("Decoded graphics", gfx.device().tag(), gfx.gfx(index)->decoded_bytes());
+
+	// tilemap pixmaps, by the device that owns them or the device decoding their tiles
+	tilemap_manager &tilemaps = machine().tilemap();
+	for (int index = 0; index < tilemaps.count(); index++)
+	{
+		tilemap_t &tmap = *tilemaps.find(index);
+		device_t &owner = (tmap.device() != nullptr) ? *tmap.device() : tmap.decoder().device();
+		add("Tilemaps", owner.tag(), tmap.pixmap_bytes());
+	}
+
+	// scaled variants of render textures
+	add("Render textures", "scaled copies", machine().render().scaled_texture_bytes());
+}
@@ -0,0 +1,77 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    memreport.h
+
+    Accounting of the host memory held by each subsystem.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __EMU_H__
+#error Dont include this file directly; include emu.h instead.
+#endif
+
+#ifndef MAME_EMU_MEMREPORT_H
+#define MAME_EMU_MEMREPORT_H
+
+#include <functional>
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> memory_report
+
+// collects the bytes held by ROM regions, shares, decoded graphics, tilemaps
+// and render textures itself; subsystems that keep memory of their own (DRC
+// caches, samples, CHD caches, save state buffers) add reporters for it
+class memory_report
+{
+public:
+	// a single line of the report
+	struct entry
+	{
+		std::string     category;           // what kind of memory this is
+		std::string     tag;                // device or region it belongs to
+		u64             bytes;              // bytes held
+	};
+
+	typedef std::function<void (memory_report &)> reporter_func;
+
+	// construction/destruction
+	memory_report(running_machine &machine);
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+
+	// reporters are called each time a report is collected
+	void add_reporter(reporter_func reporter) { m_reporters.push_back(std::move(reporter)); }
+
+	// called by reporters to account for memory; repeated category/tag pairs are summed
+	void add(const char *category, const char *tag, u64 bytes);
+
+	// collect a fresh report, grouped by category in the order they were first added
+	std::vector<entry> collect();
+
+	// format a report as text, with the largest users first within each category
+	std::string summary();
+	static std::string format_bytes(u64 bytes);
+
+	// exit notifier for -memreport
+	void print_summary();
+
+private:
+	// internal helpers
+	void add_core();
+
+	// internal state
+	running_machine &           m_machine;          // reference to our machine
+	std::vector<reporter_func>  m_reporters;        // additional reporters
+	std::vector<entry>          m_entries;          // report being collected
+};
+
+#endif  // MAME_EMU_MEMREPORT_H
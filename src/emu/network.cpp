@@ -12,6 +12,8 @@
 #include "network.h"
 #include "config.h"
 #include "xmlfile.h"
+#include "hashing.h"
+#include "asio.h"
 
 //**************************************************************************
 //  NETWORK MANAGER
@@ -87,3 +89,546 @@ void network_manager::config_save(config_type cfg_type, util::xml::data_node *pa
 		}
 	}
 }
+
+
+
+//**************************************************************************
+//  NETPLAY
+//**************************************************************************
+
+namespace {
+
+// packets are little-endian 32-bit words, starting with a magic number and a type
+const u32 NETPLAY_MAGIC = 0x314e504d; // 'MPN1'
+
+enum
+{
+	PACKET_HELLO,                   // seat, port count, system CRC
+	PACKET_INPUT,                   // ack, first frame, frame count, values
+	PACKET_HASH                     // frame, state CRC
+};
+
+inline void put_u32(std::vector<u8> &packet, u32 value)
+{
+	packet.push_back(u8(value));
+	packet.push_back(u8(value >> 8));
+	packet.push_back(u8(value >> 16));
+	packet.push_back(u8(value >> 24));
+}
+
+inline u32 get_u32(const u8 *data)
+{
+	return u32(data[0]) | (u32(data[1]) << 8) | (u32(data[2]) << 16) | (u32(data[3]) << 24);
+}
+
+} // anonymous namespace
+
+
+struct netplay_manager::transport
+{
+	transport() : socket(context) { }
+
+	asio::io_context            context;
+	asio::ip::udp::socket       socket;
+	asio::ip::udp::endpoint     peer;
+};
+
+
+//-------------------------------------------------
+//  netplay_manager - constructor; connects to or
+//  waits for the peer before the machine starts
+//-------------------------------------------------
+
+netplay_manager::netplay_manager(running_machine &machine, const char *peer, u32 delay, u32 check_interval)
+	: m_machine(machine),
+		m_transport(std::make_unique<transport>()),
+		m_active(false),
+		m_seat(0),
+		m_delay(std::max<u32>(delay, 1)),
+		m_check_interval(check_interval),
+		m_frame(0),
+		m_local_end(m_delay),
+		m_remote_end(m_delay),
+		m_peer_ack(m_delay),
+		m_rollback_to(~u32(0)),
+		m_next_check(check_interval),
+		m_capture(false),
+		m_port_index(0),
+		m_last_receive(0)
+{
+	// the peer that waits owns player 1 and the system inputs, the one that connects the rest
+	m_seat = (peer[0] == ':') ? 0 : 1;
+	for (auto &port : machine.ioport().ports())
+	{
+		ioport_value player1 = 0, others = 0;
+		for (ioport_field &field : port.second->fields())
+			if (!field.is_analog())
+				((field.player() == 0) ? player1 : others) |= field.mask();
+		m_ports.push_back(port.second.get());
+		m_local_mask.push_back(m_seat ? others : player1);
+		m_remote_mask.push_back(m_seat ? player1 : others);
+	}
+	m_local.resize(HISTORY * m_ports.size(), 0);
+	m_remote.resize(HISTORY * m_ports.size(), 0);
+	m_applied.resize(HISTORY * m_ports.size(), 0);
+	std::fill(std::begin(m_snapshot_frame), std::end(m_snapshot_frame), ~u32(0));
+
+	// the frame number is part of the state, so rolling back rewinds it too
+	machine.save().save_item(NAME(m_frame));
+
+	m_active = connect(peer);
+}
+
+
+//-------------------------------------------------
+//  ~netplay_manager - destructor
+//-------------------------------------------------
+
+netplay_manager::~netplay_manager()
+{
+}
+
+
+//-------------------------------------------------
+//  connect - open the socket and exchange hello
+//  packets with the peer
+//-------------------------------------------------
+
+bool netplay_manager::connect(const char *peer)
+{
+	std::string const address(peer);
+	std::string::size_type const colon = address.rfind(':');
+	if (colon == std::string::npos)
+	{
+		osd_printf_error("Netplay: expected host:port or :port, got '%s'\n", peer);
+		return false;
+	}
+	std::string const host = address.substr(0, colon);
+	std::string const service = address.substr(colon + 1);
+
+	asio::error_code ec;
+	asio::ip::udp::socket &socket = m_transport->socket;
+	if (m_seat == 0)
+	{
+		socket.open(asio::ip::udp::v4(), ec);
+		if (!ec)
+			socket.bind(asio::ip::udp::endpoint(asio::ip::udp::v4(), u16(atoi(service.c_str()))), ec);
+	}
+	else
+	{
+		asio::ip::udp::resolver resolver(m_transport->context);
+		auto const endpoints = resolver.resolve(asio::ip::udp::v4(), host, service, ec);
+		if (!ec && endpoints.begin() != endpoints.end())
+		{
+			m_transport->peer = *endpoints.begin();
+			socket.open(asio::ip::udp::v4(), ec);
+		}
+		else if (!ec)
+			ec = asio::error::host_not_found;
+	}
+	if (!ec)
+		socket.non_blocking(true, ec);
+	if (ec)
+	{
+		osd_printf_error("Netplay: unable to open a socket for '%s': %s\n", peer, ec.message().c_str());
+		return false;
+	}
+
+	// both sides must be running the same system with the same ports
+	u32 const system_crc = util::crc32_creator::simple(machine().system().name, strlen(machine().system().name));
+	std::vector<u8> hello;
+	put_u32(hello, NETPLAY_MAGIC);
+	put_u32(hello, PACKET_HELLO);
+	put_u32(hello, m_seat);
+	put_u32(hello, u32(m_ports.size()));
+	put_u32(hello, system_crc);
+
+	if (m_seat == 0)
+		osd_printf_info("Netplay: waiting for a peer on port %s\n", service.c_str());
+	else
+		osd_printf_info("Netplay: connecting to %s\n", peer);
+
+	// keep saying hello until we hear one back; the connecting side keeps resending
+	// until its hello gets through, then the waiting side's reply completes the exchange
+	osd_ticks_t const start = osd_ticks();
+	osd_ticks_t last_send = 0;
+	u8 buffer[1500];
+	while (osd_ticks() - start < osd_ticks_per_second() * TIMEOUT_SECONDS * 2)
+	{
+		if (m_seat == 1 && osd_ticks() - last_send > osd_ticks_per_second() / 4)
+		{
+			socket.send_to(asio::buffer(hello), m_transport->peer, 0, ec);
+			last_send = osd_ticks();
+		}
+
+		asio::ip::udp::endpoint sender;
+		size_t const length = socket.receive_from(asio::buffer(buffer), sender, 0, ec);
+		if (ec == asio::error::would_block || ec == asio::error::try_again)
+		{
+			osd_sleep(osd_ticks_per_second() / 100);
+			continue;
+		}
+		if (ec || length < 20 || get_u32(&buffer[0]) != NETPLAY_MAGIC || get_u32(&buffer[4]) != PACKET_HELLO)
+			continue;
+		if (get_u32(&buffer[8]) == m_seat || get_u32(&buffer[12]) != m_ports.size() || get_u32(&buffer[16]) != system_crc)
+		{
+			osd_printf_error("Netplay: the peer is running a different system or the same seat\n");
+			return false;
+		}
+
+		if (m_seat == 0)
+		{
+			m_transport->peer = sender;
+			socket.send_to(asio::buffer(hello), sender, 0, ec);
+		}
+		m_last_receive = osd_ticks();
+		osd_printf_info("Netplay: connected to %s:%u, input delay %u frames\n", m_transport->peer.address().to_string().c_str(), unsigned(m_transport->peer.port()), unsigned(m_delay));
+		return true;
+	}
+
+	osd_printf_error("Netplay: timed out waiting for the peer\n");
+	return false;
+}
+
+
+//-------------------------------------------------
+//  end - stop exchanging input and carry on with
+//  local input only
+//-------------------------------------------------
+
+void netplay_manager::end(const char *reason)
+{
+	if (!m_active)
+		return;
+	m_active = false;
+	machine().logerror("Netplay: %s\n", reason);
+	machine().popmessage("Netplay ended: %s", reason);
+}
+
+
+//-------------------------------------------------
+//  begin_frame - start latching the input for
+//  the next frame
+//-------------------------------------------------
+
+void netplay_manager::begin_frame()
+{
+	// when a frame is emulated again after a rollback, its local input was sampled the first time
+	m_port_index = 0;
+	m_capture = m_active && (m_frame + m_delay >= m_local_end);
+}
+
+
+//-------------------------------------------------
+//  update_port - replace a port's live digital
+//  state with the one agreed for this frame
+//-------------------------------------------------
+
+void netplay_manager::update_port(ioport_port &port)
+{
+	if (!m_active || m_port_index >= m_ports.size())
+		return;
+	u32 const index = m_port_index++;
+
+	// what we sample now is sent to the peer and used m_delay frames from now
+	if (m_capture)
+		local_inputs(m_frame + m_delay)[index] = port.live().digital & m_local_mask[index];
+
+	// use the peer's input if we have it, otherwise predict it hasn't changed
+	ioport_value const remote = (m_frame < m_remote_end) ? remote_inputs(m_frame)[index] : remote_inputs(m_remote_end - 1)[index];
+	ioport_value const value = local_inputs(m_frame)[index] | remote;
+	applied_inputs(m_frame)[index] = value;
+	port.live().digital = value;
+}
+
+
+//-------------------------------------------------
+//  end_frame - finish latching the input for this
+//  frame and send any new local input
+//-------------------------------------------------
+
+void netplay_manager::end_frame()
+{
+	if (!m_active)
+		return;
+
+	if (m_capture)
+	{
+		m_local_end = m_frame + m_delay + 1;
+		send_inputs();
+	}
+	m_frame++;
+}
+
+
+//-------------------------------------------------
+//  frame_completed - snapshot the state at the
+//  frame boundary so we can roll back to it
+//-------------------------------------------------
+
+void netplay_manager::frame_completed()
+{
+	if (!m_active)
+		return;
+
+	u32 const slot = m_frame % SNAPSHOTS;
+	if (machine().save().write_buffer(m_snapshots[slot]) != STATERR_NONE)
+	{
+		end("unable to save the machine state");
+		return;
+	}
+	m_snapshot_frame[slot] = m_frame;
+
+	check_determinism();
+}
+
+
+//-------------------------------------------------
+//  wait_for_peer - stall while we are too far
+//  ahead of the peer's input to roll back
+//-------------------------------------------------
+
+void netplay_manager::wait_for_peer()
+{
+	osd_ticks_t last_send = osd_ticks();
+	while (m_active && m_frame >= m_remote_end + MAX_ROLLBACK)
+	{
+		receive();
+		if (osd_ticks() - m_last_receive > osd_ticks_per_second() * TIMEOUT_SECONDS)
+			end("the peer stopped responding");
+		else if (m_frame >= m_remote_end + MAX_ROLLBACK)
+		{
+			// resend in case our input was lost on the way
+			if (osd_ticks() - last_send > osd_ticks_per_second() / 20)
+			{
+				send_inputs();
+				last_send = osd_ticks();
+			}
+			osd_sleep(osd_ticks_per_second() / 1000);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  poll - take in the peer's input; if any frame
+//  was emulated on a wrong prediction, restore
+//  the state from before it and return the frame
+//  to emulate up to again, or 0 if there's none
+//-------------------------------------------------
+
+u32 netplay_manager::poll()
+{
+	if (!m_active)
+		return 0;
+
+	receive();
+	if (m_rollback_to == ~u32(0))
+		return 0;
+
+	// restore the state from just before the first frame on a wrong prediction
+	u32 const target = m_frame;
+	u32 const frame = m_rollback_to;
+	u32 const slot = frame % SNAPSHOTS;
+	m_rollback_to = ~u32(0);
+	if (m_snapshot_frame[slot] != frame || machine().save().read_buffer(m_snapshots[slot]) != STATERR_NONE)
+	{
+		end("the peer's input arrived too late to roll back");
+		return 0;
+	}
+
+	// port state isn't saved, so put back what the last good frame was emulated with
+	for (u32 index = 0; index < m_ports.size(); index++)
+		m_ports[index]->live().digital = applied_inputs(frame - 1)[index];
+	return target;
+}
+
+
+//-------------------------------------------------
+//  send_inputs - send whatever local input the
+//  peer hasn't acknowledged yet
+//-------------------------------------------------
+
+void netplay_manager::send_inputs()
+{
+	u32 const first = std::max(m_peer_ack, (m_local_end > HISTORY) ? (m_local_end - HISTORY + 1) : 0);
+	if (first >= m_local_end)
+		return;
+	u32 const count = std::min(m_local_end - first, MAX_FRAMES_PER_PACKET);
+
+	m_packet.clear();
+	put_u32(m_packet, NETPLAY_MAGIC);
+	put_u32(m_packet, PACKET_INPUT);
+	put_u32(m_packet, m_remote_end);
+	put_u32(m_packet, first);
+	put_u32(m_packet, count);
+	for (u32 frame = first; frame < first + count; frame++)
+		for (u32 index = 0; index < m_ports.size(); index++)
+			put_u32(m_packet, local_inputs(frame)[index]);
+
+	asio::error_code ec;
+	m_transport->socket.send_to(asio::buffer(m_packet), m_transport->peer, 0, ec);
+}
+
+
+//-------------------------------------------------
+//  send_hash - send the hash of the state at a
+//  frame boundary
+//-------------------------------------------------
+
+void netplay_manager::send_hash(u32 frame, u32 crc)
+{
+	m_packet.clear();
+	put_u32(m_packet, NETPLAY_MAGIC);
+	put_u32(m_packet, PACKET_HASH);
+	put_u32(m_packet, frame);
+	put_u32(m_packet, crc);
+
+	asio::error_code ec;
+	m_transport->socket.send_to(asio::buffer(m_packet), m_transport->peer, 0, ec);
+}
+
+
+//-------------------------------------------------
+//  receive - process every packet waiting on the
+//  socket
+//-------------------------------------------------
+
+void netplay_manager::receive()
+{
+	u8 buffer[65536];
+	while (m_active)
+	{
+		asio::error_code ec;
+		asio::ip::udp::endpoint sender;
+		size_t const length = m_transport->socket.receive_from(asio::buffer(buffer), sender, 0, ec);
+		if (ec)
+			break;
+		if (sender == m_transport->peer)
+		{
+			m_last_receive = osd_ticks();
+			process_packet(buffer, length);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  process_packet - handle a packet from the peer
+//-------------------------------------------------
+
+void netplay_manager::process_packet(const u8 *data, size_t length)
+{
+	if (length < 8 || get_u32(&data[0]) != NETPLAY_MAGIC)
+		return;
+
+	switch (get_u32(&data[4]))
+	{
+	case PACKET_INPUT:
+		{
+			if (length < 20)
+				return;
+			m_peer_ack = std::max(m_peer_ack, get_u32(&data[8]));
+			u32 const first = get_u32(&data[12]);
+			u32 const count = get_u32(&data[16]);
+			if (count > MAX_FRAMES_PER_PACKET || length < 20 + size_t(count) * m_ports.size() * 4)
+				return;
+
+			// frames only ever arrive in order, since the peer resends everything we haven't acknowledged
+			const u8 *values = &data[20];
+			for (u32 frame = first; frame < first + count; frame++, values += m_ports.size() * 4)
+			{
+				if (frame != m_remote_end)
+					continue;
+
+				// the peer can't have got further ahead of us than our own history
+				if (frame >= m_frame + HISTORY - MAX_ROLLBACK)
+					break;
+
+				bool mispredicted = false;
+				for (u32 index = 0; index < m_ports.size(); index++)
+				{
+					ioport_value const value = get_u32(&values[index * 4]) & m_remote_mask[index];
+					remote_inputs(frame)[index] = value;
+					if (frame < m_frame && (applied_inputs(frame)[index] & m_remote_mask[index]) != value)
+						mispredicted = true;
+				}
+				if (mispredicted)
+					m_rollback_to = std::min(m_rollback_to, frame);
+				m_remote_end++;
+			}
+		}
+		break;
+
+	case PACKET_HASH:
+		if (length >= 16)
+		{
+			u32 const frame = get_u32(&data[8]);
+			m_remote_hashes[frame] = get_u32(&data[12]);
+			compare_hash(frame);
+		}
+		break;
+
+	case PACKET_HELLO:
+		// the peer resent its hello before it saw ours; tell it again
+		if (m_seat == 0)
+		{
+			std::vector<u8> hello(data, data + length);
+			hello[8] = u8(m_seat);
+			asio::error_code ec;
+			m_transport->socket.send_to(asio::buffer(hello), m_transport->peer, 0, ec);
+		}
+		break;
+	}
+}
+
+
+//-------------------------------------------------
+//  check_determinism - hash the state once every
+//  interval, at frame boundaries where both
+//  peers have emulated with the same input
+//-------------------------------------------------
+
+void netplay_manager::check_determinism()
+{
+	if (m_check_interval == 0)
+		return;
+
+	// a boundary is final once every frame before it has the peer's real input; snapshots
+	// that have already been replaced are skipped rather than waited for
+	while (m_next_check <= std::min(m_frame, m_remote_end) && m_rollback_to == ~u32(0))
+	{
+		u32 const slot = m_next_check % SNAPSHOTS;
+		if (m_snapshot_frame[slot] == m_next_check)
+		{
+			std::vector<u8> const &state = m_snapshots[slot];
+			u32 const crc = util::crc32_creator::simple(state.data(), u32(state.size()));
+			m_local_hashes[m_next_check] = crc;
+			send_hash(m_next_check, crc);
+			compare_hash(m_next_check);
+		}
+		m_next_check += m_check_interval;
+	}
+}
+
+
+//-------------------------------------------------
+//  compare_hash - compare our hash for a frame
+//  with the peer's once we have both
+//-------------------------------------------------
+
+void netplay_manager::compare_hash(u32 frame)
+{
+	auto const local = m_local_hashes.find(frame);
+	auto const remote = m_remote_hashes.find(frame);
+	if (local == m_local_hashes.end() || remote == m_remote_hashes.end())
+		return;
+
+	if (local->second != remote->second)
+	{
+		machine().logerror("Netplay: desync at frame %u (local %08X, peer %08X)\n", frame, local->second, remote->second);
+		machine().popmessage("Netplay desync detected at frame %u", frame);
+	}
+	m_local_hashes.erase(local);
+	m_remote_hashes.erase(remote);
+}
@@ -30,4 +30,85 @@ private:
 	running_machine &   m_machine;                  // reference to our machine
 };
 
+
+// ======================> netplay_manager
+
+// two-player netplay over UDP: each peer owns the digital inputs of one seat
+// (player 1 and the system inputs on the peer that waits for the connection,
+// everyone else on the peer that connects), and sends them a few frames before
+// they are used; frames emulated on a predicted remote input are rolled back
+// through in-memory save states and emulated again once the real one arrives
+class netplay_manager
+{
+public:
+	// construction/destruction
+	netplay_manager(running_machine &machine, const char *peer, u32 delay, u32 check_interval);
+	~netplay_manager();
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+	bool active() const { return m_active; }
+	u32 frame() const { return m_frame; }
+
+	// ioport_manager hooks, called from its per-frame update
+	void begin_frame();
+	void update_port(ioport_port &port);
+	void end_frame();
+
+	// running_machine hooks, called between timeslices
+	void frame_completed();
+	void wait_for_peer();
+	u32 poll();
+
+private:
+	struct transport;
+
+	static constexpr u32 HISTORY = 256;                 // frames of input kept, must be a power of two
+	static constexpr u32 MAX_ROLLBACK = 8;              // frames we may run ahead of the peer's input
+	static constexpr u32 SNAPSHOTS = MAX_ROLLBACK + 2;  // snapshots kept for rolling back
+	static constexpr u32 MAX_FRAMES_PER_PACKET = 32;    // unacknowledged frames resent per packet
+	static constexpr u32 TIMEOUT_SECONDS = 30;          // give up on a silent peer after this long
+
+	// internal helpers
+	bool connect(const char *peer);
+	void end(const char *reason);
+	void send_inputs();
+	void send_hash(u32 frame, u32 crc);
+	void receive();
+	void process_packet(const u8 *data, size_t length);
+	void compare_hash(u32 frame);
+	void check_determinism();
+	ioport_value *local_inputs(u32 frame) { return &m_local[(frame & (HISTORY - 1)) * m_ports.size()]; }
+	ioport_value *remote_inputs(u32 frame) { return &m_remote[(frame & (HISTORY - 1)) * m_ports.size()]; }
+	ioport_value *applied_inputs(u32 frame) { return &m_applied[(frame & (HISTORY - 1)) * m_ports.size()]; }
+
+	// internal state
+	running_machine &           m_machine;          // reference to our machine
+	std::unique_ptr<transport>  m_transport;        // UDP socket and peer address
+	bool                        m_active;           // connected and exchanging input?
+	u32                         m_seat;             // 0 if we waited for the peer, 1 if we connected
+	u32                         m_delay;            // frames between sampling local input and using it
+	u32                         m_check_interval;   // frames between determinism checks
+	u32                         m_frame;            // next frame whose input is latched (saved with the state)
+	u32                         m_local_end;        // first frame we don't have local input for
+	u32                         m_remote_end;       // first frame we don't have the peer's input for
+	u32                         m_peer_ack;         // first frame the peer doesn't have our input for
+	u32                         m_rollback_to;      // earliest frame emulated on a wrong prediction, or ~0
+	u32                         m_next_check;       // next frame whose state is hashed
+	bool                        m_capture;          // sampling local input in this frame update?
+	u32                         m_port_index;       // port being updated in this frame update
+	osd_ticks_t                 m_last_receive;     // when we last heard from the peer
+	std::vector<ioport_port *>  m_ports;            // ports in the order their values are sent
+	std::vector<ioport_value>   m_local_mask;       // digital bits we own, per port
+	std::vector<ioport_value>   m_remote_mask;      // digital bits the peer owns, per port
+	std::vector<ioport_value>   m_local;            // our input, HISTORY frames of every port
+	std::vector<ioport_value>   m_remote;           // the peer's input, likewise
+	std::vector<ioport_value>   m_applied;          // the input each frame was emulated with
+	std::vector<u8>             m_snapshots[SNAPSHOTS]; // states at the last few frame boundaries
+	u32                         m_snapshot_frame[SNAPSHOTS]; // value of m_frame for each snapshot
+	std::map<u32, u32>          m_local_hashes;     // state hashes waiting for the peer's
+	std::map<u32, u32>          m_remote_hashes;    // the peer's hashes waiting for ours
+	std::vector<u8>             m_packet;           // scratch buffer for building packets
+};
+
 #endif /* MAME_EMU_NETWORK_H */
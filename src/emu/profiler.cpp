@@ -2,7 +2,7 @@
 // copyright-holders:Aaron Giles
 /***************************************************************************
 
-    profiler.c
+    profiler.cpp
 
     Functions to manage profiling of MAME execution.
 
@@ -19,6 +19,9 @@
 
     the profiler handles a FILO list so calls may be nested.
 
+    Trace scopes (profiler_trace_scope) are recorded separately, into a
+    buffer per thread, and written out as a Chrome JSON trace.
+
 ***************************************************************************/
 
 #include "emu.h"
@@ -77,6 +80,9 @@ dummy_profiler_state::dummy_profiler_state()
 //-------------------------------------------------
 
 real_profiler_state::real_profiler_state()
+	: m_tracing(false),
+		m_trace_generation(0),
+		m_trace_start(0)
 {
 	memset(m_filo, 0, sizeof(m_filo));
 	memset(m_data, 0, sizeof(m_data));
@@ -227,3 +233,128 @@ void real_profiler_state::update_text(running_machine &machine)
 	// reset data set to 0
 	memset(m_data, 0, sizeof(m_data));
 }
+
+
+
+//-------------------------------------------------
+//  trace_start - begin recording trace scopes,
+//  discarding anything recorded before
+//-------------------------------------------------
+
+bool real_profiler_state::trace_start()
+{
+	std::lock_guard<std::mutex> lock(m_trace_lock);
+	if (tracing())
+		return true;
+
+	// threads notice the new generation and make themselves fresh buffers
+	m_trace_threads.clear();
+	m_trace_generation++;
+	m_trace_start = osd_ticks();
+	m_trace_main = std::this_thread::get_id();
+	m_tracing.store(true, std::memory_order_release);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  trace_event - record a scope beginning or
+//  ending on the calling thread
+//-------------------------------------------------
+
+void real_profiler_state::trace_event(const char *name, const char *category, char phase)
+{
+	static thread_local trace_thread *s_thread = nullptr;
+	static thread_local u32 s_generation = 0;
+
+	// the first event of a trace on this thread needs a buffer
+	if (s_generation != m_trace_generation)
+	{
+		std::lock_guard<std::mutex> lock(m_trace_lock);
+		m_trace_threads.emplace_back(std::make_unique<trace_thread>());
+		s_thread = m_trace_threads.back().get();
+		s_thread->id = std::this_thread::get_id();
+		s_thread->dropped = 0;
+		s_generation = m_trace_generation;
+	}
+
+	if (s_thread->entries.size() < TRACE_THREAD_ENTRIES)
+		s_thread->entries.push_back(trace_entry{ name, category, osd_ticks(), phase });
+	else
+		s_thread->dropped++;
+}
+
+
+//-------------------------------------------------
+//  trace_string - write a JSON string
+//-------------------------------------------------
+
+static void trace_string(FILE *file, const char *string)
+{
+	fputc('"', file);
+	for ( ; *string != 0; string++)
+	{
+		if (*string == '"' || *string == '\\')
+			fprintf(file, "\\%c", *string);
+		else if (u8(*string) < 0x20)
+			fprintf(file, "\\u%04x", u8(*string));
+		else
+			fputc(*string, file);
+	}
+	fputc('"', file);
+}
+
+
+//-------------------------------------------------
+//  trace_write - stop recording and write the
+//  trace in Chrome's JSON trace format
+//-------------------------------------------------
+
+void real_profiler_state::trace_write(const char *filename)
+{
+	std::lock_guard<std::mutex> lock(m_trace_lock);
+	if (!tracing())
+		return;
+	m_tracing.store(false, std::memory_order_release);
+
+	FILE *file = fopen(filename, "w");
+	if (file == nullptr)
+	{
+		osd_printf_error("Unable to open profiler trace %s for writing\n", filename);
+		m_trace_threads.clear();
+		return;
+	}
+
+	fprintf(file, "{\"traceEvents\":[\n");
+	double const scale = 1000000.0 / double(osd_ticks_per_second());
+	for (int tid = 0; tid < m_trace_threads.size(); tid++)
+	{
+		trace_thread const &thread = *m_trace_threads[tid];
+
+		// name the thread, then list its events
+		if (thread.id == m_trace_main)
+			fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"main\"}}", tid ? ",\n" : "", tid);
+		else
+			fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"worker %d\"}}", tid ? ",\n" : "", tid, tid);
+		for (trace_entry const &entry : thread.entries)
+		{
+			fprintf(file, ",\n{");
+			if (entry.name != nullptr)
+			{
+				fprintf(file, "\"name\":");
+				trace_string(file, entry.name);
+				fprintf(file, ",\"cat\":");
+				trace_string(file, entry.category);
+				fputc(',', file);
+			}
+			fprintf(file, "\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}", entry.phase, double(entry.time - m_trace_start) * scale, tid);
+		}
+
+		if (thread.dropped != 0)
+			osd_printf_warning("Profiler trace: %u events dropped on thread %d\n", unsigned(thread.dropped), tid);
+	}
+	fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+	fclose(file);
+
+	m_trace_threads.clear();
+}
@@ -19,6 +19,19 @@
 
     the profiler handles a FILO list so calls may be nested.
 
+    Separately, named scopes can be recorded to a trace that is written
+    out in Chrome's JSON trace format, which Perfetto and chrome://tracing
+    can display.  Any thread may record trace scopes; each gets its own
+    buffer:
+
+    {
+        profiler_trace_scope scope(device.tag(), "video");
+
+        your_work_here();
+    }
+
+    Names must stay valid until the trace has been written.
+
 ***************************************************************************/
 
 #ifndef MAME_EMU_PROFILER_H
@@ -28,6 +41,12 @@
 
 #include "attotime.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 
 
 //**************************************************************************
@@ -94,6 +113,7 @@ public:
 		return m_filoptr != nullptr;
 	}
 	const char *text(running_machine &machine);
+	osd_ticks_t ticks(profile_type type) const { return m_data[type]; }
 
 	// enable/disable
 	void enable(bool state = true)
@@ -108,9 +128,17 @@ public:
 	void start(profile_type type) { if (enabled()) real_start(type); }
 	void stop() { if (enabled()) real_stop(); }
 
+	// trace capture; trace_write stops capturing
+	bool tracing() const { return m_tracing.load(std::memory_order_acquire); }
+	bool trace_start();
+	void trace_write(const char *filename);
+	void trace_begin(const char *name, const char *category) { if (tracing()) trace_event(name, category, 'B'); }
+	void trace_end() { if (tracing()) trace_event(nullptr, nullptr, 'E'); }
+
 private:
 	void reset(bool enabled);
 	void update_text(running_machine &machine);
+	void trace_event(const char *name, const char *category, char phase);
 
 	//-------------------------------------------------
 	//  real_start - mark the beginning of a
@@ -165,12 +193,38 @@ private:
 		osd_ticks_t     start;                      // start time
 	};
 
+	// a begin or end of a traced scope
+	struct trace_entry
+	{
+		const char *    name;                       // scope name, or nullptr for an end
+		const char *    category;                   // scope category
+		osd_ticks_t     time;                       // when it happened
+		char            phase;                      // 'B' or 'E'
+	};
+
+	// the events recorded by one thread
+	struct trace_thread
+	{
+		std::vector<trace_entry> entries;           // recorded events
+		std::thread::id id;                         // thread that recorded them
+		u64             dropped;                    // events lost to the size limit
+	};
+
 	// internal state
 	filo_entry *        m_filoptr;                  // current FILO index
 	std::string         m_text;                     // profiler text
 	attotime            m_text_time;                // profiler text last update
 	filo_entry          m_filo[32];                 // array of FILO entries
 	osd_ticks_t         m_data[PROFILER_TOTAL + 1]; // array of data
+
+	std::atomic<bool>   m_tracing;                  // true while recording a trace
+	u32                 m_trace_generation;         // bumped for each trace, to retire old buffers
+	osd_ticks_t         m_trace_start;              // time the trace started
+	std::thread::id     m_trace_main;               // thread that started the trace
+	std::mutex          m_trace_lock;               // protects the list of buffers
+	std::vector<std::unique_ptr<trace_thread>> m_trace_threads; // per-thread buffers
+
+	static constexpr size_t TRACE_THREAD_ENTRIES = 1 << 21;
 };
 
 
@@ -185,6 +239,7 @@ public:
 	// getters
 	bool enabled() const { return false; }
 	const char *text(running_machine &machine) { return ""; }
+	osd_ticks_t ticks(profile_type type) const { return 0; }
 
 	// enable/disable
 	void enable(bool state = true) { }
@@ -192,6 +247,13 @@ public:
 	// start/stop
 	void start(profile_type type) { }
 	void stop() { }
+
+	// trace capture
+	bool tracing() const { return false; }
+	bool trace_start() { return false; }
+	void trace_write(const char *filename) { }
+	void trace_begin(const char *name, const char *category) { }
+	void trace_end() { }
 };
 
 
@@ -212,4 +274,22 @@ typedef dummy_profiler_state profiler_state;
 extern profiler_state g_profiler;
 
 
+
+//**************************************************************************
+//  TRACE SCOPES
+//**************************************************************************
+
+// ======================> profiler_trace_scope
+
+class profiler_trace_scope
+{
+public:
+	profiler_trace_scope(const char *name, const char *category) { g_profiler.trace_begin(name, category); }
+	~profiler_trace_scope() { g_profiler.trace_end(); }
+
+	profiler_trace_scope(const profiler_trace_scope &) = delete;
+	profiler_trace_scope &operator=(const profiler_trace_scope &) = delete;
+};
+
+
 #endif  /* MAME_EMU_PROFILER_H */
@@ -78,18 +78,6 @@ enum
 //  TYPE DEFINITIONS
 //**************************************************************************
 
-// an object_transform is used to track transformations when building an object list
-struct object_transform
-{
-	float               xoffs, yoffs;       // offset transforms
-	float               xscale, yscale;     // scale transforms
-	render_color        color;              // color transform
-	int                 orientation;        // orientation transform
-	bool                no_center;          // center the container?
-};
-
-
-
 //**************************************************************************
 //  GLOBAL VARIABLES
 //**************************************************************************
@@ -285,9 +273,11 @@ inline render_primitive *render_primitive_list::alloc(render_primitive::primitiv
 
 void render_primitive_list::release_all()
 {
-	// release all the live items while under the lock
-	m_primitive_allocator.reclaim_all(m_primlist);
-	m_reference_allocator.reclaim_all(m_reflist);
+	// drop the lists and rewind the arenas; nothing is freed
+	m_primlist.detach_all();
+	m_reflist.detach_all();
+	m_primitive_allocator.reclaim_all();
+	m_reference_allocator.reclaim_all();
 }
 
 
@@ -326,7 +316,6 @@ render_texture::render_texture()
 		m_curseq(0)
 {
 	m_sbounds.set(0, -1, 0, -1);
-	memset(m_scaled, 0, sizeof(m_scaled));
 }
 
 
@@ -366,12 +355,8 @@ void render_texture::release()
 {
 	// free all scaled versions
 	for (auto & elem : m_scaled)
-	{
-		m_manager->invalidate_all(elem.bitmap);
-		global_free(elem.bitmap);
-		elem.bitmap = nullptr;
-		elem.seqid = 0;
-	}
+		free_scaled(elem);
+	m_scaled.clear();
 
 	// invalidate references to the original bitmap as well
 	m_manager->invalidate_all(m_bitmap);
@@ -405,15 +390,8 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 
 	// invalidate all scaled versions
 	for (auto & elem : m_scaled)
-	{
-		if (elem.bitmap != nullptr)
-		{
-			m_manager->invalidate_all(elem.bitmap);
-			global_free(elem.bitmap);
-		}
-		elem.bitmap = nullptr;
-		elem.seqid = 0;
-	}
+		free_scaled(elem);
+	m_scaled.clear();
 }
 
 
@@ -468,62 +446,193 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 
 		// is it a size we already have?
 		scaled_texture *scaled = nullptr;
-		int scalenum;
-		for (scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
-		{
-			scaled = &m_scaled[scalenum];
-
-			// we need a non-NULL bitmap with matching dest size
-			if (scaled->bitmap != nullptr && dwidth == scaled->bitmap->width() && dheight == scaled->bitmap->height())
+		for (auto &elem : m_scaled)
+			if (dwidth == elem.bitmap->width() && dheight == elem.bitmap->height())
+			{
+				scaled = &elem;
 				break;
-		}
+			}
 
 		// did we get one?
-		if (scalenum == ARRAY_LENGTH(m_scaled))
+		if (scaled == nullptr)
 		{
-			int lowest = -1;
+			// stay within the memory budget
+			trim_scaled(size_t(dwidth) * dheight * sizeof(u32), primlist);
 
-			// didn't find one -- take the entry with the lowest seqnum
-			for (scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
-				if ((lowest == -1 || m_scaled[scalenum].seqid < m_scaled[lowest].seqid) && !primlist.has_reference(m_scaled[scalenum].bitmap))
-					lowest = scalenum;
-			assert_always(lowest != -1, "Too many live texture instances!");
+			// the high-quality scaler only touches the bitmaps it is given, so once we have
+			// something to show in the meantime new sizes can be produced in the background
+			bool background = (m_scaler == hq_scale && m_bitmap != nullptr && find_nearest_scaled(dwidth, dheight) != nullptr);
 
-			// throw out any existing entries
-			scaled = &m_scaled[lowest];
-			if (scaled->bitmap != nullptr)
+			m_scaled.push_back(scaled_texture{ global_alloc(bitmap_argb32(dwidth, dheight)), 0, 0, nullptr });
+			scaled = &m_scaled.back();
+			scaled->seqid = ++m_curseq;
+			m_manager->m_scaled_bytes += size_t(dwidth) * dheight * sizeof(u32);
+
+			if (background)
 			{
-				m_manager->invalidate_all(scaled->bitmap);
-				global_free(scaled->bitmap);
+				// snapshot the source so the owner is free to modify it while we work
+				scale_job *job = global_alloc(scale_job);
+				job->source.allocate(swidth, sheight);
+				for (int y = 0; y < sheight; y++)
+					memcpy(&job->source.pix32(y), &srcbitmap.pix32(m_sbounds.min_y + y, m_sbounds.min_x), swidth * sizeof(u32));
+				job->dest = scaled->bitmap;
+				job->scaler = m_scaler;
+				job->param = m_param;
+				job->item = osd_work_item_queue(m_manager->m_scale_queue, scale_job_callback, job, 0);
+				scaled->job = job;
+				if (job->item == nullptr)
+				{
+					// couldn't queue it, so do it now
+					scale_job_callback(job, 0);
+					scaled->job = nullptr;
+					global_free(job);
+				}
 			}
+			else
+			{
+				// let the scaler do the work
+				(*m_scaler)(*scaled->bitmap, srcbitmap, m_sbounds, m_param);
+			}
+		}
 
-			// allocate a new bitmap
-			scaled->bitmap = global_alloc(bitmap_argb32(dwidth, dheight));
-			scaled->seqid = ++m_curseq;
-
-			// let the scaler do the work
-			(*m_scaler)(*scaled->bitmap, srcbitmap, m_sbounds, m_param);
+		// if it isn't ready yet, draw the nearest finished size this time around
+		if (!complete_scaled(*scaled, false))
+		{
+			scaled->lastuse = ++m_curseq;
+			scaled_texture *nearest = find_nearest_scaled(dwidth, dheight);
+			if (nearest != nullptr)
+				scaled = nearest;
+			else
+				complete_scaled(*scaled, true);
 		}
 
 		// finally fill out the new info
+		scaled->lastuse = ++m_curseq;
 		primlist.add_reference(scaled->bitmap);
 		texinfo.base = &scaled->bitmap->pix32(0);
 		texinfo.rowpixels = scaled->bitmap->rowpixels();
-		texinfo.width = dwidth;
-		texinfo.height = dheight;
+		texinfo.width = scaled->bitmap->width();
+		texinfo.height = scaled->bitmap->height();
 		// palette will be set later
 		texinfo.seqid = scaled->seqid;
 	}
 }
 
 
+//-------------------------------------------------
+//  find_nearest_scaled - find the finished
+//  scaled variant closest to the given size
+//-------------------------------------------------
+
+render_texture::scaled_texture *render_texture::find_nearest_scaled(u32 dwidth, u32 dheight)
+{
+	scaled_texture *nearest = nullptr;
+	u32 bestdist = ~0U;
+	for (auto &elem : m_scaled)
+		if (complete_scaled(elem, false))
+		{
+			u32 dist = std::abs(s32(elem.bitmap->width() - dwidth)) + std::abs(s32(elem.bitmap->height() - dheight));
+			if (dist < bestdist)
+			{
+				nearest = &elem;
+				bestdist = dist;
+			}
+		}
+	return nearest;
+}
+
+
+//-------------------------------------------------
+//  complete_scaled - retire a background scale
+//  if it has finished, optionally waiting for it
+//-------------------------------------------------
+
+bool render_texture::complete_scaled(scaled_texture &scaled, bool wait)
+{
+	if (scaled.job == nullptr)
+		return true;
+
+	if (wait)
+	{
+		while (!osd_work_item_wait(scaled.job->item, osd_ticks_per_second() * 10)) { }
+	}
+	else if (!osd_work_item_wait(scaled.job->item, 0))
+		return false;
+
+	// the bitmap has only been visible to the scaler so far, so a new sequence number is enough
+	osd_work_item_release(scaled.job->item);
+	global_free(scaled.job);
+	scaled.job = nullptr;
+	scaled.seqid = ++m_curseq;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  free_scaled - free a scaled variant, waiting
+//  for any background scale to finish first
+//-------------------------------------------------
+
+void render_texture::free_scaled(scaled_texture &scaled)
+{
+	complete_scaled(scaled, true);
+	m_manager->invalidate_all(scaled.bitmap);
+	m_manager->m_scaled_bytes -= size_t(scaled.bitmap->width()) * scaled.bitmap->height() * sizeof(u32);
+	global_free(scaled.bitmap);
+	scaled.bitmap = nullptr;
+}
+
+
+//-------------------------------------------------
+//  trim_scaled - throw out least recently used
+//  variants until there is room for a new one
+//  within the memory budget
+//-------------------------------------------------
+
+void render_texture::trim_scaled(size_t newbytes, render_primitive_list &primlist)
+{
+	while (m_manager->m_scaled_bytes + newbytes > m_manager->m_scaled_budget)
+	{
+		// never throw out one that is still being scaled or is in use this frame
+		int lowest = -1;
+		for (int scalenum = 0; scalenum < m_scaled.size(); scalenum++)
+		{
+			scaled_texture &elem = m_scaled[scalenum];
+			if (elem.job == nullptr && !primlist.has_reference(elem.bitmap) && (lowest == -1 || elem.lastuse < m_scaled[lowest].lastuse))
+				lowest = scalenum;
+		}
+		if (lowest == -1)
+			break;
+
+		free_scaled(m_scaled[lowest]);
+		m_scaled.erase(m_scaled.begin() + lowest);
+	}
+}
+
+
+//-------------------------------------------------
+//  scale_job_callback - run a scaler in the
+//  background
+//-------------------------------------------------
+
+void *render_texture::scale_job_callback(void *param, int threadid)
+{
+	scale_job *job = reinterpret_cast<scale_job *>(param);
+	profiler_trace_scope scope("texture scale", "render");
+	(*job->scaler)(*job->dest, job->source, job->source.cliprect(), job->param);
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  get_adjusted_palette - return the adjusted
 //  palette for a texture
 //-------------------------------------------------
 
-const rgb_t *render_texture::get_adjusted_palette(render_container &container)
+const rgb_t *render_texture::get_adjusted_palette(render_container &container, u32 &length)
 {
+	length = 0;
+
 	// override the palette with our adjusted palette
 	switch (m_format)
 	{
@@ -533,6 +642,7 @@ const rgb_t *render_texture::get_adjusted_palette(render_container &container)
 			assert(m_bitmap->palette() != nullptr);
 
 			// return our adjusted palette
+			length = m_bitmap->palette()->max_index();
 			return container.bcg_lookup_table(m_format, m_bitmap->palette());
 
 		case TEXFORMAT_RGB32:
@@ -542,6 +652,7 @@ const rgb_t *render_texture::get_adjusted_palette(render_container &container)
 			// if no adjustment necessary, return nullptr
 			if (!container.has_brightness_contrast_gamma_changes())
 				return nullptr;
+			length = 0x400;
 			return container.bcg_lookup_table(m_format);
 
 		default:
@@ -920,7 +1031,8 @@ render_target::render_target(render_manager &manager, const internal_layout *lay
 		m_base_orientation(ROT0),
 		m_maxtexwidth(65536),
 		m_maxtexheight(65536),
-		m_transform_container(true)
+		m_transform_container(true),
+		m_item_cache_dirty(true)
 {
 	// determine the base layer configuration based on options
 	m_base_layerconfig.set_backdrops_enabled(manager.machine().options().use_backdrops());
@@ -1021,6 +1133,7 @@ void render_target::set_bounds(s32 width, s32 height, float pixel_aspect)
 	m_bounds.x1 = (float)width;
 	m_bounds.y1 = (float)height;
 	m_pixel_aspect = pixel_aspect != 0.0? pixel_aspect : 1.0;
+	m_item_cache_dirty = true;
 }
 
 
@@ -1036,6 +1149,13 @@ void render_target::set_view(int viewindex)
 	{
 		m_curview = view;
 		view->recompute(m_layerconfig);
+		m_item_cache_dirty = true;
+
+		// decode this view's artwork in parallel rather than one image at a time on first draw
+		for (item_layer layer = ITEM_LAYER_FIRST; layer < ITEM_LAYER_MAX; ++layer)
+			for (layout_view::item &curitem : view->items(layer))
+				if (curitem.element() != nullptr)
+					curitem.element()->preload();
 	}
 }
 
@@ -1049,6 +1169,7 @@ void render_target::set_max_texture_size(int maxwidth, int maxheight)
 {
 	m_maxtexwidth = maxwidth;
 	m_maxtexheight = maxheight;
+	m_item_cache_dirty = true;
 }
 
 
@@ -1361,6 +1482,11 @@ render_primitive_list &render_target::get_primitives()
 
 	// iterate over layers back-to-front, but only if we're running
 	if (m_manager.machine().phase() >= MACHINE_PHASE_RESET)
+	{
+		// the item transforms only change with the layout, so reuse them when we can
+		update_item_cache(root_xform);
+		const item_cache_entry *entry = m_item_cache.data();
+
 		for (item_layer layernum = ITEM_LAYER_FIRST; layernum < ITEM_LAYER_MAX; ++layernum)
 		{
 			int blendmode;
@@ -1370,32 +1496,16 @@ render_primitive_list &render_target::get_primitives()
 				// iterate over items in the layer
 				for (layout_view::item &curitem : m_curview->items(layer))
 				{
-					// first apply orientation to the bounds
-					render_bounds bounds = curitem.bounds();
-					apply_orientation(bounds, root_xform.orientation);
-					normalize_bounds(bounds);
-
-					// apply the transform to the item
-					object_transform item_xform;
-					item_xform.xoffs = root_xform.xoffs + bounds.x0 * root_xform.xscale;
-					item_xform.yoffs = root_xform.yoffs + bounds.y0 * root_xform.yscale;
-					item_xform.xscale = (bounds.x1 - bounds.x0) * root_xform.xscale;
-					item_xform.yscale = (bounds.y1 - bounds.y0) * root_xform.yscale;
-					item_xform.color.r = curitem.color().r * root_xform.color.r;
-					item_xform.color.g = curitem.color().g * root_xform.color.g;
-					item_xform.color.b = curitem.color().b * root_xform.color.b;
-					item_xform.color.a = curitem.color().a * root_xform.color.a;
-					item_xform.orientation = orientation_add(curitem.orientation(), root_xform.orientation);
-					item_xform.no_center = false;
-
 					// if there is no associated element, it must be a screen element
 					if (curitem.screen() != nullptr)
-						add_container_primitives(list, root_xform, item_xform, curitem.screen()->container(), blendmode);
+						add_container_primitives(list, root_xform, entry->xform, curitem.screen()->container(), blendmode);
 					else
-						add_element_primitives(list, item_xform, *curitem.element(), curitem.state(), blendmode);
+						add_element_primitives(list, *entry, *curitem.element(), curitem.state(), blendmode);
+					entry++;
 				}
 			}
 		}
+	}
 
 	// if we are not in the running stage, draw an outer box
 	else
@@ -1461,6 +1571,85 @@ render_primitive_list &render_target::get_primitives()
 }
 
 
+//-------------------------------------------------
+//  update_item_cache - recompute the transforms
+//  and element geometry for the items in the
+//  enabled layers of the current view, if the
+//  layout has changed since the last frame
+//-------------------------------------------------
+
+void render_target::update_item_cache(const object_transform &root_xform)
+{
+	// the root transform picks up changes to the target size, orientation and scaling
+	if (!m_item_cache_dirty &&
+			m_item_cache_layerconfig == m_layerconfig &&
+			m_item_cache_root.xoffs == root_xform.xoffs && m_item_cache_root.yoffs == root_xform.yoffs &&
+			m_item_cache_root.xscale == root_xform.xscale && m_item_cache_root.yscale == root_xform.yscale &&
+			m_item_cache_root.orientation == root_xform.orientation)
+		return;
+
+	m_item_cache.clear();
+	for (item_layer layernum = ITEM_LAYER_FIRST; layernum < ITEM_LAYER_MAX; ++layernum)
+	{
+		int blendmode;
+		item_layer layer = get_layer_and_blendmode(*m_curview, layernum, blendmode);
+		if (m_curview->layer_enabled(layer))
+		{
+			for (layout_view::item &curitem : m_curview->items(layer))
+			{
+				item_cache_entry entry;
+
+				// first apply orientation to the bounds
+				render_bounds bounds = curitem.bounds();
+				apply_orientation(bounds, root_xform.orientation);
+				normalize_bounds(bounds);
+
+				// apply the transform to the item
+				object_transform &item_xform = entry.xform;
+				item_xform.xoffs = root_xform.xoffs + bounds.x0 * root_xform.xscale;
+				item_xform.yoffs = root_xform.yoffs + bounds.y0 * root_xform.yscale;
+				item_xform.xscale = (bounds.x1 - bounds.x0) * root_xform.xscale;
+				item_xform.yscale = (bounds.y1 - bounds.y0) * root_xform.yscale;
+				item_xform.color.r = curitem.color().r * root_xform.color.r;
+				item_xform.color.g = curitem.color().g * root_xform.color.g;
+				item_xform.color.b = curitem.color().b * root_xform.color.b;
+				item_xform.color.a = curitem.color().a * root_xform.color.a;
+				item_xform.orientation = orientation_add(curitem.orientation(), root_xform.orientation);
+				item_xform.no_center = false;
+
+				// compute the bounds of the element quad
+				s32 width = render_round_nearest(item_xform.xscale);
+				s32 height = render_round_nearest(item_xform.yscale);
+				set_render_bounds_wh(&entry.bounds, render_round_nearest(item_xform.xoffs), render_round_nearest(item_xform.yoffs), (float) width, (float) height);
+				entry.full_bounds = entry.bounds;
+				if (item_xform.orientation & ORIENTATION_SWAP_XY)
+					std::swap(width, height);
+				entry.texwidth = std::min(width, m_maxtexwidth);
+				entry.texheight = std::min(height, m_maxtexheight);
+
+				// compute the clip rect
+				render_bounds cliprect;
+				cliprect.x0 = render_round_nearest(item_xform.xoffs);
+				cliprect.y0 = render_round_nearest(item_xform.yoffs);
+				cliprect.x1 = render_round_nearest(item_xform.xoffs + item_xform.xscale);
+				cliprect.y1 = render_round_nearest(item_xform.yoffs + item_xform.yscale);
+				sect_render_bounds(&cliprect, &m_bounds);
+
+				// determine UV coordinates and apply clipping
+				entry.texcoords = oriented_texcoords[item_xform.orientation];
+				entry.clipped = render_clip_quad(&entry.bounds, &cliprect, &entry.texcoords);
+
+				m_item_cache.push_back(entry);
+			}
+		}
+	}
+
+	m_item_cache_dirty = false;
+	m_item_cache_root = root_xform;
+	m_item_cache_layerconfig = m_layerconfig;
+}
+
+
 //-------------------------------------------------
 //  map_point_container - attempts to map a point
 //  on the specified render_target to the
@@ -1563,6 +1752,7 @@ void render_target::resolve_tags()
 void render_target::update_layer_config()
 {
 	m_curview->recompute(m_layerconfig);
+	m_item_cache_dirty = true;
 }
 
 
@@ -1913,7 +2103,7 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 					curitem.texture()->get_scaled(width, height, prim->texture, list, curitem.flags());
 
 					// set the palette
-					prim->texture.palette = curitem.texture()->get_adjusted_palette(container);
+					prim->texture.palette = curitem.texture()->get_adjusted_palette(container, prim->texture.palette_length);
 
 					// determine UV coordinates
 					prim->texcoords = oriented_texcoords[finalorient];
@@ -2041,7 +2231,7 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 //  for an element in the current state
 //-------------------------------------------------
 
-void render_target::add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode)
+void render_target::add_element_primitives(render_primitive_list &list, const item_cache_entry &entry, layout_element &element, int state, int blendmode)
 {
 	// if we're out of range, bail
 	if (state > element.maxstate())
@@ -2049,6 +2239,10 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 	if (state < 0)
 		state = 0;
 
+	// the geometry was worked out when the layout last changed; skip if it's clipped out
+	if (entry.clipped)
+		return;
+
 	// get a pointer to the relevant texture
 	render_texture *texture = element.state_texture(state);
 	if (texture != nullptr)
@@ -2056,37 +2250,15 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 		render_primitive *prim = list.alloc(render_primitive::QUAD);
 
 		// configure the basics
-		prim->color = xform.color;
-		prim->flags = PRIMFLAG_TEXORIENT(xform.orientation) | PRIMFLAG_BLENDMODE(blendmode) | PRIMFLAG_TEXFORMAT(texture->format());
-
-		// compute the bounds
-		s32 width = render_round_nearest(xform.xscale);
-		s32 height = render_round_nearest(xform.yscale);
-		set_render_bounds_wh(&prim->bounds, render_round_nearest(xform.xoffs), render_round_nearest(xform.yoffs), (float) width, (float) height);
-		prim->full_bounds = prim->bounds;
-		if (xform.orientation & ORIENTATION_SWAP_XY)
-			std::swap(width, height);
-		width = std::min(width, m_maxtexwidth);
-		height = std::min(height, m_maxtexheight);
+		prim->color = entry.xform.color;
+		prim->flags = PRIMFLAG_TEXORIENT(entry.xform.orientation) | PRIMFLAG_BLENDMODE(blendmode) | PRIMFLAG_TEXFORMAT(texture->format());
+		prim->bounds = entry.bounds;
+		prim->full_bounds = entry.full_bounds;
+		prim->texcoords = entry.texcoords;
 
 		// get the scaled texture and append it
-
-		texture->get_scaled(width, height, prim->texture, list, prim->flags);
-
-		// compute the clip rect
-		render_bounds cliprect;
-		cliprect.x0 = render_round_nearest(xform.xoffs);
-		cliprect.y0 = render_round_nearest(xform.yoffs);
-		cliprect.x1 = render_round_nearest(xform.xoffs + xform.xscale);
-		cliprect.y1 = render_round_nearest(xform.yoffs + xform.yscale);
-		sect_render_bounds(&cliprect, &m_bounds);
-
-		// determine UV coordinates and apply clipping
-		prim->texcoords = oriented_texcoords[xform.orientation];
-		bool clipped = render_clip_quad(&prim->bounds, &cliprect, &prim->texcoords);
-
-		// add to the list or free if we're clipped out
-		list.append_or_return(*prim, clipped);
+		texture->get_scaled(entry.texwidth, entry.texheight, prim->texture, list, prim->flags);
+		list.append(*prim);
 	}
 }
 
@@ -2615,6 +2787,10 @@ render_manager::render_manager(running_machine &machine)
 	: m_machine(machine),
 		m_ui_target(nullptr),
 		m_live_textures(0),
+		m_scale_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI)),
+		m_decode_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI)),
+		m_scaled_bytes(0),
+		m_scaled_budget(size_t(std::max(machine.options().texture_budget(), 0)) << 20),
 		m_ui_container(global_alloc(render_container(*this)))
 {
 	// register callbacks
@@ -2638,6 +2814,11 @@ render_manager::~render_manager()
 
 	// better not be any outstanding textures when we die
 	assert(m_live_textures == 0);
+
+	// releasing the textures waited for any background scaling, and freeing
+	// the targets waited for any artwork decoding
+	osd_work_queue_free(m_scale_queue);
+	osd_work_queue_free(m_decode_queue);
 }
 
 
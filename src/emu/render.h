@@ -168,7 +168,6 @@ class screen_device;
 class render_container;
 class render_manager;
 class render_font;
-struct object_transform;
 class layout_element;
 class layout_view;
 
@@ -217,6 +216,17 @@ struct render_quad_texuv
 };
 
 
+// object_transform - used to track transformations when building an object list
+struct object_transform
+{
+	float               xoffs, yoffs;       // offset transforms
+	float               xscale, yscale;     // scale transforms
+	render_color        color;              // color transform
+	int                 orientation;        // orientation transform
+	bool                no_center;          // center the container?
+};
+
+
 // render_texinfo - texture information
 struct render_texinfo
 {
@@ -227,6 +237,7 @@ struct render_texinfo
 	u32                 seqid;              // sequence ID
 	u64                 osddata;            // aux data to pass to osd
 	const rgb_t *       palette;            // palette for PALETTE16 textures, bcg lookup table for RGB32/YUY16
+	u32                 palette_length;     // number of entries in palette
 };
 
 
@@ -371,7 +382,9 @@ private:
 
 // ======================> render_primitive_list
 
-// render_primitive_list - an object containing a list head plus a lock
+// render_primitive_list - an object containing a list head plus a lock;
+// primitives come from a per-list arena that is rewound in one step when
+// the list is rebuilt, so consecutive primitives sit next to each other
 class render_primitive_list
 {
 	friend class render_target;
@@ -417,8 +430,8 @@ private:
 	simple_list<render_primitive> m_primlist;               // list of primitives
 	simple_list<reference> m_reflist;                       // list of references
 
-	fixed_allocator<render_primitive> m_primitive_allocator;// allocator for primitives
-	fixed_allocator<reference> m_reference_allocator;       // allocator for references
+	arena_allocator<render_primitive> m_primitive_allocator;// per-frame arena for primitives
+	arena_allocator<reference> m_reference_allocator;       // per-frame arena for references
 
 	std::recursive_mutex     m_lock;                             // lock to protect list accesses
 };
@@ -462,17 +475,34 @@ public:
 private:
 	// internal helpers
 	void get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags = 0);
-	const rgb_t *get_adjusted_palette(render_container &container);
+	const rgb_t *get_adjusted_palette(render_container &container, u32 &length);
 
-	static const int MAX_TEXTURE_SCALES = 16;
+	// a scale_job holds a private copy of the source while a variant is scaled in the background
+	struct scale_job
+	{
+		bitmap_argb32       source;                 // copy of the source bounds
+		bitmap_argb32 *     dest;                   // bitmap being filled in
+		texture_scaler_func scaler;                 // scaling callback
+		void *              param;                  // scaling callback parameter
+		osd_work_item *     item;                   // work item doing the scaling
+	};
 
 	// a scaled_texture contains a single scaled entry for a texture
 	struct scaled_texture
 	{
 		bitmap_argb32 *     bitmap;                 // final bitmap
 		u32              seqid;                  // sequence number
+		u32              lastuse;                // sequence number when last requested
+		scale_job *         job;                    // pending background scale, or nullptr once ready
 	};
 
+	// scaled variant management
+	scaled_texture *find_nearest_scaled(u32 dwidth, u32 dheight);
+	bool complete_scaled(scaled_texture &scaled, bool wait);
+	void free_scaled(scaled_texture &scaled);
+	void trim_scaled(size_t newbytes, render_primitive_list &primlist);
+	static void *scale_job_callback(void *param, int threadid);
+
 	// internal state
 	render_manager *    m_manager;                  // reference to our manager
 	render_texture *    m_next;                     // next texture (for free list)
@@ -485,7 +515,7 @@ private:
 	texture_scaler_func m_scaler;                   // scaling callback
 	void *              m_param;                    // scaling callback parameter
 	u32              m_curseq;                   // current sequence number
-	scaled_texture      m_scaled[MAX_TEXTURE_SCALES];// array of scaled variants of this texture
+	std::vector<scaled_texture> m_scaled;           // scaled variants of this texture
 };
 
 
@@ -539,7 +569,7 @@ public:
 	void set_user_settings(const user_settings &settings);
 
 	// empty the item list
-	void empty() { m_item_allocator.reclaim_all(m_itemlist); }
+	void empty() { m_itemlist.detach_all(); m_item_allocator.reclaim_all(); }
 
 	// add items to the list
 	void add_line(float x0, float y0, float x1, float y1, float width, rgb_t argb, u32 flags);
@@ -599,7 +629,7 @@ private:
 	render_container *      m_next;                 // the next container in the list
 	render_manager &        m_manager;              // reference back to the owning manager
 	simple_list<item>       m_itemlist;             // head of the item list
-	fixed_allocator<item>   m_item_allocator;       // free container items
+	arena_allocator<item>   m_item_allocator;       // arena for container items
 	screen_device *         m_screen;               // the screen device
 	user_settings           m_user;                 // user settings
 	bitmap_argb32 *         m_overlaybitmap;        // overlay bitmap
@@ -655,6 +685,9 @@ public:
 	int maxstate() const { return m_maxstate; }
 	render_texture *state_texture(int state);
 
+	// start loading any artwork in the background
+	void preload();
+
 private:
 	// a component represents an image, rectangle, or disk in an element
 	class component
@@ -676,6 +709,7 @@ private:
 		const render_color &color() const { return m_color; }
 
 		// operations
+		virtual void preload(running_machine &machine) { }
 		virtual void draw(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state) = 0;
 
 	protected:
@@ -704,16 +738,21 @@ private:
 	public:
 		// construction/destruction
 		image_component(running_machine &machine, util::xml::data_node const &compnode, const char *dirname);
+		virtual ~image_component();
 
 	protected:
 		// overrides
+		virtual void preload(running_machine &machine) override;
 		virtual void draw(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state) override;
 
 	private:
 		// internal helpers
 		void load_bitmap();
+		void decode_bitmap();
+		static void *decode_static(void *param, int threadid);
 
 		// internal state
+		osd_work_item *     m_load_item;                // background decode, if one was started
 		bitmap_argb32       m_bitmap;                   // source bitmap for images
 		std::string         m_dirname;                  // directory name of image file (for lazy loading)
 		std::unique_ptr<emu_file> m_file;               // file object for reading image/alpha files
@@ -1160,13 +1199,27 @@ public:
 	void resolve_tags();
 
 private:
+	// an item_cache_entry holds the layout-dependent geometry for one view item, so it
+	// need only be recomputed when the view, layer config or target bounds change
+	struct item_cache_entry
+	{
+		object_transform    xform;              // transform for the item
+		render_bounds       bounds;             // clipped bounds of the element quad
+		render_bounds       full_bounds;        // unclipped bounds of the element quad
+		render_quad_texuv   texcoords;          // clipped texture coordinates of the element quad
+		s32                 texwidth;           // width to scale the element texture to
+		s32                 texheight;          // height to scale the element texture to
+		bool                clipped;            // element quad is entirely clipped out
+	};
+
 	// internal helpers
 	void update_layer_config();
 	void load_layout_files(const internal_layout *layoutfile, bool singlefile);
 	bool load_layout_file(const char *dirname, const char *filename);
 	bool load_layout_file(const char *dirname, const internal_layout *layout_data);
 	void add_container_primitives(render_primitive_list &list, const object_transform &root_xform, const object_transform &xform, render_container &container, int blendmode);
-	void add_element_primitives(render_primitive_list &list, const object_transform &xform, layout_element &element, int state, int blendmode);
+	void add_element_primitives(render_primitive_list &list, const item_cache_entry &entry, layout_element &element, int state, int blendmode);
+	void update_item_cache(const object_transform &root_xform);
 	bool map_point_internal(s32 target_x, s32 target_y, render_container *container, float &mapped_x, float &mapped_y, ioport_port *&mapped_input_port, ioport_value &mapped_input_mask);
 
 	// config callbacks
@@ -1217,6 +1270,10 @@ private:
 	s32                     m_clear_extents[MAX_CLEAR_EXTENTS]; // array of clear extents
 	bool                    m_transform_container;      // determines whether the screen container is transformed by the core renderer,
 														// otherwise the respective render API will handle the transformation (scale, offset)
+	std::vector<item_cache_entry> m_item_cache;         // cached per-item geometry for the current view
+	bool                    m_item_cache_dirty;         // cached geometry must be rebuilt
+	object_transform        m_item_cache_root;          // root transform the cache was built for
+	render_layer_config     m_item_cache_layerconfig;   // layer configuration the cache was built for
 
 	static render_screen_list s_empty_screen_list;
 };
@@ -1227,6 +1284,7 @@ private:
 // contains machine-global information and operations
 class render_manager
 {
+	friend class render_texture;
 	friend class render_target;
 
 public:
@@ -1240,6 +1298,7 @@ public:
 	// global queries
 	bool is_live(screen_device &screen) const;
 	float max_update_rate() const;
+	size_t scaled_texture_bytes() const { return m_scaled_bytes; }
 
 	// targets
 	render_target *target_alloc(const internal_layout *layoutfile = nullptr, u32 flags = 0);
@@ -1260,6 +1319,9 @@ public:
 	render_texture *texture_alloc(texture_scaler_func scaler = nullptr, void *param = nullptr);
 	void texture_free(render_texture *texture);
 
+	// artwork
+	osd_work_queue *decode_queue() const { return m_decode_queue; }
+
 	// fonts
 	render_font *font_alloc(const char *filename = nullptr);
 	void font_free(render_font *font);
@@ -1290,6 +1352,12 @@ private:
 	u32                             m_live_textures;    // number of live textures
 	fixed_allocator<render_texture> m_texture_allocator;// texture allocator
 
+	// scaled texture variants
+	osd_work_queue *                m_scale_queue;      // queue for background scaling
+	osd_work_queue *                m_decode_queue;     // queue for background artwork decoding
+	size_t                          m_scaled_bytes;     // bytes held by all scaled variants
+	size_t                          m_scaled_budget;    // bytes of scaled variants to keep before evicting
+
 	// containers for the UI and for screens
 	render_container *              m_ui_container;     // UI container
 	simple_list<render_container>   m_screen_container_list; // list of containers for the screen
@@ -13,6 +13,7 @@
 #include "eminline.h"
 #include "video/rgbutil.h"
 #include "render.h"
+#include "osdcore.h"
 
 
 template<typename _PixelType, int _SrcShiftR, int _SrcShiftG, int _SrcShiftB, int _DstShiftR, int _DstShiftG, int _DstShiftB, bool _NoDestRead = false, bool _BilinearFilter = false>
@@ -28,6 +29,18 @@ private:
 		s32 endx, endy;
 	};
 
+	// a horizontal strip of the target drawn by one work item
+	struct strip_work
+	{
+		const render_primitive_list *primlist;
+		void *dstdata;
+		u32 width, height;
+		u32 pitch;
+		s32 miny, maxy;
+	};
+
+	static constexpr int MAX_STRIPS = 16;
+
 	// internal helpers
 	static inline bool is_opaque(float alpha) { return (alpha >= (_NoDestRead ? 0.5f : 1.0f)); }
 	static inline bool is_transparent(float alpha) { return (alpha < (_NoDestRead ? 0.5f : 0.0001f)); }
@@ -337,10 +350,18 @@ private:
 	//  draw_line - draw a line or point
 	//-------------------------------------------------
 
-	static void draw_line(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void draw_line(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 miny, s32 maxy, u32 pitch)
 	{
-		// internal tables
-		static u32 s_cosine_table[2049];
+		// internal tables, built once even when several strips get here at the same time
+		static const struct cosine_table
+		{
+			cosine_table()
+			{
+				for (int entry = 0; entry <= 2048; entry++)
+					value[entry] = int(double(1.0 / cos(atan(double(entry) / 2048.0))) * 0x10000000 + 0.5);
+			}
+			u32 value[2049];
+		} s_cosine_table;
 
 		// compute the start/end coordinates
 		int x1 = int(prim.bounds.x0 * 65536.0f);
@@ -353,11 +374,6 @@ private:
 
 		if (PRIMFLAG_GET_ANTIALIAS(prim.flags))
 		{
-			// build up the cosine table if we haven't yet
-			if (s_cosine_table[0] == 0)
-				for (int entry = 0; entry <= 2048; entry++)
-					s_cosine_table[entry] = int(double(1.0 / cos(atan(double(entry) / 2048.0))) * 0x10000000 + 0.5);
-
 			int beam = prim.width * 65536.0f;
 			if (beam < 0x00010000)
 				beam = 0x00010000;
@@ -374,7 +390,7 @@ private:
 					dy--;
 				x1 >>= 16;
 				int xx = x2 >> 16;
-				int bwidth = mul_32x32_hi(beam << 4, s_cosine_table[abs(sy) >> 5]);
+				int bwidth = mul_32x32_hi(beam << 4, s_cosine_table.value[abs(sy) >> 5]);
 				y1 -= bwidth >> 1; // start back half the diameter
 				for (;;)
 				{
@@ -382,7 +398,7 @@ private:
 					{
 						dx = bwidth;    // init diameter of beam
 						dy = y1 >> 16;
-						if (dy >= 0 && dy < height)
+						if (dy >= miny && dy < maxy)
 							draw_aa_pixel(dstdata, pitch, x1, dy, apply_intensity(0xff & (~y1 >> 8), col));
 						dy++;
 						dx -= 0x10000 - (0xffff & y1); // take off amount plotted
@@ -390,11 +406,11 @@ private:
 						dx >>= 16;                   // adjust to pixel (solid) count
 						while (dx--)                 // plot rest of pixels
 						{
-							if (dy >= 0 && dy < height)
+							if (dy >= miny && dy < maxy)
 								draw_aa_pixel(dstdata, pitch, x1, dy, col);
 							dy++;
 						}
-						if (dy >= 0 && dy < height)
+						if (dy >= miny && dy < maxy)
 							draw_aa_pixel(dstdata, pitch, x1, dy, apply_intensity(a1,col));
 					}
 					if (x1 == xx) break;
@@ -410,11 +426,11 @@ private:
 					dx--;
 				y1 >>= 16;
 				int yy = y2 >> 16;
-				int bwidth = mul_32x32_hi(beam << 4,s_cosine_table[abs(sx) >> 5]);
+				int bwidth = mul_32x32_hi(beam << 4,s_cosine_table.value[abs(sx) >> 5]);
 				x1 -= bwidth >> 1; // start back half the width
 				for (;;)
 				{
-					if (y1 >= 0 && y1 < height)
+					if (y1 >= miny && y1 < maxy)
 					{
 						dy = bwidth;    // calc diameter of beam
 						dx = x1 >> 16;
@@ -457,7 +473,7 @@ private:
 			{
 				for (;;)
 				{
-					if (x1 >= 0 && x1 < width && y1 >= 0 && y1 < height)
+					if (x1 >= 0 && x1 < width && y1 >= miny && y1 < maxy)
 						draw_aa_pixel(dstdata, pitch, x1, y1, col);
 					if (x1 == x2) break;
 					x1 += sx;
@@ -473,7 +489,7 @@ private:
 			{
 				for (;;)
 				{
-					if (x1 >= 0 && x1 < width && y1 >= 0 && y1 < height)
+					if (x1 >= 0 && x1 < width && y1 >= miny && y1 < maxy)
 						draw_aa_pixel(dstdata, pitch, x1, y1, col);
 					if (y1 == y2) break;
 					y1 += sy;
@@ -498,7 +514,7 @@ private:
 	//  draw_rect - draw a solid rectangle
 	//-------------------------------------------------
 
-	static void draw_rect(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void draw_rect(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 miny, s32 maxy, u32 pitch)
 	{
 		render_bounds fpos = prim.bounds;
 		assert(fpos.x0 <= fpos.x1);
@@ -515,10 +531,10 @@ private:
 		if (startx >= width) startx = width;
 		if (endx < 0) endx = 0;
 		if (endx >= width) endx = width;
-		if (starty < 0) starty = 0;
-		if (starty >= height) starty = height;
-		if (endy < 0) endy = 0;
-		if (endy >= height) endy = height;
+		if (starty < miny) starty = miny;
+		if (starty >= maxy) starty = maxy;
+		if (endy < miny) endy = miny;
+		if (endy >= maxy) endy = maxy;
 
 		// bail if nothing left
 		if (fpos.x0 > fpos.x1 || fpos.y0 > fpos.y1)
@@ -1825,7 +1841,7 @@ private:
 	//  drawing routine
 	//-------------------------------------------------
 
-	static void setup_and_draw_textured_quad(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void setup_and_draw_textured_quad(const render_primitive &prim, _PixelType *dstdata, s32 width, s32 height, s32 miny, s32 maxy, u32 pitch)
 	{
 		assert(prim.bounds.x0 <= prim.bounds.x1);
 		assert(prim.bounds.y0 <= prim.bounds.y1);
@@ -1872,6 +1888,17 @@ private:
 			setup.startv -= 0x8000;
 		}
 
+		// clip to the strip, stepping U/V down to the first row exactly as the
+		// rasterizers would so that the result matches drawing the whole target
+		if (setup.starty < miny)
+		{
+			setup.startu += (miny - setup.starty) * setup.dudy;
+			setup.startv += (miny - setup.starty) * setup.dvdy;
+			setup.starty = miny;
+		}
+		if (setup.starty > maxy) setup.starty = maxy;
+		if (setup.endy > maxy) setup.endy = maxy;
+
 		// render based on the texture coordinates
 		switch (prim.flags & (PRIMFLAG_TEXFORMAT_MASK | PRIMFLAG_BLENDMODE_MASK))
 		{
@@ -1931,30 +1958,86 @@ private:
 	//**************************************************************************
 
 	//-------------------------------------------------
-	//  draw_primitives - draw a series of primitives
-	//  using a software rasterizer
+	//  draw_strip - draw a series of primitives,
+	//  clipped to rows miny to maxy - 1, using a
+	//  software rasterizer
 	//-------------------------------------------------
 
-public:
-	static void draw_primitives(const render_primitive_list &primlist, void *dstdata, u32 width, u32 height, u32 pitch)
+	static void draw_strip(const render_primitive_list &primlist, void *dstdata, u32 width, u32 height, u32 pitch, s32 miny, s32 maxy)
 	{
 		// loop over the list and render each element
 		for (const render_primitive *prim = primlist.first(); prim != nullptr; prim = prim->next())
 			switch (prim->type)
 			{
 				case render_primitive::LINE:
-					draw_line(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
+					draw_line(*prim, reinterpret_cast<_PixelType *>(dstdata), width, miny, maxy, pitch);
 					break;
 
 				case render_primitive::QUAD:
 					if (!prim->texture.base)
-						draw_rect(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
+						draw_rect(*prim, reinterpret_cast<_PixelType *>(dstdata), width, miny, maxy, pitch);
 					else
-						setup_and_draw_textured_quad(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, pitch);
+						setup_and_draw_textured_quad(*prim, reinterpret_cast<_PixelType *>(dstdata), width, height, miny, maxy, pitch);
 					break;
 
 				default:
 					throw emu_fatalerror("Unexpected render_primitive type");
 			}
 	}
+
+	//-------------------------------------------------
+	//  draw_strip_callback - work item callback for
+	//  drawing a single strip
+	//-------------------------------------------------
+
+	static void *draw_strip_callback(void *param, int threadid)
+	{
+		const strip_work &work = *reinterpret_cast<const strip_work *>(param);
+		draw_strip(*work.primlist, work.dstdata, work.width, work.height, work.pitch, work.miny, work.maxy);
+		return nullptr;
+	}
+
+public:
+	//-------------------------------------------------
+	//  draw_primitives - draw a series of primitives
+	//  using a software rasterizer
+	//-------------------------------------------------
+
+	static void draw_primitives(const render_primitive_list &primlist, void *dstdata, u32 width, u32 height, u32 pitch)
+	{
+		draw_strip(primlist, dstdata, width, height, pitch, 0, height);
+	}
+
+	//-------------------------------------------------
+	//  draw_primitives - draw a series of primitives,
+	//  splitting the target into horizontal strips
+	//  that are rendered in parallel on a work queue
+	//-------------------------------------------------
+
+	static void draw_primitives(const render_primitive_list &primlist, void *dstdata, u32 width, u32 height, u32 pitch, osd_work_queue *queue, int strips)
+	{
+		// every primitive is clipped against every strip, so don't make them too thin
+		strips = std::min(std::min(strips, MAX_STRIPS), int(height / 16));
+		if (queue == nullptr || strips <= 1)
+		{
+			draw_primitives(primlist, dstdata, width, height, pitch);
+			return;
+		}
+
+		strip_work work[MAX_STRIPS];
+		for (int stripnum = 0; stripnum < strips; stripnum++)
+		{
+			work[stripnum].primlist = &primlist;
+			work[stripnum].dstdata = dstdata;
+			work[stripnum].width = width;
+			work[stripnum].height = height;
+			work[stripnum].pitch = pitch;
+			work[stripnum].miny = height * stripnum / strips;
+			work[stripnum].maxy = height * (stripnum + 1) / strips;
+		}
+
+		osd_work_item_queue_multiple(queue, draw_strip_callback, strips, work, sizeof(work[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(queue, osd_ticks_per_second() * 10);
+	}
+
 };
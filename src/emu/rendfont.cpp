@@ -529,6 +529,7 @@ inline render_font::glyph &render_font::get_char(char32_t chnum)
 			clip.max_x = glyph_ch.bitmap.width() - 1;
 			clip.max_y = glyph_ch.bitmap.height() - 1;
 			render_texture::hq_scale(gl.bitmap, glyph_ch.bitmap, clip, nullptr);
+			atlas_store(gl);
 
 			/* wrap a texture around the bitmap */
 			gl.texture = m_manager.texture_alloc(render_texture::hq_scale);
@@ -564,6 +565,9 @@ render_font::render_font(render_manager &manager, const char *filename)
 	, m_osdfont()
 	, m_height_cmd(0)
 	, m_yoffs_cmd(0)
+	, m_atlas_x(ATLAS_SIZE)
+	, m_atlas_y(ATLAS_SIZE)
+	, m_atlas_shelf(0)
 {
 	memset(m_glyphs, 0, sizeof(m_glyphs));
 	memset(m_glyphs_cmd, 0, sizeof(m_glyphs_cmd));
@@ -776,11 +780,53 @@ void render_font::char_expand(char32_t chnum, glyph &gl)
 	}
 
 	// wrap a texture around the bitmap
+	atlas_store(gl);
 	gl.texture = m_manager.texture_alloc(render_texture::hq_scale);
 	gl.texture->set_bitmap(gl.bitmap, gl.bitmap.cliprect(), TEXFORMAT_ARGB32);
 }
 
 
+//-------------------------------------------------
+//  atlas_store - move a freshly expanded glyph
+//  bitmap into the atlas, leaving the glyph with
+//  a view of its place there
+//-------------------------------------------------
+
+void render_font::atlas_store(glyph &gl)
+{
+	// glyphs too big for a page keep their own bitmap
+	int const width = gl.bitmap.width();
+	int const height = gl.bitmap.height();
+	if (!gl.bitmap.valid() || (width > ATLAS_SIZE) || (height > ATLAS_SIZE))
+		return;
+
+	// start a new shelf if this one is full, and a new page if that doesn't fit either;
+	// pages are never reallocated because textures and primitive lists point into them
+	if (m_atlas_x + width > ATLAS_SIZE)
+	{
+		m_atlas_x = 0;
+		m_atlas_y += m_atlas_shelf;
+		m_atlas_shelf = 0;
+	}
+	if (m_atlas_y + height > ATLAS_SIZE)
+	{
+		m_atlas.emplace_back(std::make_unique<bitmap_argb32>(ATLAS_SIZE, ATLAS_SIZE));
+		m_atlas.back()->fill(0);
+		m_atlas_x = m_atlas_y = m_atlas_shelf = 0;
+	}
+
+	// copy the pixels over and point the glyph at them
+	bitmap_argb32 &page = *m_atlas.back();
+	rectangle const slot(m_atlas_x, m_atlas_x + width - 1, m_atlas_y, m_atlas_y + height - 1);
+	for (int y = 0; y < height; y++)
+		memcpy(&page.pix32(m_atlas_y + y, m_atlas_x), &gl.bitmap.pix32(y), width * sizeof(u32));
+	gl.bitmap.wrap(page, slot);
+
+	m_atlas_x += width;
+	m_atlas_shelf = std::max(m_atlas_shelf, height);
+}
+
+
 //-------------------------------------------------
 //  get_char_texture_and_bounds - return the
 //  texture for a character and compute the
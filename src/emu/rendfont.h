@@ -67,7 +67,7 @@ private:
 		s32                 bmwidth, bmheight;  // width and height of bitmap
 		const char *        rawdata;            // pointer to the raw data for this one
 		render_texture *    texture;            // pointer to a texture for rendering and sizing
-		bitmap_argb32       bitmap;             // pointer to the bitmap containing the raw data
+		bitmap_argb32       bitmap;             // bitmap containing the raw data, usually a view of an atlas page
 
 		rgb_t               color;
 	};
@@ -84,6 +84,7 @@ private:
 	// helpers
 	glyph &get_char(char32_t chnum);
 	void char_expand(char32_t chnum, glyph &ch);
+	void atlas_store(glyph &gl);
 	bool load_cached_bdf(const char *filename);
 	bool load_bdf();
 	bool load_cached(emu_file &file, u64 length, u32 hash);
@@ -108,8 +109,14 @@ private:
 	EQUIVALENT_ARRAY(m_glyphs, glyph *) m_glyphs_cmd; // array of glyph subtables
 	std::vector<char>   m_rawdata_cmd;      // pointer to the raw data for the font
 
+	std::vector<std::unique_ptr<bitmap_argb32>> m_atlas; // pages that expanded glyphs are packed into
+	int                 m_atlas_x;          // next free column on the current shelf of the last page
+	int                 m_atlas_y;          // top of the current shelf of the last page
+	int                 m_atlas_shelf;      // height of the current shelf of the last page
+
 	// constants
 	static const u64 CACHED_BDF_HASH_SIZE   = 1024;
+	static constexpr int ATLAS_SIZE         = 512;
 };
 
 void convert_command_glyph(std::string &s);
@@ -506,6 +506,18 @@ render_texture *layout_element::state_texture(int state)
 }
 
 
+//-------------------------------------------------
+//  preload - start loading any artwork used by
+//  the components in the background
+//-------------------------------------------------
+
+void layout_element::preload()
+{
+	for (auto const &curcomp : m_complist)
+		curcomp->preload(machine());
+}
+
+
 //-------------------------------------------------
 //  element_scale - scale an element by rendering
 //  all the components at the appropriate
@@ -643,6 +655,7 @@ void layout_element::component::normalize_bounds(float xoffs, float yoffs, float
 
 layout_element::image_component::image_component(running_machine &machine, util::xml::data_node const &compnode, const char *dirname)
 	: component(machine, compnode, dirname)
+	, m_load_item(nullptr)
 	, m_hasalpha(false)
 {
 	if (dirname != nullptr)
@@ -653,13 +666,40 @@ layout_element::image_component::image_component(running_machine &machine, util:
 }
 
 
+//-------------------------------------------------
+//  ~image_component - destructor
+//-------------------------------------------------
+
+layout_element::image_component::~image_component()
+{
+	if (m_load_item != nullptr)
+	{
+		osd_work_item_wait(m_load_item, 100 * osd_ticks_per_second());
+		osd_work_item_release(m_load_item);
+	}
+}
+
+
+//-------------------------------------------------
+//  preload - start decoding the image on the
+//  artwork work queue
+//-------------------------------------------------
+
+void layout_element::image_component::preload(running_machine &machine)
+{
+	if (m_load_item == nullptr && !m_bitmap.valid())
+		m_load_item = osd_work_item_queue(machine.render().decode_queue(), decode_static, this, 0);
+}
+
+
 //-------------------------------------------------
 //  draw - draw a component
 //-------------------------------------------------
 
 void layout_element::image_component::draw(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state)
 {
-	if (!m_bitmap.valid())
+	// the bitmap can't be looked at while a background decode is filling it
+	if (m_load_item != nullptr || !m_bitmap.valid())
 		load_bitmap();
 
 	bitmap_argb32 destsub(dest, bounds);
@@ -674,17 +714,17 @@ void layout_element::image_component::draw(running_machine &machine, bitmap_argb
 
 void layout_element::image_component::load_bitmap()
 {
-	// load the basic bitmap
-	assert(m_file != nullptr);
-	m_hasalpha = render_load_png(m_bitmap, *m_file, m_dirname.c_str(), m_imagefile.c_str());
-
-	// load the alpha bitmap if specified
-	if (m_bitmap.valid() && !m_alphafile.empty())
-		render_load_png(m_bitmap, *m_file, m_dirname.c_str(), m_alphafile.c_str(), true);
-
-	// PNG failed, let's try JPG
-	if (!m_bitmap.valid())
-		render_load_jpeg(m_bitmap, *m_file, m_dirname.c_str(), m_imagefile.c_str());
+	// collect the background decode if there was one, or decode now
+	if (m_load_item != nullptr)
+	{
+		osd_work_item_wait(m_load_item, 100 * osd_ticks_per_second());
+		osd_work_item_release(m_load_item);
+		m_load_item = nullptr;
+	}
+	else
+	{
+		decode_bitmap();
+	}
 
 	// if we can't load the bitmap, allocate a dummy one and report an error
 	if (!m_bitmap.valid())
@@ -705,6 +745,39 @@ void layout_element::image_component::load_bitmap()
 }
 
 
+//-------------------------------------------------
+//  decode_bitmap - read the PNG/JPG files; only
+//  touches this component, so it can run on the
+//  artwork work queue
+//-------------------------------------------------
+
+void layout_element::image_component::decode_bitmap()
+{
+	// load the basic bitmap
+	assert(m_file != nullptr);
+	m_hasalpha = render_load_png(m_bitmap, *m_file, m_dirname.c_str(), m_imagefile.c_str());
+
+	// load the alpha bitmap if specified
+	if (m_bitmap.valid() && !m_alphafile.empty())
+		render_load_png(m_bitmap, *m_file, m_dirname.c_str(), m_alphafile.c_str(), true);
+
+	// PNG failed, let's try JPG
+	if (!m_bitmap.valid())
+		render_load_jpeg(m_bitmap, *m_file, m_dirname.c_str(), m_imagefile.c_str());
+}
+
+
+//-------------------------------------------------
+//  decode_static - work item callback
+//-------------------------------------------------
+
+void *layout_element::image_component::decode_static(void *param, int threadid)
+{
+	reinterpret_cast<image_component *>(param)->decode_bitmap();
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  text_component - constructor
 //-------------------------------------------------
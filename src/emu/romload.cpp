@@ -40,9 +40,9 @@ static osd_file::error common_process_file(emu_options &options, const char *loc
 	return filerr;
 }
 
-std::unique_ptr<emu_file> common_process_file(emu_options &options, const char *location, bool has_crc, u32 crc, const rom_entry *romp, osd_file::error &filerr)
+std::unique_ptr<emu_file> common_process_file(emu_options &options, const char *location, bool has_crc, u32 crc, const rom_entry *romp, osd_file::error &filerr, u32 openflags)
 {
-	auto image_file = std::make_unique<emu_file>(options.media_path(), OPEN_FLAG_READ);
+	auto image_file = std::make_unique<emu_file>(options.media_path(), openflags);
 
 	if (has_crc)
 		filerr = image_file->open(location, PATH_SEPARATOR, ROM_GETNAME(romp), crc);
@@ -429,7 +429,7 @@ void rom_load_manager::verify_length_and_hash(const char *name, u32 explength, c
 	}
 
 	/* If there is no good dump known, write it */
-	util::hash_collection &acthashes = m_file->hashes(hashes.hash_types().c_str());
+	util::hash_collection const acthashes = hash_cache::instance().hashes(*m_file, hashes.hash_types().c_str());
 	if (hashes.flag(util::hash_collection::FLAG_NO_DUMP))
 	{
 		m_errorstring.append(string_format("%s NO GOOD DUMP KNOWN\n", name));
@@ -541,35 +541,32 @@ void rom_load_manager::region_post_process(const char *rgntag, bool invert)
 
 
 /*-------------------------------------------------
-    open_rom_file - open a ROM file, searching
-    up the parent and loading by checksum
+    find_rom_file - locate and open a ROM file,
+    searching up the parent and loading by
+    checksum; safe to call from a work item
 -------------------------------------------------*/
 
-int rom_load_manager::open_rom_file(const char *regiontag, const rom_entry *romp, std::string &tried_file_names, bool from_list)
+std::unique_ptr<emu_file> rom_load_manager::find_rom_file(const char *regiontag, const rom_entry *romp, std::string &tried_file_names, osd_file::error &filerr) const
 {
-	osd_file::error filerr = osd_file::error::NOT_FOUND;
-	u32 romsize = rom_file_size(romp);
+	std::unique_ptr<emu_file> file;
+	filerr = osd_file::error::NOT_FOUND;
 	tried_file_names = "";
 
-	/* update status display */
-	display_loading_rom_message(ROM_GETNAME(romp), from_list);
-
 	/* extract CRC to use for searching */
 	u32 crc = 0;
 	bool has_crc = util::hash_collection(ROM_GETHASHDATA(romp)).crc(crc);
 
 	/* attempt reading up the chain through the parents. It automatically also
 	 attempts any kind of load by checksum supported by the archives. */
-	m_file = nullptr;
-	for (int drv = driver_list::find(machine().system()); m_file == nullptr && drv != -1; drv = driver_list::clone(drv)) {
+	for (int drv = driver_list::find(machine().system()); file == nullptr && drv != -1; drv = driver_list::clone(drv)) {
 		if (tried_file_names.length() != 0)
 			tried_file_names += " ";
 		tried_file_names += driver_list::driver(drv).name;
-		m_file = common_process_file(machine().options(), driver_list::driver(drv).name, has_crc, crc, romp, filerr);
+		file = common_process_file(machine().options(), driver_list::driver(drv).name, has_crc, crc, romp, filerr, OPEN_FLAG_READ | OPEN_FLAG_NO_PRELOAD);
 	}
 
 	/* if the region is load by name, load the ROM from there */
-	if (m_file == nullptr && regiontag != nullptr)
+	if (file == nullptr && regiontag != nullptr)
 	{
 		// check if we are dealing with softwarelists. if so, locationtag
 		// is actually a concatenation of: listname + setname + parentname
@@ -618,37 +615,82 @@ int rom_load_manager::open_rom_file(const char *regiontag, const rom_entry *romp
 		if (!is_list)
 		{
 			tried_file_names += " " + tag1;
-			m_file = common_process_file(machine().options(), tag1.c_str(), has_crc, crc, romp, filerr);
+			file = common_process_file(machine().options(), tag1.c_str(), has_crc, crc, romp, filerr, OPEN_FLAG_READ | OPEN_FLAG_NO_PRELOAD);
 		}
 		else
 		{
 			// try to load from list/setname
-			if ((m_file == nullptr) && (tag2.c_str() != nullptr))
+			if ((file == nullptr) && (tag2.c_str() != nullptr))
 			{
 				tried_file_names += " " + tag2;
-				m_file = common_process_file(machine().options(), tag2.c_str(), has_crc, crc, romp, filerr);
+				file = common_process_file(machine().options(), tag2.c_str(), has_crc, crc, romp, filerr, OPEN_FLAG_READ | OPEN_FLAG_NO_PRELOAD);
 			}
 			// try to load from list/parentname
-			if ((m_file == nullptr) && has_parent && (tag3.c_str() != nullptr))
+			if ((file == nullptr) && has_parent && (tag3.c_str() != nullptr))
 			{
 				tried_file_names += " " + tag3;
-				m_file = common_process_file(machine().options(), tag3.c_str(), has_crc, crc, romp, filerr);
+				file = common_process_file(machine().options(), tag3.c_str(), has_crc, crc, romp, filerr, OPEN_FLAG_READ | OPEN_FLAG_NO_PRELOAD);
 			}
 			// try to load from setname
-			if ((m_file == nullptr) && (tag4.c_str() != nullptr))
+			if ((file == nullptr) && (tag4.c_str() != nullptr))
 			{
 				tried_file_names += " " + tag4;
-				m_file = common_process_file(machine().options(), tag4.c_str(), has_crc, crc, romp, filerr);
+				file = common_process_file(machine().options(), tag4.c_str(), has_crc, crc, romp, filerr, OPEN_FLAG_READ | OPEN_FLAG_NO_PRELOAD);
 			}
 			// try to load from parentname
-			if ((m_file == nullptr) && has_parent && (tag5.c_str() != nullptr))
+			if ((file == nullptr) && has_parent && (tag5.c_str() != nullptr))
 			{
 				tried_file_names += " " + tag5;
-				m_file = common_process_file(machine().options(), tag5.c_str(), has_crc, crc, romp, filerr);
+				file = common_process_file(machine().options(), tag5.c_str(), has_crc, crc, romp, filerr, OPEN_FLAG_READ | OPEN_FLAG_NO_PRELOAD);
 			}
 		}
 	}
 
+	return file;
+}
+
+
+/*-------------------------------------------------
+    open_rom_file - open a ROM file, taking it
+    from the prefetch list if it was opened ahead
+-------------------------------------------------*/
+
+int rom_load_manager::open_rom_file(const char *regiontag, const rom_entry *romp, std::string &tried_file_names, bool from_list)
+{
+	osd_file::error filerr = osd_file::error::NOT_FOUND;
+	u32 romsize = rom_file_size(romp);
+
+	/* update status display */
+	display_loading_rom_message(ROM_GETNAME(romp), from_list);
+
+	/* use the prefetched file if this is the ROM it was opened for */
+	rom_prefetch *prefetch = nullptr;
+	if (m_prefetch_used < m_prefetch.size() && m_prefetch[m_prefetch_used]->romp == romp)
+	{
+		prefetch = m_prefetch[m_prefetch_used++].get();
+		if (prefetch->item != nullptr)
+		{
+			osd_work_item_wait(prefetch->item, 100 * osd_ticks_per_second());
+			osd_work_item_release(prefetch->item);
+			prefetch->item = nullptr;
+		}
+		prefetch_queue_next();
+	}
+
+	/* otherwise, or if the work item couldn't finish, search for it here */
+	if (prefetch != nullptr && !prefetch->failed)
+	{
+		m_file = std::move(prefetch->file);
+		m_file_direct = prefetch->direct;
+		tried_file_names = std::move(prefetch->tried_file_names);
+		filerr = prefetch->filerr;
+	}
+	else
+	{
+		m_file = find_rom_file(regiontag, romp, tried_file_names, filerr);
+		m_file_direct = false;
+	}
+
 	/* update counters */
 	m_romsloaded++;
 	m_romsloadedsize += romsize;
@@ -658,6 +700,182 @@ int rom_load_manager::open_rom_file(const char *regiontag, const rom_entry *romp
 }
 
 
+/*-------------------------------------------------
+    prefetch_rom_entries - queue every file in a
+    region to be opened, decompressed and hashed
+    on the work queue ahead of the loader
+-------------------------------------------------*/
+
+void rom_load_manager::prefetch_rom_entries(const char *regiontag, const rom_entry *parent_region, device_t *device)
+{
+	m_prefetch.clear();
+	m_prefetch_used = m_prefetch_queued = 0;
+	if (m_prefetch_queue == nullptr)
+		return;
+
+	/* one entry per file the loader will open, in the order it will open them */
+	for (const rom_entry *romp = rom_first_file(parent_region); romp != nullptr; romp = rom_next_file(romp))
+	{
+		if (ROM_GETBIOSFLAGS(romp) != 0 && ROM_GETBIOSFLAGS(romp) != device->system_bios())
+			continue;
+		auto prefetch = std::make_unique<rom_prefetch>();
+		prefetch->manager = this;
+		prefetch->regiontag = regiontag;
+		prefetch->romp = romp;
+		m_prefetch.push_back(std::move(prefetch));
+	}
+
+	/* a single file gains nothing from the queue */
+	if (m_prefetch.size() < 2)
+	{
+		m_prefetch.clear();
+		return;
+	}
+
+	prefetch_find_direct(parent_region, device);
+	while (m_prefetch_queued < m_prefetch.size() && m_prefetch_queued < PREFETCH_DEPTH)
+		prefetch_queue_next();
+}
+
+
+/*-------------------------------------------------
+    prefetch_find_direct - find the files that
+    are loaded whole and untouched by anything
+    else in the region, so the work queue can
+    decompress them straight into place
+-------------------------------------------------*/
+
+void rom_load_manager::prefetch_find_direct(const rom_entry *parent_region, device_t *device)
+{
+	struct written_range { u32 start, end; rom_prefetch *owner; };
+	std::vector<written_range> ranges;
+	std::vector<rom_prefetch *> candidates;
+	size_t next = 0;
+	u32 lastflags = 0;
+
+	for (const rom_entry *romp = parent_region + 1; !ROMENTRY_ISREGIONEND(romp); romp++)
+	{
+		/* fills and copies land wherever they say; a copy out of this region needs its source in order too */
+		if (ROMENTRY_ISFILL(romp) || ROMENTRY_ISCOPY(romp))
+		{
+			if (ROMENTRY_ISCOPY(romp) && machine().root_device().memregion(ROM_GETNAME(romp)) == m_region)
+				return;
+			ranges.push_back({ ROM_GETOFFSET(romp), ROM_GETOFFSET(romp) + ROM_GETLENGTH(romp), nullptr });
+			continue;
+		}
+		if (!ROMENTRY_ISFILE(romp) && !ROMENTRY_ISCONTINUE(romp) && !ROMENTRY_ISIGNORE(romp) && !ROMENTRY_ISRELOAD(romp))
+			continue;
+
+		/* work out the flags the loader will use for this piece */
+		rom_entry modified_romp = *romp;
+		if (!ROM_INHERITSFLAGS(&modified_romp))
+			lastflags = modified_romp.flags();
+		else
+			modified_romp.set_flags((modified_romp.flags() & ~ROM_INHERITEDFLAGS) | lastflags);
+		if (ROMENTRY_ISIGNORE(&modified_romp))
+			continue;
+
+		/* pieces of a file we don't prefetch can still overlap one we do */
+		rom_prefetch *owner = nullptr;
+		if (ROMENTRY_ISFILE(romp) && next < m_prefetch.size() && m_prefetch[next]->romp == romp)
+			owner = m_prefetch[next++].get();
+		u32 const numbytes = ROM_GETLENGTH(&modified_romp);
+		u32 const groupsize = ROM_GETGROUPSIZE(&modified_romp);
+		u32 const numgroups = (numbytes + groupsize - 1) / groupsize;
+		u32 const end = ROM_GETOFFSET(&modified_romp) + numgroups * groupsize + (numgroups - 1) * ROM_GETSKIPCOUNT(&modified_romp);
+		ranges.push_back({ ROM_GETOFFSET(&modified_romp), end, owner });
+
+		/* only a file read whole, byte for byte, in a single piece */
+		bool const simple = ROM_GETBITWIDTH(&modified_romp) == 8 && ROM_GETBITSHIFT(&modified_romp) == 0 && ROM_GETSKIPCOUNT(&modified_romp) == 0 && (groupsize == 1 || !ROM_ISREVERSED(&modified_romp));
+		bool const single = !ROMENTRY_ISCONTINUE(romp + 1) && !ROMENTRY_ISIGNORE(romp + 1) && !ROMENTRY_ISRELOAD(romp + 1);
+		if (owner != nullptr && simple && single && numbytes != 0 && end <= m_region->bytes())
+			candidates.push_back(owner);
+	}
+
+	/* keep the ones nothing else writes over */
+	for (rom_prefetch *candidate : candidates)
+	{
+		auto const mine = std::find_if(ranges.begin(), ranges.end(), [candidate] (const written_range &range) { return range.owner == candidate; });
+		bool const overlapped = std::any_of(ranges.begin(), ranges.end(),
+				[candidate, &mine] (const written_range &range) { return range.owner != candidate && range.start < mine->end && mine->start < range.end; });
+		if (!overlapped)
+		{
+			candidate->direct_base = m_region->base() + mine->start;
+			candidate->direct_length = mine->end - mine->start;
+		}
+	}
+}
+
+
+/*-------------------------------------------------
+    prefetch_queue_next - queue the next file in
+    the prefetch list, keeping at most
+    PREFETCH_DEPTH files ahead of the loader
+-------------------------------------------------*/
+
+void rom_load_manager::prefetch_queue_next()
+{
+	if (m_prefetch_queued >= m_prefetch.size() || m_prefetch_queued >= m_prefetch_used + PREFETCH_DEPTH)
+		return;
+
+	rom_prefetch &prefetch = *m_prefetch[m_prefetch_queued++];
+	prefetch.item = osd_work_item_queue(m_prefetch_queue, prefetch_rom_static, &prefetch, 0);
+
+	/* if we couldn't queue it, the loader will find it itself */
+	if (prefetch.item == nullptr)
+		prefetch.failed = true;
+}
+
+
+/*-------------------------------------------------
+    prefetch_rom_static - work item callback that
+    opens a ROM file and computes its hashes, so
+    inflate/un7z and CRC/SHA-1 run off the
+    loader thread
+-------------------------------------------------*/
+
+void *rom_load_manager::prefetch_rom_static(void *param, int threadid)
+{
+	rom_prefetch &prefetch = *reinterpret_cast<rom_prefetch *>(param);
+	try
+	{
+		prefetch.file = prefetch.manager->find_rom_file(prefetch.regiontag, prefetch.romp, prefetch.tried_file_names, prefetch.filerr);
+		if (prefetch.file != nullptr)
+		{
+			/* a file with its own part of the region goes straight there */
+			std::string const types = util::hash_collection(ROM_GETHASHDATA(prefetch.romp)).hash_types();
+			u32 actual;
+			if (prefetch.direct_base != nullptr && prefetch.file->size() <= prefetch.direct_length)
+				prefetch.direct = prefetch.file->read_direct(prefetch.direct_base, prefetch.direct_length, types.c_str(), actual);
+			hash_cache::instance().hashes(*prefetch.file, types.c_str());
+		}
+	}
+	catch (...)
+	{
+		/* leave errors to be reported when the loader retries on its own thread */
+		prefetch.file = nullptr;
+		prefetch.direct = false;
+		prefetch.failed = true;
+	}
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    ~rom_prefetch - make sure the work item is
+    done with us before we go away
+-------------------------------------------------*/
+
+rom_load_manager::rom_prefetch::~rom_prefetch()
+{
+	if (item != nullptr)
+	{
+		osd_work_item_wait(item, 100 * osd_ticks_per_second());
+		osd_work_item_release(item);
+	}
+}
+
+
 /*-------------------------------------------------
     rom_fread - cheesy fread that fills with
     random data for a nullptr file
@@ -711,7 +929,21 @@ int rom_load_manager::read_rom_data(const rom_entry *parent_region, const rom_en
 
 	/* special case for simple loads */
 	if (datamask == 0xff && (groupsize == 1 || !reversed) && skip == 0)
+	{
+		/* a whole file may already be in place, or can be read or decompressed straight there */
+		if (ROMENTRY_ISFILE(romp) && m_file != nullptr)
+		{
+			u32 actual;
+			if (m_file_direct)
+			{
+				m_file_direct = false;
+				return m_file->size();
+			}
+			if (m_file->read_direct(base, numbytes, util::hash_collection(ROM_GETHASHDATA(romp)).hash_types().c_str(), actual))
+				return actual;
+		}
 		return rom_fread(base, numbytes, parent_region);
+	}
 
 	/* use a temporary buffer for complex loads */
 	tempbufsize = std::min(TEMPBUFFER_MAX_SIZE, numbytes);
@@ -867,6 +1099,10 @@ void rom_load_manager::process_rom_entries(const char *regiontag, const rom_entr
 {
 	u32 lastflags = 0;
 
+	/* start opening the region's files in parallel; fills, copies and the
+	   data layout itself are still applied here, in order */
+	prefetch_rom_entries(regiontag, parent_region, device);
+
 	/* loop until we hit the end of this region */
 	while (!ROMENTRY_ISREGIONEND(romp))
 	{
@@ -934,8 +1170,9 @@ void rom_load_manager::process_rom_entries(const char *regiontag, const rom_entr
 					LOG(("Verify finished\n"));
 				}
 
-				/* reseek to the start and clear the baserom so we don't reverify */
-				if (m_file != nullptr)
+				/* reseek to the start and clear the baserom so we don't reverify; only
+				   reloads need it, and it would inflate a direct-read archive member again */
+				if (m_file != nullptr && ROMENTRY_ISRELOAD(romp))
 					m_file->seek(0, SEEK_SET);
 				baserom = nullptr;
 				explength = 0;
@@ -954,6 +1191,9 @@ void rom_load_manager::process_rom_entries(const char *regiontag, const rom_entr
 			romp++; /* something else; skip */
 		}
 	}
+
+	/* anything left over was never asked for */
+	m_prefetch.clear();
 }
 
 
@@ -1196,6 +1436,10 @@ void rom_load_manager::process_disk_entries(const char *regiontag, const rom_ent
 				m_knownbad++;
 			}
 
+			/* decompress ahead of sequential reads on another thread if requested */
+			if (machine().options().chd_readahead() > 0)
+				chd->orig_chd().enable_read_ahead(machine().options().chd_readahead());
+
 			/* if not read-only, make the diff file */
 			if (!DISK_ISREADONLY(romp))
 			{
@@ -1376,6 +1620,234 @@ void rom_load_manager::load_software_part_region(device_t &device, software_list
 }
 
 
+/*-------------------------------------------------
+    region_cache_path - return the shared region
+    cache file for a key
+-------------------------------------------------*/
+
+std::string rom_load_manager::region_cache_path(const std::string &key) const
+{
+	return string_format("%s" PATH_SEPARATOR "%s.bin", machine().options().regioncache_directory(), key);
+}
+
+
+/*-------------------------------------------------
+    region_cache_key - compute the key a region's
+    loaded contents are shared under; returns
+    false if the region can't be shared
+-------------------------------------------------*/
+
+bool rom_load_manager::region_cache_key(device_t &device, const rom_entry *region, u8 width, endianness_t endianness, std::string &key) const
+{
+	key.clear();
+	if (!*machine().options().regioncache_directory())
+		return false;
+
+	/* the key covers the layout and the hashes of the files, not their names,
+	   so clones and other systems with the same BIOS share one copy */
+	util::sha1_creator sha1;
+	auto const append = [&sha1] (u32 value) { sha1.append(&value, sizeof(value)); };
+	append(1); // layout version
+	append(ROMREGION_GETLENGTH(region));
+	append(ROMREGION_GETFLAGS(region));
+	append(width);
+	append(u32(endianness));
+	append(device.system_bios());
+	for (const rom_entry *romp = region + 1; !ROMENTRY_ISREGIONEND(romp); romp++)
+	{
+		/* copies depend on another region, and files must be known by SHA1 */
+		if (ROMENTRY_ISCOPY(romp))
+			return false;
+		if (ROMENTRY_ISFILE(romp))
+		{
+			util::sha1_t filesha1;
+			if (!util::hash_collection(ROM_GETHASHDATA(romp)).sha1(filesha1))
+				return false;
+			sha1.append(filesha1.m_raw, sizeof(filesha1.m_raw));
+		}
+		else if (ROMENTRY_ISFILL(romp))
+		{
+			sha1.append(romp->hashdata().c_str(), romp->hashdata().length());
+		}
+		append(ROM_GETOFFSET(romp));
+		append(ROM_GETLENGTH(romp));
+		append(ROM_GETFLAGS(romp));
+	}
+
+	key = sha1.finish().as_string();
+	return true;
+}
+
+
+/*-------------------------------------------------
+    region_cache_map - create a region as a
+    copy-on-write view of a cached file, so every
+    instance mapping it shares the same pages
+-------------------------------------------------*/
+
+bool rom_load_manager::region_cache_map(const char *regiontag, const std::string &key, u32 length, u8 width, endianness_t endianness)
+{
+	osd_file::ptr file;
+	u64 filesize;
+	if (osd_file::open(region_cache_path(key), OPEN_FLAG_READ, file, filesize) != osd_file::error::NONE || filesize != length)
+		return false;
+
+	void *data;
+	u64 maplength;
+	if (file->map_private(data, maplength) != osd_file::error::NONE || maplength != length)
+		return false;
+
+	m_region = machine().memory().region_map(regiontag, std::move(file), reinterpret_cast<u8 *>(data), length, width, endianness);
+	LOG(("Mapped %X bytes @ %p from region cache\n", m_region->bytes(), m_region->base()));
+	return true;
+}
+
+
+/*-------------------------------------------------
+    region_cache_read - fill a buffer from a
+    cache file; returns false if the file is
+    missing or the wrong size
+-------------------------------------------------*/
+
+bool rom_load_manager::region_cache_read(const std::string &key, u8 *data, u32 length) const
+{
+	osd_file::ptr file;
+	u64 filesize;
+	if (osd_file::open(region_cache_path(key), OPEN_FLAG_READ, file, filesize) != osd_file::error::NONE || filesize != length)
+		return false;
+
+	for (u32 done = 0; done < length; )
+	{
+		u32 actual = 0;
+		if (file->read(data + done, done, length - done, actual) != osd_file::error::NONE || actual == 0)
+			return false;
+		done += actual;
+	}
+	return true;
+}
+
+
+/*-------------------------------------------------
+    region_cache_write - write a buffer to a
+    cache file
+-------------------------------------------------*/
+
+void rom_load_manager::region_cache_write(const std::string &key, const u8 *data, u32 length) const
+{
+	/* write under a temporary name and rename it into place, so no instance
+	   ever maps a partial file */
+	std::string const path = region_cache_path(key);
+	std::string const temp = string_format("%s.%08x.tmp", path, u32(osd_ticks()));
+	osd_file::ptr file;
+	u64 filesize;
+	if (osd_file::open(temp, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, file, filesize) != osd_file::error::NONE)
+		return;
+
+	bool success = true;
+	for (u32 written = 0; success && written < length; )
+	{
+		u32 actual = 0;
+		success = file->write(data + written, written, length - written, actual) == osd_file::error::NONE && actual != 0;
+		written += actual;
+	}
+	file.reset();
+
+	if (!success || std::rename(temp.c_str(), path.c_str()) != 0)
+		osd_file::remove(temp);
+}
+
+
+/*-------------------------------------------------
+    region_cache_store - write a loaded and
+    post-processed region to the region cache
+-------------------------------------------------*/
+
+void rom_load_manager::region_cache_store(const char *regiontag, const std::string &key)
+{
+	memory_region *region = machine().root_device().memregion(regiontag);
+	if (region != nullptr && region->bytes() != 0)
+		region_cache_write(key, region->base(), region->bytes());
+}
+
+
+/*-------------------------------------------------
+    region_transform - apply a driver's in-place
+    transform (typically a decryption) to part
+    of a region, reusing the result from the
+    region cache when the same transform has
+    already been applied to the same ROMs
+-------------------------------------------------*/
+
+void rom_load_manager::region_transform(const char *regiontag, const char *name, u32 version, u32 offset, u32 length, u32 granularity, region_transform_func transform)
+{
+	memory_region *region = machine().root_device().memregion(regiontag);
+	if (region == nullptr)
+		fatalerror("region_transform called on missing region \"%s\"\n", regiontag);
+	if (offset > region->bytes() || length > region->bytes() - offset)
+		fatalerror("region_transform called with range %X-%X outside region \"%s\"\n", offset, offset + length - 1, regiontag);
+	u8 *const base = region->base() + offset;
+
+	/* the key follows the region from its loaded contents through every
+	   transform applied so far; regions that can't be cached have none */
+	std::string key;
+	auto const current = m_region_keys.find(region->name());
+	if (current != m_region_keys.end())
+	{
+		util::sha1_creator sha1;
+		auto const append = [&sha1] (u32 value) { sha1.append(&value, sizeof(value)); };
+		sha1.append(current->second.c_str(), current->second.length());
+		sha1.append(name, strlen(name) + 1);
+		append(version);
+		append(offset);
+		append(length);
+		key = sha1.finish().as_string();
+
+		if (region_cache_read(key, base, length))
+		{
+			LOG(("Read %X bytes of \"%s\" transformed by %s from region cache\n", length, regiontag, name));
+			current->second = std::move(key);
+			return;
+		}
+	}
+
+	/* split the range on granularity boundaries and transform the pieces in parallel */
+	osd_work_queue *queue = (granularity != 0 && length > granularity) ? osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI) : nullptr;
+	if (queue == nullptr)
+	{
+		transform(0, length);
+	}
+	else
+	{
+		u32 const chunk = std::max<u32>(granularity, (length / TRANSFORM_CHUNKS + granularity - 1) / granularity * granularity);
+		std::vector<transform_chunk> chunks;
+		for (u32 start = 0; start < length; start += chunk)
+			chunks.push_back(transform_chunk{ &transform, start, std::min(length - start, chunk) + start });
+		osd_work_item_queue_multiple(queue, transform_chunk_static, chunks.size(), &chunks[0], sizeof(chunks[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(queue, osd_ticks_per_second() * 10)) { }
+		osd_work_queue_free(queue);
+	}
+
+	if (!key.empty())
+	{
+		region_cache_write(key, base, length);
+		current->second = std::move(key);
+	}
+}
+
+
+/*-------------------------------------------------
+    transform_chunk_static - work queue callback
+    applying a transform to one piece of a range
+-------------------------------------------------*/
+
+void *rom_load_manager::transform_chunk_static(void *param, int threadid)
+{
+	transform_chunk const &chunk = *reinterpret_cast<transform_chunk const *>(param);
+	(*chunk.transform)(chunk.start, chunk.end);
+	return nullptr;
+}
+
+
 /*-------------------------------------------------
     process_region_list - process a region list
 -------------------------------------------------*/
@@ -1383,6 +1855,7 @@ void rom_load_manager::load_software_part_region(device_t &device, software_list
 void rom_load_manager::process_region_list()
 {
 	std::string regiontag;
+	std::vector<std::pair<std::string, std::string>> cachestore;
 
 	/* loop until we hit the end */
 	device_iterator deviter(machine().root_device());
@@ -1405,6 +1878,20 @@ void rom_load_manager::process_region_list()
 				if (machine().device(regiontag.c_str()) != nullptr)
 					normalize_flags_for_device(machine(), regiontag.c_str(), width, endianness);
 
+				/* share a copy another instance already loaded, if there is one */
+				std::string cachekey;
+				if (region_cache_key(device, region, width, endianness, cachekey) && region_cache_map(regiontag.c_str(), cachekey, regionlength, width, endianness))
+				{
+					m_region_keys.emplace(regiontag, std::move(cachekey));
+					for (const rom_entry *rom = rom_first_file(region); rom != nullptr; rom = rom_next_file(rom))
+						if (ROM_GETBIOSFLAGS(rom) == 0 || ROM_GETBIOSFLAGS(rom) == device.system_bios())
+						{
+							m_romsloaded++;
+							m_romsloadedsize += rom_file_size(rom);
+						}
+					continue;
+				}
+
 				/* remember the base and length */
 				m_region = machine().memory().region_alloc(regiontag.c_str(), regionlength, width, endianness);
 				LOG(("Allocated %X bytes @ %p\n", m_region->bytes(), m_region->base()));
@@ -1424,7 +1911,15 @@ void rom_load_manager::process_region_list()
 #endif
 
 				/* now process the entries in the region */
+				int const problems = m_errors + m_warnings;
 				process_rom_entries(device.shortname(), region, region + 1, &device, false);
+
+				/* only share regions that loaded cleanly */
+				if (!cachekey.empty() && (m_errors + m_warnings) == problems)
+				{
+					m_region_keys.emplace(regiontag, cachekey);
+					cachestore.emplace_back(regiontag, std::move(cachekey));
+				}
 			}
 			else if (ROMREGION_ISDISKDATA(region))
 				process_disk_entries(regiontag.c_str(), region, region + 1, nullptr);
@@ -1435,9 +1930,15 @@ void rom_load_manager::process_region_list()
 		for (const rom_entry *region = rom_first_region(device); region != nullptr; region = rom_next_region(region))
 		{
 			regiontag = rom_region_name(device, region);
-			region_post_process(regiontag.c_str(), ROMREGION_ISINVERTED(region));
+			memory_region *const memregion = machine().root_device().memregion(regiontag.c_str());
+			if (memregion == nullptr || !memregion->is_mapped())
+				region_post_process(regiontag.c_str(), ROMREGION_ISINVERTED(region));
 		}
 
+	/* cached copies hold the post-processed data */
+	for (auto const &entry : cachestore)
+		region_cache_store(entry.first.c_str(), entry.second);
+
 	/* and finally register all per-game parameters */
 	for (device_t &device : deviter)
 		for (const rom_entry *param = rom_first_parameter(device); param != nullptr; param = rom_next_parameter(param))
@@ -1455,6 +1956,10 @@ void rom_load_manager::process_region_list()
 
 rom_load_manager::rom_load_manager(running_machine &machine)
 	: m_machine(machine)
+	, m_file_direct(false)
+	, m_prefetch_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI))
+	, m_prefetch_used(0)
+	, m_prefetch_queued(0)
 {
 	/* figure out which BIOS we are using */
 
@@ -1481,14 +1986,42 @@ rom_load_manager::rom_load_manager(running_machine &machine)
 	/* reset the disk list */
 	m_chd_list.clear();
 
+	/* account for the hunks cached by the disks we open */
+	machine.memreport().add_reporter([this] (memory_report &report)
+	{
+		for (auto &curdisk : m_chd_list)
+			report.add("CHD hunk caches", curdisk->region(), curdisk->orig_chd().cache_bytes() + curdisk->diff_chd().cache_bytes());
+	});
+
+	/* look archives up in the index rather than opening each one */
+	if (machine.options().rom_index())
+		archive_index::instance().load(machine.options().cfg_directory());
+
+	/* reuse the hashes of files that haven't changed since the last run */
+	if (machine.options().hash_cache())
+		hash_cache::instance().load(machine.options().cfg_directory());
+
 	/* process the ROM entries we were passed */
 	process_region_list();
+	if (machine.options().rom_index())
+		archive_index::instance().save();
+	if (machine.options().hash_cache())
+		hash_cache::instance().save();
 
 	/* display the results and exit */
 	display_rom_load_results(false);
 }
 
 
+rom_load_manager::~rom_load_manager()
+{
+	/* outstanding work items must finish before the queue goes */
+	m_prefetch.clear();
+	if (m_prefetch_queue != nullptr)
+		osd_work_queue_free(m_prefetch_queue);
+}
+
+
 // -------------------------------------------------
 // rom_build_entries - builds a rom_entry vector
 // from a tiny_rom_entry array
@@ -179,6 +179,7 @@ class rom_load_manager
 public:
 	// construction/destruction
 	rom_load_manager(running_machine &machine);
+	~rom_load_manager();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
@@ -201,7 +202,50 @@ public:
 
 	void load_software_part_region(device_t &device, software_list_device &swlist, const char *swname, const rom_entry *start_region);
 
+	/* ----- transformed regions ----- */
+
+	// transforms bytes [start, end) of the range passed to region_transform in place
+	typedef std::function<void (u32 start, u32 end)> region_transform_func;
+
+	/* apply a transform (typically a decryption) to part of a region as loaded; with
+	   -regioncache_directory set the result is kept keyed by the region's ROM hashes,
+	   the transform name and its version, so bump the version whenever the transform
+	   changes; a nonzero granularity lets pieces of that size be transformed in parallel */
+	void region_transform(const char *regiontag, const char *name, u32 version, u32 offset, u32 length, u32 granularity, region_transform_func transform);
+
 private:
+	// number of files opened ahead of the loader at once
+	static constexpr size_t PREFETCH_DEPTH = 8;
+
+	// number of pieces a parallel transform is split into
+	static constexpr u32 TRANSFORM_CHUNKS = 64;
+
+	// one piece of a transform on the work queue
+	struct transform_chunk
+	{
+		const region_transform_func *transform;   // transform to apply
+		u32                 start;                // first byte of the piece
+		u32                 end;                  // byte following the piece
+	};
+
+	// a ROM file being opened, decompressed and hashed on the work queue
+	struct rom_prefetch
+	{
+		~rom_prefetch();
+
+		rom_load_manager *  manager = nullptr;    // owning manager
+		const char *        regiontag = nullptr;  // location tag to search
+		const rom_entry *   romp = nullptr;       // entry being opened
+		osd_work_item *     item = nullptr;       // work item, or nullptr once collected
+		bool                failed = false;       // loader must search for the file itself
+		std::unique_ptr<emu_file> file;           // opened file, or nullptr if not found
+		u8 *                direct_base = nullptr; // region bytes only this file writes, or nullptr
+		u32                 direct_length = 0;    // length of that range
+		bool                direct = false;       // file was already read into the range
+		std::string         tried_file_names;     // locations searched
+		osd_file::error     filerr = osd_file::error::NOT_FOUND; // result of the search
+	};
+
 	void determine_bios_rom(device_t &device, const char *specbios);
 	void count_roms();
 	void fill_random(u8 *base, u32 length);
@@ -211,7 +255,12 @@ private:
 	void display_loading_rom_message(const char *name, bool from_list);
 	void display_rom_load_results(bool from_list);
 	void region_post_process(const char *rgntag, bool invert);
+	std::unique_ptr<emu_file> find_rom_file(const char *regiontag, const rom_entry *romp, std::string &tried_file_names, osd_file::error &filerr) const;
 	int open_rom_file(const char *regiontag, const rom_entry *romp, std::string &tried_file_names, bool from_list);
+	void prefetch_rom_entries(const char *regiontag, const rom_entry *parent_region, device_t *device);
+	void prefetch_find_direct(const rom_entry *parent_region, device_t *device);
+	void prefetch_queue_next();
+	static void *prefetch_rom_static(void *param, int threadid);
 	int rom_fread(u8 *buffer, int length, const rom_entry *parent_region);
 	int read_rom_data(const rom_entry *parent_region, const rom_entry *romp);
 	void fill_rom_data(const rom_entry *romp);
@@ -220,6 +269,13 @@ private:
 	chd_error open_disk_diff(emu_options &options, const rom_entry *romp, chd_file &source, chd_file &diff_chd);
 	void process_disk_entries(const char *regiontag, const rom_entry *parent_region, const rom_entry *romp, const char *locationtag);
 	void normalize_flags_for_device(running_machine &machine, const char *rgntag, u8 &width, endianness_t &endian);
+	std::string region_cache_path(const std::string &key) const;
+	bool region_cache_key(device_t &device, const rom_entry *region, u8 width, endianness_t endianness, std::string &key) const;
+	bool region_cache_map(const char *regiontag, const std::string &key, u32 length, u8 width, endianness_t endianness);
+	bool region_cache_read(const std::string &key, u8 *data, u32 length) const;
+	void region_cache_write(const std::string &key, const u8 *data, u32 length) const;
+	void region_cache_store(const char *regiontag, const std::string &key);
+	static void *transform_chunk_static(void *param, int threadid);
 	void process_region_list();
 
 
@@ -236,10 +292,18 @@ private:
 	u32                 m_romstotalsize;      // total size of ROMs to read
 
 	std::unique_ptr<emu_file>  m_file;               /* current file */
+	bool                m_file_direct;        // current file was read into the region ahead
 	std::vector<std::unique_ptr<open_chd>> m_chd_list;     /* disks */
 
 	memory_region *     m_region;             // info about current region
 
+	osd_work_queue *    m_prefetch_queue;     // queue for opening ROM files ahead
+	std::vector<std::unique_ptr<rom_prefetch>> m_prefetch; /* files of the current region */
+	size_t              m_prefetch_used;      // entries handed to the loader so far
+	size_t              m_prefetch_queued;    // entries queued so far
+
+	std::unordered_map<std::string, std::string> m_region_keys; // region cache key of each region's current contents
+
 	std::string         m_errorstring;        // error string
 	std::string         m_softwarningstring;  // software warning string
 };
@@ -247,7 +311,7 @@ private:
 
 /* ----- Helpers ----- */
 
-std::unique_ptr<emu_file> common_process_file(emu_options &options, const char *location, bool has_crc, u32 crc, const rom_entry *romp, osd_file::error &filerr);
+std::unique_ptr<emu_file> common_process_file(emu_options &options, const char *location, bool has_crc, u32 crc, const rom_entry *romp, osd_file::error &filerr, u32 openflags = OPEN_FLAG_READ);
 
 /* return pointer to the first ROM region within a source */
 const rom_entry *rom_first_region(const device_t &device);
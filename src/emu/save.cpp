@@ -62,7 +62,9 @@ enum
 save_manager::save_manager(running_machine &machine)
 	: m_machine(machine),
 		m_reg_allowed(true),
-		m_illegal_regs(0)
+		m_illegal_regs(0),
+		m_blocks_dirty(false),
+		m_state_size(0)
 {
 }
 
@@ -77,7 +79,10 @@ void save_manager::allow_registration(bool allowed)
 	// allow/deny registration
 	m_reg_allowed = allowed;
 	if (!allowed)
+	{
 		dump_registry();
+		build_blocks();
+	}
 }
 
 
@@ -184,6 +189,7 @@ void save_manager::save_memory(device_t *device, const char *module, const char
 
 	// insert us into the list
 	m_entry_list.insert(insert_after,std::make_unique<state_entry>(val, totalname.c_str(), device, module, tag ? tag : "", index, valsize, valcount));
+	m_blocks_dirty = true;
 }
 
 
@@ -321,6 +327,330 @@ save_error save_manager::write_file(emu_file &file)
 }
 
 
+//-------------------------------------------------
+//  write_buffer - snapshot the current state into
+//  a buffer; the buffer is only reallocated if
+//  the state has grown since it was last used
+//-------------------------------------------------
+
+save_error save_manager::write_buffer(std::vector<u8> &buffer)
+{
+	// if we have illegal registrations, return an error
+	if (m_illegal_regs > 0)
+		return STATERR_ILLEGAL_REGISTRATIONS;
+
+	// call the pre-save functions
+	dispatch_presave();
+
+	// then copy all the data
+	buffer.resize(state_size());
+	u8 *dest = buffer.data();
+	for (copy_block const &block : m_blocks)
+	{
+		memcpy(dest, block.m_data, block.m_size);
+		dest += block.m_size;
+	}
+	return STATERR_NONE;
+}
+
+
+//-------------------------------------------------
+//  read_buffer - restore a snapshot taken with
+//  write_buffer
+//-------------------------------------------------
+
+save_error save_manager::read_buffer(const std::vector<u8> &buffer)
+{
+	// if we have illegal registrations, return an error
+	if (m_illegal_regs > 0)
+		return STATERR_ILLEGAL_REGISTRATIONS;
+
+	// the snapshot must have come from this machine
+	if (buffer.size() != state_size())
+		return STATERR_INVALID_HEADER;
+
+	// copy all the data back
+	const u8 *src = buffer.data();
+	for (copy_block const &block : m_blocks)
+	{
+		memcpy(block.m_data, src, block.m_size);
+		src += block.m_size;
+	}
+
+	// call the post-load functions
+	dispatch_postload();
+
+	return STATERR_NONE;
+}
+
+
+//-------------------------------------------------
+//  make_delta - encode the difference between two
+//  snapshots as runs of unchanged bytes and runs
+//  of bytes XORed with the original
+//-------------------------------------------------
+
+static void write_delta_length(std::vector<u8> &delta, size_t length)
+{
+	// lengths are stored as little-endian base-128 varints
+	while (length >= 0x80)
+	{
+		delta.push_back(u8(length | 0x80));
+		length >>= 7;
+	}
+	delta.push_back(u8(length));
+}
+
+void save_manager::make_delta(const std::vector<u8> &from, const std::vector<u8> &to, std::vector<u8> &delta)
+{
+	assert(from.size() == to.size());
+
+	// most of a machine's state doesn't change from frame to frame, so compare a word
+	// at a time to get through the unchanged runs quickly
+	size_t const size = to.size();
+	const u8 *const a = from.data();
+	const u8 *const b = to.data();
+	delta.clear();
+	size_t pos = 0;
+	while (pos < size)
+	{
+		// skip the unchanged bytes
+		size_t start = pos;
+		while (pos + 8 <= size && !memcmp(&a[pos], &b[pos], 8))
+			pos += 8;
+		while (pos < size && a[pos] == b[pos])
+			pos++;
+		if (pos == size)
+			break;
+		write_delta_length(delta, pos - start);
+
+		// a changed run ends at the first stretch of eight unchanged bytes, so that
+		// isolated matching bytes are cheaper to XOR than to encode as a run
+		start = pos;
+		while (pos < size && (pos + 8 > size || memcmp(&a[pos], &b[pos], 8)))
+			pos++;
+		write_delta_length(delta, pos - start);
+		for (size_t i = start; i < pos; i++)
+			delta.push_back(a[i] ^ b[i]);
+	}
+}
+
+
+//-------------------------------------------------
+//  apply_delta - apply a delta made with
+//  make_delta; returns false if it is malformed
+//-------------------------------------------------
+
+static bool read_delta_length(const std::vector<u8> &delta, size_t &offset, size_t &length)
+{
+	length = 0;
+	for (int shift = 0; offset < delta.size() && shift < 64; shift += 7)
+	{
+		u8 const byte = delta[offset++];
+		length |= size_t(byte & 0x7f) << shift;
+		if (!(byte & 0x80))
+			return true;
+	}
+	return false;
+}
+
+bool save_manager::apply_delta(std::vector<u8> &state, const std::vector<u8> &delta)
+{
+	size_t offset = 0;
+	size_t pos = 0;
+	while (offset < delta.size())
+	{
+		size_t skip, count;
+		if (!read_delta_length(delta, offset, skip) || !read_delta_length(delta, offset, count))
+			return false;
+		if (skip > state.size() - pos || count > state.size() - pos - skip || count > delta.size() - offset)
+			return false;
+
+		pos += skip;
+		for (size_t i = 0; i < count; i++)
+			state[pos++] ^= delta[offset++];
+	}
+	return true;
+}
+
+
+//**************************************************************************
+//  REWINDER
+//**************************************************************************
+
+//-------------------------------------------------
+//  rewinder - constructor
+//-------------------------------------------------
+
+rewinder::rewinder(save_manager &save, u32 interval, size_t capacity)
+	: m_save(save),
+		m_interval(std::max<u32>(interval, 1)),
+		m_capacity(capacity),
+		m_frames(0),
+		m_delta_bytes(0),
+		m_queue(osd_work_queue_alloc(0)),
+		m_item(nullptr)
+{
+}
+
+
+//-------------------------------------------------
+//  ~rewinder - destructor
+//-------------------------------------------------
+
+rewinder::~rewinder()
+{
+	wait();
+	if (m_queue != nullptr)
+		osd_work_queue_free(m_queue);
+}
+
+
+//-------------------------------------------------
+//  history_size - return the number of captures
+//  that can be restored
+//-------------------------------------------------
+
+size_t rewinder::history_size()
+{
+	wait();
+	return m_current.empty() ? 0 : (m_deltas.size() + 1);
+}
+
+
+//-------------------------------------------------
+//  history_bytes - return the memory held by the
+//  captures
+//-------------------------------------------------
+
+size_t rewinder::history_bytes()
+{
+	wait();
+	return m_current.capacity() + m_pending.capacity() + m_delta_bytes;
+}
+
+
+//-------------------------------------------------
+//  capture - snapshot the machine and queue the
+//  previous snapshot for compression
+//-------------------------------------------------
+
+void rewinder::capture()
+{
+	// the last delta has to be finished before its buffers can be touched
+	wait();
+	m_frames = 0;
+
+	// the first capture has nothing to be a delta against
+	std::vector<u8> &dest = m_current.empty() ? m_current : m_pending;
+	if (m_save.write_buffer(dest) != STATERR_NONE)
+	{
+		dest.clear();
+		return;
+	}
+	if (&dest == &m_current)
+		return;
+
+	if (m_queue != nullptr)
+		m_item = osd_work_item_queue(m_queue, compress_callback, this, 0);
+	if (m_item == nullptr)
+		compress_callback(this, 0);
+}
+
+
+//-------------------------------------------------
+//  step_back - restore the latest capture if the
+//  machine has run since it was taken, otherwise
+//  the one before it
+//-------------------------------------------------
+
+bool rewinder::step_back()
+{
+	wait();
+	if (m_current.empty())
+		return false;
+
+	// if we're sitting on the latest capture, go back to its predecessor
+	if (m_frames == 0)
+	{
+		if (m_deltas.empty())
+			return false;
+		bool const valid = save_manager::apply_delta(m_current, m_deltas.back());
+		m_delta_bytes -= m_deltas.back().size();
+		m_deltas.pop_back();
+		if (!valid)
+		{
+			invalidate();
+			return false;
+		}
+	}
+
+	m_frames = 0;
+	return m_save.read_buffer(m_current) == STATERR_NONE;
+}
+
+
+//-------------------------------------------------
+//  invalidate - forget the history, e.g. because a
+//  state was loaded from a file
+//-------------------------------------------------
+
+void rewinder::invalidate()
+{
+	wait();
+	m_frames = 0;
+	m_current.clear();
+	m_deltas.clear();
+	m_delta_bytes = 0;
+}
+
+
+//-------------------------------------------------
+//  wait - wait for any delta being computed
+//-------------------------------------------------
+
+void rewinder::wait()
+{
+	if (m_item != nullptr)
+	{
+		while (!osd_work_item_wait(m_item, osd_ticks_per_second() * 10)) { }
+		osd_work_item_release(m_item);
+		m_item = nullptr;
+	}
+}
+
+
+//-------------------------------------------------
+//  compress_callback - make the delta from the new
+//  capture back to the previous one, then make
+//  the new capture current
+//-------------------------------------------------
+
+void *rewinder::compress_callback(void *param, int threadid)
+{
+	rewinder &rw = *reinterpret_cast<rewinder *>(param);
+	profiler_trace_scope scope("rewind compress", "state");
+
+	// a state that doesn't change at all isn't worth a step
+	std::vector<u8> delta;
+	save_manager::make_delta(rw.m_pending, rw.m_current, delta);
+	std::swap(rw.m_current, rw.m_pending);
+	if (delta.empty())
+		return nullptr;
+
+	rw.m_delta_bytes += delta.size();
+	rw.m_deltas.push_back(std::move(delta));
+
+	// drop the oldest history to stay within budget
+	while (rw.m_delta_bytes > rw.m_capacity && !rw.m_deltas.empty())
+	{
+		rw.m_delta_bytes -= rw.m_deltas.front().size();
+		rw.m_deltas.pop_front();
+	}
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  signature - compute the signature, which
 //  is a CRC over the structure of the data
@@ -357,6 +687,51 @@ void save_manager::dump_registry() const
 }
 
 
+//-------------------------------------------------
+//  build_blocks - merge the registered entries
+//  into as few contiguous ranges as possible so
+//  in-memory snapshots are a handful of memcpys
+//-------------------------------------------------
+
+void save_manager::build_blocks()
+{
+	if (!m_blocks_dirty)
+		return;
+	m_blocks_dirty = false;
+
+	// entries are kept in name order for the file format, but neighbouring fields of
+	// a device or a run of array elements are only adjacent in address order
+	m_blocks.clear();
+	m_blocks.reserve(m_entry_list.size());
+	for (auto &entry : m_entry_list)
+		m_blocks.push_back(copy_block{ reinterpret_cast<u8 *>(entry->m_data), size_t(entry->m_typesize) * entry->m_typecount });
+	std::sort(m_blocks.begin(), m_blocks.end(), [] (copy_block const &a, copy_block const &b) { return std::less<u8 *>()(a.m_data, b.m_data); });
+
+	// merge ranges that touch; padding between them is never copied, as it may hold
+	// unsaved members, but ranges that overlap are merged so nothing is copied twice
+	size_t count = 0;
+	m_state_size = 0;
+	for (copy_block const &block : m_blocks)
+	{
+		if (count != 0 && block.m_data <= m_blocks[count - 1].m_data + m_blocks[count - 1].m_size)
+		{
+			copy_block &prev = m_blocks[count - 1];
+			size_t const end = std::max(prev.m_size, size_t(block.m_data - prev.m_data) + block.m_size);
+			m_state_size += end - prev.m_size;
+			prev.m_size = end;
+		}
+		else
+		{
+			m_blocks[count++] = block;
+			m_state_size += block.m_size;
+		}
+	}
+	m_blocks.resize(count);
+
+	LOG(("%d save state entries in %d contiguous blocks, %d bytes\n", int(m_entry_list.size()), int(count), int(m_state_size)));
+}
+
+
 //-------------------------------------------------
 //  validate_header - validate the data in the
 //  header
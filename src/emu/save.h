@@ -17,6 +17,8 @@
 #ifndef MAME_EMU_SAVE_H
 #define MAME_EMU_SAVE_H
 
+#include <deque>
+
 
 
 //**************************************************************************
@@ -153,10 +155,32 @@ public:
 	save_error write_file(emu_file &file);
 	save_error read_file(emu_file &file);
 
+	// templatized wrapper for plain structures made up of fields of a single size,
+	// so the whole thing can be saved as one entry and still be byte-swapped
+	template<typename _ElementType, typename _StructType>
+	void save_struct(device_t *device, const char *module, const char *tag, int index, _StructType &value, const char *valname)
+	{
+		static_assert(std::is_trivially_copyable<_StructType>::value, "Called save_struct on a non-trivially-copyable type!");
+		static_assert(sizeof(_StructType) % sizeof(_ElementType) == 0, "Called save_struct with an element size that doesn't divide the structure!");
+		if (!type_checker<_ElementType>::is_atom) throw emu_fatalerror("Called save_struct with a non-fundamental element type!");
+		save_memory(device, module, tag, index, valname, &value, sizeof(_ElementType), sizeof(_StructType) / sizeof(_ElementType));
+	}
+
+	// in-memory snapshots, in native byte order with no header; the layout is
+	// only fixed once registration is closed
+	size_t state_size() { build_blocks(); return m_state_size; }
+	save_error write_buffer(std::vector<u8> &buffer);
+	save_error read_buffer(const std::vector<u8> &buffer);
+
+	// snapshot deltas: applying a delta to either snapshot it was made from yields the other
+	static void make_delta(const std::vector<u8> &from, const std::vector<u8> &to, std::vector<u8> &delta);
+	static bool apply_delta(std::vector<u8> &state, const std::vector<u8> &delta);
+
 private:
 	// internal helpers
 	u32 signature() const;
 	void dump_registry() const;
+	void build_blocks();
 	static save_error validate_header(const u8 *header, const char *gamename, u32 signature, void (CLIB_DECL *errormsg)(const char *fmt, ...), const char *error_prefix);
 
 	// state callback item
@@ -174,6 +198,16 @@ private:
 	bool                    m_reg_allowed;          // are registrations allowed?
 	int                     m_illegal_regs;         // number of illegal registrations
 
+	// contiguous ranges of registered memory, in address order, for in-memory snapshots
+	struct copy_block
+	{
+		u8 *        m_data;                         // start of the range
+		size_t      m_size;                         // length of the range
+	};
+	std::vector<copy_block> m_blocks;               // ranges covering every entry, built on demand
+	bool                    m_blocks_dirty;         // entries registered since the ranges were built
+	size_t                  m_state_size;           // total size of the ranges
+
 	std::vector<std::unique_ptr<state_entry>> m_entry_list;          // list of registered entries
 	std::vector<std::unique_ptr<state_callback>> m_presave_list;     // list of pre-save functions
 	std::vector<std::unique_ptr<state_callback>> m_postload_list;    // list of post-load functions
@@ -199,6 +233,48 @@ ALLOW_SAVE_TYPE_AND_ARRAY(endianness_t)
 ALLOW_SAVE_TYPE_AND_ARRAY(rgb_t)
 
 
+// ======================> rewinder
+
+// a history of in-memory snapshots: the latest is kept whole, and each older one
+// as the delta that turns its successor back into it; the deltas are computed on
+// a work queue so capturing costs the emulation thread little more than a memcpy
+class rewinder
+{
+public:
+	// construction/destruction
+	rewinder(save_manager &save, u32 interval, size_t capacity);
+	~rewinder();
+
+	// getters
+	bool capture_due() const { return m_frames >= m_interval; }
+	size_t history_size();
+	size_t history_bytes();
+
+	// history management
+	void frame_completed() { m_frames++; }
+	void capture();
+	bool step_back();
+	void invalidate();
+
+private:
+	// internal helpers
+	void wait();
+	static void *compress_callback(void *param, int threadid);
+
+	// internal state
+	save_manager &          m_save;                 // save manager that takes the snapshots
+	u32                     m_interval;             // frames between captures
+	size_t                  m_capacity;             // bytes of deltas to keep
+	u32                     m_frames;               // frames completed since the latest capture
+	std::vector<u8>         m_current;              // latest capture
+	std::vector<u8>         m_pending;              // capture waiting to replace m_current
+	std::deque<std::vector<u8>> m_deltas;           // oldest first; each turns a capture into its predecessor
+	size_t                  m_delta_bytes;          // total size of m_deltas
+	osd_work_queue *        m_queue;                // queue for computing deltas
+	osd_work_item *         m_item;                 // delta being computed, if any
+};
+
+
 
 //**************************************************************************
 //  INLINE FUNCTIONS
@@ -9,8 +9,12 @@
 ***************************************************************************/
 
 #include "emu.h"
+#include "emuopts.h"
 #include "debugger.h"
 
+#include <algorithm>
+
+
 //**************************************************************************
 //  DEBUGGING
 //**************************************************************************
@@ -56,7 +60,10 @@ emu_timer::emu_timer()
 		m_start(attotime::zero),
 		m_expire(attotime::never),
 		m_device(nullptr),
-		m_id(0)
+		m_id(0),
+		m_heapindex(-1),
+		m_sequence(0),
+		m_heapexpire(attotime::never)
 {
 }
 
@@ -91,6 +98,7 @@ emu_timer &emu_timer::init(running_machine &machine, timer_expired_delegate call
 	m_expire = attotime::never;
 	m_device = nullptr;
 	m_id = 0;
+	m_heapindex = -1;
 
 	// if we're not temporary, register ourselves with the save state system
 	if (!m_temporary)
@@ -123,6 +131,7 @@ emu_timer &emu_timer::init(device_t &device, device_timer_id id, void *ptr, bool
 	m_expire = attotime::never;
 	m_device = &device;
 	m_id = id;
+	m_heapindex = -1;
 
 	// if we're not temporary, register ourselves with the save state system
 	if (!m_temporary)
@@ -199,7 +208,7 @@ void emu_timer::adjust(attotime start_delay, s32 param, const attotime &period)
 	scheduler.timer_list_insert(*this);
 
 	// if this was inserted as the head, abort the current timeslice and resync
-	if (this == scheduler.first_timer())
+	if (scheduler.expires_in_timeslice(*this))
 		scheduler.abort_timeslice();
 }
 
@@ -269,6 +278,7 @@ void emu_timer::register_save()
 	machine().save().save_item(m_device, "timer", name.c_str(), index, NAME(m_period));
 	machine().save().save_item(m_device, "timer", name.c_str(), index, NAME(m_start));
 	machine().save().save_item(m_device, "timer", name.c_str(), index, NAME(m_expire));
+	machine().save().save_item(m_device, "timer", name.c_str(), index, NAME(m_sequence));
 }
 
 
@@ -310,22 +320,44 @@ void emu_timer::dump() const
 //  DEVICE SCHEDULER
 //**************************************************************************
 
+thread_local device_execute_interface *device_scheduler::s_executing_device = nullptr;
+
+
 //-------------------------------------------------
 //  device_scheduler - constructor
 //-------------------------------------------------
 
 device_scheduler::device_scheduler(running_machine &machine) :
 	m_machine(machine),
-	m_executing_device(nullptr),
 	m_execute_list(nullptr),
 	m_basetime(attotime::zero),
 	m_timer_list(nullptr),
+	m_next_expire(attotime::never),
+	m_timer_heap_enabled(machine.options().timer_heap()),
+	m_sync_head(0),
+	m_sync_count(0),
+	m_active_groups(0),
+	m_parallel_active(false),
+	m_parallel_target(attotime::zero),
+	m_work_queue(nullptr),
 	m_callback_timer(nullptr),
 	m_callback_timer_modified(false),
 	m_callback_timer_expire_time(attotime::zero),
+	m_callback_sync(false),
 	m_suspend_changes_pending(true),
 	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000)
 {
+	for (int groupnum = 0; groupnum < MAX_EXECUTE_GROUPS; groupnum++)
+	{
+		execute_group &group = m_groups[groupnum];
+		group.m_scheduler = this;
+		group.m_index = groupnum;
+		group.m_list = nullptr;
+		group.m_target = attotime::zero;
+		group.m_sequence = 0;
+		machine.save().save_item(nullptr, "scheduler", "group", groupnum, NAME(group.m_sequence));
+	}
+
 	// append a single never-expiring timer so there is always one in the list
 	m_timer_list = &m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), nullptr, true);
 	m_timer_list->adjust(attotime::never);
@@ -346,6 +378,10 @@ device_scheduler::~device_scheduler()
 	// remove all timers
 	while (m_timer_list != nullptr)
 		m_timer_allocator.reclaim(m_timer_list->release());
+
+	// free the work queue
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
 }
 
 
@@ -356,12 +392,12 @@ device_scheduler::~device_scheduler()
 attotime device_scheduler::time() const
 {
 	// if we're currently in a callback, use the timer's expiration time as a base
-	if (m_callback_timer != nullptr)
+	if (m_callback_timer != nullptr || m_callback_sync)
 		return m_callback_timer_expire_time;
 
 	// if we're executing as a particular CPU, use its local time as a base
 	// otherwise, return the global base time
-	return (m_executing_device != nullptr) ? m_executing_device->local_time() : m_basetime;
+	return (s_executing_device != nullptr) ? s_executing_device->local_time() : m_basetime;
 }
 
 
@@ -381,6 +417,14 @@ bool device_scheduler::can_save() const
 			return false;
 		}
 
+	// pending synchronization callbacks are anonymous timers too
+	if (m_sync_count != 0)
+	{
+		machine().logerror("Failed save state attempt due to pending synchronization callbacks:\n");
+		dump_timers();
+		return false;
+	}
+
 	// otherwise, we're good
 	return true;
 }
@@ -410,6 +454,104 @@ inline void device_scheduler::apply_suspend_changes()
 }
 
 
+//-------------------------------------------------
+//  execute_devices - execute each device in a
+//  list up to the target time, returning the
+//  possibly reduced target
+//-------------------------------------------------
+
+template <device_execute_interface *device_execute_interface::*Next>
+inline attotime device_scheduler::execute_devices(device_execute_interface *list, attotime target, bool call_debugger, bool profile)
+{
+	// loop over all devices in the list
+	for (device_execute_interface *exec = list; exec != nullptr; exec = exec->*Next)
+	{
+		// only process if this CPU is executing or truly halted (not yielding)
+		// and if our target is later than the CPU's current time (coarse check)
+		if (EXPECTED((exec->m_suspend == 0 || exec->m_eatcycles) && target.seconds() >= exec->m_localtime.seconds()))
+		{
+			// compute how many attoseconds to execute this CPU
+			attoseconds_t delta = target.attoseconds() - exec->m_localtime.attoseconds();
+			if (delta < 0 && target.seconds() > exec->m_localtime.seconds())
+				delta += ATTOSECONDS_PER_SECOND;
+			assert(delta == (target - exec->m_localtime).as_attoseconds());
+
+			// if we have enough for at least 1 cycle, do the math
+			if (delta >= exec->m_attoseconds_per_cycle)
+			{
+				// compute how many cycles we want to execute
+				int ran = exec->m_cycles_running = divu_64x32(u64(delta) >> exec->m_divshift, exec->m_divisor);
+				LOG(("  cpu '%s': %d (%d cycles)\n", exec->device().tag(), delta, exec->m_cycles_running));
+
+				// if we're not suspended, actually execute
+				if (exec->m_suspend == 0)
+				{
+					if (profile)
+						g_profiler.start(exec->m_profiler);
+					g_profiler.trace_begin(exec->device().tag(), "execute");
+
+					// note that this global variable cycles_stolen can be modified
+					// via the call to cpu_execute
+					exec->m_cycles_stolen = 0;
+					s_executing_device = exec;
+					*exec->m_icountptr = exec->m_cycles_running;
+					if (!call_debugger)
+						exec->run();
+					else
+					{
+						debugger_start_cpu_hook(&exec->device(), target);
+						exec->run();
+						debugger_stop_cpu_hook(&exec->device());
+					}
+
+					// adjust for any cycles we took back
+					assert(ran >= *exec->m_icountptr);
+					ran -= *exec->m_icountptr;
+					assert(ran >= exec->m_cycles_stolen);
+					ran -= exec->m_cycles_stolen;
+					g_profiler.trace_end();
+					if (profile)
+						g_profiler.stop();
+				}
+
+				// account for these cycles
+				exec->m_totalcycles += ran;
+
+				// update the local time for this CPU
+				attotime deltatime(0, exec->m_attoseconds_per_cycle * ran);
+				assert(deltatime >= attotime::zero);
+				exec->m_localtime += deltatime;
+				LOG(("         %d ran, %d total, time = %s\n", ran, s32(exec->m_totalcycles), exec->m_localtime.as_string(PRECISION)));
+
+				// if the new local CPU time is less than our target, move the target up, but not before the base
+				if (exec->m_localtime < target)
+				{
+					target = max(exec->m_localtime, m_basetime);
+					LOG(("         (new target)\n"));
+				}
+			}
+		}
+	}
+	s_executing_device = nullptr;
+	return target;
+}
+
+
+//-------------------------------------------------
+//  execute_group_callback - work queue callback
+//  to execute a single group on a worker thread
+//-------------------------------------------------
+
+void *device_scheduler::execute_group_callback(void *param, int threadid)
+{
+	execute_group &group = *reinterpret_cast<execute_group *>(param);
+
+	// the profiler is not thread-safe, so don't attempt to use it here; trace scopes are fine
+	group.m_target = group.m_scheduler->execute_devices<&device_execute_interface::m_nextgroupexec>(group.m_list, group.m_target, false, false);
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  timeslice - execute all devices for a single
 //  timeslice
@@ -428,14 +570,14 @@ void device_scheduler::timeslice()
 		m_quantum_allocator.reclaim(m_quantum_list.detach_head());
 
 	// loop until we hit the next timer
-	while (m_basetime < m_timer_list->m_expire)
+	while (m_basetime < m_next_expire)
 	{
 		// by default, assume our target is the end of the next quantum
 		attotime target(m_basetime + attotime(0, m_quantum_list.first()->m_actual));
 
 		// however, if the next timer is going to fire before then, override
-		if (m_timer_list->m_expire < target)
-			target = m_timer_list->m_expire;
+		if (m_next_expire < target)
+			target = m_next_expire;
 
 		LOG(("------------------\n"));
 		LOG(("cpu_timeslice: target = %s\n", target.as_string(PRECISION)));
@@ -444,72 +586,35 @@ void device_scheduler::timeslice()
 		if (m_suspend_changes_pending)
 			apply_suspend_changes();
 
-		// loop over all CPUs
-		for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+		// run each execution group on its own thread if more than one is populated;
+		// the profiler keeps a single stack, so not while it is running
+		if (m_active_groups > 1 && !call_debugger && !g_profiler.enabled())
 		{
-			// only process if this CPU is executing or truly halted (not yielding)
-			// and if our target is later than the CPU's current time (coarse check)
-			if (EXPECTED((exec->m_suspend == 0 || exec->m_eatcycles) && target.seconds() >= exec->m_localtime.seconds()))
-			{
-				// compute how many attoseconds to execute this CPU
-				attoseconds_t delta = target.attoseconds() - exec->m_localtime.attoseconds();
-				if (delta < 0 && target.seconds() > exec->m_localtime.seconds())
-					delta += ATTOSECONDS_PER_SECOND;
-				assert(delta == (target - exec->m_localtime).as_attoseconds());
-
-				// if we have enough for at least 1 cycle, do the math
-				if (delta >= exec->m_attoseconds_per_cycle)
-				{
-					// compute how many cycles we want to execute
-					int ran = exec->m_cycles_running = divu_64x32(u64(delta) >> exec->m_divshift, exec->m_divisor);
-					LOG(("  cpu '%s': %d (%d cycles)\n", exec->device().tag(), delta, exec->m_cycles_running));
-
-					// if we're not suspended, actually execute
-					if (exec->m_suspend == 0)
-					{
-						g_profiler.start(exec->m_profiler);
-
-						// note that this global variable cycles_stolen can be modified
-						// via the call to cpu_execute
-						exec->m_cycles_stolen = 0;
-						m_executing_device = exec;
-						*exec->m_icountptr = exec->m_cycles_running;
-						if (!call_debugger)
-							exec->run();
-						else
-						{
-							debugger_start_cpu_hook(&exec->device(), target);
-							exec->run();
-							debugger_stop_cpu_hook(&exec->device());
-						}
-
-						// adjust for any cycles we took back
-						assert(ran >= *exec->m_icountptr);
-						ran -= *exec->m_icountptr;
-						assert(ran >= exec->m_cycles_stolen);
-						ran -= exec->m_cycles_stolen;
-						g_profiler.stop();
-					}
-
-					// account for these cycles
-					exec->m_totalcycles += ran;
-
-					// update the local time for this CPU
-					attotime deltatime(0, exec->m_attoseconds_per_cycle * ran);
-					assert(deltatime >= attotime::zero);
-					exec->m_localtime += deltatime;
-					LOG(("         %d ran, %d total, time = %s\n", ran, s32(exec->m_totalcycles), exec->m_localtime.as_string(PRECISION)));
-
-					// if the new local CPU time is less than our target, move the target up, but not before the base
-					if (exec->m_localtime < target)
-					{
-						target = max(exec->m_localtime, m_basetime);
-						LOG(("         (new target)\n"));
-					}
-				}
-			}
+			for (execute_group &group : m_groups)
+				group.m_target = target;
+
+			// queue the secondary groups, then run the first group here
+			m_parallel_target = target;
+			m_parallel_active = true;
+			for (int groupnum = 1; groupnum < MAX_EXECUTE_GROUPS; groupnum++)
+				if (m_groups[groupnum].m_list != nullptr)
+					osd_work_item_queue(m_work_queue, execute_group_callback, &m_groups[groupnum], WORK_ITEM_FLAG_AUTO_RELEASE);
+			if (m_groups[0].m_list != nullptr)
+				m_groups[0].m_target = execute_devices<&device_execute_interface::m_nextgroupexec>(m_groups[0].m_list, target, false, true);
+			while (!osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10)) { }
+			m_parallel_active = false;
+
+			// the groups synchronize at the earliest time any of them reached; groups that
+			// went further wait there until the others catch up, as devices earlier in the
+			// serial list do, so the result depends only on what each group did
+			for (execute_group &group : m_groups)
+				if (group.m_list != nullptr && group.m_target < target)
+					target = group.m_target;
 		}
-		m_executing_device = nullptr;
+
+		// otherwise, loop over all CPUs
+		else
+			target = execute_devices<&device_execute_interface::m_nextexec>(m_execute_list, target, call_debugger, true);
 
 		// update the base time
 		m_basetime = target;
@@ -520,6 +625,23 @@ void device_scheduler::timeslice()
 }
 
 
+//-------------------------------------------------
+//  expires_in_timeslice - return true if a timer
+//  that was just adjusted should end the current
+//  timeslice early
+//-------------------------------------------------
+
+bool device_scheduler::expires_in_timeslice(const emu_timer &timer)
+{
+	// while groups run in parallel, the head of the queue depends on what the
+	// other groups have inserted so far; compare against the fixed target of the
+	// timeslice instead, so that each group stops at the same point every run
+	if (m_parallel_active)
+		return timer.m_enabled && timer.m_expire < m_parallel_target;
+	return &timer == next_expiring_timer();
+}
+
+
 //-------------------------------------------------
 //  abort_timeslice - abort execution for the
 //  current timeslice
@@ -527,8 +649,8 @@ void device_scheduler::timeslice()
 
 void device_scheduler::abort_timeslice()
 {
-	if (m_executing_device != nullptr)
-		m_executing_device->abort_timeslice();
+	if (s_executing_device != nullptr)
+		s_executing_device->abort_timeslice();
 }
 
 
@@ -574,7 +696,7 @@ void device_scheduler::boost_interleave(const attotime &timeslice_time, const at
 
 emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback, void *ptr)
 {
-	return &m_timer_allocator.alloc()->init(machine(), callback, ptr, false);
+	return &allocate_timer()->init(machine(), callback, ptr, false);
 }
 
 
@@ -586,7 +708,10 @@ emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback, void *
 
 void device_scheduler::timer_set(const attotime &duration, timer_expired_delegate callback, int param, void *ptr)
 {
-	m_timer_allocator.alloc()->init(machine(), callback, ptr, true).adjust(duration, param);
+	// zero-delay callbacks skip the timer list unless too many are pending
+	if (duration.is_zero() && sync_insert(callback, param, ptr))
+		return;
+	allocate_timer()->init(machine(), callback, ptr, true).adjust(duration, param);
 }
 
 
@@ -598,7 +723,7 @@ void device_scheduler::timer_set(const attotime &duration, timer_expired_delegat
 
 void device_scheduler::timer_pulse(const attotime &period, timer_expired_delegate callback, int param, void *ptr)
 {
-	m_timer_allocator.alloc()->init(machine(), callback, ptr, false).adjust(period, param, period);
+	allocate_timer()->init(machine(), callback, ptr, false).adjust(period, param, period);
 }
 
 
@@ -609,7 +734,7 @@ void device_scheduler::timer_pulse(const attotime &period, timer_expired_delegat
 
 emu_timer *device_scheduler::timer_alloc(device_t &device, device_timer_id id, void *ptr)
 {
-	return &m_timer_allocator.alloc()->init(device, id, ptr, false);
+	return &allocate_timer()->init(device, id, ptr, false);
 }
 
 
@@ -621,7 +746,71 @@ emu_timer *device_scheduler::timer_alloc(device_t &device, device_timer_id id, v
 
 void device_scheduler::timer_set(const attotime &duration, device_t &device, device_timer_id id, int param, void *ptr)
 {
-	m_timer_allocator.alloc()->init(device, id, ptr, true).adjust(duration, param);
+	allocate_timer()->init(device, id, ptr, true).adjust(duration, param);
+}
+
+
+//-------------------------------------------------
+//  allocate_timer - allocate a timer object,
+//  which may be requested from a worker thread
+//-------------------------------------------------
+
+emu_timer *device_scheduler::allocate_timer()
+{
+	std::unique_lock<std::mutex> lock(m_timer_lock, std::defer_lock);
+	if (m_parallel_active)
+		lock.lock();
+	return m_timer_allocator.alloc();
+}
+
+
+//-------------------------------------------------
+//  sync_insert - queue a zero-delay callback,
+//  ordered against the timers as if it were a
+//  temporary timer expiring now; returns false
+//  if too many are already pending
+//-------------------------------------------------
+
+bool device_scheduler::sync_insert(timer_expired_delegate &callback, int param, void *ptr)
+{
+	attotime expire = time();
+	bool is_next;
+	{
+		// devices executing on worker threads may be synchronizing too
+		std::unique_lock<std::mutex> lock(m_timer_lock, std::defer_lock);
+		if (m_parallel_active)
+			lock.lock();
+
+		if (m_sync_count == MAX_SYNC_CALLBACKS)
+			return false;
+		u64 sequence = next_timer_sequence();
+
+		// shift later entries towards the tail to keep the ring sorted
+		int index = m_sync_count++;
+		for ( ; index > 0; index--)
+		{
+			sync_callback &prev = m_sync_ring[(m_sync_head + index - 1) % MAX_SYNC_CALLBACKS];
+			if (prev.m_expire < expire || (prev.m_expire == expire && prev.m_sequence < sequence))
+				break;
+			m_sync_ring[(m_sync_head + index) % MAX_SYNC_CALLBACKS] = prev;
+		}
+
+		sync_callback &entry = m_sync_ring[(m_sync_head + index) % MAX_SYNC_CALLBACKS];
+		entry.m_expire = expire;
+		entry.m_sequence = sequence;
+		entry.m_callback = callback;
+		entry.m_param = param;
+		entry.m_ptr = ptr;
+
+		is_next = m_parallel_active ? (expire < m_parallel_target) : (index == 0 && expire <= m_next_expire);
+		if (index == 0 && expire <= m_next_expire)
+			m_next_expire = expire;
+	}
+
+	// if this is the next thing to fire, abort the current timeslice and resync
+	if (is_next)
+		abort_timeslice();
+	return true;
 }
 
 
@@ -666,11 +855,22 @@ void device_scheduler::presave()
 
 void device_scheduler::postload()
 {
+	// the list is in whatever order it had before the load, so put the timers in
+	// the order they will fire; the sequence numbers were saved with the timers,
+	// but the heap keys are derived, so refresh those from the restored state
+	std::vector<emu_timer *> timers;
+	for (emu_timer *timer = m_timer_list; timer != nullptr; timer = timer->next())
+	{
+		timer->m_heapexpire = timer->m_enabled ? timer->m_expire : attotime::never;
+		timers.push_back(timer);
+	}
+	std::stable_sort(timers.begin(), timers.end(), [] (const emu_timer *a, const emu_timer *b) { return timer_heap_before(*a, *b); });
+
 	// remove all timers and make a private list of permanent ones
 	simple_list<emu_timer> private_list;
-	while (m_timer_list != nullptr)
+	for (emu_timer *curtimer : timers)
 	{
-		emu_timer &timer = *m_timer_list;
+		emu_timer &timer = *curtimer;
 
 		// temporary timers go away entirely (except our special never-expiring one)
 		if (timer.m_temporary && !timer.expire().is_never())
@@ -681,10 +881,15 @@ void device_scheduler::postload()
 			private_list.append(timer_list_remove(timer));
 	}
 
-	// now re-insert them; this effectively re-sorts them by time
+	// pending synchronization callbacks go away with the temporary timers
+	m_sync_head = m_sync_count = 0;
+
+	// now re-insert them in firing order, keeping the restored sequence numbers
+	// so that ties with timers inserted after the load resolve as they would have
 	emu_timer *timer;
 	while ((timer = private_list.detach_head()) != nullptr)
-		timer_list_insert(*timer);
+		timer_list_insert(*timer, false);
+	update_next_expire();
 
 	m_suspend_changes_pending = true;
 	rebuild_execute_list();
@@ -804,6 +1009,31 @@ void device_scheduler::rebuild_execute_list()
 
 	// append the suspend list to the end of the active list
 	*active_tailptr = suspend_list;
+
+	// rebuild the per-group lists in the same order
+	device_execute_interface **group_tailptr[MAX_EXECUTE_GROUPS];
+	for (execute_group &group : m_groups)
+	{
+		group.m_list = nullptr;
+		group_tailptr[group.m_index] = &group.m_list;
+	}
+	for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
+	{
+		assert(exec->m_execute_group >= 0 && exec->m_execute_group < MAX_EXECUTE_GROUPS);
+		exec->m_nextgroupexec = nullptr;
+		*group_tailptr[exec->m_execute_group] = exec;
+		group_tailptr[exec->m_execute_group] = &exec->m_nextgroupexec;
+	}
+
+	// groups can only run in parallel if the timer heap keeps insertion order deterministic
+	m_active_groups = 0;
+	for (execute_group &group : m_groups)
+		if (group.m_list != nullptr)
+			m_active_groups++;
+	if (m_active_groups > 1 && !m_timer_heap_enabled)
+		m_active_groups = 1;
+	if (m_active_groups > 1 && m_work_queue == nullptr)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_HIGH_FREQ);
 }
 
 
@@ -812,8 +1042,31 @@ void device_scheduler::rebuild_execute_list()
 //  the list at the appropriate location
 //-------------------------------------------------
 
-emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
+emu_timer &device_scheduler::timer_list_insert(emu_timer &timer, bool renumber)
 {
+	// devices executing on worker threads may be adjusting timers too
+	std::unique_lock<std::mutex> lock(m_timer_lock, std::defer_lock);
+	if (m_parallel_active)
+		lock.lock();
+
+	// the sequence number orders this against timers and synchronization callbacks due at the same time;
+	// timers re-inserted after a load keep the one they were saved with
+	if (renumber)
+		timer.m_sequence = timer.m_enabled ? next_timer_sequence() : ~u64(0);
+
+	// in heap mode, the list is unordered and the heap tracks expiration order
+	if (m_timer_heap_enabled)
+	{
+		timer.m_prev = nullptr;
+		timer.m_next = m_timer_list;
+		if (m_timer_list != nullptr)
+			m_timer_list->m_prev = &timer;
+		m_timer_list = &timer;
+		timer_heap_insert(timer);
+		update_next_expire();
+		return timer;
+	}
+
 	// disabled timers sort to the end
 	const attotime &expire = timer.m_enabled ? timer.m_expire : attotime::never;
 
@@ -834,6 +1087,7 @@ emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
 				m_timer_list = &timer;
 
 			curtimer->m_prev = &timer;
+			update_next_expire();
 			return timer;
 		}
 	}
@@ -846,6 +1100,7 @@ emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
 
 	timer.m_prev = prevtimer;
 	timer.m_next = nullptr;
+	update_next_expire();
 	return timer;
 }
 
@@ -857,6 +1112,11 @@ emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
 
 emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 {
+	// devices executing on worker threads may be adjusting timers too
+	std::unique_lock<std::mutex> lock(m_timer_lock, std::defer_lock);
+	if (m_parallel_active)
+		lock.lock();
+
 	// remove it from the list
 	if (timer.m_prev != nullptr)
 		timer.m_prev->m_next = timer.m_next;
@@ -866,23 +1126,179 @@ emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 	if (timer.m_next != nullptr)
 		timer.m_next->m_prev = timer.m_prev;
 
+	// remove it from the heap as well
+	if (m_timer_heap_enabled)
+		timer_heap_remove(timer);
+
+	update_next_expire();
 	return timer;
 }
 
 
+//-------------------------------------------------
+//  update_next_expire - refresh the cached
+//  expiration time of the next timer to fire,
+//  so the timeslice loop need not chase pointers
+//-------------------------------------------------
+
+inline void device_scheduler::update_next_expire()
+{
+	if (m_timer_heap_enabled)
+		m_next_expire = m_timer_heap.empty() ? attotime::never : m_timer_heap.front()->m_expire;
+	else
+		m_next_expire = (m_timer_list == nullptr) ? attotime::never : m_timer_list->m_expire;
+
+	// a pending synchronization callback may be due first
+	if (m_sync_count != 0 && m_sync_ring[m_sync_head].m_expire < m_next_expire)
+		m_next_expire = m_sync_ring[m_sync_head].m_expire;
+}
+
+
+//-------------------------------------------------
+//  next_timer_sequence - return the sequence
+//  number for a timer or callback being queued
+//  by the current execution group
+//-------------------------------------------------
+
+inline u64 device_scheduler::next_timer_sequence()
+{
+	// sequence numbers are counted per execution group so that the order
+	// does not depend on how worker threads interleave
+	execute_group &group = m_groups[(s_executing_device != nullptr) ? s_executing_device->m_execute_group : 0];
+	return (group.m_sequence++ * MAX_EXECUTE_GROUPS) + group.m_index;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_before - return true if timer a
+//  should fire before timer b; ties are broken
+//  by insertion order, matching the list
+//-------------------------------------------------
+
+inline bool device_scheduler::timer_heap_before(const emu_timer &a, const emu_timer &b)
+{
+	if (a.m_heapexpire != b.m_heapexpire)
+		return a.m_heapexpire < b.m_heapexpire;
+	return a.m_sequence < b.m_sequence;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_sift_up - move the timer at the
+//  given heap index towards the root
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_sift_up(u32 index)
+{
+	emu_timer *const timer = m_timer_heap[index];
+	while (index > 0)
+	{
+		const u32 parent = (index - 1) / 2;
+		if (!timer_heap_before(*timer, *m_timer_heap[parent]))
+			break;
+		m_timer_heap[index] = m_timer_heap[parent];
+		m_timer_heap[index]->m_heapindex = index;
+		index = parent;
+	}
+	m_timer_heap[index] = timer;
+	timer->m_heapindex = index;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_sift_down - move the timer at the
+//  given heap index away from the root
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_sift_down(u32 index)
+{
+	emu_timer *const timer = m_timer_heap[index];
+	const u32 count = m_timer_heap.size();
+	while (true)
+	{
+		u32 child = index * 2 + 1;
+		if (child >= count)
+			break;
+		if (child + 1 < count && timer_heap_before(*m_timer_heap[child + 1], *m_timer_heap[child]))
+			child++;
+		if (!timer_heap_before(*m_timer_heap[child], *timer))
+			break;
+		m_timer_heap[index] = m_timer_heap[child];
+		m_timer_heap[index]->m_heapindex = index;
+		index = child;
+	}
+	m_timer_heap[index] = timer;
+	timer->m_heapindex = index;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_insert - add a timer to the heap
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_insert(emu_timer &timer)
+{
+	assert(timer.m_heapindex == -1);
+
+	// disabled timers sort to the end, behind any enabled never-expiring ones;
+	// the sequence number was assigned by timer_list_insert
+	timer.m_heapexpire = timer.m_enabled ? timer.m_expire : attotime::never;
+
+	m_timer_heap.push_back(&timer);
+	timer_heap_sift_up(m_timer_heap.size() - 1);
+}
+
+
+//-------------------------------------------------
+//  timer_heap_remove - remove a timer from the
+//  heap
+//-------------------------------------------------
+
+void device_scheduler::timer_heap_remove(emu_timer &timer)
+{
+	assert(timer.m_heapindex >= 0 && m_timer_heap[timer.m_heapindex] == &timer);
+
+	// move the last entry into the vacated slot and restore the heap order
+	const u32 index = timer.m_heapindex;
+	emu_timer *const last = m_timer_heap.back();
+	m_timer_heap.pop_back();
+	timer.m_heapindex = -1;
+	if (last != &timer)
+	{
+		m_timer_heap[index] = last;
+		last->m_heapindex = index;
+		if (index > 0 && timer_heap_before(*last, *m_timer_heap[(index - 1) / 2]))
+			timer_heap_sift_up(index);
+		else
+			timer_heap_sift_down(index);
+	}
+}
+
+
 //-------------------------------------------------
 //  execute_timers - execute timers that are due
 //-------------------------------------------------
 
 inline void device_scheduler::execute_timers()
 {
-	LOG(("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_timer_list->m_expire.as_string(PRECISION)));
+	LOG(("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_next_expire.as_string(PRECISION)));
 
 	// now process any timers that are overdue
-	while (m_timer_list->m_expire <= m_basetime)
+	while (m_next_expire <= m_basetime)
 	{
+		// synchronization callbacks fire in the same order as timers set at the same time would
+		emu_timer &timer = *next_expiring_timer();
+		if (m_sync_count != 0)
+		{
+			const sync_callback &entry = m_sync_ring[m_sync_head];
+			if (entry.m_expire < timer.m_expire || (entry.m_expire == timer.m_expire && entry.m_sequence < timer.m_sequence))
+			{
+				execute_sync_callback();
+				continue;
+			}
+		}
+
 		// if this is a one-shot timer, disable it now
-		emu_timer &timer = *m_timer_list;
 		bool was_enabled = timer.m_enabled;
 		if (timer.m_period.is_zero() || timer.m_period.is_never())
 			timer.m_enabled = false;
@@ -900,12 +1316,16 @@ inline void device_scheduler::execute_timers()
 			if (timer.m_device != nullptr)
 			{
 				LOG(("execute_timers: timer device %s timer %d\n", timer.m_device->tag(), timer.m_id));
+				g_profiler.trace_begin(timer.m_device->tag(), "timer");
 				timer.m_device->timer_expired(timer, timer.m_id, timer.m_param, timer.m_ptr);
+				g_profiler.trace_end();
 			}
 			else if (!timer.m_callback.isnull())
 			{
 				LOG(("execute_timers: timer callback %s\n", timer.m_callback.name()));
+				g_profiler.trace_begin((timer.m_callback.name() != nullptr) ? timer.m_callback.name() : "(anonymous)", "timer");
 				timer.m_callback(timer.m_ptr, timer.m_param);
+				g_profiler.trace_end();
 			}
 
 			g_profiler.stop();
@@ -929,6 +1349,40 @@ inline void device_scheduler::execute_timers()
 }
 
 
+//-------------------------------------------------
+//  execute_sync_callback - remove the soonest
+//  synchronization callback and call it
+//-------------------------------------------------
+
+void device_scheduler::execute_sync_callback()
+{
+	// take it off the ring first, since the callback may synchronize again
+	const sync_callback &entry = m_sync_ring[m_sync_head];
+	timer_expired_delegate callback = entry.m_callback;
+	s32 param = entry.m_param;
+	void *ptr = entry.m_ptr;
+	m_callback_timer_expire_time = entry.m_expire;
+	m_sync_head = (m_sync_head + 1) % MAX_SYNC_CALLBACKS;
+	m_sync_count--;
+	update_next_expire();
+
+	// set the global state of which callback we're in
+	m_callback_sync = true;
+
+	if (!callback.isnull())
+	{
+		LOG(("execute_timers: synchronize callback %s\n", callback.name()));
+		g_profiler.start(PROFILER_TIMER_CALLBACK);
+		g_profiler.trace_begin((callback.name() != nullptr) ? callback.name() : "(anonymous)", "timer");
+		callback(ptr, param);
+		g_profiler.trace_end();
+		g_profiler.stop();
+	}
+
+	m_callback_sync = false;
+}
+
+
 //-------------------------------------------------
 //  add_scheduling_quantum - add a scheduling
 //  quantum; the smallest active one is the one
@@ -984,5 +1438,10 @@ void device_scheduler::dump_timers() const
 	machine().logerror("Timer Dump: Time = %15s\n", time().as_string(PRECISION));
 	for (emu_timer *timer = first_timer(); timer != nullptr; timer = timer->next())
 		timer->dump();
+	for (int index = 0; index < m_sync_count; index++)
+	{
+		const sync_callback &entry = m_sync_ring[(m_sync_head + index) % MAX_SYNC_CALLBACKS];
+		machine().logerror("sync: exp=%15s param=%d ptr=%p cb=%s\n", entry.m_expire.as_string(PRECISION), entry.m_param, entry.m_ptr, (entry.m_callback.name() != nullptr) ? entry.m_callback.name() : "(anonymous)");
+	}
 	machine().logerror("=============================================\n");
 }
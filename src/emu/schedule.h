@@ -102,6 +102,9 @@ private:
 	attotime            m_expire;       // time when the timer will expire
 	device_t *          m_device;       // for device timers, a pointer to the device
 	device_timer_id     m_id;           // for device timers, the ID of the timer
+	s32                 m_heapindex;    // index in the scheduler's timer heap, or -1
+	u64                 m_sequence;     // insertion sequence number, breaks ties in the heap
+	attotime            m_heapexpire;   // expiration time used to order the heap
 };
 
 
@@ -121,7 +124,8 @@ public:
 	running_machine &machine() const { return m_machine; }
 	attotime time() const;
 	emu_timer *first_timer() const { return m_timer_list; }
-	device_execute_interface *currently_executing() const { return m_executing_device; }
+	emu_timer *next_expiring_timer() const { return m_timer_heap_enabled ? m_timer_heap.front() : m_timer_list; }
+	device_execute_interface *currently_executing() const { return s_executing_device; }
 	bool can_save() const;
 
 	// execution
@@ -154,30 +158,82 @@ private:
 	void postload();
 
 	// scheduling helpers
+	struct execute_group;
+	template <device_execute_interface *device_execute_interface::*Next> attotime execute_devices(device_execute_interface *list, attotime target, bool call_debugger, bool profile);
+	static void *execute_group_callback(void *param, int threadid);
+	emu_timer *allocate_timer();
+	bool sync_insert(timer_expired_delegate &callback, int param, void *ptr);
 	void compute_perfect_interleave();
 	void rebuild_execute_list();
 	void apply_suspend_changes();
 	void add_scheduling_quantum(const attotime &quantum, const attotime &duration);
 
 	// timer helpers
-	emu_timer &timer_list_insert(emu_timer &timer);
+	emu_timer &timer_list_insert(emu_timer &timer, bool renumber = true);
 	emu_timer &timer_list_remove(emu_timer &timer);
+	void timer_heap_insert(emu_timer &timer);
+	void timer_heap_remove(emu_timer &timer);
+	void timer_heap_sift_up(u32 index);
+	void timer_heap_sift_down(u32 index);
+	static bool timer_heap_before(const emu_timer &a, const emu_timer &b);
+	u64 next_timer_sequence();
+	void update_next_expire();
+	bool expires_in_timeslice(const emu_timer &timer);
 	void execute_timers();
+	void execute_sync_callback();
 
 	// internal state
 	running_machine &           m_machine;                  // reference to our machine
-	device_execute_interface *  m_executing_device;         // pointer to currently executing device
 	device_execute_interface *  m_execute_list;             // list of devices to be executed
 	attotime                    m_basetime;                 // global basetime; everything moves forward from here
 
 	// list of active timers
 	emu_timer *                 m_timer_list;               // head of the active list
 	fixed_allocator<emu_timer>  m_timer_allocator;          // allocator for timers
+	attotime                    m_next_expire;              // cached expiration time of the next timer to fire
+
+	// binary heap of active timers; when enabled, the list above is not kept in order
+	bool                        m_timer_heap_enabled;       // true to order timers using the heap
+	std::vector<emu_timer *>    m_timer_heap;               // heap of timers, soonest first
+
+	// zero-delay synchronization callbacks, fired without allocating a timer
+	static constexpr int MAX_SYNC_CALLBACKS = 16;
+	struct sync_callback
+	{
+		attotime                    m_expire;               // time the callback was requested
+		u64                         m_sequence;             // insertion sequence number, ordered against timers
+		timer_expired_delegate      m_callback;             // callback function
+		s32                         m_param;                // integer parameter
+		void *                      m_ptr;                  // pointer parameter
+	};
+	sync_callback               m_sync_ring[MAX_SYNC_CALLBACKS]; // pending callbacks, soonest first from the head
+	int                         m_sync_head;                // index of the soonest pending callback
+	int                         m_sync_count;               // number of pending callbacks
+
+	// execution groups; devices in groups other than the first may run on worker threads
+	struct execute_group
+	{
+		device_scheduler *          m_scheduler;            // owning scheduler
+		int                         m_index;                // index of this group
+		device_execute_interface *  m_list;                 // devices in this group, in execution order
+		attotime                    m_target;               // target time for the current timeslice
+		u64                         m_sequence;             // sequence number for the next timer inserted by this group
+	};
+	execute_group               m_groups[MAX_EXECUTE_GROUPS]; // state for each execution group
+	int                         m_active_groups;            // number of groups containing devices
+	bool                        m_parallel_active;          // true while groups are executing on worker threads
+	attotime                    m_parallel_target;          // target time of the timeslice the groups are executing
+	std::mutex                  m_timer_lock;               // protects the timer lists during parallel execution
+	osd_work_queue *            m_work_queue;               // work queue for executing groups
+
+	// device currently executing on this thread
+	static thread_local device_execute_interface *s_executing_device;
 
 	// other internal states
 	emu_timer *                 m_callback_timer;           // pointer to the current callback timer
 	bool                        m_callback_timer_modified;  // true if the current callback timer was modified
 	attotime                    m_callback_timer_expire_time; // the original expiration time
+	bool                        m_callback_sync;            // true while a synchronization callback is running
 	bool                        m_suspend_changes_pending;  // suspend/resume changes are pending
 
 	// scheduling quanta
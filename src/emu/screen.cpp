@@ -579,6 +579,8 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 		m_vblank_end_timer(nullptr),
 		m_scanline0_timer(nullptr),
 		m_scanline_timer(nullptr),
+		m_scanline_dispatch_timer(nullptr),
+		m_scanline_dispatch_resync(true),
 		m_frame_number(0),
 		m_partial_updates_this_frame(0)
 {
@@ -831,6 +833,11 @@ void screen_device::device_start()
 	if (m_palette != nullptr && !m_palette->started())
 		throw device_missing_dependencies();
 
+	// any palette may be read through a screen update or the render textures,
+	// so collect them all to flush their pending paletteram writes
+	for (palette_device &palette : palette_device_iterator(machine().root_device()))
+		m_palettes.push_back(&palette);
+
 	// configure bitmap formats and allocate screen bitmaps
 	// svg is RGB32 too, and doesn't have any update method
 	texture_format texformat = !m_screen_update_ind16.isnull() ? TEXFORMAT_PALETTE16 : TEXFORMAT_RGB32;
@@ -843,10 +850,11 @@ void screen_device::device_start()
 	register_screen_bitmap(m_priority);
 
 	// allocate raw textures
-	m_texture[0] = machine().render().texture_alloc();
-	m_texture[0]->set_osd_data(u64((m_unique_id << 1) | 0));
-	m_texture[1] = machine().render().texture_alloc();
-	m_texture[1]->set_osd_data(u64((m_unique_id << 1) | 1));
+	for (int index = 0; index < SCREEN_BITMAPS; index++)
+	{
+		m_texture[index] = machine().render().texture_alloc();
+		m_texture[index]->set_osd_data(u64((m_unique_id << 2) | index));
+	}
 
 	// configure the default cliparea
 	render_container::user_settings settings;
@@ -868,6 +876,9 @@ void screen_device::device_start()
 	if ((m_video_attributes & VIDEO_UPDATE_SCANLINE) != 0)
 		m_scanline_timer = timer_alloc(TID_SCANLINE);
 
+	// allocate a timer to fire registered scanline callbacks
+	m_scanline_dispatch_timer = timer_alloc(TID_SCANLINE_DISPATCH);
+
 	// configure the screen with the default parameters
 	configure(m_width, m_height, m_visarea, m_refresh);
 
@@ -923,6 +934,9 @@ void screen_device::device_reset()
 {
 	// reset brightness to default
 	m_brightness = 0xff;
+
+	// scanline callbacks start over from their first position
+	start_scanline_dispatch();
 }
 
 
@@ -933,8 +947,8 @@ void screen_device::device_reset()
 
 void screen_device::device_stop()
 {
-	machine().render().texture_free(m_texture[0]);
-	machine().render().texture_free(m_texture[1]);
+	for (render_texture *texture : m_texture)
+		machine().render().texture_free(texture);
 	if (m_burnin.valid())
 		finalize_burnin();
 }
@@ -948,6 +962,7 @@ void screen_device::device_stop()
 void screen_device::device_post_load()
 {
 	realloc_screen_bitmaps();
+	m_scanline_dispatch_resync = true;
 }
 
 
@@ -973,6 +988,7 @@ void screen_device::device_timer(emu_timer &timer, device_timer_id id, int param
 		// first scanline
 		case TID_SCANLINE0:
 			reset_partial_updates();
+			reset_raster_states();
 			break;
 
 		// subsequent scanlines when scanline updates are enabled
@@ -987,6 +1003,11 @@ void screen_device::device_timer(emu_timer &timer, device_timer_id id, int param
 				param = m_visarea.min_y;
 			m_scanline_timer->adjust(time_until_pos(param), param);
 			break;
+
+		// registered scanline callbacks
+		case TID_SCANLINE_DISPATCH:
+			dispatch_scanline(param);
+			break;
 	}
 }
 
@@ -1027,6 +1048,7 @@ void screen_device::configure(int width, int height, const rectangle &visarea, a
 		m_vblank_period = m_vblank;
 	else
 		m_vblank_period = m_scantime * (height - visarea.height());
+	m_scanline_dispatch_resync = true;
 
 	// we are now fully configured with the new parameters
 	// and can safely call time_until_pos(), etc.
@@ -1042,7 +1064,10 @@ void screen_device::configure(int width, int height, const rectangle &visarea, a
 	// if we are on scanline 0 already, call the scanline 0 timer
 	// by hand now; otherwise, adjust it for the future
 	if (vpos() == 0)
+	{
 		reset_partial_updates();
+		reset_raster_states();
+	}
 	else
 		m_scanline0_timer->adjust(time_until_pos(0));
 
@@ -1062,11 +1087,15 @@ void screen_device::reset_origin(int beamy, int beamx)
 	attotime curtime = machine().time();
 	m_vblank_end_time = curtime - attotime(0, beamy * m_scantime + beamx * m_pixeltime);
 	m_vblank_start_time = m_vblank_end_time - attotime(0, m_vblank_period);
+	m_scanline_dispatch_resync = true;
 
 	// if we are resetting relative to (0,0) == VBLANK end, call the
 	// scanline 0 timer by hand now; otherwise, adjust it for the future
 	if (beamy == 0 && beamx == 0)
+	{
 		reset_partial_updates();
+		reset_raster_states();
+	}
 	else
 		m_scanline0_timer->adjust(time_until_pos(0));
 
@@ -1099,13 +1128,12 @@ void screen_device::realloc_screen_bitmaps()
 		item->m_bitmap.resize(effwidth, effheight);
 
 	// re-set up textures
-	if (m_palette != nullptr)
+	for (int index = 0; index < SCREEN_BITMAPS; index++)
 	{
-		m_bitmap[0].set_palette(m_palette->palette());
-		m_bitmap[1].set_palette(m_palette->palette());
+		if (m_palette != nullptr)
+			m_bitmap[index].set_palette(m_palette->palette());
+		m_texture[index]->set_bitmap(m_bitmap[index], m_visarea, m_bitmap[index].texformat());
 	}
-	m_texture[0]->set_bitmap(m_bitmap[0], m_visarea, m_bitmap[0].texformat());
-	m_texture[1]->set_bitmap(m_bitmap[1], m_visarea, m_bitmap[1].texformat());
 }
 
 
@@ -1180,13 +1208,7 @@ bool screen_device::update_partial(int scanline)
 	u32 flags;
 	if (m_type != SCREEN_TYPE_SVG)
 	{
-		screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
-		switch (curbitmap.format())
-		{
-			default:
-			case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-			case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
-		}
+		flags = update_spans(clip);
 	}
 	else
 	{
@@ -1205,6 +1227,62 @@ bool screen_device::update_partial(int scanline)
 }
 
 
+//-------------------------------------------------
+//  flush_palettes - apply paletteram writes that
+//  are still batched up in any palette
+//-------------------------------------------------
+
+void screen_device::flush_palettes()
+{
+	for (palette_device *palette : m_palettes)
+		palette->flush_writes();
+}
+
+
+//-------------------------------------------------
+//  update_spans - call the screen update callback
+//  for a cliprect, once for each span of scanlines
+//  over which no raster state changes
+//-------------------------------------------------
+
+u32 screen_device::update_spans(const rectangle &clip)
+{
+	profiler_trace_scope scope(tag(), "video");
+	flush_palettes();
+
+	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
+	u32 flags = UPDATE_HAS_NOT_CHANGED;
+	rectangle span = clip;
+	while (span.min_y <= clip.max_y)
+	{
+		// end the span just before the first change after its top line
+		span.max_y = clip.max_y;
+		for (screen_raster_state_base *state : m_raster_states)
+		{
+			int next = state->next_change(span.min_y);
+			if (next <= span.max_y)
+				span.max_y = next - 1;
+			state->select(span.min_y);
+		}
+
+		u32 spanflags;
+		switch (curbitmap.format())
+		{
+			default:
+			case BITMAP_FORMAT_IND16:   spanflags = m_screen_update_ind16(*this, curbitmap.as_ind16(), span);   break;
+			case BITMAP_FORMAT_RGB32:   spanflags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), span);   break;
+		}
+		flags &= spanflags;
+		span.min_y = span.max_y + 1;
+	}
+
+	// outside of updates, the states report what was last written
+	for (screen_raster_state_base *state : m_raster_states)
+		state->select(-1);
+	return flags;
+}
+
+
 //-------------------------------------------------
 //  update_now - perform an update from the last
 //  beam position up to the current beam position
@@ -1262,13 +1340,7 @@ void screen_device::update_now()
 			{
 				g_profiler.start(PROFILER_VIDEO);
 
-				screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
-				switch (curbitmap.format())
-				{
-					default:
-					case BITMAP_FORMAT_IND16: m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-					case BITMAP_FORMAT_RGB32: m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
-				}
+				update_spans(clip);
 
 				m_partial_updates_this_frame++;
 				g_profiler.stop();
@@ -1301,14 +1373,7 @@ void screen_device::update_now()
 
 		LOG_PARTIAL_UPDATES(("doing scanline partial draw: Y %d X %d-%d\n", clip.max_y, clip.min_x, clip.max_x));
 
-		u32 flags;
-		screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
-		switch (curbitmap.format())
-		{
-			default:
-			case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-			case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
-		}
+		u32 flags = update_spans(clip);
 
 		m_partial_updates_this_frame++;
 		g_profiler.stop();
@@ -1456,6 +1521,129 @@ void screen_device::register_vblank_callback(vblank_state_delegate vblank_callba
 }
 
 
+//-------------------------------------------------
+//  register_scanline_callback - registers a
+//  callback fired when the beam reaches
+//  first_vpos and every increment lines after it
+//  (or only first_vpos if increment is 0)
+//-------------------------------------------------
+
+void screen_device::register_scanline_callback(scanline_state_delegate scanline_callback, int first_vpos, int increment)
+{
+	// validate arguments
+	assert(!scanline_callback.isnull());
+	assert(first_vpos >= 0);
+	assert(increment >= 0);
+
+	m_scanline_list.push_back(scanline_item{ std::move(scanline_callback), first_vpos, increment });
+}
+
+
+//-------------------------------------------------
+//  start_scanline_dispatch - arm the dispatch
+//  timer for the first scanline any registered
+//  callback wants
+//-------------------------------------------------
+
+void screen_device::start_scanline_dispatch()
+{
+	if (m_scanline_list.empty())
+		return;
+
+	int nextvpos = 0;
+	attotime nexttime = attotime::never;
+	for (const scanline_item &item : m_scanline_list)
+	{
+		int const vpos = item.m_first_vpos % m_height;
+		attotime const delta = time_until_pos(vpos);
+		if (delta < nexttime)
+		{
+			nexttime = delta;
+			nextvpos = vpos;
+		}
+	}
+	m_scanline_dispatch_timer->adjust(nexttime, nextvpos);
+	m_scanline_dispatch_resync = false;
+}
+
+
+//-------------------------------------------------
+//  dispatch_scanline - fire every scanline
+//  callback due on the given line, then arm the
+//  dispatch timer for the next line one is due
+//-------------------------------------------------
+
+void screen_device::dispatch_scanline(int vpos)
+{
+	for (scanline_item &item : m_scanline_list)
+	{
+		int const first = item.m_first_vpos % m_height;
+		if (vpos == first || (item.m_increment != 0 && vpos > first && vpos < m_height && ((vpos - first) % item.m_increment) == 0))
+			item.m_callback(*this, vpos);
+	}
+
+	// find the nearest line in beam order; a callback past the bottom of the screen goes back to its first line
+	int nextvpos = vpos;
+	int nextlines = m_height;
+	for (const scanline_item &item : m_scanline_list)
+	{
+		int const first = item.m_first_vpos % m_height;
+		int target = first;
+		if (item.m_increment != 0 && vpos >= first)
+		{
+			target = vpos + item.m_increment - ((vpos - first) % item.m_increment);
+			if (target >= m_height)
+				target = first;
+		}
+		int lines = target - vpos;
+		if (lines <= 0)
+			lines += m_height;
+		if (lines < nextlines)
+		{
+			nextlines = lines;
+			nextvpos = target;
+		}
+	}
+
+	// we were fired exactly on this line, so unless the timing changed the
+	// next line is a whole number of scanlines away
+	if (m_scanline_dispatch_resync)
+	{
+		m_scanline_dispatch_timer->adjust(time_until_pos(nextvpos), nextvpos);
+		m_scanline_dispatch_resync = false;
+	}
+	else
+		m_scanline_dispatch_timer->adjust(attotime(0, attoseconds_t(nextlines) * m_scantime), nextvpos);
+}
+
+
+//-------------------------------------------------
+//  register_raster_state - registers a set of
+//  per-scanline register snapshots that updates
+//  should be split on
+//-------------------------------------------------
+
+void screen_device::register_raster_state(screen_raster_state_base &state)
+{
+	if (std::find(m_raster_states.begin(), m_raster_states.end(), &state) == m_raster_states.end())
+		m_raster_states.push_back(&state);
+}
+
+
+//-------------------------------------------------
+//  reset_raster_states - start a new frame in
+//  each registered raster state; not done from
+//  reset_partial_updates, since that is also used
+//  to redraw the current frame while paused
+//-------------------------------------------------
+
+void screen_device::reset_raster_states()
+{
+	for (screen_raster_state_base *state : m_raster_states)
+		state->frame_reset();
+}
+
+
 //-------------------------------------------------
 //  register_screen_bitmap - registers a bitmap
 //  that should track the screen size
@@ -1466,6 +1654,9 @@ void screen_device::register_screen_bitmap(bitmap_t &bitmap)
 	// append to the list
 	m_auto_bitmap_list.push_back(std::make_unique<auto_bitmap_item>(bitmap));
 
+	// keep rows on their own cache lines for the vectorised drawing paths
+	bitmap.set_row_alignment(bitmap_t::CACHE_LINE_BYTES);
+
 	// if allocating now, just do it
 	bitmap.allocate(width(), height());
 	if (m_palette != nullptr)
@@ -1484,6 +1675,10 @@ void screen_device::vblank_begin()
 	m_vblank_start_time = machine().time();
 	m_vblank_end_time = m_vblank_start_time + attotime(0, m_vblank_period);
 
+	// the renderer reads the palettes directly, even on frames where the screen
+	// update is skipped, so apply anything written since the last update
+	flush_palettes();
+
 	// if this is the primary screen and we need to update now
 	if (this == machine().first_screen() && !(m_video_attributes & VIDEO_UPDATE_AFTER_VBLANK))
 		machine().video().frame_update();
@@ -1545,7 +1740,7 @@ bool screen_device::update_quads()
 			{
 				m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat());
 				m_curtexture = m_curbitmap;
-				m_curbitmap = 1 - m_curbitmap;
+				m_curbitmap = (m_curbitmap + 1) % SCREEN_BITMAPS;
 			}
 
 			// brightness adjusted render color
@@ -1564,6 +1759,29 @@ bool screen_device::update_quads()
 }
 
 
+//-------------------------------------------------
+//  append_frame_crc - add the visible area of the
+//  bitmap being drawn this frame to a checksum
+//-------------------------------------------------
+
+void screen_device::append_frame_crc(util::crc32_creator &crc)
+{
+	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
+	if (!curbitmap.valid())
+		return;
+
+	// indexed bitmaps are hashed as indices; palette changes alone don't show up
+	const bitmap_t &bitmap = curbitmap;
+	rectangle visarea = m_visarea;
+	visarea &= bitmap.cliprect();
+	if (visarea.empty())
+		return;
+	u32 const bytes = visarea.width() * bitmap.bpp() / 8;
+	for (s32 y = visarea.min_y; y <= visarea.max_y; y++)
+		crc.append(bitmap.raw_pixptr(y, visarea.min_x), bytes);
+}
+
+
 //-------------------------------------------------
 //  update_burnin - update the burnin bitmap
 //-------------------------------------------------
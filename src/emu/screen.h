@@ -8,6 +8,7 @@
 
 ***************************************************************************/
 
+#include <limits>
 #include <utility>
 
 #pragma once
@@ -164,12 +165,36 @@ private:
 // ======================> other delegate types
 
 typedef delegate<void (screen_device &, bool)> vblank_state_delegate;
+typedef delegate<void (screen_device &, int)> scanline_state_delegate;
 
 typedef device_delegate<u32 (screen_device &, bitmap_ind16 &, const rectangle &)> screen_update_ind16_delegate;
 typedef device_delegate<u32 (screen_device &, bitmap_rgb32 &, const rectangle &)> screen_update_rgb32_delegate;
 typedef device_delegate<void (screen_device &, bool)> screen_vblank_delegate;
 
 
+// ======================> screen_raster_state_base
+
+// interface between the screen and the per-scanline register snapshots that
+// drivers keep for raster effects; see screen_raster_state below
+class screen_raster_state_base
+{
+	friend class screen_device;
+
+public:
+	virtual ~screen_raster_state_base() { }
+
+protected:
+	// first scanline after the given one where the state changes, or the largest int
+	virtual int next_change(int scanline) const = 0;
+
+	// select the state in effect on a scanline for drawing, or the live state for -1
+	virtual void select(int scanline) = 0;
+
+	// start a new frame, keeping only the live state
+	virtual void frame_reset() = 0;
+};
+
+
 // ======================> screen_device
 
 class screen_device_svg_renderer;
@@ -252,24 +277,33 @@ public:
 
 	// additional helpers
 	void register_vblank_callback(vblank_state_delegate vblank_callback);
+	void register_scanline_callback(scanline_state_delegate scanline_callback, int first_vpos, int increment);
 	void register_screen_bitmap(bitmap_t &bitmap);
+	void register_raster_state(screen_raster_state_base &state);
 
 	// internal to the video system
 	bool update_quads();
 	void update_burnin();
+	void append_frame_crc(util::crc32_creator &crc);
 
 	// globally accessible constants
 	static constexpr int DEFAULT_FRAME_RATE = 60;
 	static const attotime DEFAULT_FRAME_PERIOD;
 
 private:
+	// the bitmap being drawn, the one the renderer was last handed, and one that
+	// may still be in flight from the frame before, so a renderer that presents
+	// a frame late never sees the emulation drawing into it
+	static constexpr int SCREEN_BITMAPS = 3;
+
 	// timer IDs
 	enum
 	{
 		TID_VBLANK_START,
 		TID_VBLANK_END,
 		TID_SCANLINE0,
-		TID_SCANLINE
+		TID_SCANLINE,
+		TID_SCANLINE_DISPATCH
 	};
 
 	// device-level overrides
@@ -287,6 +321,11 @@ private:
 	void vblank_end();
 	void finalize_burnin();
 	void load_effect_overlay(const char *filename);
+	void reset_raster_states();
+	void start_scanline_dispatch();
+	void dispatch_scanline(int vpos);
+	u32 update_spans(const rectangle &clip);
+	void flush_palettes();
 
 	// inline configuration data
 	screen_type_enum    m_type;                     // type of screen
@@ -312,8 +351,8 @@ private:
 
 	// textures and bitmaps
 	texture_format      m_texformat;                // texture format
-	render_texture *    m_texture[2];               // 2x textures for the screen bitmap
-	screen_bitmap       m_bitmap[2];                // 2x bitmaps for rendering
+	render_texture *    m_texture[SCREEN_BITMAPS];  // textures for the screen bitmaps
+	screen_bitmap       m_bitmap[SCREEN_BITMAPS];   // bitmaps for rendering, used in rotation
 	bitmap_ind8         m_priority;                 // priority bitmap
 	bitmap_ind64        m_burnin;                   // burn-in bitmap
 	u8                  m_curbitmap;                // current bitmap index
@@ -337,6 +376,8 @@ private:
 	emu_timer *         m_vblank_end_timer;         // timer to signal VBLANK end
 	emu_timer *         m_scanline0_timer;          // scanline 0 timer
 	emu_timer *         m_scanline_timer;           // scanline timer
+	emu_timer *         m_scanline_dispatch_timer;  // timer shared by all scanline callbacks
+	bool                m_scanline_dispatch_resync; // timing changed since the dispatch timer was armed
 	u64                 m_frame_number;             // the current frame number
 	u32                 m_partial_updates_this_frame;// partial update counter this frame
 
@@ -351,6 +392,19 @@ private:
 	};
 	std::vector<std::unique_ptr<callback_item>> m_callback_list;     // list of VBLANK callbacks
 
+	// scanline callbacks, fired on first_vpos and every increment lines after it
+	struct scanline_item
+	{
+		scanline_state_delegate     m_callback;
+		int                         m_first_vpos;
+		int                         m_increment;
+	};
+	std::vector<scanline_item> m_scanline_list;                     // list of scanline callbacks
+
+	std::vector<screen_raster_state_base *> m_raster_states;       // per-scanline register snapshots
+
+	std::vector<palette_device *> m_palettes;                       // palettes whose batched writes we flush before drawing
+
 	// auto-sizing bitmaps
 	class auto_bitmap_item
 	{
@@ -372,6 +426,85 @@ extern const device_type SCREEN;
 // iterator helper
 typedef device_type_iterator<&device_creator<screen_device>, screen_device> screen_device_iterator;
 
+
+// ======================> screen_raster_state
+
+// Per-scanline snapshot of whatever registers a driver's raster effects
+// depend on (scroll, bank, palette offset, ...). Rather than forcing a
+// partial update before every register write, the driver calls set() with
+// the new state; the screen then splits each update into spans of scanlines
+// that share the same state, selecting it before calling screen_update, which
+// reads it back with get(). The state type needs operator== so that
+// redundant writes don't split spans.
+template <typename T>
+class screen_raster_state : public screen_raster_state_base
+{
+public:
+	// construction
+	screen_raster_state() : m_screen(nullptr), m_selected(-1) { }
+
+	// call from video_start to attach to a screen
+	void start(screen_device &screen, const T &initial = T())
+	{
+		m_screen = &screen;
+		m_frame_start = initial;
+		m_changes.clear();
+		screen.register_raster_state(*this);
+	}
+
+	// record a new state, taking effect on the line after the beam
+	void set(const T &state) { set(m_screen->vpos() + 1, state); }
+
+	// record a new state, taking effect on the given scanline
+	void set(int scanline, const T &state)
+	{
+		// a later write to an earlier or equal line replaces what was recorded there
+		while (!m_changes.empty() && m_changes.back().first >= scanline)
+			m_changes.pop_back();
+		if (state == live())
+			return;
+		m_changes.emplace_back(scanline, state);
+	}
+
+	// the state for the span being drawn, or the live state outside of an update
+	const T &get() const { return (m_selected < 0) ? live() : state_at(m_selected); }
+
+	// the most recently recorded state
+	const T &live() const { return m_changes.empty() ? m_frame_start : m_changes.back().second; }
+
+protected:
+	virtual int next_change(int scanline) const override
+	{
+		for (const auto &change : m_changes)
+			if (change.first > scanline)
+				return change.first;
+		return std::numeric_limits<int>::max();
+	}
+
+	virtual void select(int scanline) override { m_selected = scanline; }
+
+	virtual void frame_reset() override
+	{
+		m_frame_start = live();
+		m_changes.clear();
+		m_selected = -1;
+	}
+
+private:
+	const T &state_at(int scanline) const
+	{
+		for (auto it = m_changes.rbegin(); it != m_changes.rend(); ++it)
+			if (it->first <= scanline)
+				return it->second;
+		return m_frame_start;
+	}
+
+	screen_device *     m_screen;               // screen we are attached to
+	T                   m_frame_start;          // state at the start of the frame
+	std::vector<std::pair<int, T>> m_changes;   // changes this frame, by first scanline
+	int                 m_selected;             // scanline selected for drawing, or -1
+};
+
 /*!
  @defgroup Screen device configuration macros
  @{
@@ -820,6 +820,190 @@ void softlist_parser::parse_soft_end(const char *tagname)
 }
 
 
+//**************************************************************************
+//  SOFTWARE LIST INDEX
+//**************************************************************************
+
+namespace {
+
+// little-endian field writer for building an index in memory
+class index_writer
+{
+public:
+	void u32_value(u32 value) { for (int shift = 0; shift < 32; shift += 8) m_data.push_back(u8(value >> shift)); }
+	void u64_value(u64 value) { u32_value(u32(value)); u32_value(u32(value >> 32)); }
+	void string(const std::string &value) { u32_value(value.length()); m_data.insert(m_data.end(), value.begin(), value.end()); }
+	void features(const std::list<feature_list_item> &list)
+	{
+		u32_value(list.size());
+		for (const feature_list_item &item : list)
+		{
+			string(item.name());
+			string(item.value());
+		}
+	}
+	const std::vector<u8> &data() const { return m_data; }
+
+private:
+	std::vector<u8> m_data;
+};
+
+// matching reader; any field running off the end marks the whole index bad
+class index_reader
+{
+public:
+	index_reader(const u8 *data, u64 length) : m_ptr(data), m_end(data + length), m_ok(true) { }
+
+	bool ok() const { return m_ok; }
+	u32 u32_value()
+	{
+		if (m_end - m_ptr < 4) { m_ok = false; return 0; }
+		u32 const value = m_ptr[0] | (m_ptr[1] << 8) | (m_ptr[2] << 16) | (u32(m_ptr[3]) << 24);
+		m_ptr += 4;
+		return value;
+	}
+	u64 u64_value() { u64 const low = u32_value(); return low | (u64(u32_value()) << 32); }
+	std::string string()
+	{
+		u32 const length = u32_value();
+		if (u64(m_end - m_ptr) < length) { m_ok = false; return std::string(); }
+		std::string value(reinterpret_cast<const char *>(m_ptr), length);
+		m_ptr += length;
+		return value;
+	}
+	void features(std::list<feature_list_item> &list)
+	{
+		for (u32 count = u32_value(); m_ok && count > 0; count--)
+		{
+			std::string name = string();
+			std::string value = string();
+			list.emplace_back(std::move(name), std::move(value));
+		}
+	}
+
+private:
+	const u8 *  m_ptr;
+	const u8 *  m_end;
+	bool        m_ok;
+};
+
+} // anonymous namespace
+
+
+//-------------------------------------------------
+//  read - load a software list from an index
+//  written for the given source; returns false
+//  and leaves nothing behind if the index is
+//  stale or damaged
+//-------------------------------------------------
+
+bool softlist_index::read(util::core_file &file, const std::string &source, s64 modified, u64 size, std::string &description, std::list<software_info> &infolist)
+{
+	// large indexes are mapped rather than read
+	const u8 *data = reinterpret_cast<const u8 *>(file.buffer());
+	if (data == nullptr)
+		return false;
+	index_reader reader(data, file.size());
+
+	// check that it was made from this very file
+	if (reader.u32_value() != VERSION || reader.string() != source || s64(reader.u64_value()) != modified || reader.u64_value() != size || !reader.ok())
+		return false;
+
+	std::string listdesc = reader.string();
+	std::list<software_info> list;
+	for (u32 count = reader.u32_value(); reader.ok() && count > 0; count--)
+	{
+		std::string name = reader.string();
+		std::string parent = reader.string();
+		list.emplace_back(std::move(name), std::move(parent), "");
+		software_info &info = list.back();
+		info.m_supported = reader.u32_value();
+		info.m_longname = reader.string();
+		info.m_year = reader.string();
+		info.m_publisher = reader.string();
+		reader.features(info.m_other_info);
+		reader.features(info.m_shared_info);
+
+		for (u32 parts = reader.u32_value(); reader.ok() && parts > 0; parts--)
+		{
+			std::string partname = reader.string();
+			std::string interface = reader.string();
+			info.m_partdata.emplace_back(info, std::move(partname), std::move(interface));
+			software_part &part = info.m_partdata.back();
+			reader.features(part.m_featurelist);
+
+			u32 const roms = reader.u32_value();
+			if (!reader.ok())
+				break;
+			part.m_romdata.reserve(roms);
+			for (u32 rom = 0; reader.ok() && rom < roms; rom++)
+			{
+				std::string romname = reader.string();
+				std::string hashdata = reader.string();
+				u32 const offset = reader.u32_value();
+				u32 const length = reader.u32_value();
+				u32 const flags = reader.u32_value();
+				part.m_romdata.emplace_back(std::move(romname), std::move(hashdata), offset, length, flags);
+			}
+		}
+	}
+	if (!reader.ok())
+		return false;
+
+	description = std::move(listdesc);
+	infolist.splice(infolist.end(), list);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  write - save a parsed software list as an
+//  index of the given source
+//-------------------------------------------------
+
+void softlist_index::write(util::core_file &file, const std::string &source, s64 modified, u64 size, const std::string &description, const std::list<software_info> &infolist)
+{
+	index_writer writer;
+	writer.u32_value(VERSION);
+	writer.string(source);
+	writer.u64_value(modified);
+	writer.u64_value(size);
+	writer.string(description);
+
+	writer.u32_value(infolist.size());
+	for (const software_info &info : infolist)
+	{
+		writer.string(info.shortname());
+		writer.string(info.parentname());
+		writer.u32_value(info.supported());
+		writer.string(info.longname());
+		writer.string(info.year());
+		writer.string(info.publisher());
+		writer.features(info.other_info());
+		writer.features(info.shared_info());
+
+		writer.u32_value(info.parts().size());
+		for (const software_part &part : info.parts())
+		{
+			writer.string(part.name());
+			writer.string(part.interface());
+			writer.features(part.featurelist());
+			writer.u32_value(part.romdata().size());
+			for (const rom_entry &rom : part.romdata())
+			{
+				writer.string(rom.name());
+				writer.string(rom.hashdata());
+				writer.u32_value(rom.offset());
+				writer.u32_value(rom.length());
+				writer.u32_value(rom.flags());
+			}
+		}
+	}
+
+	file.write(writer.data().data(), writer.data().size());
+}
+
+
 //-------------------------------------------------
 //  software_name_parse - helper that splits a
 //  software identifier (software_list:software:part)
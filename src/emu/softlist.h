@@ -66,6 +66,7 @@ private:
 class software_part
 {
 	friend class softlist_parser;
+	friend class softlist_index;
 
 public:
 	// construction/destruction
@@ -104,6 +105,7 @@ private:
 class software_info
 {
 	friend class softlist_parser;
+	friend class softlist_index;
 
 public:
 	// construction/destruction
@@ -206,6 +208,21 @@ private:
 };
 
 
+// ======================> softlist_index
+
+// compiled copy of a parsed software list, so it can be loaded again without the XML
+class softlist_index
+{
+public:
+	// the source path, time and size identify the XML the index was made from
+	static bool read(util::core_file &file, const std::string &source, s64 modified, u64 size, std::string &description, std::list<software_info> &infolist);
+	static void write(util::core_file &file, const std::string &source, s64 modified, u64 size, const std::string &description, const std::list<software_info> &infolist);
+
+private:
+	static constexpr u32 VERSION = 1;
+};
+
+
 // ----- Helpers -----
 
 // parses a software identifier (e.g. - 'apple2e:agentusa:flop1') into its constituent parts (returns false if cannot parse)
@@ -187,6 +187,7 @@ void software_list_device::release()
 	m_description.clear();
 	m_errors.clear();
 	m_infolist.clear();
+	m_shortnames.clear();
 }
 
 
@@ -264,6 +265,12 @@ const software_info *software_list_device::find(const std::string &look_for)
 
 	// find a match (will cause a parse if needed when calling get_info)
 	const auto &info_list = get_info();
+	if (!iswild)
+	{
+		std::string name(look_for);
+		auto const found = m_shortnames.find(strmakelower(name));
+		return (found != m_shortnames.end()) ? found->second : nullptr;
+	}
 	auto iter = std::find_if(
 		info_list.begin(),
 		info_list.end(),
@@ -297,20 +304,92 @@ void software_list_device::parse()
 	osd_file::error filerr = m_file.open(m_list_name.c_str(), ".xml");
 	if (filerr == osd_file::error::NONE)
 	{
-		// parse if no error
-		std::ostringstream errs;
-		softlist_parser parser(m_file, m_file.filename(), m_description, m_infolist, errs);
+		// parse if no error, unless there's a compiled copy of this very file
+		if (!read_index())
+		{
+			std::ostringstream errs;
+			softlist_parser parser(m_file, m_file.filename(), m_description, m_infolist, errs);
+			m_errors = errs.str();
+
+			// lists with errors are parsed every time so the errors are still reported
+			if (m_errors.empty())
+				write_index();
+		}
 		m_file.close();
-		m_errors = errs.str();
 	}
 	else
 		m_errors = string_format("Error opening file: %s\n", filename());
 
+	// index the entries by name
+	for (const software_info &swinfo : m_infolist)
+	{
+		std::string name(swinfo.shortname());
+		m_shortnames.emplace(strmakelower(name), &swinfo);
+	}
+
 	// indicate that we've been parsed
 	m_parsed = true;
 }
 
 
+//-------------------------------------------------
+//  index_source - get the time and size of the
+//  open XML file if compiled lists are in use
+//-------------------------------------------------
+
+bool software_list_device::index_source(s64 &modified, u64 &size)
+{
+	if (!mconfig().options().softlist_index())
+		return false;
+
+	// lists that aren't plain files (in archives, for instance) aren't compiled
+	auto const stat = osd_stat(m_file.fullpath());
+	if (!stat || stat->type != osd::directory::entry::entry_type::FILE)
+		return false;
+	modified = std::chrono::duration_cast<std::chrono::seconds>(stat->last_modified.time_since_epoch()).count();
+	size = stat->size;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  read_index - load our list from its compiled
+//  copy in the cfg directory, if that was made
+//  from the XML file that's open
+//-------------------------------------------------
+
+bool software_list_device::read_index()
+{
+	s64 modified;
+	u64 size;
+	if (!index_source(modified, size))
+		return false;
+
+	emu_file file(mconfig().options().cfg_directory(), OPEN_FLAG_READ);
+	if (file.open(m_list_name.c_str(), ".sli") != osd_file::error::NONE)
+		return false;
+	return softlist_index::read(file, m_file.fullpath(), modified, size, m_description, m_infolist);
+}
+
+
+//-------------------------------------------------
+//  write_index - save our freshly parsed list
+//  to the cfg directory
+//-------------------------------------------------
+
+void software_list_device::write_index()
+{
+	s64 modified;
+	u64 size;
+	if (!index_source(modified, size))
+		return;
+
+	emu_file file(mconfig().options().cfg_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(m_list_name.c_str(), ".sli") == osd_file::error::NONE)
+		softlist_index::write(file, m_file.fullpath(), modified, size, m_description, m_infolist);
+}
+
+
 //-------------------------------------------------
 //  is_compatible - determine if we are compatible
 //  with the given software_list_device
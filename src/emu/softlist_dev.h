@@ -169,6 +169,9 @@ protected:
 private:
 	// internal helpers
 	void parse();
+	bool index_source(s64 &modified, u64 &size);
+	bool read_index();
+	void write_index();
 	void internal_validity_check(validity_checker &valid) ATTR_COLD;
 
 	// configuration state
@@ -182,6 +185,7 @@ private:
 	std::string                 m_description;
 	std::string                 m_errors;
 	std::list<software_info>    m_infolist;
+	std::unordered_map<std::string, const software_info *> m_shortnames; // entries by lowercase name
 };
 
 
@@ -36,7 +36,6 @@
 //  GLOBAL VARIABLES
 //**************************************************************************
 
-const attotime sound_manager::STREAMS_UPDATE_ATTOTIME = attotime::from_hz(STREAMS_UPDATE_FREQUENCY);
 
 
 
@@ -53,6 +52,7 @@ sound_stream::sound_stream(device_t &device, int inputs, int outputs, int sample
 		m_next(nullptr),
 		m_sample_rate(sample_rate),
 		m_new_sample_rate(0),
+		m_pure(false),
 		m_attoseconds_per_sample(0),
 		m_max_samples_per_update(0),
 		m_input(inputs),
@@ -253,6 +253,19 @@ void sound_stream::set_input(int index, sound_stream *input_stream, int output_i
 
 	// update sample rates now that we know the input
 	recompute_sample_rate_data();
+	m_device.machine().sound().m_pure_plan_dirty = true;
+}
+
+
+//-------------------------------------------------
+//  set_pure - mark a stream as safe to update
+//  on a worker thread
+//-------------------------------------------------
+
+void sound_stream::set_pure(bool pure)
+{
+	m_pure = pure;
+	m_device.machine().sound().m_pure_plan_dirty = true;
 }
 
 
@@ -262,6 +275,28 @@ void sound_stream::set_input(int index, sound_stream *input_stream, int output_i
 //-------------------------------------------------
 
 void sound_stream::update()
+{
+	s32 update_sampindex = current_sampindex();
+
+	// generate samples to get us up to the appropriate time
+	g_profiler.start(PROFILER_SOUND);
+	assert(m_output_sampindex - m_output_base_sampindex >= 0);
+	assert(update_sampindex - m_output_base_sampindex <= m_output_bufalloc);
+	generate_samples(update_sampindex - m_output_sampindex);
+	g_profiler.stop();
+
+	// remember this info for next time
+	m_output_sampindex = update_sampindex;
+}
+
+
+//-------------------------------------------------
+//  current_sampindex - return the output sample
+//  matching the current emulated time, relative
+//  to the second of the last global update
+//-------------------------------------------------
+
+s32 sound_stream::current_sampindex() const
 {
 	// determine the number of samples since the start of this second
 	attotime time = m_device.machine().time();
@@ -281,15 +316,20 @@ void sound_stream::update()
 		assert(time.seconds() == last_update.seconds() - 1);
 		update_sampindex -= m_sample_rate;
 	}
+	return update_sampindex;
+}
 
-	// generate samples to get us up to the appropriate time
-	g_profiler.start(PROFILER_SOUND);
-	assert(m_output_sampindex - m_output_base_sampindex >= 0);
-	assert(update_sampindex - m_output_base_sampindex <= m_output_bufalloc);
-	generate_samples(update_sampindex - m_output_sampindex);
-	g_profiler.stop();
 
-	// remember this info for next time
+//-------------------------------------------------
+//  update_from_worker - update a pure stream
+//  whose inputs are already current, without
+//  touching the profiler or any other stream
+//-------------------------------------------------
+
+void sound_stream::update_from_worker()
+{
+	s32 update_sampindex = current_sampindex();
+	generate_samples(update_sampindex - m_output_sampindex, false);
 	m_output_sampindex = update_sampindex;
 }
 
@@ -502,6 +542,20 @@ void sound_stream::recompute_sample_rate_data()
 			else if (input.m_source->m_stream->m_sample_rate == m_sample_rate)
 				latency = 0;
 
+			// use a FIR when the rates differ, as long as its window fits comfortably within
+			// the history kept by the source; it needs half a window of lookahead
+			input.m_filter = nullptr;
+			u32 source_rate = input.m_source->m_stream->m_sample_rate;
+			if (source_rate != m_sample_rate)
+			{
+				int taps = resample_filter::taps_for_rates(source_rate, m_sample_rate);
+				if (taps != 0 && (taps + 2) * new_attosecs_per_sample < update_attoseconds)
+				{
+					input.m_filter = m_device.machine().sound().find_resample_filter(source_rate, m_sample_rate);
+					latency = std::max(latency, (taps / 2 + 2) * new_attosecs_per_sample);
+				}
+			}
+
 			// we generally don't want to tweak the latency, so we just keep the greatest
 			// one we've computed thus far
 			input.m_latency_attoseconds = std::max(input.m_latency_attoseconds, latency);
@@ -596,7 +650,7 @@ void sound_stream::postload()
 //  samples generated
 //-------------------------------------------------
 
-void sound_stream::generate_samples(int samples)
+void sound_stream::generate_samples(int samples, bool update_inputs)
 {
 	stream_sample_t **inputs = nullptr;
 	stream_sample_t **outputs = nullptr;
@@ -611,7 +665,7 @@ void sound_stream::generate_samples(int samples)
 	{
 		// update the stream to the current time
 		stream_input &input = m_input[inputnum];
-		if (input.m_source != nullptr)
+		if (input.m_source != nullptr && update_inputs)
 			input.m_source->m_stream->update();
 
 		// generate the resampled data
@@ -637,7 +691,9 @@ void sound_stream::generate_samples(int samples)
 
 	// run the callback
 	VPRINTF(("  callback(%p, %d)\n", (void *)this, samples));
+	g_profiler.trace_begin(m_device.tag(), "sound");
 	m_callback(*this, inputs, outputs, samples);
+	g_profiler.trace_end();
 	VPRINTF(("  callback done\n"));
 }
 
@@ -685,10 +741,37 @@ stream_sample_t *sound_stream::generate_resampled_data(stream_input &input, u32
 	// compute the stepping fraction
 	u32 step = (u64(input_stream.m_sample_rate) << FRAC_BITS) / m_sample_rate;
 
-	// if we have equal sample rates, we just need to copy
-	if (step == FRAC_ONE)
+	// if we have a FIR for this pair of rates, run every output sample through it
+	const resample_filter *filter = input.m_filter;
+	if (filter != nullptr && filter->input_rate() == input_stream.m_sample_rate && filter->output_rate() == m_sample_rate)
 	{
+		// the window is centered between source[0] and source[1]
+		int taps = filter->taps();
+		assert(source - (taps / 2 - 1) >= &output.m_buffer[0]);
+		source -= taps / 2 - 1;
 		while (numsamples--)
+		{
+			const s32 *coeffs = filter->phase(basefrac >> (FRAC_BITS - resample_filter::PHASE_BITS));
+			s64 sample = 0;
+			for (int tap = 0; tap < taps; tap++)
+				sample += s64(source[tap]) * coeffs[tap];
+			sample >>= resample_filter::COEFF_BITS;
+			*dest++ = (sample * gain) >> 8;
+
+			// advance
+			basefrac += step;
+			source += basefrac >> FRAC_BITS;
+			basefrac &= FRAC_MASK;
+		}
+	}
+
+	// if we have equal sample rates, we just need to copy
+	else if (step == FRAC_ONE)
+	{
+		// unity gain is by far the most common case; skip the multiplies entirely
+		if (gain == 0x100)
+			memcpy(dest, source, numsamples * sizeof(*dest));
+		else while (numsamples--)
 		{
 			// compute the sample
 			s64 sample = *source++;
@@ -763,6 +846,65 @@ stream_sample_t *sound_stream::generate_resampled_data(stream_input &input, u32
 
 
 
+//**************************************************************************
+//  RESAMPLE FILTER
+//**************************************************************************
+
+//-------------------------------------------------
+//  resample_filter - constructor
+//-------------------------------------------------
+
+resample_filter::resample_filter(u32 input_rate, u32 output_rate)
+	: m_input_rate(input_rate),
+		m_output_rate(output_rate),
+		m_taps(taps_for_rates(input_rate, output_rate)),
+		m_coeffs(PHASES * m_taps)
+{
+	assert(m_taps != 0);
+
+	// cut off a little below the lower of the two Nyquist frequencies, in cycles per input sample
+	double cutoff = 0.45 * std::min(1.0, double(output_rate) / double(input_rate));
+	double halfwidth = m_taps / 2;
+
+	for (int phase = 0; phase < PHASES; phase++)
+	{
+		// windowed sinc, evaluated at the distance from each tap to the output position
+		std::vector<double> ideal(m_taps);
+		double sum = 0;
+		for (int tap = 0; tap < m_taps; tap++)
+		{
+			double dist = double(phase) / PHASES + (m_taps / 2 - 1) - tap;
+			double x = 2.0 * M_PI * cutoff * dist;
+			double sinc = (dist == 0) ? 1.0 : sin(x) / x;
+			double window = 0.42 + 0.5 * cos(M_PI * dist / halfwidth) + 0.08 * cos(2.0 * M_PI * dist / halfwidth);
+			ideal[tap] = sinc * window;
+			sum += ideal[tap];
+		}
+
+		// normalize each phase to unity gain at DC so constant input stays constant
+		s32 *coeffs = &m_coeffs[phase * m_taps];
+		for (int tap = 0; tap < m_taps; tap++)
+			coeffs[tap] = s32(floor(ideal[tap] / sum * (1 << COEFF_BITS) + 0.5));
+	}
+}
+
+
+//-------------------------------------------------
+//  taps_for_rates - return the number of taps
+//  needed for a rate pair, or 0 if the input is
+//  so oversampled that box averaging is cheaper
+//-------------------------------------------------
+
+int resample_filter::taps_for_rates(u32 input_rate, u32 output_rate)
+{
+	// the window has to widen with the decimation ratio to keep the same quality
+	u32 ratio = (input_rate + output_rate - 1) / output_rate;
+	int taps = MIN_TAPS * std::max<u32>(ratio, 1);
+	return (taps <= MAX_TAPS) ? taps : 0;
+}
+
+
+
 //**************************************************************************
 //  STREAM INPUT
 //**************************************************************************
@@ -774,6 +916,7 @@ stream_sample_t *sound_stream::generate_resampled_data(stream_input &input, u32
 sound_stream::stream_input::stream_input()
 	: m_source(nullptr),
 		m_latency_attoseconds(0),
+		m_filter(nullptr),
 		m_gain(0x100),
 		m_user_gain(0x100)
 {
@@ -816,9 +959,12 @@ sound_manager::sound_manager(running_machine &machine)
 		m_muted(0),
 		m_attenuation(0),
 		m_nosound_mode(machine.osd().no_sound()),
+		m_output_suppressed(false),
 		m_wavfile(nullptr),
-		m_update_attoseconds(STREAMS_UPDATE_ATTOTIME.attoseconds()),
-		m_last_update(attotime::zero)
+		m_update_attoseconds(attotime::from_hz(std::max(machine.options().sound_update_rate(), STREAMS_UPDATE_FREQUENCY)).attoseconds()),
+		m_last_update(attotime::zero),
+		m_work_queue(nullptr),
+		m_pure_plan_dirty(true)
 {
 	// get filename for WAV file or AVI file if specified
 	const char *wavfile = machine.options().wav_write();
@@ -849,7 +995,8 @@ sound_manager::sound_manager(running_machine &machine)
 
 	// start the periodic update flushing timer
 	m_update_timer = machine.scheduler().timer_alloc(timer_expired_delegate(FUNC(sound_manager::update), this));
-	m_update_timer->adjust(STREAMS_UPDATE_ATTOTIME, 0, STREAMS_UPDATE_ATTOTIME);
+	attotime update_period(0, m_update_attoseconds);
+	m_update_timer->adjust(update_period, 0, update_period);
 }
 
 
@@ -859,6 +1006,22 @@ sound_manager::sound_manager(running_machine &machine)
 
 sound_manager::~sound_manager()
 {
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
+}
+
+
+//-------------------------------------------------
+//  find_resample_filter - return the shared FIR
+//  for a pair of rates, building it on first use
+//-------------------------------------------------
+
+const resample_filter *sound_manager::find_resample_filter(u32 input_rate, u32 output_rate)
+{
+	std::unique_ptr<resample_filter> &filter = m_resample_filters[std::make_pair(input_rate, output_rate)];
+	if (!filter)
+		filter = std::make_unique<resample_filter>(input_rate, output_rate);
+	return filter.get();
 }
 
 
@@ -983,6 +1146,100 @@ void sound_manager::resume()
 }
 
 
+//-------------------------------------------------
+//  plan_pure_streams - group the streams that can
+//  be updated on worker threads by their depth in
+//  the graph, so each group only depends on the
+//  ones before it
+//-------------------------------------------------
+
+void sound_manager::plan_pure_streams()
+{
+	m_pure_plan_dirty = false;
+	m_pure_levels.clear();
+
+	// a stream qualifies if it is pure and asynchronous and all of its sources qualify;
+	// -2 marks streams not yet visited, -1 ones that don't qualify (or are being visited,
+	// which also keeps any cycle out of the plan)
+	std::unordered_map<sound_stream *, int> depth;
+	std::function<int (sound_stream &)> compute_depth = [&depth, &compute_depth] (sound_stream &stream)
+	{
+		auto found = depth.find(&stream);
+		if (found != depth.end())
+			return found->second;
+		depth[&stream] = -1;
+		if (!stream.m_pure || stream.m_synchronous)
+			return -1;
+
+		int result = 0;
+		for (auto &input : stream.m_input)
+			if (input.m_source != nullptr)
+			{
+				int source_depth = compute_depth(*input.m_source->m_stream);
+				if (source_depth < 0)
+					return -1;
+				result = std::max(result, source_depth + 1);
+			}
+		depth[&stream] = result;
+		return result;
+	};
+
+	int count = 0;
+	for (auto &stream : m_stream_list)
+	{
+		int level = compute_depth(*stream);
+		if (level < 0)
+			continue;
+		if (level >= int(m_pure_levels.size()))
+			m_pure_levels.resize(level + 1);
+		m_pure_levels[level].push_back(stream.get());
+		count++;
+	}
+
+	// it's only worth handing work to other threads if there is more than one stream
+	if (count < 2)
+		m_pure_levels.clear();
+	else if (m_work_queue == nullptr)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+}
+
+
+//-------------------------------------------------
+//  update_pure_streams - update every pure stream,
+//  one depth level at a time, each level in
+//  parallel on the work queue
+//-------------------------------------------------
+
+void sound_manager::update_pure_streams()
+{
+	if (m_pure_plan_dirty)
+		plan_pure_streams();
+
+	for (auto &level : m_pure_levels)
+	{
+		if (level.size() == 1)
+			level[0]->update_from_worker();
+		else
+		{
+			osd_work_item_queue_multiple(m_work_queue, pure_stream_callback, level.size(), &level[0], sizeof(level[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+			osd_work_queue_wait(m_work_queue, osd_ticks_per_second() * 10);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  pure_stream_callback - work item updating one
+//  pure stream
+//-------------------------------------------------
+
+void *sound_manager::pure_stream_callback(void *param, int threadid)
+{
+	(*reinterpret_cast<sound_stream **>(param))->update_from_worker();
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  config_load - read and apply data from the
 //  configuration file
@@ -1057,6 +1314,9 @@ void sound_manager::update(void *ptr, int param)
 
 	g_profiler.start(PROFILER_SOUND);
 
+	// bring the pure parts of the graph up to date in parallel before pulling the rest
+	update_pure_streams();
+
 	// force all the speaker streams to generate the proper number of samples
 	int samples_this_update = 0;
 	for (speaker_device &speaker : speaker_device_iterator(machine().root_device()))
@@ -1067,7 +1327,24 @@ void sound_manager::update(void *ptr, int param)
 	u32 finalmix_offset = 0;
 	s16 *finalmix = &m_finalmix[0];
 	int sample;
-	for (sample = m_finalmix_leftover; sample < samples_this_update * 1000; sample += finalmix_step)
+	if (finalmix_step == 1000)
+	{
+		// normal speed: every mixed sample is used once, so clamp them in a straight
+		// loop the compiler can vectorize instead of stepping through fractions
+		int sampindex = m_finalmix_leftover / 1000;
+		if (sampindex < samples_this_update)
+		{
+			for ( ; sampindex < samples_this_update; sampindex++)
+			{
+				finalmix[finalmix_offset++] = std::max(-32768, std::min(32767, m_leftmix[sampindex]));
+				finalmix[finalmix_offset++] = std::max(-32768, std::min(32767, m_rightmix[sampindex]));
+			}
+			sample = samples_this_update * 1000 + m_finalmix_leftover % 1000;
+		}
+		else
+			sample = m_finalmix_leftover;
+	}
+	else for (sample = m_finalmix_leftover; sample < samples_this_update * 1000; sample += finalmix_step)
 	{
 		int sampindex = sample / 1000;
 
@@ -1090,12 +1367,13 @@ void sound_manager::update(void *ptr, int param)
 	m_finalmix_leftover = sample - samples_this_update * 1000;
 
 	// play the result
-	if (finalmix_offset > 0)
+	if (finalmix_offset > 0 && !m_output_suppressed)
 	{
 		if (!m_nosound_mode)
 			machine().osd().update_audio_stream(finalmix, finalmix_offset / 2);
 		machine().osd().add_audio_to_recording(finalmix, finalmix_offset / 2);
 		machine().video().add_sound_to_recording(finalmix, finalmix_offset / 2);
+		m_mix_crc.append(finalmix, finalmix_offset * sizeof(*finalmix));
 		if (m_wavfile != nullptr)
 			wav_add_data_16(m_wavfile, finalmix, finalmix_offset);
 	}
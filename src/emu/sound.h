@@ -48,6 +48,39 @@ struct mixer_input
 };
 
 
+// ======================> resample_filter
+
+// polyphase FIR coefficients for converting between one pair of sample rates;
+// built once by the sound manager and shared by every input using that pair
+class resample_filter
+{
+public:
+	static constexpr int PHASE_BITS     = 6;
+	static constexpr int PHASES         = 1 << PHASE_BITS;
+	static constexpr int COEFF_BITS     = 15;
+	static constexpr int MIN_TAPS       = 16;
+	static constexpr int MAX_TAPS       = 128;
+
+	// construction/destruction
+	resample_filter(u32 input_rate, u32 output_rate);
+
+	// getters
+	u32 input_rate() const { return m_input_rate; }
+	u32 output_rate() const { return m_output_rate; }
+	int taps() const { return m_taps; }
+	const s32 *phase(u32 index) const { return &m_coeffs[index * m_taps]; }
+
+	// number of taps needed for a pair of rates, or 0 if the pair is too far apart
+	static int taps_for_rates(u32 input_rate, u32 output_rate);
+
+private:
+	u32                 m_input_rate;           // rate we convert from
+	u32                 m_output_rate;          // rate we convert to
+	int                 m_taps;                 // taps per phase
+	std::vector<s32>    m_coeffs;               // PHASES rows of m_taps coefficients
+};
+
+
 // ======================> sound_stream
 
 class sound_stream
@@ -83,6 +116,7 @@ class sound_stream
 		stream_output *     m_source;               // pointer to the sound_output for this source
 		std::vector<stream_sample_t> m_resample;  // buffer for resampling to the stream's sample rate
 		attoseconds_t       m_latency_attoseconds;  // latency between this stream and the input stream
+		const resample_filter *m_filter;          // FIR used to change rates, or nullptr for the simple resampler
 		s16               m_gain;                 // gain to apply to this input
 		s16               m_user_gain;            // user-controlled gain to apply to this input
 	};
@@ -111,6 +145,7 @@ public:
 	float user_gain(int inputnum) const;
 	float input_gain(int inputnum) const;
 	float output_gain(int outputnum) const;
+	bool pure() const { return m_pure; }
 
 	// operations
 	void set_input(int inputnum, sound_stream *input_stream, int outputnum = 0, float gain = 1.0f);
@@ -123,6 +158,10 @@ public:
 	void set_input_gain(int inputnum, float gain);
 	void set_output_gain(int outputnum, float gain);
 
+	// a pure stream's callback only touches its own device's state, so the global
+	// update may run it on a worker thread alongside other pure streams
+	void set_pure(bool pure = true);
+
 private:
 	// helpers called by our friends only
 	void update_with_accounting(bool second_tick);
@@ -133,7 +172,9 @@ private:
 	void allocate_resample_buffers();
 	void allocate_output_buffers();
 	void postload();
-	void generate_samples(int samples);
+	s32 current_sampindex() const;
+	void update_from_worker();
+	void generate_samples(int samples, bool update_inputs = true);
 	stream_sample_t *generate_resampled_data(stream_input &input, u32 numsamples);
 	void sync_update(void *, s32);
 
@@ -145,6 +186,7 @@ private:
 	u32                 m_sample_rate;                // sample rate of this stream
 	u32                 m_new_sample_rate;            // newly-set sample rate for the stream
 	bool                m_synchronous;                // synchronous stream that runs at the rate of its input
+	bool                m_pure;                       // callback is safe to run on a worker thread
 
 	// timing information
 	attoseconds_t       m_attoseconds_per_sample;     // number of attoseconds per sample
@@ -185,10 +227,9 @@ class sound_manager
 	static constexpr u8 MUTE_REASON_DEBUGGER = 0x04;
 	static constexpr u8 MUTE_REASON_SYSTEM = 0x08;
 
-	// stream updates
-	static const attotime STREAMS_UPDATE_ATTOTIME;
-
 public:
+	// default and minimum rate of global updates; -sound_update_rate can raise it
+	// to hand smaller blocks to the OSD more often
 	static constexpr int STREAMS_UPDATE_FREQUENCY = 50;
 
 	// construction/destruction
@@ -213,10 +254,15 @@ public:
 	void debugger_mute(bool turn_off = true) { mute(turn_off, MUTE_REASON_DEBUGGER); }
 	void system_mute(bool turn_off = true) { mute(turn_off, MUTE_REASON_SYSTEM); }
 	void system_enable(bool turn_on = true) { mute(!turn_on, MUTE_REASON_SYSTEM); }
+	void suppress_output(bool suppress = true) { m_output_suppressed = suppress; }
+	util::crc32_t take_mix_crc() { util::crc32_t const result = m_mix_crc.finish(); m_mix_crc.reset(); return result; }
 
 	// user gain controls
 	bool indexed_mixer_input(int index, mixer_input &info) const;
 
+	// resampling
+	const resample_filter *find_resample_filter(u32 input_rate, u32 output_rate);
+
 private:
 	// internal helpers
 	void mute(bool mute, u8 reason);
@@ -227,6 +273,9 @@ private:
 	void config_save(config_type cfg_type, util::xml::data_node *parentnode);
 
 	void update(void *ptr = nullptr, s32 param = 0);
+	void plan_pure_streams();
+	void update_pure_streams();
+	static void *pure_stream_callback(void *param, int threadid);
 
 	// internal state
 	running_machine &   m_machine;              // reference to our machine
@@ -240,13 +289,21 @@ private:
 	u8                  m_muted;
 	int                 m_attenuation;
 	int                 m_nosound_mode;
+	bool                m_output_suppressed;    // discard mixed output (frames that will be rolled back)
 
 	wav_file *          m_wavfile;
+	util::crc32_creator m_mix_crc;              // checksum of the output since the last take_mix_crc
 
 	// streams data
 	std::vector<std::unique_ptr<sound_stream>> m_stream_list;    // list of streams
 	attoseconds_t       m_update_attoseconds;   // attoseconds between global updates
 	attotime            m_last_update;          // last update time
+	std::map<std::pair<u32, u32>, std::unique_ptr<resample_filter>> m_resample_filters; // shared FIR tables, by rate pair
+
+	// parallel update of pure streams
+	osd_work_queue *    m_work_queue;           // queue for updating pure streams, or nullptr
+	bool                m_pure_plan_dirty;      // stream graph changed since the levels were computed
+	std::vector<std::vector<sound_stream *>> m_pure_levels; // pure streams, grouped by depth in the graph
 };
 
 
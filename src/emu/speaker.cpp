@@ -152,5 +152,7 @@ void speaker_device::mix(s32 *leftmix, s32 *rightmix, int &samples_this_update,
 
 void speaker_device::device_start()
 {
-	// dummy save to make device.c happy
+	// the mixer stream only sums its inputs, so it can be updated on a worker thread
+	if (m_mixer_stream != nullptr)
+		m_mixer_stream->set_pure();
 }
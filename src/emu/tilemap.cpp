@@ -10,6 +10,25 @@
 
 #include "emu.h"
 
+#if defined(__SSE2__) || (defined(_MSC_VER) && defined(PTR64))
+#include <emmintrin.h>
+#define TILEMAP_SSE2_PRIORITY   (1)
+#else
+#define TILEMAP_SSE2_PRIORITY   (0)
+#endif
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// tall draws are split into bands of at least this many rows, rendered in parallel
+const int TILEMAP_BAND_MIN_ROWS = 32;
+
+// upper limit on the number of bands in a single draw
+const int TILEMAP_MAX_BANDS = 8;
+
+
 
 //**************************************************************************
 //  INLINE FUNCTIONS
@@ -99,6 +118,56 @@ inline bool tilemap_t::gfx_elements_changed()
 //  SCANLINE RASTERIZERS
 //**************************************************************************
 
+//-------------------------------------------------
+//  scanline_priority_opaque - apply a priority
+//  code across a run of the priority bitmap
+//-------------------------------------------------
+
+static inline void scanline_priority_opaque(int count, u8 *pri, u32 pcode)
+{
+	int i = 0;
+#if TILEMAP_SSE2_PRIORITY
+	const __m128i keep = _mm_set1_epi8(u8(pcode >> 8));
+	const __m128i code = _mm_set1_epi8(u8(pcode));
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&pri[i]));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&pri[i]), _mm_or_si128(_mm_and_si128(p, keep), code));
+	}
+#endif
+	for ( ; i < count; i++)
+		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+}
+
+
+//-------------------------------------------------
+//  scanline_priority_masked - apply a priority
+//  code to the pixels of a run that pass the mask
+//-------------------------------------------------
+
+static inline void scanline_priority_masked(const u8 *maskptr, int mask, int value, int count, u8 *pri, u32 pcode)
+{
+	int i = 0;
+#if TILEMAP_SSE2_PRIORITY
+	const __m128i keep = _mm_set1_epi8(u8(pcode >> 8));
+	const __m128i code = _mm_set1_epi8(u8(pcode));
+	const __m128i maskv = _mm_set1_epi8(u8(mask));
+	const __m128i valuev = _mm_set1_epi8(u8(value));
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&maskptr[i]));
+		__m128i pass = _mm_cmpeq_epi8(_mm_and_si128(m, maskv), valuev);
+		__m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&pri[i]));
+		__m128i updated = _mm_or_si128(_mm_and_si128(p, keep), code);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&pri[i]), _mm_or_si128(_mm_and_si128(pass, updated), _mm_andnot_si128(pass, p)));
+	}
+#endif
+	for ( ; i < count; i++)
+		if ((maskptr[i] & mask) == value)
+			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+}
+
+
 //-------------------------------------------------
 //  scanline_draw_opaque_null - draw to a nullptr
 //  bitmap, setting priority only
@@ -111,8 +180,7 @@ inline void tilemap_t::scanline_draw_opaque_null(int count, u8 *pri, u32 pcode)
 		return;
 
 	// update priority across the scanline
-	for (int i = 0; i < count; i++)
-		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+	scanline_priority_opaque(count, pri, pcode);
 }
 
 
@@ -128,9 +196,7 @@ inline void tilemap_t::scanline_draw_masked_null(const u8 *maskptr, int mask, in
 		return;
 
 	// update priority across the scanline, checking the mask
-	for (int i = 0; i < count; i++)
-		if ((maskptr[i] & mask) == value)
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+	scanline_priority_masked(maskptr, mask, value, count, pri, pcode);
 }
 
 
@@ -154,18 +220,15 @@ inline void tilemap_t::scanline_draw_opaque_ind16(u16 *dest, const u16 *source,
 			return;
 
 		// update priority across the scanline
-		for (int i = 0; i < count; i++)
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+		scanline_priority_opaque(count, pri, pcode);
 	}
 
 	// priority case
 	else if ((pcode & 0xffff) != 0xff00)
 	{
 		for (int i = 0; i < count; i++)
-		{
 			dest[i] = source[i] + pal;
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
+		scanline_priority_opaque(count, pri, pcode);
 	}
 
 	// no priority case
@@ -191,10 +254,8 @@ inline void tilemap_t::scanline_draw_masked_ind16(u16 *dest, const u16 *source,
 	{
 		for (int i = 0; i < count; i++)
 			if ((maskptr[i] & mask) == value)
-			{
 				dest[i] = source[i] + pal;
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
+		scanline_priority_masked(maskptr, mask, value, count, pri, pcode);
 	}
 
 	// no priority case
@@ -221,10 +282,8 @@ inline void tilemap_t::scanline_draw_opaque_rgb32(u32 *dest, const u16 *source,
 	if ((pcode & 0xffff) != 0xff00)
 	{
 		for (int i = 0; i < count; i++)
-		{
 			dest[i] = clut[source[i]];
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
+		scanline_priority_opaque(count, pri, pcode);
 	}
 
 	// no priority case
@@ -250,10 +309,8 @@ inline void tilemap_t::scanline_draw_masked_rgb32(u32 *dest, const u16 *source,
 	{
 		for (int i = 0; i < count; i++)
 			if ((maskptr[i] & mask) == value)
-			{
 				dest[i] = clut[source[i]];
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
+		scanline_priority_masked(maskptr, mask, value, count, pri, pcode);
 	}
 
 	// no priority case
@@ -279,10 +336,8 @@ inline void tilemap_t::scanline_draw_opaque_rgb32_alpha(u32 *dest, const u16 *so
 	if ((pcode & 0xffff) != 0xff00)
 	{
 		for (int i = 0; i < count; i++)
-		{
 			dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
+		scanline_priority_opaque(count, pri, pcode);
 	}
 
 	// no priority case
@@ -309,10 +364,8 @@ inline void tilemap_t::scanline_draw_masked_rgb32_alpha(u32 *dest, const u16 *so
 	{
 		for (int i = 0; i < count; i++)
 			if ((maskptr[i] & mask) == value)
-			{
 				dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
+		scanline_priority_masked(maskptr, mask, value, count, pri, pcode);
 	}
 
 	// no priority case
@@ -371,6 +424,7 @@ tilemap_t &tilemap_t::init(tilemap_manager &manager, device_gfx_interface &decod
 	m_attributes = 0;
 	m_all_tiles_dirty = true;
 	m_all_tiles_clean = false;
+	m_dirty_list_overflow = true;
 	m_palette_offset = 0;
 	m_gfx_used = 0;
 	memset(m_gfx_dirtyseq, 0, sizeof(m_gfx_dirtyseq));
@@ -387,10 +441,14 @@ tilemap_t &tilemap_t::init(tilemap_manager &manager, device_gfx_interface &decod
 	m_dy = 0;
 	m_dy_flipped = 0;
 
-	// allocate pixmap
+	// allocate pixmap; every tile starts dirty, so it is all drawn before it is read
+	m_pixmap.set_row_alignment(bitmap_t::CACHE_LINE_BYTES);
+	m_pixmap.set_zero_fill(false);
 	m_pixmap.allocate(m_width, m_height);
 
 	// allocate transparency mapping
+	m_flagsmap.set_row_alignment(bitmap_t::CACHE_LINE_BYTES);
+	m_flagsmap.set_zero_fill(false);
 	m_flagsmap.allocate(m_width, m_height);
 	memset(m_pen_to_flags, 0, sizeof(m_pen_to_flags));
 
@@ -450,7 +508,23 @@ void tilemap_t::mark_tile_dirty(tilemap_memory_index memindex)
 		logical_index logindex = m_memory_to_logical[memindex];
 		if (logindex != INVALID_LOGICAL_INDEX)
 		{
-			m_tileflags[logindex] = TILE_FLAG_DIRTY;
+			if (m_tileflags[logindex] != TILE_FLAG_DIRTY)
+			{
+				m_tileflags[logindex] = TILE_FLAG_DIRTY;
+
+				// remember it for pixmap_update, unless a full scan is already due; tiles
+				// redrawn by draw() are not removed, so cap the list at a quarter of the map
+				if (!m_dirty_list_overflow)
+				{
+					if (m_dirty_list.size() < m_tileflags.size() / 4)
+						m_dirty_list.push_back(logindex);
+					else
+					{
+						m_dirty_list.clear();
+						m_dirty_list_overflow = true;
+					}
+				}
+			}
 			m_all_tiles_clean = false;
 		}
 	}
@@ -646,6 +720,7 @@ void tilemap_t::mappings_create()
 	m_memory_to_logical.resize(max_memory_index);
 	m_logical_to_memory.resize(max_logical_index);
 	m_tileflags.resize(max_logical_index);
+	m_dirty_list.reserve(max_logical_index / 4);
 
 	// update the mappings
 	mappings_update();
@@ -700,6 +775,10 @@ inline void tilemap_t::realize_all_dirty_tiles()
 		memset(&m_tileflags[0], TILE_FLAG_DIRTY, m_tileflags.size());
 		m_all_tiles_dirty = false;
 		m_gfx_used = 0;
+
+		// the dirty list no longer covers everything
+		m_dirty_list.clear();
+		m_dirty_list_overflow = true;
 	}
 }
 
@@ -722,14 +801,27 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	// flush the dirty state to all tiles as appropriate
 	realize_all_dirty_tiles();
 
-	// iterate over rows and columns
-	logical_index logindex = 0;
-	for (u32 row = 0; row < m_rows; row++)
-		for (u32 col = 0; col < m_cols; col++, logindex++)
+	// if the dirty list is complete, only visit the tiles on it
+	if (!m_dirty_list_overflow)
+	{
+		for (logical_index logindex : m_dirty_list)
 			if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
-				tile_update(logindex, col, row);
+				tile_update(logindex, logindex % m_cols, logindex / m_cols);
+	}
+
+	// otherwise iterate over rows and columns
+	else
+	{
+		logical_index logindex = 0;
+		for (u32 row = 0; row < m_rows; row++)
+			for (u32 col = 0; col < m_cols; col++, logindex++)
+				if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
+					tile_update(logindex, col, row);
+	}
 
 	// mark it all clean
+	m_dirty_list.clear();
+	m_dirty_list_overflow = false;
 	m_all_tiles_clean = true;
 
 g_profiler.stop();
@@ -955,6 +1047,48 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	u32 width = visarea.min_x + visarea.max_x + 1;
 	u32 height = visarea.min_y + visarea.max_y + 1;
 
+	// split tall draws into bands of rows rendered in parallel; each band
+	// touches its own rows of dest and the priority bitmap, so once every
+	// tile has been brought up to date here they need no locking
+	int bands = draw_band_count(blit.cliprect);
+	if (bands > 1)
+	{
+		pixmap_update();
+		m_palette->flush_writes();
+
+		draw_band<_BitmapClass> band[TILEMAP_MAX_BANDS];
+		int rows = blit.cliprect.height();
+		for (int bandnum = 0; bandnum < bands; bandnum++)
+		{
+			band[bandnum].tilemap = this;
+			band[bandnum].screen = &screen;
+			band[bandnum].dest = &dest;
+			band[bandnum].blit = blit;
+			band[bandnum].blit.cliprect.min_y = blit.cliprect.min_y + rows * bandnum / bands;
+			band[bandnum].blit.cliprect.max_y = blit.cliprect.min_y + rows * (bandnum + 1) / bands - 1;
+			band[bandnum].width = width;
+			band[bandnum].height = height;
+		}
+
+		osd_work_queue *queue = m_manager->work_queue();
+		osd_work_item_queue_multiple(queue, draw_band_callback<_BitmapClass>, bands, band, sizeof(band[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(queue, osd_ticks_per_second() * 10);
+	}
+	else
+		draw_clipped(screen, dest, blit, width, height);
+g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  draw_clipped - draw every instance of the
+//  tilemap that falls within blit.cliprect,
+//  honoring row and column scroll
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void tilemap_t::draw_clipped(screen_device &screen, _BitmapClass &dest, blit_parameters &blit, u32 width, u32 height)
+{
 	// XY scrolling playfield
 	if (m_scrollrows == 1 && m_scrollcols == 1)
 	{
@@ -1040,9 +1174,45 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 			}
 		}
 	}
-g_profiler.stop();
 }
 
+
+//-------------------------------------------------
+//  draw_band_callback - work queue entry point
+//  for drawing one band of a split draw
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void *tilemap_t::draw_band_callback(void *param, int threadid)
+{
+	draw_band<_BitmapClass> &band = *reinterpret_cast<draw_band<_BitmapClass> *>(param);
+	profiler_trace_scope scope("tilemap band", "video");
+	band.tilemap->draw_clipped(*band.screen, *band.dest, band.blit, band.width, band.height);
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  draw_band_count - return how many bands a draw
+//  to the given cliprect should be split into
+//-------------------------------------------------
+
+int tilemap_t::draw_band_count(const rectangle &cliprect) const
+{
+	// too short to be worth splitting
+	int rows = cliprect.height();
+	if (rows < 2 * TILEMAP_BAND_MIN_ROWS)
+		return 1;
+
+	// splitting means updating every dirty tile up front, which only pays
+	// off when most of the tilemap is on screen anyway
+	if (u64(m_width) * m_height > 4 * u64(cliprect.width()) * rows)
+		return 1;
+
+	return std::min(rows / TILEMAP_BAND_MIN_ROWS, TILEMAP_MAX_BANDS);
+}
+
+
 void tilemap_t::draw(screen_device &screen, bitmap_ind16 &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask)
 { draw_common(screen, dest, cliprect, flags, priority, priority_mask); }
 
@@ -1509,7 +1679,8 @@ void tilemap_t::get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &col
 
 tilemap_manager::tilemap_manager(running_machine &machine)
 	: m_machine(machine),
-		m_instance(0)
+		m_instance(0),
+		m_work_queue(nullptr)
 {
 }
 
@@ -1534,6 +1705,22 @@ tilemap_manager::~tilemap_manager()
 				break;
 			}
 	}
+
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
+}
+
+
+//-------------------------------------------------
+//  work_queue - return the queue used for banded
+//  drawing, allocating it on first use
+//-------------------------------------------------
+
+osd_work_queue *tilemap_manager::work_queue()
+{
+	if (m_work_queue == nullptr)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	return m_work_queue;
 }
 
 
@@ -524,6 +524,7 @@ public:
 	bitmap_ind16 &pixmap() { pixmap_update(); return m_pixmap; }
 	bitmap_ind8 &flagsmap() { pixmap_update(); return m_flagsmap; }
 	u8 *tile_flags() { pixmap_update(); return &m_tileflags[0]; }
+	u64 pixmap_bytes() const { return m_pixmap.allocated_bytes() + m_flagsmap.allocated_bytes() + m_tileflags.size(); }
 	tilemap_memory_index memory_index(u32 col, u32 row) { return m_mapper(col, row, m_cols, m_rows); }
 	void get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &color);
 
@@ -599,6 +600,18 @@ private:
 		u8                  alpha;
 	};
 
+	// one horizontal band of a draw, rendered on the manager's work queue
+	template<class _BitmapClass>
+	struct draw_band
+	{
+		tilemap_t *         tilemap;
+		screen_device *     screen;
+		_BitmapClass *      dest;
+		blit_parameters     blit;
+		u32                 width;
+		u32                 height;
+	};
+
 	// inline helpers
 	s32 effective_rowscroll(int index, u32 screen_width);
 	s32 effective_colscroll(int index, u32 screen_height);
@@ -627,6 +640,9 @@ private:
 	u8 tile_apply_bitmask(const u8 *maskdata, u32 x0, u32 y0, u8 category, u8 flags);
 	void configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &priority_bitmap, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
+	template<class _BitmapClass> void draw_clipped(screen_device &screen, _BitmapClass &dest, blit_parameters &blit, u32 width, u32 height);
+	template<class _BitmapClass> static void *draw_band_callback(void *param, int threadid);
+	int draw_band_count(const rectangle &cliprect) const;
 	template<class _BitmapClass> void draw_roz_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_instance(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, int xpos, int ypos);
 	template<class _BitmapClass> void draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, const blit_parameters &blit, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound);
@@ -684,6 +700,8 @@ private:
 	// transparency mapping
 	bitmap_ind8                 m_flagsmap;             // per-pixel flags
 	std::vector<u8>             m_tileflags;            // per-tile flags
+	std::vector<logical_index>  m_dirty_list;           // tiles marked dirty since the last pixmap update
+	bool                        m_dirty_list_overflow;  // true if some dirty tiles are missing from m_dirty_list
 	u8                          m_pen_to_flags[MAX_PEN_TO_FLAGS * TILEMAP_NUM_GROUPS]; // mapping of pens to flags
 };
 
@@ -719,10 +737,14 @@ private:
 	// allocate an instance index
 	int alloc_instance() { return ++m_instance; }
 
+	// queue for banded drawing, allocated on first use
+	osd_work_queue *work_queue();
+
 	// internal state
 	running_machine &       m_machine;
 	simple_list<tilemap_t>  m_tilemap_list;
 	int                     m_instance;
+	osd_work_queue *        m_work_queue;           // queue for banded drawing, or nullptr
 };
 
 
@@ -44,8 +44,7 @@ timer_device::timer_device(const machine_config &mconfig, const char *tag, devic
 		m_screen(nullptr),
 		m_first_vpos(0),
 		m_increment(0),
-		m_timer(nullptr),
-		m_first_time(true)
+		m_timer(nullptr)
 {
 }
 
@@ -199,8 +198,13 @@ void timer_device::device_start()
 
 	m_callback.bind_relative_to(*owner());
 
-	// register for save states
-	save_item(NAME(m_first_time));
+	// scanline timers are fired by the screen, which coalesces all of them into one scheduler event per line
+	if (m_type == TIMER_TYPE_SCANLINE)
+	{
+		if (m_screen == nullptr)
+			fatalerror("timer '%s': unable to find screen '%s'\n", tag(), m_screen_tag);
+		m_screen->register_scanline_callback(scanline_state_delegate(&timer_device::scanline_fired, this), m_first_vpos, m_increment);
+	}
 }
 
 
@@ -234,12 +238,8 @@ void timer_device::device_reset()
 		}
 
 		case TIMER_TYPE_SCANLINE:
-			if (m_screen == nullptr)
-				fatalerror("timer '%s': unable to find screen '%s'\n", tag(), m_screen_tag);
-
-			// set the timer to fire immediately
-			m_first_time = true;
-			m_timer->adjust(attotime::zero, m_param);
+			// the backing timer never fires; it only holds the enable state and parameter
+			m_timer->adjust(attotime::never, m_param);
 			break;
 	}
 }
@@ -260,30 +260,20 @@ void timer_device::device_timer(emu_timer &timer, device_timer_id id, int param,
 				(m_callback)(*this, m_ptr, param);
 			break;
 
-
-		// scanline timers have to do some additiona bookkeeping
+		// scanline timers are fired through scanline_fired
 		case TIMER_TYPE_SCANLINE:
-		{
-			// by default, we fire at the first position
-			int next_vpos = m_first_vpos;
-
-			// the first time through we just go with the default position
-			if (!m_first_time)
-			{
-				// call the real callback
-				int vpos = m_screen->vpos();
-				if (!m_callback.isnull())
-					(m_callback)(*this, m_ptr, vpos);
-
-				// advance by the increment only if we will still be within the screen bounds
-				if (m_increment != 0 && (vpos + m_increment) < m_screen->height())
-					next_vpos = vpos + m_increment;
-			}
-			m_first_time = false;
-
-			// adjust the timer
-			m_timer->adjust(m_screen->time_until_pos(next_vpos));
 			break;
-		}
 	}
 }
+
+
+//-------------------------------------------------
+//  scanline_fired - called by the screen when the
+//  beam reaches one of our scanlines
+//-------------------------------------------------
+
+void timer_device::scanline_fired(screen_device &screen, int vpos)
+{
+	if (m_timer->enabled() && !m_callback.isnull())
+		(m_callback)(*this, m_ptr, vpos);
+}
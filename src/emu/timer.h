@@ -119,6 +119,9 @@ private:
 	virtual void device_reset() override;
 	virtual void device_timer(emu_timer &timer, device_timer_id id, int param, void *ptr) override;
 
+	// internal helpers
+	void scanline_fired(screen_device &screen, int vpos);
+
 	// timer types
 	enum timer_type
 	{
@@ -145,7 +148,6 @@ private:
 
 	// internal state
 	emu_timer *             m_timer;            // the backing timer
-	bool                    m_first_time;       // indicates that the system is starting (scanline timers only)
 };
 
 
@@ -62,13 +62,15 @@ ui_input_manager::ui_input_manager(running_machine &machine)
 
 void ui_input_manager::frame_update()
 {
-	/* update the state of all the UI keys */
+	/* update the state of all the UI keys, reading each switch only once */
+	machine().input().begin_switch_batch();
 	for (ioport_type code = ioport_type(IPT_UI_FIRST + 1); code < IPT_UI_LAST; ++code)
 	{
 		bool pressed = machine().ioport().type_pressed(code);
 		if (!pressed || m_seqpressed[code] != SEQ_PRESSED_RESET)
 			m_seqpressed[code] = pressed;
 	}
+	machine().input().end_switch_batch();
 
 	// perform mouse hit testing
 	ioport_field *mouse_field = m_current_mouse_down ? find_mouse_field() : nullptr;
@@ -21,6 +21,23 @@
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+namespace {
+
+// a run of drivers validated by one work item
+struct validate_block
+{
+	std::unique_ptr<validity_checker> checker;  // checker holding this block's state and output
+	const int *     drivers;                    // driver indices to validate
+	int             count;                      // number of drivers
+};
+
+// the checker whose driver is being validated on this thread, if not the one
+// that owns the output stack
+thread_local validity_checker *s_thread_checker = nullptr;
+
+} // anonymous namespace
+
+
 //**************************************************************************
 //  INLINE FUNCTIONS
 //**************************************************************************
@@ -134,7 +151,8 @@ validity_checker::validity_checker(emu_options &options)
 		m_current_config(nullptr),
 		m_current_device(nullptr),
 		m_current_ioport(nullptr),
-		m_validate_all(false)
+		m_validate_all(false),
+		m_deferred(false)
 {
 	// pre-populate the defstr map with all the default strings
 	for (int strnum = 1; strnum < INPUT_STRING_COUNT; strnum++)
@@ -214,11 +232,17 @@ bool validity_checker::check_all_matching(const char *string)
 		output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "\n");
 	}
 
-	// then iterate over all drivers and check them
+	// then iterate over all drivers and check them, spreading large runs across threads
+	std::vector<int> drivers;
 	m_drivlist.reset();
 	while (m_drivlist.next())
 		if (m_drivlist.matches(string, m_drivlist.driver().name))
-			validate_one(m_drivlist.driver());
+			drivers.push_back(m_drivlist.current());
+	if (drivers.size() > VALIDATE_BLOCK_DRIVERS)
+		validate_parallel(drivers);
+	else
+		for (int index : drivers)
+			validate_one(m_drivlist.driver(index));
 
 	// cleanup
 	validate_end();
@@ -227,6 +251,83 @@ bool validity_checker::check_all_matching(const char *string)
 }
 
 
+//-------------------------------------------------
+//  validate_parallel - validate the given drivers
+//  in fixed-size blocks on the work queue, each
+//  with its own checker, then print the output in
+//  driver order so it doesn't depend on timing
+//-------------------------------------------------
+
+void validity_checker::validate_parallel(const std::vector<int> &drivers)
+{
+	// names and descriptions are checked for duplicates against the whole list; entering
+	// the first driver with each up front gives the same reports as checking in order
+	for (int index : drivers)
+	{
+		const game_driver &driver = m_drivlist.driver(index);
+		m_names_map.emplace(driver.name, &driver);
+		m_descriptions_map.emplace(driver.description, &driver);
+	}
+
+	std::vector<validate_block> blocks((drivers.size() + VALIDATE_BLOCK_DRIVERS - 1) / VALIDATE_BLOCK_DRIVERS);
+	for (size_t blocknum = 0; blocknum < blocks.size(); blocknum++)
+	{
+		validate_block &block = blocks[blocknum];
+		block.checker = std::make_unique<validity_checker>(m_drivlist.options());
+		block.checker->m_print_verbose = m_print_verbose;
+		block.checker->m_validate_all = m_validate_all;
+		block.checker->m_deferred = true;
+		block.checker->m_names_map = m_names_map;
+		block.checker->m_descriptions_map = m_descriptions_map;
+		block.drivers = &drivers[blocknum * VALIDATE_BLOCK_DRIVERS];
+		block.count = std::min<int>(VALIDATE_BLOCK_DRIVERS, drivers.size() - blocknum * VALIDATE_BLOCK_DRIVERS);
+	}
+
+	osd_work_queue *queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if (queue == nullptr)
+	{
+		for (validate_block &block : blocks)
+			validate_block_callback(&block, 0);
+	}
+	else
+	{
+		osd_work_item_queue_multiple(queue, validate_block_callback, blocks.size(), &blocks[0], sizeof(blocks[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(queue, osd_ticks_per_second() * 10)) { }
+		osd_work_queue_free(queue);
+	}
+
+	// merge the results in order
+	for (validate_block &block : blocks)
+	{
+		m_errors += block.checker->m_errors;
+		m_warnings += block.checker->m_warnings;
+		if (!block.checker->m_deferred_output.empty())
+			output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "%s", block.checker->m_deferred_output.c_str());
+		block.checker.reset();
+	}
+}
+
+
+//-------------------------------------------------
+//  validate_block_callback - validate one block
+//  of drivers on a work queue thread
+//-------------------------------------------------
+
+void *validity_checker::validate_block_callback(void *param, int threadid)
+{
+	validate_block &block = *reinterpret_cast<validate_block *>(param);
+	validity_checker &checker = *block.checker;
+
+	// messages from this thread reach the owner of the output stack, which hands them
+	// to this block's checker
+	s_thread_checker = &checker;
+	for (int index = 0; index < block.count; index++)
+		checker.validate_one(checker.m_drivlist.driver(block.drivers[index]));
+	s_thread_checker = nullptr;
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  validate_begin - prepare for validation by
 //  taking over the output callbacks and resetting
@@ -1339,17 +1440,19 @@ void validity_checker::validate_rgb()
 
 void validity_checker::validate_driver()
 {
-	// check for duplicate names
-	if (!m_names_map.insert(std::make_pair(m_current_driver->name, m_current_driver)).second)
+	// check for duplicate names; the maps may already hold this driver when validating in parallel
+	auto const name = m_names_map.insert(std::make_pair(m_current_driver->name, m_current_driver));
+	if (!name.second && name.first->second != m_current_driver)
 	{
-		const game_driver *match = m_names_map.find(m_current_driver->name)->second;
+		const game_driver *match = name.first->second;
 		osd_printf_error("Driver name is a duplicate of %s(%s)\n", core_filename_extract_base(match->source_file).c_str(), match->name);
 	}
 
 	// check for duplicate descriptions
-	if (!m_descriptions_map.insert(std::make_pair(m_current_driver->description, m_current_driver)).second)
+	auto const description = m_descriptions_map.insert(std::make_pair(m_current_driver->description, m_current_driver));
+	if (!description.second && description.first->second != m_current_driver)
 	{
-		const game_driver *match = m_descriptions_map.find(m_current_driver->description)->second;
+		const game_driver *match = description.first->second;
 		osd_printf_error("Driver description is a duplicate of %s(%s)\n", core_filename_extract_base(match->source_file).c_str(), match->name);
 	}
 
@@ -1880,6 +1983,15 @@ void validity_checker::build_output_prefix(std::string &str)
 
 void validity_checker::output_callback(osd_output_channel channel, const char *msg, va_list args)
 {
+	// errors, warnings and verbose messages from a thread validating a block belong to
+	// that block's checker; anything else is passed on as usual
+	bool const counted = (channel == OSD_OUTPUT_CHANNEL_ERROR) || (channel == OSD_OUTPUT_CHANNEL_WARNING) || (channel == OSD_OUTPUT_CHANNEL_VERBOSE);
+	if (counted && s_thread_checker != nullptr && s_thread_checker != this)
+	{
+		s_thread_checker->output_callback(channel, msg, args);
+		return;
+	}
+
 	std::string output;
 	switch (channel)
 	{
@@ -1935,9 +2047,13 @@ void validity_checker::output_via_delegate(osd_output_channel channel, const cha
 {
 	va_list argptr;
 
-	// call through to the delegate with the proper parameters
+	// call through to the delegate with the proper parameters, or hold it back until
+	// the block is merged
 	va_start(argptr, format);
-	chain_output(channel, format, argptr);
+	if (m_deferred)
+		strcatvprintf(m_deferred_output, format, argptr);
+	else
+		chain_output(channel, format, argptr);
 	va_end(argptr);
 }
 
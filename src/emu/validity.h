@@ -70,6 +70,8 @@ private:
 	void validate_begin();
 	void validate_end();
 	void validate_one(const game_driver &driver);
+	void validate_parallel(const std::vector<int> &drivers);
+	static void *validate_block_callback(void *param, int threadid);
 
 	// internal sub-checks
 	void validate_core();
@@ -119,6 +121,12 @@ private:
 	int_map                 m_region_map;
 	std::unordered_set<std::string>   m_already_checked;
 	bool                    m_validate_all;
+
+	// parallel validation
+	bool                    m_deferred;         // collect output in m_deferred_output instead of passing it on
+	std::string             m_deferred_output;  // output held back so blocks can be printed in order
+
+	static constexpr int VALIDATE_BLOCK_DRIVERS = 256;
 };
 
 #endif // MAME_EMU_VALIDITY_H
@@ -73,6 +73,8 @@ video_manager::video_manager(running_machine &machine)
 	: m_machine(machine),
 		m_screenless_frame_timer(nullptr),
 		m_output_changed(false),
+		m_frame_count(0),
+		m_frame_role(FR_NORMAL),
 		m_throttle_last_ticks(0),
 		m_throttle_realtime(attotime::zero),
 		m_throttle_emutime(attotime::zero),
@@ -96,6 +98,11 @@ video_manager::video_manager(running_machine &machine)
 		m_frameskip_adjust(0),
 		m_skipping_this_frame(false),
 		m_average_oversleep(0),
+		m_frame_time_last_ticks(0),
+		m_frame_time_samples(0),
+		m_telemetry(machine.options().telemetry()),
+		m_telemetry_last_frame(0),
+		m_telemetry_missed(0),
 		m_snap_target(nullptr),
 		m_snap_native(true),
 		m_snap_width(0),
@@ -107,7 +114,14 @@ video_manager::video_manager(running_machine &machine)
 		m_avi_frame_period(attotime::zero),
 		m_avi_next_frame_time(attotime::zero),
 		m_avi_frame(0),
+		m_movie_queue(nullptr),
+		m_avi_failed(false),
+		m_mng_failed(false),
+		m_avi_dropped(0),
+		m_mng_dropped(0),
 		m_dummy_recording(false),
+		m_framehash_interval(0),
+		m_framehash_compared(0),
 		m_timecode_enabled(false),
 		m_timecode_write(false),
 		m_timecode_text(""),
@@ -115,12 +129,17 @@ video_manager::video_manager(running_machine &machine)
 		m_timecode_total(attotime::zero)
 
 {
+	std::fill(std::begin(m_frame_time_histogram), std::end(m_frame_time_histogram), 0);
+	for (movie_frame &frame : m_movie_frames)
+		frame.refs = 0;
+
 	// request a callback upon exiting
 	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&video_manager::exit, this));
 	machine.save().register_postload(save_prepost_delegate(FUNC(video_manager::postload), this));
 
 	// extract initial execution state from global configuration settings
 	update_refresh_speed();
+	png_set_compression_level(machine.options().snap_compression());
 
 	// create a render target for snapshots
 	const char *viewname = machine.options().snap_view();
@@ -164,6 +183,33 @@ video_manager::video_manager(running_machine &machine)
 	m_dummy_recording = machine.options().dummy_write();
 #endif
 
+	// open the checksum output and read the baseline if requested
+	const char *const hashfile = machine.options().frame_hash();
+	const char *const baseline = machine.options().frame_hash_baseline();
+	if (hashfile[0] != 0 || baseline[0] != 0)
+	{
+		m_framehash_interval = std::max(machine.options().frame_hash_interval(), 1);
+		if (hashfile[0] != 0 && util::core_file::open(hashfile, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE, m_framehash_file) != osd_file::error::NONE)
+			throw emu_fatalerror("Unable to create frame checksum file '%s'", hashfile);
+		if (baseline[0] != 0)
+		{
+			util::core_file::ptr file;
+			if (util::core_file::open(baseline, OPEN_FLAG_READ, file) != osd_file::error::NONE)
+				throw emu_fatalerror("Unable to open frame checksum baseline '%s'", baseline);
+			char line[256];
+			while (file->gets(line, ARRAY_LENGTH(line)) != nullptr)
+			{
+				unsigned long long frame;
+				frame_hash entry;
+				if (sscanf(line, "%llu %x %x", &frame, &entry.video, &entry.audio) == 3)
+				{
+					entry.frame = frame;
+					m_framehash_baseline.push_back(entry);
+				}
+			}
+		}
+	}
+
 	// if no screens, create a periodic timer to drive updates
 	if (machine.first_screen() == nullptr)
 	{
@@ -208,6 +254,8 @@ void video_manager::frame_update(bool from_debugger)
 	// only render sound and video if we're in the running phase
 	int phase = machine().phase();
 	bool skipped_it = m_skipping_this_frame;
+	if (skipped_it && !from_debugger)
+		m_telemetry_missed++;
 	if (phase == MACHINE_PHASE_RUNNING && (!machine().paused() || machine().options().update_in_pause()))
 	{
 		bool anything_changed = finish_screen_updates();
@@ -221,31 +269,51 @@ void video_manager::frame_update(bool from_debugger)
 			m_empty_skip_count = 0;
 	}
 
+	// when running ahead, the UI runs once per host frame on the real timeline so that
+	// anything it changes isn't rolled back, and only the last frame run ahead is shown
+	bool const ui_frame = from_debugger || m_frame_role == FR_NORMAL || m_frame_role == FR_KEPT;
+	bool const shown_frame = from_debugger || m_frame_role == FR_NORMAL || m_frame_role == FR_SHOWN;
+
 	// draw the user interface
-	emulator_info::draw_user_interface(machine());
+	if (ui_frame)
+		emulator_info::draw_user_interface(machine());
 
-	// if we're throttling, synchronize before rendering
 	attotime current_time = machine().time();
-	if (!from_debugger && !skipped_it && effective_throttle())
-		update_throttle(current_time);
+	if (shown_frame)
+	{
+		// if we're throttling, synchronize before rendering
+		if (!from_debugger && !skipped_it && effective_throttle())
+			update_throttle(current_time);
 
-	// ask the OSD to update
-	g_profiler.start(PROFILER_BLIT);
-	machine().osd().update(!from_debugger && skipped_it);
-	g_profiler.stop();
+		// ask the OSD to update
+		g_profiler.start(PROFILER_BLIT);
+		machine().osd().update(!from_debugger && skipped_it);
+		g_profiler.stop();
+
+		// keep track of how evenly the frames we actually present are spaced
+		if (!from_debugger && !skipped_it)
+		{
+			update_frame_time_histogram();
+			machine().ioport().frame_presented();
+		}
+	}
 
-	emulator_info::periodic_check();
+	if (ui_frame)
+		emulator_info::periodic_check();
 
 	// perform tasks for this frame
 	if (!from_debugger)
+	{
 		machine().call_notifiers(MACHINE_NOTIFY_FRAME);
+		m_frame_count++;
+	}
 
 	// update frameskipping
-	if (!from_debugger)
+	if (!from_debugger && shown_frame)
 		update_frameskip();
 
 	// update speed computations
-	if (!from_debugger && !skipped_it)
+	if (!from_debugger && !skipped_it && shown_frame)
 		recompute_speed(current_time);
 
 	// call the end-of-frame callback
@@ -415,6 +483,10 @@ void video_manager::begin_recording(const char *name, movie_format format)
 	// create a snapshot bitmap so we know what the target size is
 	create_snapshot_bitmap(nullptr);
 
+	// frames are encoded and written in the background
+	if (m_movie_queue == nullptr)
+		m_movie_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+
 	// start up an AVI recording
 	if (format == MF_AVI)
 	{
@@ -423,6 +495,8 @@ void video_manager::begin_recording(const char *name, movie_format format)
 
 		// reset the state
 		m_avi_frame = 0;
+		m_avi_failed = false;
+		m_avi_dropped = 0;
 		m_avi_next_frame_time = machine().time();
 
 		// build up information about this new movie
@@ -482,6 +556,8 @@ void video_manager::begin_recording(const char *name, movie_format format)
 
 		// reset the state
 		m_mng_frame = 0;
+		m_mng_failed = false;
+		m_mng_dropped = 0;
 		m_mng_next_frame_time = machine().time();
 
 		// create a new movie file and start recording
@@ -522,11 +598,17 @@ void video_manager::begin_recording(const char *name, movie_format format)
 
 void video_manager::end_recording(movie_format format)
 {
+	// let the encoder finish everything already queued
+	if (m_movie_queue != nullptr)
+		while (!osd_work_queue_wait(m_movie_queue, osd_ticks_per_second() * 10)) { }
+
 	if (format == MF_AVI)
 	{
 		// close the file if it exists
 		if (m_avi_file)
 		{
+			if (m_avi_dropped != 0)
+				osd_printf_info("AVI recording repeated %u frames while the encoder caught up\n", m_avi_dropped);
 			m_avi_file.reset();
 
 			// reset the state
@@ -538,6 +620,8 @@ void video_manager::end_recording(movie_format format)
 		// close the file if it exists
 		if (m_mng_file != nullptr)
 		{
+			if (m_mng_dropped != 0)
+				osd_printf_info("MNG recording dropped %u frames while the encoder caught up\n", m_mng_dropped);
 			mng_capture_stop(*m_mng_file);
 			m_mng_file.reset();
 
@@ -558,15 +642,13 @@ void video_manager::add_sound_to_recording(const s16 *sound, int numsamples)
 	// only record if we have a file
 	if (m_avi_file != nullptr)
 	{
-		g_profiler.start(PROFILER_MOVIE_REC);
-
-		// write the next frame
-		avi_file::error avierr = m_avi_file->append_sound_samples(0, sound + 0, numsamples, 1);
-		if (avierr == avi_file::error::NONE)
-			avierr = m_avi_file->append_sound_samples(1, sound + 1, numsamples, 1);
-		if (avierr != avi_file::error::NONE)
-			end_recording(MF_AVI);
+		// stop if the encoder has failed
+		if (m_avi_failed)
+			return end_recording(MF_AVI);
 
+		// hand the samples to the encoder, in order with the video frames
+		g_profiler.start(PROFILER_MOVIE_REC);
+		queue_movie_job(MF_AVI, nullptr, m_avi_frame, sound, numsamples);
 		g_profiler.stop();
 	}
 }
@@ -583,6 +665,14 @@ void video_manager::exit()
 	end_recording(MF_AVI);
 	end_recording(MF_MNG);
 
+	// close the checksum file and say how far the baseline got
+	m_framehash_file.reset();
+	if (!m_framehash_baseline.empty())
+		osd_printf_info("Frame checksums: %u of %u baseline entries matched\n", u32(m_framehash_compared), u32(m_framehash_baseline.size()));
+	if (m_movie_queue != nullptr)
+		osd_work_queue_free(m_movie_queue);
+	m_movie_queue = nullptr;
+
 	// free the snapshot target
 	machine().render().target_free(m_snap_target);
 	m_snap_bitmap.reset();
@@ -590,11 +680,22 @@ void video_manager::exit()
 	// print a final result if we have at least 2 seconds' worth of data
 	if (!emulator_info::standalone() && m_overall_emutime.seconds() >= 1)
 	{
-		osd_ticks_t tps = osd_ticks_per_second();
-		double final_real_time = (double)m_overall_real_seconds + (double)m_overall_real_ticks / (double)tps;
+		double final_real_time = overall_real_time();
 		double final_emu_time = m_overall_emutime.as_double();
 		osd_printf_info("Average speed: %.2f%% (%d seconds)\n", 100 * final_emu_time / final_real_time, (m_overall_emutime + attotime(0, ATTOSECONDS_PER_SECOND / 2)).seconds());
 	}
+
+	// report the spread of frame times, which the average speed hides
+	if (m_frame_time_samples != 0)
+	{
+		u32 const median = frame_time_percentile(50);
+		u32 const p99 = frame_time_percentile(99);
+		u32 longest = FRAME_TIME_BUCKETS - 1;
+		while (longest > 0 && m_frame_time_histogram[longest] == 0)
+			longest--;
+		osd_printf_verbose("Frame times: median %u ms, 99th percentile %u ms, longest %s%u ms (%u frames)\n",
+				median, p99, (longest == FRAME_TIME_BUCKETS - 1) ? ">=" : "", longest, m_frame_time_samples);
+	}
 }
 
 
@@ -701,6 +802,11 @@ bool video_manager::finish_screen_updates()
 	for (screen_device &screen : iter)
 		screen.update_partial(screen.visible_area().max_y);
 
+	// checksum the finished bitmaps before the screens move on to the next ones;
+	// frames that will be rolled back or replayed are left out
+	if (m_framehash_interval != 0 && (m_frame_role == FR_NORMAL || m_frame_role == FR_SHOWN) && (m_frame_count % m_framehash_interval) == 0)
+		hash_frame();
+
 	// now add the quads for all the screens
 	bool anything_changed = m_output_changed;
 	m_output_changed = false;
@@ -857,12 +963,16 @@ void video_manager::update_throttle(attotime emutime)
 		{
 			if (LOG_THROTTLE)
 				machine().logerror("Resync due to being behind: %s (history=%08X)\n", attotime(0, -real_is_ahead_attoseconds).as_string(18), m_throttle_history);
+			m_telemetry_missed++;
 			break;
 		}
 
 		// if we're behind, it's time to just get out
 		if (real_is_ahead_attoseconds < 0)
+		{
+			m_telemetry_missed++;
 			return;
+		}
 
 		// compute the target real time, in ticks, where we want to be
 		osd_ticks_t target_ticks = m_throttle_last_ticks + real_is_ahead_attoseconds / attoseconds_per_tick;
@@ -895,14 +1005,16 @@ osd_ticks_t video_manager::throttle_until_ticks(osd_ticks_t target_ticks)
 	if (machine().paused())
 		allowed_to_sleep = true;
 
-	// loop until we reach our target
+	// loop until we reach our target; we sleep until we are within the usual
+	// oversleep of the target, and spin only for what is left after that
 	g_profiler.start(PROFILER_IDLE);
-	osd_ticks_t minimum_sleep = osd_ticks_per_second() / 1000;
+	osd_ticks_t const minimum_sleep = osd_ticks_per_second() / 10000;
 	osd_ticks_t current_ticks = osd_ticks();
 	while (current_ticks < target_ticks)
 	{
 		// compute how much time to sleep for, taking into account the average oversleep
-		osd_ticks_t delta = (target_ticks - current_ticks) * 1000 / (1000 + m_average_oversleep);
+		osd_ticks_t const remaining = target_ticks - current_ticks;
+		osd_ticks_t const delta = (remaining > m_average_oversleep) ? (remaining - m_average_oversleep) : 0;
 
 		// see if we can sleep
 		bool slept = false;
@@ -918,17 +1030,14 @@ osd_ticks_t video_manager::throttle_until_ticks(osd_ticks_t target_ticks)
 		// keep some metrics on the sleeping patterns of the OSD layer
 		if (slept)
 		{
-			// if we overslept, keep an average of the amount
+			// scheduler latency is roughly constant rather than proportional to the
+			// length of the sleep, so keep a running average of the ticks we lose
 			osd_ticks_t actual_ticks = new_ticks - current_ticks;
-			if (actual_ticks > delta)
-			{
-				// take 90% of the previous average plus 10% of the new value
-				osd_ticks_t oversleep_milliticks = 1000 * (actual_ticks - delta) / delta;
-				m_average_oversleep = (m_average_oversleep * 99 + oversleep_milliticks) / 100;
+			osd_ticks_t oversleep_ticks = (actual_ticks > delta) ? (actual_ticks - delta) : 0;
+			m_average_oversleep = (m_average_oversleep * 15 + oversleep_ticks) / 16;
 
-				if (LOG_THROTTLE)
-					machine().logerror("Slept for %d ticks, got %d ticks, avgover = %d\n", (int)delta, (int)actual_ticks, (int)m_average_oversleep);
-			}
+			if (LOG_THROTTLE)
+				machine().logerror("Slept for %d ticks, got %d ticks, avgover = %d\n", (int)delta, (int)actual_ticks, (int)m_average_oversleep);
 		}
 		current_ticks = new_ticks;
 	}
@@ -938,6 +1047,46 @@ osd_ticks_t video_manager::throttle_until_ticks(osd_ticks_t target_ticks)
 }
 
 
+//-------------------------------------------------
+//  update_frame_time_histogram - record the real
+//  time since the previous presented frame
+//-------------------------------------------------
+
+void video_manager::update_frame_time_histogram()
+{
+	osd_ticks_t const current_ticks = osd_ticks();
+
+	// pauses and fast-forwarding would only pollute the statistics
+	if (m_frame_time_last_ticks != 0 && !machine().paused() && !m_fastforward)
+	{
+		osd_ticks_t const bucket = (current_ticks - m_frame_time_last_ticks) * 1000 / osd_ticks_per_second();
+		m_frame_time_histogram[std::min<osd_ticks_t>(bucket, FRAME_TIME_BUCKETS - 1)]++;
+		m_frame_time_samples++;
+	}
+	m_frame_time_last_ticks = current_ticks;
+}
+
+
+//-------------------------------------------------
+//  frame_time_percentile - return the frame time
+//  in milliseconds below which the given
+//  percentage of frames fell
+//-------------------------------------------------
+
+u32 video_manager::frame_time_percentile(u32 percent) const
+{
+	u64 const threshold = (u64(m_frame_time_samples) * percent + 99) / 100;
+	u64 total = 0;
+	for (u32 bucket = 0; bucket < FRAME_TIME_BUCKETS; bucket++)
+	{
+		total += m_frame_time_histogram[bucket];
+		if (total >= threshold)
+			return bucket;
+	}
+	return FRAME_TIME_BUCKETS - 1;
+}
+
+
 //-------------------------------------------------
 //  update_frameskip - update frameskipping
 //  counters and periodically update autoframeskip
@@ -1056,6 +1205,8 @@ void video_manager::recompute_speed(const attotime &emutime)
 		osd_ticks_t delta_realtime = realtime - m_speed_last_realtime;
 		osd_ticks_t tps = osd_ticks_per_second();
 		m_speed_percent = delta_emutime.as_double() * (double)tps / (double)delta_realtime;
+		if (m_telemetry)
+			publish_telemetry(delta_emutime, delta_realtime);
 
 		// remember the last times
 		m_speed_last_realtime = realtime;
@@ -1096,6 +1247,40 @@ void video_manager::recompute_speed(const attotime &emutime)
 }
 
 
+//-------------------------------------------------
+//  publish_telemetry - set outputs describing the
+//  speed update period that just ended, so that
+//  the output module can pass them on
+//-------------------------------------------------
+
+void video_manager::publish_telemetry(const attotime &delta_emutime, osd_ticks_t delta_realtime)
+{
+	output_manager &output = machine().output();
+	u64 const frames = m_frame_count - m_telemetry_last_frame;
+	m_telemetry_last_frame = m_frame_count;
+
+	// average emulated and host time per frame, in microseconds
+	output.set_value("telemetry_speed", s32(100 * m_speed_percent + 0.5));
+	if (frames != 0)
+	{
+		output.set_value("telemetry_frame_emu_us", s32(delta_emutime.as_attoseconds() / (ATTOSECONDS_PER_MICROSECOND * frames)));
+		output.set_value("telemetry_frame_host_us", s32(delta_realtime * 1000000 / (osd_ticks_per_second() * frames)));
+	}
+
+	// running totals
+	output.set_value("telemetry_frames_missed", s32(m_telemetry_missed));
+	output.set_value("telemetry_sound_underflows", s32(machine().osd().sound_underflows()));
+
+	// input latency needs the latency monitor running
+	input_latency_monitor const *const latency = machine().ioport().latency_monitor();
+	if (latency && latency->samples() != 0)
+	{
+		output.set_value("telemetry_input_latency_ms", s32(latency->percentile(50)));
+		output.set_value("telemetry_input_latency_p99_ms", s32(latency->percentile(99)));
+	}
+}
+
+
 //-------------------------------------------------
 //  create_snapshot_bitmap - creates a
 //  bitmap containing the screenshot for the
@@ -1265,6 +1450,37 @@ osd_file::error video_manager::open_next(emu_file &file, const char *extension)
 }
 
 
+//-------------------------------------------------
+//  hash_frame - checksum the screens and the
+//  sound since the last checksum, then write
+//  and/or compare the result
+//-------------------------------------------------
+
+void video_manager::hash_frame()
+{
+	util::crc32_creator crc;
+	for (screen_device &screen : screen_device_iterator(machine().root_device()))
+		screen.append_frame_crc(crc);
+
+	frame_hash const current = { m_frame_count, crc.finish(), machine().sound().take_mix_crc() };
+	if (m_framehash_file)
+		m_framehash_file->printf("%llu %08x %08x\n", (unsigned long long)current.frame, current.video, current.audio);
+
+	// baseline entries are in frame order, so only the next one can match
+	if (m_framehash_compared < m_framehash_baseline.size())
+	{
+		frame_hash const &expected = m_framehash_baseline[m_framehash_compared];
+		if (expected.frame == current.frame)
+		{
+			if (expected.video != current.video || expected.audio != current.audio)
+				throw emu_fatalerror("Frame %llu differs from the checksum baseline (video %08x expected %08x, audio %08x expected %08x)",
+						(unsigned long long)current.frame, current.video, expected.video, current.audio, expected.audio);
+			m_framehash_compared++;
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  record_frame - record a frame of a movie
 //-------------------------------------------------
@@ -1275,6 +1491,12 @@ void video_manager::record_frame()
 	if (m_mng_file == nullptr && m_avi_file == nullptr && !m_dummy_recording)
 		return;
 
+	// stop any recording the encoder has failed to write
+	if (m_avi_failed)
+		end_recording(MF_AVI);
+	if (m_mng_failed)
+		end_recording(MF_MNG);
+
 	// start the profiler and get the current time
 	g_profiler.start(PROFILER_MOVIE_REC);
 	attotime curtime = machine().time();
@@ -1282,20 +1504,21 @@ void video_manager::record_frame()
 	// create the bitmap
 	create_snapshot_bitmap(nullptr);
 
+	// copy it once for all the movies, if the encoder has a free slot
+	movie_frame *frame = nullptr;
+	if ((m_avi_file != nullptr && m_avi_next_frame_time <= curtime) || (m_mng_file != nullptr && m_mng_next_frame_time <= curtime))
+		frame = alloc_movie_frame();
+
 	// handle an AVI recording
 	if (m_avi_file != nullptr)
 	{
-		// loop until we hit the right time
-		while (m_avi_next_frame_time <= curtime)
+		// loop until we hit the right time; frames after the first repeat it, and if
+		// the encoder is behind the first is a repeat too, so the sound stays in sync
+		for (bool first = true; m_avi_next_frame_time <= curtime; first = false)
 		{
-			// write the next frame
-			avi_file::error avierr = m_avi_file->append_video_frame(m_snap_bitmap);
-			if (avierr != avi_file::error::NONE)
-			{
-				g_profiler.stop();
-				end_recording(MF_AVI);
-				break;
-			}
+			if (first && frame == nullptr)
+				m_avi_dropped++;
+			queue_movie_job(MF_AVI, first ? frame : nullptr, m_avi_frame);
 
 			// advance time
 			m_avi_next_frame_time += m_avi_frame_period;
@@ -1306,39 +1529,136 @@ void video_manager::record_frame()
 	// handle a MNG recording
 	if (m_mng_file != nullptr)
 	{
-		// loop until we hit the right time
+		// loop until we hit the right time; MNG has no sound to keep in sync, so
+		// frames are simply dropped if the encoder is behind
 		while (m_mng_next_frame_time <= curtime)
 		{
-			// set up the text fields in the movie info
-			png_info pnginfo = { nullptr };
-			if (m_mng_frame == 0)
-			{
-				std::string text1 = std::string(emulator_info::get_appname()).append(" ").append(emulator_info::get_build_version());
-				std::string text2 = std::string(machine().system().manufacturer).append(" ").append(machine().system().description);
-				png_add_text(&pnginfo, "Software", text1.c_str());
-				png_add_text(&pnginfo, "System", text2.c_str());
-			}
+			if (frame != nullptr)
+				queue_movie_job(MF_MNG, frame, m_mng_frame++);
+			else
+				m_mng_dropped++;
+
+			// advance time
+			m_mng_next_frame_time += m_mng_frame_period;
+		}
+	}
+
+	g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  alloc_movie_frame - copy the snapshot bitmap
+//  into a free movie frame, or return nullptr if
+//  the encoder is using all of them
+//-------------------------------------------------
 
-			// write the next frame
+video_manager::movie_frame *video_manager::alloc_movie_frame()
+{
+	for (movie_frame &frame : m_movie_frames)
+		if (frame.refs == 0)
+		{
+			if (frame.bitmap.width() != m_snap_bitmap.width() || frame.bitmap.height() != m_snap_bitmap.height())
+				frame.bitmap.allocate(m_snap_bitmap.width(), m_snap_bitmap.height());
+			copybitmap(frame.bitmap, m_snap_bitmap, 0, 0, 0, 0, m_snap_bitmap.cliprect());
+
+			// the palette can change before the encoder gets to the frame
+			frame.palette.clear();
 			screen_device *screen = machine().first_screen();
-			const rgb_t *palette = (screen != nullptr && screen->has_palette()) ? screen->palette().palette()->entry_list_adjusted() : nullptr;
-			int entries = (screen != nullptr && screen->has_palette()) ? screen->palette().entries() : 0;
-			png_error error = mng_capture_frame(*m_mng_file, &pnginfo, m_snap_bitmap, entries, palette);
-			png_free(&pnginfo);
-			if (error != PNGERR_NONE)
+			if (m_mng_file != nullptr && screen != nullptr && screen->has_palette())
 			{
-				g_profiler.stop();
-				end_recording(MF_MNG);
-				break;
+				const rgb_t *palette = screen->palette().palette()->entry_list_adjusted();
+				frame.palette.assign(palette, palette + screen->palette().entries());
 			}
+			return &frame;
+		}
+	return nullptr;
+}
 
-			// advance time
-			m_mng_next_frame_time += m_mng_frame_period;
-			m_mng_frame++;
+
+//-------------------------------------------------
+//  queue_movie_job - queue a video frame, a
+//  repeat of the previous frame (AVI only, when
+//  frame is nullptr) or sound samples for the
+//  encoder
+//-------------------------------------------------
+
+struct video_manager::movie_job
+{
+	video_manager *     manager;                    // owning video manager
+	movie_format        format;                     // movie being written
+	movie_frame *       frame;                      // frame to append, or nullptr
+	u32                 framenum;                   // movie frame number
+	std::vector<s16>    sound;                      // interleaved stereo samples to append
+};
+
+void video_manager::queue_movie_job(movie_format format, movie_frame *frame, u32 framenum, const s16 *sound, int numsamples)
+{
+	auto job = std::make_unique<movie_job>();
+	job->manager = this;
+	job->format = format;
+	job->frame = frame;
+	job->framenum = framenum;
+	if (sound != nullptr)
+		job->sound.assign(sound, sound + numsamples * 2);
+	if (frame != nullptr)
+		frame->refs++;
+
+	// the callback takes ownership of the job
+	osd_work_item_queue(m_movie_queue, movie_job_callback, job.release(), WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+
+//-------------------------------------------------
+//  movie_job_callback - encode and write one
+//  queued movie job on the I/O thread
+//-------------------------------------------------
+
+void *video_manager::movie_job_callback(void *param, int threadid)
+{
+	std::unique_ptr<movie_job> const job(reinterpret_cast<movie_job *>(param));
+	video_manager &manager = *job->manager;
+
+	if (job->format == MF_AVI && !manager.m_avi_failed)
+	{
+		avi_file::error avierr;
+		if (!job->sound.empty())
+		{
+			u32 const numsamples = job->sound.size() / 2;
+			avierr = manager.m_avi_file->append_sound_samples(0, &job->sound[0], numsamples, 1);
+			if (avierr == avi_file::error::NONE)
+				avierr = manager.m_avi_file->append_sound_samples(1, &job->sound[1], numsamples, 1);
 		}
+		else if (job->frame != nullptr)
+			avierr = manager.m_avi_file->append_video_frame(job->frame->bitmap);
+		else
+			avierr = manager.m_avi_file->append_video_repeat();
+		if (avierr != avi_file::error::NONE)
+			manager.m_avi_failed = true;
+	}
+	else if (job->format == MF_MNG && !manager.m_mng_failed)
+	{
+		// set up the text fields in the movie info
+		png_info pnginfo = { nullptr };
+		if (job->framenum == 0)
+		{
+			std::string text1 = std::string(emulator_info::get_appname()).append(" ").append(emulator_info::get_build_version());
+			std::string text2 = std::string(manager.machine().system().manufacturer).append(" ").append(manager.machine().system().description);
+			png_add_text(&pnginfo, "Software", text1.c_str());
+			png_add_text(&pnginfo, "System", text2.c_str());
+		}
+
+		// write the next frame
+		std::vector<rgb_t> const &palette = job->frame->palette;
+		png_error error = mng_capture_frame(*manager.m_mng_file, &pnginfo, job->frame->bitmap, palette.size(), palette.empty() ? nullptr : &palette[0]);
+		png_free(&pnginfo);
+		if (error != PNGERR_NONE)
+			manager.m_mng_failed = true;
 	}
 
-	g_profiler.stop();
+	if (job->frame != nullptr)
+		job->frame->refs--;
+	return nullptr;
 }
 
 //-------------------------------------------------
@@ -19,6 +19,8 @@
 
 #include "aviio.h"
 
+#include <atomic>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -55,6 +57,15 @@ public:
 		MF_AVI
 	};
 
+	// what a frame is used for when the machine is running ahead
+	enum frame_role
+	{
+		FR_NORMAL,      // drive the UI and show the frame as usual
+		FR_KEPT,        // real timeline: drive the UI, but a later frame is shown instead
+		FR_AHEAD,       // run ahead and rolled back unseen
+		FR_SHOWN        // run ahead, shown, then rolled back
+	};
+
 	// construction/destruction
 	video_manager(running_machine &machine);
 
@@ -67,6 +78,7 @@ public:
 	float throttle_rate() const { return m_throttle_rate; }
 	bool fastforward() const { return m_fastforward; }
 	bool is_recording() const { return (m_mng_file || m_avi_file); }
+	u64 frame_count() const { return m_frame_count; }
 
 	// setters
 	void set_frameskip(int frameskip);
@@ -74,6 +86,7 @@ public:
 	void set_throttle_rate(float throttle_rate) { m_throttle_rate = throttle_rate; }
 	void set_fastforward(bool ffwd = true) { m_fastforward = ffwd; }
 	void set_output_changed() { m_output_changed = true; }
+	void set_frame_role(frame_role role) { m_frame_role = role; }
 
 	// misc
 	void toggle_throttle();
@@ -86,6 +99,8 @@ public:
 	// current speed helpers
 	std::string speed_text();
 	double speed_percent() const { return m_speed_percent; }
+	attotime overall_emutime() const { return m_overall_emutime; }
+	double overall_real_time() const { return double(m_overall_real_seconds) + double(m_overall_real_ticks) / double(osd_ticks_per_second()); }
 
 	// snapshots
 	void save_snapshot(screen_device *screen, emu_file &file);
@@ -125,12 +140,21 @@ private:
 	void update_throttle(attotime emutime);
 	osd_ticks_t throttle_until_ticks(osd_ticks_t target_ticks);
 	void update_frameskip();
+	void update_frame_time_histogram();
+	u32 frame_time_percentile(u32 percent) const;
 	void update_refresh_speed();
 	void recompute_speed(const attotime &emutime);
+	void publish_telemetry(const attotime &delta_emutime, osd_ticks_t delta_realtime);
 
 	// snapshot/movie helpers
 	void create_snapshot_bitmap(screen_device *screen);
 	void record_frame();
+	void hash_frame();
+	struct movie_frame;
+	struct movie_job;
+	movie_frame *alloc_movie_frame();
+	void queue_movie_job(movie_format format, movie_frame *frame, u32 framenum, const s16 *sound = nullptr, int numsamples = 0);
+	static void *movie_job_callback(void *param, int threadid);
 
 	// internal state
 	running_machine &   m_machine;                  // reference to our machine
@@ -138,6 +162,8 @@ private:
 	// screenless systems
 	emu_timer *         m_screenless_frame_timer;   // timer to signal VBLANK start
 	bool                m_output_changed;           // did an output element change?
+	u64                 m_frame_count;              // number of frames completed outside the debugger
+	frame_role          m_frame_role;               // how the next frame is used
 
 	// throttling calculations
 	osd_ticks_t         m_throttle_last_ticks;      // osd_ticks the last call to throttle
@@ -172,6 +198,17 @@ private:
 	bool                m_skipping_this_frame;      // flag: true if we are skipping the current frame
 	osd_ticks_t         m_average_oversleep;        // average number of ticks the OSD oversleeps
 
+	// frame pacing statistics
+	static constexpr u32 FRAME_TIME_BUCKETS = 100;
+	osd_ticks_t         m_frame_time_last_ticks;    // osd_ticks when the last frame was presented
+	u32                 m_frame_time_samples;       // number of frame times recorded
+	u32                 m_frame_time_histogram[FRAME_TIME_BUCKETS]; // frame times in 1ms buckets; the last bucket holds the rest
+
+	// telemetry published as outputs
+	bool                m_telemetry;                // flag: true if we're publishing telemetry
+	u64                 m_telemetry_last_frame;     // frame count at the last publication
+	u32                 m_telemetry_missed;         // frames skipped or presented late
+
 	// snapshot stuff
 	render_target *     m_snap_target;              // screen shapshot target
 	bitmap_rgb32        m_snap_bitmap;              // screen snapshot bitmap
@@ -191,9 +228,37 @@ private:
 	attotime            m_avi_next_frame_time;      // time of next frame
 	u32                 m_avi_frame;                // current movie frame number
 
+	// movie recording - background encoding; frames are copied into a
+	// fixed set of slots and appended to the files on an I/O work queue
+	static constexpr int MOVIE_QUEUE_FRAMES = 8;
+	struct movie_frame
+	{
+		bitmap_rgb32        bitmap;                 // copy of the snapshot bitmap
+		std::vector<rgb_t>  palette;                // copy of the screen palette, for MNG
+		std::atomic<int>    refs;                   // number of queued jobs using this frame
+	};
+	osd_work_queue *    m_movie_queue;              // queue encoding and writing movie frames
+	movie_frame         m_movie_frames[MOVIE_QUEUE_FRAMES]; // frames waiting to be encoded
+	std::atomic<bool>   m_avi_failed;               // set by the encoder when an AVI write fails
+	std::atomic<bool>   m_mng_failed;               // set by the encoder when a MNG write fails
+	u32                 m_avi_dropped;              // AVI frames repeated because the encoder was behind
+	u32                 m_mng_dropped;              // MNG frames dropped because the encoder was behind
+
 	// movie recording - dummy
 	bool                m_dummy_recording;          // indicates if snapshot should be created of every frame
 
+	// frame checksums for regression runs
+	struct frame_hash
+	{
+		u64                 frame;                  // frame number
+		u32                 video;                  // checksum of the visible area of every screen
+		u32                 audio;                  // checksum of the mixed output since the previous entry
+	};
+	u32                 m_framehash_interval;       // frames between checksums, or 0 if disabled
+	util::core_file::ptr m_framehash_file;          // file to write checksums to
+	std::vector<frame_hash> m_framehash_baseline;   // checksums to compare against
+	size_t              m_framehash_compared;       // number of baseline entries checked so far
+
 	static const bool   s_skiptable[FRAMESKIP_LEVELS][FRAMESKIP_LEVELS];
 
 	static const attoseconds_t ATTOSECONDS_PER_SPEED_UPDATE = ATTOSECONDS_PER_SECOND / 4;
@@ -0,0 +1,176 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb, Ryan Holtz
+/***************************************************************************
+
+    rgbavx.h
+
+    AVX2 optimised two-pixel RGB utilities.
+
+    WARNING: This code assumes AVX2 capability and the SSE rgbaint_t.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_RGBAVX_H
+#define MAME_EMU_VIDEO_RGBAVX_H
+
+#pragma once
+
+#include <immintrin.h>
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+// two rgbaint_t side by side: pixel 0 in the low 128 bits, pixel 1 in the high 128 bits
+class rgbaint8_t
+{
+public:
+	rgbaint8_t() { }
+	rgbaint8_t(u32 rgba0, u32 rgba1) { set(rgba0, rgba1); }
+	rgbaint8_t(const rgbaint_t& pixel0, const rgbaint_t& pixel1) { set(pixel0, pixel1); }
+	explicit rgbaint8_t(__m256i value) { m_value = value; }
+
+	rgbaint8_t(const rgbaint8_t& other) = default;
+	rgbaint8_t &operator=(const rgbaint8_t& other) = default;
+
+	void set(const rgbaint8_t& other) { m_value = other.m_value; }
+	void set(u32 rgba0, u32 rgba1) { m_value = _mm256_cvtepu8_epi32(_mm_set_epi32(0, 0, rgba1, rgba0)); }
+	void set(const rgbaint_t& pixel0, const rgbaint_t& pixel1) { m_value = _mm256_inserti128_si256(_mm256_castsi128_si256(pixel0.m_value), pixel1.m_value, 1); }
+
+	rgbaint_t pixel0() const { return rgbaint_t(_mm256_castsi256_si128(m_value)); }
+	rgbaint_t pixel1() const { return rgbaint_t(_mm256_extracti128_si256(m_value, 1)); }
+
+	// stores both pixels, saturated to 8 bits per channel, to dest[0] and dest[1]
+	inline void to_rgba(u32 *dest) const
+	{
+		__m256i temp = _mm256_packus_epi16(_mm256_packs_epi32(m_value, _mm256_setzero_si256()), _mm256_setzero_si256());
+		temp = _mm256_permutevar8x32_epi32(temp, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+		_mm_storel_epi64((__m128i *)dest, _mm256_castsi256_si128(temp));
+	}
+
+	inline void add(const rgbaint8_t& color2) { m_value = _mm256_add_epi32(m_value, color2.m_value); }
+	inline void add_imm(const s32 imm) { m_value = _mm256_add_epi32(m_value, _mm256_set1_epi32(imm)); }
+
+	inline void sub(const rgbaint8_t& color2) { m_value = _mm256_sub_epi32(m_value, color2.m_value); }
+	inline void sub_imm(const s32 imm) { m_value = _mm256_sub_epi32(m_value, _mm256_set1_epi32(imm)); }
+
+	inline void subr(const rgbaint8_t& color2) { m_value = _mm256_sub_epi32(color2.m_value, m_value); }
+	inline void subr_imm(const s32 imm) { m_value = _mm256_sub_epi32(_mm256_set1_epi32(imm), m_value); }
+
+	inline void mul(const rgbaint8_t& color) { m_value = _mm256_mullo_epi32(m_value, color.m_value); }
+	inline void mul_imm(const s32 imm) { m_value = _mm256_mullo_epi32(m_value, _mm256_set1_epi32(imm)); }
+
+	inline void shl(const rgbaint8_t& shift) { m_value = _mm256_sllv_epi32(m_value, shift.m_value); }
+	inline void shl_imm(const u8 shift) { m_value = _mm256_slli_epi32(m_value, shift); }
+
+	inline void shr(const rgbaint8_t& shift) { m_value = _mm256_srlv_epi32(m_value, shift.m_value); }
+	inline void shr_imm(const u8 shift) { m_value = _mm256_srli_epi32(m_value, shift); }
+
+	inline void sra(const rgbaint8_t& shift) { m_value = _mm256_srav_epi32(m_value, shift.m_value); }
+	inline void sra_imm(const u8 shift) { m_value = _mm256_srai_epi32(m_value, shift); }
+
+	void or_reg(const rgbaint8_t& color2) { m_value = _mm256_or_si256(m_value, color2.m_value); }
+	void and_reg(const rgbaint8_t& color2) { m_value = _mm256_and_si256(m_value, color2.m_value); }
+	void xor_reg(const rgbaint8_t& color2) { m_value = _mm256_xor_si256(m_value, color2.m_value); }
+
+	void andnot_reg(const rgbaint8_t& color2) { m_value = _mm256_andnot_si256(color2.m_value, m_value); }
+
+	void or_imm(s32 value) { m_value = _mm256_or_si256(m_value, _mm256_set1_epi32(value)); }
+	void and_imm(s32 value) { m_value = _mm256_and_si256(m_value, _mm256_set1_epi32(value)); }
+	void xor_imm(s32 value) { m_value = _mm256_xor_si256(m_value, _mm256_set1_epi32(value)); }
+
+	inline void clamp_to_uint8()
+	{
+		m_value = _mm256_min_epi32(_mm256_max_epi32(m_value, _mm256_setzero_si256()), _mm256_set1_epi32(0xff));
+	}
+
+	inline void min(const s32 value) { m_value = _mm256_min_epi32(m_value, _mm256_set1_epi32(value)); }
+	inline void max(const s32 value) { m_value = _mm256_max_epi32(m_value, _mm256_set1_epi32(value)); }
+
+	inline void blend(const rgbaint8_t& other, u8 factor)
+	{
+		const __m256i scale1 = _mm256_set1_epi32(factor);
+		const __m256i scale2 = _mm256_sub_epi32(_mm256_set1_epi32(0x100), scale1);
+		m_value = _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(m_value, scale1), _mm256_mullo_epi32(other.m_value, scale2)), 8);
+	}
+
+	inline void scale_and_clamp(const rgbaint8_t& scale)
+	{
+		mul(scale);
+		sra_imm(8);
+		clamp_to_uint8();
+	}
+
+	inline void scale_imm_and_clamp(const s32 scale)
+	{
+		mul_imm(scale);
+		sra_imm(8);
+		clamp_to_uint8();
+	}
+
+	inline void scale_add_and_clamp(const rgbaint8_t& scale, const rgbaint8_t& other)
+	{
+		mul(scale);
+		sra_imm(8);
+		add(other);
+		clamp_to_uint8();
+	}
+
+	inline void scale_imm_add_and_clamp(const s32 scale, const rgbaint8_t& other)
+	{
+		mul_imm(scale);
+		sra_imm(8);
+		add(other);
+		clamp_to_uint8();
+	}
+
+	void cmpeq(const rgbaint8_t& value) { m_value = _mm256_cmpeq_epi32(m_value, value.m_value); }
+	void cmpgt(const rgbaint8_t& value) { m_value = _mm256_cmpgt_epi32(m_value, value.m_value); }
+	void cmplt(const rgbaint8_t& value) { m_value = _mm256_cmpgt_epi32(value.m_value, m_value); }
+
+	void cmpeq_imm(s32 value) { m_value = _mm256_cmpeq_epi32(m_value, _mm256_set1_epi32(value)); }
+	void cmpgt_imm(s32 value) { m_value = _mm256_cmpgt_epi32(m_value, _mm256_set1_epi32(value)); }
+	void cmplt_imm(s32 value) { m_value = _mm256_cmpgt_epi32(_mm256_set1_epi32(value), m_value); }
+
+	inline rgbaint8_t& operator+=(const rgbaint8_t& other)
+	{
+		add(other);
+		return *this;
+	}
+
+	inline rgbaint8_t& operator+=(const s32 other)
+	{
+		add_imm(other);
+		return *this;
+	}
+
+	inline rgbaint8_t& operator-=(const rgbaint8_t& other)
+	{
+		sub(other);
+		return *this;
+	}
+
+	inline rgbaint8_t& operator*=(const rgbaint8_t& other)
+	{
+		mul(other);
+		return *this;
+	}
+
+	inline rgbaint8_t& operator*=(const s32 other)
+	{
+		mul_imm(other);
+		return *this;
+	}
+
+	inline rgbaint8_t& operator>>=(const s32 shift)
+	{
+		m_value = _mm256_srai_epi32(m_value, shift);
+		return *this;
+	}
+
+protected:
+	__m256i m_value;
+};
+
+#endif /* MAME_EMU_VIDEO_RGBAVX_H */
@@ -8,7 +8,7 @@
 
 ***************************************************************************/
 
-#if !(defined(__ALTIVEC__) || ((!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)))
+#if !(defined(__ALTIVEC__) || ((!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__SSE2__) || defined(_MSC_VER)) && defined(PTR64)) || ((!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && defined(__ARM_NEON) && defined(__aarch64__) && !defined(__AARCH64EB__)))
 
 #include "emu.h"
 #include "rgbgen.h"
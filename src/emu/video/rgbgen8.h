@@ -0,0 +1,138 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb, Ryan Holtz
+/***************************************************************************
+
+    rgbgen8.h
+
+    General two-pixel RGB utilities, built on rgbaint_t.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_RGBGEN8_H
+#define MAME_EMU_VIDEO_RGBGEN8_H
+
+#pragma once
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+// two rgbaint_t side by side, with the same interface as the AVX2 version
+class rgbaint8_t
+{
+public:
+	rgbaint8_t() { }
+	rgbaint8_t(u32 rgba0, u32 rgba1) { set(rgba0, rgba1); }
+	rgbaint8_t(const rgbaint_t& pixel0, const rgbaint_t& pixel1) { set(pixel0, pixel1); }
+
+	rgbaint8_t(const rgbaint8_t& other) = default;
+	rgbaint8_t &operator=(const rgbaint8_t& other) = default;
+
+	void set(const rgbaint8_t& other) { m_pixel[0] = other.m_pixel[0]; m_pixel[1] = other.m_pixel[1]; }
+	void set(u32 rgba0, u32 rgba1) { m_pixel[0].set(rgba0); m_pixel[1].set(rgba1); }
+	void set(const rgbaint_t& pixel0, const rgbaint_t& pixel1) { m_pixel[0] = pixel0; m_pixel[1] = pixel1; }
+
+	rgbaint_t pixel0() const { return m_pixel[0]; }
+	rgbaint_t pixel1() const { return m_pixel[1]; }
+
+	// stores both pixels, saturated to 8 bits per channel, to dest[0] and dest[1]
+	inline void to_rgba(u32 *dest) const
+	{
+		dest[0] = m_pixel[0].to_rgba_clamp();
+		dest[1] = m_pixel[1].to_rgba_clamp();
+	}
+
+	inline void add(const rgbaint8_t& color2) { m_pixel[0].add(color2.m_pixel[0]); m_pixel[1].add(color2.m_pixel[1]); }
+	inline void add_imm(const s32 imm) { m_pixel[0].add_imm(imm); m_pixel[1].add_imm(imm); }
+
+	inline void sub(const rgbaint8_t& color2) { m_pixel[0].sub(color2.m_pixel[0]); m_pixel[1].sub(color2.m_pixel[1]); }
+	inline void sub_imm(const s32 imm) { m_pixel[0].sub_imm(imm); m_pixel[1].sub_imm(imm); }
+
+	inline void subr(const rgbaint8_t& color2) { m_pixel[0].subr(color2.m_pixel[0]); m_pixel[1].subr(color2.m_pixel[1]); }
+	inline void subr_imm(const s32 imm) { m_pixel[0].subr_imm(imm); m_pixel[1].subr_imm(imm); }
+
+	inline void mul(const rgbaint8_t& color) { m_pixel[0].mul(color.m_pixel[0]); m_pixel[1].mul(color.m_pixel[1]); }
+	inline void mul_imm(const s32 imm) { m_pixel[0].mul_imm(imm); m_pixel[1].mul_imm(imm); }
+
+	inline void shl(const rgbaint8_t& shift) { m_pixel[0].shl(shift.m_pixel[0]); m_pixel[1].shl(shift.m_pixel[1]); }
+	inline void shl_imm(const u8 shift) { m_pixel[0].shl_imm(shift); m_pixel[1].shl_imm(shift); }
+
+	inline void shr(const rgbaint8_t& shift) { m_pixel[0].shr(shift.m_pixel[0]); m_pixel[1].shr(shift.m_pixel[1]); }
+	inline void shr_imm(const u8 shift) { m_pixel[0].shr_imm(shift); m_pixel[1].shr_imm(shift); }
+
+	inline void sra(const rgbaint8_t& shift) { m_pixel[0].sra(shift.m_pixel[0]); m_pixel[1].sra(shift.m_pixel[1]); }
+	inline void sra_imm(const u8 shift) { m_pixel[0].sra_imm(shift); m_pixel[1].sra_imm(shift); }
+
+	void or_reg(const rgbaint8_t& color2) { m_pixel[0].or_reg(color2.m_pixel[0]); m_pixel[1].or_reg(color2.m_pixel[1]); }
+	void and_reg(const rgbaint8_t& color2) { m_pixel[0].and_reg(color2.m_pixel[0]); m_pixel[1].and_reg(color2.m_pixel[1]); }
+	void xor_reg(const rgbaint8_t& color2) { m_pixel[0].xor_reg(color2.m_pixel[0]); m_pixel[1].xor_reg(color2.m_pixel[1]); }
+
+	void andnot_reg(const rgbaint8_t& color2) { m_pixel[0].andnot_reg(color2.m_pixel[0]); m_pixel[1].andnot_reg(color2.m_pixel[1]); }
+
+	void or_imm(s32 value) { m_pixel[0].or_imm(value); m_pixel[1].or_imm(value); }
+	void and_imm(s32 value) { m_pixel[0].and_imm(value); m_pixel[1].and_imm(value); }
+	void xor_imm(s32 value) { m_pixel[0].xor_imm(value); m_pixel[1].xor_imm(value); }
+
+	inline void clamp_to_uint8() { m_pixel[0].clamp_to_uint8(); m_pixel[1].clamp_to_uint8(); }
+
+	inline void min(const s32 value) { m_pixel[0].min(value); m_pixel[1].min(value); }
+	inline void max(const s32 value) { m_pixel[0].max(value); m_pixel[1].max(value); }
+
+	inline void blend(const rgbaint8_t& other, u8 factor) { m_pixel[0].blend(other.m_pixel[0], factor); m_pixel[1].blend(other.m_pixel[1], factor); }
+
+	inline void scale_and_clamp(const rgbaint8_t& scale) { m_pixel[0].scale_and_clamp(scale.m_pixel[0]); m_pixel[1].scale_and_clamp(scale.m_pixel[1]); }
+	inline void scale_imm_and_clamp(const s32 scale) { m_pixel[0].scale_imm_and_clamp(scale); m_pixel[1].scale_imm_and_clamp(scale); }
+	inline void scale_add_and_clamp(const rgbaint8_t& scale, const rgbaint8_t& other) { m_pixel[0].scale_add_and_clamp(scale.m_pixel[0], other.m_pixel[0]); m_pixel[1].scale_add_and_clamp(scale.m_pixel[1], other.m_pixel[1]); }
+	inline void scale_imm_add_and_clamp(const s32 scale, const rgbaint8_t& other) { m_pixel[0].scale_imm_add_and_clamp(scale, other.m_pixel[0]); m_pixel[1].scale_imm_add_and_clamp(scale, other.m_pixel[1]); }
+
+	void cmpeq(const rgbaint8_t& value) { m_pixel[0].cmpeq(value.m_pixel[0]); m_pixel[1].cmpeq(value.m_pixel[1]); }
+	void cmpgt(const rgbaint8_t& value) { m_pixel[0].cmpgt(value.m_pixel[0]); m_pixel[1].cmpgt(value.m_pixel[1]); }
+	void cmplt(const rgbaint8_t& value) { m_pixel[0].cmplt(value.m_pixel[0]); m_pixel[1].cmplt(value.m_pixel[1]); }
+
+	void cmpeq_imm(s32 value) { m_pixel[0].cmpeq_imm(value); m_pixel[1].cmpeq_imm(value); }
+	void cmpgt_imm(s32 value) { m_pixel[0].cmpgt_imm(value); m_pixel[1].cmpgt_imm(value); }
+	void cmplt_imm(s32 value) { m_pixel[0].cmplt_imm(value); m_pixel[1].cmplt_imm(value); }
+
+	inline rgbaint8_t& operator+=(const rgbaint8_t& other)
+	{
+		add(other);
+		return *this;
+	}
+
+	inline rgbaint8_t& operator+=(const s32 other)
+	{
+		add_imm(other);
+		return *this;
+	}
+
+	inline rgbaint8_t& operator-=(const rgbaint8_t& other)
+	{
+		sub(other);
+		return *this;
+	}
+
+	inline rgbaint8_t& operator*=(const rgbaint8_t& other)
+	{
+		mul(other);
+		return *this;
+	}
+
+	inline rgbaint8_t& operator*=(const s32 other)
+	{
+		mul_imm(other);
+		return *this;
+	}
+
+	inline rgbaint8_t& operator>>=(const s32 shift)
+	{
+		m_pixel[0] >>= shift;
+		m_pixel[1] >>= shift;
+		return *this;
+	}
+
+protected:
+	rgbaint_t m_pixel[2];
+};
+
+#endif // MAME_EMU_VIDEO_RGBGEN8_H
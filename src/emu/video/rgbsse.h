@@ -416,6 +416,8 @@ public:
 	}
 
 protected:
+	friend class rgbaint8_t;
+
 	struct _statics
 	{
 		__m128  dummy_for_alignment;
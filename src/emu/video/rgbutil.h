@@ -17,8 +17,17 @@
 #include "rgbsse.h"
 #elif defined(__ALTIVEC__)
 #include "rgbvmx.h"
+#elif (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && defined(__ARM_NEON) && defined(__aarch64__) && !defined(__AARCH64EB__)
+#include "rgbneon.h"
 #else
 #include "rgbgen.h"
 #endif
 
+// two pixels at a time: AVX2 builds on the SSE rgbaint_t, everything else pairs rgbaint_t up
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && defined(__AVX2__) && defined(PTR64)
+#include "rgbavx.h"
+#else
+#include "rgbgen8.h"
+#endif
+
 #endif // MAME_EMU_VIDEO_RGBUTIL_H
@@ -29,6 +29,7 @@ media_auditor::media_auditor(const driver_enumerator &enumerator)
 	: m_enumerator(enumerator)
 	, m_validation(AUDIT_VALIDATE_FULL)
 	, m_searchpath(nullptr)
+	, m_file_cache(nullptr)
 {
 }
 
@@ -388,8 +389,21 @@ media_auditor::audit_record &media_auditor::audit_one_rom(const rom_entry *rom)
 	file.set_restrict_to_mediapath(true);
 	path_iterator path(m_searchpath);
 	std::string curpath;
+	bool const use_cache = m_file_cache != nullptr && !strcmp(m_file_cache->validation(), m_validation);
 	while (path.next(curpath, record.name()))
 	{
+		// use the shared result if there is one
+		if (use_cache)
+		{
+			audit_file_cache::result const found = m_file_cache->find(curpath, has_crc, crc);
+			if (found.found)
+			{
+				record.set_actual(found.hashes, found.length);
+				break;
+			}
+			continue;
+		}
+
 		// open the file if we can
 		osd_file::error filerr;
 		if (has_crc)
@@ -529,6 +543,152 @@ device_t *media_auditor::find_shared_device(device_t &device, const char *name,
 }
 
 
+//-------------------------------------------------
+//  audit_file_cache - constructor
+//-------------------------------------------------
+
+audit_file_cache::audit_file_cache(emu_options &options, const char *validation)
+	: m_options(options)
+	, m_validation(validation)
+	, m_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI))
+{
+}
+
+
+//-------------------------------------------------
+//  ~audit_file_cache - destructor
+//-------------------------------------------------
+
+audit_file_cache::~audit_file_cache()
+{
+	// anything still queued refers to us
+	if (m_queue != nullptr)
+		osd_work_queue_free(m_queue);
+}
+
+
+//-------------------------------------------------
+//  find - look for a file in the media path,
+//  returning the result of an earlier lookup of
+//  the same path and CRC if there was one
+//-------------------------------------------------
+
+audit_file_cache::result audit_file_cache::find(const std::string &path, bool has_crc, uint32_t crc)
+{
+	std::string const key(has_crc ? util::string_format("%s:%08x", path, crc) : path);
+
+	// wait for an earlier or in-progress lookup, or claim this one
+	entry *claimed;
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		auto const found = m_entries.find(key);
+		if (found != m_entries.end())
+		{
+			entry &existing = found->second;
+			m_done.wait(lock, [&existing] { return existing.done; });
+			return existing.value;
+		}
+		claimed = &m_entries[key];
+	}
+
+	// do the work without holding the lock
+	result value = compute(path, has_crc, crc);
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		claimed->value = value;
+		claimed->done = true;
+	}
+	m_done.notify_all();
+	return value;
+}
+
+
+//-------------------------------------------------
+//  prefetch - queue the ROMs of a system to be
+//  looked for, using the same search paths as
+//  media_auditor::audit_media
+//-------------------------------------------------
+
+void audit_file_cache::prefetch(device_t &root)
+{
+	if (m_queue == nullptr)
+		return;
+
+	const char *driverpath = root.searchpath();
+	for (device_t &device : device_iterator(root))
+		for (const rom_entry *region = rom_first_region(device); region; region = rom_next_region(region))
+		{
+			if (!ROMREGION_ISROMDATA(region))
+				continue;
+
+			std::string combinedpath = util::string_format("%s;%s", device.searchpath(), driverpath);
+			if (device.shortname())
+				combinedpath.append(";").append(device.shortname());
+
+			for (const rom_entry *rom = rom_first_file(region); rom; rom = rom_next_file(rom))
+			{
+				job *const item = new job;
+				item->cache = this;
+				item->searchpath = combinedpath;
+				item->name = ROM_GETNAME(rom);
+				item->has_crc = util::hash_collection(ROM_GETHASHDATA(rom)).crc(item->crc);
+				if (osd_work_item_queue(m_queue, prefetch_static, item, WORK_ITEM_FLAG_AUTO_RELEASE) == nullptr)
+				{
+					// the audit will do it itself
+					delete item;
+					return;
+				}
+			}
+		}
+}
+
+
+//-------------------------------------------------
+//  prefetch_static - work item callback that
+//  tries each location for a ROM in turn until
+//  one is found, like audit_one_rom
+//-------------------------------------------------
+
+void *audit_file_cache::prefetch_static(void *param, int threadid)
+{
+	std::unique_ptr<job> const item(reinterpret_cast<job *>(param));
+	path_iterator path(item->searchpath);
+	std::string curpath;
+	while (path.next(curpath, item->name.c_str()))
+		if (item->cache->find(curpath, item->has_crc, item->crc).found)
+			break;
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  compute - open a file and hash it
+//-------------------------------------------------
+
+audit_file_cache::result audit_file_cache::compute(const std::string &path, bool has_crc, uint32_t crc)
+{
+	result value;
+	try
+	{
+		emu_file file(m_options.media_path(), OPEN_FLAG_READ | OPEN_FLAG_NO_PRELOAD);
+		file.set_restrict_to_mediapath(true);
+		osd_file::error const filerr = has_crc ? file.open(path, crc) : file.open(path);
+		if (filerr == osd_file::error::NONE)
+		{
+			value.found = true;
+			value.hashes = file.hashes(m_validation);
+			value.length = file.size();
+		}
+	}
+	catch (...)
+	{
+		// treat anything unexpected as not found
+		value = result();
+	}
+	return value;
+}
+
+
 //-------------------------------------------------
 //  audit_record - constructor
 //-------------------------------------------------
@@ -15,8 +15,11 @@
 
 #include "hash.h"
 
+#include <condition_variable>
 #include <iosfwd>
 #include <list>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 
 
@@ -41,6 +44,68 @@ class driver_enumerator;
 
 
 
+// ======================> audit_file_cache
+
+// results of looking for and hashing ROM files, shared between audits so
+// parent and BIOS sets are only read once; the files of sets about to be
+// audited can be looked for ahead of time on a work queue
+class audit_file_cache
+{
+public:
+	// result of looking for a file
+	struct result
+	{
+		bool                    found = false;      // could the file be opened?
+		uint64_t                length = 0;         // length if found
+		util::hash_collection   hashes;             // hashes if found
+	};
+
+	// construction/destruction
+	audit_file_cache(emu_options &options, const char *validation);
+	~audit_file_cache();
+
+	// getters
+	const char *validation() const { return m_validation; }
+
+	// look for a file, waiting for or doing the work as needed
+	result find(const std::string &path, bool has_crc, uint32_t crc);
+
+	// queue the ROMs of a system to be looked for ahead of its audit
+	void prefetch(device_t &root);
+
+private:
+	// a cached lookup
+	struct entry
+	{
+		bool                    done = false;       // has the result been filled in?
+		result                  value;              // the result
+	};
+
+	// a ROM to look for on the work queue
+	struct job
+	{
+		audit_file_cache *      cache;              // owning cache
+		std::string             searchpath;         // locations to try, in order
+		std::string             name;               // ROM name
+		bool                    has_crc;            // is the CRC known?
+		uint32_t                crc;                // expected CRC
+	};
+
+	// internal helpers
+	static void *prefetch_static(void *param, int threadid);
+	result compute(const std::string &path, bool has_crc, uint32_t crc);
+
+	// internal state
+	emu_options &               m_options;          // options for the media path
+	const char *                m_validation;       // hashes to compute
+	osd_work_queue *            m_queue;            // queue for looking ahead
+	std::mutex                  m_mutex;            // protects the map
+	std::condition_variable     m_done;             // signalled when a result is filled in
+	std::unordered_map<std::string, entry> m_entries; // results by path and CRC
+};
+
+
+
 // ======================> media_auditor
 
 // class which manages auditing of items
@@ -155,6 +220,9 @@ public:
 	// getters
 	const record_list &records() const { return m_record_list; }
 
+	// setters
+	void set_file_cache(audit_file_cache *cache) { m_file_cache = cache; }
+
 	// audit operations
 	summary audit_media(const char *validation = AUDIT_VALIDATE_FULL);
 	summary audit_device(device_t &device, const char *validation = AUDIT_VALIDATE_FULL);
@@ -175,6 +243,7 @@ private:
 	const driver_enumerator &   m_enumerator;
 	const char *                m_validation;
 	const char *                m_searchpath;
+	audit_file_cache *          m_file_cache;
 };
 
 
@@ -70,6 +70,14 @@
 
 
 namespace {
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// number of sets -verifyroms looks for files for ahead of the one being audited
+constexpr unsigned VERIFY_PREFETCH_SETS = 16;
+
+
 //**************************************************************************
 //  COMMAND-LINE OPTIONS
 //**************************************************************************
@@ -284,11 +292,196 @@ void cli_frontend::start_execution(mame_machine_manager *manager,int argc, char
 		if (system == nullptr && *(m_options.system_name()) != 0)
 			throw emu_fatalerror(EMU_ERR_NO_SUCH_GAME, "Unknown system '%s'", m_options.system_name());
 
-		// otherwise just run the game
-		m_result = manager->execute();
+		// otherwise just run the game, or the benchmark or batch list
+		if (*(m_options.bench_list()) != 0)
+			m_result = run_benchmarks(manager);
+		else if (*(m_options.batch_list()) != 0)
+			m_result = run_batch(manager);
+		else
+			m_result = manager->execute();
 	}
 }
 
+
+//-------------------------------------------------
+//  json_string - quote a string for JSON output
+//-------------------------------------------------
+
+static std::string json_string(const std::string &str)
+{
+	std::string result("\"");
+	for (char ch : str)
+	{
+		if (ch == '"' || ch == '\\')
+			result.append(1, '\\').append(1, ch);
+		else if (u8(ch) < 0x20)
+			result.append(string_format("\\u%04x", u8(ch)));
+		else
+			result.append(1, ch);
+	}
+	return result.append(1, '"');
+}
+
+
+//-------------------------------------------------
+//  run_benchmarks - run each system named in the
+//  -benchlist file for -seconds_to_run emulated
+//  seconds and write out the timings as JSON
+//-------------------------------------------------
+
+int cli_frontend::run_benchmarks(mame_machine_manager *manager)
+{
+	// read the list of systems, each optionally followed by an input file
+	util::core_file::ptr listfile;
+	if (util::core_file::open(m_options.bench_list(), OPEN_FLAG_READ, listfile) != osd_file::error::NONE)
+		throw emu_fatalerror(EMU_ERR_FATALERROR, "Unable to open benchmark list '%s'\n", m_options.bench_list());
+
+	std::vector<std::pair<std::string, std::string>> entries;
+	char buffer[1024];
+	while (listfile->gets(buffer, ARRAY_LENGTH(buffer)) != nullptr)
+	{
+		std::string line(buffer);
+		strtrimspace(line);
+		if (line.empty() || line[0] == '#')
+			continue;
+		std::string::size_type const split = line.find_first_of(" \t");
+		std::string system = line.substr(0, split);
+		std::string inpfile = (split != std::string::npos) ? line.substr(split + 1) : std::string();
+		strtrimspace(inpfile);
+		entries.emplace_back(std::move(system), std::move(inpfile));
+	}
+	listfile.reset();
+
+	// a run with no time limit would never finish
+	std::string error;
+	if (m_options.seconds_to_run() == 0)
+		m_options.set_value(OPTION_SECONDS_TO_RUN, 60, OPTION_PRIORITY_MAXIMUM, error);
+
+	osd_ticks_t const tps = osd_ticks_per_second();
+	int result = EMU_ERR_NONE;
+	std::string json("[\n");
+	for (auto &entry : entries)
+	{
+		bench_stats stats;
+		int entry_result;
+		try
+		{
+			mame_options::set_system_name(m_options, entry.first.c_str());
+			if (mame_options::system(m_options) == nullptr)
+				throw emu_fatalerror(EMU_ERR_NO_SUCH_GAME, "Unknown system '%s'", entry.first.c_str());
+			m_options.set_value(OPTION_PLAYBACK, entry.second.c_str(), OPTION_PRIORITY_MAXIMUM, error);
+
+			osd_printf_info("Benchmarking %s\n", entry.first.c_str());
+			manager->set_bench_stats(&stats);
+			entry_result = manager->execute();
+			manager->set_bench_stats(nullptr);
+		}
+		catch (emu_fatalerror &fatal)
+		{
+			manager->set_bench_stats(nullptr);
+			std::string str(fatal.string());
+			strtrimspace(str);
+			osd_printf_error("%s\n", str.c_str());
+			entry_result = (fatal.exitcode() != 0) ? fatal.exitcode() : EMU_ERR_FATALERROR;
+		}
+		if (entry_result != EMU_ERR_NONE)
+			result = entry_result;
+
+		// express the profiler buckets as shares of the time after the first frame
+		json.append(string_format("  {\n    \"system\": %s,\n    \"inp\": %s,\n    \"error\": %d,\n",
+				json_string(entry.first), json_string(entry.second), entry_result));
+		if (entry_result == EMU_ERR_NONE && stats.real_seconds > 0.0)
+			json.append(string_format("    \"speed_percent\": %.2f,\n", 100.0 * stats.emulated_seconds / stats.real_seconds));
+		else
+			json.append("    \"speed_percent\": null,\n");
+		if (stats.first_frame != 0)
+			json.append(string_format("    \"startup_seconds\": %.3f,\n", double(stats.first_frame - stats.started) / double(tps)));
+		else
+			json.append("    \"startup_seconds\": null,\n");
+
+		osd_ticks_t const total = stats.emulation_ticks + stats.video_ticks + stats.sound_ticks + stats.other_ticks + stats.idle_ticks;
+		if (stats.profiled && stats.first_frame != 0 && total != 0)
+		{
+			double const scale = double(stats.finished - stats.first_frame) / double(tps) / double(total);
+			json.append(string_format("    \"cpu_seconds\": { \"emulation\": %.3f, \"video\": %.3f, \"sound\": %.3f, \"other\": %.3f, \"idle\": %.3f },\n",
+					double(stats.emulation_ticks) * scale, double(stats.video_ticks) * scale, double(stats.sound_ticks) * scale,
+					double(stats.other_ticks) * scale, double(stats.idle_ticks) * scale));
+		}
+		else
+			json.append("    \"cpu_seconds\": null,\n");
+		json.append(string_format("    \"peak_rss_bytes\": %u\n  }%s\n", osd_peak_memory_usage(), (&entry != &entries.back()) ? "," : ""));
+	}
+	json.append("]\n");
+
+	// write to the requested file, or standard output
+	if (*(m_options.bench_json()) != 0)
+	{
+		util::core_file::ptr jsonfile;
+		if (util::core_file::open(m_options.bench_json(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE, jsonfile) != osd_file::error::NONE)
+			throw emu_fatalerror(EMU_ERR_FATALERROR, "Unable to create benchmark results '%s'\n", m_options.bench_json());
+		jsonfile->puts(json.c_str());
+	}
+	else
+		printf("%s", json.c_str());
+
+	return result;
+}
+
+//-------------------------------------------------
+//  run_batch - run each system named in the
+//  -batchlist file in turn, keeping archives and
+//  validity results from one run to the next
+//-------------------------------------------------
+
+int cli_frontend::run_batch(mame_machine_manager *manager)
+{
+	// read from standard input so a queue can be fed while earlier systems run
+	bool const from_stdin = !strcmp(m_options.batch_list(), "-");
+	util::core_file::ptr listfile;
+	if (!from_stdin && util::core_file::open(m_options.batch_list(), OPEN_FLAG_READ, listfile) != osd_file::error::NONE)
+		throw emu_fatalerror(EMU_ERR_FATALERROR, "Unable to open batch list '%s'\n", m_options.batch_list());
+
+	manager->set_keep_archive_cache(true);
+	int result = EMU_ERR_NONE;
+	std::string error;
+	char buffer[1024];
+	while ((from_stdin ? fgets(buffer, ARRAY_LENGTH(buffer), stdin) : listfile->gets(buffer, ARRAY_LENGTH(buffer))) != nullptr)
+	{
+		std::string system(buffer);
+		strtrimspace(system);
+		if (system.empty() || system[0] == '#')
+			continue;
+
+		int entry_result;
+		try
+		{
+			mame_options::set_system_name(m_options, system.c_str());
+			if (mame_options::system(m_options) == nullptr)
+				throw emu_fatalerror(EMU_ERR_NO_SUCH_GAME, "Unknown system '%s'", system.c_str());
+
+			osd_printf_info("Running %s\n", system.c_str());
+			entry_result = manager->execute();
+		}
+		catch (emu_fatalerror &fatal)
+		{
+			std::string str(fatal.string());
+			strtrimspace(str);
+			osd_printf_error("%s\n", str.c_str());
+			entry_result = (fatal.exitcode() != 0) ? fatal.exitcode() : EMU_ERR_FATALERROR;
+		}
+		if (entry_result != EMU_ERR_NONE)
+			result = entry_result;
+
+		// one line per run so a driving script can follow along
+		printf("%s %d\n", system.c_str(), entry_result);
+		fflush(stdout);
+	}
+	manager->set_keep_archive_cache(false);
+	util::archive_file::cache_clear();
+
+	return result;
+}
+
 //-------------------------------------------------
 //  execute - execute a game via the standard
 //  command line interface
@@ -383,9 +576,12 @@ void cli_frontend::listxml(const char *gamename)
 	if (drivlist.count() == 0)
 		throw emu_fatalerror(EMU_ERR_NO_SUCH_GAME, "No matching games found for '%s'", gamename);
 
-	// create the XML and print it to stdout
+	// create the XML and print it to stdout, reusing what earlier runs of this build produced
+	std::unique_ptr<info_cache> cache;
+	if (m_options.info_cache())
+		cache = std::make_unique<info_cache>(m_options, CLICOMMAND_LISTXML);
 	info_xml_creator creator(drivlist);
-	creator.output(stdout);
+	creator.output(stdout, false, cache.get());
 }
 
 
@@ -559,6 +755,11 @@ void cli_frontend::listroms(const char *gamename)
 	if (drivlist.count() == 0)
 		throw emu_fatalerror(EMU_ERR_NO_SUCH_GAME, "No matching games found for '%s'", gamename);
 
+	// reuse what earlier runs of this build produced
+	std::unique_ptr<info_cache> cache;
+	if (m_options.info_cache())
+		cache = std::make_unique<info_cache>(m_options, CLICOMMAND_LISTROMS);
+
 	// iterate through matches
 	bool first = true;
 	while (drivlist.next())
@@ -567,43 +768,51 @@ void cli_frontend::listroms(const char *gamename)
 		if (!first)
 			osd_printf_info("\n");
 		first = false;
-		osd_printf_info("ROMs required for driver \"%s\".\n"
-	                	"%-32s %10s %s\n",drivlist.driver().name, "Name", "Size", "Checksum");
 
-		// iterate through roms
-		for (device_t &device : device_iterator(drivlist.config()->root_device()))
-			for (const rom_entry *region = rom_first_region(device); region; region = rom_next_region(region))
-				for (const rom_entry *rom = rom_first_file(region); rom; rom = rom_next_file(rom))
-				{
-					// accumulate the total length of all chunks
-					int64_t length = -1;
-					if (ROMREGION_ISROMDATA(region))
-						length = rom_file_size(rom);
-
-					// start with the name
-					const char *name = ROM_GETNAME(rom);
-					osd_printf_info("%-32s ", name);
-
-					// output the length next
-					if (length >= 0)
-						osd_printf_info("%10u", unsigned(uint64_t(length)));
-					else
-						osd_printf_info("%10s", "");
+		std::string text;
+		if (cache == nullptr || !cache->find(drivlist.driver().name, text))
+		{
+			text = string_format("ROMs required for driver \"%s\".\n"
+		                	"%-32s %10s %s\n",drivlist.driver().name, "Name", "Size", "Checksum");
 
-					// output the hash data
-					util::hash_collection hashes(ROM_GETHASHDATA(rom));
-					if (!hashes.flag(util::hash_collection::FLAG_NO_DUMP))
+			// iterate through roms
+			for (device_t &device : device_iterator(drivlist.config()->root_device()))
+				for (const rom_entry *region = rom_first_region(device); region; region = rom_next_region(region))
+					for (const rom_entry *rom = rom_first_file(region); rom; rom = rom_next_file(rom))
 					{
-						if (hashes.flag(util::hash_collection::FLAG_BAD_DUMP))
-							osd_printf_info(" BAD");
-						osd_printf_info(" %s", hashes.macro_string().c_str());
-					}
-					else
-						osd_printf_info(" NO GOOD DUMP KNOWN");
+						// accumulate the total length of all chunks
+						int64_t length = -1;
+						if (ROMREGION_ISROMDATA(region))
+							length = rom_file_size(rom);
+
+						// start with the name
+						const char *name = ROM_GETNAME(rom);
+						text.append(string_format("%-32s ", name));
+
+						// output the length next
+						if (length >= 0)
+							text.append(string_format("%10u", unsigned(uint64_t(length))));
+						else
+							text.append(string_format("%10s", ""));
 
-					// end with a CR
-					osd_printf_info("\n");
-				}
+						// output the hash data
+						util::hash_collection hashes(ROM_GETHASHDATA(rom));
+						if (!hashes.flag(util::hash_collection::FLAG_NO_DUMP))
+						{
+							if (hashes.flag(util::hash_collection::FLAG_BAD_DUMP))
+								text.append(" BAD");
+							text.append(" ").append(hashes.macro_string());
+						}
+						else
+							text.append(" NO GOOD DUMP KNOWN");
+
+						// end with a CR
+						text.append("\n");
+					}
+			if (cache != nullptr)
+				cache->add(drivlist.driver().name, std::string(text));
+		}
+		osd_printf_info("%s", text.c_str());
 	}
 }
 
@@ -848,12 +1057,22 @@ void cli_frontend::verifyroms(const char *gamename)
 	unsigned notfound = 0;
 	unsigned matched = 0;
 
+	// share files between sets, and look for the files of the next few sets
+	// on other threads while this one is audited; results are still
+	// reported in order
+	audit_file_cache file_cache(m_options, AUDIT_VALIDATE_FAST);
+	driver_enumerator ahead(m_options, gamename);
+	unsigned queued = 0;
+
 	// iterate over drivers
 	media_auditor auditor(drivlist);
+	auditor.set_file_cache(&file_cache);
 	util::ovectorstream summary_string;
 	while (drivlist.next())
 	{
 		matched++;
+		for ( ; (queued < matched + VERIFY_PREFETCH_SETS) && ahead.next(); queued++)
+			file_cache.prefetch(drivlist.config(ahead.current())->root_device());
 
 		// audit the ROMs in this set
 		media_auditor::summary summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
@@ -60,6 +60,8 @@ private:
 	void display_suggestions(const char *gamename);
 	void output_single_softlist(FILE *out, software_list_device &swlist);
 	void start_execution(mame_machine_manager *manager, int argc, char **argv, std::string &option_errors);
+	int run_benchmarks(mame_machine_manager *manager);
+	int run_batch(mame_machine_manager *manager);
 
 	// internal state
 	emu_options &       m_options;
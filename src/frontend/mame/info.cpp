@@ -173,6 +173,204 @@ const char info_xml_creator::s_dtd_string[] =
 "]>";
 
 
+//**************************************************************************
+//  INFO CACHE
+//**************************************************************************
+
+//-------------------------------------------------
+//  info_cache - constructor; loads the cache if
+//  it was written by this build
+//-------------------------------------------------
+
+info_cache::info_cache(emu_options &options, const char *name)
+	: m_directory(options.cfg_directory()),
+		m_filename(std::string(name).append(".cache")),
+		m_stamp(string_format("%s%s %d", emulator_info::get_build_version(),
+#ifdef MAME_DEBUG
+			" debug",
+#else
+			"",
+#endif
+			CONFIG_VERSION)),
+		m_file(std::string(m_directory), OPEN_FLAG_READ),
+		m_data(nullptr),
+		m_scratch(nullptr),
+		m_scratchstart(0)
+{
+	if (m_file.open(m_filename) != osd_file::error::NONE)
+		return;
+
+	// large caches are mapped rather than read
+	util::core_file &file = m_file;
+	const u8 *const data = reinterpret_cast<const u8 *>(file.buffer());
+	u64 const length = file.size();
+	if (data == nullptr)
+		return;
+
+	// little-endian lengths, each string preceded by its length
+	u64 pos = 0;
+	auto const read_u32 = [data, length, &pos] (u32 &value)
+	{
+		if (length - pos < 4)
+			return false;
+		value = data[pos] | (data[pos + 1] << 8) | (data[pos + 2] << 16) | (u32(data[pos + 3]) << 24);
+		pos += 4;
+		return true;
+	};
+	auto const read_string = [&read_u32, length, &pos] (u64 &offset, u32 &size)
+	{
+		if (!read_u32(size) || (length - pos < size))
+			return false;
+		offset = pos;
+		pos += size;
+		return true;
+	};
+
+	// a cache from another build is ignored, and replaced when saving
+	u32 version, count, stamplength;
+	u64 stampoffset;
+	if (!read_u32(version) || (version != VERSION) || !read_string(stampoffset, stamplength) || !read_u32(count))
+		return;
+	if (m_stamp.compare(0, std::string::npos, reinterpret_cast<const char *>(&data[stampoffset]), stamplength) != 0)
+		return;
+	for ( ; count > 0; count--)
+	{
+		u64 keyoffset, textoffset;
+		u32 keylength, textlength;
+		if (!read_string(keyoffset, keylength) || !read_string(textoffset, textlength))
+		{
+			m_entries.clear();
+			return;
+		}
+		m_entries.emplace(std::string(reinterpret_cast<const char *>(&data[keyoffset]), keylength), std::make_pair(textoffset, textlength));
+	}
+	m_data = data;
+}
+
+
+//-------------------------------------------------
+//  ~info_cache - destructor; saves anything new
+//-------------------------------------------------
+
+info_cache::~info_cache()
+{
+	save();
+	if (m_scratch != nullptr)
+		fclose(m_scratch);
+}
+
+
+//-------------------------------------------------
+//  find - get the text stored under a key
+//-------------------------------------------------
+
+bool info_cache::find(const std::string &key, std::string &text) const
+{
+	auto const found = m_entries.find(key);
+	if (found == m_entries.end())
+		return false;
+	text.assign(reinterpret_cast<const char *>(&m_data[found->second.first]), found->second.second);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  add - store text under a key
+//-------------------------------------------------
+
+void info_cache::add(const std::string &key, std::string &&text)
+{
+	m_added[key] = std::move(text);
+}
+
+
+//-------------------------------------------------
+//  capture_start - get a file to capture output
+//  in; nullptr if there isn't one
+//-------------------------------------------------
+
+FILE *info_cache::capture_start()
+{
+	if (m_scratch == nullptr)
+		m_scratch = tmpfile();
+	if (m_scratch != nullptr)
+		m_scratchstart = ftell(m_scratch);
+	return m_scratch;
+}
+
+
+//-------------------------------------------------
+//  capture_end - get everything written since
+//  capture_start
+//-------------------------------------------------
+
+std::string info_cache::capture_end()
+{
+	long const end = ftell(m_scratch);
+	std::string text(std::max(end - m_scratchstart, 0L), '\0');
+	fseek(m_scratch, m_scratchstart, SEEK_SET);
+	if (!text.empty())
+		text.resize(fread(&text[0], 1, text.size(), m_scratch));
+	fseek(m_scratch, end, SEEK_SET);
+	return text;
+}
+
+
+//-------------------------------------------------
+//  save - write the cache back if anything was
+//  added
+//-------------------------------------------------
+
+void info_cache::save()
+{
+	if (m_added.empty())
+		return;
+
+	std::vector<u8> data;
+	auto const write_u32 = [&data] (u32 value)
+	{
+		for (int shift = 0; shift < 32; shift += 8)
+			data.push_back(u8(value >> shift));
+	};
+	auto const write_string = [&data, &write_u32] (const char *text, u32 length)
+	{
+		write_u32(length);
+		data.insert(data.end(), text, text + length);
+	};
+
+	// keep what we loaded unless it was replaced
+	u32 count = m_added.size();
+	for (auto const &entry : m_entries)
+		if (m_added.find(entry.first) == m_added.end())
+			count++;
+	write_u32(VERSION);
+	write_string(m_stamp.c_str(), m_stamp.length());
+	write_u32(count);
+	for (auto const &entry : m_entries)
+		if (m_added.find(entry.first) == m_added.end())
+		{
+			write_string(entry.first.c_str(), entry.first.length());
+			write_string(reinterpret_cast<const char *>(&m_data[entry.second.first]), entry.second.second);
+		}
+	for (auto const &entry : m_added)
+	{
+		write_string(entry.first.c_str(), entry.first.length());
+		write_string(entry.second.c_str(), entry.second.length());
+	}
+
+	// let go of the mapping before replacing the file
+	m_entries.clear();
+	m_added.clear();
+	m_data = nullptr;
+	m_file.close();
+
+	emu_file file(std::string(m_directory), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(m_filename) == osd_file::error::NONE)
+		file.write(&data[0], data.size());
+}
+
+
+
 //**************************************************************************
 //  INFO XML CREATOR
 //**************************************************************************
@@ -195,7 +393,7 @@ info_xml_creator::info_xml_creator(driver_enumerator &drivlist)
 //  for all known games
 //-------------------------------------------------
 
-void info_xml_creator::output(FILE *out, bool nodevices)
+void info_xml_creator::output(FILE *out, bool nodevices, info_cache *cache)
 {
 	m_output = out;
 
@@ -222,17 +420,57 @@ void info_xml_creator::output(FILE *out, bool nodevices)
 
 	// iterate through the drivers, outputting one at a time
 	while (m_drivlist.next())
-		output_one();
+		output_cached(cache, m_drivlist.driver().name, &info_xml_creator::output_one);
 
-	// output devices (both devices with roms and slot devices)
+	// output devices (both devices with roms and slot devices); which ones
+	// depends on the drivers listed, so they're cached for that set
 	if (!nodevices)
-		output_devices();
+	{
+		util::crc32_creator names;
+		m_drivlist.reset();
+		while (m_drivlist.next())
+			names.append(m_drivlist.driver().name, strlen(m_drivlist.driver().name) + 1);
+		output_cached(cache, string_format("*devices %d %s", m_drivlist.count(), names.finish().as_string()), &info_xml_creator::output_devices);
+	}
 
 	// close the top level tag
 	fprintf(m_output, "</%s>\n",XML_ROOT);
 }
 
 
+//-------------------------------------------------
+//  output_cached - print the output of one of
+//  our helpers, taking it from the cache if an
+//  earlier run already produced it
+//-------------------------------------------------
+
+void info_xml_creator::output_cached(info_cache *cache, const std::string &key, void (info_xml_creator::*func)())
+{
+	std::string text;
+	if (cache != nullptr && cache->find(key, text))
+	{
+		fwrite(text.c_str(), 1, text.length(), m_output);
+		return;
+	}
+
+	// run the helper, capturing its output for the cache if we can
+	FILE *const capture = (cache != nullptr) ? cache->capture_start() : nullptr;
+	if (capture == nullptr)
+	{
+		(this->*func)();
+		return;
+	}
+	FILE *const out = m_output;
+	m_output = capture;
+	(this->*func)();
+	m_output = out;
+
+	text = cache->capture_end();
+	fwrite(text.c_str(), 1, text.length(), m_output);
+	cache->add(key, std::move(text));
+}
+
+
 //-------------------------------------------------
 //  output_one - print the XML information
 //  for one particular game driver
@@ -20,6 +20,41 @@ class driver_enumerator;
 //  FUNCTION PROTOTYPES
 //**************************************************************************
 
+// output of the info commands for each system, kept in the cfg directory
+// between runs of the same build
+class info_cache
+{
+public:
+	// construction/destruction
+	info_cache(emu_options &options, const char *name);
+	~info_cache();
+
+	// text stored under a key by this or an earlier run
+	bool find(const std::string &key, std::string &text) const;
+	void add(const std::string &key, std::string &&text);
+
+	// capture text written to the returned file, for output that goes to a FILE
+	FILE *capture_start();
+	std::string capture_end();
+
+private:
+	static constexpr u32 VERSION = 1;
+
+	void save();
+
+	// internal state
+	std::string             m_directory;    // where the cache lives
+	std::string             m_filename;     // name of the cache file
+	std::string             m_stamp;        // build the cached text came from
+	emu_file                m_file;         // open cache file, mapped while in use
+	const u8 *              m_data;         // contents of the cache file
+	std::unordered_map<std::string, std::pair<u64, u32>> m_entries; // key to offset and length in m_data
+	std::unordered_map<std::string, std::string> m_added; // text captured this run
+	FILE *                  m_scratch;      // temporary file for capturing
+	long                    m_scratchstart; // where the current capture began
+};
+
+
 // helper class to putput
 class info_xml_creator
 {
@@ -28,7 +63,7 @@ public:
 	info_xml_creator(driver_enumerator &drivlist);
 
 	// output
-	void output(FILE *out, bool nodevices = false);
+	void output(FILE *out, bool nodevices = false, info_cache *cache = nullptr);
 
 private:
 	// internal helper
@@ -53,6 +88,7 @@ private:
 
 	void output_one_device(device_t &device, const char *devtag);
 	void output_devices();
+	void output_cached(info_cache *cache, const std::string &key, void (info_xml_creator::*func)());
 
 	const char *get_merge_name(const util::hash_collection &romhashes);
 
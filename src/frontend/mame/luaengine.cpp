@@ -275,6 +275,67 @@ void lua_engine::addr_space::mem_write(offs_t address, T val, sol::object shift)
 	}
 }
 
+//-------------------------------------------------
+//  mem_read_range - read values of the given width from a range of addresses
+//  into a string of native-endian data, stepping by whole values unless told otherwise
+//  -> manager:machine().devices[":maincpu"].spaces["program"]:read_range(0xC000, 0xC0FF, 8)
+//-------------------------------------------------
+
+std::string lua_engine::addr_space::mem_read_range(sol::this_state s, offs_t first, offs_t last, int width, sol::object step)
+{
+	lua_State *L = s;
+	std::string data;
+	if((width != 8) && (width != 16) && (width != 32) && (width != 64))
+	{
+		luaL_error(L, "Invalid width %d in read_range", width);
+		return data;
+	}
+	if(last < first)
+	{
+		luaL_error(L, "Invalid range in read_range");
+		return data;
+	}
+
+	offs_t stride = std::max<offs_t>(space.byte_to_address(width / 8), 1);
+	if(step.is<offs_t>())
+		stride = step.as<offs_t>();
+	if(!stride)
+	{
+		luaL_error(L, "Invalid step in read_range");
+		return data;
+	}
+
+	sol::object const shift = sol::make_object(L, true);
+	data.reserve(((u64(last) - first) / stride + 1) * (width / 8));
+	for(u64 address = first; address <= last; address += stride)
+	{
+		offs_t const byteaddress = space.address_to_byte(offs_t(address));
+		switch(width) {
+			case 8: {
+				uint8_t const value = mem_read<uint8_t>(byteaddress, shift);
+				data.append(reinterpret_cast<const char *>(&value), sizeof(value));
+				break;
+			}
+			case 16: {
+				uint16_t const value = mem_read<uint16_t>(byteaddress, shift);
+				data.append(reinterpret_cast<const char *>(&value), sizeof(value));
+				break;
+			}
+			case 32: {
+				uint32_t const value = mem_read<uint32_t>(byteaddress, shift);
+				data.append(reinterpret_cast<const char *>(&value), sizeof(value));
+				break;
+			}
+			case 64: {
+				uint64_t const value = mem_read<uint64_t>(byteaddress, shift);
+				data.append(reinterpret_cast<const char *>(&value), sizeof(value));
+				break;
+			}
+		}
+	}
+	return data;
+}
+
 //-------------------------------------------------
 //  log_mem_read - templated logical memory readers for <sign>,<size>
 //  -> manager:machine().devices[":maincpu"].spaces["program"]:read_log_i8(0xC000)
@@ -605,33 +666,26 @@ bool lua_engine::menu_callback(const std::string &menu, int index, const std::st
 
 bool lua_engine::execute_function(const char *id)
 {
-	sol::object functable = sol().registry()[id];
-	if(functable.is<sol::table>())
+	// callbacks are kept converted, as some of these run every frame
+	auto const found = m_functions.find(id);
+	if(found == m_functions.end())
+		return false;
+
+	for(sol::protected_function &func : found->second)
 	{
-		for(auto &func : functable.as<sol::table>())
+		auto ret = func();
+		if(!ret.valid())
 		{
-			if(func.second.is<sol::protected_function>())
-			{
-				auto ret = (func.second.as<sol::protected_function>())();
-				if(!ret.valid())
-				{
-					sol::error err = ret;
-					osd_printf_error("[LUA ERROR] in execute_function: %s\n", err.what());
-				}
-			}
+			sol::error err = ret;
+			osd_printf_error("[LUA ERROR] in execute_function: %s\n", err.what());
 		}
-		return true;
 	}
-	return false;
+	return true;
 }
 
 void lua_engine::register_function(sol::function func, const char *id)
 {
-	sol::object functable = sol().registry()[id];
-	if(functable.is<sol::table>())
-		functable.as<sol::table>().add(func);
-	else
-		sol().registry().create_named(id, 1, func);
+	m_functions[id].emplace_back(func);
 }
 
 void lua_engine::on_machine_prestart()
@@ -998,6 +1052,7 @@ void lua_engine::initialize()
  * machine:soft_reset() - soft reset emulation
  * machine:save(filename) - save state to filename
  * machine:load(filename) - load state from filename
+ * machine:rewind() - step back through the rewind history (needs -rewind)
  * machine:system() - get game_driver for running driver
  * machine:video() - get video_manager
  * machine:render() - get render_manager
@@ -1006,6 +1061,7 @@ void lua_engine::initialize()
  * machine:options() - get machine core_options
  * machine:output() - get output_manager
  * machine:input() - get ui_input_manager
+ * machine:memory_report() - get list of { category, tag, bytes } tables of host memory in use
  * machine.paused - get paused state
  * machine.devices - get device table
  * machine.screens - get screens table
@@ -1020,6 +1076,7 @@ void lua_engine::initialize()
 			"soft_reset", &running_machine::schedule_soft_reset,
 			"save", &running_machine::schedule_save,
 			"load", &running_machine::schedule_load,
+			"rewind", &running_machine::schedule_rewind,
 			"system", &running_machine::system,
 			"video", &running_machine::video,
 			"render", &running_machine::render,
@@ -1029,6 +1086,19 @@ void lua_engine::initialize()
 			"options", [](running_machine &m) { return static_cast<core_options *>(&m.options()); },
 			"outputs", &running_machine::output,
 			"input", &running_machine::ui_input,
+			"memory_report", [this](running_machine &m) {
+					sol::table table = sol().create_table();
+					int index = 1;
+					for (const memory_report::entry &entry : m.memreport().collect())
+					{
+						sol::table item = sol().create_table();
+						item["category"] = entry.category;
+						item["tag"] = entry.tag;
+						item["bytes"] = entry.bytes;
+						table[index++] = item;
+					}
+					return table;
+				},
 			"paused", sol::property(&running_machine::paused),
 			"devices", sol::property([this](running_machine &m) {
 					std::function<void(device_t &, sol::table)> tree;
@@ -1158,6 +1228,7 @@ void lua_engine::initialize()
 			"write_u32", &addr_space::mem_write<uint32_t>,
 			"write_i64", &addr_space::mem_write<int64_t>,
 			"write_u64", &addr_space::mem_write<uint64_t>,
+			"read_range", &addr_space::mem_read_range,
 			"read_log_i8", &addr_space::log_mem_read<int8_t>,
 			"read_log_u8", &addr_space::log_mem_read<uint8_t>,
 			"read_log_i16", &addr_space::log_mem_read<int16_t>,
@@ -1711,6 +1782,7 @@ bool lua_engine::frame_hook()
 
 void lua_engine::close()
 {
+	m_functions.clear();
 	lua_settop(m_lua_state, 0);  /* clear stack */
 	lua_close(m_lua_state);
 }
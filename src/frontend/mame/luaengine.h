@@ -110,6 +110,7 @@ private:
 	running_machine *m_machine;
 
 	std::vector<std::string> m_menu;
+	std::map<std::string, std::vector<sol::protected_function>> m_functions;
 
 	running_machine &machine() const { return *m_machine; }
 
@@ -130,6 +131,7 @@ private:
 			space(space), dev(dev) {}
 		template<typename T> T mem_read(offs_t address, sol::object shift);
 		template<typename T> void mem_write(offs_t address, T val, sol::object shift);
+		std::string mem_read_range(sol::this_state s, offs_t first, offs_t last, int width, sol::object step);
 		template<typename T> T log_mem_read(offs_t address);
 		template<typename T> void log_mem_write(offs_t address, T val);
 		template<typename T> T direct_mem_read(offs_t address);
@@ -55,6 +55,7 @@ mame_machine_manager::mame_machine_manager(emu_options &options,osd_interface &o
 		m_lua(global_alloc(lua_engine)),
 		m_new_driver_pending(nullptr),
 		m_firstrun(true),
+		m_bench_stats(nullptr),
 		m_autoboot_timer(nullptr)
 {
 }
@@ -208,18 +209,29 @@ int mame_machine_manager::execute()
 		}
 
 		// otherwise, perform validity checks before anything else
+		osd_ticks_t const validity_start = osd_ticks();
 		bool is_empty = (system == &GAME_NAME(___empty));
-		if (!is_empty)
+		if (!is_empty && m_validated_sources.find(system->source_file) == m_validated_sources.end())
 		{
 			validity_checker valid(m_options);
 			valid.set_verbose(false);
 			valid.check_shared_source(*system);
+			m_validated_sources.emplace(system->source_file);
 		}
 
 		// create the machine configuration
+		osd_ticks_t const config_start = osd_ticks();
 		machine_config config(*system, m_options);
+		if (m_options.startup_profile())
+		{
+			double const ms_per_tick = 1000.0 / double(osd_ticks_per_second());
+			osd_printf_info("Validity checks took %.1f ms, building the device tree %.1f ms\n",
+					double(config_start - validity_start) * ms_per_tick, double(osd_ticks() - config_start) * ms_per_tick);
+		}
 
 		// create the machine structure and driver
+		if (m_bench_stats != nullptr)
+			m_bench_stats->started = osd_ticks();
 		running_machine machine(config, *this);
 
 		set_machine(&machine);
@@ -228,6 +240,32 @@ int mame_machine_manager::execute()
 		error = machine.run(is_empty);
 		m_firstrun = false;
 
+		// collect timings for the benchmark runner
+		if (m_bench_stats != nullptr)
+		{
+			bench_stats &stats = *m_bench_stats;
+			stats.finished = osd_ticks();
+			stats.emulated_seconds = machine.video().overall_emutime().as_double();
+			stats.real_seconds = machine.video().overall_real_time();
+			stats.profiled = g_profiler.enabled();
+			if (stats.profiled)
+			{
+				stats.emulation_ticks = g_profiler.ticks(PROFILER_DRC_COMPILE) + g_profiler.ticks(PROFILER_MEM_REMAP)
+						+ g_profiler.ticks(PROFILER_MEMREAD) + g_profiler.ticks(PROFILER_MEMWRITE) + g_profiler.ticks(PROFILER_TIMER_CALLBACK);
+				for (int type = PROFILER_DEVICE_FIRST; type < PROFILER_DEVICE_MAX; type++)
+					stats.emulation_ticks += g_profiler.ticks(profile_type(type));
+				stats.video_ticks = 0;
+				for (int type = PROFILER_VIDEO; type <= PROFILER_BLIT; type++)
+					stats.video_ticks += g_profiler.ticks(profile_type(type));
+				stats.sound_ticks = g_profiler.ticks(PROFILER_SOUND);
+				stats.other_ticks = 0;
+				for (int type = PROFILER_INPUT; type <= PROFILER_USER8; type++)
+					stats.other_ticks += g_profiler.ticks(profile_type(type));
+				stats.idle_ticks = g_profiler.ticks(PROFILER_IDLE);
+			}
+			g_profiler.enable(false);
+		}
+
 		// check the state of the machine
 		if (m_new_driver_pending)
 		{
@@ -302,6 +340,24 @@ void mame_machine_manager::create_custom(running_machine& machine)
 
 	// set up the cheat engine
 	m_cheat = std::make_unique<cheat_manager>(machine);
+
+	// time the rest of the run from the first frame when benchmarking
+	if (m_bench_stats != nullptr)
+	{
+		m_bench_stats->first_frame = 0;
+		machine.add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&mame_machine_manager::bench_frame, this));
+	}
+}
+
+void mame_machine_manager::bench_frame()
+{
+	// start profiling from a clean slate once startup is out of the way
+	if (m_bench_stats->first_frame == 0)
+	{
+		m_bench_stats->first_frame = osd_ticks();
+		g_profiler.enable(false);
+		g_profiler.enable(true);
+	}
 }
 
 const char * emulator_info::get_bare_build_version() { return bare_build_version; }
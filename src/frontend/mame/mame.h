@@ -12,6 +12,9 @@
 #ifndef __MAME_H__
 #define __MAME_H__
 
+#include <string>
+#include <unordered_set>
+
 class plugin_options;
 class osd_interface;
 
@@ -27,6 +30,25 @@ class mame_ui_manager;
 namespace ui {
 } // namespace ui
 
+// ======================> bench_stats
+
+// timings collected from one run for the -benchlist runner
+struct bench_stats
+{
+	osd_ticks_t     started = 0;                    // when the machine was created
+	osd_ticks_t     first_frame = 0;                // when the first frame was completed
+	osd_ticks_t     finished = 0;                   // when the machine stopped running
+	double          emulated_seconds = 0.0;         // emulated time covered by the run
+	double          real_seconds = 0.0;             // real time taken by the run
+	bool            profiled = false;               // true if the tick counts below are valid
+	osd_ticks_t     emulation_ticks = 0;            // devices, memory and timers
+	osd_ticks_t     video_ticks = 0;                // screen updates and drawing
+	osd_ticks_t     sound_ticks = 0;                // sound streams
+	osd_ticks_t     other_ticks = 0;                // input, recording and everything else
+	osd_ticks_t     idle_ticks = 0;                 // waiting for the throttle or the OSD
+};
+
+
 // ======================> machine_manager
 
 class mame_machine_manager : public machine_manager
@@ -58,6 +80,7 @@ public:
 	int execute();
 	void start_luaengine();
 	void schedule_new_driver(const game_driver &driver);
+	void set_bench_stats(bench_stats *stats) { m_bench_stats = stats; }
 	mame_ui_manager& ui() const { assert(m_ui != nullptr); return *m_ui; }
 	cheat_manager &cheat() const { assert(m_cheat != nullptr); return *m_cheat; }
 	inifile_manager &inifile() const { assert(m_inifile != nullptr); return *m_inifile; }
@@ -68,6 +91,10 @@ private:
 
 	const game_driver *     m_new_driver_pending;   // pointer to the next pending driver
 	bool                    m_firstrun;
+	bench_stats *           m_bench_stats;          // timings to fill in, or nullptr
+	std::unordered_set<std::string> m_validated_sources; // source files already checked in this process
+
+	void bench_frame();
 
 	static mame_machine_manager* m_manager;
 	emu_timer               *m_autoboot_timer;      // autoboot timer
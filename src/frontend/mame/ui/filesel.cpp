@@ -50,6 +50,8 @@ menu_file_selector::menu_file_selector(mame_ui_manager &mui, render_container &c
 	, m_current_directory(current_directory)
 	, m_current_file(current_file)
 	, m_result(result)
+	, m_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO))
+	, m_scan_item(nullptr)
 {
 	m_image = image;
 	m_has_empty = has_empty;
@@ -64,6 +66,13 @@ menu_file_selector::menu_file_selector(mame_ui_manager &mui, render_container &c
 
 menu_file_selector::~menu_file_selector()
 {
+	if (m_scan_item != nullptr)
+	{
+		osd_work_item_wait(m_scan_item, 100 * osd_ticks_per_second());
+		osd_work_item_release(m_scan_item);
+	}
+	if (m_queue != nullptr)
+		osd_work_queue_free(m_queue);
 }
 
 
@@ -203,41 +212,127 @@ menu_file_selector::file_selector_entry &menu_file_selector::append_entry(
 
 
 //-------------------------------------------------
-//  append_entry_menu_item - appends
-//  a menu item for a file selector entry
+//  start_scan - start reading the current
+//  directory on the work queue
+//-------------------------------------------------
+
+void menu_file_selector::start_scan()
+{
+	// let any earlier read finish before starting over
+	if (m_scan_item != nullptr)
+	{
+		osd_work_item_wait(m_scan_item, 100 * osd_ticks_per_second());
+		osd_work_item_release(m_scan_item);
+		m_scan_item = nullptr;
+	}
+
+	m_scan = std::make_unique<directory_scan>();
+	m_scan->directory = m_current_directory;
+	m_scan->current_file = m_current_file;
+
+	// read it right here if there's no queue to hand it to
+	if (m_queue != nullptr)
+		m_scan_item = osd_work_item_queue(m_queue, scan_static, m_scan.get(), 0);
+	if (m_scan_item == nullptr)
+		scan_directory(*m_scan);
+}
+
+
+//-------------------------------------------------
+//  finish_scan - rebuild the menu once the
+//  directory has been read
+//-------------------------------------------------
+
+void menu_file_selector::finish_scan()
+{
+	if (m_scan_item != nullptr && osd_work_item_wait(m_scan_item, 0))
+	{
+		osd_work_item_release(m_scan_item);
+		m_scan_item = nullptr;
+		reset(reset_options::SELECT_FIRST);
+	}
+}
+
+
+//-------------------------------------------------
+//  scan_static - work item callback
 //-------------------------------------------------
 
-menu_file_selector::file_selector_entry *menu_file_selector::append_dirent_entry(const osd::directory::entry *dirent)
+void *menu_file_selector::scan_static(void *param, int threadid)
 {
-	std::string buffer;
-	file_selector_entry_type entry_type;
-	file_selector_entry *entry;
+	scan_directory(*reinterpret_cast<directory_scan *>(param));
+	return nullptr;
+}
+
 
-	switch(dirent->type)
+//-------------------------------------------------
+//  scan_directory - read and sort a directory;
+//  touches nothing but the scan itself
+//-------------------------------------------------
+
+void menu_file_selector::scan_directory(directory_scan &scan)
+{
+	util::zippath_directory *directory = nullptr;
+	if (util::zippath_opendir(scan.directory, &directory) != osd_file::error::NONE)
 	{
+		if (directory != nullptr)
+			util::zippath_closedir(directory);
+		return;
+	}
+	scan.opened = true;
+	scan.is_zip = util::zippath_is_zip(directory);
+
+	const osd::directory::entry *dirent;
+	while ((dirent = util::zippath_readdir(directory)) != nullptr)
+	{
+		file_selector_entry entry;
+		switch (dirent->type)
+		{
 		case osd::directory::entry::entry_type::FILE:
-			entry_type = SELECTOR_ENTRY_TYPE_FILE;
+			entry.type = SELECTOR_ENTRY_TYPE_FILE;
 			break;
 
 		case osd::directory::entry::entry_type::DIR:
-			entry_type = SELECTOR_ENTRY_TYPE_DIRECTORY;
+			entry.type = SELECTOR_ENTRY_TYPE_DIRECTORY;
 			break;
 
 		default:
 			// exceptional case; do not add a menu item
-			return nullptr;
+			continue;
+		}
+		entry.basename = dirent->name;
+		entry.fullpath = util::zippath_combine(scan.directory, dirent->name);
+		scan.entries.emplace_back(std::move(entry));
 	}
+	util::zippath_closedir(directory);
 
-	// determine the full path
-	buffer = util::zippath_combine(m_current_directory, dirent->name);
-
-	// create the file selector entry
-	entry = &append_entry(
-		entry_type,
-		dirent->name,
-		std::move(buffer));
+	// sort all but the first entry, converting each name to a collation key
+	// once rather than on every comparison
+	const std::collate<wchar_t>& coll = std::use_facet<std::collate<wchar_t>>(std::locale());
+	std::vector<std::pair<std::wstring, file_selector_entry> > sorted;
+	for (std::size_t index = 1; index < scan.entries.size(); index++)
+	{
+		std::wstring const name = wstring_from_utf8(scan.entries[index].basename);
+		sorted.emplace_back(coll.transform(name.data(), name.data() + name.size()), std::move(scan.entries[index]));
+	}
+	std::sort(sorted.begin(), sorted.end(), [](std::pair<std::wstring, file_selector_entry> const &x, std::pair<std::wstring, file_selector_entry> const &y)
+		{
+			return x.first < y.first;
+		} );
+	for (std::size_t index = 0; index < sorted.size(); index++)
+		scan.entries[1 + index] = std::move(sorted[index].second);
 
-	return entry;
+	// select the current file, or else the first thing that isn't the parent
+	for (std::size_t index = 0; index < scan.entries.size(); index++)
+	{
+		if (!core_stricmp(scan.current_file.c_str(), scan.entries[index].basename.c_str()))
+		{
+			scan.selected = index;
+			break;
+		}
+		if (scan.selected < 0 && scan.entries[index].basename != "..")
+			scan.selected = index;
+	}
 }
 
 
@@ -290,17 +385,23 @@ void menu_file_selector::append_entry_menu_item(const file_selector_entry *entry
 
 void menu_file_selector::populate(float &customtop, float &custombottom)
 {
-	util::zippath_directory *directory = nullptr;
-	osd_file::error err;
-	const osd::directory::entry *dirent;
-	const file_selector_entry *entry;
 	const file_selector_entry *selected_entry = nullptr;
-	int i;
 	const char *volume_name;
-	uint8_t first;
+	int softlist_index = -1;
 
-	// open the directory
-	err = util::zippath_opendir(m_current_directory, &directory);
+	// set up custom render proc
+	customtop = ui().get_line_height() + 3.0f * UI_BOX_TB_BORDER;
+
+	// the directory is read off the machine's thread, and the menu is rebuilt
+	// when it's done; until then, just say so
+	if (!m_scan || (m_scan->directory != m_current_directory))
+		start_scan();
+	if (m_scan_item != nullptr)
+	{
+		m_entrylist.clear();
+		item_append(_("Reading directory..."), "", FLAG_DISABLE, nullptr);
+		return;
+	}
 
 	// clear out the menu entries
 	m_entrylist.clear();
@@ -311,7 +412,7 @@ void menu_file_selector::populate(float &customtop, float &custombottom)
 		append_entry(SELECTOR_ENTRY_TYPE_EMPTY, "", "");
 	}
 
-	if (m_has_create && !util::zippath_is_zip(directory))
+	if (m_has_create && !m_scan->is_zip)
 	{
 		// add the "[create]" entry
 		append_entry(SELECTOR_ENTRY_TYPE_CREATE, "", "");
@@ -320,51 +421,30 @@ void menu_file_selector::populate(float &customtop, float &custombottom)
 	if (m_has_softlist)
 	{
 		// add the "[software list]" entry
-		entry = &append_entry(SELECTOR_ENTRY_TYPE_SOFTWARE_LIST, "", "");
-		selected_entry = entry;
+		softlist_index = m_entrylist.size();
+		append_entry(SELECTOR_ENTRY_TYPE_SOFTWARE_LIST, "", "");
 	}
 
 	// add the drives
-	i = 0;
-	while((volume_name = osd_get_volume_name(i))!=nullptr)
+	for (int i = 0; (volume_name = osd_get_volume_name(i)) != nullptr; i++)
+		append_entry(SELECTOR_ENTRY_TYPE_DRIVE, volume_name, volume_name);
+
+	// add the directory contents; the software list entry wins over the first
+	// directory entry, but not over the current file
+	const std::size_t first = m_entrylist.size();
+	for (file_selector_entry &entry : m_scan->entries)
+		m_entrylist.emplace_back(std::move(entry));
+	if (softlist_index >= 0)
+		selected_entry = &m_entrylist[softlist_index];
+	if (m_scan->selected >= 0)
 	{
-		append_entry(SELECTOR_ENTRY_TYPE_DRIVE,
-			volume_name, volume_name);
-		i++;
+		const file_selector_entry &candidate = m_entrylist[first + m_scan->selected];
+		if (!selected_entry || !core_stricmp(m_current_file.c_str(), candidate.basename.c_str()))
+			selected_entry = &candidate;
 	}
 
-	// mark first filename entry
-	first = m_entrylist.size() + 1;
-
-	// build the menu for each item
-	if (err == osd_file::error::NONE)
-	{
-		while((dirent = util::zippath_readdir(directory)) != nullptr)
-		{
-			// append a dirent entry
-			entry = append_dirent_entry(dirent);
-
-			if (entry != nullptr)
-			{
-				// set the selected item to be the first non-parent directory or file
-				if ((selected_entry == nullptr) && strcmp(dirent->name, ".."))
-					selected_entry = entry;
-
-				// do we have to select this file?
-				if (!core_stricmp(m_current_file.c_str(), dirent->name))
-					selected_entry = entry;
-			}
-		}
-	}
-
-	// sort the menu entries
-	const std::collate<wchar_t>& coll = std::use_facet<std::collate<wchar_t>>(std::locale());
-	std::sort(m_entrylist.begin()+first, m_entrylist.end(), [&coll](file_selector_entry const &x, file_selector_entry const &y)
-		{
-			std::wstring xstr = wstring_from_utf8(x.basename);
-			std::wstring ystr = wstring_from_utf8(y.basename);
-			return coll.compare(xstr.data(), xstr.data()+xstr.size(), ystr.data(), ystr.data()+ystr.size()) < 0;
-		} );
+	// the next reset reads the directory again
+	m_scan.reset();
 
 	// append all of the menu entries
 	for (auto &entry : m_entrylist)
@@ -373,12 +453,6 @@ void menu_file_selector::populate(float &customtop, float &custombottom)
 	// set the selection (if we have one)
 	if (selected_entry != nullptr)
 		set_selection((void *) selected_entry);
-
-	// set up custom render proc
-	customtop = ui().get_line_height() + 3.0f * UI_BOX_TB_BORDER;
-
-	if (directory != nullptr)
-		util::zippath_closedir(directory);
 }
 
 
@@ -392,6 +466,9 @@ void menu_file_selector::handle()
 	const file_selector_entry *selected_entry = nullptr;
 	int bestmatch = 0;
 
+	// pick up the directory contents once they've been read
+	finish_scan();
+
 	// process the menu
 	const event *event = process(0);
 	if (event != nullptr && event->itemref != nullptr)
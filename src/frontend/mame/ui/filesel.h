@@ -58,6 +58,18 @@ private:
 		std::string fullpath;
 	};
 
+	// a directory read on a work queue, so slow or huge directories don't
+	// hold up the machine while the menu waits for them
+	struct directory_scan
+	{
+		std::string                         directory;      // directory to read
+		std::string                         current_file;   // name of the file to select
+		bool                                is_zip = false; // directory is inside an archive
+		bool                                opened = false; // directory could be read
+		std::vector<file_selector_entry>    entries;        // sorted directories and files
+		int                                 selected = -1;  // index of the entry to select
+	};
+
 	// internal state
 	device_image_interface *    m_image;
 	std::string &               m_current_directory;
@@ -69,15 +81,23 @@ private:
 	std::vector<file_selector_entry>    m_entrylist;
 	std::string                 m_hover_directory;
 	std::string                 m_filename;
+	osd_work_queue *            m_queue;
+	osd_work_item *             m_scan_item;
+	std::unique_ptr<directory_scan> m_scan;
 
 	virtual void populate(float &customtop, float &custombottom) override;
 	virtual void handle() override;
 
+	// directory reading
+	void start_scan();
+	void finish_scan();
+	static void *scan_static(void *param, int threadid);
+	static void scan_directory(directory_scan &scan);
+
 	// methods
 	int compare_entries(const file_selector_entry *e1, const file_selector_entry *e2);
 	file_selector_entry &append_entry(file_selector_entry_type entry_type, const std::string &entry_basename, const std::string &entry_fullpath);
 	file_selector_entry &append_entry(file_selector_entry_type entry_type, std::string &&entry_basename, std::string &&entry_fullpath);
-	file_selector_entry *append_dirent_entry(const osd::directory::entry *dirent);
 	void append_entry_menu_item(const file_selector_entry *entry);
 };
 
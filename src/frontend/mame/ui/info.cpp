@@ -369,6 +369,46 @@ void menu_game_info::handle()
 }
 
 
+/*-------------------------------------------------
+  menu_memory_usage - show the host memory held
+  by each subsystem
+ -------------------------------------------------*/
+
+menu_memory_usage::menu_memory_usage(mame_ui_manager &mui, render_container &container) : menu(mui, container)
+{
+}
+
+menu_memory_usage::~menu_memory_usage()
+{
+}
+
+void menu_memory_usage::populate(float &customtop, float &custombottom)
+{
+	std::vector<memory_report::entry> entries = machine().memreport().collect();
+	u64 total = 0;
+	for (auto it = entries.begin(); it != entries.end(); )
+	{
+		auto end = std::find_if(it, entries.end(), [it] (const memory_report::entry &elem) { return elem.category != it->category; });
+		u64 bytes = 0;
+		for (auto cur = it; cur != end; ++cur)
+			bytes += cur->bytes;
+		total += bytes;
+
+		item_append(it->category, memory_report::format_bytes(bytes), FLAG_DISABLE, nullptr);
+		for ( ; it != end; ++it)
+			item_append(std::string("  ").append(it->tag), memory_report::format_bytes(it->bytes), FLAG_DISABLE, nullptr);
+	}
+	item_append(menu_item_type::SEPARATOR);
+	item_append(_("Total"), memory_report::format_bytes(total), FLAG_DISABLE, nullptr);
+}
+
+void menu_memory_usage::handle()
+{
+	// process the menu
+	process(0);
+}
+
+
 /*-------------------------------------------------
   menu_image_info - handle the image information
   menu
@@ -62,6 +62,18 @@ private:
 };
 
 
+class menu_memory_usage : public menu
+{
+public:
+	menu_memory_usage(mame_ui_manager &mui, render_container &container);
+	virtual ~menu_memory_usage() override;
+
+private:
+	virtual void populate(float &customtop, float &custombottom) override;
+	virtual void handle() override;
+};
+
+
 class menu_image_info : public menu
 {
 public:
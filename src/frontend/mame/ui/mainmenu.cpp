@@ -71,6 +71,7 @@ void menu_main::populate(float &customtop, float &custombottom)
 
 	/* add game info menu */
 	item_append(_("Machine Information"), "", 0, (void *)GAME_INFO);
+	item_append(_("Memory Usage"), "", 0, (void *)MEMORY_USAGE);
 
 	for (device_image_interface &image : image_interface_iterator(machine().root_device()))
 	{
@@ -191,6 +192,10 @@ void menu_main::handle()
 			menu::stack_push<menu_game_info>(ui(), container());
 			break;
 
+		case MEMORY_USAGE:
+			menu::stack_push<menu_memory_usage>(ui(), container());
+			break;
+
 		case IMAGE_MENU_IMAGE_INFO:
 			menu::stack_push<menu_image_info>(ui(), container());
 			break;
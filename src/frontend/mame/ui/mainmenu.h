@@ -29,6 +29,7 @@ private:
 		ANALOG,
 		BOOKKEEPING,
 		GAME_INFO,
+		MEMORY_USAGE,
 		IMAGE_MENU_IMAGE_INFO,
 		IMAGE_MENU_FILE_MANAGER,
 		TAPE_CONTROL,
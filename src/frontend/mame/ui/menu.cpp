@@ -235,6 +235,8 @@ menu::menu(mame_ui_manager &mui, render_container &container)
 	, m_pool(nullptr)
 	, m_customtop(0.0f)
 	, m_custombottom(0.0f)
+	, m_measured_height(0.0f)
+	, m_measured_aspect(0.0f)
 	, m_resetpos(0)
 	, m_resetref(nullptr)
 	, m_mouse_hit(false)
@@ -537,21 +539,34 @@ void menu::draw(uint32_t flags)
 	if (&machine().system() == &GAME_NAME(___empty) && !noimage)
 		draw_background();
 
+	// item widths are kept from frame to frame, so they only need measuring again if the text size changes
+	float const aspect = machine().render().ui_aspect();
+	if ((line_height != m_measured_height) || (aspect != m_measured_aspect))
+	{
+		for (auto &pitem : item)
+			pitem.width = -1.0f;
+		m_measured_height = line_height;
+		m_measured_aspect = aspect;
+	}
+
 	// compute the width and height of the full menu
 	float visible_width = 0;
 	float visible_main_menu_height = 0;
-	for (auto const &pitem : item)
+	for (auto &pitem : item)
 	{
-		// compute width of left hand side
-		float total_width = gutter_width + ui().get_string_width(pitem.text.c_str()) + gutter_width;
+		if (pitem.width < 0.0f)
+		{
+			// compute width of left hand side
+			pitem.width = gutter_width + ui().get_string_width(pitem.text.c_str()) + gutter_width;
 
-		// add in width of right hand side
-		if (!pitem.subtext.empty())
-			total_width += 2.0f * gutter_width + ui().get_string_width(pitem.subtext.c_str());
+			// add in width of right hand side
+			if (!pitem.subtext.empty())
+				pitem.width += 2.0f * gutter_width + ui().get_string_width(pitem.subtext.c_str());
+		}
 
 		// track the maximum
-		if (total_width > visible_width)
-			visible_width = total_width;
+		if (pitem.width > visible_width)
+			visible_width = pitem.width;
 
 		// track the height as well
 		visible_main_menu_height += line_height;
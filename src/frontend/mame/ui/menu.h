@@ -323,6 +323,8 @@ private:
 
 	float                   m_customtop;        // amount of extra height to add at the top
 	float                   m_custombottom;     // amount of extra height to add at the bottom
+	float                   m_measured_height;  // line height the item widths were measured at
+	float                   m_measured_aspect;  // UI aspect the item widths were measured at
 
 	int                     m_resetpos;         // reset position
 	void                    *m_resetref;        // reset reference
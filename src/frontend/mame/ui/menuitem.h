@@ -41,6 +41,7 @@ public:
 	uint32_t          flags;
 	void            *ref;
 	menu_item_type  type;   // item type (eventually will go away when itemref is proper ui_menu_item class rather than void*)
+	float           width = -1.0f;  // measured width of text and subtext, or negative if not measured yet
 };
 
 } // namespace ui
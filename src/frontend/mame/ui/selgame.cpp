@@ -1184,6 +1184,11 @@ void menu_select_game::populate_search()
 	int index = 0;
 	for (; index < m_displaylist.size(); ++index)
 	{
+		// don't bother scoring entries that can't beat the worst one we're keeping
+		int bound = std::min(fuzzy_substring_bound(m_search, core_strcharset(m_displaylist[index]->description)), fuzzy_substring_bound(m_search, core_strcharset(m_displaylist[index]->name)));
+		if (bound >= penalty[VISIBLE_GAMES_IN_SEARCH - 1])
+			continue;
+
 		// pick the best match between driver name and description
 		int curpenalty = fuzzy_substring(m_search, m_displaylist[index]->description);
 		int tmp = fuzzy_substring(m_search, m_displaylist[index]->name);
@@ -1013,10 +1013,16 @@ void menu_select_software::find_matches(const char *str, int count)
 {
 	// allocate memory to track the penalty value
 	std::vector<int> penalty(count, 9999);
+	std::string const needle(str);
 	int index = 0;
 
 	for (; index < m_displaylist.size(); ++index)
 	{
+		// don't bother scoring entries that can't beat the worst one we're keeping
+		int bound = std::min(fuzzy_substring_bound(needle, core_strcharset(m_displaylist[index]->longname.c_str())), fuzzy_substring_bound(needle, core_strcharset(m_displaylist[index]->shortname.c_str())));
+		if ((count == 0) || (bound >= penalty[count - 1]))
+			continue;
+
 		// pick the best match between driver name and description
 		int curpenalty = fuzzy_substring(str, m_displaylist[index]->longname);
 		int tmp = fuzzy_substring(str, m_displaylist[index]->shortname);
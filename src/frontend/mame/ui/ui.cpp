@@ -1215,6 +1215,13 @@ uint32_t mame_ui_manager::handler_ingame(render_container &container)
 		machine().resume();
 	}
 
+	// rewind single step; pause so there's time to look at where we've got to
+	if (machine().ui_input().pressed(IPT_UI_REWIND_SINGLE))
+	{
+		machine().pause();
+		machine().schedule_rewind();
+	}
+
 	// handle a toggle cheats request
 	if (machine().ui_input().pressed(IPT_UI_TOGGLE_CHEAT))
 		mame_machine_manager::instance()->cheat().set_enable(!mame_machine_manager::instance()->cheat().enabled());
@@ -162,6 +162,22 @@ int fuzzy_substring(std::string s_needle, std::string s_haystack)
 	return rv;
 }
 
+//-------------------------------------------------
+//  lowest score fuzzy_substring could give the
+//  needle against a haystack with the given
+//  core_strcharset: each needle character the
+//  haystack lacks costs at least one edit
+//-------------------------------------------------
+
+int fuzzy_substring_bound(const std::string &needle, uint64_t haystackset)
+{
+	int bound = 0;
+	for (char c : needle)
+		if (!(core_charbit(c) & haystackset))
+			bound++;
+	return bound;
+}
+
 //-------------------------------------------------
 //  set manufacturers
 //-------------------------------------------------
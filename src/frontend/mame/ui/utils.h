@@ -232,6 +232,7 @@ struct sw_custfltr
 
 // GLOBAL FUNCTIONS
 int fuzzy_substring(std::string needle, std::string haystack);
+int fuzzy_substring_bound(const std::string &needle, uint64_t haystackset);
 char* chartrimcarriage(char str[]);
 const char* strensure(const char* s);
 int getprecisionchr(const char* s);
@@ -909,6 +909,36 @@ floppy_image::~floppy_image()
 {
 }
 
+void floppy_image::set_track_loader(track_loader _loader, int _tracks, int _heads)
+{
+	loader = std::move(_loader);
+	for(int track=0; track < _tracks && track < tracks; track++)
+		for(int head=0; head < _heads && head < heads; head++)
+			track_array[track*4][head].pending = true;
+}
+
+void floppy_image::load_track(int index, int head)
+{
+	// clear the flag first, the loader fills the buffer in through get_buffer
+	track_array[index][head].pending = false;
+	loader(index >> 2, head);
+}
+
+void floppy_image::load_all_tracks()
+{
+	for(int i=0; i<tracks*4+1; i++)
+		for(int j=0; j<heads; j++)
+			if(track_array[i][j].pending)
+				load_track(i, j);
+}
+
+void floppy_image::clear_dirty_tracks()
+{
+	for(auto &track : track_array)
+		for(auto &head : track)
+			head.dirty = false;
+}
+
 void floppy_image::get_maximal_geometry(int &_tracks, int &_heads) const
 {
 	_tracks = tracks;
@@ -921,7 +951,7 @@ void floppy_image::get_actual_geometry(int &_tracks, int &_heads)
 
 	while(maxt >= 0) {
 		for(int i=0; i<=maxh; i++)
-			if(!track_array[maxt][i].cell_data.empty())
+			if(track_array[maxt][i].pending || !track_array[maxt][i].cell_data.empty())
 				goto track_done;
 		maxt--;
 	}
@@ -929,7 +959,7 @@ void floppy_image::get_actual_geometry(int &_tracks, int &_heads)
 	if(maxt >= 0)
 		while(maxh >= 0) {
 			for(int i=0; i<=maxt; i++)
-				if(!track_array[i][maxh].cell_data.empty())
+				if(track_array[i][maxh].pending || !track_array[i][maxh].cell_data.empty())
 					goto head_done;
 			maxh--;
 		}
@@ -943,7 +973,7 @@ int floppy_image::get_resolution() const
 	int mask = 0;
 	for(int i=0; i<=(tracks-1)*4; i++)
 		for(int j=0; j<heads; j++)
-			if(!track_array[i][j].cell_data.empty())
+			if(track_array[i][j].pending || !track_array[i][j].cell_data.empty())
 				mask |= 1 << (i & 3);
 	if(mask & 0xa)
 		return 2;
@@ -988,6 +1018,19 @@ bool floppy_image_format_t::save(io_generic *, floppy_image *)
 	return false;
 }
 
+std::vector<floppy_image_format_t::desc_e> floppy_image_format_t::copy_desc(const desc_e *desc)
+{
+	int count = 0;
+	while(desc[count].type != END)
+		count++;
+	return std::vector<desc_e>(desc, desc + count + 1);
+}
+
+bool floppy_image_format_t::save_modified(io_generic *, floppy_image *)
+{
+	return false;
+}
+
 bool floppy_image_format_t::extension_matches(const char *file_name) const
 {
 	const char *ext = strrchr(file_name, '.');
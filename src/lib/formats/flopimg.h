@@ -16,6 +16,8 @@
 #include "opresolv.h"
 #include "coretmpl.h"
 
+#include <functional>
+
 #ifndef LOG_FORMATS
 #define LOG_FORMATS if (0) printf
 #endif
@@ -256,6 +258,15 @@ public:
 	*/
 	virtual bool save(io_generic *io, floppy_image *image);
 
+	/*! @brief Write back the tracks changed since the image was loaded.
+	  Formats that keep every track at a fixed place in the file can
+	  rewrite just the dirty tracks in place instead of the whole image.
+	  @param io buffer holding the image this format loaded.
+	  @param image source buffer containing data in MESS internal format.
+	  @return true on success, false if a full save() is needed.
+	*/
+	virtual bool save_modified(io_generic *io, floppy_image *image);
+
 	//! @returns string containing name of format.
 	virtual const char *name() const = 0;
 	//! @returns string containing description of format.
@@ -298,6 +309,10 @@ protected:
 			p2;     //!< second param
 	};
 
+	//! Copies a track description up to and including its END, so a lazy
+	//! track loader keeps its own copy of a description built in place.
+	static std::vector<desc_e> copy_desc(const desc_e *desc);
+
 	//! Opcodes of the format description language used by generate_track()
 	enum {
 		END,                    //!< End of description
@@ -733,7 +748,28 @@ public:
 	  @param head head number
 	  @return a pointer to the data buffer for this track and head
 	*/
-	std::vector<uint32_t> &get_buffer(int track, int head, int subtrack = 0) { return track_array[track*4+subtrack][head].cell_data; }
+	std::vector<uint32_t> &get_buffer(int track, int head, int subtrack = 0) { track_info &t = track_array[track*4+subtrack][head]; if(t.pending) load_track(track*4+subtrack, head); return t.cell_data; }
+
+	//! Called with a track and head to generate that track on first access.
+	typedef std::function<void (int track, int head)> track_loader;
+
+	/*! @brief Defers generating tracks until they are first accessed.
+	  Every whole track below the given geometry is left empty until
+	  get_buffer asks for it, then the loader fills it in.
+	  @param loader the function generating one track.
+	  @param tracks number of tracks the loader can generate.
+	  @param heads number of heads the loader can generate.
+	*/
+	void set_track_loader(track_loader loader, int tracks, int heads);
+	//! Generates every track still waiting for the loader.
+	void load_all_tracks();
+
+	//! Marks a track as written to since the image was loaded or saved.
+	void set_track_dirty(int track, int head, int subtrack = 0) { track_array[track*4+subtrack][head].dirty = true; }
+	//! @return true if the track was written to since the image was loaded or saved.
+	bool is_track_dirty(int track, int head, int subtrack = 0) const { return track_array[track*4+subtrack][head].dirty; }
+	//! Forgets which tracks were written to, once they are saved.
+	void clear_dirty_tracks();
 
 	//! Sets the write splice position.
 	//! The "track splice" information indicates where to start writing
@@ -747,9 +783,9 @@ public:
 	    @param head
 	    @param pos the position
 	*/
-	void set_write_splice_position(int track, int head, uint32_t pos, int subtrack = 0) { track_array[track*4+subtrack][head].write_splice = pos; }
+	void set_write_splice_position(int track, int head, uint32_t pos, int subtrack = 0) { get_buffer(track, head, subtrack); track_array[track*4+subtrack][head].write_splice = pos; }
 	//! @return the current write splice position.
-	uint32_t get_write_splice_position(int track, int head, int subtrack = 0) const { return track_array[track*4+subtrack][head].write_splice; }
+	uint32_t get_write_splice_position(int track, int head, int subtrack = 0) { get_buffer(track, head, subtrack); return track_array[track*4+subtrack][head].write_splice; }
 	//! @return the maximal geometry supported by this format.
 	void get_maximal_geometry(int &tracks, int &heads) const;
 
@@ -773,10 +809,16 @@ private:
 	struct track_info {
 		std::vector<uint32_t> cell_data;
 		uint32_t write_splice;
+		bool pending;   //!< not generated yet, the loader fills it in on first access
+		bool dirty;     //!< written to since the image was loaded or saved
 
-		track_info() { write_splice = 0; }
+		track_info() { write_splice = 0; pending = false; dirty = false; }
 	};
 
+	track_loader loader;
+
+	void load_track(int index, int head);
+
 	// track number multiplied by 4 then head
 	// last array size may be bigger than actual track size
 	std::vector<std::vector<track_info> > track_array;
@@ -214,15 +214,16 @@ bool upd765_format::load(io_generic *io, uint32_t form_factor, floppy_image *ima
 
 	int track_size = compute_track_size(f);
 
-	uint8_t sectdata[40*512];
-	desc_s sectors[40];
+	// tracks are read and generated when the drive first gets to them; the
+	// header size is per file, so keep the one identify found for this one
+	image->set_track_loader([this, io = *io, &f, track_desc = copy_desc(desc), total_size, track_size, header_size = file_header_skip_bytes, image](int track, int head) mutable {
+		uint8_t sectdata[40*512];
+		desc_s sectors[40];
 
-	for(int track=0; track < f.track_count; track++)
-		for(int head=0; head < f.head_count; head++) {
-			build_sector_description(f, sectdata, sectors, track, head);
-			io_generic_read(io, sectdata, file_header_skip_bytes + (track*f.head_count + head)*track_size, track_size);
-			generate_track(desc, track, head, sectors, f.sector_count, total_size, image);
-		}
+		build_sector_description(f, sectdata, sectors, track, head);
+		io_generic_read(&io, sectdata, header_size + (track*f.head_count + head)*track_size, track_size);
+		generate_track(&track_desc[0], track, head, sectors, f.sector_count, total_size, image);
+	}, f.track_count, f.head_count);
 
 	image->set_variant(f.variant);
 
@@ -350,6 +351,33 @@ bool upd765_format::save(io_generic *io, floppy_image *image)
 	return true;
 }
 
+bool upd765_format::save_modified(io_generic *io, floppy_image *image)
+{
+	// the file still has to be laid out the way the image looks now
+	std::vector<int> candidates(1, find_size(io, image->get_form_factor()));
+	if(candidates[0] == -1)
+		return false;
+	check_compatibility(image, candidates);
+	if(candidates.empty())
+		return false;
+
+	const format &f = formats[candidates[0]];
+	int track_size = compute_track_size(f);
+
+	uint8_t sectdata[40*512];
+	desc_s sectors[40];
+
+	for(int track=0; track < f.track_count; track++)
+		for(int head=0; head < f.head_count; head++)
+			if(image->is_track_dirty(track, head)) {
+				build_sector_description(f, sectdata, sectors, track, head);
+				extract_sectors(image, f, sectors, track, head);
+				io_generic_write(io, sectdata, file_header_skip_bytes + (track*f.head_count + head)*track_size, track_size);
+			}
+
+	return true;
+}
+
 void upd765_format::check_compatibility(floppy_image *image, std::vector<int> &candidates)
 {
 	uint8_t bitstream[500000/8];
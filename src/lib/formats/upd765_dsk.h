@@ -41,6 +41,7 @@ public:
 	virtual int identify(io_generic *io, uint32_t form_factor) override;
 	virtual bool load(io_generic *io, uint32_t form_factor, floppy_image *image) override;
 	virtual bool save(io_generic *io, floppy_image *image) override;
+	virtual bool save_modified(io_generic *io, floppy_image *image) override;
 	virtual bool supports_save() const override;
 
 protected:
@@ -198,20 +198,20 @@ bool wd177x_format::load(io_generic *io, uint32_t form_factor, floppy_image *ima
 
 	int track_size = compute_track_size(f);
 
-	uint8_t sectdata[40*512];
-	desc_s sectors[40];
+	// tracks are read and generated when the drive first gets to them
+	image->set_track_loader([this, io = *io, &f, track_desc = copy_desc(desc), total_size, track_size, image](int track, int head) mutable {
+		uint8_t sectdata[40*512];
+		desc_s sectors[40];
 
-	for(int track=0; track < f.track_count; track++)
-		for(int head=0; head < f.head_count; head++) {
-			if (f.encoding == floppy_image::FM)
-				desc[14].p1 = get_track_dam_fm(f, head, track);
-			else
-				desc[16].p1 = get_track_dam_mfm(f, head, track);
+		if (f.encoding == floppy_image::FM)
+			track_desc[14].p1 = get_track_dam_fm(f, head, track);
+		else
+			track_desc[16].p1 = get_track_dam_mfm(f, head, track);
 
-			build_sector_description(f, sectdata, sectors, track, head);
-			io_generic_read(io, sectdata, get_image_offset(f, head, track), track_size);
-			generate_track(desc, track, head, sectors, f.sector_count, total_size, image);
-		}
+		build_sector_description(f, sectdata, sectors, track, head);
+		io_generic_read(&io, sectdata, get_image_offset(f, head, track), track_size);
+		generate_track(&track_desc[0], track, head, sectors, f.sector_count, total_size, image);
+	}, f.track_count, f.head_count);
 
 	image->set_variant(f.variant);
 
@@ -341,6 +341,33 @@ bool wd177x_format::save(io_generic *io, floppy_image *image)
 	return true;
 }
 
+bool wd177x_format::save_modified(io_generic *io, floppy_image *image)
+{
+	// the file still has to be laid out the way the image looks now
+	std::vector<int> candidates(1, find_size(io, image->get_form_factor()));
+	if(candidates[0] == -1)
+		return false;
+	check_compatibility(image, candidates);
+	if(candidates.empty())
+		return false;
+
+	const format &f = formats[candidates[0]];
+	int track_size = compute_track_size(f);
+
+	uint8_t sectdata[40*512];
+	desc_s sectors[40];
+
+	for(int track=0; track < f.track_count; track++)
+		for(int head=0; head < f.head_count; head++)
+			if(image->is_track_dirty(track, head)) {
+				build_sector_description(f, sectdata, sectors, track, head);
+				extract_sectors(image, f, sectors, track, head);
+				io_generic_write(io, sectdata, get_image_offset(f, head, track), track_size);
+			}
+
+	return true;
+}
+
 /*
     Default implementation of the image offset computation. May be overwritten
     by subclasses.
@@ -14,6 +14,8 @@
 #include "../nl_base.h"
 #include "../plib/putil.h"
 
+#include <type_traits>
+
 #define NETLIB_TRUTHTABLE(cname, nIN, nOUT)                                     \
 	class NETLIB_NAME(cname) : public nld_truthtable_t<nIN, nOUT>               \
 	{                                                                           \
@@ -161,6 +163,8 @@ namespace netlist
 		, m_fam(*this, fam)
 		, m_ign(*this, "m_ign", 0)
 		, m_active(*this, "m_active", 1)
+		, m_state(*this, "m_state", 0)
+		, m_packed(false)
 		, m_ttp(ttp)
 		{
 			while (*desc != "" )
@@ -178,6 +182,8 @@ namespace netlist
 		, m_fam(*this, fam)
 		, m_ign(*this, "m_ign", 0)
 		, m_active(*this, "m_active", 1)
+		, m_state(*this, "m_state", 0)
+		, m_packed(false)
 		, m_ttp(ttp)
 		{
 			m_desc = desc;
@@ -201,7 +207,7 @@ namespace netlist
 			for (std::size_t i=0; i < m_NI; i++)
 			{
 				inout[i] = inout[i].trim();
-				m_I.emplace(i, *this, inout[i]);
+				m_I.emplace(i, *this, inout[i], input_delegate(i, std::integral_constant<std::size_t, 0>()));
 			}
 			for (std::size_t i=0; i < m_NO; i++)
 			{
@@ -250,6 +256,14 @@ namespace netlist
 			for (std::size_t i=0; i<m_NO;i++)
 				if (this->m_Q[i].has_net() && this->m_Q[i].net().num_cons()>0)
 					m_active++;
+			/* Inputs sharing a net would see each other's change only after
+			 * their own update, so those devices read all inputs every time.
+			 */
+			m_packed = true;
+			for (std::size_t i = 0; i < m_NI; i++)
+				for (std::size_t j = i + 1; j < m_NI; j++)
+					if (!m_I[i].has_net() || !m_I[j].has_net() || &m_I[i].net() == &m_I[j].net())
+						m_packed = false;
 		}
 
 		NETLIB_UPDATEI()
@@ -293,7 +307,35 @@ namespace netlist
 
 	private:
 
-		template<bool doOUT>
+		/* Each input has its own update. A change on input N only updates
+		 * bit N of the packed input state; inputs which were ignored are
+		 * read again in process().
+		 */
+		template <std::size_t N>
+		void update_input()
+		{
+			if (m_packed)
+			{
+				m_state = (m_state & ~(UINT32_C(1) << N)) | (m_I[N]() << N);
+				process<true, true>();
+			}
+			else
+				process<true>();
+		}
+
+		nldelegate input_delegate(std::size_t, std::integral_constant<std::size_t, m_NI>)
+		{
+			return nldelegate();
+		}
+
+		template <std::size_t N>
+		nldelegate input_delegate(std::size_t i, std::integral_constant<std::size_t, N>)
+		{
+			return (i == N) ? nldelegate(&nld_truthtable_t::template update_input<N>, this)
+				: input_delegate(i, std::integral_constant<std::size_t, N + 1>());
+		}
+
+		template<bool doOUT, bool packed = false>
 		inline void process()
 		{
 			netlist_time mt = netlist_time::zero();
@@ -309,6 +351,16 @@ namespace netlist
 						state |= (m_I[i]() << i);
 						mt = std::max(this->m_I[i].net().time(), mt);
 					}
+				else if (packed)
+				{
+					state = m_state;
+					for (std::size_t i = 0; ign != 0; ign >>= 1, i++)
+						if ((ign & 1))
+						{
+							m_I[i].activate();
+							state = (state & ~(UINT64_C(1) << i)) | (static_cast<uint_least64_t>(m_I[i]()) << i);
+						}
+				}
 				else
 					for (std::size_t i = 0; i < m_NI; ign >>= 1, i++)
 					{
@@ -330,6 +382,7 @@ namespace netlist
 						state |= (m_I[i]() << i);
 			}
 			auto nstate = state;
+			m_state = static_cast<std::uint32_t>(state);
 
 			const auto outstate = m_ttp->m_outs[nstate];
 			const auto out = outstate & ((1 << m_NO) - 1);
@@ -359,6 +412,8 @@ namespace netlist
 		/* FIXME: check width */
 		state_var_u32       m_ign;
 		state_var_s32       m_active;
+		state_var_u32       m_state;
+		bool                m_packed;
 		truthtable_t *      m_ttp;
 		std::vector<pstring> m_desc;
 	};
@@ -0,0 +1,354 @@
+// license:GPL-2.0+
+// copyright-holders:Couriersud
+/*
+ * static_solvers.cpp
+ *
+ * Generated by nltool -c static, do not edit.
+ *
+ */
+
+#include "../nl_base.h"
+
+extern "C" void nl_gcr_62a1f769e35fade5_35(double * __restrict m_A, double * __restrict RHS, double * __restrict V)
+
+{
+
+double m_A0 = m_A[0];
+double m_A1 = m_A[1];
+double m_A2 = m_A[2];
+double m_A3 = m_A[3];
+double m_A4 = m_A[4];
+double m_A5 = m_A[5];
+double m_A6 = m_A[6];
+double m_A7 = m_A[7];
+double m_A8 = m_A[8];
+double m_A9 = m_A[9];
+double m_A10 = m_A[10];
+double m_A11 = m_A[11];
+double m_A12 = m_A[12];
+double m_A13 = m_A[13];
+double m_A14 = m_A[14];
+double m_A15 = m_A[15];
+double m_A16 = m_A[16];
+double m_A17 = m_A[17];
+double m_A18 = m_A[18];
+double m_A19 = m_A[19];
+double m_A20 = m_A[20];
+double m_A21 = m_A[21];
+double m_A22 = m_A[22];
+double m_A23 = m_A[23];
+double m_A24 = m_A[24];
+double m_A25 = m_A[25];
+double m_A26 = m_A[26];
+double m_A27 = m_A[27];
+double m_A28 = m_A[28];
+double m_A29 = m_A[29];
+double m_A30 = m_A[30];
+double m_A31 = m_A[31];
+double m_A32 = m_A[32];
+double m_A33 = m_A[33];
+double m_A34 = m_A[34];
+const double f0 = 1.0 / m_A0;
+	const double f0_3 = -f0 * m_A6;
+	m_A7 += m_A1 * f0_3;
+	RHS[3] += f0_3 * RHS[0];
+const double f1 = 1.0 / m_A2;
+	const double f1_6 = -f1 * m_A19;
+	m_A23 += m_A3 * f1_6;
+	RHS[6] += f1_6 * RHS[1];
+const double f2 = 1.0 / m_A4;
+	const double f2_5 = -f2 * m_A14;
+	m_A16 += m_A5 * f2_5;
+	RHS[5] += f2_5 * RHS[2];
+const double f3 = 1.0 / m_A7;
+	const double f3_5 = -f3 * m_A15;
+	m_A16 += m_A8 * f3_5;
+	m_A17 += m_A9 * f3_5;
+	RHS[5] += f3_5 * RHS[3];
+	const double f3_6 = -f3 * m_A20;
+	m_A22 += m_A8 * f3_6;
+	m_A23 += m_A9 * f3_6;
+	RHS[6] += f3_6 * RHS[3];
+const double f4 = 1.0 / m_A10;
+	const double f4_6 = -f4 * m_A21;
+	m_A23 += m_A11 * f4_6;
+	m_A24 += m_A12 * f4_6;
+	m_A25 += m_A13 * f4_6;
+	RHS[6] += f4_6 * RHS[4];
+	const double f4_7 = -f4 * m_A26;
+	m_A27 += m_A11 * f4_7;
+	m_A28 += m_A12 * f4_7;
+	m_A29 += m_A13 * f4_7;
+	RHS[7] += f4_7 * RHS[4];
+	const double f4_8 = -f4 * m_A30;
+	m_A32 += m_A11 * f4_8;
+	m_A33 += m_A12 * f4_8;
+	m_A34 += m_A13 * f4_8;
+	RHS[8] += f4_8 * RHS[4];
+const double f5 = 1.0 / m_A16;
+	const double f5_6 = -f5 * m_A22;
+	m_A23 += m_A17 * f5_6;
+	m_A25 += m_A18 * f5_6;
+	RHS[6] += f5_6 * RHS[5];
+	const double f5_8 = -f5 * m_A31;
+	m_A32 += m_A17 * f5_8;
+	m_A34 += m_A18 * f5_8;
+	RHS[8] += f5_8 * RHS[5];
+const double f6 = 1.0 / m_A23;
+	const double f6_7 = -f6 * m_A27;
+	m_A28 += m_A24 * f6_7;
+	m_A29 += m_A25 * f6_7;
+	RHS[7] += f6_7 * RHS[6];
+	const double f6_8 = -f6 * m_A32;
+	m_A33 += m_A24 * f6_8;
+	m_A34 += m_A25 * f6_8;
+	RHS[8] += f6_8 * RHS[6];
+const double f7 = 1.0 / m_A28;
+	const double f7_8 = -f7 * m_A33;
+	m_A34 += m_A29 * f7_8;
+	RHS[8] += f7_8 * RHS[7];
+	V[8] = RHS[8] / m_A34;
+	double tmp7 = 0.0;
+	tmp7 += m_A29 * V[8];
+	V[7] = (RHS[7] - tmp7) / m_A28;
+	double tmp6 = 0.0;
+	tmp6 += m_A24 * V[7];
+	tmp6 += m_A25 * V[8];
+	V[6] = (RHS[6] - tmp6) / m_A23;
+	double tmp5 = 0.0;
+	tmp5 += m_A17 * V[6];
+	tmp5 += m_A18 * V[8];
+	V[5] = (RHS[5] - tmp5) / m_A16;
+	double tmp4 = 0.0;
+	tmp4 += m_A11 * V[6];
+	tmp4 += m_A12 * V[7];
+	tmp4 += m_A13 * V[8];
+	V[4] = (RHS[4] - tmp4) / m_A10;
+	double tmp3 = 0.0;
+	tmp3 += m_A8 * V[5];
+	tmp3 += m_A9 * V[6];
+	V[3] = (RHS[3] - tmp3) / m_A7;
+	double tmp2 = 0.0;
+	tmp2 += m_A5 * V[5];
+	V[2] = (RHS[2] - tmp2) / m_A4;
+	double tmp1 = 0.0;
+	tmp1 += m_A3 * V[6];
+	V[1] = (RHS[1] - tmp1) / m_A2;
+	double tmp0 = 0.0;
+	tmp0 += m_A1 * V[3];
+	V[0] = (RHS[0] - tmp0) / m_A0;
+}
+
+
+extern "C" void nl_gcr_8638c88639cadabb_14(double * __restrict m_A, double * __restrict RHS, double * __restrict V)
+
+{
+
+double m_A0 = m_A[0];
+double m_A1 = m_A[1];
+double m_A2 = m_A[2];
+double m_A3 = m_A[3];
+double m_A4 = m_A[4];
+double m_A5 = m_A[5];
+double m_A6 = m_A[6];
+double m_A7 = m_A[7];
+double m_A8 = m_A[8];
+double m_A9 = m_A[9];
+double m_A10 = m_A[10];
+double m_A11 = m_A[11];
+double m_A12 = m_A[12];
+double m_A13 = m_A[13];
+const double f0 = 1.0 / m_A0;
+	const double f0_1 = -f0 * m_A3;
+	m_A4 += m_A1 * f0_1;
+	m_A5 += m_A2 * f0_1;
+	RHS[1] += f0_1 * RHS[0];
+	const double f0_2 = -f0 * m_A7;
+	m_A8 += m_A1 * f0_2;
+	m_A9 += m_A2 * f0_2;
+	RHS[2] += f0_2 * RHS[0];
+const double f1 = 1.0 / m_A4;
+	const double f1_2 = -f1 * m_A8;
+	m_A9 += m_A5 * f1_2;
+	m_A10 += m_A6 * f1_2;
+	RHS[2] += f1_2 * RHS[1];
+	const double f1_3 = -f1 * m_A11;
+	m_A12 += m_A5 * f1_3;
+	m_A13 += m_A6 * f1_3;
+	RHS[3] += f1_3 * RHS[1];
+const double f2 = 1.0 / m_A9;
+	const double f2_3 = -f2 * m_A12;
+	m_A13 += m_A10 * f2_3;
+	RHS[3] += f2_3 * RHS[2];
+	V[3] = RHS[3] / m_A13;
+	double tmp2 = 0.0;
+	tmp2 += m_A10 * V[3];
+	V[2] = (RHS[2] - tmp2) / m_A9;
+	double tmp1 = 0.0;
+	tmp1 += m_A5 * V[2];
+	tmp1 += m_A6 * V[3];
+	V[1] = (RHS[1] - tmp1) / m_A4;
+	double tmp0 = 0.0;
+	tmp0 += m_A1 * V[1];
+	tmp0 += m_A2 * V[2];
+	V[0] = (RHS[0] - tmp0) / m_A0;
+}
+
+
+extern "C" void nl_gcr_c1d7c07fda963658_20(double * __restrict m_A, double * __restrict RHS, double * __restrict V)
+
+{
+
+double m_A0 = m_A[0];
+double m_A1 = m_A[1];
+double m_A2 = m_A[2];
+double m_A3 = m_A[3];
+double m_A4 = m_A[4];
+double m_A5 = m_A[5];
+double m_A6 = m_A[6];
+double m_A7 = m_A[7];
+double m_A8 = m_A[8];
+double m_A9 = m_A[9];
+double m_A10 = m_A[10];
+double m_A11 = m_A[11];
+double m_A12 = m_A[12];
+double m_A13 = m_A[13];
+double m_A14 = m_A[14];
+double m_A15 = m_A[15];
+double m_A16 = m_A[16];
+double m_A17 = m_A[17];
+double m_A18 = m_A[18];
+double m_A19 = m_A[19];
+const double f0 = 1.0 / m_A0;
+	const double f0_5 = -f0 * m_A16;
+	m_A19 += m_A1 * f0_5;
+	RHS[5] += f0_5 * RHS[0];
+const double f1 = 1.0 / m_A2;
+	const double f1_4 = -f1 * m_A11;
+	m_A14 += m_A3 * f1_4;
+	RHS[4] += f1_4 * RHS[1];
+const double f2 = 1.0 / m_A4;
+	const double f2_3 = -f2 * m_A7;
+	m_A8 += m_A5 * f2_3;
+	m_A9 += m_A6 * f2_3;
+	RHS[3] += f2_3 * RHS[2];
+	const double f2_4 = -f2 * m_A12;
+	m_A13 += m_A5 * f2_4;
+	m_A14 += m_A6 * f2_4;
+	RHS[4] += f2_4 * RHS[2];
+const double f3 = 1.0 / m_A8;
+	const double f3_4 = -f3 * m_A13;
+	m_A14 += m_A9 * f3_4;
+	m_A15 += m_A10 * f3_4;
+	RHS[4] += f3_4 * RHS[3];
+	const double f3_5 = -f3 * m_A17;
+	m_A18 += m_A9 * f3_5;
+	m_A19 += m_A10 * f3_5;
+	RHS[5] += f3_5 * RHS[3];
+const double f4 = 1.0 / m_A14;
+	const double f4_5 = -f4 * m_A18;
+	m_A19 += m_A15 * f4_5;
+	RHS[5] += f4_5 * RHS[4];
+	V[5] = RHS[5] / m_A19;
+	double tmp4 = 0.0;
+	tmp4 += m_A15 * V[5];
+	V[4] = (RHS[4] - tmp4) / m_A14;
+	double tmp3 = 0.0;
+	tmp3 += m_A9 * V[4];
+	tmp3 += m_A10 * V[5];
+	V[3] = (RHS[3] - tmp3) / m_A8;
+	double tmp2 = 0.0;
+	tmp2 += m_A5 * V[3];
+	tmp2 += m_A6 * V[4];
+	V[2] = (RHS[2] - tmp2) / m_A4;
+	double tmp1 = 0.0;
+	tmp1 += m_A3 * V[4];
+	V[1] = (RHS[1] - tmp1) / m_A2;
+	double tmp0 = 0.0;
+	tmp0 += m_A1 * V[5];
+	V[0] = (RHS[0] - tmp0) / m_A0;
+}
+
+
+extern "C" void nl_gcr_ecd5f36fb3a774a6_7(double * __restrict m_A, double * __restrict RHS, double * __restrict V)
+
+{
+
+double m_A0 = m_A[0];
+double m_A1 = m_A[1];
+double m_A2 = m_A[2];
+double m_A3 = m_A[3];
+double m_A4 = m_A[4];
+double m_A5 = m_A[5];
+double m_A6 = m_A[6];
+const double f0 = 1.0 / m_A0;
+	const double f0_2 = -f0 * m_A4;
+	m_A6 += m_A1 * f0_2;
+	RHS[2] += f0_2 * RHS[0];
+const double f1 = 1.0 / m_A2;
+	const double f1_2 = -f1 * m_A5;
+	m_A6 += m_A3 * f1_2;
+	RHS[2] += f1_2 * RHS[1];
+	V[2] = RHS[2] / m_A6;
+	double tmp1 = 0.0;
+	tmp1 += m_A3 * V[2];
+	V[1] = (RHS[1] - tmp1) / m_A2;
+	double tmp0 = 0.0;
+	tmp0 += m_A1 * V[2];
+	V[0] = (RHS[0] - tmp0) / m_A0;
+}
+
+
+extern "C" void nl_gcr_ed623a41542a99c5_10(double * __restrict m_A, double * __restrict RHS, double * __restrict V)
+
+{
+
+double m_A0 = m_A[0];
+double m_A1 = m_A[1];
+double m_A2 = m_A[2];
+double m_A3 = m_A[3];
+double m_A4 = m_A[4];
+double m_A5 = m_A[5];
+double m_A6 = m_A[6];
+double m_A7 = m_A[7];
+double m_A8 = m_A[8];
+double m_A9 = m_A[9];
+const double f0 = 1.0 / m_A0;
+	const double f0_3 = -f0 * m_A6;
+	m_A9 += m_A1 * f0_3;
+	RHS[3] += f0_3 * RHS[0];
+const double f1 = 1.0 / m_A2;
+	const double f1_3 = -f1 * m_A7;
+	m_A9 += m_A3 * f1_3;
+	RHS[3] += f1_3 * RHS[1];
+const double f2 = 1.0 / m_A4;
+	const double f2_3 = -f2 * m_A8;
+	m_A9 += m_A5 * f2_3;
+	RHS[3] += f2_3 * RHS[2];
+	V[3] = RHS[3] / m_A9;
+	double tmp2 = 0.0;
+	tmp2 += m_A5 * V[3];
+	V[2] = (RHS[2] - tmp2) / m_A4;
+	double tmp1 = 0.0;
+	tmp1 += m_A3 * V[3];
+	V[1] = (RHS[1] - tmp1) / m_A2;
+	double tmp0 = 0.0;
+	tmp0 += m_A1 * V[3];
+	V[0] = (RHS[0] - tmp0) / m_A0;
+}
+
+
+namespace netlist
+{
+
+const plib::dynlib_static_sym static_solver_syms[] =
+{
+	{ "nl_gcr_62a1f769e35fade5_35", reinterpret_cast<void *>(&nl_gcr_62a1f769e35fade5_35) },
+	{ "nl_gcr_8638c88639cadabb_14", reinterpret_cast<void *>(&nl_gcr_8638c88639cadabb_14) },
+	{ "nl_gcr_c1d7c07fda963658_20", reinterpret_cast<void *>(&nl_gcr_c1d7c07fda963658_20) },
+	{ "nl_gcr_ecd5f36fb3a774a6_7", reinterpret_cast<void *>(&nl_gcr_ecd5f36fb3a774a6_7) },
+	{ "nl_gcr_ed623a41542a99c5_10", reinterpret_cast<void *>(&nl_gcr_ed623a41542a99c5_10) },
+	{ nullptr, nullptr }
+};
+
+} // namespace netlist
@@ -356,6 +356,8 @@ void netlist_t::start()
 
 	pstring libpath = plib::util::environment("NL_BOOSTLIB", plib::util::buildpath({".", "nlboost.so"}));
 	m_lib = plib::make_unique<plib::dynlib>(libpath);
+	if (!m_lib->isLoaded())
+		m_lib = plib::make_unique<plib::dynlib>(static_solver_syms);
 
 	/* resolve inputs */
 	setup().resolve_inputs();
@@ -618,6 +620,8 @@ void netlist_t::print_stats() const
 
 		log().verbose("Queue Pushes   {1:15}", queue().m_prof_call());
 		log().verbose("Queue Moves    {1:15}", queue().m_prof_sortmove());
+		log().verbose("Queue Depth    {1:15}", queue().m_prof_depth()
+				/ std::max(queue().m_prof_call(), static_cast<nperfcount_t::type>(1)));
 
 		log().verbose("Total loop     {1:15}", m_stat_mainloop());
 		/* Only one serialization should be counted in total time */
@@ -203,6 +203,12 @@ namespace netlist
 		class net_t;
 	}
 
+	/*! Solvers compiled from "nltool -c static" output.
+	 *  The table lives in generated/static_solvers.cpp and is used when no
+	 *  external solver library is found.
+	 */
+	extern const plib::dynlib_static_sym static_solver_syms[];
+
 	//============================================================
 	//  Exceptions
 	//============================================================
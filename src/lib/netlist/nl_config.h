@@ -53,7 +53,9 @@
 //============================================================
 
 #define NL_DEBUG                    (false)
+#if !defined(NL_KEEP_STATISTICS)
 #define NL_KEEP_STATISTICS          (0)
+#endif // !defined(NL_KEEP_STATISTICS)
 
 //============================================================
 //  General Macros
@@ -94,6 +94,7 @@ namespace netlist
 			*i = std::move(e);
 			++m_end;
 			m_prof_call.inc();
+			m_prof_depth.add(size());
 		}
 
 #if 0
@@ -162,6 +163,7 @@ namespace netlist
 		// profiling
 		nperfcount_t m_prof_sortmove;
 		nperfcount_t m_prof_call;
+		nperfcount_t m_prof_depth;
 };
 
 }
@@ -148,6 +148,7 @@ namespace chrono {
 		typedef uint_least64_t type;
 		type operator()() const { return m_count; }
 		void inc() { ++m_count; }
+		void add(const type n) { m_count += n; }
 		void reset() { m_count = 0; }
 		constexpr static bool enabled = enabled_;
 	private:
@@ -160,6 +161,7 @@ namespace chrono {
 		typedef uint_least64_t type;
 		constexpr type operator()() const { return 0; }
 		void inc() const { }
+		void add(const type) const { }
 		void reset() const { }
 		constexpr static bool enabled = false;
 	};
@@ -59,7 +59,7 @@ WCHAR *wstring_from_utf8(const char *utf8string)
 
 namespace plib {
 dynlib::dynlib(const pstring libname)
-: m_isLoaded(false), m_lib(nullptr)
+: m_isLoaded(false), m_lib(nullptr), m_syms(nullptr)
 {
 #ifdef _WIN32
 	//fprintf(stderr, "win: loading <%s>\n", libname.c_str());
@@ -87,7 +87,7 @@ dynlib::dynlib(const pstring libname)
 	}
 
 dynlib::dynlib(const pstring path, const pstring libname)
-: m_isLoaded(false), m_lib(nullptr)
+: m_isLoaded(false), m_lib(nullptr), m_syms(nullptr)
 {
 	//  printf("win: loading <%s>\n", libname.c_str());
 #ifdef _WIN32
@@ -118,6 +118,11 @@ dynlib::dynlib(const pstring path, const pstring libname)
 #endif
 }
 
+dynlib::dynlib(const dynlib_static_sym *syms)
+: m_isLoaded(true), m_lib(nullptr), m_syms(syms)
+{
+}
+
 dynlib::~dynlib()
 {
 	if (m_lib != nullptr)
@@ -137,6 +142,13 @@ bool dynlib::isLoaded() const
 
 void *dynlib::getsym_p(const pstring name)
 {
+	if (m_syms != nullptr)
+	{
+		for (const dynlib_static_sym *s = m_syms; s->name != nullptr; s++)
+			if (name == pstring(s->name, pstring::UTF8))
+				return s->addr;
+		return nullptr;
+	}
 #ifdef _WIN32
 	return (void *) GetProcAddress((HMODULE) m_lib, name.c_str());
 #else
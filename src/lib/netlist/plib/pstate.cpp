@@ -8,6 +8,8 @@
 #include "pstate.h"
 #include "palloc.h"
 
+#include <cstring>
+
 namespace plib {
 state_manager_t::state_manager_t()
 {
@@ -45,6 +47,55 @@ void state_manager_t::remove_save_items(const void *owner)
 	}
 }
 
+std::size_t state_manager_t::packed_size() const
+{
+	std::size_t size = 0;
+	for (auto const & s : m_save)
+		size += s->m_dt.size * s->m_count;
+	return size;
+}
+
+std::uint32_t state_manager_t::schema() const
+{
+	/* FNV-1a */
+	std::uint32_t hash = 2166136261u;
+	auto add = [&hash](std::size_t v)
+	{
+		hash = (hash ^ static_cast<std::uint32_t>(v)) * 16777619u;
+	};
+
+	for (auto const & s : m_save)
+	{
+		for (const char *p = s->m_name.c_str(); *p != 0; p++)
+			add(static_cast<unsigned char>(*p));
+		add(s->m_dt.size);
+		add(s->m_count);
+	}
+	return hash;
+}
+
+void state_manager_t::pack(void *buffer) const
+{
+	char *p = static_cast<char *>(buffer);
+	for (auto const & s : m_save)
+	{
+		const std::size_t sz = s->m_dt.size * s->m_count;
+		std::memcpy(p, s->m_ptr, sz);
+		p += sz;
+	}
+}
+
+void state_manager_t::unpack(const void *buffer)
+{
+	const char *p = static_cast<const char *>(buffer);
+	for (auto const & s : m_save)
+	{
+		const std::size_t sz = s->m_dt.size * s->m_count;
+		std::memcpy(s->m_ptr, p, sz);
+		p += sz;
+	}
+}
+
 void state_manager_t::pre_save()
 {
 	for (auto & s : m_custom)
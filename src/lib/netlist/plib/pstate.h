@@ -13,6 +13,7 @@
 
 #include <vector>
 #include <memory>
+#include <cstdint>
 
 // ----------------------------------------------------------------------------------------
 // state saving ...
@@ -112,6 +113,15 @@ public:
 
 	const entry_t::list_t &save_list() const { return m_save; }
 
+	/* All items of save_list() copied into one contiguous buffer, in list
+	 * order. schema() is a hash of the names and sizes of the items and
+	 * identifies the layout of the buffer.
+	 */
+	std::size_t packed_size() const;
+	std::uint32_t schema() const;
+	void pack(void *buffer) const;
+	void unpack(const void *buffer);
+
 	void save_state_ptr(const void *owner, const pstring &stname, const datatype_t dt, const std::size_t count, void *ptr);
 
 protected:
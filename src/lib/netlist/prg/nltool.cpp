@@ -23,7 +23,7 @@ public:
 	tool_app_t() :
 		plib::app(),
 		opt_grp1(*this,     "General options",              "The following options apply to all commands."),
-		opt_cmd (*this,     "c", "cmd",         "run",      "run:convert:listdevices:static:header:docheader", "run|convert|listdevices|static|header"),
+		opt_cmd (*this,     "c", "cmd",         "run",      "run:convert:listdevices:static:bench:header:docheader", "run|convert|listdevices|static|bench|header|docheader"),
 		opt_file(*this,     "f", "file",        "-",        "file to process (default is stdin)"),
 		opt_defines(*this,  "D", "define",                  "predefine value as macro, e.g. -Dname=value. If '=value' is omitted predefine it as 1. This option may be specified repeatedly."),
 		opt_rfolders(*this, "r", "rom",                     "where to look for data files"),
@@ -31,21 +31,30 @@ public:
 		opt_quiet(*this,    "q", "quiet",                   "be quiet - no warnings"),
 		opt_version(*this,  "",  "version",                 "display version and exit"),
 		opt_help(*this,     "h", "help",                    "display help and exit"),
-		opt_grp2(*this,     "Options for run and static commands",   "These options apply to run and static commands."),
+		opt_grp2(*this,     "Options for run, static and bench commands",   "These options apply to run, static and bench commands."),
 		opt_name(*this,     "n", "name",        "",         "the netlist in file specified by ""-f"" option to run; default is first one"),
-		opt_grp3(*this,     "Options for run command",      "These options are only used by the run command."),
+		opt_grp3(*this,     "Options for run and bench commands",      "These options are only used by the run and bench commands."),
 		opt_ttr (*this,     "t", "time_to_run", 1.0,        "time to run the emulation (seconds)"),
 		opt_logs(*this,     "l", "log" ,                    "define terminal to log. This option may be specified repeatedly."),
 		opt_inp(*this,      "i", "input",       "",         "input file to process (default is none)"),
 		opt_loadstate(*this,"",  "loadstate",	"",			"load state from file and continue from there"),
 		opt_savestate(*this,"",  "savestate",	"",			"save state to file at end of run"),
+		opt_stats(*this,    "s", "stats",                   "print event queue statistics at end of run (needs NL_KEEP_STATISTICS)"),
 		opt_grp4(*this,     "Options for convert command",  "These options are only used by the convert command."),
 		opt_type(*this,     "y", "type",        "spice",    "spice:eagle:rinf", "type of file to be converted: spice,eagle,rinf"),
+		opt_grp5(*this,     "Options for static and bench commands",   "These options are only used by the static and bench commands."),
+		opt_add(*this,      "a", "add",                     "also process the first netlist in this file. This option may be specified repeatedly."),
+		opt_grp6(*this,     "Options for bench command",    "These options are only used by the bench command."),
+		opt_baseline(*this, "b", "baseline",    "",         "compare with the results of an earlier bench run in this file"),
 
 		opt_ex1(*this,     "nltool -c run -t 3.5 -f nl_examples/cdelay.c -n cap_delay",
 				"Run netlist \"cap_delay\" from file nl_examples/cdelay.c for 3.5 seconds"),
 		opt_ex2(*this,     "nltool --cmd=listdevices",
-				"List all known devices.")
+				"List all known devices."),
+		opt_ex3(*this,     "nltool -c static -f nl_pong.cpp -a nl_stuntcyc.cpp >generated/static_solvers.cpp",
+				"Compile the solvers of both netlists into the netlist library"),
+		opt_ex4(*this,     "nltool -c bench -t 2 -f a.c -a b.c -b base.json >new.json",
+				"Run both netlists for 2 seconds and compare with an earlier run")
 		{}
 
 	plib::option_group  opt_grp1;
@@ -65,10 +74,17 @@ public:
 	plib::option_str    opt_inp;
 	plib::option_str    opt_loadstate;
 	plib::option_str    opt_savestate;
+	plib::option_bool   opt_stats;
 	plib::option_group  opt_grp4;
 	plib::option_str_limit opt_type;
+	plib::option_group  opt_grp5;
+	plib::option_vec    opt_add;
+	plib::option_group  opt_grp6;
+	plib::option_str    opt_baseline;
 	plib::option_example opt_ex1;
 	plib::option_example opt_ex2;
+	plib::option_example opt_ex3;
+	plib::option_example opt_ex4;
 
 	int execute();
 	pstring usage();
@@ -76,6 +92,7 @@ public:
 private:
 	void run();
 	void static_compile();
+	int bench();
 
 	void mac_out(const pstring s, const bool cont = true);
 	void cmac(const netlist::factory::element_t *e);
@@ -186,45 +203,17 @@ public:
 	std::vector<char> save_state()
 	{
 		state().pre_save();
-		std::size_t size = 0;
-		for (auto const & s : state().save_list())
-			size += s->m_dt.size * s->m_count;
-
-		std::vector<char> buf(size);
-		char *p = buf.data();
-
-		for (auto const & s : state().save_list())
-		{
-			std::size_t sz = s->m_dt.size * s->m_count;
-			if (s->m_dt.is_float || s->m_dt.is_integral)
-				std::copy((char *)s->m_ptr, (char *) s->m_ptr + sz, p);
-			else
-				log().fatal("found unsupported save element {1}\n", s->m_name);
-			p += sz;
-		}
+		std::vector<char> buf(state().packed_size());
+		state().pack(buf.data());
 		return buf;
 	}
 
 	void load_state(std::vector<char> &buf)
 	{
-		std::size_t size = 0;
-		for (auto const & s : state().save_list())
-			size += s->m_dt.size * s->m_count;
-
-		if (buf.size() != size)
+		if (buf.size() != state().packed_size())
 			throw netlist::nl_exception("Size different during load state.");
 
-		char *p = buf.data();
-
-		for (auto const & s : state().save_list())
-		{
-			std::size_t sz = s->m_dt.size * s->m_count;
-			if (s->m_dt.is_float || s->m_dt.is_integral)
-				std::copy(p, p + sz, (char *) s->m_ptr);
-			else
-				log().fatal("found unsupported save element {1}\n", s->m_name);
-			p += sz;
-		}
+		state().unpack(buf.data());
 		state().post_load();
 		rebuild_lists();
 	}
@@ -337,6 +326,10 @@ void tool_app_t::run()
 	{
 		plib::pifilestream strm(opt_loadstate());
 		plib::pbinary_reader reader(strm);
+		std::uint32_t schema = 0;
+		reader.read(schema);
+		if (schema != nt.state().schema())
+			throw netlist::nl_exception("State file was saved from a different netlist.");
 		std::vector<char> loadstate;
 		reader.read(loadstate);
 		nt.load_state(loadstate);
@@ -373,8 +366,23 @@ void tool_app_t::run()
 		auto savestate = nt.save_state();
 		plib::pofilestream strm(opt_savestate());
 		plib::pbinary_writer writer(strm);
+		writer.write(nt.state().schema());
 		writer.write(savestate);
 	}
+
+	if (opt_stats())
+	{
+		const auto &q = nt.queue();
+		if (!netlist::nperfcount_t::enabled)
+			pout("queue statistics not available, build with NL_KEEP_STATISTICS=1\n");
+		else if (q.m_prof_call() > 0)
+		{
+			pout("queue pushes           {1:12}\n", q.m_prof_call());
+			pout("average queue depth    {1:12.2f}\n", static_cast<double>(q.m_prof_depth()) / static_cast<double>(q.m_prof_call()));
+			pout("average moves per push {1:12.2f}\n", static_cast<double>(q.m_prof_sortmove()) / static_cast<double>(q.m_prof_call()));
+		}
+	}
+
 	nt.stop();
 
 	t.stop();
@@ -387,29 +395,171 @@ void tool_app_t::run()
 
 void tool_app_t::static_compile()
 {
-	netlist_tool_t nt("netlist");
+	std::map<pstring, pstring> mp;
 
-	nt.init();
+	std::vector<std::pair<pstring, pstring>> netlists;
+	netlists.push_back(std::make_pair(opt_file(), opt_name()));
+	for (auto &f : opt_add())
+		netlists.push_back(std::make_pair(f, pstring("")));
 
-	nt.log().verbose.set_enabled(false);
-	nt.log().warning.set_enabled(false);
+	for (auto &n : netlists)
+	{
+		netlist_tool_t nt("netlist");
 
-	nt.read_netlist(opt_file(), opt_name(),
-			opt_logs(),
-			opt_defines(), opt_rfolders());
+		nt.init();
 
+		nt.log().verbose.set_enabled(false);
+		nt.log().warning.set_enabled(false);
+
+		nt.read_netlist(n.first, n.second,
+				opt_logs(),
+				opt_defines(), opt_rfolders());
+
+		nt.solver()->create_solver_code(mp);
+
+		nt.stop();
+	}
+
+	/* emit a translation unit which can be linked into the netlist library */
 	plib::putf8_writer w(pout_strm);
-	std::map<pstring, pstring> mp;
 
-	nt.solver()->create_solver_code(mp);
+	w.write("// license:GPL-2.0+\n");
+	w.write("// copyright-holders:Couriersud\n");
+	w.write("/*\n * static_solvers.cpp\n *\n * Generated by nltool -c static, do not edit.\n *\n */\n\n");
+	w.write("#include \"../nl_base.h\"\n\n");
+
+	for (auto &e : mp)
+		if (e.first != "")
+		{
+			w.write(e.second);
+			w.write("\n");
+		}
 
+	w.write("namespace netlist\n{\n\n");
+	w.write("const plib::dynlib_static_sym static_solver_syms[] =\n{\n");
 	for (auto &e : mp)
+		if (e.first != "")
+			w.write(plib::pfmt("\t{ \"{1}\", reinterpret_cast<void *>(&{2}) },\n")(e.first)(e.first));
+	w.write("\t{ nullptr, nullptr }\n};\n\n");
+	w.write("} // namespace netlist\n");
+}
+
+/* extract a value written by bench() from one line of its output */
+static bool bench_value(const pstring &line, const pstring &key, pstring &val)
+{
+	const pstring k = "\"" + key + "\": ";
+	auto p = line.find(k);
+	if (p == line.end())
+		return false;
+	val = line.substr(p + k.len());
+	if (val.startsWith("\""))
+		val = val.substr(1);
+	auto e = val.begin();
+	while (e != val.end() && *e != ',' && *e != '"' && *e != '}')
+		++e;
+	val = val.left(e);
+	return true;
+}
+
+int tool_app_t::bench()
+{
+	/* wall time per simulated second of an earlier run, by file */
+	std::map<pstring, double> baseline;
+	if (opt_baseline() != "")
 	{
-		w.write(e.second);
+		plib::pifilestream f(opt_baseline());
+		plib::putf8_reader r(f);
+		pstring line;
+		while (r.readline(line))
+		{
+			pstring file, rate;
+			bool err = false;
+			if (bench_value(line, "file", file) && bench_value(line, "wall_per_sim_second", rate))
+				baseline[file] = rate.as_double(&err);
+		}
 	}
 
-	nt.stop();
+	std::vector<pstring> files;
+	files.push_back(opt_file());
+	for (auto &f : opt_add())
+		files.push_back(f);
+
+	const netlist::netlist_time ttr = netlist::netlist_time::from_double(opt_ttr());
+	int regressions = 0;
+
+	pout("{\n  \"sim_time\": {1:f},\n  \"netlists\": [\n", ttr.as_double());
+	for (std::size_t i = 0; i < files.size(); i++)
+	{
+		/* keep each netlist on one line, the baseline reader depends on it */
+		pstring entry = plib::pfmt("    {\"file\": \"{1}\"")(files[i]);
+		try
+		{
+			netlist_tool_t nt("netlist");
+
+			nt.init();
+			nt.log().verbose.set_enabled(false);
+			nt.log().warning.set_enabled(false);
+
+			nt.read_netlist(files[i], (i == 0) ? opt_name() : pstring(""),
+					opt_logs(),
+					opt_defines(), opt_rfolders());
 
+			plib::chrono::timer<plib::chrono::system_ticks> t;
+			t.start();
+			nt.process_queue(ttr);
+			t.stop();
+
+			/* only solvers with dynamic devices run newton raphson loops */
+			std::uint_least64_t calculations = 0, nr = 0, retries = 0, fails = 0;
+			if (nt.solver() != nullptr)
+				for (auto &s : nt.solver()->solvers())
+				{
+					calculations += static_cast<std::uint_least64_t>(s->stat_calculations());
+					fails += static_cast<std::uint_least64_t>(s->stat_iterative_fail());
+					if (s->has_dynamic_devices())
+					{
+						nr += static_cast<std::uint_least64_t>(s->stat_newton_raphson());
+						retries += static_cast<std::uint_least64_t>(s->stat_newton_raphson() - s->stat_vsolver_calls());
+					}
+				}
+
+			const double rate = t.as_seconds() / ttr.as_double();
+			entry += plib::pfmt(", \"wall_time\": {1:f}, \"wall_per_sim_second\": {2:f}")(t.as_seconds())(rate);
+			entry += plib::pfmt(", \"solver_calls\": {1}, \"newton_raphson_loops\": {2}, \"newton_raphson_retries\": {3}, \"iterative_fails\": {4}")
+				(calculations)(nr)(retries)(fails);
+			if (netlist::nperfcount_t::enabled)
+				entry += plib::pfmt(", \"queue_pushes\": {1}")(nt.queue().m_prof_call());
+			else
+				entry += ", \"queue_pushes\": null";
+
+			auto b = baseline.find(files[i]);
+			if (b != baseline.end() && b->second > 0.0)
+			{
+				const double ratio = rate / b->second;
+				const bool regression = ratio > 1.1;
+				entry += plib::pfmt(", \"baseline_wall_per_sim_second\": {1:f}, \"ratio\": {2:.3f}, \"regression\": {3}")
+					(b->second)(ratio)(regression ? "true" : "false");
+				if (regression)
+					regressions++;
+			}
+
+			nt.stop();
+		}
+		catch (plib::pexception &e)
+		{
+			/* no quotes or control characters in json strings */
+			pstring text;
+			for (auto c : e.text())
+				text += (c == '"') ? '\'' : (c < ' ') ? ' ' : c;
+			entry += plib::pfmt(", \"error\": \"{1}\"")(text.trim());
+		}
+		pout("{1}}{2}\n", entry, (i + 1 < files.size()) ? "," : "");
+	}
+	pout("  ]\n}\n");
+
+	if (regressions > 0)
+		perr("{1} netlists are more than 10% slower than the baseline\n", regressions);
+	return (regressions > 0) ? 1 : 0;
 }
 
 void tool_app_t::mac_out(const pstring s, const bool cont)
@@ -700,6 +850,7 @@ int tool_app_t::execute()
 		return 0;
 	}
 
+	int ret = 0;
 	try
 	{
 		pstring cmd = opt_cmd();
@@ -709,6 +860,8 @@ int tool_app_t::execute()
 			run();
 		else if (cmd == "static")
 			static_compile();
+		else if (cmd == "bench")
+			ret = bench();
 		else if (cmd == "header")
 			create_header();
 		else if (cmd == "docheader")
@@ -769,7 +922,7 @@ int tool_app_t::execute()
 	}
 
 	pstring::resetmem();
-	return 0;
+	return ret;
 }
 
 PMAIN(tool_app_t)
@@ -8,6 +8,7 @@
 #include "nld_matrix_solver.h"
 #include "../plib/putil.h"
 
+#include <algorithm>
 #include <cmath>  // <<= needed by windows build
 
 namespace netlist
@@ -24,6 +25,11 @@ terms_for_net_t::terms_for_net_t()
 	, m_last_V(0.0)
 	, m_DD_n_m_1(0.0)
 	, m_h_n_m_1(1e-9)
+	, m_net_idx(nullptr)
+	, m_go(nullptr)
+	, m_gt(nullptr)
+	, m_Idr(nullptr)
+	, m_connected_net_V(nullptr)
 {
 }
 
@@ -31,10 +37,7 @@ void terms_for_net_t::clear()
 {
 	m_terms.clear();
 	m_connected_net_idx.clear();
-	m_gt.clear();
-	m_go.clear();
-	m_Idr.clear();
-	m_connected_net_V.clear();
+	m_net_idx = m_connected_net_idx.data();
 }
 
 void terms_for_net_t::add(terminal_t *term, int net_other, bool sorted)
@@ -46,25 +49,31 @@ void terms_for_net_t::add(terminal_t *term, int net_other, bool sorted)
 			{
 				plib::container::insert_at(m_terms, i, term);
 				plib::container::insert_at(m_connected_net_idx, i, net_other);
-				plib::container::insert_at(m_gt, i, 0.0);
-				plib::container::insert_at(m_go, i, 0.0);
-				plib::container::insert_at(m_Idr, i, 0.0);
-				plib::container::insert_at(m_connected_net_V, i, nullptr);
+				m_net_idx = m_connected_net_idx.data();
 				return;
 			}
 		}
 	m_terms.push_back(term);
 	m_connected_net_idx.push_back(net_other);
-	m_gt.push_back(0.0);
-	m_go.push_back(0.0);
-	m_Idr.push_back(0.0);
-	m_connected_net_V.push_back(nullptr);
+	m_net_idx = m_connected_net_idx.data();
 }
 
-void terms_for_net_t::set_pointers()
+void terms_for_net_t::set_pointers(nl_double *values, nl_double **net_V, int *net_idx)
 {
-	for (unsigned i = 0; i < count(); i++)
+	const std::size_t n = count();
+
+	m_gt = values;
+	m_go = values + n;
+	m_Idr = values + 2 * n;
+	m_connected_net_V = net_V;
+	std::copy(m_net_idx, m_net_idx + n, net_idx);
+	m_net_idx = net_idx;
+	m_connected_net_idx.clear();
+	m_connected_net_idx.shrink_to_fit();
+
+	for (std::size_t i = 0; i < n; i++)
 	{
+		m_gt[i] = m_go[i] = m_Idr[i] = 0.0;
 		m_terms[i]->set_ptrs(&m_gt[i], &m_go[i], &m_Idr[i]);
 		m_connected_net_V[i] = m_terms[i]->m_otherterm->net().Q_Analog_state_ptr();
 	}
@@ -83,7 +92,11 @@ matrix_solver_t::matrix_solver_t(netlist_t &anetlist, const pstring &name,
 	, m_stat_vsolver_calls(*this, "m_stat_vsolver_calls", 0)
 	, m_iterative_fail(*this, "m_iterative_fail", 0)
 	, m_iterative_total(*this, "m_iterative_total", 0)
+	, m_stat_ts_backoff(*this, "m_stat_ts_backoff", 0)
 	, m_last_step(*this, "m_last_step", netlist_time::zero())
+	, m_last_ts(*this, "m_last_ts", 0.0)
+	, m_ts_shrinking(false)
+	, m_newton_failed(false)
 	, m_fb_sync(*this, "FB_sync")
 	, m_Q_sync(*this, "Q_sync")
 	, m_sort(sort)
@@ -184,7 +197,6 @@ void matrix_solver_t::setup_matrix()
 			this->m_terms[k]->add(m_rails_temp[k]->terms()[i], m_rails_temp[k]->connected_net_idx()[i], false);
 
 		m_rails_temp[k]->clear(); // no longer needed
-		m_terms[k]->set_pointers();
 	}
 
 	for (unsigned k = 0; k < iN; k++)
@@ -212,7 +224,9 @@ void matrix_solver_t::setup_matrix()
 	 *
 	 */
 
-	if (m_sort != NOSORT)
+	if (m_sort == MIN_DEGREE)
+		sort_min_degree();
+	else if (m_sort != NOSORT)
 	{
 		int sort_order = (m_sort == DESCENDING ? 1 : -1);
 
@@ -225,7 +239,10 @@ void matrix_solver_t::setup_matrix()
 					std::swap(m_nets[i], m_nets[k]);
 				}
 			}
+	}
 
+	if (m_sort != NOSORT)
+	{
 		for (unsigned k = 0; k < iN; k++)
 		{
 			int *other = m_terms[k]->connected_net_idx();
@@ -235,6 +252,8 @@ void matrix_solver_t::setup_matrix()
 		}
 	}
 
+	relocate_terms();
+
 	/* create a list of non zero elements. */
 	for (unsigned k = 0; k < iN; k++)
 	{
@@ -354,8 +373,113 @@ void matrix_solver_t::setup_matrix()
 	plib::pfree_array(touched);
 }
 
+/* Place the term data of all nets next to each other, in the order the
+ * matrix rows are processed. Devices write their conductances into these
+ * arrays through the pointers set in their terminals.
+ */
+
+void matrix_solver_t::relocate_terms()
+{
+	std::size_t total = 0;
+	for (auto &t : m_terms)
+		total += t->count();
+
+	m_term_values.assign(3 * total, 0.0);
+	m_term_net_V.assign(total, nullptr);
+	m_term_net_idx.assign(total, 0);
+
+	std::size_t offset = 0;
+	for (auto &t : m_terms)
+	{
+		t->set_pointers(m_term_values.data() + 3 * offset, m_term_net_V.data() + offset, m_term_net_idx.data() + offset);
+		offset += t->count();
+	}
+}
+
+/* Minimum degree ordering on the elimination graph of the matrix.
+ *
+ * Gaussian elimination of node k connects all remaining neighbours of k with
+ * each other. Eliminating the node with the fewest remaining neighbours first
+ * keeps this fill-in small. The resulting order is computed once here; the
+ * solvers then reuse the symbolic pattern for every numeric factorization.
+ *
+ * Ties are broken by the current position, so the ordering is deterministic.
+ */
+
+void matrix_solver_t::sort_min_degree()
+{
+	const std::size_t iN = m_nets.size();
+
+	std::vector<std::vector<bool>> adj(iN, std::vector<bool>(iN, false));
+	for (std::size_t k = 0; k < iN; k++)
+	{
+		int *other = m_terms[k]->connected_net_idx();
+		for (std::size_t i = 0; i < m_terms[k]->m_railstart; i++)
+			if (other[i] >= 0 && static_cast<std::size_t>(other[i]) != k)
+			{
+				adj[k][static_cast<std::size_t>(other[i])] = true;
+				adj[static_cast<std::size_t>(other[i])][k] = true;
+			}
+	}
+
+	std::vector<std::size_t> order;
+	std::vector<bool> eliminated(iN, false);
+	std::vector<std::size_t> degree(iN, 0);
+	for (std::size_t k = 0; k < iN; k++)
+		for (std::size_t j = 0; j < iN; j++)
+			if (adj[k][j])
+				degree[k]++;
+
+	for (std::size_t step = 0; step < iN; step++)
+	{
+		std::size_t p = iN;
+		for (std::size_t k = 0; k < iN; k++)
+			if (!eliminated[k] && (p == iN || degree[k] < degree[p]))
+				p = k;
+
+		order.push_back(p);
+		eliminated[p] = true;
+
+		/* remaining neighbours of p form a clique after elimination */
+		for (std::size_t i = 0; i < iN; i++)
+		{
+			if (eliminated[i] || !adj[p][i])
+				continue;
+			adj[i][p] = false;
+			degree[i]--;
+			for (std::size_t j = 0; j < iN; j++)
+				if (j != i && !eliminated[j] && adj[p][j] && !adj[i][j])
+				{
+					adj[i][j] = true;
+					degree[i]++;
+				}
+		}
+	}
+
+	std::vector<std::unique_ptr<terms_for_net_t>> terms(iN);
+	std::vector<analog_net_t *> nets(iN);
+	for (std::size_t k = 0; k < iN; k++)
+	{
+		terms[k] = std::move(m_terms[order[k]]);
+		nets[k] = m_nets[order[k]];
+	}
+	m_terms = std::move(terms);
+	m_nets = std::move(nets);
+}
+
 void matrix_solver_t::update_inputs()
 {
+	/* solve_base may have run on another thread, so the queue is only
+	 * touched from here
+	 */
+	if (m_newton_failed && !m_Q_sync.net().is_queued())
+	{
+		log().warning(MW_1_NEWTON_LOOPS_EXCEEDED_ON_NET_1, this->name());
+		m_Q_sync.net().toggle_new_Q();
+		m_Q_sync.net().reschedule_in_queue(m_params.m_nr_recalc_delay);
+	}
+	m_newton_failed = false;
+
 	// avoid recursive calls. Inputs are updated outside this call
 	for (auto &inp : m_inps)
 		inp->push(inp->m_proxied_net->Q_Analog());
@@ -371,6 +495,7 @@ void matrix_solver_t::update_dynamic()
 void matrix_solver_t::reset()
 {
 	m_last_step = netlist_time::zero();
+	m_last_ts = m_params.m_min_timestep;
 }
 
 void matrix_solver_t::update() NL_NOEXCEPT
@@ -382,6 +507,13 @@ void matrix_solver_t::update() NL_NOEXCEPT
 	{
 		m_Q_sync.net().force_queue_execution();
 		m_Q_sync.net().reschedule_in_queue(new_timestep);
+
+		/* A transient starts here. Solvers driven by our inputs would
+		 * otherwise only notice at their next - possibly much later - step.
+		 */
+		if (m_ts_shrinking)
+			for (auto &s : m_coupled)
+				s->limit_timestep(new_timestep);
 	}
 }
 
@@ -394,6 +526,40 @@ void matrix_solver_t::update_forced()
 	{
 		m_Q_sync.net().force_queue_execution();
 		m_Q_sync.net().reschedule_in_queue(netlist_time::from_double(m_params.m_min_timestep));
+		m_last_ts = m_params.m_min_timestep;
+	}
+}
+
+void matrix_solver_t::setup_coupling(const std::vector<std::unique_ptr<matrix_solver_t>> &solvers)
+{
+	m_coupled.clear();
+	for (auto &inp : m_inps)
+		for (auto &term : inp->net().m_core_terms)
+			for (auto &s : solvers)
+				if (s.get() != this && s->has_device(term->device()))
+					if (!plib::container::contains(m_coupled, s.get()))
+						m_coupled.push_back(s.get());
+}
+
+bool matrix_solver_t::has_device(const core_device_t &dev) const
+{
+	for (auto &t : m_terms)
+		for (std::size_t i = 0; i < t->count(); i++)
+			if (&t->terms()[i]->device() == &dev)
+				return true;
+	return false;
+}
+
+void matrix_solver_t::limit_timestep(const netlist_time &ts)
+{
+	if (!has_timestep_devices())
+		return;
+
+	m_last_ts = std::min(static_cast<nl_double>(m_last_ts), ts.as_double());
+	if (m_Q_sync.net().is_queued() && m_Q_sync.net().time() > netlist().time() + ts)
+	{
+		m_Q_sync.net().force_queue_execution();
+		m_Q_sync.net().reschedule_in_queue(ts);
 	}
 }
 
@@ -420,13 +586,8 @@ void matrix_solver_t::solve_base()
 		} while (this_resched > 1 && newton_loops < m_params.m_nr_loops);
 
 		m_stat_newton_raphson += newton_loops;
-		// reschedule ....
-		if (this_resched > 1 && !m_Q_sync.net().is_queued())
-		{
-			log().warning(MW_1_NEWTON_LOOPS_EXCEEDED_ON_NET_1, this->name());
-			m_Q_sync.net().toggle_new_Q();
-			m_Q_sync.net().reschedule_in_queue(m_params.m_nr_recalc_delay);
-		}
+		// reschedule in update_inputs ....
+		m_newton_failed = this_resched > 1;
 	}
 	else
 	{
@@ -513,11 +674,26 @@ netlist_time matrix_solver_t::compute_next_timestep(const double cur_ts)
 
 			t->m_last_V = n->Q_Analog();
 		}
+
+		/* The estimate above only looks back and may jump around. Optionally
+		 * limit how fast the step grows, and back off if the last step needed
+		 * more newton raphson loops than allowed.
+		 */
+		if (m_newton_failed)
+		{
+			new_solver_timestep = std::min(new_solver_timestep, m_params.m_ts_backoff * m_last_ts);
+			m_stat_ts_backoff++;
+		}
+		else if (m_params.m_ts_growth > 0.0)
+			new_solver_timestep = std::min(new_solver_timestep, m_params.m_ts_growth * m_last_ts);
+
 		if (new_solver_timestep < m_params.m_min_timestep)
 		{
 			//log().warning("Dynamic timestep below min timestep. Consider decreasing MIN_TIMESTEP: {1} us", new_solver_timestep*1.0e6);
 			new_solver_timestep = m_params.m_min_timestep;
 		}
+		m_ts_shrinking = new_solver_timestep < m_last_ts;
+		m_last_ts = new_solver_timestep;
 	}
 	//if (new_solver_timestep > 10.0 * hn)
 	//    new_solver_timestep = 10.0 * hn;
@@ -547,6 +723,8 @@ void matrix_solver_t::log_stats()
 				100.0 * static_cast<double>(this->m_iterative_fail)
 					/ static_cast<double>(this->m_stat_calculations),
 				static_cast<double>(this->m_iterative_total) / static_cast<double>(this->m_stat_calculations));
+		if (this->m_params.m_dynamic_ts)
+			log().verbose("       {1:10} time step backoffs, {2} coupled solvers", this->m_stat_ts_backoff, this->m_coupled.size());
 	}
 }
 
@@ -25,6 +25,8 @@ namespace netlist
 		nl_double m_dynamic_lte;
 		nl_double m_min_timestep;
 		nl_double m_max_timestep;
+		nl_double m_ts_growth;
+		nl_double m_ts_backoff;
 		nl_double m_gs_sor;
 		bool m_dynamic_ts;
 		unsigned m_gs_loops;
@@ -46,13 +48,16 @@ public:
 	inline std::size_t count() const { return m_terms.size(); }
 
 	inline terminal_t **terms() { return m_terms.data(); }
-	inline int *connected_net_idx() { return m_connected_net_idx.data(); }
-	inline nl_double *gt() { return m_gt.data(); }
-	inline nl_double *go() { return m_go.data(); }
-	inline nl_double *Idr() { return m_Idr.data(); }
-	inline nl_double * const *connected_net_V() const { return m_connected_net_V.data(); }
-
-	void set_pointers();
+	inline int *connected_net_idx() { return m_net_idx; }
+	inline nl_double *gt() { return m_gt; }
+	inline nl_double *go() { return m_go; }
+	inline nl_double *Idr() { return m_Idr; }
+	inline nl_double * const *connected_net_V() const { return m_connected_net_V; }
+
+	/* Move the per term data into storage provided by the solver.
+	 * values holds 3 * count() elements, net_V and net_idx count() each.
+	 */
+	void set_pointers(nl_double *values, nl_double **net_V, int *net_idx);
 
 	std::size_t m_railstart;
 
@@ -66,13 +71,14 @@ public:
 	nl_double m_h_n_m_1;
 
 private:
-	std::vector<int> m_connected_net_idx;
-	std::vector<nl_double> m_go;
-	std::vector<nl_double> m_gt;
-	std::vector<nl_double> m_Idr;
-	std::vector<nl_double *> m_connected_net_V;
 	std::vector<terminal_t *> m_terms;
+	std::vector<int> m_connected_net_idx; /* only used until set_pointers */
 
+	int *m_net_idx;
+	nl_double *m_go;
+	nl_double *m_gt;
+	nl_double *m_Idr;
+	nl_double **m_connected_net_V;
 };
 
 class proxied_analog_output_t : public analog_output_t
@@ -98,7 +104,8 @@ public:
 	{
 		NOSORT,
 		ASCENDING,
-		DESCENDING
+		DESCENDING,
+		MIN_DEGREE
 	};
 
 	matrix_solver_t(netlist_t &anetlist, const pstring &name,
@@ -120,8 +127,20 @@ public:
 	void update_inputs();
 
 	inline bool has_dynamic_devices() const { return m_dynamic_devices.size() > 0; }
+	inline std::size_t net_count() const { return m_nets.size(); }
 	inline bool has_timestep_devices() const { return m_step_devices.size() > 0; }
 
+	/* statistics */
+	inline int stat_calculations() const { return m_stat_calculations; }
+	inline int stat_newton_raphson() const { return m_stat_newton_raphson; }
+	inline int stat_vsolver_calls() const { return m_stat_vsolver_calls; }
+	inline int stat_iterative_fail() const { return m_iterative_fail; }
+
+	/* dynamic time step: find the solvers driven by our analog inputs */
+	void setup_coupling(const std::vector<std::unique_ptr<matrix_solver_t>> &solvers);
+	bool has_device(const core_device_t &dev) const;
+	void limit_timestep(const netlist_time &ts);
+
 	void update_forced();
 	void update_after(const netlist_time &after)
 	{
@@ -140,7 +159,7 @@ public:
 
 	virtual std::pair<pstring, pstring> create_solver_code()
 	{
-		return std::pair<pstring, pstring>("", plib::pfmt("/* {1} doesn't support static compile */"));
+		return std::pair<pstring, pstring>("", plib::pfmt("/* {1} doesn't support static compile */\n")(name()));
 	}
 
 protected:
@@ -177,10 +196,15 @@ protected:
 	state_var<int> m_stat_vsolver_calls;
 	state_var<int> m_iterative_fail;
 	state_var<int> m_iterative_total;
+	state_var<int> m_stat_ts_backoff;
 
 private:
 
 	state_var<netlist_time> m_last_step;
+	state_var<nl_double> m_last_ts;  /* last time step proposed by compute_next_timestep */
+	bool m_ts_shrinking;
+	bool m_newton_failed;
+	std::vector<matrix_solver_t *> m_coupled;
 	std::vector<core_device_t *> m_step_devices;
 	std::vector<core_device_t *> m_dynamic_devices;
 
@@ -189,10 +213,19 @@ private:
 
 	/* calculate matrix */
 	void setup_matrix();
+	void sort_min_degree();
+	void relocate_terms();
 
 	void step(const netlist_time &delta);
 
 	const eSortType m_sort;
+
+	/* Term data of all nets in matrix order. The build_LE loops walk
+	 * these front to back instead of chasing one allocation per net.
+	 */
+	std::vector<nl_double> m_term_values;
+	std::vector<nl_double *> m_term_net_V;
+	std::vector<int> m_term_net_idx;
 };
 
 template <typename T>
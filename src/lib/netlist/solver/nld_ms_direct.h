@@ -280,11 +280,18 @@ void matrix_solver_direct_t<m_N, storage_N>::LE_solve()
 			const auto &nzrd = m_terms[i]->m_nzrd;
 			const auto &nzbd = m_terms[i]->m_nzbd;
 
+			/* work on row pointers, so the compiler knows the rows don't
+			 * overlap and keeps the column list in registers
+			 */
+			const unsigned * RESTRICT const p = nzrd.data();
+			const std::size_t e = nzrd.size();
+			const nl_double * RESTRICT const Ai = &A(i,0);
 			for (std::size_t j : nzbd)
 			{
-				const nl_double f1 = -f * A(j,i);
-				for (std::size_t k : nzrd)
-					A(j,k) += A(i,k) * f1;
+				nl_double * RESTRICT const Aj = &A(j,0);
+				const nl_double f1 = -f * Aj[i];
+				for (std::size_t k = 0; k < e; k++)
+					Aj[p[k]] += Ai[p[k]] * f1;
 				//RHS(j) += RHS(i) * f1;
 			}
 #endif
@@ -363,15 +370,16 @@ void matrix_solver_direct_t<m_N, storage_N>::LE_back_subst(
 		{
 			T tmp = 0;
 
-			const auto *p = m_terms[j]->m_nzrd.data();
-			const auto e = m_terms[j]->m_nzrd.size() - 1; /* exclude RHS element */
+			const unsigned * RESTRICT const p = m_terms[j]->m_nzrd.data();
+			const std::size_t e = m_terms[j]->m_nzrd.size() - 1; /* exclude RHS element */
+			const nl_double * RESTRICT const Aj = &A(j,0);
 
 			for (std::size_t k = 0; k < e; k++)
 			{
 				const auto pk = p[k];
-				tmp += A(j,pk) * x[pk];
+				tmp += Aj[pk] * x[pk];
 			}
-			x[j] = (RHS(j) - tmp) / A(j,j);
+			x[j] = (RHS(j) - tmp) / Aj[j];
 		}
 	}
 }
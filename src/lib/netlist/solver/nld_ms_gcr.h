@@ -29,8 +29,9 @@ class matrix_solver_GCR_t: public matrix_solver_t
 public:
 
 	matrix_solver_GCR_t(netlist_t &anetlist, const pstring &name,
-			const solver_parameters_t *params, const std::size_t size)
-		: matrix_solver_t(anetlist, name, matrix_solver_t::ASCENDING, params)
+			const solver_parameters_t *params, const std::size_t size,
+			const eSortType sort = matrix_solver_t::ASCENDING)
+		: matrix_solver_t(anetlist, name, sort, params)
 		, m_dim(size)
 		, mat(size)
 		, m_proc(nullptr)
@@ -157,7 +158,7 @@ void matrix_solver_GCR_t<m_N, storage_N>::vsetup(analog_net_t::list_t &nets)
 		if (m_proc != nullptr)
 			this->log().verbose("External static solver {1} found ...", symname);
 		else
-			this->log().warning("External static solver {1} not found ...", symname);
+			this->log().verbose("External static solver {1} not found ...", symname);
 	}
 
 }
@@ -293,7 +294,7 @@ pstring matrix_solver_GCR_t<m_N, storage_N>::static_compile_name()
 	csc_private(w);
 	std::hash<pstring> h;
 
-	return plib::pfmt("nl_gcr_{1:x}_{2}")(h( t.str() ))(mat.nz_num);
+	return plib::pfmt("nl_gcr_{1}_{2}").x(h( t.str() ))(mat.nz_num);
 }
 
 template <std::size_t m_N, std::size_t storage_N>
@@ -31,14 +31,14 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>  // <<= needed by windows build
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #include "../nl_lists.h"
 
-#if HAS_OPENMP
-#include "omp.h"
-#endif
-
 #include "../nl_factory.h"
 
 #include "nld_solver.h"
@@ -65,6 +65,110 @@ namespace netlist
 
 
 
+// ----------------------------------------------------------------------------------------
+// solver_threads_t
+// ----------------------------------------------------------------------------------------
+
+/* Worker threads solving net groups in parallel. The groups due in a time
+ * step are handed over with start(), the calling thread helps out in
+ * finish() and returns once all of them are solved.
+ */
+
+class solver_threads_t
+{
+public:
+	explicit solver_threads_t(std::size_t count)
+	: m_work(nullptr), m_generation(0), m_next(0), m_done(0), m_sleeping(0), m_exit(false)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			m_threads.emplace_back(&solver_threads_t::worker, this);
+	}
+
+	~solver_threads_t()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_exit = true;
+		}
+		m_wake.notify_all();
+		for (auto &thr : m_threads)
+			thr.join();
+	}
+
+	void start(const std::vector<matrix_solver_t *> &solvers)
+	{
+		/* m_done is cleared first: a worker late from the last step may
+		 * already grab work as soon as m_next is reset
+		 */
+		m_done = 0;
+		m_work = &solvers;
+		m_next = 0;
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_generation++;
+		}
+		if (m_sleeping > 0)
+			m_wake.notify_all();
+	}
+
+	void finish()
+	{
+		const std::size_t count = m_work.load()->size();
+		run();
+		while (m_done.load() < count)
+			std::this_thread::yield();
+	}
+
+private:
+	void run()
+	{
+		while (true)
+		{
+			const std::size_t i = m_next++;
+			const std::vector<matrix_solver_t *> &work = *m_work.load();
+			if (i >= work.size())
+				break;
+			// Ignore return value
+			ATTR_UNUSED const netlist_time ts = work[i]->solve();
+			m_done++;
+		}
+	}
+
+	void worker()
+	{
+		unsigned seen = 0;
+		while (true)
+		{
+			/* time steps follow each other closely, so spin a while before sleeping */
+			for (int spins = 0; spins < SPIN_COUNT && m_generation.load() == seen && !m_exit; spins++)
+				std::this_thread::yield();
+			if (m_generation.load() == seen && !m_exit)
+			{
+				std::unique_lock<std::mutex> lock(m_lock);
+				m_sleeping++;
+				m_wake.wait(lock, [this, seen] { return m_exit || m_generation.load() != seen; });
+				m_sleeping--;
+			}
+			if (m_exit)
+				return;
+			seen = m_generation.load();
+			run();
+		}
+	}
+
+	static constexpr int SPIN_COUNT = 1000;
+
+	std::vector<std::thread> m_threads;
+	std::mutex m_lock;
+	std::condition_variable m_wake;
+	std::atomic<const std::vector<matrix_solver_t *> *> m_work;
+	std::atomic<unsigned> m_generation;
+	std::atomic<std::size_t> m_next;
+	std::atomic<std::size_t> m_done;
+	std::atomic<int> m_sleeping;
+	std::atomic<bool> m_exit;
+};
+
 // ----------------------------------------------------------------------------------------
 // solver
 // ----------------------------------------------------------------------------------------
@@ -94,44 +198,41 @@ NETLIB_UPDATE(solver)
 	/* FIXME: Needs a more elegant solution */
 	bool force_solve = (netlist().time() < netlist_time::from_double(2 * m_params.m_max_timestep));
 
-#if HAS_OPENMP && USE_OPENMP
-	const std::size_t t_cnt = m_mat_solvers.size();
-	if (m_parallel())
+	if (m_threads)
 	{
-		//omp_set_num_threads(3);
-		//omp_set_dynamic(0);
-		#pragma omp parallel
-		{
-			#pragma omp for
-			for (int i = 0; i <  t_cnt; i++)
-				if (m_mat_solvers[i]->has_timestep_devices() || force_solve)
-				{
-					// Ignore return value
-					ATTR_UNUSED const netlist_time ts = m_mat_solvers[i]->solve();
-				}
-		}
+		/* big groups go to the threads, small ones are solved here meanwhile.
+		 * Inputs are only updated once everything is solved since that
+		 * touches the queue.
+		 */
+		const std::size_t min_nets = static_cast<std::size_t>(m_parallel_min());
+		m_parallel_due.clear();
+		for (auto & solver : m_mat_solvers)
+			if ((solver->has_timestep_devices() || force_solve) && solver->net_count() >= min_nets)
+				m_parallel_due.push_back(solver.get());
+		if (!m_parallel_due.empty())
+			m_threads->start(m_parallel_due);
+
+		for (auto & solver : m_mat_solvers)
+			if ((solver->has_timestep_devices() || force_solve) && solver->net_count() < min_nets)
+			{
+				// Ignore return value
+				ATTR_UNUSED const netlist_time ts = solver->solve();
+			}
+		if (!m_parallel_due.empty())
+			m_threads->finish();
 
 		for (auto & solver : m_mat_solvers)
 			if (solver->has_timestep_devices() || force_solve)
 				solver->update_inputs();
 	}
 	else
-		for (int i = 0; i < t_cnt; i++)
-			if (m_mat_solvers[i]->has_timestep_devices() || force_solve)
+		for (auto & solver : m_mat_solvers)
+			if (solver->has_timestep_devices() || force_solve)
 			{
 				// Ignore return value
-				ATTR_UNUSED const netlist_time ts = m_mat_solvers[i]->solve();
+				ATTR_UNUSED const netlist_time ts = solver->solve();
 				solver->update_inputs();
 			}
-#else
-	for (auto & solver : m_mat_solvers)
-		if (solver->has_timestep_devices() || force_solve)
-		{
-			// Ignore return value
-			ATTR_UNUSED const netlist_time ts = solver->solve();
-			solver->update_inputs();
-		}
-#endif
 
 	/* step circuit */
 	if (!m_Q_step.net().is_queued())
@@ -170,6 +271,12 @@ std::unique_ptr<matrix_solver_t> NETLIB_NAME(solver)::create_solver(std::size_t
 			return plib::make_unique<solver_mat>(netlist(), solvername, &m_params, size);
 		}
 	}
+	else if (pstring("MAT_CR_MD").equals(m_method()))
+	{
+		/* GCR with a minimum degree ordering to reduce fill-in on large nets */
+		typedef matrix_solver_GCR_t<m_N,storage_N> solver_mat;
+		return plib::make_unique<solver_mat>(netlist(), solvername, &m_params, size, matrix_solver_t::MIN_DEGREE);
+	}
 	else if (pstring("MAT").equals(m_method()))
 	{
 		typedef matrix_solver_direct_t<m_N,storage_N> solver_mat;
@@ -273,10 +380,14 @@ void NETLIB_NAME(solver)::post_start()
 	m_params.m_min_timestep = m_dynamic_min_ts();
 	m_params.m_dynamic_ts = (m_dynamic_ts() == 1 ? true : false);
 	m_params.m_max_timestep = netlist_time::from_double(1.0 / m_freq()).as_double();
+	m_params.m_ts_growth = m_dynamic_ts_growth();
+	m_params.m_ts_backoff = m_dynamic_ts_backoff();
 
 	if (m_params.m_dynamic_ts)
 	{
-		m_params.m_max_timestep *= 1;//NL_FCONST(1000.0);
+		/* steady state periods may be stepped over with larger steps */
+		if (m_dynamic_max_ts() > m_params.m_max_timestep)
+			m_params.m_max_timestep = m_dynamic_max_ts();
 	}
 	else
 	{
@@ -421,6 +532,17 @@ void NETLIB_NAME(solver)::post_start()
 
 		m_mat_solvers.push_back(std::move(ms));
 	}
+
+	if (m_params.m_dynamic_ts && m_dynamic_ts_coupled())
+		for (auto & s : m_mat_solvers)
+			s->setup_coupling(m_mat_solvers);
+
+	/* the thread calling update counts as one */
+	if (m_parallel() > 1 && !m_params.m_dynamic_ts)
+	{
+		log().verbose("Solving net groups of {1} or more nets on {2} threads", m_parallel_min(), m_parallel());
+		m_threads = plib::make_unique<solver_threads_t>(static_cast<std::size_t>(m_parallel() - 1));
+	}
 }
 
 void NETLIB_NAME(solver)::create_solver_code(std::map<pstring, pstring> &mp)
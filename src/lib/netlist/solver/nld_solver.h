@@ -9,6 +9,7 @@
 #define NLD_SOLVER_H_
 
 #include <map>
+#include <memory>
 
 #include "../nl_base.h"
 #include "../plib/pstream.h"
@@ -29,6 +30,7 @@ class NETLIB_NAME(solver);
 
 
 class matrix_solver_t;
+class solver_threads_t;
 
 NETLIB_OBJECT(solver)
 {
@@ -48,12 +50,17 @@ NETLIB_OBJECT(solver)
 	, m_pivot(*this, "PIVOT", 0)                    // use pivoting - on supported solvers
 	, m_nr_loops(*this, "NR_LOOPS", 250)            // Newton-Raphson loops
 	, m_nr_recalc_delay(*this, "NR_RECALC_DELAY", NLTIME_FROM_NS(10).as_double()) // Delay to next solve attempt if nr loops exceeded
-	, m_parallel(*this, "PARALLEL", 0)
+	, m_parallel(*this, "PARALLEL", 0)             // threads to solve net groups on, 0 or 1 for none
+	, m_parallel_min(*this, "PARALLEL_MIN", 8)      // nets a group needs to be worth solving on another thread
 
 	/* automatic time step */
 	, m_dynamic_ts(*this, "DYNAMIC_TS", 0)
 	, m_dynamic_lte(*this, "DYNAMIC_LTE", 1e-5)                     // diff/timestep
 	, m_dynamic_min_ts(*this, "DYNAMIC_MIN_TIMESTEP", 1e-6)   // nl_double timestep resolution
+	, m_dynamic_max_ts(*this, "DYNAMIC_MAX_TIMESTEP", 0.0)    // 0: 1 / FREQ
+	, m_dynamic_ts_growth(*this, "DYNAMIC_TS_GROWTH", 0.0)    // max. factor the time step may grow by per solve, 0 for no limit
+	, m_dynamic_ts_backoff(*this, "DYNAMIC_TS_BACKOFF", 0.5)  // time step factor after newton raphson failed
+	, m_dynamic_ts_coupled(*this, "DYNAMIC_TS_COUPLED", 0)    // shrinking time steps also apply to solvers driven by analog inputs
 
 	, m_log_stats(*this, "LOG_STATS", 1)   // nl_double timestep resolution
 	{
@@ -71,6 +78,8 @@ NETLIB_OBJECT(solver)
 
 	void create_solver_code(std::map<pstring, pstring> &mp);
 
+	const std::vector<std::unique_ptr<matrix_solver_t>> &solvers() const { return m_mat_solvers; }
+
 	NETLIB_UPDATEI();
 	NETLIB_RESETI();
 	// NETLIB_UPDATE_PARAMI();
@@ -89,9 +98,14 @@ protected:
 	param_int_t m_nr_loops;
 	param_double_t m_nr_recalc_delay;
 	param_int_t m_parallel;
+	param_int_t m_parallel_min;
 	param_logic_t  m_dynamic_ts;
 	param_double_t m_dynamic_lte;
 	param_double_t m_dynamic_min_ts;
+	param_double_t m_dynamic_max_ts;
+	param_double_t m_dynamic_ts_growth;
+	param_double_t m_dynamic_ts_backoff;
+	param_logic_t  m_dynamic_ts_coupled;
 
 	param_logic_t  m_log_stats;
 
@@ -100,6 +114,9 @@ private:
 
 	solver_parameters_t m_params;
 
+	std::unique_ptr<solver_threads_t> m_threads;
+	std::vector<matrix_solver_t *> m_parallel_due;
+
 	template <std::size_t m_N, std::size_t storage_N>
 	std::unique_ptr<matrix_solver_t> create_solver(std::size_t size, const pstring &solvername);
 };
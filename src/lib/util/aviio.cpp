@@ -463,6 +463,7 @@ public:
 
 	virtual error append_video_frame(bitmap_yuy16 &bitmap) override;
 	virtual error append_video_frame(bitmap_rgb32 &bitmap) override;
+	virtual error append_video_repeat() override;
 	virtual error append_sound_samples(int channel, std::int16_t const *samples, std::uint32_t numsamples, std::uint32_t sampleskip) override;
 
 	error read_movie_data();
@@ -1906,6 +1907,46 @@ avi_file::error avi_file_impl::append_video_frame(bitmap_rgb32 &bitmap)
 }
 
 
+/*-------------------------------------------------
+    avi_append_video_repeat - append an empty
+    video chunk, which players treat as a repeat
+    of the previous frame
+-------------------------------------------------*/
+
+/**
+ * @fn  avi_error avi_append_video_repeat(avi_file *file)
+ *
+ * @brief   Avi append video repeat.
+ *
+ * @return  An avi_error.
+ */
+
+avi_file::error avi_file_impl::append_video_repeat()
+{
+	avi_stream *const stream = get_video_stream();
+	error avierr;
+
+	/* write out any sound data first */
+	avierr = soundbuf_write_chunk(stream->chunks());
+	if (avierr != error::NONE)
+		return avierr;
+
+	/* write an empty chunk */
+	avierr = chunk_write(get_chunkid_for_stream(stream), nullptr, 0);
+	if (avierr != error::NONE)
+		return avierr;
+
+	/* set the info for this new chunk */
+	avierr = stream->set_chunk_info(stream->chunks(), m_writeoffs - 8, 8);
+	if (avierr != error::NONE)
+		return avierr;
+
+	stream->set_samples(m_info.video_numsamples = stream->chunks());
+
+	return error::NONE;
+}
+
+
 /*-------------------------------------------------
     avi_append_sound_samples - append sound
     samples
@@ -120,6 +120,7 @@ public:
 
 	virtual error append_video_frame(bitmap_yuy16 &bitmap) = 0;
 	virtual error append_video_frame(bitmap_rgb32 &bitmap) = 0;
+	virtual error append_video_repeat() = 0;
 	virtual error append_sound_samples(int channel, std::int16_t const *samples, std::uint32_t numsamples, std::uint32_t sampleskip) = 0;
 
 protected:
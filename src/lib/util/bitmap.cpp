@@ -26,7 +26,12 @@
 
 inline int32_t bitmap_t::compute_rowpixels(int width, int xslop)
 {
-	return width + 2 * xslop;
+	// aligned bitmaps round each row up to a whole number of alignment units
+	const int32_t rowpixels = width + 2 * xslop;
+	if (m_rowalign == 0)
+		return rowpixels;
+	const int32_t unit = m_rowalign * 8 / m_bpp;
+	return (rowpixels + unit - 1) & ~(unit - 1);
 }
 
 
@@ -37,7 +42,12 @@ inline int32_t bitmap_t::compute_rowpixels(int width, int xslop)
 
 inline void bitmap_t::compute_base(int xslop, int yslop)
 {
-	m_base = m_alloc.get() + (m_rowpixels * yslop + xslop) * (m_bpp / 8);
+	uint8_t *base = m_alloc.get() + (m_rowpixels * yslop + xslop) * (m_bpp / 8);
+
+	// the allocation has room to move pixel (0,0) up to the next aligned address
+	if (m_rowalign != 0)
+		base += -uintptr_t(base) & uintptr_t(m_rowalign - 1);
+	m_base = base;
 }
 
 
@@ -57,6 +67,8 @@ bitmap_t::bitmap_t(bitmap_t &&that)
 	, m_bpp(that.m_bpp)
 	, m_palette(nullptr)
 	, m_cliprect(that.m_cliprect)
+	, m_rowalign(that.m_rowalign)
+	, m_zerofill(that.m_zerofill)
 {
 	set_palette(that.m_palette);
 	that.reset();
@@ -83,6 +95,8 @@ bitmap_t::bitmap_t(bitmap_format format, uint8_t bpp, int width, int height, int
 	, m_format(format)
 	, m_bpp(bpp)
 	, m_palette(nullptr)
+	, m_rowalign(0)
+	, m_zerofill(true)
 {
 	// allocate intializes all other fields
 	allocate(width, height, xslop, yslop);
@@ -112,6 +126,8 @@ bitmap_t::bitmap_t(bitmap_format format, uint8_t bpp, void *base, int width, int
 	, m_bpp(bpp)
 	, m_palette(nullptr)
 	, m_cliprect(0, width - 1, 0, height - 1)
+	, m_rowalign(0)
+	, m_zerofill(true)
 {
 }
 
@@ -137,6 +153,8 @@ bitmap_t::bitmap_t(bitmap_format format, uint8_t bpp, bitmap_t &source, const re
 	, m_bpp(bpp)
 	, m_palette(nullptr)
 	, m_cliprect(0, subrect.width() - 1, 0, subrect.height() - 1)
+	, m_rowalign(0)
+	, m_zerofill(true)
 {
 	assert(format == source.m_format);
 	assert(bpp == source.m_bpp);
@@ -169,6 +187,8 @@ bitmap_t &bitmap_t::operator=(bitmap_t &&that)
 	m_bpp = that.m_bpp;
 	set_palette(that.m_palette);
 	m_cliprect = that.m_cliprect;
+	m_rowalign = that.m_rowalign;
+	m_zerofill = that.m_zerofill;
 	that.reset();
 	return *this;
 }
@@ -206,11 +226,12 @@ void bitmap_t::allocate(int width, int height, int xslop, int yslop)
 	m_cliprect.set(0, width - 1, 0, height - 1);
 
 	// allocate memory for the bitmap itself
-	m_allocbytes = m_rowpixels * (m_height + 2 * yslop) * m_bpp / 8;
+	m_allocbytes = m_rowpixels * (m_height + 2 * yslop) * m_bpp / 8 + m_rowalign;
 	m_alloc.reset(new uint8_t[m_allocbytes]);
 
-	// clear to 0 by default
-	memset(m_alloc.get(), 0, m_allocbytes);
+	// clear to 0 unless the owner will write every pixel anyway
+	if (m_zerofill)
+		memset(m_alloc.get(), 0, m_allocbytes);
 
 	// compute the base
 	compute_base(xslop, yslop);
@@ -241,7 +262,7 @@ void bitmap_t::resize(int width, int height, int xslop, int yslop)
 
 	// determine how much memory we need for the new bitmap
 	int new_rowpixels = compute_rowpixels(width, xslop);
-	uint32_t new_allocbytes = new_rowpixels * (height + 2 * yslop) * m_bpp / 8;
+	uint32_t new_allocbytes = new_rowpixels * (height + 2 * yslop) * m_bpp / 8 + m_rowalign;
 
 	// if we need more memory, just realloc
 	if (new_allocbytes > m_allocbytes)
@@ -132,6 +132,9 @@ protected:
 	bitmap_t &operator=(bitmap_t &&that);
 
 public:
+	// row alignment that keeps every row of an aligned bitmap on its own cache lines
+	static constexpr int CACHE_LINE_BYTES = 64;
+
 	// allocation/deallocation
 	void reset();
 
@@ -150,6 +153,12 @@ public:
 	void allocate(int width, int height, int xslop = 0, int yslop = 0);
 	void resize(int width, int height, int xslop = 0, int yslop = 0);
 
+	// allocation policy, applied by later calls to allocate and resize
+	void set_row_alignment(int bytes) { assert(bytes == 0 || (bytes >= 8 && !(bytes & (bytes - 1)))); m_rowalign = bytes; }
+	void set_zero_fill(bool zero) { m_zerofill = zero; }
+	int row_alignment() const { return m_rowalign; }
+	uint32_t allocated_bytes() const { return m_alloc ? m_allocbytes : 0; }
+
 	// operations
 	void set_palette(palette_t *palette);
 	void fill(uint32_t color) { fill(color, m_cliprect); }
@@ -186,6 +195,8 @@ private:
 	uint8_t                     m_bpp;          // bits per pixel
 	palette_t *                 m_palette;      // optional palette
 	rectangle                   m_cliprect;     // a clipping rectangle covering the full bitmap
+	int                         m_rowalign;     // byte alignment of pixel 0 of each row, or 0
+	bool                        m_zerofill;     // clear newly allocated memory
 };
 
 
@@ -330,7 +341,7 @@ public:
 	bitmap_ind16(uint16_t *base, int width, int height, int rowpixels) : bitmap16_t(k_bitmap_format, base, width, height, rowpixels) { }
 	bitmap_ind16(bitmap_ind16 &source, const rectangle &subrect) : bitmap16_t(k_bitmap_format, source, subrect) { }
 	void wrap(uint16_t *base, int width, int height, int rowpixels) { bitmap_t::wrap(base, width, height, rowpixels); }
-	void wrap(const bitmap_ind8 &source, const rectangle &subrect) { bitmap_t::wrap(static_cast<const bitmap_t &>(source), subrect); }
+	void wrap(const bitmap_ind16 &source, const rectangle &subrect) { bitmap_t::wrap(static_cast<const bitmap_t &>(source), subrect); }
 
 	// getters
 	bitmap_format format() const { return k_bitmap_format; }
@@ -350,7 +361,7 @@ public:
 	bitmap_ind32(uint32_t *base, int width, int height, int rowpixels) : bitmap32_t(k_bitmap_format, base, width, height, rowpixels) { }
 	bitmap_ind32(bitmap_ind32 &source, const rectangle &subrect) : bitmap32_t(k_bitmap_format, source, subrect) { }
 	void wrap(uint32_t *base, int width, int height, int rowpixels) { bitmap_t::wrap(base, width, height, rowpixels); }
-	void wrap(const bitmap_ind8 &source, const rectangle &subrect) { bitmap_t::wrap(static_cast<const bitmap_t &>(source), subrect); }
+	void wrap(const bitmap_ind32 &source, const rectangle &subrect) { bitmap_t::wrap(static_cast<const bitmap_t &>(source), subrect); }
 
 	// getters
 	bitmap_format format() const { return k_bitmap_format; }
@@ -370,7 +381,7 @@ public:
 	bitmap_ind64(uint64_t *base, int width, int height, int rowpixels) : bitmap64_t(k_bitmap_format, base, width, height, rowpixels) { }
 	bitmap_ind64(bitmap_ind64 &source, const rectangle &subrect) : bitmap64_t(k_bitmap_format, source, subrect) { }
 	void wrap(uint64_t *base, int width, int height, int rowpixels) { bitmap_t::wrap(base, width, height, rowpixels); }
-	void wrap(const bitmap_ind8 &source, const rectangle &subrect) { bitmap_t::wrap(static_cast<const bitmap_t &>(source), subrect); }
+	void wrap(const bitmap_ind64 &source, const rectangle &subrect) { bitmap_t::wrap(static_cast<const bitmap_t &>(source), subrect); }
 
 	// getters
 	bitmap_format format() const { return k_bitmap_format; }
@@ -38,8 +38,11 @@ public:
 	uint32_t flush();
 
 private:
+	// internal helpers
+	void refill();
+
 	// internal state
-	uint32_t          m_buffer;       // current bit accumulator
+	uint64_t          m_buffer;       // current bit accumulator
 	int             m_bits;         // number of bits in the accumulator
 	const uint8_t *   m_read;         // read pointer
 	uint32_t          m_doffset;      // byte offset within the data
@@ -102,18 +105,42 @@ inline uint32_t bitstream_in::peek(int numbits)
 
 	// fetch data if we need more
 	if (numbits > m_bits)
+		refill();
+
+	// return the data
+	return m_buffer >> (64 - numbits);
+}
+
+
+//-------------------------------------------------
+//  refill - top up the accumulator with as many
+//  whole bytes as will fit
+//-------------------------------------------------
+
+inline void bitstream_in::refill()
+{
+	// away from the end, load 8 bytes at once; any bits below the ones we count
+	// are the next bits of the stream, so ORing them in again later is harmless
+	if (m_doffset + 8 <= m_dlength)
 	{
-		while (m_bits <= 24)
-		{
-			if (m_doffset < m_dlength)
-				m_buffer |= m_read[m_doffset] << (24 - m_bits);
-			m_doffset++;
-			m_bits += 8;
-		}
+		const uint8_t *src = &m_read[m_doffset];
+		uint64_t word = (uint64_t(src[0]) << 56) | (uint64_t(src[1]) << 48) | (uint64_t(src[2]) << 40) | (uint64_t(src[3]) << 32) |
+				(uint64_t(src[4]) << 24) | (uint64_t(src[5]) << 16) | (uint64_t(src[6]) << 8) | uint64_t(src[7]);
+		int bytes = (64 - m_bits) >> 3;
+		m_buffer |= word >> m_bits;
+		m_doffset += bytes;
+		m_bits += bytes * 8;
+		return;
 	}
 
-	// return the data
-	return m_buffer >> (32 - numbits);
+	// near the end, fetch a byte at a time and pad with zeroes
+	while (m_bits <= 56)
+	{
+		if (m_doffset < m_dlength)
+			m_buffer |= uint64_t(m_read[m_doffset]) << (56 - m_bits);
+		m_doffset++;
+		m_bits += 8;
+	}
 }
 
 
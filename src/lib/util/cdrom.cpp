@@ -116,6 +116,10 @@ struct cdrom_file
 	chdcd_track_input_info track_info;      /* track info */
 	/** @brief  The fhandle[ CD maximum tracks]. */
 	util::core_file::ptr fhandle[CD_MAX_TRACKS];/* file handle */
+	/** @brief  The fmapped[ CD maximum tracks]. */
+	const uint8_t *     fmapped[CD_MAX_TRACKS]; /* file data mapped into memory, or nullptr */
+	/** @brief  The fmappedbytes[ CD maximum tracks]. */
+	uint64_t            fmappedbytes[CD_MAX_TRACKS]; /* number of bytes mapped */
 };
 
 
@@ -251,6 +255,12 @@ cdrom_file *cdrom_open(const char *inputfile)
 			cdrom_close(file);
 			return nullptr;
 		}
+
+		/* read straight from a mapping of the file where the OS supports it */
+		file->fmappedbytes[i] = 0;
+		file->fmapped[i] = reinterpret_cast<const uint8_t *>(file->fhandle[i]->mapped(file->fmappedbytes[i]));
+		if (file->fmapped[i] == nullptr)
+			file->fmappedbytes[i] = 0;
 	}
 	/* calculate the starting frame for each track, keeping in mind that CHDMAN
 	   pads tracks out with extra frames to fit 4-frame size boundries
@@ -483,8 +493,13 @@ chd_error read_partial_sector(cdrom_file *file, void *dest, uint32_t lbasector,
 
 		//  printf("Reading sector %d from track %d at offset %lld\n", chdsector, tracknum, sourcefileoffset);
 
-		srcfile.seek(sourcefileoffset, SEEK_SET);
-		srcfile.read(dest, length);
+		if (file->fmapped[tracknum] != nullptr && sourcefileoffset + length <= file->fmappedbytes[tracknum])
+			memcpy(dest, file->fmapped[tracknum] + sourcefileoffset, length);
+		else
+		{
+			srcfile.seek(sourcefileoffset, SEEK_SET);
+			srcfile.read(dest, length);
+		}
 
 		needswap = file->track_info.track[tracknum].swap;
 	}
@@ -289,10 +289,12 @@ inline uint8_t chd_file::bits_for_value(uint64_t value)
 
 chd_file::chd_file()
 	: m_file(nullptr),
-		m_owns_file(false)
+		m_owns_file(false),
+		m_readahead_queue(nullptr)
 {
 	// reset state
 	memset(m_decompressor, 0, sizeof(m_decompressor));
+	memset(m_readahead_decompressor, 0, sizeof(m_readahead_decompressor));
 	close();
 }
 
@@ -801,7 +803,12 @@ chd_error chd_file::open(util::core_file &file, bool writeable, chd_file *parent
 
 void chd_file::close()
 {
+	// stop any background decompression before the codecs go away
+	disable_read_ahead();
+
 	// reset file characteristics
+	m_mapped = nullptr;
+	m_mappedbytes = 0;
 	if (m_owns_file && m_file)
 		delete m_file;
 	m_file = nullptr;
@@ -870,6 +877,67 @@ void chd_file::close()
  */
 
 chd_error chd_file::read_hunk(uint32_t hunknum, void *buffer)
+{
+	// without read-ahead, just decompress the hunk
+	if (m_readahead_queue == nullptr || buffer == nullptr || hunknum >= m_hunkcount)
+		return read_hunk_direct(hunknum, buffer);
+
+	// check the cache first, waiting for the hunk if it's still being decompressed
+	uint8_t *dest = reinterpret_cast<uint8_t *>(buffer);
+	chd_error err = CHDERR_NONE;
+	readahead_entry *entry = readahead_find(hunknum);
+	if (entry != nullptr)
+	{
+		readahead_wait(*entry);
+		err = entry->m_error;
+		if (err == CHDERR_NONE)
+		{
+			memcpy(dest, &entry->m_data[0], m_hunkbytes);
+			entry->m_lastuse = ++m_readahead_clock;
+		}
+		else
+			entry->m_hunknum = ~0;
+	}
+
+	// otherwise decompress it here and keep a copy
+	if (entry == nullptr || err != CHDERR_NONE)
+	{
+		err = read_hunk_direct(hunknum, dest);
+		if (err != CHDERR_NONE)
+			return err;
+		entry = readahead_victim();
+		if (entry != nullptr)
+		{
+			entry->m_hunknum = hunknum;
+			entry->m_error = CHDERR_NONE;
+			entry->m_lastuse = ++m_readahead_clock;
+			memcpy(&entry->m_data[0], dest, m_hunkbytes);
+		}
+	}
+
+	// when reading sequentially, start on the hunks that will be wanted next
+	bool const sequential = (hunknum == m_readahead_last + 1);
+	m_readahead_last = hunknum;
+	if (sequential)
+		for (uint32_t ahead = 1; ahead <= m_readahead_hunks && hunknum + ahead < m_hunkcount; ahead++)
+			readahead_queue(hunknum + ahead);
+	return CHDERR_NONE;
+}
+
+/**
+ * @fn  chd_error chd_file::read_hunk_direct(uint32_t hunknum, void *buffer)
+ *
+ * @brief   -------------------------------------------------
+ *            read_hunk_direct - read and decompress a single hunk on the calling thread
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum         The hunknum.
+ * @param [in,out]  buffer  If non-null, the buffer.
+ *
+ * @return  The hunk.
+ */
+
+chd_error chd_file::read_hunk_direct(uint32_t hunknum, void *buffer)
 {
 	// wrap this for clean reporting
 	try
@@ -938,7 +1006,9 @@ chd_error chd_file::read_hunk(uint32_t hunknum, void *buffer)
 				if (!compressed())
 				{
 					blockoffs = uint64_t(be_read(rawmap, 4)) * uint64_t(m_hunkbytes);
-					if (blockoffs != 0)
+					if (blockoffs != 0 && m_mapped != nullptr && blockoffs + m_hunkbytes <= m_mappedbytes)
+						memcpy(dest, m_mapped + blockoffs, m_hunkbytes);
+					else if (blockoffs != 0)
 						file_read(blockoffs, dest, m_hunkbytes);
 					else if (m_parent_missing)
 						throw CHDERR_REQUIRES_PARENT;
@@ -995,6 +1065,239 @@ chd_error chd_file::read_hunk(uint32_t hunknum, void *buffer)
 	}
 }
 
+/**
+ * @fn  chd_error chd_file::enable_read_ahead(uint32_t cachehunks)
+ *
+ * @brief   -------------------------------------------------
+ *            enable_read_ahead - keep a cache of the given number of hunks, and when hunks
+ *            are read in sequence, decompress the next half of that many on another thread
+ *          -------------------------------------------------.
+ *
+ * @param   cachehunks  Number of hunks to cache, or 0 to disable read-ahead.
+ *
+ * @return  A chd_error.
+ */
+
+chd_error chd_file::enable_read_ahead(uint32_t cachehunks)
+{
+	disable_read_ahead();
+	if (cachehunks == 0)
+		return CHDERR_NONE;
+
+	// punt if no file
+	if (m_file == nullptr)
+		return CHDERR_NOT_OPEN;
+
+	// only read-only v5 compressed files are handled; A/V codecs are configured by the caller
+	if (m_allow_writes || m_version < 5 || !compressed())
+		return CHDERR_NOT_SUPPORTED;
+	for (auto & elem : m_compression)
+		if (elem == CHD_CODEC_AVHUFF)
+			return CHDERR_NOT_SUPPORTED;
+
+	// the queue gets its own codecs, since they keep state between hunks
+	for (int decompnum = 0; decompnum < ARRAY_LENGTH(m_compression); decompnum++)
+		m_readahead_decompressor[decompnum] = chd_codec_list::new_decompressor(m_compression[decompnum], *this);
+
+	// allocate the cache entries up front
+	m_readahead.resize(std::max<uint32_t>(cachehunks, 2));
+	for (auto & entry : m_readahead)
+	{
+		entry = std::make_unique<readahead_entry>();
+		entry->m_chd = this;
+		entry->m_data.resize(m_hunkbytes);
+		entry->m_compressed.reserve(m_hunkbytes);
+	}
+	m_readahead_hunks = m_readahead.size() / 2;
+	m_readahead_last = ~0;
+	m_readahead_clock = 0;
+
+	m_readahead_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	if (m_readahead_queue == nullptr)
+	{
+		disable_read_ahead();
+		return CHDERR_OUT_OF_MEMORY;
+	}
+	return CHDERR_NONE;
+}
+
+/**
+ * @fn  void chd_file::disable_read_ahead()
+ *
+ * @brief   -------------------------------------------------
+ *            disable_read_ahead - wait for background decompression to finish and free the
+ *            read-ahead cache
+ *          -------------------------------------------------.
+ */
+
+void chd_file::disable_read_ahead()
+{
+	for (auto & entry : m_readahead)
+		readahead_wait(*entry);
+	m_readahead.clear();
+	if (m_readahead_queue != nullptr)
+		osd_work_queue_free(m_readahead_queue);
+	m_readahead_queue = nullptr;
+	for (auto & elem : m_readahead_decompressor)
+	{
+		delete elem;
+		elem = nullptr;
+	}
+	m_readahead_hunks = 0;
+}
+
+/**
+ * @fn  chd_file::readahead_entry *chd_file::readahead_find(uint32_t hunknum)
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_find - find the cache entry holding a hunk
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ *
+ * @return  null if the hunk isn't cached, else the entry.
+ */
+
+chd_file::readahead_entry *chd_file::readahead_find(uint32_t hunknum)
+{
+	for (auto & entry : m_readahead)
+		if (entry->m_hunknum == hunknum)
+			return entry.get();
+	return nullptr;
+}
+
+/**
+ * @fn  chd_file::readahead_entry *chd_file::readahead_victim()
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_victim - pick the least recently used entry that isn't being
+ *            decompressed
+ *          -------------------------------------------------.
+ *
+ * @return  null if every entry is busy, else the entry.
+ */
+
+chd_file::readahead_entry *chd_file::readahead_victim()
+{
+	readahead_entry *result = nullptr;
+	for (auto & entry : m_readahead)
+	{
+		// hunks that were decompressed but never read can be reused once they're done
+		if (entry->m_osd != nullptr && osd_work_item_wait(entry->m_osd, 0))
+		{
+			osd_work_item_release(entry->m_osd);
+			entry->m_osd = nullptr;
+		}
+		if (entry->m_osd != nullptr)
+			continue;
+		if (entry->m_hunknum == ~0U)
+			return entry.get();
+		if (result == nullptr || entry->m_lastuse < result->m_lastuse)
+			result = entry.get();
+	}
+	return result;
+}
+
+/**
+ * @fn  void chd_file::readahead_queue(uint32_t hunknum)
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_queue - read a hunk's compressed data and queue it for decompression,
+ *            unless it's already cached or isn't stored compressed in this file
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ */
+
+void chd_file::readahead_queue(uint32_t hunknum)
+{
+	// self and parent references are resolved when they're read
+	uint8_t *rawmap = &m_rawmap[m_mapentrybytes * hunknum];
+	if (rawmap[0] > COMPRESSION_TYPE_3 || readahead_find(hunknum) != nullptr)
+		return;
+
+	readahead_entry *entry = readahead_victim();
+	if (entry == nullptr)
+		return;
+
+	// the file is only touched from this thread, so read the compressed data now
+	uint32_t const blocklen = be_read(&rawmap[1], 3);
+	uint64_t const blockoffs = be_read(&rawmap[4], 6);
+	entry->m_hunknum = ~0;
+	entry->m_compressed.resize(blocklen);
+	try
+	{
+		file_read(blockoffs, &entry->m_compressed[0], blocklen);
+	}
+	catch (chd_error &)
+	{
+		return;
+	}
+
+	entry->m_hunknum = hunknum;
+	entry->m_codec = rawmap[0];
+	entry->m_crc = be_read(&rawmap[10], 2);
+	entry->m_error = CHDERR_NONE;
+	entry->m_lastuse = ++m_readahead_clock;
+	entry->m_osd = osd_work_item_queue(m_readahead_queue, readahead_decompress, entry, 0);
+	if (entry->m_osd == nullptr)
+		entry->m_hunknum = ~0;
+}
+
+/**
+ * @fn  void chd_file::readahead_wait(readahead_entry &entry)
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_wait - wait for an entry's decompression to finish
+ *          -------------------------------------------------.
+ *
+ * @param [in,out]  entry   The entry.
+ */
+
+void chd_file::readahead_wait(readahead_entry &entry)
+{
+	if (entry.m_osd != nullptr)
+	{
+		while (!osd_work_item_wait(entry.m_osd, osd_ticks_per_second() * 10)) { }
+		osd_work_item_release(entry.m_osd);
+		entry.m_osd = nullptr;
+	}
+}
+
+/**
+ * @fn  void *chd_file::readahead_decompress(void *param, int threadid)
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_decompress - decompress a hunk on the work queue
+ *          -------------------------------------------------.
+ *
+ * @param [in,out]  param   If non-null, the readahead_entry.
+ * @param   threadid        The threadid.
+ *
+ * @return  null.
+ */
+
+void *chd_file::readahead_decompress(void *param, int threadid)
+{
+	readahead_entry &entry = *reinterpret_cast<readahead_entry *>(param);
+	chd_file &chd = *entry.m_chd;
+	chd_decompressor &codec = *chd.m_readahead_decompressor[entry.m_codec];
+	try
+	{
+		// same checks as read_hunk_direct
+		codec.decompress(&entry.m_compressed[0], entry.m_compressed.size(), &entry.m_data[0], chd.m_hunkbytes);
+		if (!codec.lossy() && util::crc16_creator::simple(&entry.m_data[0], chd.m_hunkbytes) != entry.m_crc)
+			throw CHDERR_DECOMPRESSION_ERROR;
+		if (codec.lossy() && util::crc16_creator::simple(&entry.m_compressed[0], entry.m_compressed.size()) != entry.m_crc)
+			throw CHDERR_DECOMPRESSION_ERROR;
+	}
+	catch (chd_error &err)
+	{
+		entry.m_error = err;
+	}
+	return nullptr;
+}
+
 /**
  * @fn  chd_error chd_file::write_hunk(uint32_t hunknum, const void *buffer)
  *
@@ -1148,9 +1451,14 @@ chd_error chd_file::read_bytes(uint64_t offset, void *buffer, uint32_t bytes)
 
 		// if it's a full block, just read directly from disk unless it's the cached hunk
 		chd_error err = CHDERR_NONE;
+		const uint8_t *mapped;
 		if (startoffs == 0 && endoffs == m_hunkbytes - 1 && curhunk != m_cachehunk)
 			err = read_hunk(curhunk, dest);
 
+		// partial blocks of mapped hunks can be copied directly
+		else if ((mapped = mapped_hunk(curhunk)) != nullptr)
+			memcpy(dest, mapped + startoffs, endoffs + 1 - startoffs);
+
 		// otherwise, read from the cache
 		else
 		{
@@ -1172,6 +1480,31 @@ chd_error chd_file::read_bytes(uint64_t offset, void *buffer, uint32_t bytes)
 	return CHDERR_NONE;
 }
 
+/**
+ * @fn  const uint8_t *chd_file::mapped_hunk(uint32_t hunknum)
+ *
+ * @brief   -------------------------------------------------
+ *            mapped_hunk - return a pointer to a hunk in the mapped file, if it's stored
+ *            uncompressed in this file
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ *
+ * @return  null if the hunk isn't mapped, else a pointer to its data.
+ */
+
+const uint8_t *chd_file::mapped_hunk(uint32_t hunknum)
+{
+	if (m_mapped == nullptr || hunknum >= m_hunkcount)
+		return nullptr;
+
+	// zero offsets are read from the parent or are all zero
+	uint64_t const blockoffs = uint64_t(be_read(&m_rawmap[m_mapentrybytes * hunknum], 4)) * uint64_t(m_hunkbytes);
+	if (blockoffs == 0 || blockoffs + m_hunkbytes > m_mappedbytes)
+		return nullptr;
+	return m_mapped + blockoffs;
+}
+
 /**
  * @fn  chd_error chd_file::write_bytes(uint64_t offset, const void *buffer, uint32_t bytes)
  *
@@ -2471,6 +2804,16 @@ void chd_file::create_open_common()
 	// allocate the temporary compressed buffer and a buffer for caching
 	m_compressed.resize(m_hunkbytes);
 	m_cache.resize(m_hunkbytes);
+
+	// uncompressed hunks of read-only files can be copied straight out of a mapping of the file
+	m_mapped = nullptr;
+	m_mappedbytes = 0;
+	if (m_version >= 5 && !compressed() && !m_allow_writes)
+	{
+		m_mapped = reinterpret_cast<const uint8_t *>(m_file->mapped(m_mappedbytes));
+		if (m_mapped == nullptr)
+			m_mappedbytes = 0;
+	}
 }
 
 /**
@@ -2758,10 +3101,13 @@ chd_file_compressor::chd_file_compressor()
 	: m_walking_parent(false),
 		m_total_in(0),
 		m_total_out(0),
+		m_codec_heuristic(false),
 		m_read_queue(nullptr),
 		m_read_queue_offset(0),
 		m_read_done_offset(0),
 		m_read_error(false),
+		m_hash_queue(nullptr),
+		m_hash_done_offset(0),
 		m_work_queue(nullptr),
 		m_write_hunk(0)
 {
@@ -2770,6 +3116,7 @@ chd_file_compressor::chd_file_compressor()
 
 	// allocate work queues
 	m_read_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	m_hash_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
 	m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
 }
 
@@ -2785,6 +3132,7 @@ chd_file_compressor::~chd_file_compressor()
 {
 	// free the work queues
 	osd_work_queue_free(m_read_queue);
+	osd_work_queue_free(m_hash_queue);
 	osd_work_queue_free(m_work_queue);
 
 	// delete allocated arrays
@@ -2816,6 +3164,7 @@ void chd_file_compressor::compress_begin()
 	m_read_queue_offset = 0;
 	m_read_done_offset = 0;
 	m_read_error = false;
+	m_hash_done_offset = 0;
 
 	// reset work item state
 	m_work_buffer.resize(hunk_bytes() * (WORK_BUFFER_HUNKS + 1));
@@ -2835,6 +3184,7 @@ void chd_file_compressor::compress_begin()
 	{
 		delete elem;
 		elem = new chd_compressor_group(*this, m_compression);
+		elem->set_heuristic(m_codec_heuristic);
 	}
 
 	// reset write state
@@ -2875,6 +3225,10 @@ chd_error chd_file_compressor::compress_continue(double &progress, double &ratio
 		if (curitem != enditem)
 			break;
 
+		// the running SHA-1 must also be done with the half we're about to overwrite
+		if (!m_walking_parent && m_read_queue_offset + WORK_BUFFER_HUNKS * hunk_bytes() / 2 > m_hash_done_offset + WORK_BUFFER_HUNKS * hunk_bytes())
+			break;
+
 		// if we're walking the parent, we want one more item to have cleared so we
 		// can read an extra hunk there
 		if (m_walking_parent && m_work_item[curitem % WORK_BUFFER_HUNKS].m_status != WS_READY)
@@ -2975,6 +3329,7 @@ chd_error chd_file_compressor::compress_continue(double &progress, double &ratio
 				osd_work_queue_wait(m_read_queue, 30 * osd_ticks_per_second());
 				if (!compressed())
 					return CHDERR_NONE;
+				osd_work_queue_wait(m_hash_queue, 30 * osd_ticks_per_second());
 				set_raw_sha1(m_compsha1.finish());
 				return compress_v5_map();
 			}
@@ -3161,11 +3516,13 @@ void chd_file_compressor::async_read()
 			item.m_osd = osd_work_item_queue(m_work_queue, m_walking_parent ? async_walk_parent_static : async_compress_hunk_static, &item, 0);
 		}
 
-		// continue the running SHA-1
+		// continue the running SHA-1 on its own thread so the next read can start
 		if (!m_walking_parent)
 		{
 			if (compressed())
-				m_compsha1.append(dest, numbytes);
+				osd_work_item_queue(m_hash_queue, async_hash_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+			else
+				m_hash_done_offset = end_offset;
 			m_total_in += numbytes;
 		}
 
@@ -3184,6 +3541,45 @@ void chd_file_compressor::async_read()
 	}
 }
 
+/**
+ * @fn  void *chd_file_compressor::async_hash_static(void *param, int threadid)
+ *
+ * @brief   -------------------------------------------------
+ *            async_hash - handle asynchronous running SHA-1
+ *          -------------------------------------------------.
+ *
+ * @param [in,out]  param   If non-null, the parameter.
+ * @param   threadid        The threadid.
+ *
+ * @return  null if it fails, else a void*.
+ */
+
+void *chd_file_compressor::async_hash_static(void *param, int threadid)
+{
+	reinterpret_cast<chd_file_compressor *>(param)->async_hash();
+	return nullptr;
+}
+
+/**
+ * @fn  void chd_file_compressor::async_hash()
+ *
+ * @brief   Asynchronous running SHA-1 over the next half of the work buffer.  The
+ *          hash queue has a single thread, so halves are appended in read order
+ *          while the read thread fills the other half.
+ */
+
+void chd_file_compressor::async_hash()
+{
+	uint32_t work_buffer_bytes = WORK_BUFFER_HUNKS * hunk_bytes();
+	uint64_t offset = m_hash_done_offset;
+	uint32_t numbytes = work_buffer_bytes / 2;
+	if (offset + numbytes > logical_bytes())
+		numbytes = logical_bytes() - offset;
+
+	m_compsha1.append(&m_work_buffer[0] + (offset % work_buffer_bytes), numbytes);
+	m_hash_done_offset = offset + numbytes;
+}
+
 
 
 //**************************************************************************
@@ -315,8 +315,10 @@ public:
 	uint32_t unit_bytes() const { return m_unitbytes; }
 	uint64_t unit_count() const { return m_unitcount; }
 	bool compressed() const { return (m_compression[0] != CHD_CODEC_NONE); }
+	bool writeable() const { return m_allow_writes; }
 	chd_codec_type compression(int index) const { return m_compression[index]; }
 	chd_file *parent() const { return m_parent; }
+	uint64_t cache_bytes() const { return m_cache.size() + uint64_t(m_readahead.size()) * m_hunkbytes * 2; }
 	util::sha1_t sha1();
 	util::sha1_t raw_sha1();
 	util::sha1_t parent_sha1();
@@ -339,6 +341,9 @@ public:
 	// file close
 	void close();
 
+	// background decompression of sequentially read hunks
+	chd_error enable_read_ahead(uint32_t cachehunks);
+
 	// read/write
 	chd_error read_hunk(uint32_t hunknum, void *buffer);
 	chd_error write_hunk(uint32_t hunknum, const void *buffer);
@@ -371,6 +376,20 @@ private:
 	struct metadata_entry;
 	struct metadata_hash;
 
+	// a hunk held in the read-ahead cache, possibly still being decompressed
+	struct readahead_entry
+	{
+		chd_file *              m_chd = nullptr;    // owning file
+		uint32_t                m_hunknum = ~0U;    // hunk held here, or ~0 if empty
+		uint64_t                m_lastuse = 0;      // value of m_readahead_clock when last used
+		osd_work_item *         m_osd = nullptr;    // OSD work item decompressing this hunk, if any
+		chd_error               m_error = CHDERR_NONE; // result of decompression
+		uint8_t                 m_codec = 0;        // index of the codec to use
+		util::crc16_t           m_crc;              // expected CRC of the data
+		std::vector<uint8_t>    m_compressed;       // compressed data read from the file
+		std::vector<uint8_t>    m_data;             // decompressed hunk
+	};
+
 	// inline helpers
 	uint64_t be_read(const uint8_t *base, int numbytes);
 	void be_write(uint8_t *base, uint64_t value, int numbytes);
@@ -399,6 +418,14 @@ private:
 	void metadata_set_previous_next(uint64_t prevoffset, uint64_t nextoffset);
 	void metadata_update_hash();
 	static int CLIB_DECL metadata_hash_compare(const void *elem1, const void *elem2);
+	chd_error read_hunk_direct(uint32_t hunknum, void *buffer);
+	const uint8_t *mapped_hunk(uint32_t hunknum);
+	readahead_entry *readahead_find(uint32_t hunknum);
+	readahead_entry *readahead_victim();
+	void readahead_queue(uint32_t hunknum);
+	void readahead_wait(readahead_entry &entry);
+	void disable_read_ahead();
+	static void *readahead_decompress(void *param, int threadid);
 
 	// file characteristics
 	util::core_file *       m_file;             // handle to the open core file
@@ -437,6 +464,16 @@ private:
 	// caching
 	std::vector<uint8_t>          m_cache;            // single-hunk cache for partial reads/writes
 	uint32_t                  m_cachehunk;        // which hunk is in the cache?
+	const uint8_t *         m_mapped;           // file contents mapped into memory, if read-only and uncompressed
+	uint64_t                  m_mappedbytes;      // number of bytes mapped
+
+	// read-ahead
+	std::vector<std::unique_ptr<readahead_entry>> m_readahead; // LRU cache of decompressed hunks
+	osd_work_queue *        m_readahead_queue;  // queue for decompressing upcoming hunks
+	chd_decompressor *      m_readahead_decompressor[4]; // codecs used by the queue
+	uint32_t                m_readahead_hunks;  // how many hunks to decompress ahead
+	uint32_t                m_readahead_last;   // last hunk read, to detect sequential access
+	uint64_t                m_readahead_clock;  // counter for tracking least recently used hunks
 };
 
 
@@ -451,6 +488,7 @@ public:
 	virtual ~chd_file_compressor();
 
 	// compression management
+	void set_codec_heuristic(bool enable) { m_codec_heuristic = enable; }
 	void compress_begin();
 	chd_error compress_continue(double &progress, double &ratio);
 
@@ -551,12 +589,15 @@ private:
 	void async_compress_hunk(work_item &item, int threadid);
 	static void *async_read_static(void *param, int threadid);
 	void async_read();
+	static void *async_hash_static(void *param, int threadid);
+	void async_hash();
 
 	// current compression status
 	bool                    m_walking_parent;   // are we building the parent map?
 	uint64_t                  m_total_in;         // total bytes in
 	uint64_t                  m_total_out;        // total bytes out
 	util::sha1_creator      m_compsha1;         // running SHA-1 on raw data
+	bool                    m_codec_heuristic;  // skip codec trials when one keeps winning?
 
 	// hash lookup maps
 	hashmap                 m_parent_map;       // hash map for parent
@@ -568,6 +609,10 @@ private:
 	uint64_t                  m_read_done_offset; // next offset that will complete
 	bool                    m_read_error;       // error during reading?
 
+	// raw SHA-1 thread
+	osd_work_queue *        m_hash_queue;       // work queue for the running SHA-1
+	std::atomic<uint64_t>   m_hash_done_offset; // next offset that will be hashed
+
 	// work item thread
 	static const int WORK_BUFFER_HUNKS = 256;
 	osd_work_queue *        m_work_queue;       // queue for doing work on other threads
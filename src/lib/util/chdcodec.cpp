@@ -18,6 +18,11 @@
 #include <zlib.h>
 #include "lzma/C/LzmaEnc.h"
 #include "lzma/C/LzmaDec.h"
+#if CHDCODEC_USE_ZSTD_LZ4
+#include <zstd.h>
+#include <lz4.h>
+#include <lz4hc.h>
+#endif
 #include <new>
 
 
@@ -159,6 +164,78 @@ private:
 };
 
 
+#if CHDCODEC_USE_ZSTD_LZ4
+// ======================> chd_zstd_compressor
+
+// Zstandard compressor
+class chd_zstd_compressor : public chd_compressor
+{
+public:
+	// construction/destruction
+	chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy);
+	~chd_zstd_compressor();
+
+	// core functionality
+	virtual uint32_t compress(const uint8_t *src, uint32_t srclen, uint8_t *dest) override;
+
+private:
+	// internal state
+	ZSTD_CCtx *             m_context;
+};
+
+
+// ======================> chd_zstd_decompressor
+
+// Zstandard decompressor
+class chd_zstd_decompressor : public chd_decompressor
+{
+public:
+	// construction/destruction
+	chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy);
+	~chd_zstd_decompressor();
+
+	// core functionality
+	virtual void decompress(const uint8_t *src, uint32_t complen, uint8_t *dest, uint32_t destlen) override;
+
+private:
+	// internal state
+	ZSTD_DCtx *             m_context;
+};
+
+
+// ======================> chd_lz4_compressor
+
+// LZ4 compressor (high compression mode; the stream format is plain LZ4)
+class chd_lz4_compressor : public chd_compressor
+{
+public:
+	// construction/destruction
+	chd_lz4_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy);
+
+	// core functionality
+	virtual uint32_t compress(const uint8_t *src, uint32_t srclen, uint8_t *dest) override;
+
+private:
+	// internal state
+	std::vector<uint8_t>    m_state;
+};
+
+
+// ======================> chd_lz4_decompressor
+
+// LZ4 decompressor
+class chd_lz4_decompressor : public chd_decompressor
+{
+public:
+	// construction/destruction
+	chd_lz4_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy);
+
+	// core functionality
+	virtual void decompress(const uint8_t *src, uint32_t complen, uint8_t *dest, uint32_t destlen) override;
+};
+#endif
+
+
 // ======================> chd_huffman_compressor
 
 // Huffman compressor
@@ -468,11 +545,19 @@ const chd_codec_list::codec_entry chd_codec_list::s_codec_list[] =
 	{ CHD_CODEC_LZMA,       false,  "LZMA",                 &chd_codec_list::construct_compressor<chd_lzma_compressor>,     &chd_codec_list::construct_decompressor<chd_lzma_decompressor> },
 	{ CHD_CODEC_HUFFMAN,    false,  "Huffman",              &chd_codec_list::construct_compressor<chd_huffman_compressor>,  &chd_codec_list::construct_decompressor<chd_huffman_decompressor> },
 	{ CHD_CODEC_FLAC,       false,  "FLAC",                 &chd_codec_list::construct_compressor<chd_flac_compressor>,     &chd_codec_list::construct_decompressor<chd_flac_decompressor> },
+#if CHDCODEC_USE_ZSTD_LZ4
+	{ CHD_CODEC_ZSTD,       false,  "Zstandard",            &chd_codec_list::construct_compressor<chd_zstd_compressor>,     &chd_codec_list::construct_decompressor<chd_zstd_decompressor> },
+	{ CHD_CODEC_LZ4,        false,  "LZ4",                  &chd_codec_list::construct_compressor<chd_lz4_compressor>,      &chd_codec_list::construct_decompressor<chd_lz4_decompressor> },
+#endif
 
 	// general codecs with CD frontend
 	{ CHD_CODEC_CD_ZLIB,    false,  "CD Deflate",           &chd_codec_list::construct_compressor<chd_cd_compressor<chd_zlib_compressor, chd_zlib_compressor> >,        &chd_codec_list::construct_decompressor<chd_cd_decompressor<chd_zlib_decompressor, chd_zlib_decompressor> > },
 	{ CHD_CODEC_CD_LZMA,    false,  "CD LZMA",              &chd_codec_list::construct_compressor<chd_cd_compressor<chd_lzma_compressor, chd_zlib_compressor> >,        &chd_codec_list::construct_decompressor<chd_cd_decompressor<chd_lzma_decompressor, chd_zlib_decompressor> > },
 	{ CHD_CODEC_CD_FLAC,    false,  "CD FLAC",              &chd_codec_list::construct_compressor<chd_cd_flac_compressor>,  &chd_codec_list::construct_decompressor<chd_cd_flac_decompressor> },
+#if CHDCODEC_USE_ZSTD_LZ4
+	{ CHD_CODEC_CD_ZSTD,    false,  "CD Zstandard",         &chd_codec_list::construct_compressor<chd_cd_compressor<chd_zstd_compressor, chd_zstd_compressor> >,        &chd_codec_list::construct_decompressor<chd_cd_decompressor<chd_zstd_decompressor, chd_zstd_decompressor> > },
+	{ CHD_CODEC_CD_LZ4,     false,  "CD LZ4",               &chd_codec_list::construct_compressor<chd_cd_compressor<chd_lz4_compressor, chd_lz4_compressor> >,          &chd_codec_list::construct_decompressor<chd_cd_decompressor<chd_lz4_decompressor, chd_lz4_decompressor> > },
+#endif
 
 	// A/V codecs
 	{ CHD_CODEC_AVHUFF,     false,  "A/V Huffman",          &chd_codec_list::construct_compressor<chd_avhuff_compressor>,   &chd_codec_list::construct_decompressor<chd_avhuff_decompressor> },
@@ -616,7 +701,11 @@ const chd_codec_list::codec_entry *chd_codec_list::find_in_list(chd_codec_type t
 
 chd_compressor_group::chd_compressor_group(chd_file &chd, uint32_t compressor_list[4])
 	: m_hunkbytes(chd.hunk_bytes()),
-		m_compress_test(m_hunkbytes)
+		m_compress_test(m_hunkbytes),
+		m_heuristic(false),
+		m_streak_codec(-1),
+		m_streak(0),
+		m_since_trial(0)
 #if CHDCODEC_VERIFY_COMPRESSION
 		,m_decompressed(m_hunkbytes)
 #endif
@@ -660,55 +749,79 @@ chd_compressor_group::~chd_compressor_group()
 
 int8_t chd_compressor_group::find_best_compressor(const uint8_t *src, uint8_t *compressed, uint32_t &complen)
 {
-	// determine best compression technique
+	// if one codec has been winning consistently, try just that one; fall back to
+	// a full trial if it fails to compress
 	complen = m_hunkbytes;
+	if (m_heuristic && m_streak_codec != -1 && m_streak >= STREAK_LOCK && m_since_trial < STREAK_RETRY)
+	{
+		m_since_trial++;
+		if (try_compressor(m_streak_codec, src, compressed, complen))
+			return m_streak_codec;
+	}
+
+	// determine best compression technique
 	int8_t compression = -1;
 	for (int codecnum = 0; codecnum < ARRAY_LENGTH(m_compressor); codecnum++)
-		if (m_compressor[codecnum] != nullptr)
+		if (m_compressor[codecnum] != nullptr && try_compressor(codecnum, src, compressed, complen))
+			compression = codecnum;
+
+	// track the winner for the heuristic
+	m_streak = (compression != -1 && compression == m_streak_codec) ? m_streak + 1 : 1;
+	m_streak_codec = compression;
+	m_since_trial = 0;
+
+	// if the best is none, copy it over
+	if (compression == -1)
+		memcpy(compressed, src, m_hunkbytes);
+	return compression;
+}
+
+
+//-------------------------------------------------
+//  try_compressor - compress with one codec and
+//  keep the result if it beats complen
+//-------------------------------------------------
+
+bool chd_compressor_group::try_compressor(int codecnum, const uint8_t *src, uint8_t *compressed, uint32_t &complen)
+{
+	// attempt to compress, swallowing errors
+	try
+	{
+		// if this is the best one, copy the data into the permanent buffer
+		uint32_t compbytes = m_compressor[codecnum]->compress(src, m_hunkbytes, &m_compress_test[0]);
+#if CHDCODEC_VERIFY_COMPRESSION
+		try
+		{
+			memset(m_decompressed, 0, m_hunkbytes);
+			m_decompressor[codecnum]->decompress(m_compress_test, compbytes, m_decompressed, m_hunkbytes);
+		}
+		catch (...)
+		{
+		}
+
+		if (memcmp(src, m_decompressed, m_hunkbytes) != 0)
 		{
-			// attempt to compress, swallowing errors
+			compbytes = m_compressor[codecnum]->compress(src, m_hunkbytes, m_compress_test);
 			try
 			{
-				// if this is the best one, copy the data into the permanent buffer
-				uint32_t compbytes = m_compressor[codecnum]->compress(src, m_hunkbytes, &m_compress_test[0]);
-#if CHDCODEC_VERIFY_COMPRESSION
-				try
-				{
-					memset(m_decompressed, 0, m_hunkbytes);
-					m_decompressor[codecnum]->decompress(m_compress_test, compbytes, m_decompressed, m_hunkbytes);
-				}
-				catch (...)
-				{
-				}
-
-				if (memcmp(src, m_decompressed, m_hunkbytes) != 0)
-				{
-					compbytes = m_compressor[codecnum]->compress(src, m_hunkbytes, m_compress_test);
-					try
-					{
-						m_decompressor[codecnum]->decompress(m_compress_test, compbytes, m_decompressed, m_hunkbytes);
-					}
-					catch (...)
-					{
-						memset(m_decompressed, 0, m_hunkbytes);
-					}
-				}
+				m_decompressor[codecnum]->decompress(m_compress_test, compbytes, m_decompressed, m_hunkbytes);
+			}
+			catch (...)
+			{
+				memset(m_decompressed, 0, m_hunkbytes);
+			}
+		}
 printf("   codec%d=%d bytes            \n", codecnum, compbytes);
 #endif
-				if (compbytes < complen)
-				{
-					compression = codecnum;
-					complen = compbytes;
-					memcpy(compressed, &m_compress_test[0], compbytes);
-				}
-			}
-			catch (...) { }
+		if (compbytes < complen)
+		{
+			complen = compbytes;
+			memcpy(compressed, &m_compress_test[0], compbytes);
+			return true;
 		}
-
-	// if the best is none, copy it over
-	if (compression == -1)
-		memcpy(compressed, src, m_hunkbytes);
-	return compression;
+	}
+	catch (...) { }
+	return false;
 }
 
 
@@ -1193,6 +1306,160 @@ void chd_lzma_decompressor::decompress(const uint8_t *src, uint32_t complen, uin
 
 
 
+#if CHDCODEC_USE_ZSTD_LZ4
+
+//**************************************************************************
+//  ZSTD COMPRESSOR
+//**************************************************************************
+
+//-------------------------------------------------
+//  chd_zstd_compressor - constructor
+//-------------------------------------------------
+
+chd_zstd_compressor::chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
+	: chd_compressor(chd, hunkbytes, lossy),
+		m_context(ZSTD_createCCtx())
+{
+	if (m_context == nullptr)
+		throw std::bad_alloc();
+}
+
+
+//-------------------------------------------------
+//  ~chd_zstd_compressor - destructor
+//-------------------------------------------------
+
+chd_zstd_compressor::~chd_zstd_compressor()
+{
+	ZSTD_freeCCtx(m_context);
+}
+
+
+//-------------------------------------------------
+//  compress - compress data using the Zstandard
+//  codec
+//-------------------------------------------------
+
+uint32_t chd_zstd_compressor::compress(const uint8_t *src, uint32_t srclen, uint8_t *dest)
+{
+	// compress at a high level; decode speed doesn't depend on it
+	size_t result = ZSTD_compressCCtx(m_context, dest, srclen, src, srclen, 19);
+
+	// if we ended up with more data than we started with, return an error
+	if (ZSTD_isError(result) || result >= srclen)
+		throw CHDERR_COMPRESSION_ERROR;
+
+	// otherwise, return the length
+	return result;
+}
+
+
+
+//**************************************************************************
+//  ZSTD DECOMPRESSOR
+//**************************************************************************
+
+//-------------------------------------------------
+//  chd_zstd_decompressor - constructor
+//-------------------------------------------------
+
+chd_zstd_decompressor::chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
+	: chd_decompressor(chd, hunkbytes, lossy),
+		m_context(ZSTD_createDCtx())
+{
+	if (m_context == nullptr)
+		throw std::bad_alloc();
+}
+
+
+//-------------------------------------------------
+//  ~chd_zstd_decompressor - destructor
+//-------------------------------------------------
+
+chd_zstd_decompressor::~chd_zstd_decompressor()
+{
+	ZSTD_freeDCtx(m_context);
+}
+
+
+//-------------------------------------------------
+//  decompress - decompress data using the
+//  Zstandard codec
+//-------------------------------------------------
+
+void chd_zstd_decompressor::decompress(const uint8_t *src, uint32_t complen, uint8_t *dest, uint32_t destlen)
+{
+	size_t result = ZSTD_decompressDCtx(m_context, dest, destlen, src, complen);
+	if (ZSTD_isError(result) || result != destlen)
+		throw CHDERR_DECOMPRESSION_ERROR;
+}
+
+
+
+//**************************************************************************
+//  LZ4 COMPRESSOR
+//**************************************************************************
+
+//-------------------------------------------------
+//  chd_lz4_compressor - constructor
+//-------------------------------------------------
+
+chd_lz4_compressor::chd_lz4_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
+	: chd_compressor(chd, hunkbytes, lossy),
+		m_state(LZ4_sizeofStateHC())
+{
+}
+
+
+//-------------------------------------------------
+//  compress - compress data using the LZ4 codec
+//-------------------------------------------------
+
+uint32_t chd_lz4_compressor::compress(const uint8_t *src, uint32_t srclen, uint8_t *dest)
+{
+	// the HC encoder only costs time here; the decoder is the same as for fast mode
+	int result = LZ4_compress_HC_extStateHC(&m_state[0], reinterpret_cast<const char *>(src), reinterpret_cast<char *>(dest), srclen, srclen, LZ4HC_CLEVEL_MAX);
+
+	// zero means it didn't fit in srclen bytes
+	if (result <= 0 || uint32_t(result) >= srclen)
+		throw CHDERR_COMPRESSION_ERROR;
+
+	// otherwise, return the length
+	return result;
+}
+
+
+
+//**************************************************************************
+//  LZ4 DECOMPRESSOR
+//**************************************************************************
+
+//-------------------------------------------------
+//  chd_lz4_decompressor - constructor
+//-------------------------------------------------
+
+chd_lz4_decompressor::chd_lz4_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
+	: chd_decompressor(chd, hunkbytes, lossy)
+{
+}
+
+
+//-------------------------------------------------
+//  decompress - decompress data using the LZ4
+//  codec
+//-------------------------------------------------
+
+void chd_lz4_decompressor::decompress(const uint8_t *src, uint32_t complen, uint8_t *dest, uint32_t destlen)
+{
+	int result = LZ4_decompress_safe(reinterpret_cast<const char *>(src), reinterpret_cast<char *>(dest), complen, destlen);
+	if (result < 0 || uint32_t(result) != destlen)
+		throw CHDERR_DECOMPRESSION_ERROR;
+}
+
+#endif // CHDCODEC_USE_ZSTD_LZ4
+
+
+
 //**************************************************************************
 //  HUFFMAN COMPRESSOR
 //**************************************************************************
@@ -19,6 +19,12 @@
 
 #define CHDCODEC_VERIFY_COMPRESSION 0
 
+// the Zstandard and LZ4 codecs link against the system zstd and lz4 libraries,
+// which aren't bundled in 3rdparty; define this to 1 to build them
+#ifndef CHDCODEC_USE_ZSTD_LZ4
+#define CHDCODEC_USE_ZSTD_LZ4 0
+#endif
+
 
 //**************************************************************************
 //  MACROS
@@ -147,14 +153,29 @@ public:
 	chd_compressor_group(chd_file &file, chd_codec_type compressor_list[4]);
 	~chd_compressor_group();
 
+	// configuration
+	void set_heuristic(bool enable) { m_heuristic = enable; }
+
 	// find the best compressor
 	int8_t find_best_compressor(const uint8_t *src, uint8_t *compressed, uint32_t &complen);
 
 private:
+	// once a codec wins this many hunks in a row, only it is tried...
+	static const uint32_t STREAK_LOCK = 8;
+	// ...until this many hunks pass, when all codecs are tried again
+	static const uint32_t STREAK_RETRY = 64;
+
+	// internal helpers
+	bool try_compressor(int codecnum, const uint8_t *src, uint8_t *compressed, uint32_t &complen);
+
 	// internal state
 	uint32_t                  m_hunkbytes;        // number of bytes in a hunk
 	chd_compressor *        m_compressor[4];    // array of active codecs
 	std::vector<uint8_t>          m_compress_test;    // test buffer for compression
+	bool                    m_heuristic;        // skip trials while one codec keeps winning?
+	int8_t                  m_streak_codec;     // codec that won the last full trial
+	uint32_t                m_streak;           // full trials in a row it has won
+	uint32_t                m_since_trial;      // hunks since the last full trial
 #if CHDCODEC_VERIFY_COMPRESSION
 	chd_decompressor *      m_decompressor[4];  // array of active codecs
 	std::vector<uint8_t>          m_decompressed;     // verification buffer
@@ -175,11 +196,15 @@ const chd_codec_type CHD_CODEC_ZLIB         = CHD_MAKE_TAG('z','l','i','b');
 const chd_codec_type CHD_CODEC_LZMA         = CHD_MAKE_TAG('l','z','m','a');
 const chd_codec_type CHD_CODEC_HUFFMAN      = CHD_MAKE_TAG('h','u','f','f');
 const chd_codec_type CHD_CODEC_FLAC         = CHD_MAKE_TAG('f','l','a','c');
+const chd_codec_type CHD_CODEC_ZSTD         = CHD_MAKE_TAG('z','s','t','d');
+const chd_codec_type CHD_CODEC_LZ4          = CHD_MAKE_TAG('l','z','4','h');
 
 // general codecs with CD frontend
 const chd_codec_type CHD_CODEC_CD_ZLIB      = CHD_MAKE_TAG('c','d','z','l');
 const chd_codec_type CHD_CODEC_CD_LZMA      = CHD_MAKE_TAG('c','d','l','z');
 const chd_codec_type CHD_CODEC_CD_FLAC      = CHD_MAKE_TAG('c','d','f','l');
+const chd_codec_type CHD_CODEC_CD_ZSTD      = CHD_MAKE_TAG('c','d','z','s');
+const chd_codec_type CHD_CODEC_CD_LZ4       = CHD_MAKE_TAG('c','d','l','4');
 
 // A/V codecs
 const chd_codec_type CHD_CODEC_AVHUFF       = CHD_MAKE_TAG('a','v','h','u');
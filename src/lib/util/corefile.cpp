@@ -155,6 +155,7 @@ public:
 	virtual int ungetc(int c) override { return m_file.ungetc(c); }
 	virtual char *gets(char *s, int n) override { return m_file.gets(s, n); }
 	virtual const void *buffer() override { return m_file.buffer(); }
+	virtual const void *mapped(std::uint64_t &length) override { return m_file.mapped(length); }
 
 	virtual std::uint32_t write(const void *buffer, std::uint32_t length) override { return m_file.write(buffer, length); }
 	virtual int puts(const char *s) override { return m_file.puts(s); }
@@ -241,6 +242,7 @@ public:
 
 	virtual std::uint32_t read(void *buffer, std::uint32_t length) override;
 	virtual void const *buffer() override { return m_data; }
+	virtual void const *mapped(std::uint64_t &length) override { length = m_length; return m_data; }
 
 	virtual std::uint32_t write(void const *buffer, std::uint32_t length) override { return 0; }
 	virtual osd_file::error truncate(std::uint64_t offset) override;
@@ -257,6 +259,7 @@ protected:
 	}
 
 	bool is_loaded() const { return nullptr != m_data; }
+	void attach(void const *data) { purge(); m_data = data; }
 	void *allocate()
 	{
 		if (m_data) return nullptr;
@@ -299,9 +302,21 @@ public:
 		: core_in_memory_file(openmode, length)
 		, m_file(std::move(file))
 		, m_zdata()
+		, m_mapped(false)
 		, m_bufferbase(0)
 		, m_bufferbytes(0)
 	{
+		// large read-only files are read straight out of a mapping
+		if (read_access() && !write_access() && (length >= MAP_THRESHOLD))
+		{
+			void const *data;
+			std::uint64_t maplength;
+			if ((m_file->map(data, maplength) == osd_file::error::NONE) && (maplength >= length))
+			{
+				attach(data);
+				m_mapped = true;
+			}
+		}
 	}
 	~core_osd_file() override;
 
@@ -311,6 +326,7 @@ public:
 
 	virtual std::uint32_t read(void *buffer, std::uint32_t length) override;
 	virtual void const *buffer() override;
+	virtual void const *mapped(std::uint64_t &length) override;
 
 	virtual std::uint32_t write(void const *buffer, std::uint32_t length) override;
 	virtual osd_file::error truncate(std::uint64_t offset) override;
@@ -322,12 +338,14 @@ protected:
 
 private:
 	static constexpr std::size_t FILE_BUFFER_SIZE = 512;
+	static constexpr std::uint64_t MAP_THRESHOLD = 256 * 1024;
 
 	osd_file::error osd_or_zlib_read(void *buffer, std::uint64_t offset, std::uint32_t length, std::uint32_t &actual);
 	osd_file::error osd_or_zlib_write(void const *buffer, std::uint64_t offset, std::uint32_t length, std::uint32_t &actual);
 
 	osd_file::ptr   m_file;                     // OSD file handle
 	zlib_data::ptr  m_zdata;                    // compression data
+	bool            m_mapped;                   // data is the OSD file's mapping
 	std::uint64_t   m_bufferbase;               // base offset of internal buffer
 	std::uint32_t   m_bufferbytes;              // bytes currently loaded into buffer
 	std::uint8_t    m_buffer[FILE_BUFFER_SIZE]; // buffer data
@@ -791,6 +809,13 @@ osd_file::error core_osd_file::compress(int level)
 	{
 		int zerr;
 
+		// compressed data has to come through the OSD reads
+		if (m_mapped)
+		{
+			attach(nullptr);
+			m_mapped = false;
+		}
+
 		// initialize the stream and compressor
 		if (write_access())
 			zerr = zlib_data::start_compression(level, offset(), m_zdata);
@@ -899,6 +924,28 @@ void const *core_osd_file::buffer()
 }
 
 
+/*-------------------------------------------------
+    mapped - get a pointer to the file's data,
+    asking the OSD to map it if it isn't loaded
+-------------------------------------------------*/
+
+void const *core_osd_file::mapped(std::uint64_t &length)
+{
+	// data already in RAM doesn't need mapping, and compressed data can't be mapped
+	if (is_loaded())
+		return core_in_memory_file::mapped(length);
+	if (m_zdata)
+		return nullptr;
+
+	void const *data;
+	std::uint64_t maplength;
+	if (m_file->map(data, maplength) != osd_file::error::NONE)
+		return nullptr;
+	length = (std::min)(maplength, this->length());
+	return data;
+}
+
+
 /*-------------------------------------------------
     write - write to a file
 -------------------------------------------------*/
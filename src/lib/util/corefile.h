@@ -99,6 +99,10 @@ public:
 	// this function may cause the full file data to be read
 	virtual const void *buffer() = 0;
 
+	// get a pointer to the full file data without reading it, mapping the file if necessary
+	// returns nullptr if the data isn't directly accessible; the pointer is valid until the file is closed
+	virtual const void *mapped(std::uint64_t &length) = 0;
+
 	// open a file with the specified filename, read it into memory, and return a pointer
 	static osd_file::error load(std::string const &filename, void **data, std::uint32_t &length);
 	static osd_file::error load(std::string const &filename, std::vector<uint8_t> &data);
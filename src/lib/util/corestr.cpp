@@ -49,6 +49,36 @@ int core_strnicmp(const char *s1, const char *s2, size_t n)
 }
 
 
+/*-------------------------------------------------
+    core_charbit - the bit standing for a
+    character in a core_strcharset
+-------------------------------------------------*/
+
+uint64_t core_charbit(int c)
+{
+	c = tolower(uint8_t(c));
+	if (c >= 'a' && c <= 'z')
+		return uint64_t(1) << (c - 'a');
+	if (c >= '0' && c <= '9')
+		return uint64_t(1) << (26 + c - '0');
+	return uint64_t(1) << (36 + (c % 28));
+}
+
+
+/*-------------------------------------------------
+    core_strcharset - the set of characters in a
+    string, ignoring case
+-------------------------------------------------*/
+
+uint64_t core_strcharset(const char *str)
+{
+	uint64_t result = 0;
+	for ( ; *str != 0; str++)
+		result |= core_charbit(*str);
+	return result;
+}
+
+
 /*-------------------------------------------------
     core_strwildcmp - case-insensitive wildcard
     string compare (up to 16 characters at the
@@ -61,6 +61,13 @@ char *core_strdup(const char *str);
 int core_strwildcmp(const char *sp1, const char *sp2);
 
 
+/* case-insensitive sets of the characters in strings; letters and digits get a bit
+   each and everything else shares the rest, so a character whose bit isn't in a
+   string's set is certainly not in the string */
+uint64_t core_charbit(int c);
+uint64_t core_strcharset(const char *str);
+
+
 int strcatvprintf(std::string &str, const char *format, va_list args);
 
 void strdelchr(std::string& str, char chr);
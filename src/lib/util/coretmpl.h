@@ -360,6 +360,49 @@ private:
 };
 
 
+// ======================> arena_allocator
+
+// an arena_allocator hands out objects in order from contiguous blocks and
+// takes them all back at once; blocks are kept, and objects are reused
+// rather than destroyed, so callers must reset them after allocating
+template<class _ItemType, std::size_t _BlockSize = 256>
+class arena_allocator
+{
+	// we don't support deep copying
+	arena_allocator(const arena_allocator &);
+	arena_allocator &operator=(const arena_allocator &);
+
+public:
+	// construction/destruction
+	arena_allocator() : m_block(0), m_index(0) { }
+
+	// allocate the next item, adding a new block once the current one is used up
+	_ItemType *alloc()
+	{
+		if (m_index == _BlockSize)
+		{
+			m_block++;
+			m_index = 0;
+		}
+		if (m_block == m_blocks.size())
+			m_blocks.emplace_back(new _ItemType[_BlockSize]);
+		return &m_blocks[m_block][m_index++];
+	}
+
+	// reclaim an item; only the most recently allocated item can be reused before reclaim_all
+	void reclaim(_ItemType &item) { if (m_index != 0 && &m_blocks[m_block][m_index - 1] == &item) m_index--; }
+
+	// reclaim every item in O(1)
+	void reclaim_all() { m_block = 0; m_index = 0; }
+
+private:
+	// internal state
+	std::vector<std::unique_ptr<_ItemType []>> m_blocks;  // blocks of items
+	std::size_t             m_block;        // index of the block being allocated from
+	std::size_t             m_index;        // index of the next item in that block
+};
+
+
 // ======================> contiguous_sequence_wrapper
 
 namespace util {
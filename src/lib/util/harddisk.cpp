@@ -13,20 +13,97 @@
 #include "harddisk.h"
 
 #include <stdlib.h>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <vector>
+
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+/* most data written but not yet on the host before writes wait for it */
+#define HARD_DISK_DIRTY_BYTES   (4 * 1024 * 1024)
+
 
 
 /***************************************************************************
     TYPE DEFINITIONS
 ***************************************************************************/
 
+struct hard_disk_dirty_sector
+{
+	std::vector<uint8_t> data;              /* sector contents */
+	uint64_t            generation;         /* bumped on every write, so rewrites aren't lost */
+};
+
 struct hard_disk_file
 {
 	chd_file *          chd;                /* CHD file */
 	hard_disk_info      info;               /* hard disk info */
+
+	/* write-back state; sectors stay in the dirty map until they reach the CHD,
+	   so reads see them, and the CHD is only touched under chdlock */
+	osd_work_queue *    queue;              /* queue for the background writer, or nullptr to write through */
+	std::mutex          chdlock;            /* serializes access to the CHD */
+	std::mutex          dirtylock;          /* protects everything below */
+	std::condition_variable dirtychanged;   /* signalled as sectors are written */
+	std::map<uint32_t, hard_disk_dirty_sector> dirty; /* sectors waiting to be written, by LBA */
+	uint32_t            maxdirty;           /* most sectors allowed in the dirty map */
+	uint64_t            generation;         /* last generation handed out */
+	bool                writing;            /* the writer work item is queued or running */
+	chd_error           writeerr;           /* first error the writer hit */
 };
 
 
 
+/***************************************************************************
+    WRITE-BACK
+***************************************************************************/
+
+/*-------------------------------------------------
+    hard_disk_write_back - work item callback that
+    writes dirty sectors to the CHD in LBA order
+    until there are none left
+-------------------------------------------------*/
+
+static void *hard_disk_write_back(void *param, int threadid)
+{
+	hard_disk_file *file = (hard_disk_file *)param;
+	std::unique_lock<std::mutex> dirtylock(file->dirtylock);
+	while (!file->dirty.empty())
+	{
+		/* take a copy so the emulation can keep writing while the host is busy */
+		auto const next = file->dirty.begin();
+		uint32_t const lbasector = next->first;
+		std::vector<uint8_t> const data = next->second.data;
+		uint64_t const generation = next->second.generation;
+		dirtylock.unlock();
+
+		chd_error err;
+		{
+			std::lock_guard<std::mutex> chdlock(file->chdlock);
+			err = file->chd->write_units(lbasector, &data[0]);
+		}
+
+		/* drop the sector unless it was rewritten meanwhile; a failed write
+		   is reported from the next write or flush rather than retried */
+		dirtylock.lock();
+		if (err != CHDERR_NONE && file->writeerr == CHDERR_NONE)
+			file->writeerr = err;
+		auto const current = file->dirty.find(lbasector);
+		if (current != file->dirty.end() && current->second.generation == generation)
+			file->dirty.erase(current);
+		file->dirtychanged.notify_all();
+	}
+	file->writing = false;
+	file->dirtychanged.notify_all();
+	return nullptr;
+}
+
+
+
 /***************************************************************************
     CORE IMPLEMENTATION
 ***************************************************************************/
@@ -57,7 +134,7 @@ hard_disk_file *hard_disk_open(chd_file *chd)
 		return nullptr;
 
 	/* allocate memory for the hard disk file */
-	file = (hard_disk_file *)malloc(sizeof(hard_disk_file));
+	file = new (std::nothrow) hard_disk_file;
 	if (file == nullptr)
 		return nullptr;
 
@@ -67,6 +144,16 @@ hard_disk_file *hard_disk_open(chd_file *chd)
 	file->info.heads = heads;
 	file->info.sectors = sectors;
 	file->info.sectorbytes = sectorbytes;
+
+	/* writes that can succeed are written back in the background; anything
+	   else goes straight to the CHD so errors are reported immediately */
+	file->queue = nullptr;
+	if (chd->writeable() && !chd->compressed() && chd->unit_bytes() == sectorbytes)
+		file->queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	file->maxdirty = std::max<uint32_t>(HARD_DISK_DIRTY_BYTES / std::max(sectorbytes, 1), 1);
+	file->generation = 0;
+	file->writing = false;
+	file->writeerr = CHDERR_NONE;
 	return file;
 }
 
@@ -77,7 +164,10 @@ hard_disk_file *hard_disk_open(chd_file *chd)
 
 void hard_disk_close(hard_disk_file *file)
 {
-	free(file);
+	hard_disk_flush(file);
+	if (file->queue != nullptr)
+		osd_work_queue_free(file->queue);
+	delete file;
 }
 
 
@@ -88,6 +178,8 @@ void hard_disk_close(hard_disk_file *file)
 
 chd_file *hard_disk_get_chd(hard_disk_file *file)
 {
+	/* callers use the CHD directly, so it has to be up to date and idle */
+	hard_disk_flush(file);
 	return file->chd;
 }
 
@@ -132,6 +224,19 @@ hard_disk_info *hard_disk_get_info(hard_disk_file *file)
 
 uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer)
 {
+	/* sectors that haven't been written back yet come from memory */
+	if (file->queue != nullptr)
+	{
+		std::lock_guard<std::mutex> dirtylock(file->dirtylock);
+		auto const found = file->dirty.find(lbasector);
+		if (found != file->dirty.end())
+		{
+			memcpy(buffer, &found->second.data[0], found->second.data.size());
+			return 1;
+		}
+	}
+
+	std::lock_guard<std::mutex> chdlock(file->chdlock);
 	chd_error err = file->chd->read_units(lbasector, buffer);
 	return (err == CHDERR_NONE);
 }
@@ -156,6 +261,66 @@ uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer)
 
 uint32_t hard_disk_write(hard_disk_file *file, uint32_t lbasector, const void *buffer)
 {
-	chd_error err = file->chd->write_units(lbasector, buffer);
-	return (err == CHDERR_NONE);
+	if (file->queue == nullptr || lbasector >= file->chd->unit_count())
+	{
+		std::lock_guard<std::mutex> chdlock(file->chdlock);
+		chd_error err = file->chd->write_units(lbasector, buffer);
+		return (err == CHDERR_NONE);
+	}
+
+	/* once the host has failed us, stop pretending writes succeed */
+	std::unique_lock<std::mutex> dirtylock(file->dirtylock);
+	if (file->writeerr != CHDERR_NONE)
+		return 0;
+
+	/* only wait for the host when too much is outstanding */
+	while (file->dirty.size() >= file->maxdirty && file->dirty.find(lbasector) == file->dirty.end())
+		file->dirtychanged.wait(dirtylock);
+
+	hard_disk_dirty_sector &sector = file->dirty[lbasector];
+	const uint8_t *data = (const uint8_t *)buffer;
+	sector.data.assign(data, data + file->info.sectorbytes);
+	sector.generation = ++file->generation;
+
+	if (!file->writing)
+	{
+		file->writing = (osd_work_item_queue(file->queue, hard_disk_write_back, file, WORK_ITEM_FLAG_AUTO_RELEASE) != nullptr);
+
+		/* if the writer can't be queued, write everything here */
+		if (!file->writing)
+		{
+			file->writing = true;
+			dirtylock.unlock();
+			hard_disk_write_back(file, 0);
+			dirtylock.lock();
+		}
+	}
+	return (file->writeerr == CHDERR_NONE);
+}
+
+
+/*-------------------------------------------------
+    hard_disk_flush - wait until every write has
+    reached the CHD
+-------------------------------------------------*/
+
+/**
+ * @fn  uint32_t hard_disk_flush(hard_disk_file *file)
+ *
+ * @brief   Hard disk flush.
+ *
+ * @param [in,out]  file    If non-null, the file.
+ *
+ * @return  An uint32_t; zero if any write failed.
+ */
+
+uint32_t hard_disk_flush(hard_disk_file *file)
+{
+	if (file->queue == nullptr)
+		return 1;
+
+	std::unique_lock<std::mutex> dirtylock(file->dirtylock);
+	while (file->writing)
+		file->dirtychanged.wait(dirtylock);
+	return (file->writeerr == CHDERR_NONE);
 }
@@ -45,5 +45,6 @@ hard_disk_info *hard_disk_get_info(hard_disk_file *file);
 
 uint32_t hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer);
 uint32_t hard_disk_write(hard_disk_file *file, uint32_t lbasector, const void *buffer);
+uint32_t hard_disk_flush(hard_disk_file *file);
 
 #endif  /* __HARDDISK_H__ */
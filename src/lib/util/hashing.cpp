@@ -13,6 +13,19 @@
 #include <iomanip>
 #include <sstream>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HASHING_CRC32_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__) && (defined(__clang__) || (__GNUC__ >= 10)) && (defined(__linux__) || defined(__APPLE__))
+#define HASHING_CRC32_ARM 1
+#include <arm_acle.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#endif
+
 
 namespace util {
 //**************************************************************************
@@ -179,6 +192,225 @@ std::string crc32_t::as_string() const
 }
 
 
+#if defined(HASHING_CRC32_X86)
+
+//-------------------------------------------------
+//  crc32_clmul - fold 64-byte blocks with
+//  PCLMULQDQ and finish with a Barrett reduction;
+//  length must be a multiple of 16 and at least
+//  64, and the CRC is passed and returned
+//  without the final inversion
+//-------------------------------------------------
+
+__attribute__((target("pclmul,sse4.1")))
+static uint32_t crc32_clmul(uint32_t crc, const uint8_t *buf, uint32_t length)
+{
+	// constants for reflected CRC-32: x^(4*128+32), x^(4*128-32), x^(128+32),
+	// x^(128-32), x^64 mod P, and the polynomial and its Barrett quotient
+	static const uint64_t k1k2[] alignas(16) = { 0x0154442bd4, 0x01c6e41596 };
+	static const uint64_t k3k4[] alignas(16) = { 0x01751997d0, 0x00ccaa009e };
+	static const uint64_t k5k0[] alignas(16) = { 0x0163cd6124, 0x0000000000 };
+	static const uint64_t poly[] alignas(16) = { 0x01db710641, 0x01f7011641 };
+
+	__m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+	// load the first 64 bytes and fold in the initial CRC
+	x1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x00));
+	x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x10));
+	x3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x20));
+	x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x30));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(crc));
+	x0 = _mm_load_si128(reinterpret_cast<const __m128i *>(k1k2));
+	buf += 64;
+	length -= 64;
+
+	// fold four lanes in parallel while 64 or more bytes remain
+	while (length >= 64)
+	{
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+		x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+		x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+		x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+		x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x00)));
+		x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x10)));
+		x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x20)));
+		x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x30)));
+		buf += 64;
+		length -= 64;
+	}
+
+	// fold the four lanes into one
+	x0 = _mm_load_si128(reinterpret_cast<const __m128i *>(k3k4));
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+	// fold in any remaining 16-byte blocks
+	while (length >= 16)
+	{
+		x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf));
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+		buf += 16;
+		length -= 16;
+	}
+
+	// fold 128 bits down to 64
+	x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+	x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+	x1 = _mm_srli_si128(x1, 8);
+	x1 = _mm_xor_si128(x1, x2);
+	x0 = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(k5k0));
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_and_si128(x1, x3);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	// Barrett reduction down to 32 bits
+	x0 = _mm_load_si128(reinterpret_cast<const __m128i *>(poly));
+	x2 = _mm_and_si128(x1, x3);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+	x2 = _mm_and_si128(x2, x3);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+	return _mm_extract_epi32(x1, 1);
+}
+
+
+//-------------------------------------------------
+//  crc32_hardware - CRC-32 using PCLMULQDQ for
+//  the bulk of the data and zlib for the rest
+//-------------------------------------------------
+
+static uint32_t crc32_hardware(uint32_t crc, const uint8_t *buf, uint32_t length)
+{
+	if (length >= 64)
+	{
+		uint32_t const chunk = length & ~15;
+		crc = ~crc32_clmul(~crc, buf, chunk);
+		buf += chunk;
+		length -= chunk;
+	}
+	return length ? crc32(crc, buf, length) : crc;
+}
+
+
+//-------------------------------------------------
+//  crc32_hardware_available - check for
+//  PCLMULQDQ and SSE4.1
+//-------------------------------------------------
+
+static bool crc32_hardware_available()
+{
+	unsigned eax, ebx, ecx, edx;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+		return false;
+	return (ecx & bit_PCLMUL) && (ecx & bit_SSE4_1);
+}
+
+#elif defined(HASHING_CRC32_ARM)
+
+//-------------------------------------------------
+//  crc32_hardware - CRC-32 using the ARMv8 CRC32
+//  instructions eight bytes at a time
+//-------------------------------------------------
+
+#if defined(__clang__)
+__attribute__((target("crc")))
+#else
+__attribute__((target("+crc")))
+#endif
+static uint32_t crc32_hardware(uint32_t crc, const uint8_t *buf, uint32_t length)
+{
+	crc = ~crc;
+	for ( ; length && (uintptr_t(buf) & 7); length--)
+		crc = __crc32b(crc, *buf++);
+	for ( ; length >= 8; length -= 8, buf += 8)
+	{
+		uint64_t data;
+		memcpy(&data, buf, sizeof(data));
+		crc = __crc32d(crc, data);
+	}
+	for ( ; length; length--)
+		crc = __crc32b(crc, *buf++);
+	return ~crc;
+}
+
+
+//-------------------------------------------------
+//  crc32_hardware_available - check for the CRC32
+//  instructions
+//-------------------------------------------------
+
+static bool crc32_hardware_available()
+{
+#if defined(__APPLE__)
+	return true;
+#else
+	return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#endif
+}
+
+#endif
+
+
+//-------------------------------------------------
+//  crc32_use_hardware - whether to use the
+//  hardware implementation; decided on first use
+//-------------------------------------------------
+
+#if defined(HASHING_CRC32_X86) || defined(HASHING_CRC32_ARM)
+static bool &crc32_use_hardware()
+{
+	static bool s_use = crc32_hardware_available();
+	return s_use;
+}
+#endif
+
+
+//-------------------------------------------------
+//  hash_acceleration_available - return true if
+//  either CRC-32 or SHA-1 can use instructions
+//  specific to this CPU
+//-------------------------------------------------
+
+bool hash_acceleration_available()
+{
+#if defined(HASHING_CRC32_X86) || defined(HASHING_CRC32_ARM)
+	if (crc32_hardware_available())
+		return true;
+#endif
+	return sha1_accelerated_available() != 0;
+}
+
+
+//-------------------------------------------------
+//  set_hash_acceleration - enable or disable the
+//  CPU-specific implementations, for testing and
+//  benchmarking; enabling has no effect where
+//  they aren't supported
+//-------------------------------------------------
+
+void set_hash_acceleration(bool enable)
+{
+#if defined(HASHING_CRC32_X86) || defined(HASHING_CRC32_ARM)
+	crc32_use_hardware() = enable && crc32_hardware_available();
+#endif
+	sha1_set_accelerated(enable ? 1 : 0);
+}
+
+
 //-------------------------------------------------
 //  append - hash a block of data, appending to
 //  the currently-accumulated value
@@ -186,6 +418,13 @@ std::string crc32_t::as_string() const
 
 void crc32_creator::append(const void *data, uint32_t length)
 {
+#if defined(HASHING_CRC32_X86) || defined(HASHING_CRC32_ARM)
+	if (crc32_use_hardware())
+	{
+		m_accum.m_raw = crc32_hardware(m_accum, reinterpret_cast<const uint8_t *>(data), length);
+		return;
+	}
+#endif
 	m_accum.m_raw = crc32(m_accum, reinterpret_cast<const Bytef *>(data), length);
 }
 
@@ -23,6 +23,16 @@
 
 
 namespace util {
+//**************************************************************************
+//  FUNCTION PROTOTYPES
+//**************************************************************************
+
+// CRC-32 and SHA-1 use instructions specific to the CPU where available
+bool hash_acceleration_available();
+void set_hash_acceleration(bool enable);
+
+
+
 //**************************************************************************
 //  TYPE DEFINITIONS
 //**************************************************************************
@@ -753,9 +753,73 @@ huffman_error huffman_8bit_decoder::decode(const uint8_t *source, uint32_t sleng
 	if (err != HUFFERR_NONE)
 		return err;
 
-	// then decode the data
-	for (uint32_t cur = 0; cur < dlength; cur++)
-		dest[cur] = decode_one(bitbuf);
+	// small buffers don't repay building the multi-symbol table
+	if (dlength < (1 << MULTI_BITS))
+	{
+		for (uint32_t cur = 0; cur < dlength; cur++)
+			dest[cur] = decode_one(bitbuf);
+		bitbuf.flush();
+		return bitbuf.overflow() ? HUFFERR_INPUT_BUFFER_TOO_SMALL : HUFFERR_NONE;
+	}
+
+	// otherwise, decode up to two short codes per lookup, falling back to
+	// decode_one for codes longer than the table
+	build_multi_table();
+	uint32_t cur = 0;
+	while (cur < dlength)
+	{
+		uint32_t entry = m_multi[bitbuf.peek(MULTI_BITS)];
+		if ((entry & MULTI_TWO) && cur + 1 < dlength)
+		{
+			dest[cur++] = entry;
+			dest[cur++] = entry >> 16;
+			bitbuf.remove((entry >> 24) & 0x1f);
+		}
+		else if (entry != 0)
+		{
+			dest[cur++] = entry;
+			bitbuf.remove((entry >> 8) & 0x1f);
+		}
+		else
+			dest[cur++] = decode_one(bitbuf);
+	}
 	bitbuf.flush();
 	return bitbuf.overflow() ? HUFFERR_INPUT_BUFFER_TOO_SMALL : HUFFERR_NONE;
 }
+
+
+//-------------------------------------------------
+//  build_multi_table - build the table of symbols
+//  decoded by each MULTI_BITS-bit prefix
+//-------------------------------------------------
+
+void huffman_8bit_decoder::build_multi_table()
+{
+	// start with the codes that fit in the table; a zero entry means the prefix
+	// begins a longer code
+	memset(m_multi, 0, sizeof(m_multi));
+	for (int curcode = 0; curcode < m_numcodes; curcode++)
+	{
+		node_t &node = m_huffnode[curcode];
+		if (node.m_numbits > 0 && node.m_numbits <= MULTI_BITS)
+		{
+			int shift = MULTI_BITS - node.m_numbits;
+			uint32_t value = curcode | (node.m_numbits << 8);
+			for (uint32_t prefix = node.m_bits << shift; prefix < ((node.m_bits + 1) << shift); prefix++)
+				m_multi[prefix] = value;
+		}
+	}
+
+	// then add a second symbol wherever the rest of the prefix holds a whole code
+	for (uint32_t prefix = 0; prefix < (1 << MULTI_BITS); prefix++)
+	{
+		uint32_t first = m_multi[prefix];
+		if (first == 0)
+			continue;
+		int firstbits = (first >> 8) & 0x1f;
+		uint32_t second = m_multi[(prefix << firstbits) & ((1 << MULTI_BITS) - 1)];
+		int secondbits = (second >> 8) & 0x1f;
+		if (second != 0 && firstbits + secondbits <= MULTI_BITS)
+			m_multi[prefix] = (first & 0xffff) | ((second & 0xff) << 16) | ((firstbits + secondbits) << 24) | MULTI_TWO;
+	}
+}
@@ -167,6 +167,20 @@ public:
 
 	// operations
 	huffman_error decode(const uint8_t *source, uint32_t slength, uint8_t *dest, uint32_t destlength);
+
+private:
+	// number of bits peeked for the multi-symbol table
+	static const int MULTI_BITS = 11;
+
+	// multi-symbol table entries: first symbol and its length, then an optional
+	// second symbol and the total length of both
+	static const uint32_t MULTI_TWO = 0x80000000;
+
+	// internal helpers
+	void build_multi_table();
+
+	// internal state
+	uint32_t                  m_multi[1 << MULTI_BITS]; // symbols decoded by each MULTI_BITS prefix
 };
 
 
@@ -95,6 +95,25 @@ core_options::entry::entry(const char *name, const char *description, uint32_t f
 	if (defvalue != nullptr)
 		m_defdata = defvalue;
 	m_data = m_defdata;
+	parse_data();
+
+	// boolean items can also be turned off with a "no" prefix
+	if (type() == OPTION_BOOLEAN)
+		for (int index = 0; index < ARRAY_LENGTH(m_name); index++)
+			if (!m_name[index].empty())
+				m_noname[index] = std::string("no").append(m_name[index]);
+}
+
+
+//-------------------------------------------------
+//  parse_data - keep the numeric forms of the
+//  data up to date, so readers don't parse it
+//-------------------------------------------------
+
+void core_options::entry::parse_data()
+{
+	m_intdata = atoi(m_data.c_str());
+	m_floatdata = atof(m_data.c_str());
 }
 
 
@@ -110,6 +129,7 @@ void core_options::entry::set_value(const char *newdata, int priority)
 
 	// set the data and priority, then bump the sequence
 	m_data = newdata;
+	parse_data();
 	m_priority = priority;
 	m_seqid++;
 }
@@ -124,6 +144,7 @@ void core_options::entry::set_default_value(const char *defvalue)
 {
 	m_data = defvalue;
 	m_defdata = defvalue;
+	parse_data();
 	m_priority = OPTION_PRIORITY_DEFAULT;
 }
 
@@ -156,6 +177,7 @@ void core_options::entry::revert(int priority_hi, int priority_lo)
 	if (m_priority <= priority_hi && m_priority >= priority_lo)
 	{
 		m_data = m_defdata;
+		parse_data();
 		m_priority = OPTION_PRIORITY_DEFAULT;
 	}
 }
@@ -267,7 +289,7 @@ void core_options::add_entry(const char *name, const char *description, uint32_t
 			entry *existing = checkentry->second;
 			// if we're overriding existing entries, then remove the old one
 			if (override_existing)
-				m_entrylist.remove(*existing);
+				remove_entry(*existing);
 
 			// otherwise, just override the default and current values and throw out the new entry
 			else
@@ -704,8 +726,8 @@ void core_options::append_entry(core_options::entry &newentry)
 		{
 			m_entrymap.insert(std::make_pair(newentry.name(name), &newentry));
 			// for boolean options add a "no" variant as well
-			if (newentry.type() == OPTION_BOOLEAN)
-				m_entrymap.insert(std::make_pair(std::string("no").append(newentry.name(name)), &newentry));
+			if (!newentry.m_noname[name].empty())
+				m_entrymap.insert(std::make_pair(newentry.m_noname[name].c_str(), &newentry));
 		}
 }
 
@@ -721,8 +743,15 @@ void core_options::remove_entry(core_options::entry &delentry)
 	for (int name = 0; name < ARRAY_LENGTH(delentry.m_name); name++)
 		if (!delentry.m_name[name].empty())
 		{
-			auto entry = m_entrymap.find(delentry.m_name[name]);
+			auto entry = m_entrymap.find(delentry.m_name[name].c_str());
 			if (entry!= m_entrymap.end()) m_entrymap.erase(entry);
+
+			// the "no" variant has to go too, since the map points at its name
+			if (!delentry.m_noname[name].empty())
+			{
+				entry = m_entrymap.find(delentry.m_noname[name].c_str());
+				if (entry != m_entrymap.end()) m_entrymap.erase(entry);
+			}
 		}
 
 	// remove the entry from the list
@@ -78,6 +78,9 @@ public:
 		const char *name(int index = 0) const { return (index < ARRAY_LENGTH(m_name) && !m_name[index].empty()) ? m_name[index].c_str() : nullptr; }
 		const char *description() const { return m_description; }
 		const char *value() const { return m_data.c_str(); }
+		bool bool_value() const { return m_intdata != 0; }
+		int int_value() const { return m_intdata; }
+		float float_value() const { return m_floatdata; }
 		const char *default_value() const { return m_defdata.c_str(); }
 		const char *minimum() const { return m_minimum.c_str(); }
 		const char *maximum() const { return m_maximum.c_str(); }
@@ -100,6 +103,9 @@ public:
 		void revert(int priority_hi, int priority_lo);
 
 	private:
+		// internal helpers
+		void parse_data();
+
 		// internal state
 		entry *                 m_next;             // link to the next data
 		uint32_t                  m_flags;            // flags from the entry
@@ -108,7 +114,10 @@ public:
 		int                     m_priority;         // priority of the data set
 		const char *            m_description;      // description for this item
 		std::string             m_name[4];          // up to 4 names for the item
+		std::string             m_noname[4];        // "no" forms of the names, for boolean items
 		std::string             m_data;             // data for this item
+		int                     m_intdata;          // data parsed as an integer
+		float                   m_floatdata;        // data parsed as a float
 		std::string             m_defdata;          // default data for this item
 		std::string             m_minimum;          // minimum value
 		std::string             m_maximum;          // maximum value
@@ -161,9 +170,9 @@ public:
 	const char *value(const char *option) const;
 	const char *description(const char *option) const;
 	int priority(const char *option) const;
-	bool bool_value(const char *name) const { return (atoi(value(name)) != 0); }
-	int int_value(const char *name) const { return atoi(value(name)); }
-	float float_value(const char *name) const { return atof(value(name)); }
+	bool bool_value(const char *name) const { entry const *const curentry = get_entry(name); return curentry && curentry->bool_value(); }
+	int int_value(const char *name) const { entry const *const curentry = get_entry(name); return curentry ? curentry->int_value() : 0; }
+	float float_value(const char *name) const { entry const *const curentry = get_entry(name); return curentry ? curentry->float_value() : 0.0f; }
 	uint32_t seqid(const char *name) const;
 	bool exists(const char *name) const;
 	bool is_changed(const char *name) const;
@@ -186,9 +195,25 @@ private:
 	void copyfrom(const core_options &src);
 	bool validate_and_set_data(entry &curentry, const char *newdata, int priority, std::string &error_string);
 
+	// hash and compare names in place; the keys point at names owned by the entries
+	struct name_hash
+	{
+		size_t operator()(const char *name) const
+		{
+			size_t result = 2166136261U;
+			while (*name != 0)
+				result = (result ^ uint8_t(*name++)) * 16777619U;
+			return result;
+		}
+	};
+	struct name_equal
+	{
+		bool operator()(const char *name1, const char *name2) const { return strcmp(name1, name2) == 0; }
+	};
+
 	// internal state
 	simple_list<entry>      m_entrylist;            // head of list of entries
-	std::unordered_map<std::string,entry *>       m_entrymap;             // map for fast lookup
+	std::unordered_map<const char *, entry *, name_hash, name_equal> m_entrymap; // map for fast lookup without building a string
 	std::string             m_command;              // command found
 	static const char *const s_option_unadorned[];  // array of unadorned option "names"
 };
@@ -15,7 +15,9 @@
 #include <zlib.h>
 #include "png.h"
 
+#include <atomic>
 #include <new>
+#include <vector>
 
 
 /***************************************************************************
@@ -40,6 +42,35 @@ struct png_private
 };
 
 
+/* image data is deflated in pieces of this size, in parallel; each piece
+   is primed with the window preceding it so little compression is lost */
+#define DEFLATE_PIECE_SIZE  (256 * 1024)
+#define DEFLATE_WINDOW_SIZE 32768
+
+struct deflate_piece
+{
+	const uint8_t *     data;           /* input for this piece */
+	uint32_t            length;         /* length of the input */
+	uint32_t            dictlength;     /* length of the window preceding the input */
+	int                 level;          /* zlib compression level */
+	bool                last;           /* true to finish the stream */
+	std::vector<uint8_t> output;        /* raw deflated data */
+	uint32_t            adler;          /* Adler-32 of the input */
+	bool                success;        /* true if the piece was compressed */
+};
+
+
+struct filter_band
+{
+	const uint8_t *     src;            /* unfiltered image, with filter bytes */
+	uint8_t *           dst;            /* filtered image */
+	int                 bpp;            /* bytes per pixel */
+	int                 rowbytes;       /* bytes per row, excluding the filter byte */
+	uint32_t            starty;         /* first row of the band */
+	uint32_t            endy;           /* row after the last row of the band */
+};
+
+
 
 /***************************************************************************
     GLOBAL VARIABLES
@@ -47,6 +78,8 @@ struct png_private
 
 static const int samples[] = { 1, 0, 3, 1, 2, 0, 4 };
 
+static std::atomic<int> compression_level(Z_DEFAULT_COMPRESSION);
+
 
 
 /***************************************************************************
@@ -778,6 +811,67 @@ static png_error write_chunk(util::core_file &fp, const uint8_t *data, uint32_t
 }
 
 
+/*-------------------------------------------------
+    run_in_parallel - run a callback over a set
+    of work items on a work queue, or directly if
+    there is only one
+-------------------------------------------------*/
+
+template <typename T>
+static void run_in_parallel(osd_work_callback callback, std::vector<T> &items)
+{
+	osd_work_queue *queue = (items.size() > 1) ? osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI) : nullptr;
+	if (queue == nullptr)
+	{
+		for (T &item : items)
+			(*callback)(&item, 0);
+		return;
+	}
+	osd_work_item_queue_multiple(queue, callback, items.size(), &items[0], sizeof(items[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	while (!osd_work_queue_wait(queue, osd_ticks_per_second() * 10)) { }
+	osd_work_queue_free(queue);
+}
+
+
+/*-------------------------------------------------
+    deflate_piece_callback - deflate one piece of
+    a chunk as raw deflate data, ending on a byte
+    boundary unless it is the last
+-------------------------------------------------*/
+
+static void *deflate_piece_callback(void *param, int threadid)
+{
+	deflate_piece &piece = *reinterpret_cast<deflate_piece *>(param);
+	z_stream stream;
+	int zerr;
+
+	piece.success = false;
+	piece.adler = adler32(adler32(0, nullptr, 0), piece.data, piece.length);
+
+	/* initialize the stream, priming it with the preceding window */
+	memset(&stream, 0, sizeof(stream));
+	if (deflateInit2(&stream, piece.level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+		return nullptr;
+	if (piece.dictlength != 0 && deflateSetDictionary(&stream, piece.data - piece.dictlength, piece.dictlength) != Z_OK)
+	{
+		deflateEnd(&stream);
+		return nullptr;
+	}
+
+	/* compress it in one go; the bound leaves room for the flush marker */
+	piece.output.resize(deflateBound(&stream, piece.length) + 16);
+	stream.next_in = const_cast<Bytef *>(piece.data);
+	stream.avail_in = piece.length;
+	stream.next_out = &piece.output[0];
+	stream.avail_out = piece.output.size();
+	zerr = deflate(&stream, piece.last ? Z_FINISH : Z_SYNC_FLUSH);
+	piece.success = piece.last ? (zerr == Z_STREAM_END) : (zerr == Z_OK && stream.avail_in == 0 && stream.avail_out != 0);
+	piece.output.resize(piece.output.size() - stream.avail_out);
+	deflateEnd(&stream);
+	return nullptr;
+}
+
+
 /*-------------------------------------------------
     write_deflated_chunk - write an in-memory
     chunk to the given file by deflating it
@@ -785,15 +879,44 @@ static png_error write_chunk(util::core_file &fp, const uint8_t *data, uint32_t
 
 static png_error write_deflated_chunk(util::core_file &fp, uint8_t *data, uint32_t type, uint32_t length)
 {
-	uint64_t lengthpos = fp.tell();
-	uint8_t tempbuff[8192];
-	uint32_t zlength = 0;
-	z_stream stream;
+	int const level = compression_level;
+	uint8_t tempbuff[8];
+	uint32_t zlength;
 	uint32_t crc;
-	int zerr;
+
+	/* split the data into pieces and deflate them, in parallel if there is more than one */
+	int const numpieces = std::max<int>(1, (length + DEFLATE_PIECE_SIZE - 1) / DEFLATE_PIECE_SIZE);
+	std::vector<deflate_piece> pieces(numpieces);
+	for (int piecenum = 0; piecenum < numpieces; piecenum++)
+	{
+		deflate_piece &piece = pieces[piecenum];
+		uint32_t const start = piecenum * DEFLATE_PIECE_SIZE;
+		piece.data = data + start;
+		piece.length = std::min<uint32_t>(length - start, DEFLATE_PIECE_SIZE);
+		piece.dictlength = std::min<uint32_t>(start, DEFLATE_WINDOW_SIZE);
+		piece.level = level;
+		piece.last = (piecenum == numpieces - 1);
+	}
+	run_in_parallel(deflate_piece_callback, pieces);
+
+	/* the zlib header goes in front, with the level hint zlib itself would use */
+	uint8_t const cmf = 0x78;
+	uint8_t flg = ((level == Z_DEFAULT_COMPRESSION || level == 6) ? 2 : (level < 2) ? 0 : (level < 6) ? 1 : 3) << 6;
+	flg += 31 - ((cmf * 256 + flg) % 31);
+
+	/* the stream is the header, the pieces and the Adler-32 of the data */
+	uint32_t adler = adler32(0, nullptr, 0);
+	zlength = 2 + 4;
+	for (deflate_piece &piece : pieces)
+	{
+		if (!piece.success)
+			return PNGERR_COMPRESS_ERROR;
+		adler = adler32_combine(adler, piece.adler, piece.length);
+		zlength += piece.output.size();
+	}
 
 	/* stuff the length/type into the buffer */
-	put_32bit(tempbuff + 0, length);
+	put_32bit(tempbuff + 0, zlength);
 	put_32bit(tempbuff + 4, type);
 	crc = crc32(0, tempbuff + 4, 4);
 
@@ -801,65 +924,33 @@ static png_error write_deflated_chunk(util::core_file &fp, uint8_t *data, uint32
 	if (fp.write(tempbuff, 8) != 8)
 		return PNGERR_FILE_ERROR;
 
-	/* initialize the stream */
-	memset(&stream, 0, sizeof(stream));
-	stream.next_in = data;
-	stream.avail_in = length;
-	zerr = deflateInit(&stream, Z_DEFAULT_COMPRESSION);
-	if (zerr != Z_OK)
-		return PNGERR_COMPRESS_ERROR;
-
-	/* now loop until we run out of data */
-	for ( ; ; )
-	{
-		/* compress this chunk */
-		stream.next_out = tempbuff;
-		stream.avail_out = sizeof(tempbuff);
-		zerr = deflate(&stream, Z_FINISH);
+	/* write the zlib header */
+	put_8bit(tempbuff + 0, cmf);
+	put_8bit(tempbuff + 1, flg);
+	if (fp.write(tempbuff, 2) != 2)
+		return PNGERR_FILE_ERROR;
+	crc = crc32(crc, tempbuff, 2);
 
-		/* if there's data to write, do it */
-		if (stream.avail_out < sizeof(tempbuff))
+	/* append the deflated pieces in order */
+	for (deflate_piece &piece : pieces)
+		if (!piece.output.empty())
 		{
-			int bytes = sizeof(tempbuff) - stream.avail_out;
-			if (fp.write(tempbuff, bytes) != bytes)
-			{
-				deflateEnd(&stream);
+			if (fp.write(&piece.output[0], piece.output.size()) != piece.output.size())
 				return PNGERR_FILE_ERROR;
-			}
-			crc = crc32(crc, tempbuff, bytes);
-			zlength += bytes;
+			crc = crc32(crc, &piece.output[0], piece.output.size());
 		}
 
-		/* stop at the end of the stream */
-		if (zerr == Z_STREAM_END)
-			break;
-
-		/* other errors are fatal */
-		if (zerr != Z_OK)
-		{
-			deflateEnd(&stream);
-			return PNGERR_COMPRESS_ERROR;
-		}
-	}
-
-	/* clean up deflater(maus) */
-	zerr = deflateEnd(&stream);
-	if (zerr != Z_OK)
-		return PNGERR_COMPRESS_ERROR;
-
-	/* write the CRC */
-	put_32bit(tempbuff, crc);
+	/* write the Adler-32 */
+	put_32bit(tempbuff, adler);
 	if (fp.write(tempbuff, 4) != 4)
 		return PNGERR_FILE_ERROR;
+	crc = crc32(crc, tempbuff, 4);
 
-	/* seek back and update the length */
-	fp.seek(lengthpos, SEEK_SET);
-	put_32bit(tempbuff + 0, zlength);
+	/* write the CRC */
+	put_32bit(tempbuff, crc);
 	if (fp.write(tempbuff, 4) != 4)
 		return PNGERR_FILE_ERROR;
 
-	/* return to the end */
-	fp.seek(lengthpos + 8 + zlength + 4, SEEK_SET);
 	return PNGERR_NONE;
 }
 
@@ -1001,6 +1092,135 @@ static png_error convert_bitmap_to_image_rgb(png_info *pnginfo, const bitmap_t &
 }
 
 
+/*-------------------------------------------------
+    filter_row_cost - return the sum of the
+    filtered bytes taken as signed values, the
+    usual estimate of how well a row compresses
+-------------------------------------------------*/
+
+static inline uint32_t filter_row_cost(const uint8_t *row, int rowbytes)
+{
+	uint32_t cost = 0;
+	for (int x = 0; x < rowbytes; x++)
+		cost += std::abs(int(int8_t(row[x])));
+	return cost;
+}
+
+
+/*-------------------------------------------------
+    filter_band_callback - pick the Sub, Up or
+    Paeth filter for each row of a band where it
+    beats no filter, and write the filtered rows;
+    the loops are simple enough for the compiler
+    to vectorize
+-------------------------------------------------*/
+
+static void *filter_band_callback(void *param, int threadid)
+{
+	filter_band &band = *reinterpret_cast<filter_band *>(param);
+	int const bpp = band.bpp;
+	int const rowbytes = band.rowbytes;
+	std::vector<uint8_t> filtered(3 * rowbytes);
+	uint8_t *const sub = &filtered[0 * rowbytes];
+	uint8_t *const up = &filtered[1 * rowbytes];
+	uint8_t *const paeth = &filtered[2 * rowbytes];
+
+	for (uint32_t y = band.starty; y < band.endy; y++)
+	{
+		uint8_t const *const cur = band.src + y * (rowbytes + 1) + 1;
+		uint8_t *const dst = band.dst + y * (rowbytes + 1);
+
+		/* Sub predicts from the pixel to the left */
+		for (int x = 0; x < bpp; x++)
+			sub[x] = cur[x];
+		for (int x = bpp; x < rowbytes; x++)
+			sub[x] = cur[x] - cur[x - bpp];
+
+		uint32_t bestcost = filter_row_cost(cur, rowbytes);
+		uint8_t const *best = cur;
+		dst[0] = PNG_PF_None;
+		uint32_t const subcost = filter_row_cost(sub, rowbytes);
+		if (subcost < bestcost)
+		{
+			bestcost = subcost;
+			best = sub;
+			dst[0] = PNG_PF_Sub;
+		}
+
+		/* Up and Paeth need a row above */
+		if (y > 0)
+		{
+			uint8_t const *const prev = cur - (rowbytes + 1);
+
+			for (int x = 0; x < rowbytes; x++)
+				up[x] = cur[x] - prev[x];
+
+			for (int x = 0; x < bpp; x++)
+				paeth[x] = cur[x] - prev[x];
+			for (int x = bpp; x < rowbytes; x++)
+			{
+				int const a = cur[x - bpp], b = prev[x], c = prev[x - bpp];
+				int const pa = std::abs(b - c), pb = std::abs(a - c), pc = std::abs(a + b - 2 * c);
+				paeth[x] = cur[x] - ((pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c);
+			}
+
+			uint32_t const upcost = filter_row_cost(up, rowbytes);
+			if (upcost < bestcost)
+			{
+				bestcost = upcost;
+				best = up;
+				dst[0] = PNG_PF_Up;
+			}
+			uint32_t const paethcost = filter_row_cost(paeth, rowbytes);
+			if (paethcost < bestcost)
+			{
+				bestcost = paethcost;
+				best = paeth;
+				dst[0] = PNG_PF_Paeth;
+			}
+		}
+
+		/* store the filtered row after the filter byte */
+		memcpy(dst + 1, best, rowbytes);
+	}
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    filter_image - filter an image into a new
+    buffer, a band of rows at a time in parallel
+-------------------------------------------------*/
+
+static png_error filter_image(png_info *pnginfo)
+{
+	int const rowbytes = compute_rowbytes(pnginfo);
+	uint8_t *const filtered = (uint8_t *)malloc(pnginfo->height * (rowbytes + 1));
+	if (filtered == nullptr)
+		return PNGERR_OUT_OF_MEMORY;
+
+	/* bands are about the size of a deflate piece */
+	uint32_t const bandrows = std::max<uint32_t>(1, DEFLATE_PIECE_SIZE / (rowbytes + 1));
+	int const numbands = (pnginfo->height + bandrows - 1) / bandrows;
+	std::vector<filter_band> bands(numbands);
+	for (int bandnum = 0; bandnum < numbands; bandnum++)
+	{
+		filter_band &band = bands[bandnum];
+		band.src = pnginfo->image;
+		band.dst = filtered;
+		band.bpp = compute_bpp(pnginfo);
+		band.rowbytes = rowbytes;
+		band.starty = bandnum * bandrows;
+		band.endy = std::min<uint32_t>(pnginfo->height, band.starty + bandrows);
+	}
+	run_in_parallel(filter_band_callback, bands);
+
+	free(pnginfo->image);
+	pnginfo->image = filtered;
+	return PNGERR_NONE;
+}
+
+
 /*-------------------------------------------------
     write_png_stream - stream a series of PNG
     chunks to the given file
@@ -1020,7 +1240,11 @@ static png_error write_png_stream(util::core_file &fp, png_info *pnginfo, const
 	if (error != PNGERR_NONE)
 		goto handle_error;
 
-	/* if we wanted to get clever and do filtering, we would do it here */
+	/* filter RGB images; palette indices don't predict well */
+	if (pnginfo->color_type != 3)
+		error = filter_image(pnginfo);
+	if (error != PNGERR_NONE)
+		goto handle_error;
 
 	/* write the IHDR chunk */
 	put_32bit(tempbuff + 0, pnginfo->width);
@@ -1061,6 +1285,18 @@ handle_error:
 }
 
 
+/*-------------------------------------------------
+    png_set_compression_level - set the zlib
+    compression level used when writing, from 1
+    (fastest) to 9 (smallest)
+-------------------------------------------------*/
+
+void png_set_compression_level(int level)
+{
+	compression_level = (level >= 1 && level <= 9) ? level : Z_DEFAULT_COMPRESSION;
+}
+
+
 png_error png_write_bitmap(util::core_file &fp, png_info *info, bitmap_t &bitmap, int palette_length, const rgb_t *palette)
 {
 	png_info pnginfo;
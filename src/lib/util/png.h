@@ -124,6 +124,7 @@ png_error png_read_bitmap(util::core_file &fp, bitmap_argb32 &bitmap);
 png_error png_expand_buffer_8bit(png_info *p);
 
 png_error png_add_text(png_info *pnginfo, const char *keyword, const char *text);
+void png_set_compression_level(int level);
 png_error png_write_bitmap(util::core_file &fp, png_info *info, bitmap_t &bitmap, int palette_length, const rgb_t *palette);
 
 png_error mng_capture_start(util::core_file &fp, bitmap_t &bitmap, double rate);
@@ -31,6 +31,19 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SHA1_HW_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__) && (defined(__clang__) || (__GNUC__ >= 10)) && (defined(__linux__) || defined(__APPLE__))
+#define SHA1_HW_ARM 1
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#endif
+
 static unsigned int READ_UINT32(const uint8_t* data)
 {
 	return ((uint32_t)data[0] << 24) |
@@ -293,6 +306,308 @@ sha1_block(struct sha1_ctx *ctx, const uint8_t *block)
 	sha1_transform(ctx->digest, data);
 }
 
+#if defined(SHA1_HW_X86)
+
+/* Hash whole blocks with the SHA extensions (SHA-NI).  The state is kept
+   as ABCD in one register, in reverse order, and E in the top lane of
+   another. */
+
+__attribute__((target("sha,sse4.1")))
+static void
+sha1_blocks_hw(uint32_t *state, const uint8_t *data, unsigned blocks)
+{
+	const __m128i mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+	__m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(state)), 0x1b);
+	__m128i e0 = _mm_set_epi32(state[4], 0, 0, 0);
+	__m128i e1, msg0, msg1, msg2, msg3;
+
+	for ( ; blocks > 0; blocks--, data += SHA1_DATA_SIZE)
+	{
+		const __m128i abcd_save = abcd;
+		const __m128i e0_save = e0;
+
+		// rounds 0-3
+		msg0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0)), mask);
+		e0 = _mm_add_epi32(e0, msg0);
+		e1 = abcd;
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+		// rounds 4-7
+		msg1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 16)), mask);
+		e1 = _mm_sha1nexte_epu32(e1, msg1);
+		e0 = abcd;
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+		msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+
+		// rounds 8-11
+		msg2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 32)), mask);
+		e0 = _mm_sha1nexte_epu32(e0, msg2);
+		e1 = abcd;
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+		msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+		msg0 = _mm_xor_si128(msg0, msg2);
+
+		// rounds 12-15
+		msg3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 48)), mask);
+		e1 = _mm_sha1nexte_epu32(e1, msg3);
+		e0 = abcd;
+		msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+		msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+		msg1 = _mm_xor_si128(msg1, msg3);
+
+		// rounds 16-19
+		e0 = _mm_sha1nexte_epu32(e0, msg0);
+		e1 = abcd;
+		msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+		msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+		msg2 = _mm_xor_si128(msg2, msg0);
+
+		// rounds 20-23
+		e1 = _mm_sha1nexte_epu32(e1, msg1);
+		e0 = abcd;
+		msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+		msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+		msg3 = _mm_xor_si128(msg3, msg1);
+
+		// rounds 24-27
+		e0 = _mm_sha1nexte_epu32(e0, msg2);
+		e1 = abcd;
+		msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+		msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+		msg0 = _mm_xor_si128(msg0, msg2);
+
+		// rounds 28-31
+		e1 = _mm_sha1nexte_epu32(e1, msg3);
+		e0 = abcd;
+		msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+		msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+		msg1 = _mm_xor_si128(msg1, msg3);
+
+		// rounds 32-35
+		e0 = _mm_sha1nexte_epu32(e0, msg0);
+		e1 = abcd;
+		msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+		msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+		msg2 = _mm_xor_si128(msg2, msg0);
+
+		// rounds 36-39
+		e1 = _mm_sha1nexte_epu32(e1, msg1);
+		e0 = abcd;
+		msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+		msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+		msg3 = _mm_xor_si128(msg3, msg1);
+
+		// rounds 40-43
+		e0 = _mm_sha1nexte_epu32(e0, msg2);
+		e1 = abcd;
+		msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+		msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+		msg0 = _mm_xor_si128(msg0, msg2);
+
+		// rounds 44-47
+		e1 = _mm_sha1nexte_epu32(e1, msg3);
+		e0 = abcd;
+		msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+		msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+		msg1 = _mm_xor_si128(msg1, msg3);
+
+		// rounds 48-51
+		e0 = _mm_sha1nexte_epu32(e0, msg0);
+		e1 = abcd;
+		msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+		msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+		msg2 = _mm_xor_si128(msg2, msg0);
+
+		// rounds 52-55
+		e1 = _mm_sha1nexte_epu32(e1, msg1);
+		e0 = abcd;
+		msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+		msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+		msg3 = _mm_xor_si128(msg3, msg1);
+
+		// rounds 56-59
+		e0 = _mm_sha1nexte_epu32(e0, msg2);
+		e1 = abcd;
+		msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+		msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+		msg0 = _mm_xor_si128(msg0, msg2);
+
+		// rounds 60-63
+		e1 = _mm_sha1nexte_epu32(e1, msg3);
+		e0 = abcd;
+		msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+		msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+		msg1 = _mm_xor_si128(msg1, msg3);
+
+		// rounds 64-67
+		e0 = _mm_sha1nexte_epu32(e0, msg0);
+		e1 = abcd;
+		msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+		msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+		msg2 = _mm_xor_si128(msg2, msg0);
+
+		// rounds 68-71
+		e1 = _mm_sha1nexte_epu32(e1, msg1);
+		e0 = abcd;
+		msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+		msg3 = _mm_xor_si128(msg3, msg1);
+
+		// rounds 72-75
+		e0 = _mm_sha1nexte_epu32(e0, msg2);
+		e1 = abcd;
+		msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+
+		// rounds 76-79
+		e1 = _mm_sha1nexte_epu32(e1, msg3);
+		e0 = abcd;
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+		// add this block's result to the state
+		e0 = _mm_sha1nexte_epu32(e0, e0_save);
+		abcd = _mm_add_epi32(abcd, abcd_save);
+	}
+
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(state), _mm_shuffle_epi32(abcd, 0x1b));
+	state[4] = _mm_extract_epi32(e0, 3);
+}
+
+static int
+sha1_hw_available(void)
+{
+	unsigned eax, ebx, ecx, edx;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_SSE4_1) || !(ecx & bit_SSSE3))
+		return 0;
+	if (__get_cpuid_max(0, nullptr) < 7)
+		return 0;
+	__cpuid_count(7, 0, eax, ebx, ecx, edx);
+	return (ebx & bit_SHA) != 0;
+}
+
+#elif defined(SHA1_HW_ARM)
+
+/* Hash whole blocks with the ARMv8 cryptography extensions.  Each pass
+   does four rounds and works out the message words for four rounds
+   later. */
+
+#if defined(__clang__)
+__attribute__((target("crypto")))
+#else
+__attribute__((target("+crypto")))
+#endif
+static void
+sha1_blocks_hw(uint32_t *state, const uint8_t *data, unsigned blocks)
+{
+	static const uint32_t k[4] = { 0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xca62c1d6 };
+	uint32x4_t abcd = vld1q_u32(state);
+	uint32_t e = state[4];
+
+	for ( ; blocks > 0; blocks--, data += SHA1_DATA_SIZE)
+	{
+		const uint32x4_t abcd_save = abcd;
+		const uint32_t e_save = e;
+		uint32x4_t w[4];
+		int i;
+
+		for (i = 0; i < 4; i++)
+			w[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16 * i)));
+
+		for (i = 0; i < 20; i++)
+		{
+			const uint32x4_t wk = vaddq_u32(w[i & 3], vdupq_n_u32(k[i / 5]));
+			const uint32_t e_next = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			if (i < 5)
+				abcd = vsha1cq_u32(abcd, e, wk);
+			else if (i >= 10 && i < 15)
+				abcd = vsha1mq_u32(abcd, e, wk);
+			else
+				abcd = vsha1pq_u32(abcd, e, wk);
+			e = e_next;
+			if (i < 16)
+				w[i & 3] = vsha1su1q_u32(vsha1su0q_u32(w[i & 3], w[(i + 1) & 3], w[(i + 2) & 3]), w[(i + 3) & 3]);
+		}
+
+		abcd = vaddq_u32(abcd, abcd_save);
+		e += e_save;
+	}
+
+	vst1q_u32(state, abcd);
+	state[4] = e;
+}
+
+static int
+sha1_hw_available(void)
+{
+#if defined(__APPLE__)
+	return 1;
+#else
+	return (getauxval(AT_HWCAP) & HWCAP_SHA1) != 0;
+#endif
+}
+
+#endif
+
+/* Whether whole blocks go through sha1_blocks_hw; decided on first use. */
+
+#if defined(SHA1_HW_X86) || defined(SHA1_HW_ARM)
+static int &
+sha1_use_hw(void)
+{
+	static int s_use = sha1_hw_available();
+	return s_use;
+}
+#endif
+
+/**
+ * @fn  int sha1_accelerated_available(void)
+ *
+ * @brief   Check for SHA-1 instructions on this CPU.
+ *
+ * @return  Non-zero if they are present.
+ */
+
+int
+sha1_accelerated_available(void)
+{
+#if defined(SHA1_HW_X86) || defined(SHA1_HW_ARM)
+	return sha1_hw_available();
+#else
+	return 0;
+#endif
+}
+
+/**
+ * @fn  void sha1_set_accelerated(int enable)
+ *
+ * @brief   Enable or disable the SHA-1 instructions; enabling has no effect
+ *          if the CPU lacks them.
+ *
+ * @param   enable  Non-zero to use them.
+ */
+
+void
+sha1_set_accelerated(int enable)
+{
+#if defined(SHA1_HW_X86) || defined(SHA1_HW_ARM)
+	sha1_use_hw() = enable && sha1_hw_available();
+#endif
+}
+
 /**
  * @fn  void sha1_update(struct sha1_ctx *ctx, unsigned length, const uint8_t *buffer)
  *
@@ -324,6 +639,18 @@ sha1_update(struct sha1_ctx *ctx,
 		length -= left;
 	}
 	}
+#if defined(SHA1_HW_X86) || defined(SHA1_HW_ARM)
+	if (length >= SHA1_DATA_SIZE && sha1_use_hw())
+	{
+		unsigned blocks = length / SHA1_DATA_SIZE;
+		sha1_blocks_hw(ctx->digest, buffer, blocks);
+		ctx->count_low += blocks;
+		if (ctx->count_low < blocks)
+			++ctx->count_high;
+		buffer += blocks * SHA1_DATA_SIZE;
+		length -= blocks * SHA1_DATA_SIZE;
+	}
+#endif
 	while (length >= SHA1_DATA_SIZE)
 	{
 		sha1_block(ctx, buffer);
@@ -60,4 +60,11 @@ sha1_digest(const struct sha1_ctx *ctx,
 		unsigned length,
 		uint8_t *digest);
 
+/* SHA-1 instructions on x86 (SHA-NI) and ARMv8 are used when present */
+int
+sha1_accelerated_available(void);
+
+void
+sha1_set_accelerated(int enable);
+
 #endif /* NETTLE_SHA1_H_INCLUDED */
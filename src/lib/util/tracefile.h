@@ -0,0 +1,42 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    tracefile.h
+
+    Layout of binary debugger execution traces.
+
+    A trace starts with a header:
+
+        8 bytes     magic ("MAMETRC" followed by a NUL)
+        u32         format version
+        u32         number of hex digits to print addresses with
+        u32         length of the CPU tag, followed by the tag itself
+
+    and is followed by records, each starting with a u32:
+
+        PC          an instruction was executed at this address
+        TEXT_RECORD a u32 length and that many bytes of text follow
+                    (tracelog and logerror output)
+
+    All values are little-endian.
+
+***************************************************************************/
+
+#ifndef MAME_UTIL_TRACEFILE_H
+#define MAME_UTIL_TRACEFILE_H
+
+#pragma once
+
+#include "osdcomm.h"
+
+
+namespace util { namespace tracefile {
+
+constexpr char MAGIC[8] = { 'M', 'A', 'M', 'E', 'T', 'R', 'C', 0 };
+constexpr u32 VERSION = 1;
+constexpr u32 TEXT_RECORD = 0xffffffff;
+
+} } // namespace util::tracefile
+
+#endif // MAME_UTIL_TRACEFILE_H
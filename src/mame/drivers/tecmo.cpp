@@ -69,7 +69,14 @@ WRITE8_MEMBER(tecmo_state::bankswitch_w)
 
 WRITE8_MEMBER(tecmo_state::sound_command_w)
 {
+	// the sound CPU runs in its own execution group, so its input lines may
+	// only be changed from the scheduler thread; the latch synchronizes itself
 	m_soundlatch->write(space, offset, data);
+	machine().scheduler().synchronize(timer_expired_delegate(FUNC(tecmo_state::sound_nmi_assert), this));
+}
+
+TIMER_CALLBACK_MEMBER(tecmo_state::sound_nmi_assert)
+{
 	m_soundcpu->set_input_line(INPUT_LINE_NMI,ASSERT_LINE);
 }
 
@@ -639,6 +646,8 @@ static MACHINE_CONFIG_START( rygar, tecmo_state )
 
 	MCFG_CPU_ADD("soundcpu", Z80, XTAL_4MHz) /* verified on pcb */
 	MCFG_CPU_PROGRAM_MAP(rygar_sound_map)
+	// only talks to the main CPU through the sound latch and NMI, both synchronized
+	MCFG_DEVICE_EXECUTE_GROUP(1)
 
 	MCFG_WATCHDOG_ADD("watchdog")
 
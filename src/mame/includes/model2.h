@@ -289,6 +289,9 @@ public:
 		m_renderfuncs[5] = &model2_renderer::model2_3d_render_5;
 		m_renderfuncs[6] = &model2_renderer::model2_3d_render_6;
 		m_renderfuncs[7] = &model2_renderer::model2_3d_render_7;
+
+		// bin triangles into 32-pixel-wide tiles so each work unit stays within a cache-friendly block of the Z buffer
+		set_tile_width(32);
 	}
 
 	bitmap_rgb32& destmap() { return m_destmap; }
@@ -87,6 +87,10 @@ public:
 
 	void scu_reset(void);
 
+	// master/slave interleave on MINIT/SINIT writes: the scheduler runs with
+	// m_*_boost_timeslice (attotime::zero means perfect interleave) for
+	// m_*_boost microseconds; ST-V sets use a 50us timeslice instead, which
+	// bounds how far the two SH-2s drift apart without switching every instruction
 	int       m_minit_boost;
 	int       m_sinit_boost;
 	attotime  m_minit_boost_timeslice;
@@ -115,9 +119,35 @@ public:
 		int       local_y;
 	}m_vdp1;
 
+	/* rotation plane copies are split into scanline bands on a work queue */
+	static constexpr int STV_ROZ_MIN_BAND_ROWS = 32;
+	static constexpr int STV_ROZ_MAX_BANDS = 8;
+
+	struct stv_roz_line {
+		int32_t     kx, ky, xp;
+		bool        skip;
+	};
+
+	struct stv_roz_band {
+		saturn_state *state;
+		int32_t     min_y, max_y;
+	};
+
 	struct {
 		std::unique_ptr<uint8_t[]>      gfx_decode;
 		bitmap_rgb32 roz_bitmap[2];
+		osd_work_queue *roz_queue;
+		std::vector<stv_roz_line> roz_lines;
+		stv_roz_band roz_bands[STV_ROZ_MAX_BANDS];
+		struct {
+			bitmap_rgb32 *bitmap;
+			bitmap_rgb32 *roz_bitmap;
+			int32_t     min_x, max_x;
+			int32_t     dx, dy, yp;
+			int32_t     clipxmask, clipymask;
+			int32_t     planerenderedsizex, planerenderedsizey;
+			uint8_t     vcnt_shift, hcnt_shift;
+		} roz_copy;
 		uint8_t     dotsel;
 		uint8_t     pal;
 		uint16_t    h_count;
@@ -368,6 +398,9 @@ public:
 	void stv_vdp2_check_tilemap_with_linescroll(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	void stv_vdp2_check_tilemap(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	void stv_vdp2_copy_roz_bitmap(bitmap_rgb32 &bitmap, bitmap_rgb32 &roz_bitmap, const rectangle &cliprect, int iRP, int planesizex, int planesizey, int planerenderedsizex, int planerenderedsizey);
+	void stv_vdp2_copy_roz_bands(int32_t min_y, int32_t max_y);
+	void stv_vdp2_copy_roz_rows(int32_t min_y, int32_t max_y);
+	static void *stv_vdp2_copy_roz_band_callback(void *param, int threadid);
 	void stv_vdp2_fill_rotation_parameter_table( uint8_t rot_parameter );
 	uint8_t stv_vdp2_check_vram_cycle_pattern_registers( uint8_t access_command_pnmdr, uint8_t access_command_cpdr, uint8_t bitmap_enable );
 	uint8_t stv_vdp2_is_rotation_applied(void);
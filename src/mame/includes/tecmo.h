@@ -42,6 +42,17 @@ public:
 	tilemap_t *m_bg_tilemap;
 	uint8_t m_fgscroll[3];
 	uint8_t m_bgscroll[3];
+
+	// scroll registers in effect on each scanline
+	struct scroll_state
+	{
+		int fgx, fgy;
+		int bgx, bgy;
+
+		bool operator==(const scroll_state &rhs) const { return fgx == rhs.fgx && fgy == rhs.fgy && bgx == rhs.bgx && bgy == rhs.bgy; }
+	};
+	screen_raster_state<scroll_state> m_scroll;
+
 	int m_adpcm_pos;
 	int m_adpcm_end;
 	int m_adpcm_data;
@@ -49,6 +60,7 @@ public:
 
 	DECLARE_WRITE8_MEMBER(bankswitch_w);
 	DECLARE_WRITE8_MEMBER(sound_command_w);
+	TIMER_CALLBACK_MEMBER(sound_nmi_assert);
 	DECLARE_WRITE8_MEMBER(nmi_ack_w);
 	DECLARE_WRITE8_MEMBER(adpcm_end_w);
 	DECLARE_READ8_MEMBER(dswa_l_r);
@@ -79,6 +91,7 @@ public:
 	virtual void machine_start() override;
 	virtual void machine_reset() override;
 	virtual void video_start() override;
+	void update_scroll();
 
 	uint32_t screen_update(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect);
 };
@@ -86,27 +86,29 @@ static const uint8_t kov_tab[256] = {
 
 void pgm_kov_decrypt(running_machine &machine)
 {
-	int i;
 	uint16_t *src = (uint16_t *) (machine.root_device().memregion("maincpu")->base()+0x100000);
 
 	int rom_size = 0x400000;
 
-	for(i=0; i<rom_size/2; i++) {
-		uint16_t x = src[i];
+	machine.rom_load().region_transform("maincpu", "pgm_kov_decrypt", 1, 0x100000, rom_size, 2, [src] (uint32_t start, uint32_t end)
+	{
+		for (uint32_t i = start/2; i < end/2; i++) {
+			uint16_t x = src[i];
 
-		IGS27_CRYPT1
-		IGS27_CRYPT2_ALT
-		IGS27_CRYPT3_ALT
-		IGS27_CRYPT4
-		IGS27_CRYPT5
-		IGS27_CRYPT6_ALT
-		IGS27_CRYPT7
-		IGS27_CRYPT8
+			IGS27_CRYPT1
+			IGS27_CRYPT2_ALT
+			IGS27_CRYPT3_ALT
+			IGS27_CRYPT4
+			IGS27_CRYPT5
+			IGS27_CRYPT6_ALT
+			IGS27_CRYPT7
+			IGS27_CRYPT8
 
-		x ^= kov_tab[i & 0xff] << 8;
+			x ^= kov_tab[i & 0xff] << 8;
 
-		src[i] = x;
-	}
+			src[i] = x;
+		}
+	});
 }
 
 
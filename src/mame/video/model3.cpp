@@ -45,6 +45,9 @@ public:
 	{
 		m_fb = std::make_unique<bitmap_rgb32>(width, height);
 		m_zb = std::make_unique<bitmap_ind32>(width, height);
+
+		// bin triangles into 32-pixel-wide tiles so each work unit stays within a cache-friendly block of the Z buffer
+		set_tile_width(32);
 	}
 
 	void draw(bitmap_rgb32 &bitmap, const rectangle &cliprect);
@@ -152,6 +152,7 @@ uint32_t n64_state::screen_update_n64(screen_device &screen, bitmap_rgb32 &bitma
 	*/
 
 	m_rdp->mark_frame();
+	m_rdp->wait_for_renders("VI update");
 
 	if (n64->vi_blank)
 	{
@@ -1903,6 +1904,12 @@ void n64_rdp::draw_triangle(bool shade, bool texture, bool zbuffer, bool rect)
 	int32_t yl = int32_t(w1 >> 32) & 0x3fff;
 	int32_t ym = int32_t(w1 >> 16) & 0x3fff;
 	int32_t yh = int32_t(w1 >>  0) & 0x3fff;
+
+	// span aux data stays live until the primitive is rendered, so only recycle the buffer once everything queued has drained
+	if (m_aux_buf_ptr + (((yl >> 2) - (yh >> 2) + 2) * sizeof(rdp_span_aux)) >= EXTENT_AUX_COUNT)
+	{
+		wait_for_renders("aux buffer full");
+	}
 	int32_t xl = (int32_t)(w2 >> 32) & 0x3fffffff;
 	int32_t xh = (int32_t)(w3 >> 32) & 0x3fffffff;
 	int32_t xm = (int32_t)(w4 >> 32) & 0x3fffffff;
@@ -2195,12 +2202,55 @@ void n64_rdp::draw_triangle(bool shade, bool texture, bool zbuffer, bool rect)
 	{
 		render_spans(yh >> 2, yl >> 2, tilenum, flip ? true : false, spans, rect, object);
 	}
-	m_aux_buf_ptr = 0;  // Spans can be reused once render completes
 	//wait("draw_triangle");
 }
 
 /*****************************************************************************/
 
+void n64_rdp::wait_for_renders(const char *debug)
+{
+	wait(debug);
+	m_aux_buf_ptr = 0;  // Spans can be reused once render completes
+	m_pending_rdram_start = ~0;
+	m_pending_rdram_end = 0;
+}
+
+void n64_rdp::mark_rdram_pending(int32_t start, int32_t end)
+{
+	// queued primitives write scanlines [start, end] of the color image, and of the Z image when Z updates are on
+	const uint32_t fb_stride = (m_misc_state.m_fb_width << m_misc_state.m_fb_size) >> 1;
+	uint32_t range_start = (m_misc_state.m_fb_address & 0x007fffff) + start * fb_stride;
+	uint32_t range_end = (m_misc_state.m_fb_address & 0x007fffff) + (end + 1) * fb_stride;
+
+	if (m_other_modes.z_update_en && m_other_modes.cycle_type < CYCLE_TYPE_COPY)
+	{
+		const uint32_t zb_stride = m_misc_state.m_fb_width << 1;
+		range_start = std::min(range_start, (m_misc_state.m_zb_address & 0x007fffff) + start * zb_stride);
+		range_end = std::max(range_end, (m_misc_state.m_zb_address & 0x007fffff) + (end + 1) * zb_stride);
+	}
+
+	m_pending_rdram_start = std::min(m_pending_rdram_start, range_start);
+	m_pending_rdram_end = std::max(m_pending_rdram_end, range_end);
+}
+
+void n64_rdp::wait_for_rdram(uint32_t start, uint32_t end, const char *debug)
+{
+	// only stall if the region about to be read overlaps something a queued primitive is still drawing
+	if (start < m_pending_rdram_end && end > m_pending_rdram_start)
+	{
+		wait_for_renders(debug);
+	}
+}
+
+void n64_rdp::wait_for_texture_rows(int32_t tl, int32_t th, const char *debug)
+{
+	const uint32_t ti_stride = (m_misc_state.m_ti_width << m_misc_state.m_ti_size) >> 1;
+	const uint32_t ti_address = m_misc_state.m_ti_address & 0x007fffff;
+	wait_for_rdram(ti_address + tl * ti_stride, ti_address + (th + 1) * ti_stride, debug);
+}
+
+/*****************************************************************************/
+
 ////////////////////////
 // RDP COMMANDS
 ////////////////////////
@@ -2355,7 +2405,8 @@ void n64_rdp::cmd_sync_tile(uint64_t w1)
 
 void n64_rdp::cmd_sync_full(uint64_t w1)
 {
-	//wait("SyncFull");
+	// the CPU is free to read the frame buffer once the full-sync interrupt fires
+	wait_for_renders("SyncFull");
 	dp_full_sync(*m_machine);
 }
 
@@ -2378,7 +2429,7 @@ void n64_rdp::cmd_set_fill_color32(uint64_t w1)
 
 void n64_rdp::cmd_set_convert(uint64_t w1)
 {
-	if(!m_pipe_clean) { m_pipe_clean = true; wait("SetConvert"); }
+	if(!m_pipe_clean) { m_pipe_clean = true; wait_for_renders("SetConvert"); }
 	int32_t k0 = int32_t(w1 >> 45) & 0x1ff;
 	int32_t k1 = int32_t(w1 >> 36) & 0x1ff;
 	int32_t k2 = int32_t(w1 >> 27) & 0x1ff;
@@ -2469,6 +2520,8 @@ void n64_rdp::cmd_load_tlut(uint64_t w1)
 		fatalerror("Load tlut: tl=%d, th=%d\n",tl,th);
 	}
 
+	wait_for_texture_rows(tl >> 2, th >> 2, "LoadTLUT");
+
 	m_capture.data_begin();
 
 	const int32_t count = ((sh >> 2) - (sl >> 2) + 1) << 2;
@@ -2551,6 +2604,10 @@ void n64_rdp::cmd_load_block(uint64_t w1)
 	}
 	width >>= 3;
 
+	// a block load is one contiguous run of RDRAM starting at row tl
+	const uint32_t block_start = (m_misc_state.m_ti_address & 0x007fffff) + tl * ((m_misc_state.m_ti_width << m_misc_state.m_ti_size) >> 1) + ((sl << m_misc_state.m_ti_size) >> 1);
+	wait_for_rdram(block_start, block_start + (width << 3), "LoadBlock");
+
 	const int32_t tb = tile[tilenum].tmem << 2;
 
 	const int32_t tiwinwords = (m_misc_state.m_ti_width << m_misc_state.m_ti_size) >> 2;
@@ -2741,6 +2798,8 @@ void n64_rdp::cmd_load_tile(uint64_t w1)
 
 	const int32_t width = (sh - sl) + 1;
 	const int32_t height = (th - tl) + 1;
+
+	wait_for_texture_rows(tl, th, "LoadTile");
 /*
     int32_t topad;
     if (m_misc_state.m_ti_size < 3)
@@ -3153,6 +3212,9 @@ n64_rdp::n64_rdp(n64_state &state, uint32_t* rdram, uint32_t* dmem) : poly_manag
 	m_aux_buf = nullptr;
 	m_pipe_clean = true;
 
+	m_pending_rdram_start = ~0;
+	m_pending_rdram_end = 0;
+
 	m_pending_mode_block = false;
 
 	m_cmd_ptr = 0;
@@ -3278,7 +3340,7 @@ void n64_rdp::render_spans(int32_t start, int32_t end, int32_t tilenum, bool fli
 			render_triangle_custom(clip, render_delegate(&n64_rdp::span_draw_fill, this), start, (end - start) + 1, spans + offset);
 			break;
 	}
-	wait("render spans");
+	mark_rdram_pending(start, end);
 }
 
 void n64_rdp::rgbaz_clip(int32_t sr, int32_t sg, int32_t sb, int32_t sa, int32_t* sz, rdp_span_aux* userdata)
@@ -274,6 +274,9 @@ public:
 
 	void        mark_frame() { m_capture.mark_frame(*m_machine); }
 
+	// wait for all queued primitives to finish writing RDRAM
+	void        wait_for_renders(const char *debug);
+
 	misc_state_t m_misc_state;
 
 	// Color constants
@@ -340,6 +343,14 @@ private:
 	bool            m_pending_mode_block;
 	bool            m_pipe_clean;
 
+	// RDRAM byte range written by primitives still in flight
+	uint32_t        m_pending_rdram_start;
+	uint32_t        m_pending_rdram_end;
+
+	void            mark_rdram_pending(int32_t start, int32_t end);
+	void            wait_for_rdram(uint32_t start, uint32_t end, const char *debug);
+	void            wait_for_texture_rows(int32_t tl, int32_t th, const char *debug);
+
 	cv_mask_derivative_t cvarray[(1 << 8)];
 
 	uint16_t  m_z_com_table[0x40000]; //precalced table of compressed z values, 18b: 512 KB array!
@@ -24,6 +24,28 @@ neosprite_base_device::neosprite_base_device(const machine_config &mconfig, cons
 {
 }
 
+/* horizontal zoom table - verified on real hardware */
+static const int zoom_x_tables[][16] =
+{
+	{ 0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0 },
+	{ 0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0 },
+	{ 0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0 },
+	{ 0,0,1,0,1,0,0,0,1,0,0,0,1,0,0,0 },
+	{ 0,0,1,0,1,0,0,0,1,0,0,0,1,0,1,0 },
+	{ 0,0,1,0,1,0,1,0,1,0,0,0,1,0,1,0 },
+	{ 0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0 },
+	{ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0 },
+	{ 1,0,1,0,1,0,1,0,1,1,1,0,1,0,1,0 },
+	{ 1,0,1,1,1,0,1,0,1,1,1,0,1,0,1,0 },
+	{ 1,0,1,1,1,0,1,0,1,1,1,0,1,0,1,1 },
+	{ 1,0,1,1,1,0,1,1,1,1,1,0,1,0,1,1 },
+	{ 1,0,1,1,1,0,1,1,1,1,1,0,1,1,1,1 },
+	{ 1,1,1,1,1,0,1,1,1,1,1,0,1,1,1,1 },
+	{ 1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1 },
+	{ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 }
+};
+
+
 void neosprite_base_device::device_start()
 {
 	m_videoram = std::make_unique<uint16_t[]>(0x8000 + 0x800);
@@ -58,6 +80,16 @@ void neosprite_base_device::device_start()
 
 
 	m_region_zoomy = memregion(":zoomy")->base();
+
+	/* a sprite at zoom level n shows n + 1 of its 16 columns; list them so lines can be drawn without testing every column */
+	for (int zoom = 0; zoom < 0x10; zoom++)
+	{
+		int count = 0;
+		for (int column = 0; column < 0x10; column++)
+			if (zoom_x_tables[zoom][column])
+				m_zoom_x_columns[zoom][count++] = column;
+		assert(count == zoom + 1);
+	}
 }
 
 void neosprite_base_device::device_reset()
@@ -274,26 +306,6 @@ inline void neosprite_base_device::draw_fixed_layer_2pixels(uint32_t*&pixel_addr
 #define MAX_SPRITES_PER_LINE      (96)
 
 
-/* horizontal zoom table - verified on real hardware */
-static const int zoom_x_tables[][16] =
-{
-	{ 0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0 },
-	{ 0,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0 },
-	{ 0,0,0,0,1,0,0,0,1,0,0,0,1,0,0,0 },
-	{ 0,0,1,0,1,0,0,0,1,0,0,0,1,0,0,0 },
-	{ 0,0,1,0,1,0,0,0,1,0,0,0,1,0,1,0 },
-	{ 0,0,1,0,1,0,1,0,1,0,0,0,1,0,1,0 },
-	{ 0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0 },
-	{ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0 },
-	{ 1,0,1,0,1,0,1,0,1,1,1,0,1,0,1,0 },
-	{ 1,0,1,1,1,0,1,0,1,1,1,0,1,0,1,0 },
-	{ 1,0,1,1,1,0,1,0,1,1,1,0,1,0,1,1 },
-	{ 1,0,1,1,1,0,1,1,1,1,1,0,1,0,1,1 },
-	{ 1,0,1,1,1,0,1,1,1,1,1,0,1,1,1,1 },
-	{ 1,1,1,1,1,0,1,1,1,1,1,0,1,1,1,1 },
-	{ 1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1 },
-	{ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 }
-};
 
 
 
@@ -374,9 +386,7 @@ void neosprite_base_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline)
 			offs_t attr_and_code_offs;
 			uint16_t attr;
 			uint32_t code;
-			const int *zoom_x_table;
 			const pen_t *line_pens;
-			int x_inc;
 
 			int sprite_line = (scanline - y) & 0x1ff;
 			int zoom_line = sprite_line & 0xff;
@@ -424,74 +434,31 @@ void neosprite_base_device::draw_sprites(bitmap_rgb32 &bitmap, int scanline)
 			if (attr & 0x0002)
 				sprite_y ^= 0x0f;
 
-			zoom_x_table = zoom_x_tables[zoom_x];
-
 			/* compute offset in gfx ROM and mask it to the number of bits available */
 			int gfx_base = ((code << 8) | (sprite_y << 4)) & m_sprite_gfx_address_mask;
 
 
 			line_pens = &m_pens[attr >> 8 << m_bppshift];
 
-
-			/* horizontal flip? */
-			if (attr & 0x0001)
-			{
-				gfx_base = gfx_base + 0x0f;
-				x_inc = -1;
-			}
-			else
-				x_inc = 1;
-
 			/* draw the line - no wrap-around */
 			if (x <= 0x01f0)
-			{
-				int i;
-
-				uint32_t *pixel_addr = &bitmap.pix32(scanline, x + NEOGEO_HBEND);
-
-				for (i = 0; i < 0x10; i++)
-				{
-					if (*zoom_x_table)
-					{
-						draw_pixel(gfx_base, pixel_addr, line_pens);
-
-						pixel_addr++;
-					}
-
-					zoom_x_table++;
-					gfx_base += x_inc;
-				}
-			}
-			/* wrap-around */
+				draw_sprite_line(&bitmap.pix32(scanline, x + NEOGEO_HBEND), gfx_base, attr & 0x0001, zoom_x, 0, line_pens);
+			/* wrap-around - the columns left of 0x200 fall off the left edge */
 			else
-			{
-				int i;
-
-				int x_save = x;
-				uint32_t *pixel_addr = &bitmap.pix32(scanline, NEOGEO_HBEND);
-
-				for (i = 0; i < 0x10; i++)
-				{
-					if (*zoom_x_table)
-					{
-						if (x >= 0x200)
-						{
-							draw_pixel(gfx_base, pixel_addr, line_pens);
-
-							pixel_addr++;
-						}
+				draw_sprite_line(&bitmap.pix32(scanline, NEOGEO_HBEND), gfx_base, attr & 0x0001, zoom_x, 0x200 - x, line_pens);
+		}
+	}
+}
 
-						x++;
-					}
 
-					zoom_x_table++;
-					gfx_base += x_inc;
-				}
+/* draws the visible columns of one 16 pixel sprite line, skipping the first 'skip' of them */
+void neosprite_base_device::draw_sprite_line(uint32_t *dst, int gfx_base, bool flipx, int zoom_x, int skip, const pen_t *line_pens)
+{
+	const uint8_t *columns = m_zoom_x_columns[zoom_x];
+	const int flip = flipx ? 0x0f : 0x00;
 
-				x = x_save;
-			}
-		}
-	}
+	for (int i = skip; i <= zoom_x; i++)
+		draw_pixel(gfx_base + (columns[i] ^ flip), dst++, line_pens);
 }
 
 
@@ -764,6 +731,44 @@ inline void neosprite_optimized_device::draw_pixel(int romaddr, uint32_t* dst, c
 		*dst = line_pens[gfx];
 }
 
+void neosprite_optimized_device::draw_sprite_line(uint32_t *dst, int gfx_base, bool flipx, int zoom_x, int skip, const pen_t *line_pens)
+{
+	/* the expanded line is 16 contiguous pens; most lines drawn are either entirely transparent or unzoomed */
+	const uint8_t *src = &m_spritegfx8[gfx_base];
+	uint64_t left, right;
+	memcpy(&left, src, sizeof(left));
+	memcpy(&right, src + 8, sizeof(right));
+	if ((left | right) == 0)
+		return;
+
+	if (zoom_x == 0x0f && skip == 0)
+	{
+		if (flipx)
+		{
+			for (int i = 0; i < 0x10; i++)
+				if (src[0x0f - i])
+					dst[i] = line_pens[src[0x0f - i]];
+		}
+		else
+		{
+			for (int i = 0; i < 0x10; i++)
+				if (src[i])
+					dst[i] = line_pens[src[i]];
+		}
+		return;
+	}
+
+	const uint8_t *columns = m_zoom_x_columns[zoom_x];
+	const int flip = flipx ? 0x0f : 0x00;
+	for (int i = skip; i <= zoom_x; i++)
+	{
+		const uint8_t gfx = src[columns[i] ^ flip];
+		if (gfx)
+			*dst = line_pens[gfx];
+		dst++;
+	}
+}
+
 
 /*********************************************************************************************************************************/
 /* MIDAS specific sprite handling                                                                                                */
@@ -42,6 +42,7 @@ public:
 	void neogeo_set_fixed_layer_source(uint8_t data);
 	inline bool sprite_on_scanline(int scanline, int y, int rows);
 	virtual void draw_pixel(int romaddr, uint32_t* dst, const pen_t *line_pens) = 0;
+	virtual void draw_sprite_line(uint32_t *dst, int gfx_base, bool flipx, int zoom_x, int skip, const pen_t *line_pens);
 	void draw_sprites(bitmap_rgb32 &bitmap, int scanline);
 	void parse_sprites(int scanline);
 	void create_sprite_line_timer();
@@ -59,6 +60,7 @@ public:
 	uint16_t     m_vram_modulo;
 
 	const uint8_t *m_region_zoomy;
+	uint8_t      m_zoom_x_columns[0x10][0x10]; // visible sprite columns for each horizontal zoom level
 
 	uint32_t     m_sprite_gfx_address_mask;
 
@@ -112,6 +114,7 @@ public:
 	virtual void optimize_sprite_data() override;
 	virtual void set_optimized_sprite_data(uint8_t* sprdata, uint32_t mask) override;
 	virtual void draw_pixel(int romaddr, uint32_t* dst, const pen_t *line_pens) override;
+	virtual void draw_sprite_line(uint32_t *dst, int gfx_base, bool flipx, int zoom_x, int skip, const pen_t *line_pens) override;
 	std::vector<uint8_t> m_sprite_gfx;
 	uint8_t* m_spritegfx8;
 
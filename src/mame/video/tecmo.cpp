@@ -99,6 +99,9 @@ void tecmo_state::video_start()
 
 	save_item(NAME(m_fgscroll));
 	save_item(NAME(m_bgscroll));
+
+	m_scroll.start(*m_screen);
+	machine().save().register_postload(save_prepost_delegate(FUNC(tecmo_state::update_scroll), this));
 }
 
 
@@ -130,19 +133,26 @@ WRITE8_MEMBER(tecmo_state::bgvideoram_w)
 WRITE8_MEMBER(tecmo_state::fgscroll_w)
 {
 	m_fgscroll[offset] = data;
-
-	m_fg_tilemap->set_scrollx(0, m_fgscroll[0] + 256 * m_fgscroll[1]);
-	m_fg_tilemap->set_scrolly(0, m_fgscroll[2]);
-	m_screen->update_partial(m_screen->vpos());
+	update_scroll();
 }
 
 WRITE8_MEMBER(tecmo_state::bgscroll_w)
 {
 	m_bgscroll[offset] = data;
+	update_scroll();
+}
 
-	m_bg_tilemap->set_scrollx(0, m_bgscroll[0] + 256 * m_bgscroll[1]);
-	m_bg_tilemap->set_scrolly(0, m_bgscroll[2]);
-	m_screen->update_partial(m_screen->vpos());
+// the games rewrite the scroll registers mid-frame; rather than forcing a
+// partial update each time, record them so the screen draws each band of
+// scanlines with the values that were in effect for it
+void tecmo_state::update_scroll()
+{
+	scroll_state state;
+	state.fgx = m_fgscroll[0] + 256 * m_fgscroll[1];
+	state.fgy = m_fgscroll[2];
+	state.bgx = m_bgscroll[0] + 256 * m_bgscroll[1];
+	state.bgy = m_bgscroll[2];
+	m_scroll.set(state);
 }
 
 WRITE8_MEMBER(tecmo_state::flipscreen_w)
@@ -162,6 +172,12 @@ WRITE8_MEMBER(tecmo_state::flipscreen_w)
 
 uint32_t tecmo_state::screen_update(screen_device &screen, bitmap_ind16 &bitmap, const rectangle &cliprect)
 {
+	const scroll_state &scroll = m_scroll.get();
+	m_fg_tilemap->set_scrollx(0, scroll.fgx);
+	m_fg_tilemap->set_scrolly(0, scroll.fgy);
+	m_bg_tilemap->set_scrollx(0, scroll.bgx);
+	m_bg_tilemap->set_scrolly(0, scroll.bgy);
+
 	screen.priority().fill(0, cliprect);
 	bitmap.fill(0x100, cliprect);
 	m_bg_tilemap->draw(screen, bitmap, cliprect, 0,1);
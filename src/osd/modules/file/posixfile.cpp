@@ -45,6 +45,7 @@
 #include <cerrno>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -55,6 +56,10 @@
 #include <stdlib.h>
 #include <unistd.h>
 
+#if !defined(WIN32)
+#include <sys/mman.h>
+#endif
+
 
 
 namespace {
@@ -79,13 +84,19 @@ public:
 	posix_osd_file& operator=(posix_osd_file const &) = delete;
 	posix_osd_file& operator=(posix_osd_file &&) = delete;
 
-	posix_osd_file(int fd) : m_fd(fd)
+	posix_osd_file(int fd) : m_fd(fd), m_map(nullptr), m_maplength(0), m_privmap(nullptr), m_privmaplength(0)
 	{
 		assert(m_fd >= 0);
 	}
 
 	virtual ~posix_osd_file() override
 	{
+#if !defined(WIN32)
+		if (m_map != nullptr)
+			::munmap(m_map, size_t(m_maplength));
+		if (m_privmap != nullptr)
+			::munmap(m_privmap, size_t(m_privmaplength));
+#endif
 		::close(m_fd);
 	}
 
@@ -153,8 +164,66 @@ public:
 		return error::NONE;
 	}
 
+	virtual error map(void const *&data, std::uint64_t &length) override
+	{
+#if defined(WIN32)
+		return error::FAILURE;
+#else
+		// map the file once and hand out the same view
+		if (m_map == nullptr)
+		{
+			struct stat st;
+			if (::fstat(m_fd, &st) < 0)
+				return errno_to_file_error(errno);
+			if ((st.st_size <= 0) || (std::uint64_t(st.st_size) > std::uint64_t(std::numeric_limits<size_t>::max())))
+				return error::FAILURE;
+
+			void *const result = ::mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED, m_fd, 0);
+			if (result == MAP_FAILED)
+				return errno_to_file_error(errno);
+			m_map = result;
+			m_maplength = std::uint64_t(st.st_size);
+		}
+
+		data = m_map;
+		length = m_maplength;
+		return error::NONE;
+#endif
+	}
+
+	virtual error map_private(void *&data, std::uint64_t &length) override
+	{
+#if defined(WIN32)
+		return error::FAILURE;
+#else
+		// same as map, but writes land in private copies of the pages
+		if (m_privmap == nullptr)
+		{
+			struct stat st;
+			if (::fstat(m_fd, &st) < 0)
+				return errno_to_file_error(errno);
+			if ((st.st_size <= 0) || (std::uint64_t(st.st_size) > std::uint64_t(std::numeric_limits<size_t>::max())))
+				return error::FAILURE;
+
+			void *const result = ::mmap(nullptr, size_t(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, m_fd, 0);
+			if (result == MAP_FAILED)
+				return errno_to_file_error(errno);
+			m_privmap = result;
+			m_privmaplength = std::uint64_t(st.st_size);
+		}
+
+		data = m_privmap;
+		length = m_privmaplength;
+		return error::NONE;
+#endif
+	}
+
 private:
 	int m_fd;
+	void *m_map;
+	std::uint64_t m_maplength;
+	void *m_privmap;
+	std::uint64_t m_privmaplength;
 };
 
 
@@ -43,7 +43,7 @@ public:
 	win_osd_file& operator=(win_osd_file const &) = delete;
 	win_osd_file& operator=(win_osd_file &&) = delete;
 
-	win_osd_file(HANDLE handle) : m_handle(handle)
+	win_osd_file(HANDLE handle) : m_handle(handle), m_mapping(nullptr), m_view(nullptr), m_viewlength(0), m_privview(nullptr), m_privviewlength(0)
 	{
 		assert(m_handle);
 		assert(INVALID_HANDLE_VALUE != m_handle);
@@ -51,6 +51,12 @@ public:
 
 	virtual ~win_osd_file() override
 	{
+		if (m_view)
+			UnmapViewOfFile(m_view);
+		if (m_privview)
+			UnmapViewOfFile(m_privview);
+		if (m_mapping)
+			CloseHandle(m_mapping);
 		FlushFileBuffers(m_handle);
 		CloseHandle(m_handle);
 	}
@@ -110,8 +116,69 @@ public:
 		return error::NONE;
 	}
 
+	virtual error map(void const *&data, std::uint64_t &length) override
+	{
+		// map the file once and hand out the same view
+		if (!m_view)
+		{
+			LARGE_INTEGER size;
+			if (!GetFileSizeEx(m_handle, &size))
+				return win_error_to_file_error(GetLastError());
+			if ((size.QuadPart <= 0) || (std::uint64_t(size.QuadPart) > std::uint64_t(SIZE_MAX)))
+				return error::FAILURE;
+
+			if (!m_mapping)
+			{
+				m_mapping = CreateFileMapping(m_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (!m_mapping)
+					return win_error_to_file_error(GetLastError());
+			}
+			m_view = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+			if (!m_view)
+				return win_error_to_file_error(GetLastError());
+			m_viewlength = std::uint64_t(size.QuadPart);
+		}
+
+		data = m_view;
+		length = m_viewlength;
+		return error::NONE;
+	}
+
+	virtual error map_private(void *&data, std::uint64_t &length) override
+	{
+		// a copy view of the same read-only mapping object
+		if (!m_privview)
+		{
+			LARGE_INTEGER size;
+			if (!GetFileSizeEx(m_handle, &size))
+				return win_error_to_file_error(GetLastError());
+			if ((size.QuadPart <= 0) || (std::uint64_t(size.QuadPart) > std::uint64_t(SIZE_MAX)))
+				return error::FAILURE;
+
+			if (!m_mapping)
+			{
+				m_mapping = CreateFileMapping(m_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (!m_mapping)
+					return win_error_to_file_error(GetLastError());
+			}
+			m_privview = MapViewOfFile(m_mapping, FILE_MAP_COPY, 0, 0, 0);
+			if (!m_privview)
+				return win_error_to_file_error(GetLastError());
+			m_privviewlength = std::uint64_t(size.QuadPart);
+		}
+
+		data = m_privview;
+		length = m_privviewlength;
+		return error::NONE;
+	}
+
 private:
 	HANDLE m_handle;
+	HANDLE m_mapping;
+	void *m_view;
+	std::uint64_t m_viewlength;
+	void *m_privview;
+	std::uint64_t m_privviewlength;
 };
 
 
@@ -12,6 +12,7 @@
 #include <unistd.h>
 #include <sys/mman.h>
 #include <sys/types.h>
+#include <sys/resource.h>
 #include <signal.h>
 #include <dlfcn.h>
 
@@ -71,6 +72,35 @@ void *osd_alloc_executable(size_t size)
 #endif
 }
 
+
+//============================================================
+//  osd_reserve_executable
+//
+//  reserves "size" bytes of address space for executable
+//  memory, without making any of it accessible yet
+//============================================================
+
+void *osd_reserve_executable(size_t size)
+{
+#if defined(SDLMAME_BSD) || defined(SDLMAME_MACOSX)
+	void *ptr = mmap(0, size, PROT_NONE, MAP_ANON|MAP_SHARED, -1, 0);
+#else
+	void *ptr = mmap(0, size, PROT_NONE, MAP_ANON|MAP_SHARED|MAP_NORESERVE, 0, 0);
+#endif
+	return (ptr != MAP_FAILED) ? ptr : nullptr;
+}
+
+//============================================================
+//  osd_commit_executable
+//
+//  makes part of a reserved range usable for code
+//============================================================
+
+bool osd_commit_executable(void *ptr, size_t size)
+{
+	return mprotect(ptr, size, PROT_EXEC|PROT_READ|PROT_WRITE) == 0;
+}
+
 //============================================================
 //  osd_free_executable
 //
@@ -86,6 +116,19 @@ void osd_free_executable(void *ptr, size_t size)
 #endif
 }
 
+//============================================================
+//  osd_peak_memory_usage
+//============================================================
+
+uint64_t osd_peak_memory_usage(void)
+{
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0;
+	// macOS reports bytes
+	return uint64_t(usage.ru_maxrss);
+}
+
 //============================================================
 //  osd_break_into_debugger
 //============================================================
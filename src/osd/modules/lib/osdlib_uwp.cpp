@@ -101,6 +101,26 @@ void *osd_alloc_executable(size_t size)
 }
 
 
+//============================================================
+//  osd_reserve_executable
+//============================================================
+
+void *osd_reserve_executable(size_t size)
+{
+	return nullptr;
+}
+
+
+//============================================================
+//  osd_commit_executable
+//============================================================
+
+bool osd_commit_executable(void *ptr, size_t size)
+{
+	return false;
+}
+
+
 //============================================================
 //  osd_free_executable
 //
@@ -112,6 +132,15 @@ void osd_free_executable(void *ptr, size_t size)
 }
 
 
+//============================================================
+//  osd_peak_memory_usage
+//============================================================
+
+uint64_t osd_peak_memory_usage(void)
+{
+	return 0;
+}
+
 //============================================================
 //  osd_break_into_debugger
 //============================================================
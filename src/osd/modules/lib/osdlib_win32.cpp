@@ -10,6 +10,7 @@
 
 #include <windows.h>
 #include <mmsystem.h>
+#include <psapi.h>
 
 #include <stdlib.h>
 #ifndef _MSC_VER
@@ -95,6 +96,31 @@ void *osd_alloc_executable(size_t size)
 }
 
 
+//============================================================
+//  osd_reserve_executable
+//
+//  reserves "size" bytes of address space for executable
+//  memory, without committing any of it yet
+//============================================================
+
+void *osd_reserve_executable(size_t size)
+{
+	return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+}
+
+
+//============================================================
+//  osd_commit_executable
+//
+//  commits part of a reserved range for code
+//============================================================
+
+bool osd_commit_executable(void *ptr, size_t size)
+{
+	return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_EXECUTE_READWRITE) != nullptr;
+}
+
+
 //============================================================
 //  osd_free_executable
 //
@@ -107,6 +133,25 @@ void osd_free_executable(void *ptr, size_t size)
 }
 
 
+//============================================================
+//  osd_peak_memory_usage
+//============================================================
+
+uint64_t osd_peak_memory_usage(void)
+{
+	// K32GetProcessMemoryInfo is in kernel32 from Windows 7 on; older systems only have it in psapi.dll
+	typedef BOOL (WINAPI *get_memory_info_ptr)(HANDLE, PPROCESS_MEMORY_COUNTERS, DWORD);
+	osd::dynamic_module::ptr module = osd::dynamic_module::open({ "kernel32.dll", "psapi.dll" });
+	get_memory_info_ptr get_memory_info = module->bind<get_memory_info_ptr>("K32GetProcessMemoryInfo");
+	if (get_memory_info == nullptr)
+		get_memory_info = module->bind<get_memory_info_ptr>("GetProcessMemoryInfo");
+
+	PROCESS_MEMORY_COUNTERS counters;
+	if (get_memory_info == nullptr || !get_memory_info(GetCurrentProcess(), &counters, sizeof(counters)))
+		return 0;
+	return counters.PeakWorkingSetSize;
+}
+
 //============================================================
 //  osd_break_into_debugger
 //============================================================
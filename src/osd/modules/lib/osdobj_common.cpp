@@ -46,6 +46,7 @@ const options_entry osd_options::s_option_entries[] =
 
 	{ nullptr,                                nullptr,          OPTION_HEADER,    "OSD PERFORMANCE OPTIONS" },
 	{ OSDOPTION_NUMPROCESSORS ";np",          OSDOPTVAL_AUTO,   OPTION_STRING,    "number of processors; this overrides the number the system reports" },
+	{ OSDOPTION_AFFINITY,                     OSDOPTVAL_NONE,   OPTION_STRING,    "thread placement: none, or auto to keep the emulation thread on a fast core and workers on cores sharing its cache" },
 	{ OSDOPTION_BENCH,                        "0",              OPTION_INTEGER,   "benchmark for the given number of emulated seconds; implies -video none -sound none -nothrottle" },
 
 	{ nullptr,                                nullptr,          OPTION_HEADER,    "OSD VIDEO OPTIONS" },
@@ -56,6 +57,7 @@ const options_entry osd_options::s_option_entries[] =
 	{ OSDOPTION_MAXIMIZE ";max",              "1",              OPTION_BOOLEAN,   "default to maximized windows; otherwise, windows will be minimized" },
 	{ OSDOPTION_WAITVSYNC ";vs",              "0",              OPTION_BOOLEAN,   "enable waiting for the start of VBLANK before flipping screens; reduces tearing effects" },
 	{ OSDOPTION_SYNCREFRESH ";srf",           "0",              OPTION_BOOLEAN,   "enable using the start of VBLANK for throttling instead of the game time" },
+	{ OSDOPTION_SWSTRIPS,                     "1",              OPTION_INTEGER,   "number of horizontal strips the software renderer draws in parallel; 1 draws everything on the render thread" },
 	{ OSD_MONITOR_PROVIDER,                   OSDOPTVAL_AUTO,   OPTION_STRING,    "monitor discovery method" },
 
 	// per-window options
@@ -156,6 +158,7 @@ const options_entry osd_options::s_option_entries[] =
 	{ OSDOPTION_BGFX_SCREEN_CHAINS,           "default",         OPTION_STRING, "comma-delimited list of screen chain JSON names, colon-delimited per-window" },
 	{ OSDOPTION_BGFX_SHADOW_MASK,             "slot-mask.png",   OPTION_STRING, "shadow mask texture name" },
 	{ OSDOPTION_BGFX_AVI_NAME,                OSDOPTVAL_AUTO,    OPTION_STRING, "filename for BGFX output logging" },
+	{ OSDOPTION_BGFX_ENCODER,                 "",                OPTION_STRING, "command for an external encoder to record BGFX output to instead of AVI, fed raw BGRA frames on its standard input; %w, %h and %r are replaced by the width, height and frame rate" },
 
 		// End of list
 	{ nullptr }
@@ -555,6 +558,17 @@ void osd_common_t::set_mastervolume(int attenuation)
 }
 
 
+//-------------------------------------------------
+//  sound_underflows - return the number of times
+//  the sound output has run out of samples
+//-------------------------------------------------
+
+unsigned osd_common_t::sound_underflows()
+{
+	return (m_sound != nullptr) ? m_sound->underflows() : 0;
+}
+
+
 //-------------------------------------------------
 //  customize_input_type_list - provide OSD
 //  additions/modifications to the input list
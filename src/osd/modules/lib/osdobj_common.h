@@ -42,6 +42,7 @@
 #define OSDOPTION_WATCHDOG              "watchdog"
 
 #define OSDOPTION_NUMPROCESSORS         "numprocessors"
+#define OSDOPTION_AFFINITY              "affinity"
 #define OSDOPTION_BENCH                 "bench"
 
 #define OSDOPTION_VIDEO                 "video"
@@ -50,6 +51,7 @@
 #define OSDOPTION_MAXIMIZE              "maximize"
 #define OSDOPTION_WAITVSYNC             "waitvsync"
 #define OSDOPTION_SYNCREFRESH           "syncrefresh"
+#define OSDOPTION_SWSTRIPS              "swstrips"
 
 #define OSDOPTION_SCREEN                "screen"
 #define OSDOPTION_ASPECT                "aspect"
@@ -89,6 +91,7 @@
 #define OSDOPTION_BGFX_SCREEN_CHAINS    "bgfx_screen_chains"
 #define OSDOPTION_BGFX_SHADOW_MASK      "bgfx_shadow_mask"
 #define OSDOPTION_BGFX_AVI_NAME         "bgfx_avi_name"
+#define OSDOPTION_BGFX_ENCODER          "bgfx_encoder"
 
 //============================================================
 //  TYPE DEFINITIONS
@@ -111,6 +114,7 @@ public:
 
 	// performance options
 	const char *numprocessors() const { return value(OSDOPTION_NUMPROCESSORS); }
+	const char *affinity() const { return value(OSDOPTION_AFFINITY); }
 	int bench() const { return int_value(OSDOPTION_BENCH); }
 
 	// video options
@@ -120,6 +124,7 @@ public:
 	bool maximize() const { return bool_value(OSDOPTION_MAXIMIZE); }
 	bool wait_vsync() const { return bool_value(OSDOPTION_WAITVSYNC); }
 	bool sync_refresh() const { return bool_value(OSDOPTION_SYNCREFRESH); }
+	int sw_strips() const { return int_value(OSDOPTION_SWSTRIPS); }
 
 	// per-window options
 	const char *screen() const { return value(OSDOPTION_SCREEN); }
@@ -163,6 +168,7 @@ public:
 	const char *bgfx_screen_chains() const { return value(OSDOPTION_BGFX_SCREEN_CHAINS); }
 	const char *bgfx_shadow_mask() const { return value(OSDOPTION_BGFX_SHADOW_MASK); }
 	const char *bgfx_avi_name() const { return value(OSDOPTION_BGFX_AVI_NAME); }
+	const char *bgfx_encoder() const { return value(OSDOPTION_BGFX_ENCODER); }
 
 	// PortAudio options
 	const char *pa_api() const { return value(OSDOPTION_PA_API); }
@@ -199,6 +205,7 @@ public:
 	virtual void update_audio_stream(const int16_t *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
 	virtual bool no_sound() override;
+	virtual unsigned sound_underflows() override;
 
 	// input overridables
 	virtual void customize_input_type_list(simple_list<input_type_entry> &typelist) override;
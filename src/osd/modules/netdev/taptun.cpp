@@ -7,6 +7,12 @@
 #include <sys/ioctl.h>
 #include <net/if.h>
 #include <errno.h>
+#ifdef __linux__
+#include <poll.h>
+#endif
+
+#include <atomic>
+#include <thread>
 
 #include "emu.h"
 #include "osdnet.h"
@@ -48,10 +54,26 @@ public:
 protected:
 	int recv_dev(uint8_t **buf);
 private:
+#ifdef __linux__
+	void reader();
+#endif
+
 	int m_fd;
 	char m_ifname[10];
 	char m_mac[6];
 	uint8_t m_buf[2048];
+
+#ifdef __linux__
+	// frames are read by a thread that sleeps in poll() until the tap is
+	// readable, so the emulation timer only has to check the ring
+	enum { RING_SIZE = 32 };
+	uint8_t m_packets[RING_SIZE][2048];
+	int m_packetlens[RING_SIZE];
+	std::atomic<unsigned> m_head;
+	std::atomic<unsigned> m_tail;
+	int m_wake[2];
+	std::thread m_thread;
+#endif
 };
 
 netdev_tap::netdev_tap(const char *name, class device_network_interface *ifdev, int rate)
@@ -61,6 +83,9 @@ netdev_tap::netdev_tap(const char *name, class device_network_interface *ifdev,
 	struct ifreq ifr;
 
 	m_fd = -1;
+	m_head = 0;
+	m_tail = 0;
+	m_wake[0] = m_wake[1] = -1;
 	if((m_fd = open("/dev/net/tun", O_RDWR)) == -1) {
 		osd_printf_verbose("tap: open failed %d\n", errno);
 		return;
@@ -79,6 +104,13 @@ netdev_tap::netdev_tap(const char *name, class device_network_interface *ifdev,
 	strncpy(m_ifname, ifr.ifr_name, 10);
 	fcntl(m_fd, F_SETFL, O_NONBLOCK);
 
+	if(pipe(m_wake) == -1) {
+		osd_printf_verbose("tap: pipe failed %d\n", errno);
+		m_wake[0] = m_wake[1] = -1;
+		return;
+	}
+	m_thread = std::thread([this] () { reader(); });
+
 #else
 	m_fd = -1;
 #endif
@@ -86,9 +118,56 @@ netdev_tap::netdev_tap(const char *name, class device_network_interface *ifdev,
 
 netdev_tap::~netdev_tap()
 {
+#ifdef __linux__
+	if(m_thread.joinable()) {
+		const char stop = 0;
+		if(write(m_wake[1], &stop, 1) == -1)
+			osd_printf_verbose("tap: wake failed %d\n", errno);
+		m_thread.join();
+	}
+	if(m_wake[0] != -1) {
+		close(m_wake[0]);
+		close(m_wake[1]);
+	}
+#endif
 	close(m_fd);
 }
 
+#ifdef __linux__
+void netdev_tap::reader()
+{
+	uint8_t discard[2048];
+	struct pollfd fds[2];
+	fds[0].fd = m_fd;
+	fds[0].events = POLLIN;
+	fds[1].fd = m_wake[0];
+	fds[1].events = POLLIN;
+
+	for(;;) {
+		if(poll(fds, 2, -1) == -1) {
+			if(errno == EINTR) continue;
+			return;
+		}
+		if(fds[1].revents) return;
+		if(!(fds[0].revents & POLLIN)) continue;
+
+		// drain everything that is ready, dropping frames once the ring is full
+		for(;;) {
+			const unsigned head = m_head.load(std::memory_order_relaxed);
+			const bool full = ((head + 1) % RING_SIZE) == m_tail.load(std::memory_order_acquire);
+			int len = read(m_fd, full ? discard : m_packets[head], sizeof(discard));
+			if(len <= 0) break;
+			if(full) {
+				osd_printf_verbose("tap: buffer full, dropping packet\n");
+				continue;
+			}
+			m_packetlens[head] = len;
+			m_head.store((head + 1) % RING_SIZE, std::memory_order_release);
+		}
+	}
+}
+#endif
+
 void netdev_tap::set_mac(const char *mac)
 {
 	memcpy(m_mac, mac, 6);
@@ -105,6 +184,21 @@ int netdev_tap::recv_dev(uint8_t **buf)
 {
 	int len;
 	if(m_fd == -1) return 0;
+#ifdef __linux__
+	// exit if the ring is empty, got a broadcast or multicast packet,
+	// are in promiscuous mode or got a packet with our mac.
+	for(;;) {
+		const unsigned tail = m_tail.load(std::memory_order_relaxed);
+		if(tail == m_head.load(std::memory_order_acquire)) return 0;
+		len = m_packetlens[tail];
+		memcpy(m_buf, m_packets[tail], len);
+		m_tail.store((tail + 1) % RING_SIZE, std::memory_order_release);
+		if(!memcmp(get_mac(), m_buf, 6) || get_promisc() || (m_buf[0] & 1)) {
+			*buf = m_buf;
+			return len;
+		}
+	}
+#else
 	// exit if we didn't receive anything, got an error, got a broadcast or multicast packet,
 	// are in promiscuous mode or got a packet with our mac.
 	do {
@@ -112,6 +206,7 @@ int netdev_tap::recv_dev(uint8_t **buf)
 	} while((len > 0) && memcmp(get_mac(), m_buf, 6) && !get_promisc() && !(m_buf[0] & 1));
 	*buf = m_buf;
 	return (len == -1)?0:len;
+#endif
 }
 
 static CREATE_NETDEV(create_tap)
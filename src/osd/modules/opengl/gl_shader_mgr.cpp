@@ -26,6 +26,12 @@ static const char * glsl_mamebm_fsh_files [GLSL_SHADER_FEAT_INT_NUMBER] =
 	"/tmp/glsl_bilinear_rgb32_dir.fsh"                          // rgb32 dir bilinear
 };
 
+static const char * glsl_idx16_fsh_files [GLSL_SHADER_FEAT_INT_NUMBER] =
+{
+	"/tmp/glsl_plain_idx16_lut.fsh",                           // idx16 lut plain
+	"/tmp/glsl_bilinear_idx16_lut.fsh"                          // idx16 lut bilinear
+};
+
 #else // GLSL_SOURCE_ON_DISK
 
 #include "shader/glsl_general.vsh.c"
@@ -33,6 +39,9 @@ static const char * glsl_mamebm_fsh_files [GLSL_SHADER_FEAT_INT_NUMBER] =
 #include "shader/glsl_plain_rgb32_dir.fsh.c"
 #include "shader/glsl_bilinear_rgb32_dir.fsh.c"
 
+#include "shader/glsl_plain_idx16_lut.fsh.c"
+#include "shader/glsl_bilinear_idx16_lut.fsh.c"
+
 static const char * glsl_mamebm_vsh_sources [GLSL_VERTEX_SHADER_INT_NUMBER] =
 {
 	glsl_general_vsh_src                                    // general
@@ -44,6 +53,12 @@ static const char * glsl_mamebm_fsh_sources [GLSL_SHADER_FEAT_INT_NUMBER] =
 	glsl_bilinear_rgb32_dir_fsh_src                         // rgb32 dir bilinear
 };
 
+static const char * glsl_idx16_fsh_sources [GLSL_SHADER_FEAT_INT_NUMBER] =
+{
+	glsl_plain_idx16_lut_fsh_src,                              // idx16 lut plain
+	glsl_bilinear_idx16_lut_fsh_src                         // idx16 lut bilinear
+};
+
 #endif // GLSL_SOURCE_ON_DISK
 
 static const char * glsl_mamebm_filter_names [GLSL_SHADER_FEAT_MAX_NUMBER] =
@@ -78,6 +93,16 @@ static GLhandleARB glsl_mamebm_fsh_shader [GLSL_SHADER_FEAT_MAX_NUMBER+9] =
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0  /* rgb32 dir: plain, bilinear, custom0-9 */
 };
 
+static GLhandleARB glsl_idx16_programs [GLSL_SHADER_FEAT_INT_NUMBER] =
+{
+	0, 0  /* idx16 lut: plain, bilinear */
+};
+
+static GLhandleARB glsl_idx16_fsh_shader [GLSL_SHADER_FEAT_INT_NUMBER] =
+{
+	0, 0  /* idx16 lut: plain, bilinear */
+};
+
 static GLhandleARB glsl_scrn_programs [10] =
 {
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0  /* rgb32: custom0-9, .. */
@@ -109,6 +134,14 @@ GLhandleARB glsl_shader_get_program_mamebm(int glslShaderFeature, int idx)
 	return glsl_mamebm_programs[glslShaderFeature+idx];
 }
 
+GLhandleARB glsl_shader_get_program_idx16(int glslShaderFeature)
+{
+	if ( !(0 <= glslShaderFeature && glslShaderFeature < GLSL_SHADER_FEAT_INT_NUMBER) )
+		return 0;
+
+	return glsl_idx16_programs[glslShaderFeature];
+}
+
 GLhandleARB glsl_shader_get_program_scrn(int idx)
 {
 	if ( !(0 <= idx && idx < 10) )
@@ -156,6 +189,26 @@ glsl_shader_info *glsl_shader_init(osd_gl_context *gl_ctx)
 	#endif
 	}
 	if (err) return nullptr;
+
+	// the palette lookup variants are optional, failed programs are left at 0 and
+	// indexed screens will be converted on the CPU as before
+	for (j=0; j<GLSL_SHADER_FEAT_INT_NUMBER; j++)
+	{
+	#ifdef GLSL_SOURCE_ON_DISK
+		if(glsl_idx16_fsh_files[j])
+			err = gl_compile_shader_files  (&glsl_idx16_programs[j],
+							&glsl_mamebm_vsh_shader[glsl_mamebm_fsh2vsh[j]],
+							&glsl_idx16_fsh_shader[j],
+							nullptr /*precompiled*/, glsl_idx16_fsh_files[j], 0);
+	#else
+		if(glsl_idx16_fsh_sources[j])
+			err = gl_compile_shader_sources(&glsl_idx16_programs[j],
+							&glsl_mamebm_vsh_shader[glsl_mamebm_fsh2vsh[j]],
+							&glsl_idx16_fsh_shader[j],
+							nullptr /*precompiled*/, glsl_idx16_fsh_sources[j]);
+	#endif
+	}
+
 	return (glsl_shader_info *) malloc(sizeof(glsl_shader_info *));
 }
 
@@ -184,6 +237,14 @@ int glsl_shader_free(glsl_shader_info *shinfo)
 			(void) gl_delete_shader( &glsl_mamebm_programs[j], nullptr, nullptr);
 	}
 
+	for (j=0; j<GLSL_SHADER_FEAT_INT_NUMBER; j++)
+	{
+		if ( glsl_idx16_fsh_shader[j] )
+			(void) gl_delete_shader(nullptr, nullptr, &glsl_idx16_fsh_shader[j]);
+		if ( glsl_idx16_programs[j] )
+			(void) gl_delete_shader( &glsl_idx16_programs[j], nullptr, nullptr);
+	}
+
 	for (i=0; i<10; i++)
 	{
 		if ( glsl_scrn_vsh_shader[i] )
@@ -44,6 +44,11 @@ const char * glsl_shader_get_filter_name_mamebm(int glslShaderFeature);
 
 int glsl_shader_add_mamebm(glsl_shader_info *shinfo, const char * custShaderPrefix, int idx);
 
+/**
+ * returns the palette lookup GLSL program for 16-bit indexed bitmaps if available, otherwise 0
+ */
+GLhandleARB glsl_shader_get_program_idx16(int glslShaderFeature);
+
 GLhandleARB glsl_shader_get_program_scrn(int idx);
 int glsl_shader_add_scrn(glsl_shader_info *shinfo, const char * custShaderPrefix, int idx);
 
@@ -260,6 +260,7 @@ struct osd_video_config
 	int                 waitvsync;                  // spin until vsync
 	int                 syncrefresh;                // sync only to refresh rate
 	int                 switchres;                  // switch resolutions
+	int                 swstrips;                   // software renderer strips drawn in parallel
 
 	// d3d, accel, opengl
 	int                 filter;                     // enable filtering
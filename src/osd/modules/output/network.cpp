@@ -13,6 +13,7 @@
 
 #include <thread>
 #include <set>
+#include <deque>
 #include "asio.h"
 
 class output_client
@@ -45,8 +46,11 @@ public:
 private:
   void deliver(std::string &msg)
   {
-	std::strncpy(m_data, msg.c_str(), max_length);
-	do_write(msg.size());
+	// queue behind any write still in flight
+	bool const idle = m_queue.empty();
+	m_queue.push_back(msg);
+	if (idle)
+	  do_write();
   }
 
   void do_read()
@@ -66,13 +70,19 @@ private:
 		});
   }
 
-  void do_write(std::size_t length)
+  void do_write()
   {
 	auto self(shared_from_this());
-	asio::async_write(m_socket, asio::buffer(m_data, length),
+	asio::async_write(m_socket, asio::buffer(m_queue.front()),
 		[this, self](std::error_code ec, std::size_t /*length*/)
 		{
-		  if (ec)
+		  if (!ec)
+		  {
+			m_queue.pop_front();
+			if (!m_queue.empty())
+			  do_write();
+		  }
+		  else
 		  {
 			m_clients->erase(shared_from_this());
 		  }
@@ -81,7 +91,7 @@ private:
 
   asio::ip::tcp::socket m_socket;
   enum { max_length = 1024 };
-  char m_data[max_length];
+  std::deque<std::string> m_queue;
   char m_input_m_data[max_length];
   client_set *m_clients;
 };
@@ -137,6 +147,8 @@ public:
 
 	virtual int init(const osd_options &options) override
 	{
+		// created here so notify can post to it before the thread gets going
+		m_io_context = new asio::io_context();
 		m_working_thread = std::thread([](output_network* self) { self->process_output(); }, this);
 		return 0;
 	}
@@ -153,15 +165,15 @@ public:
 
 	virtual void notify(const char *outname, int32_t value) override
 	{
-		static char buf[256];
-		sprintf(buf, "%s = %d\n", ((outname==nullptr) ? "none" : outname), value);
-		m_server->deliver_to_all(buf);
+		// the clients belong to the network thread, so hand the message over rather than
+		// writing from the emulation thread
+		std::string msg = string_format("%s = %d\n", ((outname==nullptr) ? "none" : outname), value);
+		asio::post(*m_io_context, [this, msg]() { if (m_server) m_server->deliver_to_all(msg); });
 	}
 
 	// implementation
 	void process_output()
 	{
-		m_io_context = new asio::io_context();
 		m_server = new output_network_server(*m_io_context, 8000);
 		m_io_context->run();
 	}
@@ -15,8 +15,8 @@ avi_write::avi_write(running_machine& machine, uint32_t width, uint32_t height)
 	, m_recording(false)
 	, m_width(width)
 	, m_height(height)
-	, m_output_file(nullptr)
 	, m_frame(0)
+	, m_output_file(nullptr)
 {
 }
 
@@ -19,20 +19,17 @@ class avi_write
 {
 public:
 	avi_write(running_machine& machine, uint32_t width, uint32_t height);
-	~avi_write();
+	virtual ~avi_write();
 
-	void record(const char *name);
-	void stop();
-	void audio_frame(const int16_t *buffer, int samples_this_frame);
-	void video_frame(bitmap_rgb32& snap);
+	virtual void record(const char *name);
+	virtual void stop();
+	virtual void audio_frame(const int16_t *buffer, int samples_this_frame);
+	virtual void video_frame(bitmap_rgb32& snap);
 
 	// Getters
 	bool recording() const { return m_recording; }
 
-private:
-	void begin_avi_recording(const char *name);
-	void end_avi_recording();
-
+protected:
 	running_machine&        m_machine;
 
 	bool                    m_recording;
@@ -40,11 +37,15 @@ private:
 	uint32_t                m_width;
 	uint32_t                m_height;
 
-	avi_file::ptr           m_output_file;
-
 	int                     m_frame;
 	attotime                m_frame_period;
 	attotime                m_next_frame_time;
+
+private:
+	void begin_avi_recording(const char *name);
+	void end_avi_recording();
+
+	avi_file::ptr           m_output_file;
 };
 
 #endif // __RENDER_AVIWRITE__
@@ -37,6 +37,47 @@ using namespace rapidjson;
 
 const uint32_t chain_manager::CHAIN_NONE = 0;
 
+struct chain_manager::chain_source
+{
+	Document    document;
+	std::string error;      // empty if the chain was read and parsed
+};
+
+static std::string chain_file_path(osd_options& options, std::string name)
+{
+	if (name.length() < 5 || (name.compare(name.length() - 5, 5, ".json")!= 0))
+	{
+		name = name + ".json";
+	}
+	return std::string(options.bgfx_path()) + "/chains/" + name;
+}
+
+static void read_chain_source(std::string path, Document& document, std::string& error)
+{
+	bx::CrtFileReader reader;
+	if (!bx::open(&reader, path.c_str()))
+	{
+		error = "Unable to open chain file " + path + ", falling back to no post processing\n";
+		return;
+	}
+
+	int32_t size(bx::getSize(&reader));
+
+	char* data = new char[size + 1];
+	bx::read(&reader, reinterpret_cast<void*>(data), size);
+	bx::close(&reader);
+	data[size] = 0;
+
+	document.Parse<kParseCommentsFlag>(data);
+
+	delete [] data;
+
+	if (document.HasParseError())
+	{
+		error = "Unable to parse chain " + path + ". Errors returned:\n" + GetParseError_En(document.GetParseError()) + "\n";
+	}
+}
+
 chain_manager::chain_manager(running_machine& machine, osd_options& options, texture_manager& textures, target_manager& targets, effect_manager& effects, uint32_t window_index, slider_dirty_notifier& slider_notifier)
 	: m_machine(machine)
 	, m_options(options)
@@ -46,21 +87,124 @@ chain_manager::chain_manager(running_machine& machine, osd_options& options, tex
 	, m_window_index(window_index)
 	, m_slider_notifier(slider_notifier)
 	, m_screen_count(0)
+	, m_preload_queue(nullptr)
+	, m_preload_item(nullptr)
 {
 	refresh_available_chains();
 	parse_chain_selections(options.bgfx_screen_chains());
+	preload_chains();
 }
 
 chain_manager::~chain_manager()
 {
+	wait_preload();
+	if (m_preload_queue != nullptr)
+	{
+		osd_work_queue_free(m_preload_queue);
+	}
 	destroy_chains();
 }
 
+void chain_manager::preload_chains()
+{
+	// read and parse the chains selected in the ini while the machine starts, so the first
+	// frame only has to build them; only file access and parsing happen off this thread
+	for (int32_t chain : m_current_chain)
+	{
+		if (chain != CHAIN_NONE)
+		{
+			chain_desc& desc = m_available_chains[chain];
+			m_preload_paths.push_back(chain_file_path(m_options, desc.m_path + "/" + desc.m_name));
+		}
+	}
+
+	if (m_preload_paths.empty())
+	{
+		return;
+	}
+
+	m_preload_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	if (m_preload_queue != nullptr)
+	{
+		m_preload_item = osd_work_item_queue(m_preload_queue, preload_callback, this, 0);
+	}
+	if (m_preload_item == nullptr)
+	{
+		m_preload_paths.clear();
+	}
+}
+
+void* chain_manager::preload_callback(void* param, int threadid)
+{
+	chain_manager* chains = reinterpret_cast<chain_manager*>(param);
+	for (std::string path : chains->m_preload_paths)
+	{
+		if (chains->m_sources.find(path) == chains->m_sources.end())
+		{
+			std::unique_ptr<chain_source> source = std::make_unique<chain_source>();
+			read_chain_source(path, source->document, source->error);
+			chains->m_sources[path] = std::move(source);
+		}
+	}
+	return nullptr;
+}
+
+void chain_manager::wait_preload()
+{
+	// m_sources belongs to the preload job until it is done
+	if (m_preload_item != nullptr)
+	{
+		while (!osd_work_item_wait(m_preload_item, osd_ticks_per_second() * 10)) { }
+		osd_work_item_release(m_preload_item);
+		m_preload_item = nullptr;
+		m_preload_paths.clear();
+	}
+}
+
+const chain_manager::chain_source* chain_manager::find_source(std::string path)
+{
+	wait_preload();
+
+	std::map<std::string, std::unique_ptr<chain_source>>::iterator iter = m_sources.find(path);
+	if (iter != m_sources.end())
+	{
+		if (iter->second->error.empty())
+		{
+			return iter->second.get();
+		}
+
+		// the preload failed, report it and try the disk again next time
+		printf("%s", iter->second->error.c_str());
+		m_sources.erase(iter);
+		return nullptr;
+	}
+
+	std::unique_ptr<chain_source> source = std::make_unique<chain_source>();
+	read_chain_source(path, source->document, source->error);
+	const chain_source* result = source.get();
+
+	// a file that failed is not kept, so it can be fixed while running
+	if (source->error.empty())
+	{
+		m_sources[path] = std::move(source);
+	}
+	else
+	{
+		printf("%s", source->error.c_str());
+		return nullptr;
+	}
+	return result;
+}
+
 void chain_manager::refresh_available_chains()
 {
 	m_available_chains.clear();
 	m_available_chains.push_back(chain_desc("none", ""));
 
+	// the files may have changed, so forget what we parsed
+	wait_preload();
+	m_sources.clear();
+
 	find_available_chains(std::string(m_options.bgfx_path()) + "/chains", "");
 
 	destroy_unloaded_chains();
@@ -137,36 +281,15 @@ bgfx_chain* chain_manager::load_chain(std::string name, uint32_t screen_index)
 	{
 		name = name + ".json";
 	}
-	std::string path = std::string(m_options.bgfx_path()) + "/chains/" + name;
-
-	bx::CrtFileReader reader;
-	if (!bx::open(&reader, path.c_str()))
-	{
-		printf("Unable to open chain file %s, falling back to no post processing\n", path.c_str());
-		return nullptr;
-	}
+	std::string path = chain_file_path(m_options, name);
 
-	int32_t size(bx::getSize(&reader));
-
-	char* data = new char[size + 1];
-	bx::read(&reader, reinterpret_cast<void*>(data), size);
-	bx::close(&reader);
-	data[size] = 0;
-
-	Document document;
-	document.Parse<kParseCommentsFlag>(data);
-
-	delete [] data;
-
-	if (document.HasParseError())
+	const chain_source* source = find_source(path);
+	if (source == nullptr)
 	{
-		std::string error(GetParseError_En(document.GetParseError()));
-		printf("Unable to parse chain %s. Errors returned:\n", path.c_str());
-		printf("%s\n", error.c_str());
 		return nullptr;
 	}
 
-	bgfx_chain* chain = chain_reader::read_from_value(document, name + ": ", *this, screen_index);
+	bgfx_chain* chain = chain_reader::read_from_value(source->document, name + ": ", *this, screen_index);
 
 	if (chain == nullptr)
 	{
@@ -286,11 +409,12 @@ void chain_manager::process_screen_quad(uint32_t view, uint32_t screen, render_p
 	uint16_t tex_width(prim->texture.width);
 	uint16_t tex_height(prim->texture.height);
 
+	bgfx::TextureFormat::Enum dst_format;
 	const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(prim->flags & PRIMFLAG_TEXFORMAT_MASK,
-		tex_width, tex_height, prim->texture.rowpixels, prim->texture.palette, prim->texture.base);
+		tex_width, tex_height, prim->texture.rowpixels, prim->texture.palette, prim->texture.base, dst_format);
 
 	std::string full_name = "screen" + std::to_string(screen);
-	bgfx_texture *texture = new bgfx_texture(full_name, bgfx::TextureFormat::RGBA8, tex_width, tex_height, mem, BGFX_TEXTURE_U_CLAMP | BGFX_TEXTURE_V_CLAMP | BGFX_TEXTURE_MIN_POINT | BGFX_TEXTURE_MAG_POINT | BGFX_TEXTURE_MIP_POINT);
+	bgfx_texture *texture = new bgfx_texture(full_name, dst_format, tex_width, tex_height, mem, BGFX_TEXTURE_U_CLAMP | BGFX_TEXTURE_V_CLAMP | BGFX_TEXTURE_MIN_POINT | BGFX_TEXTURE_MAG_POINT | BGFX_TEXTURE_MIP_POINT);
 	m_textures.add_provider(full_name, texture);
 
 	const bool any_targets_rebuilt = m_targets.update_target_sizes(screen, tex_width, tex_height, TARGET_STYLE_GUEST);
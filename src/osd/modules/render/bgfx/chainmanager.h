@@ -16,6 +16,7 @@
 
 #include <vector>
 #include <map>
+#include <memory>
 #include <string>
 
 #include "texturemanager.h"
@@ -32,6 +33,9 @@ class render_primitive;
 class bgfx_chain;
 class bgfx_slider;
 
+struct osd_work_queue;
+struct osd_work_item;
+
 class chain_desc
 {
 public:
@@ -72,6 +76,14 @@ public:
 	void restore_slider_settings(int32_t id, std::vector<std::vector<float>>& settings);
 
 private:
+	// a chain_source is a chain file that has been read and parsed, kept around so reloads don't touch the disk
+	struct chain_source;
+
+	const chain_source* find_source(std::string path);
+	void preload_chains();
+	void wait_preload();
+	static void* preload_callback(void* param, int threadid);
+
 	void load_chains();
 	void destroy_chains();
 	void reload_chains();
@@ -104,6 +116,10 @@ private:
 	std::vector<std::string>    m_chain_names;
 	std::vector<ui::menu_item>  m_selection_sliders;
 	std::vector<int32_t>        m_current_chain;
+	std::map<std::string, std::unique_ptr<chain_source>> m_sources;
+	std::vector<std::string>    m_preload_paths;
+	osd_work_queue*             m_preload_queue;
+	osd_work_item*              m_preload_item;
 
 	static const uint32_t       CHAIN_NONE;
 };
@@ -50,6 +50,27 @@ const bgfx::Memory* bgfx_util::mame_texture_data_to_bgfx_texture_data(uint32_t f
 	return mem;
 }
 
+const bgfx::Memory* bgfx_util::mame_texture_data_to_bgfx_texture_data(uint32_t format, int width, int height, int rowpixels, const rgb_t *palette, void *base, bgfx::TextureFormat::Enum &dst_format)
+{
+	// unadjusted 32-bit bitmaps are already laid out as BGRA8, so only need copying
+	if ((format == PRIMFLAG_TEXFORMAT(TEXFORMAT_RGB32) || format == PRIMFLAG_TEXFORMAT(TEXFORMAT_ARGB32)) && palette == nullptr)
+	{
+		dst_format = bgfx::TextureFormat::BGRA8;
+		if (rowpixels == width)
+			return bgfx::copy(base, width * height * 4);
+
+		const bgfx::Memory* mem = bgfx::alloc(width * height * 4);
+		uint32_t* data = reinterpret_cast<uint32_t*>(mem->data);
+		uint32_t* src32 = reinterpret_cast<uint32_t*>(base);
+		for (int y = 0; y < height; y++)
+			memcpy(data + y * width, src32 + y * rowpixels, width * 4);
+		return mem;
+	}
+
+	dst_format = bgfx::TextureFormat::RGBA8;
+	return mame_texture_data_to_bgfx_texture_data(format, width, height, rowpixels, palette, base);
+}
+
 uint64_t bgfx_util::get_blend_state(uint32_t blend)
 {
 	switch (blend)
@@ -12,6 +12,7 @@ class bgfx_util
 {
 public:
 	static const bgfx::Memory* mame_texture_data_to_bgfx_texture_data(uint32_t format, int width, int height, int rowpixels, const rgb_t *palette, void *base);
+	static const bgfx::Memory* mame_texture_data_to_bgfx_texture_data(uint32_t format, int width, int height, int rowpixels, const rgb_t *palette, void *base, bgfx::TextureFormat::Enum &dst_format);
 	static uint64_t get_blend_state(uint32_t blend);
 };
 
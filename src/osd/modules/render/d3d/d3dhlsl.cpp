@@ -692,6 +692,7 @@ int shaders::create_resources()
 		texture.width = shadow_bitmap.width();
 		texture.height = shadow_bitmap.height();
 		texture.palette = nullptr;
+		texture.palette_length = 0;
 		texture.seqid = 0;
 
 		// now create it (no prescale, no wrap)
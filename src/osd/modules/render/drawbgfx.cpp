@@ -23,6 +23,7 @@
 #include "window.h"
 #include "rendutil.h"
 #include "aviwrite.h"
+#include "encoderwrite.h"
 
 #include <bgfx/bgfx.h>
 #include <bgfx/platform.h>
@@ -332,7 +333,10 @@ void renderer_bgfx::record()
 
 	if (m_avi_writer == nullptr)
 	{
-		m_avi_writer = new avi_write(win->machine(), m_width[0], m_height[0]);
+		if (m_options.bgfx_encoder()[0] != 0)
+			m_avi_writer = new encoder_write(win->machine(), m_width[0], m_height[0], m_options.bgfx_encoder());
+		else
+			m_avi_writer = new avi_write(win->machine(), m_width[0], m_height[0]);
 		m_avi_data = new uint8_t[m_width[0] * m_height[0] * 4];
 		m_avi_bitmap.allocate(m_width[0], m_height[0]);
 	}
@@ -537,10 +541,11 @@ void renderer_bgfx::render_textured_quad(render_primitive* prim, bgfx::Transient
 	uint16_t tex_width(prim->texture.width);
 	uint16_t tex_height(prim->texture.height);
 
+	bgfx::TextureFormat::Enum dst_format;
 	const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(prim->flags & PRIMFLAG_TEXFORMAT_MASK,
-		tex_width, tex_height, prim->texture.rowpixels, prim->texture.palette, prim->texture.base);
+		tex_width, tex_height, prim->texture.rowpixels, prim->texture.palette, prim->texture.base, dst_format);
 
-	bgfx::TextureHandle texture = bgfx::createTexture2D(tex_width, tex_height, false, 1, bgfx::TextureFormat::RGBA8, texture_flags, mem);
+	bgfx::TextureHandle texture = bgfx::createTexture2D(tex_width, tex_height, false, 1, dst_format, texture_flags, mem);
 
 	bgfx_effect** effects = PRIMFLAG_GET_SCREENTEX(prim->flags) ? m_screen_effect : m_gui_effect;
 
@@ -452,6 +452,7 @@ void d3d_texture_manager::create_resources()
 		texture.width = m_default_bitmap.width();
 		texture.height = m_default_bitmap.height();
 		texture.palette = nullptr;
+		texture.palette_length = 0;
 		texture.seqid = 0;
 		texture.osddata = 0;
 
@@ -484,11 +485,8 @@ texture_info *d3d_texture_manager::find_texinfo(const render_texinfo *texinfo, u
 	// find a match
 	for (auto it = m_texture_list.begin(); it != m_texture_list.end(); it++)
 	{
-		uint32_t test_screen = (uint32_t)(*it)->get_texinfo().osddata >> 1;
-		uint32_t test_page = (uint32_t)(*it)->get_texinfo().osddata & 1;
-		uint32_t prim_screen = (uint32_t)texinfo->osddata >> 1;
-		uint32_t prim_page = (uint32_t)texinfo->osddata & 1;
-		if (test_screen != prim_screen || test_page != prim_page)
+		// screen textures carry their screen and page in the OSD data
+		if ((*it)->get_texinfo().osddata != texinfo->osddata)
 			continue;
 
 		if ((*it)->get_hash() == hash &&
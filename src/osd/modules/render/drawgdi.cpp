@@ -19,6 +19,9 @@ renderer_gdi::~renderer_gdi()
 	// free the bitmap memory
 	if (m_bmdata != nullptr)
 		global_free_array(m_bmdata);
+
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
 }
 
 //============================================================
@@ -85,9 +88,13 @@ int renderer_gdi::draw(const int update)
 		m_bmdata = global_alloc_array(uint8_t, m_bmsize);
 	}
 
+	// allocate a queue if we're splitting the drawing into strips
+	if (video_config.swstrips > 1 && m_work_queue == nullptr)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
 	// draw the primitives to the bitmap
 	win->m_primlist->acquire_lock();
-	software_renderer<uint32_t, 0,0,0, 16,8,0>::draw_primitives(*win->m_primlist, m_bmdata, width, height, pitch);
+	software_renderer<uint32_t, 0,0,0, 16,8,0>::draw_primitives(*win->m_primlist, m_bmdata, width, height, pitch, m_work_queue, video_config.swstrips);
 	win->m_primlist->release_lock();
 
 	// fill in bitmap-specific info
@@ -264,10 +264,17 @@ static PFNGLFRAMEBUFFERTEXTURE2DEXTPROC pfn_glFramebufferTexture2D  = nullptr;
 
 static int glsl_shader_feature = GLSL_SHADER_FEAT_PLAIN;
 
+// the lookup shaders filter by hand, since the hardware can't filter palette indices
+static inline int glsl_shader_feature_idx16()
+{
+	return (glsl_shader_feature == GLSL_SHADER_FEAT_BILINEAR || video_config.filter) ? GLSL_SHADER_FEAT_BILINEAR : GLSL_SHADER_FEAT_PLAIN;
+}
+
 //============================================================
 //  Textures
 //============================================================
 
+static void texture_set_lut(ogl_texture_info *texture, const render_texinfo *texsource);
 static void texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags);
 
 //============================================================
@@ -678,6 +685,12 @@ void renderer_ogl::destroy_all_textures()
 			}
 
 			glDeleteTextures(1, (GLuint *)&texture->texture);
+			if ( texture->lut_texture )
+			{
+				glDeleteTextures(1, (GLuint *)&texture->lut_texture);
+				texture->lut_texture=0;
+			}
+
 			if ( texture->data_own )
 			{
 				free(texture->data);
@@ -1427,6 +1440,7 @@ void renderer_ogl::texture_compute_type_subroutine(const render_texinfo *texsour
 {
 	texture->type = TEXTURE_TYPE_NONE;
 	texture->nocopy = false;
+	texture->lut = false;
 
 	if ( texture->type == TEXTURE_TYPE_NONE &&
 			!PRIMFLAG_GET_SCREENTEX(flags))
@@ -1456,6 +1470,19 @@ void renderer_ogl::texture_compute_type_subroutine(const render_texinfo *texsour
 		texture->nocopy = true;
 	}
 
+	// indexed screens on the single pass shaders can upload the raw indices
+	// and do the palette lookup on the GPU instead
+	if    ( texture->type == TEXTURE_TYPE_SHADER &&
+			texture->format == SDL_TEXFORMAT_PALETTE16 &&
+			m_glsl_program_num == 1 && glsl_shader_feature < GLSL_SHADER_FEAT_CUSTOM &&
+			glsl_shader_get_program_idx16(glsl_shader_feature_idx16()) != 0 &&
+			!texture->borderpix && texsource->palette != nullptr &&
+			texsource->palette_length > 0 && texsource->palette_length <= 0x10000 )
+	{
+		texture->nocopy = true;
+		texture->lut = true;
+	}
+
 	if( texture->type == TEXTURE_TYPE_NONE &&
 		m_usepbo && !texture->nocopy )
 	{
@@ -1794,6 +1821,51 @@ int renderer_ogl::texture_shader_create(const render_texinfo *texsource, ogl_tex
 			m_width, m_height, surf_w_pow2, surf_h_pow2);
 	}
 
+	if ( texture->lut )
+	{
+		// GL_TEXTURE1: the palette, 256 entries per row
+		texture->lut_program = glsl_shader_get_program_idx16(glsl_shader_feature_idx16());
+		texture->lut_width = 256;
+		texture->lut_height = (texsource->palette_length + texture->lut_width - 1) / texture->lut_width;
+		int lut_h_pow2 = get_valid_pow2_value(texture->lut_height, texture->texpow2);
+
+		glGenTextures(1, (GLuint *)&texture->lut_texture);
+		pfn_glActiveTexture(GL_TEXTURE1);
+		glBindTexture(GL_TEXTURE_2D, texture->lut_texture);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, texture->lut_width, lut_h_pow2,
+				0, GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, nullptr);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		texture->lut_data.clear(); // force the first upload
+
+		pfn_glUseProgramObjectARB(texture->lut_program);
+
+		uniform_location = pfn_glGetUniformLocationARB(texture->lut_program, "color_texture");
+		pfn_glUniform1iARB(uniform_location, 0);
+		uniform_location = pfn_glGetUniformLocationARB(texture->lut_program, "colortable_texture");
+		pfn_glUniform1iARB(uniform_location, 1);
+
+		GLfloat colortable_sz[2] = { (GLfloat)texture->lut_width, (GLfloat)texture->lut_height };
+		uniform_location = pfn_glGetUniformLocationARB(texture->lut_program, "colortable_sz");
+		pfn_glUniform2fvARB(uniform_location, 1, &(colortable_sz[0]));
+
+		GLfloat colortable_pow2_sz[2] = { (GLfloat)texture->lut_width, (GLfloat)lut_h_pow2 };
+		uniform_location = pfn_glGetUniformLocationARB(texture->lut_program, "colortable_pow2_sz");
+		pfn_glUniform2fvARB(uniform_location, 1, &(colortable_pow2_sz[0]));
+
+		GLfloat color_texture_pow2_sz[2] = { (GLfloat)texture->rawwidth_create, (GLfloat)texture->rawheight_create };
+		uniform_location = pfn_glGetUniformLocationARB(texture->lut_program, "color_texture_pow2_sz");
+		pfn_glUniform2fvARB(uniform_location, 1, &(color_texture_pow2_sz[0]));
+		GL_CHECK_ERROR_NORMAL();
+	}
+
+	// the palette lookup shaders take 16-bit indices in the alpha channel
+	GLint internalformat = texture->lut ? GL_ALPHA16 : GL_RGBA8;
+	GLenum format = texture->lut ? GL_ALPHA : GL_BGRA;
+	GLenum type = texture->lut ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT_8_8_8_8_REV;
+
 	// GL_TEXTURE0
 	// get a name for this texture
 	glGenTextures(1, (GLuint *)&texture->texture);
@@ -1804,10 +1876,10 @@ int renderer_ogl::texture_shader_create(const render_texinfo *texsource, ogl_tex
 
 	uint32_t * dummy = nullptr;
 	GLint _width, _height;
-	if ( gl_texture_check_size(GL_TEXTURE_2D, 0, GL_RGBA8,
+	if ( gl_texture_check_size(GL_TEXTURE_2D, 0, internalformat,
 					texture->rawwidth_create, texture->rawheight_create,
 					0,
-					GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV,
+					format, type,
 					&_width, &_height, 1) )
 	{
 		osd_printf_error("cannot create bitmap texture, req: %dx%d, avail: %dx%d - bail out\n",
@@ -1817,14 +1889,14 @@ int renderer_ogl::texture_shader_create(const render_texinfo *texsource, ogl_tex
 
 	dummy = (uint32_t *) malloc(texture->rawwidth_create * texture->rawheight_create * sizeof(uint32_t));
 	memset(dummy, 0, texture->rawwidth_create * texture->rawheight_create * sizeof(uint32_t));
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8,
+	glTexImage2D(GL_TEXTURE_2D, 0, internalformat,
 			texture->rawwidth_create, texture->rawheight_create,
 			0,
-			GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, dummy);
+			format, type, dummy);
 			glFinish(); // should not be necessary, .. but make sure we won't access the memory after free
 	free(dummy);
 
-	if ((PRIMFLAG_GET_SCREENTEX(flags)) && video_config.filter)
+	if ((PRIMFLAG_GET_SCREENTEX(flags)) && video_config.filter && !texture->lut)
 	{
 		assert( glsl_shader_feature == GLSL_SHADER_FEAT_PLAIN );
 
@@ -2308,6 +2380,43 @@ static inline void copyline_yuy16_to_argb(uint32_t *dst, const uint16_t *src, in
 	}
 }
 
+//============================================================
+//  texture_set_lut
+//============================================================
+
+static void texture_set_lut(ogl_texture_info *texture, const render_texinfo *texsource)
+{
+	const uint32_t size = texture->lut_width * texture->lut_height;
+	const uint32_t count = std::min<uint32_t>(texsource->palette_length, size);
+	bool dirty = false;
+
+	if (texture->lut_data.size() != size)
+	{
+		texture->lut_data.assign(size, 0);
+		dirty = true;
+	}
+
+	// only send the palette when it actually changed
+	for (uint32_t i = 0; i < count; i++)
+	{
+		const uint32_t color = 0xff000000 | texsource->palette[i];
+		if (texture->lut_data[i] != color)
+		{
+			texture->lut_data[i] = color;
+			dirty = true;
+		}
+	}
+
+	if (dirty)
+	{
+		pfn_glActiveTexture(GL_TEXTURE1);
+		glBindTexture(GL_TEXTURE_2D, texture->lut_texture);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->lut_width);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texture->lut_width, texture->lut_height,
+				GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, &texture->lut_data[0]);
+	}
+}
+
 //============================================================
 //  texture_set_data
 //============================================================
@@ -2388,7 +2497,21 @@ static void texture_set_data(ogl_texture_info *texture, const render_texinfo *te
 			(texsource->width * texture->xprescale + 2) * sizeof(uint32_t));
 	}
 
-	if ( texture->type == TEXTURE_TYPE_SHADER )
+	if ( texture->type == TEXTURE_TYPE_SHADER && texture->lut )
+	{
+		texture_set_lut(texture, texsource);
+
+		pfn_glActiveTexture(GL_TEXTURE0);
+		glBindTexture(texture->texTarget, texture->texture);
+
+		// upload the raw indices, rows of 16-bit pixels need not be 4-byte aligned
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->texinfo.rowpixels);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+		glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
+				GL_ALPHA, GL_UNSIGNED_SHORT, texture->data);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	}
+	else if ( texture->type == TEXTURE_TYPE_SHADER )
 	{
 		pfn_glActiveTexture(GL_TEXTURE0);
 		glBindTexture(texture->texTarget, texture->texture);
@@ -2661,7 +2784,7 @@ ogl_texture_info * renderer_ogl::texture_update(const render_primitive *prim, in
 	{
 		if ( texture->type == TEXTURE_TYPE_SHADER )
 		{
-			pfn_glUseProgramObjectARB(m_glsl_program[shaderIdx]); // back to our shader
+			pfn_glUseProgramObjectARB(texture->lut ? texture->lut_program : m_glsl_program[shaderIdx]); // back to our shader
 		}
 		else if ( texture->type == TEXTURE_TYPE_DYNAMIC )
 		{
@@ -2677,7 +2800,7 @@ ogl_texture_info * renderer_ogl::texture_update(const render_primitive *prim, in
 
 	if (texture != nullptr)
 	{
-		if ( texture->type == TEXTURE_TYPE_SHADER )
+		if ( texture->type == TEXTURE_TYPE_SHADER && !texture->lut )
 		{
 			texture_shader_update(texture, prim->container, shaderIdx);
 			if ( m_glsl_program_num>1 )
@@ -2701,6 +2824,11 @@ ogl_texture_info * renderer_ogl::texture_update(const render_primitive *prim, in
 		if (!texBound) {
 			glBindTexture(texture->texTarget, texture->texture);
 		}
+		if (texture->lut) {
+			pfn_glActiveTexture(GL_TEXTURE1);
+			glBindTexture(GL_TEXTURE_2D, texture->lut_texture);
+			pfn_glActiveTexture(GL_TEXTURE0);
+		}
 		texture_coord_update(texture, prim, shaderIdx);
 
 		glEnableClientState(GL_TEXTURE_COORD_ARRAY);
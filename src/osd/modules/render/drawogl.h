@@ -43,7 +43,8 @@ public:
 		rawwidth_create(0), rawheight_create(0),
 		type(0), format(0), borderpix(0), xprescale(0), yprescale(0), nocopy(0),
 		texture(0), texTarget(0), texpow2(0), mpass_dest_idx(0), pbo(0), data(nullptr),
-		data_own(0), texCoordBufferName(0)
+		data_own(0), texCoordBufferName(0), lut(0), lut_texture(0), lut_program(0),
+		lut_width(0), lut_height(0)
 	{
 		for (int i=0; i<2; i++)
 		{
@@ -89,6 +90,11 @@ public:
 	GLfloat             texCoord[8];
 	GLuint              texCoordBufferName;
 
+	int                 lut;                    // are the colours looked up in a shader?
+	uint32_t              lut_texture;            // palette OpenGL texture "name"/ID (lut only!)
+	GLhandleARB         lut_program;            // GLSL program doing the lookup
+	int                 lut_width, lut_height;  // palette texture width/height in entries
+	std::vector<uint32_t> lut_data;              // copy of the palette last uploaded
 };
 
 /* sdl_info is the information about SDL for the current screen */
@@ -28,6 +28,7 @@ public:
 		, m_texture_id(nullptr)
 		, m_yuv_lookup(nullptr)
 		, m_yuv_bitmap(nullptr)
+		, m_work_queue(nullptr)
 		//, m_hw_scale_width(0)
 		//, m_hw_scale_height(0)
 		, m_last_hofs(0)
@@ -64,6 +65,9 @@ private:
 	uint32_t              *m_yuv_lookup;
 	uint16_t              *m_yuv_bitmap;
 
+	// strips for the software renderer
+	osd_work_queue      *m_work_queue;
+
 	// if we leave scaling to SDL and the underlying driver, this
 	// is the render_target_width/height to use
 
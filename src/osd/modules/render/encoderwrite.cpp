@@ -0,0 +1,110 @@
+// license:BSD-3-Clause
+// copyright-holders:Ryan Holtz
+//============================================================
+//
+//  encoderwrite.cpp - external encoder output writer class
+//
+//============================================================
+
+#include "emu.h"
+#include "encoderwrite.h"
+#include "corestr.h"
+
+#if defined(_WIN32)
+#define popen   _popen
+#define pclose  _pclose
+#define PIPE_WRITE_MODE "wb"
+#else
+#define PIPE_WRITE_MODE "w"
+#endif
+
+encoder_write::encoder_write(running_machine& machine, uint32_t width, uint32_t height, const char *command)
+	: avi_write(machine, width, height)
+	, m_command(command)
+	, m_pipe(nullptr)
+{
+}
+
+encoder_write::~encoder_write()
+{
+	if (m_recording)
+	{
+		stop();
+	}
+}
+
+void encoder_write::record(const char *name)
+{
+	// stop any existing recording
+	end_encoder_recording();
+
+	// reset the state
+	m_frame = 0;
+	m_next_frame_time = m_machine.time();
+	const double rate = (m_machine.first_screen() != nullptr) ? ATTOSECONDS_TO_HZ(m_machine.first_screen()->frame_period().m_attoseconds) : screen_device::DEFAULT_FRAME_RATE;
+	m_frame_period = attotime::from_hz(rate);
+
+	// fill in the frame geometry and rate the encoder needs to read raw frames
+	std::string command = m_command;
+	strreplace(command, "%w", std::to_string(m_width));
+	strreplace(command, "%h", std::to_string(m_height));
+	strreplace(command, "%r", string_format("%.6f", rate));
+
+	m_pipe = popen(command.c_str(), PIPE_WRITE_MODE);
+	if (m_pipe == nullptr)
+	{
+		osd_printf_error("Error starting encoder: %s\n", command.c_str());
+		return;
+	}
+
+	osd_printf_verbose("Started encoder: %s\n", command.c_str());
+	m_recording = true;
+}
+
+void encoder_write::stop()
+{
+	osd_printf_info("Stopping encoder output after %d frames.\n", m_frame);
+	end_encoder_recording();
+}
+
+void encoder_write::end_encoder_recording()
+{
+	m_recording = false;
+	if (m_pipe != nullptr)
+	{
+		// closing the pipe lets the encoder finish the stream; pclose waits for it
+		pclose(m_pipe);
+		m_pipe = nullptr;
+	}
+	m_frame = 0;
+}
+
+void encoder_write::video_frame(bitmap_rgb32& snap)
+{
+	// get the current time
+	attotime curtime = m_machine.time();
+
+	// loop until we hit the right time
+	while (m_next_frame_time <= curtime)
+	{
+		// write the next frame a row at a time, since rows may be padded
+		for (int y = 0; y < snap.height(); y++)
+		{
+			if (fwrite(&snap.pix32(y), sizeof(uint32_t), snap.width(), m_pipe) != snap.width())
+			{
+				osd_printf_error("Error while writing to encoder; stopping encoder output.\n");
+				end_encoder_recording();
+				return;
+			}
+		}
+
+		// advance time
+		m_next_frame_time += m_frame_period;
+		m_frame++;
+	}
+}
+
+void encoder_write::audio_frame(const int16_t *buffer, int samples_this_frame)
+{
+	// the pipe carries only video; the encoder can capture the host's audio output if needed
+}
@@ -0,0 +1,39 @@
+// license:BSD-3-Clause
+// copyright-holders:Ryan Holtz
+//============================================================
+//
+//  encoderwrite.h - external encoder output writer class
+//
+//============================================================
+
+#pragma once
+
+#ifndef __RENDER_ENCODERWRITE__
+#define __RENDER_ENCODERWRITE__
+
+#include "aviwrite.h"
+
+#include <cstdio>
+#include <string>
+
+// pipes raw BGRA frames to an external encoder process, which can use
+// whatever hardware encoder and container or transport the host offers
+class encoder_write : public avi_write
+{
+public:
+	encoder_write(running_machine& machine, uint32_t width, uint32_t height, const char *command);
+	virtual ~encoder_write();
+
+	virtual void record(const char *name) override;
+	virtual void stop() override;
+	virtual void audio_frame(const int16_t *buffer, int samples_this_frame) override;
+	virtual void video_frame(bitmap_rgb32& snap) override;
+
+private:
+	void end_encoder_recording();
+
+	std::string             m_command;
+	FILE *                  m_pipe;
+};
+
+#endif // __RENDER_ENCODERWRITE__
@@ -0,0 +1,101 @@
+// license:BSD-3-Clause
+// copyright-holders:intealls, R.Belmont
+/*
+ * audio_buffer.h
+ *
+ * Lock free single producer/single consumer ring buffer shared by the
+ * callback driven sound modules. The emulation thread writes each frame's
+ * samples with write() and the audio device callback pulls them with read(),
+ * so neither side ever blocks the other.
+ *
+ */
+
+#ifndef AUDIO_BUFFER_H_
+#define AUDIO_BUFFER_H_
+
+#include <atomic>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+template <typename T>
+struct audio_buffer {
+	T*               buf;
+	int              size;
+	int              reserve;
+	std::atomic<int> playpos, writepos;
+
+	audio_buffer(int size, int reserve) : size(size + reserve), reserve(reserve) {
+		playpos = writepos = 0;
+		buf = new T[this->size];
+	}
+
+	~audio_buffer() { delete[] buf; }
+
+	int count() {
+		int diff = writepos - playpos;
+		return diff < 0 ? size + diff : diff;
+	}
+
+	void increment_writepos(int n) {
+		writepos.store((writepos + n) % size);
+	}
+
+	int write(const T* src, int n, int attenuation) {
+		n = std::min<int>(n, size - reserve - count());
+
+		if (writepos + n > size) {
+			att_memcpy(buf + writepos, src, sizeof(T) * (size - writepos), attenuation);
+			att_memcpy(buf, src + (size - writepos), sizeof(T) * (n - (size - writepos)), attenuation);
+		} else {
+			att_memcpy(buf + writepos, src, sizeof(T) * n, attenuation);
+		}
+
+		increment_writepos(n);
+
+		return n;
+	}
+
+	void increment_playpos(int n) {
+		playpos.store((playpos + n) % size);
+	}
+
+	int read(T* dst, int n) {
+		n = std::min<int>(n, count());
+
+		if (playpos + n > size) {
+			std::memcpy(dst, buf + playpos, sizeof(T) * (size - playpos));
+			std::memcpy(dst + (size - playpos), buf, sizeof(T) * (n - (size - playpos)));
+		} else {
+			std::memcpy(dst, buf + playpos, sizeof(T) * n);
+		}
+
+		increment_playpos(n);
+
+		return n;
+	}
+
+	int clear(int n) {
+		n = std::min<int>(n, size - reserve - count());
+
+		if (writepos + n > size) {
+			std::memset(buf + writepos, 0, sizeof(T) * (size - writepos));
+			std::memset(buf, 0, sizeof(T) * (n - (size - writepos)));
+		} else {
+			std::memset(buf + writepos, 0, sizeof(T) * n);
+		}
+
+		increment_writepos(n);
+
+		return n;
+	}
+
+	void att_memcpy(T* dest, const T* data, int n, int attenuation) {
+		int level = powf(10.0, attenuation / 20.0) * 32768;
+		n /= sizeof(T);
+		while (n--)
+			*dest++ = (*data++ * level) >> 15;
+	}
+};
+
+#endif /* AUDIO_BUFFER_H_ */
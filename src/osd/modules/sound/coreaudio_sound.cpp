@@ -64,6 +64,7 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, int16_t const *buffer, int samples_this_frame);
 	virtual void set_mastervolume(int attenuation);
+	virtual unsigned underflows() const { return m_underflows; }
 
 private:
 	struct node_detail
@@ -9,6 +9,7 @@
 *******************************************************************c********/
 
 #include "sound_module.h"
+#include "audio_buffer.h"
 #include "modules/osdmodule.h"
 
 #ifndef NO_USE_PORTAUDIO
@@ -47,89 +48,9 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const s16 *buffer, int samples_this_frame);
 	virtual void set_mastervolume(int attenuation);
+	virtual unsigned underflows() const { return m_underflows; }
 
 private:
-	// Lock free SPSC ring buffer
-	template <typename T>
-	struct audio_buffer {
-		T*               buf;
-		int              size;
-		int              reserve;
-		std::atomic<int> playpos, writepos;
-
-		audio_buffer(int size, int reserve) : size(size + reserve), reserve(reserve) {
-			playpos = writepos = 0;
-			buf = new T[this->size];
-		}
-
-		~audio_buffer() { delete[] buf; }
-
-		int count() {
-			int diff = writepos - playpos;
-			return diff < 0 ? size + diff : diff;
-		}
-
-		void increment_writepos(int n) {
-			writepos.store((writepos + n) % size);
-		}
-
-		int write(const T* src, int n, int attenuation) {
-			n = std::min<int>(n, size - reserve - count());
-
-			if (writepos + n > size) {
-				att_memcpy(buf + writepos, src, sizeof(T) * (size - writepos), attenuation);
-				att_memcpy(buf, src + (size - writepos), sizeof(T) * (n - (size - writepos)), attenuation);
-			} else {
-				att_memcpy(buf + writepos, src, sizeof(T) * n, attenuation);
-			}
-
-			increment_writepos(n);
-
-			return n;
-		}
-
-		void increment_playpos(int n) {
-			playpos.store((playpos + n) % size);
-		}
-
-		int read(T* dst, int n) {
-			n = std::min<int>(n, count());
-
-			if (playpos + n > size) {
-				std::memcpy(dst, buf + playpos, sizeof(T) * (size - playpos));
-				std::memcpy(dst + (size - playpos), buf, sizeof(T) * (n - (size - playpos)));
-			} else {
-				std::memcpy(dst, buf + playpos, sizeof(T) * n);
-			}
-
-			increment_playpos(n);
-
-			return n;
-		}
-
-		int clear(int n) {
-			n = std::min<int>(n, size - reserve - count());
-
-			if (writepos + n > size) {
-				std::memset(buf + writepos, 0, sizeof(T) * (size - writepos));
-				std::memset(buf, 0, sizeof(T) * (n - (size - writepos)));
-			} else {
-				std::memset(buf + writepos, 0, sizeof(T) * n);
-			}
-
-			increment_writepos(n);
-
-			return n;
-		}
-
-		void att_memcpy(T* dest, const T* data, int n, int attenuation) {
-			int level = powf(10.0, attenuation / 20.0) * 32768;
-			n /= sizeof(T);
-			while (n--)
-				*dest++ = (*data++ * level) >> 15;
-		}
-	};
-
 	enum
 	{
 		LATENCY_MIN = 1,
@@ -154,6 +75,8 @@ private:
 
 	audio_buffer<s16>*  m_ab;
 
+	bool                m_boosted; // the callback thread has requested real-time priority
+
 	std::atomic<bool>   m_has_underflowed;
 	std::atomic<bool>   m_has_overflowed;
 	unsigned            m_underflows;
@@ -192,6 +115,7 @@ int sound_pa::init(osd_options const &options)
 	m_skip_threshold_ticks  = 0;
 	m_osd_tps               = osd_ticks_per_second();
 	m_buffer_min_ct         = INT_MAX;
+	m_boosted               = false;
 	m_audio_latency         = std::min<int>(std::max<int>(m_audio_latency, LATENCY_MIN), LATENCY_MAX);
 
 	try {
@@ -324,6 +248,13 @@ PaDeviceIndex sound_pa::list_get_devidx(const char* api_str, const char* device_
 
 int sound_pa::callback(s16* output_buffer, size_t number_of_samples)
 {
+	if (!m_boosted)
+	{
+		if (osd_thread_realtime_priority())
+			osd_printf_verbose("PortAudio: Callback thread is running at real-time priority\n");
+		m_boosted = true;
+	}
+
 	int buf_ct = m_ab->count();
 
 	if (buf_ct >= number_of_samples)
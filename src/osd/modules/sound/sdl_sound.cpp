@@ -9,6 +9,7 @@
 //============================================================
 
 #include "sound_module.h"
+#include "audio_buffer.h"
 #include "modules/osdmodule.h"
 
 #if (defined(OSD_SDL) || defined(USE_SDL_SOUND))
@@ -50,8 +51,7 @@ public:
 	sound_sdl()
 	: osd_module(OSD_SOUND_PROVIDER, "sdl"), sound_module(),
 		stream_in_initialized(0),
-		stream_loop(0),
-		attenuation(0), buf_locked(0), stream_buffer(nullptr), stream_playpos(0), stream_buffer_size(0), stream_buffer_in(0), buffer_underflows(0), buffer_overflows(0)
+		attenuation(0), stream_buffer(nullptr), stream_buffer_size(0), stream_prefill(0), has_underflowed(false), callback_boosted(false), buffer_underflows(0), buffer_overflows(0)
 {
 		sdl_xfer_samples = SDL_XFER_SAMPLES;
 	}
@@ -64,27 +64,24 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual unsigned underflows() const override { return buffer_underflows; }
 
 private:
-	int lock_buffer(bool is_throttled, long offset, long size, void **buffer1, long *length1, void **buffer2, long *length2);
-	void unlock_buffer(void);
-	void att_memcpy(void *dest, const int16_t *data, int bytes_to_copy);
-	void copy_sample_data(bool is_throttled, const int16_t *data, int bytes_to_copy);
 	int sdl_create_buffers(void);
 	void sdl_destroy_buffers(void);
 
 	int sdl_xfer_samples;
 	int stream_in_initialized;
-	int stream_loop;
 	int attenuation;
 
-	int              buf_locked;
+	// samples are pushed by update_audio_stream and pulled by sdl_callback
+	audio_buffer<int16_t> *stream_buffer;
 
-	int8_t             *stream_buffer;
-	volatile int32_t   stream_playpos;
+	uint32_t           stream_buffer_size;  // in samples
+	uint32_t           stream_prefill;      // silence queued before playback starts, in samples
 
-	uint32_t           stream_buffer_size;
-	uint32_t           stream_buffer_in;
+	std::atomic<bool>  has_underflowed;
+	bool               callback_boosted;
 
 	// buffer over/underflow counts
 	int              buffer_underflows;
@@ -108,140 +105,6 @@ private:
 // debugging
 static FILE *sound_log;
 
-//============================================================
-//  sound_sdl - destructor
-//============================================================
-
-//============================================================
-//  lock_buffer
-//============================================================
-int sound_sdl::lock_buffer(bool is_throttled, long offset, long size, void **buffer1, long *length1, void **buffer2, long *length2)
-{
-	volatile long pstart, pend, lstart, lend;
-
-	if (!buf_locked)
-	{
-		if (is_throttled)
-		{
-			pstart = stream_playpos;
-			pend = (pstart + sdl_xfer_samples);
-			lstart = offset;
-			lend = lstart+size;
-			while (((pstart >= lstart) && (pstart <= lend)) ||
-					((pend >= lstart) && (pend <= lend)))
-			{
-				pstart = stream_playpos;
-				pend = pstart + sdl_xfer_samples;
-			}
-		}
-
-		SDL_LockAudio();
-		buf_locked++;
-	}
-
-	// init lengths
-	*length1 = *length2 = 0;
-
-	if ((offset + size) > stream_buffer_size)
-	{
-		// 2-piece case
-		*length1 = stream_buffer_size - offset;
-		*buffer1 = &stream_buffer[offset];
-		*length2 = size - *length1;
-		*buffer2 = stream_buffer;
-	}
-	else
-	{
-		// normal 1-piece case
-		*length1 = size;
-		*buffer1 = &stream_buffer[offset];
-	}
-
-	if (LOG_SOUND)
-		fprintf(sound_log, "locking %ld bytes at offset %ld (total %d, playpos %d): len1 %ld len2 %ld\n",
-			size, offset, stream_buffer_size, stream_playpos, *length1, *length2);
-
-	return 0;
-}
-
-//============================================================
-//  unlock_buffer
-//============================================================
-void sound_sdl::unlock_buffer(void)
-{
-	buf_locked--;
-	if (!buf_locked)
-		SDL_UnlockAudio();
-
-	if (LOG_SOUND)
-		fprintf(sound_log, "unlocking\n");
-
-}
-
-//============================================================
-//  Apply attenuation
-//============================================================
-
-void sound_sdl::att_memcpy(void *dest, const int16_t *data, int bytes_to_copy)
-{
-	int level= (int) (pow(10.0, (double) attenuation / 20.0) * 128.0);
-	int16_t *d = (int16_t *) dest;
-	int count = bytes_to_copy/2;
-	while (count>0)
-	{
-		*d++ = (*data++ * level) >> 7; /* / 128 */
-		count--;
-	}
-}
-
-//============================================================
-//  copy_sample_data
-//============================================================
-
-void sound_sdl::copy_sample_data(bool is_throttled, const int16_t *data, int bytes_to_copy)
-{
-	void *buffer1, *buffer2 = (void *)nullptr;
-	long length1, length2;
-	int cur_bytes;
-
-	// attempt to lock the stream buffer
-	if (lock_buffer(is_throttled, stream_buffer_in, bytes_to_copy, &buffer1, &length1, &buffer2, &length2) < 0)
-	{
-		buffer_underflows++;
-		return;
-	}
-
-	// adjust the input pointer
-	stream_buffer_in += bytes_to_copy;
-	if (stream_buffer_in >= stream_buffer_size)
-	{
-		stream_buffer_in -= stream_buffer_size;
-		stream_loop = 1;
-
-		if (LOG_SOUND)
-			fprintf(sound_log, "stream_loop set to 1 (stream_buffer_in looped)\n");
-	}
-
-	// copy the first chunk
-	cur_bytes = (bytes_to_copy > length1) ? length1 : bytes_to_copy;
-	att_memcpy(buffer1, data, cur_bytes);
-
-	// adjust for the number of bytes
-	bytes_to_copy -= cur_bytes;
-	data = (int16_t *)((uint8_t *)data + cur_bytes);
-
-	// copy the second chunk
-	if (bytes_to_copy != 0)
-	{
-		cur_bytes = (bytes_to_copy > length2) ? length2 : bytes_to_copy;
-		att_memcpy(buffer2, data, cur_bytes);
-	}
-
-	// unlock
-	unlock_buffer();
-}
-
-
 //============================================================
 //  update_audio_stream
 //============================================================
@@ -251,74 +114,38 @@ void sound_sdl::update_audio_stream(bool is_throttled, const int16_t *buffer, in
 	// if nothing to do, don't do it
 	if (sample_rate() != 0 && stream_buffer)
 	{
-		int bytes_this_frame = samples_this_frame * sizeof(int16_t) * 2;
-		int play_position, write_position, stream_in;
-		int orig_write; // used in LOG
-
-		play_position = stream_playpos;
-
-		write_position = stream_playpos + ((sample_rate() / 50) * sizeof(int16_t) * 2);
-		orig_write = write_position;
+		int samples = samples_this_frame * 2;
 
 		if (!stream_in_initialized)
 		{
-			stream_in = stream_buffer_in = (write_position + stream_buffer_size) / 2;
+			// queue up the latency cushion before the device starts pulling
+			stream_buffer->clear(stream_prefill);
 
 			if (LOG_SOUND)
-			{
-				fprintf(sound_log, "stream_in = %d\n", (int)stream_in);
-				fprintf(sound_log, "stream_playpos = %d\n", (int)stream_playpos);
-				fprintf(sound_log, "write_position = %d\n", (int)write_position);
-			}
+				fprintf(sound_log, "prefill = %d\n", (int)stream_prefill);
+
 			// start playing
 			SDL_PauseAudio(0);
 
 			stream_in_initialized = 1;
 		}
-		else
+		else if (has_underflowed)
 		{
-			// normalize the stream in position
-			stream_in = stream_buffer_in;
-			if (stream_in < write_position && stream_loop == 1)
-				stream_in += stream_buffer_size;
-
-			// now we should have, in order:
-			//    <------pp---wp---si--------------->
-
-			// if we're between play and write positions, then bump forward, but only in full chunks
-			while (stream_in < write_position)
-			{
-				if (LOG_SOUND)
-					fprintf(sound_log, "Underflow: PP=%d  WP=%d(%d)  SI=%d(%d)  BTF=%d\n", (int)play_position, (int)write_position, (int)orig_write, (int)stream_in, (int)stream_buffer_in, (int)bytes_this_frame);
-
-				buffer_underflows++;
-				stream_in += bytes_this_frame;
-			}
-
-			// if we're going to overlap the play position, just skip this chunk
-			if (stream_in + bytes_this_frame > play_position + stream_buffer_size)
-			{
-				if (LOG_SOUND)
-					fprintf(sound_log, "Overflow: PP=%d  WP=%d(%d)  SI=%d(%d)  BTF=%d\n", (int)play_position, (int)write_position, (int)orig_write, (int)stream_in, (int)stream_buffer_in, (int)bytes_this_frame);
-
-				buffer_overflows++;
-				return;
-			}
+			// the callback ran dry; rebuild the cushion so it doesn't do so again immediately
+			buffer_underflows++;
+			stream_buffer->clear(stream_prefill);
+			has_underflowed = false;
 		}
 
-		if (stream_in >= stream_buffer_size)
+		// whatever doesn't fit is dropped, keeping the latency bounded
+		int written = stream_buffer->write(buffer, samples, attenuation);
+		if (written < samples)
 		{
-			stream_in -= stream_buffer_size;
-			stream_loop = 1;
-
 			if (LOG_SOUND)
-				fprintf(sound_log, "stream_loop set to 1 (stream_in looped)\n");
+				fprintf(sound_log, "Overflow: queued=%d  dropped=%d\n", stream_buffer->count(), samples - written);
 
+			buffer_overflows++;
 		}
-
-		// now we know where to copy; let's do it
-		stream_buffer_in = stream_in;
-		copy_sample_data(is_throttled, buffer, bytes_this_frame);
 	}
 }
 
@@ -348,53 +175,27 @@ void sound_sdl::set_mastervolume(int _attenuation)
 static void sdl_callback(void *userdata, Uint8 *stream, int len)
 {
 	sound_sdl *thiz = (sound_sdl *) userdata;
-	int len1, len2, sb_in;
-
-	sb_in = thiz->stream_buffer_in;
-	if (thiz->stream_loop)
-		sb_in += thiz->stream_buffer_size;
-
-	if (sb_in < (thiz->stream_playpos+len))
-	{
-		if (LOG_SOUND)
-			fprintf(sound_log, "Underflow at sdl_callback: SPP=%d SBI=%d(%d) Len=%d\n", (int)thiz->stream_playpos, (int)sb_in, (int)thiz->stream_buffer_in, (int)len);
+	int samples = len / sizeof(int16_t);
 
-		return;
-	}
-	else if ((thiz->stream_playpos+len) > thiz->stream_buffer_size)
-	{
-		len1 = thiz->stream_buffer_size - thiz->stream_playpos;
-		len2 = len - len1;
-	}
-	else
-	{
-		len1 = len;
-		len2 = 0;
-	}
-
-	memcpy(stream, thiz->stream_buffer + thiz->stream_playpos, len1);
-	memset(thiz->stream_buffer + thiz->stream_playpos, 0, len1); // no longer needed
-	if (len2)
+	if (!thiz->callback_boosted)
 	{
-		memcpy(stream+len1, thiz->stream_buffer, len2);
-		memset(thiz->stream_buffer, 0, len2); // no longer needed
+		if (osd_thread_realtime_priority())
+			osd_printf_verbose("Audio: Callback thread is running at real-time priority\n");
+		thiz->callback_boosted = true;
 	}
 
-
-	// move the play cursor
-	thiz->stream_playpos += len1 + len2;
-	if (thiz->stream_playpos >= thiz->stream_buffer_size)
+	int available = thiz->stream_buffer->read((int16_t *)stream, samples);
+	if (available < samples)
 	{
-		thiz->stream_playpos -= thiz->stream_buffer_size;
-		thiz->stream_loop = 0;
-
 		if (LOG_SOUND)
-			fprintf(sound_log, "stream_loop set to 0 (stream_playpos looped)\n");
+			fprintf(sound_log, "Underflow at sdl_callback: available=%d Len=%d\n", available, samples);
+
+		memset(stream + available * sizeof(int16_t), 0, (samples - available) * sizeof(int16_t));
+		thiz->has_underflowed = true;
 	}
 
 	if (LOG_SOUND)
-		fprintf(sound_log, "callback: xfer len1 %d len2 %d, playpos %d\n",
-				len1, len2, thiz->stream_playpos);
+		fprintf(sound_log, "callback: xfer %d samples, %d queued\n", available, thiz->stream_buffer->count());
 }
 
 
@@ -426,7 +227,8 @@ int sound_sdl::init(const osd_options &options)
 
 		sdl_xfer_samples = SDL_XFER_SAMPLES;
 		stream_in_initialized = 0;
-		stream_loop = 0;
+		has_underflowed = false;
+		callback_boosted = false;
 
 		// set up the audio specs
 		aspec.freq = sample_rate();
@@ -447,11 +249,12 @@ int sound_sdl::init(const osd_options &options)
 		// pin audio latency
 		audio_latency = std::max(std::min(m_audio_latency, MAX_AUDIO_LATENCY), 1);
 
-		// compute the buffer sizes
-		stream_buffer_size = (sample_rate() * 2 * sizeof(int16_t) * (2 + audio_latency)) / 30;
-		stream_buffer_size = (stream_buffer_size / 1024) * 1024;
-		if (stream_buffer_size < 1024)
-			stream_buffer_size = 1024;
+		// compute the buffer sizes; playback runs about half a buffer behind
+		stream_buffer_size = (sample_rate() * 2 * (2 + audio_latency)) / 30;
+		stream_buffer_size = (stream_buffer_size / 512) * 512;
+		if (stream_buffer_size < 512)
+			stream_buffer_size = 512;
+		stream_prefill = stream_buffer_size / 2;
 
 		// create the buffers
 		if (sdl_create_buffers())
@@ -512,11 +315,9 @@ void sound_sdl::exit()
 
 int sound_sdl::sdl_create_buffers(void)
 {
-	osd_printf_verbose("sdl_create_buffers: creating stream buffer of %u bytes\n", stream_buffer_size);
+	osd_printf_verbose("sdl_create_buffers: creating stream buffer of %u samples\n", stream_buffer_size);
 
-	stream_buffer = global_alloc_array_clear<int8_t>(stream_buffer_size);
-	stream_playpos = 0;
-	buf_locked = 0;
+	stream_buffer = global_alloc(audio_buffer<int16_t>(stream_buffer_size, 2));
 	return 0;
 }
 
@@ -528,7 +329,7 @@ void sound_sdl::sdl_destroy_buffers(void)
 {
 	// release the buffer
 	if (stream_buffer)
-		global_free_array(stream_buffer);
+		global_free(stream_buffer);
 	stream_buffer = nullptr;
 }
 
@@ -26,6 +26,7 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) = 0;
 	virtual void set_mastervolume(int attenuation) = 0;
+	virtual unsigned underflows() const { return 0; }
 
 	int sample_rate() const { return m_sample_rate; }
 
@@ -212,6 +212,57 @@ public:
 	virtual error flush() = 0;
 
 
+	/*-----------------------------------------------------------------------------
+	    osd_file::map: map the whole file into memory for reading
+
+	    Parameters:
+
+	        data - reference to a pointer to receive the address of the
+	            file's contents; valid until the file is closed
+
+	        length - reference to a uint64_t to receive the number of bytes
+	            mapped
+
+	    Return value:
+
+	        a file_error describing any error that occurred while mapping
+	        the file, or FILERR_NONE if no error occurred
+
+	    Notes:
+
+	        Mapping is optional; implementations that can't map files
+	        return an error and callers fall back to read.  Data written
+	        to the file after it was mapped may not be visible.
+	-----------------------------------------------------------------------------*/
+	virtual error map(void const *&data, std::uint64_t &length) { return error::FAILURE; }
+
+
+	/*-----------------------------------------------------------------------------
+	    osd_file::map_private: map the whole file into memory copy-on-write
+
+	    Parameters:
+
+	        data - reference to a pointer to receive the address of the
+	            file's contents; valid until the file is closed
+
+	        length - reference to a uint64_t to receive the number of bytes
+	            mapped
+
+	    Return value:
+
+	        a file_error describing any error that occurred while mapping
+	        the file, or FILERR_NONE if no error occurred
+
+	    Notes:
+
+	        The view is writable, but writes go to private copies of the
+	        touched pages and never reach the file.  Untouched pages are
+	        shared with every other process mapping the same file.  Like
+	        map, this is optional.
+	-----------------------------------------------------------------------------*/
+	virtual error map_private(void *&data, std::uint64_t &length) { return error::FAILURE; }
+
+
 	/*-----------------------------------------------------------------------------
 	    osd_file::remove: deletes a file
 
@@ -513,12 +564,14 @@ typedef void *(*osd_work_callback)(void *param, int threadid);
 
             WORK_QUEUE_FLAG_MULTI - indicates that the work queue should
                 take advantage of as many processors as it can; items queued
-                here are assumed to be fully independent or shared
+                here are assumed to be fully independent or shared; all such
+                queues are served by one shared pool of worker threads
 
             WORK_QUEUE_FLAG_HIGH_FREQ - indicates that items are expected
-                to be queued at high frequency and acted upon quickly; in
-                general, this implies doing some spin-waiting internally
-                before falling back to OS-specific synchronization
+                to be queued at high frequency and acted upon quickly; pool
+                workers look at these queues before any others, and queues
+                with their own thread spin-wait for a while before falling
+                back to OS-specific synchronization
 
     Return value:
 
@@ -679,6 +732,29 @@ void *osd_work_item_result(osd_work_item *item);
 void osd_work_item_release(osd_work_item *item);
 
 
+/*-----------------------------------------------------------------------------
+    osd_thread_realtime_priority: request real-time scheduling for the
+    calling thread
+
+    Parameters:
+
+        None
+
+    Return value:
+
+        true if the request was granted, false otherwise
+
+    Notes:
+
+        This is intended for audio device callback threads, which must
+        never miss a deadline. On Windows the thread joins the MMCSS
+        "Pro Audio" task; on Linux it is moved to SCHED_FIFO, which is only
+        allowed when the user has an rtprio limit or CAP_SYS_NICE. Failure
+        is harmless and leaves the thread as it was.
+-----------------------------------------------------------------------------*/
+bool osd_thread_realtime_priority(void);
+
+
 
 /***************************************************************************
     MISCELLANEOUS INTERFACES
@@ -705,6 +781,43 @@ void osd_work_item_release(osd_work_item *item);
 void *osd_alloc_executable(size_t size);
 
 
+/*-----------------------------------------------------------------------------
+    osd_reserve_executable: reserve address space for executable code
+        without committing any memory to it
+
+    Parameters:
+
+        size - the number of bytes to reserve
+
+    Return value:
+
+        a pointer to the reserved range, or nullptr on failure
+
+    Notes:
+
+        The range must be committed with osd_commit_executable before use,
+        and is released with osd_free_executable.
+-----------------------------------------------------------------------------*/
+void *osd_reserve_executable(size_t size);
+
+
+/*-----------------------------------------------------------------------------
+    osd_commit_executable: commit part of a range reserved with
+        osd_reserve_executable so that it can hold executable code
+
+    Parameters:
+
+        ptr - page-aligned start of the part to commit
+
+        size - the number of bytes to commit, a multiple of the page size
+
+    Return value:
+
+        true if the memory was committed
+-----------------------------------------------------------------------------*/
+bool osd_commit_executable(void *ptr, size_t size);
+
+
 /*-----------------------------------------------------------------------------
     osd_free_executable: free memory allocated by osd_alloc_executable
 
@@ -741,6 +854,18 @@ void osd_free_executable(void *ptr, size_t size);
 -----------------------------------------------------------------------------*/
 void osd_break_into_debugger(const char *message);
 
+/*-----------------------------------------------------------------------------
+    osd_peak_memory_usage: return the most memory the process has had
+        resident at any one time
+
+    Return value:
+
+        the peak resident set size in bytes, or 0 if the system does not
+        report it
+
+-----------------------------------------------------------------------------*/
+uint64_t osd_peak_memory_usage(void);
+
 /*-----------------------------------------------------------------------------
     osd_get_clipboard_text: retrieves text from the clipboard
 
@@ -18,6 +18,7 @@
 #endif
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
 #include <thread>
 #include <vector>
 #include <algorithm>
@@ -27,9 +28,16 @@
 
 #include "eminline.h"
 
+#if defined(OSD_WINDOWS) || defined(SDLMAME_WIN32)
+#include "modules/lib/osdlib.h"
+#endif
+
 #if defined(SDLMAME_LINUX) || defined(SDLMAME_BSD) || defined(SDLMAME_HAIKU) || defined(SDLMAME_EMSCRIPTEN) || defined(SDLMAME_MACOSX)
 #include <pthread.h>
 #endif
+#if defined(SDLMAME_LINUX)
+#include <sched.h>
+#endif
 
 //============================================================
 //  DEBUGGING
@@ -75,12 +83,6 @@ static void spin_while(const volatile _AtomType * volatile atom, const _MainType
 	} while (((*atom == val) ^ invert) && osd_ticks() < stopspin);
 }
 
-template<typename _AtomType, typename _MainType>
-static void spin_while_not(const volatile _AtomType * volatile atom, const _MainType val, const osd_ticks_t timeout)
-{
-	spin_while<_AtomType, _MainType>(atom, val, timeout, 1);
-}
-
 //============================================================
 //  osd_num_processors
 //============================================================
@@ -140,6 +142,7 @@ struct osd_work_queue
 	, exiting(0)
 	, threads(0)
 	, flags(0)
+	, pooled(false)
 	, doneevent(true, true)     // manual reset, signalled
 #if KEEP_STATISTICS
 	, itemsqueued(0)
@@ -155,11 +158,12 @@ struct osd_work_queue
 	osd_work_item ** volatile tailptr;  // pointer to the tail pointer of work items in the queue
 	std::atomic<osd_work_item *> free;  // free list of work items
 	std::atomic<int32_t>  items;          // items in the queue
-	std::atomic<int32_t>  livethreads;    // number of live threads
+	std::atomic<int32_t>  livethreads;    // number of live threads (pool workers inside the queue for pooled queues)
 	std::atomic<int32_t>  waiting;        // is someone waiting on the queue to complete?
 	std::atomic<int32_t>  exiting;        // should the threads exit on their next opportunity?
 	uint32_t              threads;        // number of threads in this queue
 	uint32_t              flags;          // creation flags
+	bool                pooled;         // items are run by the shared worker pool
 	std::vector<work_thread_info *>  thread;         // array of thread information
 	osd_event           doneevent;      // event signalled when work is complete
 
@@ -196,11 +200,50 @@ struct osd_work_item
 	std::atomic<int32_t>  done;           // is the item done?
 };
 
+// all multi queues share one set of worker threads, so several
+// queues don't each occupy every processor; idle workers sleep
+// until items are queued on any of them
+struct work_pool
+{
+	work_pool()
+	: idle(0)
+	, exiting(false)
+	{
+	}
+
+	std::mutex          lock;           // protects the members below
+	std::condition_variable wake;       // signalled when items are queued or the pool exits
+	std::vector<osd_work_queue *> queues; // attached queues, high frequency queues first
+	std::vector<std::thread *> threads; // the workers
+	int32_t             idle;           // workers waiting for work
+	bool                exiting;        // should the workers exit?
+};
+
+
+struct cpu_topology_entry
+{
+	int                 cpu;            // logical processor number
+	int                 core;           // lowest processor on the same physical core
+	int                 domain;         // lowest processor sharing the last level cache
+	int                 perf;           // relative speed, bigger is faster; 0 if unknown
+};
+
+struct cpu_placement
+{
+	int                 main = -1;      // processor for the emulation thread, -1 to leave alone
+	std::vector<int>    workers;        // processors the pool workers may run on
+};
+
+
 //============================================================
 //  GLOBAL VARIABLES
 //============================================================
 
 int osd_num_processors = 0;
+int osd_thread_affinity = 0;
+
+static std::mutex pool_alloc_lock;      // protects creating and destroying the pool
+static work_pool *pool = nullptr;
 
 //============================================================
 //  FUNCTION PROTOTYPES
@@ -210,6 +253,11 @@ static int effective_num_processors(void);
 static void * worker_thread_entry(void *param);
 static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread);
 static bool queue_has_list_items(osd_work_queue *queue);
+static int pool_attach(osd_work_queue *queue, int numthreads);
+static void pool_detach(osd_work_queue *queue);
+static void pool_worker_entry(int index);
+static const cpu_placement &thread_placement(void);
+static void set_thread_affinity(std::thread::native_handle_type handle, const std::vector<int> &cpus);
 
 //============================================================
 //  osd_thread_adjust_priority
@@ -273,6 +321,13 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	// clamp to the maximum
 	queue->threads = std::min(threadnum, WORK_MAX_THREADS);
 
+	// multi queues run on the shared pool; the calling thread gets the last id
+	if ((flags & WORK_QUEUE_FLAG_MULTI) && queue->threads > 0)
+	{
+		queue->pooled = true;
+		queue->threads = pool_attach(queue, std::min(threadnum, WORK_MAX_THREADS - 1));
+	}
+
 	// allocate memory for thread array (+1 to count the calling thread if WORK_QUEUE_FLAG_MULTI)
 	if (flags & WORK_QUEUE_FLAG_MULTI)
 		allocthreadnum = queue->threads + 1;
@@ -287,7 +342,7 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 		queue->thread.push_back(new work_thread_info(threadnum, *queue));
 
 	// iterate over threads
-	for (threadnum = 0; threadnum < queue->threads; threadnum++)
+	for (threadnum = 0; threadnum < (queue->pooled ? 0 : queue->threads); threadnum++)
 	{
 		work_thread_info *thread = queue->thread[threadnum];
 
@@ -349,20 +404,9 @@ bool osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 
 		end_timing(thread->waittime);
 
-		// process what we can as a worker thread
+		// process what we can as a worker thread; the items still running
+		// on other threads are waited for below rather than spun on
 		worker_thread_process(queue, thread);
-
-		// if we're a high frequency queue, spin until done
-		if (queue->flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue->items != 0)
-		{
-			// spin until we're done
-			begin_timing(thread->spintime);
-			spin_while_not<std::atomic<int>,int>(&queue->items, 0, timeout);
-			end_timing(thread->spintime);
-
-			begin_timing(thread->waittime);
-			return (queue->items == 0);
-		}
 		begin_timing(thread->waittime);
 	}
 
@@ -390,6 +434,10 @@ void osd_work_queue_free(osd_work_queue *queue)
 		end_timing(queue->thread[queue->threads]->waittime);
 	}
 
+	// make sure no pool worker is still inside the queue
+	if (queue->pooled)
+		pool_detach(queue);
+
 	// signal all the threads to exit
 	queue->exiting = true;
 	for (int threadnum = 0; threadnum < queue->threads; threadnum++)
@@ -526,8 +574,19 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 	queue->items += numitems;
 	add_to_stat(queue->itemsqueued, numitems);
 
+	// wake up pool workers to do the work
+	if (queue->pooled)
+	{
+		std::lock_guard<std::mutex> lock(pool->lock);
+		for (int wake = std::min(numitems, pool->idle); wake > 0; wake--)
+		{
+			pool->wake.notify_one();
+			add_to_stat(queue->setevents, 1);
+		}
+	}
+
 	// look for free threads to do the work
-	if (queue->livethreads < queue->threads)
+	else if (queue->livethreads < queue->threads)
 	{
 		int threadnum;
 
@@ -627,6 +686,35 @@ void osd_work_item_release(osd_work_item *item)
 }
 
 
+//============================================================
+//  osd_thread_realtime_priority
+//============================================================
+
+bool osd_thread_realtime_priority(void)
+{
+#if defined(OSD_WINDOWS) || defined(SDLMAME_WIN32)
+	// avrt.dll is not present on every system, so bind to it at runtime
+	typedef HANDLE (WINAPI *av_set_mm_thread_characteristics_fn)(LPCWSTR, LPDWORD);
+	HMODULE avrt = LoadLibraryA("avrt.dll");
+	if (avrt != nullptr)
+	{
+		auto av_set_mm_thread_characteristics = (av_set_mm_thread_characteristics_fn)GetProcAddress(avrt, "AvSetMmThreadCharacteristicsW");
+		DWORD task_index = 0;
+		if (av_set_mm_thread_characteristics != nullptr && av_set_mm_thread_characteristics(L"Pro Audio", &task_index) != nullptr)
+			return true;
+	}
+	return SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL) != 0;
+#elif defined(SDLMAME_LINUX)
+	struct sched_param  sched;
+
+	sched.sched_priority = sched_get_priority_min(SCHED_FIFO);
+	return pthread_setschedparam(pthread_self(), SCHED_FIFO, &sched) == 0;
+#else
+	return false;
+#endif
+}
+
+
 //============================================================
 //  effective_num_processors
 //============================================================
@@ -635,6 +723,10 @@ static int effective_num_processors(void)
 {
 	int physprocs = osd_get_num_processors();
 
+	// when placing threads, only count the processors they are placed on
+	if (osd_thread_affinity && thread_placement().main >= 0)
+		physprocs = std::min(physprocs, 1 + int(thread_placement().workers.size()));
+
 	// osd_num_processors == 0 for 'auto'
 	if (osd_num_processors > 0)
 	{
@@ -656,6 +748,259 @@ static int effective_num_processors(void)
 }
 
 
+//============================================================
+//  get_cpu_topology
+//============================================================
+
+#if defined(SDLMAME_LINUX)
+static bool read_sysfs_int(const char *path, int &value)
+{
+	FILE *file = fopen(path, "r");
+	if (file == nullptr)
+		return false;
+	bool result = fscanf(file, "%d", &value) == 1;
+	fclose(file);
+	return result;
+}
+
+// parses a kernel CPU list such as "0-3,8-11"
+static bool read_sysfs_cpu_list(const char *path, std::vector<int> &cpus)
+{
+	FILE *file = fopen(path, "r");
+	if (file == nullptr)
+		return false;
+	int first, last;
+	while (fscanf(file, "%d", &first) == 1)
+	{
+		last = first;
+		int sep = fgetc(file);
+		if (sep == '-')
+		{
+			if (fscanf(file, "%d", &last) != 1)
+				break;
+			sep = fgetc(file);
+		}
+		for (int cpu = first; cpu <= last; cpu++)
+			cpus.push_back(cpu);
+		if (sep != ',')
+			break;
+	}
+	fclose(file);
+	return !cpus.empty();
+}
+
+static int first_cpu_in_list(const char *path, int fallback)
+{
+	std::vector<int> cpus;
+	return read_sysfs_cpu_list(path, cpus) ? cpus.front() : fallback;
+}
+#endif
+
+static std::vector<cpu_topology_entry> get_cpu_topology(void)
+{
+	std::vector<cpu_topology_entry> result;
+
+#if defined(SDLMAME_LINUX)
+	std::vector<int> online;
+	if (!read_sysfs_cpu_list("/sys/devices/system/cpu/online", online))
+		return result;
+
+	char path[256];
+	for (int cpu : online)
+	{
+		cpu_topology_entry entry;
+		entry.cpu = cpu;
+
+		snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", cpu);
+		entry.core = first_cpu_in_list(path, cpu);
+
+		// the last level cache is normally index3; without one, use the package
+		snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/core_siblings_list", cpu);
+		entry.domain = first_cpu_in_list(path, 0);
+		for (int index = 0; index < 8; index++)
+		{
+			int level;
+			snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cache/index%d/level", cpu, index);
+			if (!read_sysfs_int(path, level))
+				break;
+			if (level == 3)
+			{
+				snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cache/index%d/shared_cpu_list", cpu, index);
+				entry.domain = first_cpu_in_list(path, entry.domain);
+			}
+		}
+
+		// ARM big.LITTLE systems report a capacity; hybrid x86 parts differ in top frequency
+		snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpu_capacity", cpu);
+		if (!read_sysfs_int(path, entry.perf))
+		{
+			snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpufreq/cpuinfo_max_freq", cpu);
+			if (!read_sysfs_int(path, entry.perf))
+				entry.perf = 0;
+		}
+		result.push_back(entry);
+	}
+#elif defined(OSD_WINDOWS) || defined(SDLMAME_WIN32)
+	// not present before Windows 7, so look it up at runtime; only processor group 0 is considered
+	typedef BOOL (WINAPI *get_info_ptr)(LOGICAL_PROCESSOR_RELATIONSHIP, PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX, PDWORD);
+	osd::dynamic_module::ptr kernel32 = osd::dynamic_module::open({ "kernel32.dll" });
+	get_info_ptr get_info = kernel32->bind<get_info_ptr>("GetLogicalProcessorInformationEx");
+	DWORD length = 0;
+	if (get_info == nullptr || get_info(RelationAll, nullptr, &length) || GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+		return result;
+	std::vector<uint8_t> buffer(length);
+	if (!get_info(RelationAll, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(&buffer[0]), &length))
+		return result;
+
+	auto lowest = [] (KAFFINITY mask) { int cpu = 0; while (!(mask & 1)) { mask >>= 1; cpu++; } return cpu; };
+	std::vector<cpu_topology_entry> cpus(sizeof(KAFFINITY) * 8);
+	for (auto &entry : cpus)
+		entry.cpu = -1;
+	for (DWORD offset = 0; offset < length; )
+	{
+		auto info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(&buffer[offset]);
+		if (info->Relationship == RelationProcessorCore && info->Processor.GroupMask[0].Group == 0 && info->Processor.GroupMask[0].Mask != 0)
+		{
+			KAFFINITY mask = info->Processor.GroupMask[0].Mask;
+			for (int cpu = 0; cpu < int(cpus.size()); cpu++)
+				if (mask & (KAFFINITY(1) << cpu))
+				{
+					cpus[cpu].cpu = cpu;
+					cpus[cpu].core = lowest(mask);
+					// EfficiencyClass follows Flags; older headers still call it reserved
+					cpus[cpu].perf = (&info->Processor.Flags)[1];
+				}
+		}
+		offset += info->Size;
+	}
+	for (auto &entry : cpus)
+		entry.domain = 0;
+	for (DWORD offset = 0; offset < length; )
+	{
+		auto info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(&buffer[offset]);
+		if (info->Relationship == RelationCache && info->Cache.Level == 3 && info->Cache.GroupMask.Group == 0 && info->Cache.GroupMask.Mask != 0)
+		{
+			KAFFINITY mask = info->Cache.GroupMask.Mask;
+			for (int cpu = 0; cpu < int(cpus.size()); cpu++)
+				if (mask & (KAFFINITY(1) << cpu))
+					cpus[cpu].domain = lowest(mask);
+		}
+		offset += info->Size;
+	}
+	for (auto &entry : cpus)
+		if (entry.cpu >= 0)
+			result.push_back(entry);
+#endif
+
+	return result;
+}
+
+
+//============================================================
+//  thread_placement
+//============================================================
+
+static cpu_placement compute_placement(void)
+{
+	cpu_placement result;
+	std::vector<cpu_topology_entry> cpus = get_cpu_topology();
+	if (cpus.size() < 2)
+		return result;
+
+	// keep the fastest class of processors; frequencies within 1/8 of the top count as the same
+	int bestperf = 0;
+	for (auto &entry : cpus)
+		bestperf = std::max(bestperf, entry.perf);
+	int minperf = bestperf - bestperf / 8;
+	cpus.erase(std::remove_if(cpus.begin(), cpus.end(), [minperf] (const cpu_topology_entry &entry) { return entry.perf < minperf; }), cpus.end());
+
+	// pick the cache domain holding the most of them
+	int domain = -1, domaincount = 0;
+	for (auto &entry : cpus)
+	{
+		int count = std::count_if(cpus.begin(), cpus.end(), [&entry] (const cpu_topology_entry &other) { return other.domain == entry.domain; });
+		if (count > domaincount)
+		{
+			domain = entry.domain;
+			domaincount = count;
+		}
+	}
+
+	// the emulation thread gets the first one; workers get the rest, preferring other cores
+	for (auto &entry : cpus)
+		if (entry.domain == domain)
+		{
+			if (result.main < 0)
+				result.main = entry.cpu;
+			else
+				result.workers.push_back(entry.cpu);
+		}
+	int maincore = std::find_if(cpus.begin(), cpus.end(), [&result] (const cpu_topology_entry &entry) { return entry.cpu == result.main; })->core;
+	std::vector<int> othercores;
+	for (auto &entry : cpus)
+		if (entry.domain == domain && entry.core != maincore)
+			othercores.push_back(entry.cpu);
+	if (!othercores.empty())
+		result.workers = othercores;
+	if (result.workers.empty())
+		result.main = -1;
+	return result;
+}
+
+static const cpu_placement &thread_placement(void)
+{
+	static const cpu_placement placement = compute_placement();
+	return placement;
+}
+
+
+//============================================================
+//  set_thread_affinity
+//============================================================
+
+static void set_thread_affinity(std::thread::native_handle_type handle, const std::vector<int> &cpus)
+{
+	if (cpus.empty())
+		return;
+#if defined(SDLMAME_LINUX)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	for (int cpu : cpus)
+		CPU_SET(cpu, &set);
+	pthread_setaffinity_np(handle, sizeof(set), &set);
+#elif defined(OSD_WINDOWS) || defined(SDLMAME_WIN32)
+	DWORD_PTR mask = 0;
+	for (int cpu : cpus)
+		mask |= DWORD_PTR(1) << cpu;
+	SetThreadAffinityMask((HANDLE)handle, mask);
+#endif
+}
+
+
+//============================================================
+//  osd_set_main_thread_affinity
+//============================================================
+
+void osd_set_main_thread_affinity(void)
+{
+	if (!osd_thread_affinity)
+		return;
+
+	const cpu_placement &placement = thread_placement();
+	if (placement.main < 0)
+	{
+		osd_printf_verbose("No CPU topology to place threads by\n");
+		return;
+	}
+	osd_printf_verbose("Placing the emulation thread on CPU %d and workers on %d CPUs sharing its cache\n", placement.main, int(placement.workers.size()));
+#if defined(SDLMAME_LINUX)
+	set_thread_affinity(pthread_self(), std::vector<int>(1, placement.main));
+#elif defined(OSD_WINDOWS) || defined(SDLMAME_WIN32)
+	SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << placement.main);
+#endif
+}
+
+
 //============================================================
 //  worker_thread_entry
 //============================================================
@@ -793,8 +1138,8 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 		}
 	}
 
-	// we don't need to set the doneevent for multi queues because they spin
-	if (queue->waiting)
+	// only signal the waiter once the items running on other threads are done too
+	if (queue->waiting && queue->items == 0)
 	{
 		queue->doneevent.set();
 		add_to_stat(queue->setevents, 1);
@@ -803,6 +1148,140 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 	end_timing(thread->runtime);
 }
 
+//============================================================
+//  pool_attach - add a multi queue to the shared
+//  pool, creating the pool if needed; returns the
+//  number of pool workers
+//============================================================
+
+static int pool_attach(osd_work_queue *queue, int numthreads)
+{
+	std::lock_guard<std::mutex> alloc_lock(pool_alloc_lock);
+
+	if (pool == nullptr)
+	{
+		pool = new work_pool();
+		for (int threadnum = 0; threadnum < numthreads; threadnum++)
+		{
+			pool->threads.push_back(new std::thread(pool_worker_entry, threadnum));
+			thread_adjust_priority(pool->threads.back(), 0);
+			if (osd_thread_affinity)
+				set_thread_affinity(pool->threads.back()->native_handle(), thread_placement().workers);
+		}
+	}
+
+	// high frequency queues are served first
+	std::lock_guard<std::mutex> lock(pool->lock);
+	auto pos = pool->queues.end();
+	if (queue->flags & WORK_QUEUE_FLAG_HIGH_FREQ)
+		pos = std::find_if(pool->queues.begin(), pool->queues.end(), [] (osd_work_queue *q) { return !(q->flags & WORK_QUEUE_FLAG_HIGH_FREQ); });
+	pool->queues.insert(pos, queue);
+
+	return int(pool->threads.size());
+}
+
+
+//============================================================
+//  pool_detach - remove a queue from the shared
+//  pool, stopping the pool with the last queue
+//============================================================
+
+static void pool_detach(osd_work_queue *queue)
+{
+	std::lock_guard<std::mutex> alloc_lock(pool_alloc_lock);
+
+	// once detached no worker can enter the queue, wait for those still inside
+	bool last;
+	{
+		std::lock_guard<std::mutex> lock(pool->lock);
+		pool->queues.erase(std::find(pool->queues.begin(), pool->queues.end(), queue));
+		last = pool->queues.empty();
+		if (last)
+			pool->exiting = true;
+	}
+	while (queue->livethreads != 0)
+		std::this_thread::yield();
+
+	if (last)
+	{
+		pool->wake.notify_all();
+		for (std::thread *thread : pool->threads)
+		{
+			thread->join();
+			delete thread;
+		}
+		delete pool;
+		pool = nullptr;
+	}
+}
+
+
+//============================================================
+//  pool_find_work - pick the queue a pool worker
+//  should serve next; called with the pool locked
+//============================================================
+
+static osd_work_queue *pool_find_work(osd_work_queue *last)
+{
+	// take the first queue with items, but stay with the previous
+	// queue if it has items of the same priority
+	osd_work_queue *found = nullptr;
+	for (osd_work_queue *queue : pool->queues)
+	{
+		if (queue->list.load() == nullptr)
+			continue;
+		if (found == nullptr)
+			found = queue;
+		else if ((queue->flags ^ found->flags) & WORK_QUEUE_FLAG_HIGH_FREQ)
+			break;
+		if (queue == last)
+			return queue;
+	}
+	return found;
+}
+
+
+//============================================================
+//  pool_worker_entry
+//============================================================
+
+static void pool_worker_entry(int index)
+{
+	osd_work_queue *last = nullptr;
+	std::unique_lock<std::mutex> lock(pool->lock);
+
+	// loop until we exit
+	for ( ;; )
+	{
+		osd_work_queue *queue = pool_find_work(last);
+		if (queue == nullptr)
+		{
+			if (pool->exiting)
+				break;
+
+			// park until something is queued
+			pool->idle++;
+			pool->wake.wait(lock);
+			pool->idle--;
+			continue;
+		}
+
+		// the queue can't be freed while we are counted as live
+		++queue->livethreads;
+		lock.unlock();
+
+		work_thread_info *thread = queue->thread[index];
+		thread->active = true;
+		worker_thread_process(queue, thread);
+		thread->active = false;
+
+		lock.lock();
+		--queue->livethreads;
+		last = queue;
+	}
+}
+
+
 bool queue_has_list_items(osd_work_queue *queue)
 {
 	std::lock_guard<std::mutex> lock(queue->lock);
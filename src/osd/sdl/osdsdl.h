@@ -160,5 +160,7 @@ private:
 //============================================================
 
 extern int osd_num_processors;
+extern int osd_thread_affinity;
+void osd_set_main_thread_affinity(void);
 
 #endif
@@ -476,6 +476,17 @@ void sdl_osd_interface::init(running_machine &machine)
 		}
 	}
 
+	/* place the emulation and worker threads */
+	stemp = options().affinity();
+
+	osd_thread_affinity = 0;
+
+	if (strcmp(stemp, OSDOPTVAL_AUTO) == 0)
+		osd_thread_affinity = 1;
+	else if (strcmp(stemp, OSDOPTVAL_NONE) != 0)
+		osd_printf_warning("Invalid affinity value %s; reverting to none\n", stemp);
+	osd_set_main_thread_affinity();
+
 	/* Initialize SDL */
 
 	if (SDL_InitSubSystem(SDL_INIT_VIDEO)) {
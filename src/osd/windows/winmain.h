@@ -347,6 +347,8 @@ extern const options_entry mame_win_options[];
 
 // defined in winwork.c
 extern int osd_num_processors;
+extern int osd_thread_affinity;
+void osd_set_main_thread_affinity(void);
 
 
 #endif
@@ -104,6 +104,7 @@ const int MODE_GDI = 2;
 #define OPTION_VERBOSE "verbose"
 #define OPTION_FIX "fix"
 #define OPTION_NUMPROCESSORS "numprocessors"
+#define OPTION_FAST_CODEC "fastcodec"
 #define OPTION_SIZE "size"
 #define OPTION_TEMPLATE "template"
 
@@ -154,7 +155,7 @@ struct command_description
 	const char *name;
 	void (*handler)(parameters_t &);
 	const char *description;
-	const char *valid_options[16];
+	const char *valid_options[17];
 };
 
 
@@ -590,6 +591,7 @@ static const option_description s_options[] =
 	{ OPTION_VALUE_TEXT,            "vt",   true, " <text>: text for the metadata" },
 	{ OPTION_VALUE_FILE,            "vf",   true, " <file>: file containing data to add" },
 	{ OPTION_NUMPROCESSORS,         "np",   true, " <processors>: limit the number of processors to use during compression" },
+	{ OPTION_FAST_CODEC,            "fc",   false, ": stop trying every codec on each hunk while one keeps winning" },
 	{ OPTION_NO_CHECKSUM,           "nocs", false, ": do not include this metadata information in the overall SHA-1" },
 	{ OPTION_FIX,                   "f",    false, ": fix the SHA-1 if it is incorrect" },
 	{ OPTION_VERBOSE,               "v",    false, ": output additional information" },
@@ -628,7 +630,8 @@ static const command_description s_commands[] =
 			REQUIRED OPTION_HUNK_SIZE,
 			REQUIRED OPTION_UNIT_SIZE,
 			OPTION_COMPRESSION,
-			OPTION_NUMPROCESSORS
+			OPTION_NUMPROCESSORS,
+			OPTION_FAST_CODEC
 		}
 	},
 
@@ -649,7 +652,8 @@ static const command_description s_commands[] =
 			OPTION_CHS,
 			OPTION_SIZE,
 			OPTION_SECTOR_SIZE,
-			OPTION_NUMPROCESSORS
+			OPTION_NUMPROCESSORS,
+			OPTION_FAST_CODEC
 		}
 	},
 
@@ -661,7 +665,8 @@ static const command_description s_commands[] =
 			REQUIRED OPTION_INPUT,
 			OPTION_HUNK_SIZE,
 			OPTION_COMPRESSION,
-			OPTION_NUMPROCESSORS
+			OPTION_NUMPROCESSORS,
+			OPTION_FAST_CODEC
 		}
 	},
 
@@ -675,7 +680,8 @@ static const command_description s_commands[] =
 			OPTION_INPUT_LENGTH_FRAMES,
 			OPTION_HUNK_SIZE,
 			OPTION_COMPRESSION,
-			OPTION_NUMPROCESSORS
+			OPTION_NUMPROCESSORS,
+			OPTION_FAST_CODEC
 		}
 	},
 
@@ -739,7 +745,8 @@ static const command_description s_commands[] =
 			OPTION_INPUT_LENGTH_HUNKS,
 			OPTION_HUNK_SIZE,
 			OPTION_COMPRESSION,
-			OPTION_NUMPROCESSORS
+			OPTION_NUMPROCESSORS,
+			OPTION_FAST_CODEC
 		}
 	},
 
@@ -1222,9 +1229,10 @@ static const char *compression_string(std::string &str, chd_codec_type compressi
 //  compress_common - standard compression loop
 //-------------------------------------------------
 
-static void compress_common(chd_file_compressor &chd)
+static void compress_common(chd_file_compressor &chd, const parameters_t &params)
 {
 	// begin compressing
+	chd.set_codec_heuristic(params.find(OPTION_FAST_CODEC) != params.end());
 	chd.compress_begin();
 
 	// loop until done
@@ -1708,7 +1716,7 @@ static void do_create_raw(parameters_t &params)
 			chd->clone_all_metadata(output_parent);
 
 		// compress it generically
-		compress_common(*chd);
+		compress_common(*chd, params);
 	}
 	catch (...)
 	{
@@ -1917,7 +1925,7 @@ static void do_create_hd(parameters_t &params)
 
 		// compress it generically
 		if (input_file)
-			compress_common(*chd);
+			compress_common(*chd, params);
 	}
 	catch (...)
 	{
@@ -2007,7 +2015,7 @@ static void do_create_cd(parameters_t &params)
 			report_error(1, "Error adding CD metadata: %s", chd_file::error_string(err));
 
 		// compress it generically
-		compress_common(*chd);
+		compress_common(*chd, params);
 		delete chd;
 	}
 	catch (...)
@@ -2126,7 +2134,7 @@ static void do_create_ld(parameters_t &params)
 			report_error(1, "Error adding AV metadata: %s\n", chd_file::error_string(err));
 
 		// create the compressor and then run it generically
-		compress_common(*chd);
+		compress_common(*chd, params);
 
 		// write the final LD metadata
 		if (info.height == 524/2 || info.height == 624/2)
@@ -2270,7 +2278,7 @@ static void do_copy(parameters_t &params)
 		}
 
 		// compress it generically
-		compress_common(*chd);
+		compress_common(*chd, params);
 		delete chd;
 	}
 	catch (...)
@@ -0,0 +1,78 @@
+#!/usr/bin/python
+##
+## license:BSD-3-Clause
+## copyright-holders:Aaron Giles
+
+# Run a list of systems headless with -framehash, in parallel processes,
+# either recording checksum baselines or comparing against them.
+# Each line of the list names a system, optionally followed by an input
+# file to play back; blank lines and lines starting with # are ignored.
+# For Python 2 and 3
+
+import argparse
+import os
+import subprocess
+import sys
+import threading
+
+
+def runEntry(args, system, inp):
+    baseline = os.path.join(args.baselines, system + '.fh')
+    command = [args.mame, system, '-video', 'none', '-sound', 'none', '-nothrottle', '-seconds_to_run', str(args.seconds), '-framehash_interval', str(args.interval)]
+    if inp:
+        command += ['-playback', inp]
+    if args.record:
+        command += ['-framehash', baseline]
+    else:
+        command += ['-framehash_baseline', baseline]
+    with open(os.devnull, 'w') as devnull:
+        return subprocess.call(command, stdout=devnull, stderr=devnull if args.quiet else None)
+
+
+def worker(args, entries, results, lock):
+    while True:
+        with lock:
+            if not entries:
+                return
+            system, inp = entries.pop(0)
+        result = runEntry(args, system, inp)
+        with lock:
+            results.append((system, result))
+            sys.stdout.write('%s %s\n' % (system, 'ok' if result == 0 else 'FAILED (%d)' % result))
+            sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Record or check frame checksum baselines.')
+    parser.add_argument('mame', help='emulator executable')
+    parser.add_argument('list', help='file listing systems, each optionally followed by an input file')
+    parser.add_argument('baselines', help='directory holding one <system>.fh baseline per system')
+    parser.add_argument('-r', '--record', action='store_true', help='write new baselines instead of comparing')
+    parser.add_argument('-j', '--jobs', type=int, default=1, help='number of systems to run at once')
+    parser.add_argument('-s', '--seconds', type=int, default=30, help='emulated seconds to run each system')
+    parser.add_argument('-i', '--interval', type=int, default=1, help='frames between checksums')
+    parser.add_argument('-q', '--quiet', action='store_true', help='discard emulator error output')
+    args = parser.parse_args()
+
+    entries = []
+    with open(args.list) as listfile:
+        for line in listfile:
+            line = line.strip()
+            if line and not line.startswith('#'):
+                fields = line.split(None, 1)
+                entries.append((fields[0], fields[1].strip() if len(fields) > 1 else None))
+
+    if args.record and not os.path.isdir(args.baselines):
+        os.makedirs(args.baselines)
+
+    results = []
+    lock = threading.Lock()
+    threads = [threading.Thread(target=worker, args=(args, entries, results, lock)) for i in range(max(args.jobs, 1))]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    failures = [system for system, result in results if result != 0]
+    sys.stdout.write('%d run, %d failed\n' % (len(results), len(failures)))
+    sys.exit(1 if failures else 0)
@@ -0,0 +1,155 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    tracedump.cpp
+
+    Turns binary debugger traces (trace <file>,<cpu>,binary) into text,
+    condensing loops the same way the text tracer does.
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "corefile.h"
+#include "corestr.h"
+#include "tracefile.h"
+
+#define TRACE_LOOPS     64
+
+
+
+/***************************************************************************
+    CORE IMPLEMENTATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    read_u32 - fetch a little-endian value,
+    returning false at the end of the data
+-------------------------------------------------*/
+
+static bool read_u32(const uint8_t *&data, const uint8_t *end, uint32_t &value)
+{
+	if (end - data < 4)
+		return false;
+	value = data[0] | (data[1] << 8) | (data[2] << 16) | (uint32_t(data[3]) << 24);
+	data += 4;
+	return true;
+}
+
+
+/*-------------------------------------------------
+    dump_trace - print the contents of a trace
+-------------------------------------------------*/
+
+static int dump_trace(const char *filename, bool detect_loops)
+{
+	// read the whole file
+	util::core_file::ptr file;
+	if (util::core_file::open(filename, OPEN_FLAG_READ, file) != osd_file::error::NONE)
+	{
+		fprintf(stderr, "Error opening file '%s'\n", filename);
+		return 1;
+	}
+	const uint8_t *data = reinterpret_cast<const uint8_t *>(file->buffer());
+	const uint8_t *const end = data + file->size();
+
+	// check the header
+	uint32_t version, addrchars, taglength;
+	if (end - data < sizeof(util::tracefile::MAGIC) || memcmp(data, util::tracefile::MAGIC, sizeof(util::tracefile::MAGIC)) != 0)
+	{
+		fprintf(stderr, "'%s' is not a binary trace\n", filename);
+		return 1;
+	}
+	data += sizeof(util::tracefile::MAGIC);
+	if (!read_u32(data, end, version) || version != util::tracefile::VERSION || !read_u32(data, end, addrchars) || !read_u32(data, end, taglength) || end - data < taglength)
+	{
+		fprintf(stderr, "'%s' has an unsupported or damaged header\n", filename);
+		return 1;
+	}
+	printf("Trace of CPU '%.*s'\n\n", int(taglength), reinterpret_cast<const char *>(data));
+	data += taglength;
+
+	// walk the records
+	uint32_t history[TRACE_LOOPS];
+	memset(history, 0, sizeof(history));
+	int nextdex = 0;
+	int loops = 0;
+	uint32_t pc;
+	while (read_u32(data, end, pc))
+	{
+		// text goes straight out
+		if (pc == util::tracefile::TEXT_RECORD)
+		{
+			uint32_t length;
+			if (!read_u32(data, end, length) || end - data < length)
+				break;
+			fwrite(data, 1, length, stdout);
+			data += length;
+			continue;
+		}
+
+		if (detect_loops)
+		{
+			// if this address was seen more than once recently, we're in a loop
+			int count = 0;
+			for (uint32_t elem : history)
+				if (elem == pc)
+					count++;
+			if (count > 1)
+			{
+				loops++;
+				continue;
+			}
+
+			// if we just finished looping, indicate as much
+			if (loops != 0)
+				printf("\n   (loops for %d instructions)\n\n", loops);
+			loops = 0;
+		}
+
+		printf("%0*X\n", int(addrchars), pc);
+		nextdex = (nextdex + 1) % TRACE_LOOPS;
+		history[nextdex] = pc;
+	}
+	if (loops != 0)
+		printf("\n   (loops for %d instructions)\n\n", loops);
+	if (data != end)
+		fprintf(stderr, "Warning: '%s' ends with an incomplete record\n", filename);
+	return 0;
+}
+
+
+/*-------------------------------------------------
+    main - primary entry point
+-------------------------------------------------*/
+
+int main(int argc, char *argv[])
+{
+	bool detect_loops = true;
+	bool badargs = false;
+	const char *filename = nullptr;
+	for (int argnum = 1; argnum < argc; argnum++)
+	{
+		if (!core_stricmp(argv[argnum], "-noloop"))
+			detect_loops = false;
+		else if (filename == nullptr)
+			filename = argv[argnum];
+		else
+			badargs = true;
+	}
+
+	if (badargs || filename == nullptr)
+	{
+		fprintf(stderr,
+			"Usage:\n"
+			"  tracedump [-noloop] <tracefile> -- print a binary debugger trace as text\n"
+			"\n"
+			"Addresses can be disassembled with unidasm against a dump of the traced memory.\n"
+		);
+		return 1;
+	}
+
+	return dump_trace(filename, detect_loops);
+}
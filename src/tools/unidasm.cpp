@@ -10,6 +10,7 @@
 
 #include "emu.h"
 #include "cpu/sparc/sparcdasm.h"
+#include "vecstream.h"
 
 #include <algorithm>
 #include <cstring>
@@ -59,6 +60,46 @@ struct options
 	const dasm_table_entry *dasm;
 	uint32_t                  skip;
 	uint32_t                  count;
+	uint8_t                   parallel;
+	const char *            indexfile;
+};
+
+
+// one disassembled instruction within a piece of the file
+struct dasm_line
+{
+	uint32_t                offset;     // input byte offset, relative to the skip point
+	offs_t                  pc;         // address of the instruction
+	uint32_t                text;       // offset of its first output line in the piece's text
+};
+
+
+// a piece of the file disassembled on its own, possibly on another thread
+struct dasm_chunk
+{
+	const options *         opts;
+	const uint8_t *           data;       // input, starting at the skip point
+	uint32_t                  available;  // input bytes readable from data
+	uint32_t                  start;      // first byte to disassemble
+	uint32_t                  end;        // disassemble instructions starting before this
+	offs_t                  pc;         // address of the first byte
+	uint32_t                  next;       // byte following the last instruction
+	offs_t                  nextpc;     // address following the last instruction
+	std::string             text;       // formatted output
+	std::vector<dasm_line>  lines;      // instructions in the output
+	osd_work_item *         item;       // work item, or nullptr if run inline
+};
+
+
+// input bytes per piece, and how many pieces may be in flight in the parallel mode
+static const uint32_t CHUNK_BYTES = 1 << 20;
+static const int CHUNKS_AHEAD = 32;
+
+// disassemblers known to keep no state between calls, so they can run on several threads at once
+static const char *const reentrant_dasm[] =
+{
+	"arm", "arm_be", "arm7", "arm7_be", "arm7thumb", "arm7thumbb",
+	"powerpc", "sh2", "sh4", "sh4be", "v810", "z80"
 };
 
 
@@ -412,6 +453,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 	bool pending_mode = false;
 	bool pending_skip = false;
 	bool pending_count = false;
+	bool pending_index = false;
 
 	memset(opts, 0, sizeof(*opts));
 
@@ -423,7 +465,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 		// is it a switch?
 		if (curarg[0] == '-')
 		{
-			if (pending_base || pending_arch || pending_mode || pending_skip || pending_count)
+			if (pending_base || pending_arch || pending_mode || pending_skip || pending_count || pending_index)
 				goto usage;
 
 			if (tolower((uint8_t)curarg[1]) == 'a')
@@ -444,6 +486,10 @@ static int parse_options(int argc, char *argv[], options *opts)
 				opts->norawbytes = true;
 			else if (tolower((uint8_t)curarg[1]) == 'u')
 				opts->upper = true;
+			else if (tolower((uint8_t)curarg[1]) == 'p')
+				opts->parallel = true;
+			else if (tolower((uint8_t)curarg[1]) == 'i')
+				pending_index = true;
 			else
 				goto usage;
 		}
@@ -500,6 +546,13 @@ static int parse_options(int argc, char *argv[], options *opts)
 			pending_count = false;
 		}
 
+		// index file
+		else if (pending_index)
+		{
+			opts->indexfile = curarg;
+			pending_index = false;
+		}
+
 		// filename
 		else if (opts->filename == nullptr)
 			opts->filename = curarg;
@@ -510,7 +563,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 	}
 
 	// if we have a dangling option, error
-	if (pending_base || pending_arch || pending_mode || pending_skip || pending_count)
+	if (pending_base || pending_arch || pending_mode || pending_skip || pending_count || pending_index)
 		goto usage;
 
 	// if no file or no architecture, fail
@@ -521,7 +574,10 @@ static int parse_options(int argc, char *argv[], options *opts)
 usage:
 	printf("Usage: %s <filename> -arch <architecture> [-basepc <pc>] \n", argv[0]);
 	printf("   [-mode <n>] [-norawbytes] [-flipped] [-upper] [-lower]\n");
-	printf("   [-skip <n>] [-count <n>]\n");
+	printf("   [-skip <n>] [-count <n>] [-parallel] [-index <file>]\n");
+	printf("\n");
+	printf("-parallel maps the file and disassembles pieces of it on several threads\n");
+	printf("-index writes a binary index of instruction addresses to output offsets\n");
 	printf("\n");
 	printf("Supported architectures:");
 	const int colwidth = 1 + std::strlen(std::max_element(std::begin(dasm_table), std::end(dasm_table), [](const dasm_table_entry &a, const dasm_table_entry &b) { return std::strlen(a.name) < std::strlen(b.name); })->name);
@@ -541,35 +597,41 @@ usage:
 };
 
 
-int main(int argc, char *argv[])
-{
-	osd_file::error filerr;
-	int displayendian;
-	int displaychunk;
-	uint32_t curbyte;
-	uint32_t length;
-	int maxchunks;
-	uint32_t curpc;
-	options opts;
-	int numbytes;
-	void *data;
-	int result = 0;
+/*-------------------------------------------------
+    append_hex - append a display chunk of raw
+    bytes in hex
+-------------------------------------------------*/
 
-	// parse options first
-	if (parse_options(argc, argv, &opts))
-		return 1;
-
-	// load the file
-	filerr = util::core_file::load(opts.filename, &data, length);
-	if (filerr != osd_file::error::NONE)
+static void append_hex(std::string &text, const uint8_t *oprom, int displaychunk, int displayendian)
+{
+	static const char digits[] = "0123456789ABCDEF";
+	for (int bytenum = 0; bytenum < displaychunk; bytenum++)
 	{
-		fprintf(stderr, "Error opening file '%s'\n", opts.filename);
-		return 1;
+		uint8_t value = oprom[displayendian ? (displaychunk - 1 - bytenum) : bytenum];
+		text += digits[value >> 4];
+		text += digits[value & 15];
 	}
+	text += ' ';
+}
+
+
+/*-------------------------------------------------
+    disassemble_chunk - disassemble and format
+    the instructions starting in a piece of the
+    file
+-------------------------------------------------*/
+
+static void disassemble_chunk(dasm_chunk &chunk)
+{
+	const options &opts = *chunk.opts;
+	char address[32];
+	uint8_t tail[64];
+	int numbytes;
 
 	// precompute parameters
-	displaychunk = (opts.dasm->display / 2) + 1;
-	displayendian = opts.dasm->display % 2;
+	int displaychunk = (opts.dasm->display / 2) + 1;
+	int displayendian = opts.dasm->display % 2;
+	int maxchunks;
 	switch (displaychunk)
 	{
 		case 1:     maxchunks = 6;  break;
@@ -577,126 +639,318 @@ int main(int argc, char *argv[])
 		default:    maxchunks = 1;  break;
 	}
 
-	// run it
-	try
+	chunk.text.clear();
+	chunk.lines.clear();
+
+	util::ovectorstream stream;
+	offs_t curpc = chunk.pc;
+	uint32_t curbyte;
+	for (curbyte = chunk.start; curbyte < chunk.end; curbyte += numbytes)
 	{
-		if (length > opts.skip)
-			length = length - opts.skip;
-		if ((length > opts.count) && (opts.count != 0))
-			length = opts.count;
-		curpc = opts.basepc;
+		const uint8_t *oprom = chunk.data + curbyte;
+		uint32_t pcdelta;
+		int numchunks;
 
-		std::stringstream stream;
-		for (curbyte = 0; curbyte < length; curbyte += numbytes)
+		// near the end of the input, read from a padded copy so decoding never runs off it
+		if (chunk.available - curbyte < sizeof(tail))
 		{
-			uint8_t *oprom = (uint8_t *)data + opts.skip + curbyte;
-			uint32_t pcdelta;
-			int numchunks;
+			memset(tail, 0, sizeof(tail));
+			memcpy(tail, oprom, chunk.available - curbyte);
+			oprom = tail;
+		}
 
-			// disassemble
-			stream.str("");
-			pcdelta = (*opts.dasm->func)(nullptr, stream, curpc, oprom, oprom, opts.mode) & DASMFLAG_LENGTHMASK;
-			std::string buffer = stream.str();
+		// disassemble
+		stream.rdbuf()->clear();
+		pcdelta = (*opts.dasm->func)(nullptr, stream, curpc, oprom, oprom, opts.mode) & DASMFLAG_LENGTHMASK;
+		std::string buffer(stream.vec().begin(), stream.vec().end());
 
-			if (opts.dasm->pcshift < 0)
-				numbytes = pcdelta << -opts.dasm->pcshift;
-			else
-				numbytes = pcdelta >> opts.dasm->pcshift;
+		if (opts.dasm->pcshift < 0)
+			numbytes = pcdelta << -opts.dasm->pcshift;
+		else
+			numbytes = pcdelta >> opts.dasm->pcshift;
 
-			// force upper or lower
-			if (opts.lower)
-			{
-				std::transform(
-					std::begin(buffer),
-					std::end(buffer),
-					std::begin(buffer),
-					[](char c) { return tolower(c); });
-			}
-			else if (opts.upper)
+		// force upper or lower
+		if (opts.lower)
+		{
+			std::transform(
+				std::begin(buffer),
+				std::end(buffer),
+				std::begin(buffer),
+				[](char c) { return tolower(c); });
+		}
+		else if (opts.upper)
+		{
+			std::transform(
+				std::begin(buffer),
+				std::end(buffer),
+				std::begin(buffer),
+				[](char c) { return toupper(c); });
+		}
+
+		// round to the nearest display chunk
+		numbytes = ((numbytes + displaychunk - 1) / displaychunk) * displaychunk;
+		if (numbytes == 0)
+			numbytes = displaychunk;
+		numchunks = numbytes / displaychunk;
+
+		chunk.lines.push_back(dasm_line{ curbyte, curpc, uint32_t(chunk.text.size()) });
+
+		// non-flipped case
+		if (!opts.flipped)
+		{
+			// output the address
+			snprintf(address, sizeof(address), "%08X: ", curpc);
+			chunk.text += address;
+
+			// output the raw bytes
+			if (!opts.norawbytes)
 			{
-				std::transform(
-					std::begin(buffer),
-					std::end(buffer),
-					std::begin(buffer),
-					[](char c) { return toupper(c); });
+				int firstchunks = (numchunks < maxchunks) ? numchunks : maxchunks;
+				int chunknum;
+				for (chunknum = 0; chunknum < firstchunks; chunknum++)
+				{
+					append_hex(chunk.text, oprom, displaychunk, displayendian);
+					oprom += displaychunk;
+				}
+				for ( ; chunknum < maxchunks; chunknum++)
+					chunk.text.append(displaychunk * 2 + 1, ' ');
+				chunk.text += ' ';
 			}
 
-			// round to the nearest display chunk
-			numbytes = ((numbytes + displaychunk - 1) / displaychunk) * displaychunk;
-			if (numbytes == 0)
-				numbytes = displaychunk;
-			numchunks = numbytes / displaychunk;
+			// output the disassembly
+			chunk.text += buffer;
+			chunk.text += '\n';
 
-			// non-flipped case
-			if (!opts.flipped)
+			// output additional raw bytes
+			if (!opts.norawbytes && numchunks > maxchunks)
 			{
-				// output the address
-				printf("%08X: ", curpc);
-
-				// output the raw bytes
-				if (!opts.norawbytes)
+				for (numchunks -= maxchunks; numchunks > 0; numchunks -= maxchunks)
 				{
 					int firstchunks = (numchunks < maxchunks) ? numchunks : maxchunks;
-					int chunknum, bytenum;
-					for (chunknum = 0; chunknum < firstchunks; chunknum++)
+					chunk.text += "          ";
+					for (int chunknum = 0; chunknum < firstchunks; chunknum++)
 					{
-						for (bytenum = 0; bytenum < displaychunk; bytenum++)
-							printf("%02X", oprom[displayendian ? (displaychunk - 1 - bytenum) : bytenum]);
-						printf(" ");
+						append_hex(chunk.text, oprom, displaychunk, displayendian);
 						oprom += displaychunk;
 					}
-					for ( ; chunknum < maxchunks; chunknum++)
-						printf("%*s ", displaychunk * 2, "");
-					printf(" ");
+					chunk.text += '\n';
 				}
+			}
+		}
 
-				// output the disassembly
-				printf("%s\n", buffer.c_str());
-
-				// output additional raw bytes
-				if (!opts.norawbytes && numchunks > maxchunks)
+		// flipped case
+		else
+		{
+			// output the disassembly and address
+			chunk.text += '\t';
+			chunk.text += buffer;
+			if (buffer.length() < 40)
+				chunk.text.append(40 - buffer.length(), ' ');
+			snprintf(address, sizeof(address), " ; %08X", curpc);
+			chunk.text += address;
+
+			// output the raw bytes
+			if (!opts.norawbytes)
+			{
+				chunk.text += ": ";
+				for (int chunknum = 0; chunknum < numchunks; chunknum++)
 				{
-					for (numchunks -= maxchunks; numchunks > 0; numchunks -= maxchunks)
-					{
-						int firstchunks = (numchunks < maxchunks) ? numchunks : maxchunks;
-						int chunknum, bytenum;
-						printf("          ");
-						for (chunknum = 0; chunknum < firstchunks; chunknum++)
-						{
-							for (bytenum = 0; bytenum < displaychunk; bytenum++)
-								printf("%02X", oprom[displayendian ? (displaychunk - 1 - bytenum) : bytenum]);
-							printf(" ");
-							oprom += displaychunk;
-						}
-						printf("\n");
-					}
+					append_hex(chunk.text, oprom, displaychunk, displayendian);
+					oprom += displaychunk;
 				}
 			}
+			chunk.text += '\n';
+		}
 
-			// flipped case
-			else
+		// advance
+		curpc += pcdelta;
+	}
+
+	chunk.next = curbyte;
+	chunk.nextpc = curpc;
+}
+
+
+static void *disassemble_chunk_static(void *param, int threadid)
+{
+	disassemble_chunk(*reinterpret_cast<dasm_chunk *>(param));
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    write_index - append index records for the
+    instructions written from a piece
+
+    The index file starts with the eight bytes
+    "UDASMIDX" and a little-endian 32-bit version
+    (1), followed by one 16-byte record per
+    instruction in output order: the 64-bit output
+    offset of its line, its 32-bit address and its
+    32-bit offset in the input file, all
+    little-endian.
+-------------------------------------------------*/
+
+static void write_index(FILE *index, const dasm_chunk &chunk, size_t first, uint64_t written, uint32_t skip)
+{
+	std::vector<uint8_t> records;
+	records.reserve((chunk.lines.size() - first) * 16);
+	auto const append = [&records] (uint64_t value, int bytes)
+	{
+		for (int byte = 0; byte < bytes; byte++)
+			records.push_back(uint8_t(value >> (byte * 8)));
+	};
+	for (size_t line = first; line < chunk.lines.size(); line++)
+	{
+		append(written + chunk.lines[line].text - chunk.lines[first].text, 8);
+		append(chunk.lines[line].pc, 4);
+		append(skip + chunk.lines[line].offset, 4);
+	}
+	fwrite(records.data(), 1, records.size(), index);
+}
+
+
+int main(int argc, char *argv[])
+{
+	osd_file::error filerr;
+	osd_file::ptr mapped;
+	uint32_t length;
+	options opts;
+	void *data = nullptr;
+	int result = 0;
+
+	// parse options first
+	if (parse_options(argc, argv, &opts))
+		return 1;
+
+	// map the file for the parallel mode, or load it
+	if (opts.parallel)
+	{
+		uint64_t filesize, maplength;
+		if (osd_file::open(opts.filename, OPEN_FLAG_READ, mapped, filesize) != osd_file::error::NONE || filesize == 0 || filesize > 0xffffffff || mapped->map_private(data, maplength) != osd_file::error::NONE)
+		{
+			mapped.reset();
+			data = nullptr;
+		}
+		else
+			length = uint32_t(maplength);
+	}
+	if (data == nullptr)
+	{
+		filerr = util::core_file::load(opts.filename, &data, length);
+		if (filerr != osd_file::error::NONE)
+		{
+			fprintf(stderr, "Error opening file '%s'\n", opts.filename);
+			return 1;
+		}
+	}
+
+	FILE *index = nullptr;
+	if (opts.indexfile != nullptr)
+	{
+		index = fopen(opts.indexfile, "wb");
+		if (index == nullptr)
+		{
+			fprintf(stderr, "Error creating index file '%s'\n", opts.indexfile);
+			if (!mapped)
+				free(data);
+			return 1;
+		}
+		static const uint8_t header[12] = { 'U', 'D', 'A', 'S', 'M', 'I', 'D', 'X', 1, 0, 0, 0 };
+		fwrite(header, 1, sizeof(header), index);
+	}
+
+	// output goes through a large buffer rather than a flush per line
+	setvbuf(stdout, nullptr, _IOFBF, 1 << 20);
+
+	// only disassemblers without shared state can run on several threads
+	osd_work_queue *queue = nullptr;
+	if (opts.parallel)
+	{
+		if (std::find_if(std::begin(reentrant_dasm), std::end(reentrant_dasm), [&opts] (const char *name) { return core_stricmp(name, opts.dasm->name) == 0; }) != std::end(reentrant_dasm))
+			queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+		else
+			fprintf(stderr, "The %s disassembler can't run on several threads, disassembling serially\n", opts.dasm->name);
+	}
+
+	// run it
+	try
+	{
+		uint32_t available = (length > opts.skip) ? length - opts.skip : 0;
+		length = available;
+		if ((length > opts.count) && (opts.count != 0))
+			length = opts.count;
+
+		// split the input into pieces on display chunk boundaries, where fixed-length instructions start
+		uint32_t displaychunk = (opts.dasm->display / 2) + 1;
+		uint32_t chunkbytes = CHUNK_BYTES / displaychunk * displaychunk;
+		std::vector<std::unique_ptr<dasm_chunk>> chunks;
+		for (uint32_t start = 0; start < length; start += std::min(chunkbytes, length - start))
+		{
+			auto chunk = std::make_unique<dasm_chunk>();
+			chunk->opts = &opts;
+			chunk->data = (const uint8_t *)data + opts.skip;
+			chunk->available = available;
+			chunk->start = start;
+			chunk->end = start + std::min(chunkbytes, length - start);
+			chunk->pc = opts.basepc + ((opts.dasm->pcshift < 0) ? (start >> -opts.dasm->pcshift) : (start << opts.dasm->pcshift));
+			chunk->item = nullptr;
+			chunks.push_back(std::move(chunk));
+		}
+
+		uint32_t curbyte = 0;
+		offs_t curpc = opts.basepc;
+		uint64_t written = 0;
+		size_t queued = 0;
+		for (size_t chunknum = 0; chunknum < chunks.size(); chunknum++)
+		{
+			dasm_chunk &chunk = *chunks[chunknum];
+
+			// keep the queue ahead of the writer
+			for ( ; queue != nullptr && queued < chunks.size() && queued < chunknum + CHUNKS_AHEAD; queued++)
+				chunks[queued]->item = osd_work_item_queue(queue, disassemble_chunk_static, chunks[queued].get(), 0);
+
+			size_t first = 0;
+			if (chunk.item != nullptr)
 			{
-				// output the disassembly and address
-				printf("\t%-40s ; %08X", buffer.c_str(), curpc);
+				osd_work_item_wait(chunk.item, 100 * osd_ticks_per_second());
+				osd_work_item_release(chunk.item);
+				chunk.item = nullptr;
 
-				// output the raw bytes
-				if (!opts.norawbytes)
+				// pick up where the previous piece left off; if its last instruction ran
+				// into this piece and decoding never fell back into step, redo it from there
+				if (chunk.start != curbyte || chunk.pc != curpc)
 				{
-					int chunknum, bytenum;
-					printf(": ");
-					for (chunknum = 0; chunknum < numchunks; chunknum++)
+					auto const sync = std::find_if(chunk.lines.begin(), chunk.lines.end(), [curbyte, curpc] (const dasm_line &line) { return line.offset == curbyte && line.pc == curpc; });
+					if (sync != chunk.lines.end())
+						first = sync - chunk.lines.begin();
+					else
 					{
-						for (bytenum = 0; bytenum < displaychunk; bytenum++)
-							printf("%02X", oprom[displayendian ? (displaychunk - 1 - bytenum) : bytenum]);
-						printf(" ");
-						oprom += displaychunk;
+						chunk.start = curbyte;
+						chunk.pc = curpc;
+						disassemble_chunk(chunk);
 					}
 				}
-				printf("\n");
+			}
+			else
+			{
+				chunk.start = curbyte;
+				chunk.pc = curpc;
+				disassemble_chunk(chunk);
 			}
 
-			// advance
-			curpc += pcdelta;
+			// write out the instructions from the sync point on
+			if (first < chunk.lines.size())
+			{
+				uint32_t textstart = chunk.lines[first].text;
+				fwrite(chunk.text.data() + textstart, 1, chunk.text.size() - textstart, stdout);
+				if (index != nullptr)
+					write_index(index, chunk, first, written, opts.skip);
+				written += chunk.text.size() - textstart;
+			}
+			curbyte = chunk.next;
+			curpc = chunk.nextpc;
+			chunks[chunknum].reset();
 		}
 	}
 	catch (emu_fatalerror &fatal)
@@ -727,7 +981,14 @@ int main(int argc, char *argv[])
 		result = 1;
 	}
 
-	free(data);
+	// outstanding work items must finish before their pieces go
+	if (queue != nullptr)
+		osd_work_queue_free(queue);
+	if (index != nullptr)
+		fclose(index);
+	fflush(stdout);
+	if (!mapped)
+		free(data);
 
 	return result;
 }
@@ -0,0 +1,45 @@
+#include "catch.hpp"
+
+#include "emucore.h"
+#include "sound/mpeg_audio.h"
+
+#include <cmath>
+
+// deterministic samples in [-range, range)
+static double random_sample(u32 &seed, double range)
+{
+	seed = seed * 1103515245 + 12345;
+	return (double(seed >> 8) / double(1 << 24) * 2 - 1) * range;
+}
+
+TEST_CASE("Factored idct32 matches the direct formula", "[mpeg_audio]")
+{
+	u32 seed = 0x12345678;
+	for (int pass = 0; pass < 1000; pass++)
+	{
+		double input[32], fast[32], reference[32];
+		for (int i = 0; i < 32; i++)
+			input[i] = random_sample(seed, 2.0);
+		mpeg_audio::idct32(input, fast);
+		mpeg_audio::idct32_reference(input, reference);
+		for (int i = 0; i < 32; i++)
+			REQUIRE(std::fabs(fast[i] - reference[i]) < 1e-12);
+	}
+}
+
+TEST_CASE("Vectorized resynthesis is bit-identical to the direct formula", "[mpeg_audio]")
+{
+	u32 seed = 0x87654321;
+	for (int pass = 0; pass < 1000; pass++)
+	{
+		// the window reads 16 blocks of 32 values around the input pointer
+		double buffer[32*32];
+		double fast[32], reference[32];
+		for (double &value : buffer)
+			value = random_sample(seed, 4.0);
+		mpeg_audio::resynthesis(buffer + 16, fast);
+		mpeg_audio::resynthesis_reference(buffer + 16, reference);
+		for (int i = 0; i < 32; i++)
+			REQUIRE(fast[i] == reference[i]);
+	}
+}
@@ -9,3 +9,19 @@ TEST_CASE("convert 1 sec to attotime", "[emu]")
    attotime value = attotime::from_seconds(1);
    REQUIRE(value.as_attoseconds() == 1000000000000000000);
 }
+
+TEST_CASE("multiply attotime by small and large factors", "[emu]")
+{
+   REQUIRE(attotime(0, 999999999999999999) * 7 == attotime(6, 999999999999999993));
+   REQUIRE(attotime(2, 500000000000000000) * 100 == attotime(250, 0));
+   REQUIRE(attotime(1, 1) * 0 == attotime::zero);
+   REQUIRE((attotime(500000000, 0) * 2).is_never());
+}
+
+TEST_CASE("divide attotime with small and large remainders", "[emu]")
+{
+   REQUIRE(attotime(3, 1) / 2 == attotime(1, 500000000000000001));
+   REQUIRE(attotime(99, 0) / 50 == attotime(1, 980000000000000000));
+   REQUIRE(attotime(0, 1001) / 4 == attotime(0, 250));
+   REQUIRE(attotime(0, 1000) / 0 == attotime(0, 1000));
+}
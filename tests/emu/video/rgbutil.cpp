@@ -1034,3 +1034,284 @@ TEST_CASE("check rgb", "[emu][video]")
 		check_expected();
 	}
 }
+
+
+TEST_CASE("check rgb8", "[emu][video]")
+{
+	/*
+	    This checks the two-pixel rgbaint8_t against the results of
+	    performing the same operation on two separate rgbaint_t values,
+	    so it relies on the rgbaint_t tests above for correctness of the
+	    underlying maths.
+	*/
+
+	rgbaint_t pixel0, pixel1, other0, other1;
+	rgbaint8_t rgb8, other8;
+	auto random_pixel = [] (rgbaint_t &pixel)
+	{
+		pixel.set(random_i32(), random_i32(), random_i32(), random_i32());
+	};
+	auto random_bytes = [] (rgbaint_t &pixel)
+	{
+		pixel.set(random_u32());
+	};
+	auto check_expected = [&] ()
+	{
+		const rgbaint_t actual0 = rgb8.pixel0();
+		const rgbaint_t actual1 = rgb8.pixel1();
+		REQUIRE(actual0.get_a32() == pixel0.get_a32());
+		REQUIRE(actual0.get_r32() == pixel0.get_r32());
+		REQUIRE(actual0.get_g32() == pixel0.get_g32());
+		REQUIRE(actual0.get_b32() == pixel0.get_b32());
+		REQUIRE(actual1.get_a32() == pixel1.get_a32());
+		REQUIRE(actual1.get_r32() == pixel1.get_r32());
+		REQUIRE(actual1.get_g32() == pixel1.get_g32());
+		REQUIRE(actual1.get_b32() == pixel1.get_b32());
+	};
+
+	random_pixel(pixel0);
+	random_pixel(pixel1);
+	random_pixel(other0);
+	random_pixel(other1);
+
+	// check set/get
+	SECTION("rgbaint8_t::set(rgbaint_t, rgbaint_t)")
+	{
+		rgb8.set(pixel0, pixel1);
+		check_expected();
+	}
+
+	SECTION("rgbaint8_t::set(u32, u32)")
+	{
+		const u32 packed0 = random_u32();
+		const u32 packed1 = random_u32();
+		rgb8.set(packed0, packed1);
+		pixel0.set(packed0);
+		pixel1.set(packed1);
+		check_expected();
+	}
+
+	SECTION("rgbaint8_t::to_rgba")
+	{
+		u32 packed[2];
+		rgb8.set(pixel0, pixel1);
+		rgb8.to_rgba(packed);
+		REQUIRE(packed[0] == u32(pixel0.to_rgba_clamp()));
+		REQUIRE(packed[1] == u32(pixel1.to_rgba_clamp()));
+	}
+
+	// check arithmetic
+	SECTION("rgbaint8_t::add")
+	{
+		rgb8.set(pixel0, pixel1);
+		rgb8.add(rgbaint8_t(other0, other1));
+		pixel0.add(other0);
+		pixel1.add(other1);
+		check_expected();
+	}
+
+	SECTION("rgbaint8_t::add_imm")
+	{
+		const s32 imm = random_i32();
+		rgb8.set(pixel0, pixel1);
+		rgb8.add_imm(imm);
+		pixel0.add_imm(imm);
+		pixel1.add_imm(imm);
+		check_expected();
+	}
+
+	SECTION("rgbaint8_t::sub")
+	{
+		rgb8.set(pixel0, pixel1);
+		rgb8.sub(rgbaint8_t(other0, other1));
+		pixel0.sub(other0);
+		pixel1.sub(other1);
+		check_expected();
+	}
+
+	SECTION("rgbaint8_t::subr_imm")
+	{
+		const s32 imm = random_i32();
+		rgb8.set(pixel0, pixel1);
+		rgb8.subr_imm(imm);
+		pixel0.subr_imm(imm);
+		pixel1.subr_imm(imm);
+		check_expected();
+	}
+
+	SECTION("rgbaint8_t::mul")
+	{
+		rgb8.set(pixel0, pixel1);
+		rgb8.mul(rgbaint8_t(other0, other1));
+		pixel0.mul(other0);
+		pixel1.mul(other1);
+		check_expected();
+	}
+
+	SECTION("rgbaint8_t::operator*=")
+	{
+		const s32 imm = random_i32();
+		rgb8.set(pixel0, pixel1);
+		rgb8 *= imm;
+		pixel0.mul_imm(imm);
+		pixel1.mul_imm(imm);
+		check_expected();
+	}
+
+	// check shifts
+	SECTION("rgbaint8_t::shl")
+	{
+		rgb8.set(pixel0, pixel1);
+		rgb8.shl(rgbaint8_t(rgbaint_t(19, 3, 21, 6), rgbaint_t(0, 31, 12, 1)));
+		pixel0.shl(rgbaint_t(19, 3, 21, 6));
+		pixel1.shl(rgbaint_t(0, 31, 12, 1));
+		check_expected();
+	}
+
+	SECTION("rgbaint8_t::shr")
+	{
+		rgb8.set(pixel0, pixel1);
+		rgb8.shr(rgbaint8_t(rgbaint_t(8, 18, 26, 4), rgbaint_t(31, 0, 7, 15)));
+		pixel0.shr(rgbaint_t(8, 18, 26, 4));
+		pixel1.shr(rgbaint_t(31, 0, 7, 15));
+		check_expected();
+	}
+
+	SECTION("rgbaint8_t::sra")
+	{
+		rgb8.set(pixel0, pixel1);
+		rgb8.sra(rgbaint8_t(rgbaint_t(6, 1, 30, 11), rgbaint_t(2, 17, 0, 24)));
+		pixel0.sra(rgbaint_t(6, 1, 30, 11));
+		pixel1.sra(rgbaint_t(2, 17, 0, 24));
+		check_expected();
+	}
+
+	SECTION("rgbaint8_t::shl_imm/shr_imm/sra_imm")
+	{
+		rgb8.set(pixel0, pixel1);
+		rgb8.shl_imm(3);
+		rgb8.sra_imm(9);
+		rgb8.shr_imm(2);
+		pixel0.shl_imm(3);
+		pixel0.sra_imm(9);
+		pixel0.shr_imm(2);
+		pixel1.shl_imm(3);
+		pixel1.sra_imm(9);
+		pixel1.shr_imm(2);
+		check_expected();
+	}
+
+	// check logical operations
+	SECTION("rgbaint8_t::and_reg/or_reg/xor_reg/andnot_reg")
+	{
+		rgb8.set(pixel0, pixel1);
+		other8.set(other0, other1);
+		rgb8.xor_reg(other8);
+		rgb8.andnot_reg(other8);
+		rgb8.or_reg(rgbaint8_t(other1, other0));
+		rgb8.and_reg(other8);
+		pixel0.xor_reg(other0);
+		pixel0.andnot_reg(other0);
+		pixel0.or_reg(other1);
+		pixel0.and_reg(other0);
+		pixel1.xor_reg(other1);
+		pixel1.andnot_reg(other1);
+		pixel1.or_reg(other0);
+		pixel1.and_reg(other1);
+		check_expected();
+	}
+
+	// check clamping and scaling
+	SECTION("rgbaint8_t::clamp_to_uint8")
+	{
+		pixel0.sra_imm(22);
+		pixel1.sra_imm(22);
+		rgb8.set(pixel0, pixel1);
+		rgb8.clamp_to_uint8();
+		pixel0.clamp_to_uint8();
+		pixel1.clamp_to_uint8();
+		check_expected();
+	}
+
+	SECTION("rgbaint8_t::min/max")
+	{
+		rgb8.set(pixel0, pixel1);
+		rgb8.min(0x12345678);
+		rgb8.max(-0x1234567);
+		pixel0.min(0x12345678);
+		pixel0.max(-0x1234567);
+		pixel1.min(0x12345678);
+		pixel1.max(-0x1234567);
+		check_expected();
+	}
+
+	SECTION("rgbaint8_t::blend")
+	{
+		const u8 factor = u8(random_u32());
+		random_bytes(pixel0);
+		random_bytes(pixel1);
+		random_bytes(other0);
+		random_bytes(other1);
+		rgb8.set(pixel0, pixel1);
+		rgb8.blend(rgbaint8_t(other0, other1), factor);
+		pixel0.blend(other0, factor);
+		pixel1.blend(other1, factor);
+		check_expected();
+	}
+
+	SECTION("rgbaint8_t::scale_imm_and_clamp")
+	{
+		const s32 scale = random_u32() & 0x1ff;
+		random_bytes(pixel0);
+		random_bytes(pixel1);
+		rgb8.set(pixel0, pixel1);
+		rgb8.scale_imm_and_clamp(scale);
+		pixel0.scale_imm_and_clamp(scale);
+		pixel1.scale_imm_and_clamp(scale);
+		check_expected();
+	}
+
+	SECTION("rgbaint8_t::scale_add_and_clamp")
+	{
+		rgbaint_t scale0, scale1;
+		random_bytes(pixel0);
+		random_bytes(pixel1);
+		random_bytes(other0);
+		random_bytes(other1);
+		random_bytes(scale0);
+		random_bytes(scale1);
+		rgb8.set(pixel0, pixel1);
+		rgb8.scale_add_and_clamp(rgbaint8_t(scale0, scale1), rgbaint8_t(other0, other1));
+		pixel0.scale_add_and_clamp(scale0, other0);
+		pixel1.scale_add_and_clamp(scale1, other1);
+		check_expected();
+	}
+
+	// check comparisons
+	SECTION("rgbaint8_t::cmpeq/cmpgt/cmplt")
+	{
+		rgbaint8_t lt8, gt8;
+		other8.set(other0, pixel1);
+		rgb8.set(pixel0, pixel1);
+		lt8 = gt8 = rgb8;
+		rgb8.cmpeq(other8);
+		gt8.cmpgt(other8);
+		lt8.cmplt(other8);
+		rgbaint_t lt0(pixel0), lt1(pixel1), gt0(pixel0), gt1(pixel1);
+		gt0.cmpgt(other0);
+		gt1.cmpgt(pixel1);
+		lt0.cmplt(other0);
+		lt1.cmplt(pixel1);
+		pixel0.cmpeq(other0);
+		pixel1.cmpeq(pixel1);
+		check_expected();
+		rgb8 = gt8;
+		pixel0 = gt0;
+		pixel1 = gt1;
+		check_expected();
+		rgb8 = lt8;
+		pixel0 = lt0;
+		pixel1 = lt1;
+		check_expected();
+	}
+}
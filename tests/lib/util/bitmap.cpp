@@ -0,0 +1,71 @@
+#include "catch.hpp"
+
+#include "bitmap.h"
+
+#include <cstdint>
+
+TEST_CASE("Aligned bitmaps start every row on an aligned address", "[bitmap]")
+{
+	bitmap_ind16 ind16;
+	ind16.set_row_alignment(bitmap_t::CACHE_LINE_BYTES);
+	ind16.allocate(321, 17, 3, 2);
+	REQUIRE(ind16.rowbytes() % bitmap_t::CACHE_LINE_BYTES == 0);
+	REQUIRE(ind16.rowpixels() >= 321 + 2 * 3);
+	for (int y = 0; y < ind16.height(); y++)
+		REQUIRE(uintptr_t(&ind16.pix(y)) % bitmap_t::CACHE_LINE_BYTES == 0);
+
+	// slop stays addressable on both sides
+	ind16.pix(-2, -3) = 1;
+	ind16.pix(16 + 2, 320 + 3) = 2;
+	REQUIRE(ind16.pix(0, 0) == 0);
+
+	// shrinking reuses the memory and keeps the alignment
+	ind16.resize(100, 10);
+	REQUIRE(ind16.rowbytes() % bitmap_t::CACHE_LINE_BYTES == 0);
+	REQUIRE(uintptr_t(&ind16.pix(0)) % bitmap_t::CACHE_LINE_BYTES == 0);
+
+	bitmap_rgb32 rgb32;
+	rgb32.set_row_alignment(32);
+	rgb32.allocate(7, 5);
+	REQUIRE(rgb32.rowpixels() == 8);
+	for (int y = 0; y < rgb32.height(); y++)
+		REQUIRE(uintptr_t(&rgb32.pix(y)) % 32 == 0);
+}
+
+TEST_CASE("Unaligned bitmaps keep their packed layout", "[bitmap]")
+{
+	bitmap_ind16 ind16(321, 17, 3, 2);
+	REQUIRE(ind16.rowpixels() == 321 + 2 * 3);
+	REQUIRE(ind16.pix(5, 7) == 0);
+}
+
+TEST_CASE("Subrectangle views share the source pixels", "[bitmap]")
+{
+	bitmap_ind16 source;
+	source.set_row_alignment(bitmap_t::CACHE_LINE_BYTES);
+	source.allocate(64, 32);
+
+	bitmap_ind16 view;
+	view.wrap(source, rectangle(8, 23, 4, 11));
+	REQUIRE(view.width() == 16);
+	REQUIRE(view.height() == 8);
+	REQUIRE(view.rowpixels() == source.rowpixels());
+	view.pix(1, 2) = 0x1234;
+	REQUIRE(source.pix(5, 10) == 0x1234);
+}
+
+TEST_CASE("Only bitmaps that own their pixels report an allocation", "[bitmap]")
+{
+	bitmap_ind16 source(64, 32);
+	REQUIRE(source.allocated_bytes() >= 64 * 32 * sizeof(uint16_t));
+
+	bitmap_ind16 view;
+	REQUIRE(view.allocated_bytes() == 0);
+	view.wrap(source, rectangle(8, 23, 4, 11));
+	REQUIRE(view.allocated_bytes() == 0);
+
+	// shrinking keeps the larger allocation around
+	uint32_t before = source.allocated_bytes();
+	source.resize(16, 16);
+	REQUIRE(source.allocated_bytes() == before);
+}
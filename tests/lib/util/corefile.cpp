@@ -0,0 +1,48 @@
+#include "catch.hpp"
+
+#include "corefile.h"
+#include <string.h>
+#include <vector>
+
+// write a file big enough to be read through a mapping, then read it back
+TEST_CASE("Large read-only files read the same through a mapping", "[corefile]")
+{
+	const char *const filename = "corefile_test.bin";
+	std::vector<uint8_t> data(1024 * 1024 + 123);
+	uint32_t seed = 0x13572468;
+	for (auto & elem : data)
+	{
+		seed = seed * 1103515245 + 12345;
+		elem = seed >> 24;
+	}
+
+	util::core_file::ptr file;
+	REQUIRE(util::core_file::open(filename, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE, file) == osd_file::error::NONE);
+	REQUIRE(file->write(&data[0], data.size()) == data.size());
+	file.reset();
+
+	REQUIRE(util::core_file::open(filename, OPEN_FLAG_READ, file) == osd_file::error::NONE);
+	REQUIRE(file->size() == data.size());
+
+	// small and large reads, across the end of the file
+	std::vector<uint8_t> buffer(data.size());
+	REQUIRE(file->read(&buffer[0], 7) == 7);
+	REQUIRE(memcmp(&buffer[0], &data[0], 7) == 0);
+	REQUIRE(file->read(&buffer[0], 100000) == 100000);
+	REQUIRE(memcmp(&buffer[0], &data[7], 100000) == 0);
+	REQUIRE(file->seek(-50, SEEK_END) == 0);
+	REQUIRE(file->read(&buffer[0], 1000) == 50);
+	REQUIRE(memcmp(&buffer[0], &data[data.size() - 50], 50) == 0);
+	REQUIRE(file->eof());
+
+	// the whole file is available without loading it
+	uint64_t length = 0;
+	const void *const mapped = file->mapped(length);
+	REQUIRE(mapped != nullptr);
+	REQUIRE(length == data.size());
+	REQUIRE(memcmp(mapped, &data[0], data.size()) == 0);
+	REQUIRE(file->buffer() == mapped);
+
+	file.reset();
+	osd_file::remove(filename);
+}
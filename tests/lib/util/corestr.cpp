@@ -60,3 +60,15 @@ TEST_CASE("String delete char", "[util]")
    REQUIRE(value == "Strng fr dng dlts");
 }
 
+
+TEST_CASE("String character sets", "[util]")
+{
+   REQUIRE(core_strcharset("") == 0);
+   REQUIRE(core_strcharset("Pac-Man") == core_strcharset("pacman-"));
+   REQUIRE(core_strcharset("Street Fighter II") == core_strcharset("street fighter ii"));
+   REQUIRE((core_strcharset("galaga88") & core_charbit('8')) != 0);
+   REQUIRE((core_strcharset("galaga88") & core_charbit('x')) == 0);
+   REQUIRE((core_strcharset("galaga88") & core_charbit('G')) != 0);
+   REQUIRE(core_charbit('a') != core_charbit('b'));
+   REQUIRE(core_charbit('0') != core_charbit('9'));
+}
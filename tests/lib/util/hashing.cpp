@@ -0,0 +1,73 @@
+#include "catch.hpp"
+
+#include "hashing.h"
+#include <zlib.h>
+#include <string.h>
+#include <vector>
+
+static std::vector<uint8_t> make_hash_source(uint32_t length)
+{
+	std::vector<uint8_t> data(length + 16);
+	uint32_t seed = 0x87654321;
+	for (auto & elem : data)
+	{
+		seed = seed * 1103515245 + 12345;
+		elem = seed >> 24;
+	}
+	return data;
+}
+
+// hash the same data with and without the CPU-specific code, in pieces
+// of the given size starting at the given misalignment
+static void compare_hashes(uint32_t length, uint32_t piece, uint32_t offset)
+{
+	std::vector<uint8_t> data = make_hash_source(length);
+	const uint8_t *base = &data[offset];
+
+	util::crc32_t crc[2];
+	util::sha1_t sha1[2];
+	for (int accel = 0; accel < 2; accel++)
+	{
+		util::set_hash_acceleration(accel != 0);
+		util::crc32_creator crccreator;
+		util::sha1_creator sha1creator;
+		for (uint32_t pos = 0; pos < length; pos += piece)
+		{
+			uint32_t chunk = std::min(piece, length - pos);
+			crccreator.append(base + pos, chunk);
+			sha1creator.append(base + pos, chunk);
+		}
+		crc[accel] = crccreator.finish();
+		sha1[accel] = sha1creator.finish();
+	}
+	util::set_hash_acceleration(true);
+
+	REQUIRE(crc[0] == util::crc32_t(crc32(0, base, length)));
+	REQUIRE(crc[1] == crc[0]);
+	REQUIRE(sha1[1] == sha1[0]);
+}
+
+TEST_CASE("CRC-32 and SHA-1 of known strings", "[hashing]")
+{
+	const char *check = "123456789";
+	REQUIRE(util::crc32_creator::simple(check, strlen(check)) == util::crc32_t(0xcbf43926));
+
+	const char *abc = "abc";
+	REQUIRE(util::sha1_creator::simple(abc, strlen(abc)).as_string() == "a9993e364706816aba3e25717850c26c9cd0d89d");
+
+	const char *longer = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+	REQUIRE(util::sha1_creator::simple(longer, strlen(longer)).as_string() == "84983e441c3bd26ebaae4aa1f95129e5e54670f1");
+}
+
+TEST_CASE("Accelerated hashes match the portable ones", "[hashing]")
+{
+	for (uint32_t length : { 0, 1, 15, 16, 63, 64, 65, 127, 128, 200, 1000, 4096, 65537 })
+		for (uint32_t offset : { 0, 1, 7 })
+			compare_hashes(length, length ? length : 1, offset);
+}
+
+TEST_CASE("Accelerated hashes match when appended in pieces", "[hashing]")
+{
+	for (uint32_t piece : { 1, 3, 17, 64, 100, 1024 })
+		compare_hashes(10000, piece, 3);
+}
@@ -0,0 +1,83 @@
+#include "catch.hpp"
+
+#include "huffman.h"
+#include <vector>
+
+static std::vector<uint8_t> make_huffman_source(uint32_t length, int spread)
+{
+	// skewed data so that some codes are short and others long
+	std::vector<uint8_t> data(length);
+	uint32_t seed = 0x12345678;
+	for (auto & elem : data)
+	{
+		seed = seed * 1103515245 + 12345;
+		uint32_t r = (seed >> 8) & 0xffff;
+		elem = (r % spread) * (r % 7 == 0 ? 37 : 1);
+	}
+	return data;
+}
+
+static void huffman_round_trip(uint32_t length, int spread)
+{
+	std::vector<uint8_t> source = make_huffman_source(length, spread);
+	std::vector<uint8_t> compressed(length * 2 + 1024);
+	uint32_t complength;
+	huffman_8bit_encoder encoder;
+	REQUIRE(encoder.encode(&source[0], length, &compressed[0], compressed.size(), complength) == HUFFERR_NONE);
+
+	std::vector<uint8_t> decoded(length);
+	huffman_8bit_decoder decoder;
+	REQUIRE(decoder.decode(&compressed[0], complength, &decoded[0], length) == HUFFERR_NONE);
+	REQUIRE(decoded == source);
+}
+
+TEST_CASE("Huffman round trip of a short buffer", "[util]")
+{
+	huffman_round_trip(100, 5);
+}
+
+TEST_CASE("Huffman round trip with mostly short codes", "[util]")
+{
+	huffman_round_trip(19584, 3);
+}
+
+TEST_CASE("Huffman round trip with long codes", "[util]")
+{
+	huffman_round_trip(19584, 256);
+}
+
+TEST_CASE("Huffman decode reports truncated input", "[util]")
+{
+	std::vector<uint8_t> source = make_huffman_source(4096, 40);
+	std::vector<uint8_t> compressed(8192 + 1024);
+	uint32_t complength;
+	huffman_8bit_encoder encoder;
+	REQUIRE(encoder.encode(&source[0], source.size(), &compressed[0], compressed.size(), complength) == HUFFERR_NONE);
+
+	std::vector<uint8_t> decoded(source.size());
+	huffman_8bit_decoder decoder;
+	REQUIRE(decoder.decode(&compressed[0], complength / 2, &decoded[0], decoded.size()) == HUFFERR_INPUT_BUFFER_TOO_SMALL);
+}
+
+TEST_CASE("Bitstream reads across refills", "[util]")
+{
+	uint8_t data[20];
+	for (int i = 0; i < 20; i++)
+		data[i] = i * 17 + 3;
+	bitstream_in bitbuf(data, sizeof(data));
+
+	// read in odd-sized pieces and compare against a bit-by-bit walk
+	uint32_t bitpos = 0;
+	for (int numbits : { 3, 13, 1, 32, 7, 29, 5, 17, 31, 9, 11 })
+	{
+		uint32_t expected = 0;
+		for (int bit = 0; bit < numbits; bit++, bitpos++)
+			expected = (expected << 1) | ((data[bitpos / 8] >> (7 - bitpos % 8)) & 1);
+		REQUIRE(bitbuf.read(numbits) == expected);
+	}
+	REQUIRE(bitbuf.read_offset() == (bitpos + 7) / 8);
+	REQUIRE(bitbuf.read(2) == (data[19] & 3));
+	REQUIRE(!bitbuf.overflow());
+	REQUIRE(bitbuf.read(16) == 0);
+	REQUIRE(bitbuf.overflow());
+}
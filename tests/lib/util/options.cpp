@@ -13,3 +13,48 @@ TEST_CASE("Empty options should have iterators same", "[util]")
 	core_options options;
 	REQUIRE(options.begin() == options.end());
 }
+
+TEST_CASE("Option values are parsed when set and reverted", "[util]")
+{
+	static const options_entry entries[] =
+	{
+		{ "number;n",  "5",   OPTION_INTEGER, "a number" },
+		{ "scale",     "1.5", OPTION_FLOAT,   "a float" },
+		{ "flag",      "0",   OPTION_BOOLEAN, "a flag" },
+		{ nullptr }
+	};
+	core_options options(entries);
+	REQUIRE(options.int_value("number") == 5);
+	REQUIRE(options.int_value("n") == 5);
+	REQUIRE(options.float_value("scale") == 1.5f);
+	REQUIRE(!options.bool_value("flag"));
+	REQUIRE(options.int_value("missing") == 0);
+
+	std::string error;
+	options.set_value("number", 42, OPTION_PRIORITY_HIGH, error);
+	options.set_value("flag", "1", OPTION_PRIORITY_HIGH, error);
+	REQUIRE(options.int_value("number") == 42);
+	REQUIRE(options.bool_value("flag"));
+
+	options.revert(OPTION_PRIORITY_HIGH, OPTION_PRIORITY_HIGH);
+	REQUIRE(options.int_value("number") == 5);
+	REQUIRE(!options.bool_value("flag"));
+
+	const char *argv[] = { "test", "-flag", "-noflag", nullptr };
+	REQUIRE(options.parse_command_line(3, const_cast<char **>(argv), OPTION_PRIORITY_HIGH, error));
+	REQUIRE(!options.bool_value("flag"));
+}
+
+TEST_CASE("Overriding an option replaces all its names", "[util]")
+{
+	static const options_entry entries[] =
+	{
+		{ "flag;f", "0", OPTION_BOOLEAN, "a flag" },
+		{ nullptr }
+	};
+	core_options options(entries);
+	options.add_entry("flag", "a new flag", OPTION_BOOLEAN, "1", true);
+	REQUIRE(options.bool_value("flag"));
+	REQUIRE(options.exists("noflag"));
+	REQUIRE(!options.exists("f"));
+}
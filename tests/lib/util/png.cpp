@@ -0,0 +1,55 @@
+#include "catch.hpp"
+
+#include "png.h"
+
+// write a bitmap large enough to be filtered and deflated in several
+// pieces, then read it back and compare every pixel
+static void check_round_trip(int width, int height, int level)
+{
+	const char *const filename = "png_test.png";
+	bitmap_rgb32 bitmap(width, height);
+	uint32_t seed = 0x13572468;
+	for (int y = 0; y < height; y++)
+		for (int x = 0; x < width; x++)
+		{
+			// flat blocks with a gradient and a little noise, so every filter gets picked
+			seed = seed * 1103515245 + 12345;
+			bitmap.pix32(y, x) = rgb_t(y * 255 / height, ((x / 8) * 7) ^ ((y / 8) * 13), (seed >> 24) & 0x03);
+		}
+
+	png_set_compression_level(level);
+	util::core_file::ptr file;
+	REQUIRE(util::core_file::open(filename, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE, file) == osd_file::error::NONE);
+	REQUIRE(png_write_bitmap(*file, nullptr, bitmap, 0, nullptr) == PNGERR_NONE);
+	file.reset();
+
+	bitmap_argb32 result;
+	REQUIRE(util::core_file::open(filename, OPEN_FLAG_READ, file) == osd_file::error::NONE);
+	REQUIRE(png_read_bitmap(*file, result) == PNGERR_NONE);
+	file.reset();
+	osd_file::remove(filename);
+
+	REQUIRE(result.width() == width);
+	REQUIRE(result.height() == height);
+	int mismatches = 0;
+	for (int y = 0; y < height; y++)
+		for (int x = 0; x < width; x++)
+			if ((result.pix32(y, x) & 0xffffff) != (bitmap.pix32(y, x) & 0xffffff))
+				mismatches++;
+	REQUIRE(mismatches == 0);
+	png_set_compression_level(0);
+}
+
+TEST_CASE("Large PNGs written in parallel pieces read back the same", "[png]")
+{
+	check_round_trip(1280, 720, 0);
+	check_round_trip(1280, 720, 1);
+	check_round_trip(1280, 720, 9);
+}
+
+TEST_CASE("Tiny PNGs written in one piece read back the same", "[png]")
+{
+	check_round_trip(1, 1, 0);
+	check_round_trip(7, 3, 0);
+	check_round_trip(1, 300, 0);
+}